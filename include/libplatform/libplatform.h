@@ -12,6 +12,9 @@
 namespace v8 {
 namespace platform {
 
+enum class WorkStealingSupport { kDisabled, kEnabled };
+enum class IdleTaskSupport { kDisabled, kEnabled };
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -19,9 +22,17 @@ namespace platform {
  * is the number of worker threads to allocate for background jobs. If a value
  * of zero is passed, a suitable default based on the current number of
  * processors online will be chosen.
+ * If |work_stealing_support| is enabled, every worker thread gets its own task
+ * queue and steals tasks from the other queues when its own queue is empty.
+ * Short running background tasks are then preferred over long running ones.
+ * If |idle_task_support| is enabled then the platform will accept idle
+ * tasks (IdleTasksEnabled will return true) and will rely on the embedder
+ * calling v8::platform::RunIdleTasks to process the idle tasks.
  */
 V8_PLATFORM_EXPORT v8::Platform* CreateDefaultPlatform(
-    int thread_pool_size = 0);
+    int thread_pool_size = 0,
+    WorkStealingSupport work_stealing_support = WorkStealingSupport::kDisabled,
+    IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled);
 
 /**
  * Pumps the message loop for the given isolate.
@@ -34,6 +45,19 @@ V8_PLATFORM_EXPORT v8::Platform* CreateDefaultPlatform(
 V8_PLATFORM_EXPORT bool PumpMessageLoop(v8::Platform* platform,
                                         v8::Isolate* isolate);
 
+/**
+ * Runs pending idle tasks for the given isolate until |idle_time_in_seconds|
+ * have passed or there are no more idle tasks. Returns the time in seconds
+ * that was actually spent running idle tasks.
+ *
+ * The caller has to make sure that this is called from the right thread.
+ * The |platform| has to be created using |CreateDefaultPlatform| with idle
+ * task support enabled.
+ */
+V8_PLATFORM_EXPORT double RunIdleTasks(v8::Platform* platform,
+                                       v8::Isolate* isolate,
+                                       double idle_time_in_seconds);
+
 /**
  * Attempts to set the tracing controller for the given platform.
  *
@@ -52,6 +52,33 @@ class V8_EXPORT FastAccessorBuilder {
   void operator=(const FastAccessorBuilder&) = delete;
 };
 
+// The types of the values a fast API call takes and returns:
+// - kVoid: no value; only allowed for the result, which is then undefined.
+// - kBool: a JavaScript boolean, passed as a C++ bool.
+// - kInt32: a JavaScript number, converted with ToInt32 to an int32_t.
+// - kWrappedObject: an object created from an ObjectTemplate with internal
+//   fields; the C function gets the void* stored in its first internal field
+//   with Object::SetAlignedPointerInInternalField.
+enum class FastApiType { kVoid, kBool, kInt32, kWrappedObject };
+
+// Allow the embedder to register a C function which optimized code may call
+// directly instead of the FunctionCallback of {function_template}, without
+// setting up a FunctionCallbackInfo. The C function takes the receiver
+// followed by the JavaScript arguments, converted as described by the
+// {parameter_count} entries of {parameter_types}, and returns a value of
+// {return_type}. Calls with a different number of arguments, or with values
+// which do not match the types, use the regular callback, so it must be
+// observably equivalent.
+//
+// The C function must not call into V8, allocate on the JavaScript heap or
+// throw, and is only called from optimized code on platforms with a C calling
+// convention for integer arguments. The callback must have been set on
+// {function_template} before, and it must not have been instantiated yet.
+V8_EXPORT void SetFastApiCall(Local<FunctionTemplate> function_template,
+                              void* c_function, FastApiType return_type,
+                              int parameter_count,
+                              const FastApiType* parameter_types);
+
 }  // namespace experimental
 }  // namespace v8
 
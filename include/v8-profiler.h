@@ -272,6 +272,44 @@ class V8_EXPORT CpuProfile {
   void Delete();
 };
 
+/**
+ * Receives the state of the inline caches of a function, see
+ * CpuProfiler::VisitInlineCaches.
+ */
+class V8_EXPORT InlineCacheVisitor {
+ public:
+  enum Kind {
+    kCall,
+    kLoad,
+    kLoadGlobal,
+    kKeyedLoad,
+    kStore,
+    kKeyedStore,
+    kBinaryOperation,
+    kCompareOperation
+  };
+
+  enum State {
+    kUninitialized,
+    kPremonomorphic,
+    kMonomorphic,
+    kRecomputeHandler,
+    kPolymorphic,
+    kMegamorphic,
+    kGeneric
+  };
+
+  virtual ~InlineCacheVisitor() {}
+
+  /**
+   * Called once for each inline cache. |slot| identifies the cache within
+   * the function's feedback vector and |map_count| is the number of
+   * receiver maps the cache currently holds.
+   */
+  virtual void VisitInlineCache(int slot, Kind kind, State state,
+                                int map_count) = 0;
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -328,6 +366,14 @@ class V8_EXPORT CpuProfiler {
    */
   void SetIdle(bool is_idle);
 
+  /**
+   * Reports the inline caches of |function| to |visitor|, in slot order.
+   * Does not require a running profile. Functions that have not been
+   * compiled yet have no inline caches.
+   */
+  static void VisitInlineCaches(Local<Function> function,
+                                InlineCacheVisitor* visitor);
+
  private:
   CpuProfiler();
   ~CpuProfiler();
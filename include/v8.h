@@ -143,6 +143,7 @@ class FastAccessorBuilder;
 
 namespace internal {
 class Arguments;
+class BackgroundCodeCacheCheckTask;
 class Heap;
 class HeapObject;
 class Isolate;
@@ -1220,12 +1221,17 @@ class V8_EXPORT ScriptCompiler {
     // alive.
     V8_INLINE const CachedData* GetCachedData() const;
 
+    // Whether the CachedData passed the checks of a ConsumeCodeCacheTask, so
+    // that consuming it only has to deserialize it.
+    V8_INLINE bool IsCachedDataChecked() const;
+
     // Prevent copying.
     Source(const Source&) = delete;
     Source& operator=(const Source&) = delete;
 
    private:
     friend class ScriptCompiler;
+    friend class internal::BackgroundCodeCacheCheckTask;
 
     Local<String> source_string;
 
@@ -1240,6 +1246,9 @@ class V8_EXPORT ScriptCompiler {
     // set), or hold newly generated cache data (kProduce*Cache flags) are
     // set when calling a compile method.
     CachedData* cached_data;
+
+    // Set by a ConsumeCodeCacheTask once cached_data passed its checks.
+    bool cached_data_checked;
   };
 
   /**
@@ -1326,12 +1335,24 @@ class V8_EXPORT ScriptCompiler {
     virtual void Run() = 0;
   };
 
+  /**
+   * A task which the embedder must run on a background thread to check code
+   * cache data before it is consumed. Returned by
+   * ScriptCompiler::StartConsumingCodeCache.
+   */
+  class ConsumeCodeCacheTask {
+   public:
+    virtual ~ConsumeCodeCacheTask() {}
+    virtual void Run() = 0;
+  };
+
   enum CompileOptions {
     kNoCompileOptions = 0,
     kProduceParserCache,
     kConsumeParserCache,
     kProduceCodeCache,
-    kConsumeCodeCache
+    kConsumeCodeCache,
+    kConsumeCompileHints
   };
 
   /**
@@ -1389,6 +1410,18 @@ class V8_EXPORT ScriptCompiler {
       Isolate* isolate, StreamedSource* source,
       CompileOptions options = kNoCompileOptions);
 
+  /**
+   * Like StartStreamingScript, but parses the source as an ES module. Tasks
+   * for different modules are independent of each other, so the embedder can
+   * run them in parallel on background threads, e.g. for all modules requested
+   * by a module graph, and compile the modules (see CompileModule below) and
+   * instantiate the graph once they are all done.
+   *
+   * This is an unfinished experimental feature, like CompileModule.
+   */
+  static ScriptStreamingTask* StartStreamingModule(Isolate* isolate,
+                                                   StreamedSource* source);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -1405,6 +1438,31 @@ class V8_EXPORT ScriptCompiler {
       Local<Context> context, StreamedSource* source,
       Local<String> full_source_string, const ScriptOrigin& origin);
 
+  /**
+   * Returns a task which checks the cached data of |source| when ran, or NULL
+   * if |source| has no cached data. The user is responsible for running the
+   * task on a background thread and deleting it. Once ConsumeCodeCacheTask::Run
+   * exits, |source| can be compiled with kConsumeCodeCache, which then only
+   * has to deserialize the data on the main thread. If the check failed, the
+   * cached data is marked as rejected.
+   *
+   * |source| must be kept alive and must not be compiled while the task runs.
+   */
+  static ConsumeCodeCacheTask* StartConsumingCodeCache(Isolate* isolate,
+                                                      Source* source);
+
+  /**
+   * Creates compile hints for |unbound_script|: cached data recording which of
+   * its functions have been compiled so far, e.g. during the start-up of a
+   * page. When the same source is compiled again with kConsumeCompileHints
+   * and this data, these functions are compiled eagerly along with the
+   * top-level code, rather than being preparsed first and parsed again when
+   * they are first called. Functions which have been optimized are
+   * optimized again as soon as their type feedback is stable. The caller owns
+   * the returned data.
+   */
+  static CachedData* CreateCompileHints(Local<UnboundScript> unbound_script);
+
   /**
    * Return a version tag for CachedData for the current V8 version & flags.
    *
@@ -1438,6 +1496,18 @@ class V8_EXPORT ScriptCompiler {
   static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
       Isolate* isolate, Source* source);
 
+  /**
+   * Compiles a streamed ES module, whose parsing was started with
+   * StartStreamingModule.
+   *
+   * This can only be called after the streaming has finished
+   * (ScriptStreamingTask has been run). As for streamed scripts, the embedder
+   * needs to pass the full source here.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<Module> CompileModule(
+      Local<Context> context, StreamedSource* source,
+      Local<String> full_source_string, const ScriptOrigin& origin);
+
   /**
    * Compile a function for a given context. This is equivalent to running
    *
@@ -1740,6 +1810,17 @@ class V8_EXPORT ValueSerializer {
      * Nothing<bool>() returned.
      */
     virtual Maybe<bool> WriteHostObject(Isolate* isolate, Local<Object> object);
+
+    /*
+     * Called when the serializer encounters a SharedArrayBuffer that was not
+     * passed to TransferSharedArrayBuffer. The embedder returns an id which
+     * is written instead of the contents, so that the same memory can be
+     * passed to ValueDeserializer::TransferSharedArrayBuffer when
+     * deserializing. If that is not possible, a suitable exception should be
+     * thrown and Nothing<uint32_t>() returned.
+     */
+    virtual Maybe<uint32_t> GetSharedArrayBufferId(
+        Isolate* isolate, Local<SharedArrayBuffer> shared_array_buffer);
   };
 
   explicit ValueSerializer(Isolate* isolate);
@@ -2913,6 +2994,15 @@ class V8_EXPORT Object : public Value {
                                                        uint32_t index,
                                                        Local<Value> value);
 
+  // Like calling CreateDataProperty for each of the |count| keys and values,
+  // but cheaper since the setup for calling into V8 is only done once.
+  //
+  // Stops at the first property which can't be created and returns false. The
+  // properties before it have been created.
+  V8_WARN_UNUSED_RESULT Maybe<bool> CreateDataProperties(
+      Local<Context> context, int count, const Local<Name> keys[],
+      const Local<Value> values[]);
+
   // Implements DefineOwnProperty.
   //
   // In general, CreateDataProperty will be faster, however, does not allow
@@ -2963,6 +3053,19 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets the values of the properties with the |count| given keys and stores
+   * them in |values|, like calling Get for each of them. This is cheaper than
+   * separate calls, since the setup for calling into V8 is only done once.
+   *
+   * Returns Nothing if getting a property throws. The values of the
+   * properties after it are undefined.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetMultiple(Local<Context> context,
+                                                int count,
+                                                const Local<Name> keys[],
+                                                Local<Value> values[]);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -3903,7 +4006,8 @@ class V8_EXPORT WasmCompiledModule : public Object {
   Local<String> GetWasmWireBytes();
 
   // Serialize the compiled module. The serialized data does not include the
-  // uncompiled bytes.
+  // uncompiled bytes, and is only accepted together with the same uncompiled
+  // bytes by the V8 version and flags that produced it.
   SerializedModule Serialize();
 
   // TODO(mtrofin): Back-compat. Move to private once change lands in Chrome.
@@ -3911,7 +4015,8 @@ class V8_EXPORT WasmCompiledModule : public Object {
   static MaybeLocal<WasmCompiledModule> Deserialize(
       Isolate* isolate, const SerializedModule& serialized_module);
   // If possible, deserialize the module, otherwise compile it from the provided
-  // uncompiled bytes.
+  // uncompiled bytes. The serialized data is rejected if it was produced for
+  // different uncompiled bytes.
   static MaybeLocal<WasmCompiledModule> DeserializeOrCompile(
       Isolate* isolate, const CallerOwnedBuffer& serialized_module,
       const CallerOwnedBuffer& wire_bytes);
@@ -3919,7 +4024,8 @@ class V8_EXPORT WasmCompiledModule : public Object {
 
  private:
   static MaybeLocal<WasmCompiledModule> Deserialize(
-      Isolate* isolate, const CallerOwnedBuffer& serialized_module);
+      Isolate* isolate, const CallerOwnedBuffer& serialized_module,
+      const CallerOwnedBuffer& wire_bytes);
   static MaybeLocal<WasmCompiledModule> Compile(Isolate* isolate,
                                                 const uint8_t* start,
                                                 size_t length);
@@ -5957,6 +6063,77 @@ class V8_EXPORT HeapStatistics {
 };
 
 
+/**
+ * Statistics about the last garbage collection that finished. All times are
+ * in milliseconds. Phases are reported by the collector that ran, so for a
+ * scavenge only scavenge_time(), weak_processing_time() and external_time()
+ * are set.
+ */
+class V8_EXPORT GCStatistics {
+ public:
+  GCStatistics();
+  GCType type() { return type_; }
+  double total_time() { return total_time_; }
+  double scavenge_time() { return scavenge_time_; }
+  // Includes the time spent in incremental marking steps.
+  double mark_time() { return mark_time_; }
+  double sweep_time() { return sweep_time_; }
+  double evacuate_time() { return evacuate_time_; }
+  double weak_processing_time() { return weak_processing_time_; }
+  // Time spent in GC prologue and epilogue callbacks and in weak callbacks.
+  double external_time() { return external_time_; }
+  size_t heap_size_before() { return heap_size_before_; }
+  size_t heap_size_after() { return heap_size_after_; }
+  // The ratio of new space objects that survived a scavenge.
+  double survival_ratio() { return survival_ratio_; }
+  // Allocation throughput over the last seconds, in bytes per millisecond.
+  double allocation_throughput() { return allocation_throughput_; }
+
+ private:
+  GCType type_;
+  double total_time_;
+  double scavenge_time_;
+  double mark_time_;
+  double sweep_time_;
+  double evacuate_time_;
+  double weak_processing_time_;
+  double external_time_;
+  size_t heap_size_before_;
+  size_t heap_size_after_;
+  double survival_ratio_;
+  double allocation_throughput_;
+
+  friend class Isolate;
+};
+
+
+/**
+ * Time (in milliseconds) and zone memory spent in one TurboFan phase, summed
+ * over all optimizing compilations since the statistics were enabled.
+ */
+class V8_EXPORT CompilePhaseStatistics {
+ public:
+  CompilePhaseStatistics();
+  // The group of phases this phase belongs to, e.g. "graph creation",
+  // "optimization" or "code generation".
+  const char* phase_kind_name() { return phase_kind_name_; }
+  const char* phase_name() { return phase_name_; }
+  double time() { return time_; }
+  size_t total_allocated_bytes() { return total_allocated_bytes_; }
+  // The most zone memory a single compilation used in this phase.
+  size_t max_allocated_bytes() { return max_allocated_bytes_; }
+
+ private:
+  const char* phase_kind_name_;
+  const char* phase_name_;
+  double time_;
+  size_t total_allocated_bytes_;
+  size_t max_allocated_bytes_;
+
+  friend class Isolate;
+};
+
+
 class V8_EXPORT HeapSpaceStatistics {
  public:
   HeapSpaceStatistics();
@@ -6148,6 +6325,21 @@ class V8_EXPORT PersistentHandleVisitor {  // NOLINT
                                      uint16_t class_id) {}
 };
 
+/**
+ * Interface for iterating through the runtime call stats of an isolate.
+ */
+class V8_EXPORT RuntimeCallStatsVisitor {  // NOLINT
+ public:
+  virtual ~RuntimeCallStatsVisitor() {}
+  /**
+   * Called for each runtime function, builtin, API function or other
+   * instrumented operation that was entered since the last reset, with the
+   * number of calls and the time spent in it excluding nested counters.
+   */
+  virtual void VisitRuntimeCallCounter(const char* name, int64_t count,
+                                       int64_t time_in_microseconds) {}
+};
+
 /**
  * Memory pressure level for the MemoryPressureNotification.
  * kNone hints V8 that there is no memory pressure.
@@ -6560,6 +6752,13 @@ class V8_EXPORT Isolate {
    */
   void GetHeapStatistics(HeapStatistics* heap_statistics);
 
+  /**
+   * Get statistics about the last garbage collection that finished. Inside
+   * GC callbacks, this is the garbage collection before the current one.
+   * Returns false if there was no garbage collection yet.
+   */
+  bool GetLastGCStatistics(GCStatistics* gc_statistics);
+
   /**
    * Returns the number of spaces in the heap.
    */
@@ -6577,6 +6776,29 @@ class V8_EXPORT Isolate {
   bool GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
                               size_t index);
 
+  /**
+   * Starts or stops recording per-phase statistics of TurboFan compilations.
+   * Stopping discards the statistics recorded so far.
+   */
+  void SetCompilePhaseStatisticsEnabled(bool enabled);
+
+  /**
+   * Returns the number of TurboFan phases statistics were recorded for.
+   */
+  size_t NumberOfCompilePhases();
+
+  /**
+   * Get the statistics of a TurboFan phase, in the order the phases first
+   * ran. The name strings stay valid until the statistics are disabled.
+   *
+   * \param phase_statistics The CompilePhaseStatistics object to fill in.
+   * \param index The index of the phase, which ranges from 0 to
+   *   NumberOfCompilePhases() - 1.
+   * \returns true on success.
+   */
+  bool GetCompilePhaseStatistics(CompilePhaseStatistics* phase_statistics,
+                                 size_t index);
+
   /**
    * Returns the number of types of objects tracked in the heap at GC.
    */
@@ -7117,6 +7339,18 @@ class V8_EXPORT Isolate {
    */
   void VisitWeakHandles(PersistentHandleVisitor* visitor);
 
+  /**
+   * Iterates through the runtime call stats collected by the isolate since
+   * the last call to ResetRuntimeCallStats(). Stats are only collected while
+   * --runtime-call-stats is set or runtime call stats tracing is enabled.
+   */
+  void VisitRuntimeCallStats(RuntimeCallStatsVisitor* visitor);
+
+  /**
+   * Resets all runtime call stats of the isolate to zero.
+   */
+  void ResetRuntimeCallStats();
+
   /**
    * Check if this isolate is in use.
    * True if at least one thread Enter'ed this isolate.
@@ -7894,6 +8128,21 @@ class V8_EXPORT Context {
       MaybeLocal<ObjectTemplate> global_template = MaybeLocal<ObjectTemplate>(),
       MaybeLocal<Value> global_object = MaybeLocal<Value>());
 
+  /**
+   * Replaces |context| with a new context created from the snapshot, which
+   * takes over the global object of |context|. Embedders holding on to the
+   * global object see fresh globals and built-ins afterwards, which is much
+   * cheaper than creating a new isolate. |context| is detached and the
+   * compilation cache entries for scripts compiled in it are dropped. The
+   * security token of |context| is carried over, its embedder data is not.
+   *
+   * \param global_template The global template which |context| was created
+   * with, if any.
+   */
+  static Local<Context> Reset(Local<Context> context,
+                              MaybeLocal<ObjectTemplate> global_template =
+                                  MaybeLocal<ObjectTemplate>());
+
   /**
    * Returns an global object that isn't backed by an actual context.
    *
@@ -8021,6 +8270,16 @@ class V8_EXPORT Context {
    */
   size_t EstimatedSize();
 
+  /**
+   * Returns the size in bytes of the live objects which the last full garbage
+   * collection attributed to this context: its JavaScript objects with their
+   * property and element backing stores, its functions and its scope
+   * contexts. Objects which are not owned by a single context, like strings
+   * and code, are not included. Returns 0 unless V8 runs with
+   * --track-context-live-size.
+   */
+  size_t LiveSizeAtLastGC();
+
   /**
    * Stack-allocated class which sets the execution context for all
    * operations executed within a local scope.
@@ -8874,12 +9133,13 @@ ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
       resource_column_offset(origin.ResourceColumnOffset()),
       resource_options(origin.Options()),
       source_map_url(origin.SourceMapUrl()),
-      cached_data(data) {}
+      cached_data(data),
+      cached_data_checked(false) {}
 
 
 ScriptCompiler::Source::Source(Local<String> string,
                                CachedData* data)
-    : source_string(string), cached_data(data) {}
+    : source_string(string), cached_data(data), cached_data_checked(false) {}
 
 
 ScriptCompiler::Source::~Source() {
@@ -8893,6 +9153,11 @@ const ScriptCompiler::CachedData* ScriptCompiler::Source::GetCachedData()
 }
 
 
+bool ScriptCompiler::Source::IsCachedDataChecked() const {
+  return cached_data_checked;
+}
+
+
 Local<Boolean> Boolean::New(Isolate* isolate, bool value) {
   return value ? True(isolate) : False(isolate);
 }
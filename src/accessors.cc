@@ -649,7 +649,8 @@ void Accessors::ScriptEvalFromScriptPositionGetter(
       Script::cast(Handle<JSValue>::cast(object)->value()), isolate);
   Handle<Object> result = isolate->factory()->undefined_value();
   if (script->compilation_type() == Script::COMPILATION_TYPE_EVAL) {
-    result = Handle<Object>(Smi::FromInt(script->GetEvalPosition()), isolate);
+    int position = Script::GetEvalPosition(script);
+    result = Handle<Object>(Smi::FromInt(position), isolate);
   }
   info.GetReturnValue().Set(Utils::ToLocal(result));
 }
@@ -34,12 +34,14 @@ namespace experimental {
 
 
 MaybeHandle<Code> BuildCodeFromFastAccessorBuilder(
-    v8::experimental::FastAccessorBuilder* fast_handler) {
+    v8::experimental::FastAccessorBuilder* fast_handler,
+    MaybeHandle<FixedArray>* program) {
   i::MaybeHandle<i::Code> code;
   if (fast_handler != nullptr) {
     auto faa = FromApi(fast_handler);
     code = faa->Build();
     CHECK(!code.is_null());
+    *program = faa->program();
     delete faa;
   }
   return code;
@@ -134,5 +136,48 @@ FastAccessorBuilder::ValueId FastAccessorBuilder::Call(
   return FromApi(this)->Call(callback, value_id);
 }
 
+STATIC_ASSERT(static_cast<int>(FastApiType::kVoid) ==
+              i::CallHandlerInfo::kFastCallVoid);
+STATIC_ASSERT(static_cast<int>(FastApiType::kBool) ==
+              i::CallHandlerInfo::kFastCallBool);
+STATIC_ASSERT(static_cast<int>(FastApiType::kInt32) ==
+              i::CallHandlerInfo::kFastCallInt32);
+STATIC_ASSERT(static_cast<int>(FastApiType::kWrappedObject) ==
+              i::CallHandlerInfo::kFastCallWrappedObject);
+
+void SetFastApiCall(Local<FunctionTemplate> function_template,
+                    void* c_function, FastApiType return_type,
+                    int parameter_count, const FastApiType* parameter_types) {
+  const char* location = "v8::experimental::SetFastApiCall";
+  auto info = Utils::OpenHandle(*function_template);
+  i::Isolate* isolate = info->GetIsolate();
+  if (!Utils::ApiCheck(!info->instantiated(), location,
+                       "FunctionTemplate already instantiated") ||
+      !Utils::ApiCheck(info->call_code()->IsCallHandlerInfo(), location,
+                       "FunctionTemplate has no callback") ||
+      !Utils::ApiCheck(parameter_count >= 1, location,
+                       "The receiver must be a parameter")) {
+    return;
+  }
+  for (int i = 0; i < parameter_count; ++i) {
+    if (!Utils::ApiCheck(parameter_types[i] != FastApiType::kVoid, location,
+                         "Parameters must not be void")) {
+      return;
+    }
+  }
+  i::HandleScope scope(isolate);
+  i::Handle<i::ByteArray> signature =
+      isolate->factory()->NewByteArray(parameter_count + 1, i::TENURED);
+  signature->set(0, static_cast<uint8_t>(return_type));
+  for (int i = 0; i < parameter_count; ++i) {
+    signature->set(i + 1, static_cast<uint8_t>(parameter_types[i]));
+  }
+  i::Handle<i::Foreign> target = isolate->factory()->NewForeign(
+      reinterpret_cast<i::Address>(c_function), i::TENURED);
+  i::CallHandlerInfo* call_info = i::CallHandlerInfo::cast(info->call_code());
+  call_info->set_fast_call_target(*target);
+  call_info->set_fast_call_signature(*signature);
+}
+
 }  // namespace experimental
 }  // namespace v8
@@ -10,6 +10,7 @@
 namespace v8 {
 namespace internal {
 class Code;
+class FixedArray;
 }  // internal;
 namespace experimental {
 class FastAccessorBuilder;
@@ -18,8 +19,11 @@ class FastAccessorBuilder;
 namespace internal {
 namespace experimental {
 
+// Builds the code of {fast_handler}, and stores the program TurboFan inlines
+// into {program}, if it could be recorded.
 v8::internal::MaybeHandle<v8::internal::Code> BuildCodeFromFastAccessorBuilder(
-    v8::experimental::FastAccessorBuilder* fast_handler);
+    v8::experimental::FastAccessorBuilder* fast_handler,
+    v8::internal::MaybeHandle<v8::internal::FixedArray>* program);
 
 }  // namespace experimental
 }  // namespace internal
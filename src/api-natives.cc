@@ -335,6 +335,38 @@ bool IsSimpleInstantiation(Isolate* isolate, ObjectTemplateInfo* info,
   return fun->context()->native_context() == isolate->raw_native_context();
 }
 
+// Returns true if |new_target| is a subclass of an API function for which
+// instantiating |info| is simple. Such instances are copies of the cached
+// instance with the prototype of the subclass, which keeps the layout.
+bool IsSimpleSubclassInstantiation(Isolate* isolate, ObjectTemplateInfo* info,
+                                   JSReceiver* new_target) {
+  DisallowHeapAllocation no_gc;
+
+  if (!new_target->IsJSFunction()) return false;
+  JSFunction* fun = JSFunction::cast(new_target);
+  if (!fun->has_initial_map()) return false;
+  Object* constructor = fun->initial_map()->GetConstructor();
+  if (!constructor->IsJSFunction()) return false;
+  return IsSimpleInstantiation(isolate, info, JSFunction::cast(constructor));
+}
+
+// Returns the map for subclass instances with |prototype|, derived from the
+// map of a cached instance, or an empty handle if there is no such map which
+// can be used for subclass instances only.
+MaybeHandle<Map> GetSubclassInstanceMap(Handle<Map> map,
+                                        Handle<Object> prototype) {
+  if (map->is_dictionary_map()) return MaybeHandle<Map>();
+  Handle<Map> new_map = TransitionArray::GetPrototypeTransition(map, prototype);
+  if (new_map.is_null()) {
+    new_map = Map::TransitionToPrototype(map, prototype, REGULAR_PROTOTYPE);
+    new_map->set_new_target_is_base(false);
+  }
+  // The transition may also have been created by changing the prototype of
+  // a regular instance.
+  if (new_map->new_target_is_base()) return MaybeHandle<Map>();
+  return new_map;
+}
+
 MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
                                         Handle<ObjectTemplateInfo> info,
                                         Handle<JSReceiver> new_target,
@@ -344,6 +376,25 @@ MaybeHandle<JSObject> InstantiateObject(Isolate* isolate,
   if (!new_target.is_null()) {
     if (IsSimpleInstantiation(isolate, *info, *new_target)) {
       constructor = Handle<JSFunction>::cast(new_target);
+    } else if (serial_number &&
+               IsSimpleSubclassInstantiation(isolate, *info, *new_target)) {
+      Handle<JSObject> result;
+      ASSIGN_RETURN_ON_EXCEPTION(
+          isolate, result,
+          InstantiateObject(isolate, info, Handle<JSReceiver>(),
+                            is_hidden_prototype),
+          JSObject);
+      Handle<Map> initial_map(JSFunction::cast(*new_target)->initial_map(),
+                              isolate);
+      Handle<Map> map;
+      if (GetSubclassInstanceMap(handle(result->map(), isolate),
+                                 handle(initial_map->prototype(), isolate))
+              .ToHandle(&map)) {
+        JSObject::MigrateToMap(result, map);
+        return result;
+      }
+      // Disable caching for subclass instantiation.
+      serial_number = 0;
     } else {
       // Disable caching for subclass instantiation.
       serial_number = 0;
@@ -29,6 +29,8 @@
 #include "src/bootstrapper.h"
 #include "src/char-predicates-inl.h"
 #include "src/code-stubs.h"
+#include "src/compilation-cache.h"
+#include "src/compilation-statistics.h"
 #include "src/compiler.h"
 #include "src/context-measure.h"
 #include "src/contexts.h"
@@ -41,11 +43,13 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/gc-tracer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
 #include "src/json-stringifier.h"
 #include "src/messages.h"
+#include "src/parsing/compile-hints.h"
 #include "src/parsing/parser.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/pending-compilation-error-handler.h"
@@ -66,6 +70,7 @@
 #include "src/snapshot/snapshot.h"
 #include "src/startup-data-util.h"
 #include "src/tracing/trace-event.h"
+#include "src/type-feedback-vector-inl.h"
 #include "src/unicode-inl.h"
 #include "src/v8.h"
 #include "src/v8threads.h"
@@ -1239,11 +1244,16 @@ void FunctionTemplate::SetCallHandler(
   i::Handle<i::CallHandlerInfo> obj =
       i::Handle<i::CallHandlerInfo>::cast(struct_obj);
   SET_FIELD_WRAPPED(obj, set_callback, callback);
+  i::MaybeHandle<i::FixedArray> program;
   i::MaybeHandle<i::Code> code =
-      i::experimental::BuildCodeFromFastAccessorBuilder(fast_handler);
+      i::experimental::BuildCodeFromFastAccessorBuilder(fast_handler,
+                                                        &program);
   if (!code.is_null()) {
     obj->set_fast_handler(*code.ToHandleChecked());
   }
+  if (!program.is_null()) {
+    obj->set_fast_handler_program(*program.ToHandleChecked());
+  }
   if (data.IsEmpty()) {
     data = v8::Undefined(reinterpret_cast<v8::Isolate*>(isolate));
   }
@@ -1945,11 +1955,15 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
   }
 
   i::ScriptData* script_data = NULL;
-  if (options == kConsumeParserCache || options == kConsumeCodeCache) {
+  if (options == kConsumeParserCache || options == kConsumeCodeCache ||
+      options == kConsumeCompileHints) {
     DCHECK(source->cached_data);
     // ScriptData takes care of pointer-aligning the data.
     script_data = new i::ScriptData(source->cached_data->data,
                                     source->cached_data->length);
+    if (options == kConsumeCodeCache && source->IsCachedDataChecked()) {
+      script_data->MarkChecked();
+    }
   }
 
   i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
@@ -1995,7 +2009,9 @@ MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundInternal(
       source->cached_data = new CachedData(
           script_data->data(), script_data->length(), CachedData::BufferOwned);
       script_data->ReleaseDataOwnership();
-    } else if (options == kConsumeParserCache || options == kConsumeCodeCache) {
+    } else if (options == kConsumeParserCache ||
+               options == kConsumeCodeCache ||
+               options == kConsumeCompileHints) {
       source->cached_data->rejected = script_data->rejected();
     }
     delete script_data;
@@ -2212,18 +2228,29 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingScript(
   }
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
   return new i::BackgroundParsingTask(source->impl(), options,
-                                      i::FLAG_stack_size, isolate);
+                                      i::FLAG_stack_size, isolate, false);
 }
 
 
-MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
-                                           StreamedSource* v8_source,
-                                           Local<String> full_source_string,
-                                           const ScriptOrigin& origin) {
-  PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Script);
-  TRACE_EVENT0("v8", "V8.ScriptCompiler");
-  i::StreamedSource* source = v8_source->impl();
-  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreamingModule(
+    Isolate* v8_isolate, StreamedSource* source) {
+  if (!i::FLAG_script_streaming) {
+    return nullptr;
+  }
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return new i::BackgroundParsingTask(source->impl(), kNoCompileOptions,
+                                      i::FLAG_stack_size, isolate, true);
+}
+
+
+namespace {
+
+// Finishes the parsing done by a ScriptStreamingTask and compiles the result
+// on the main thread. Returns a null handle and leaves an exception pending if
+// parsing or compilation failed.
+i::Handle<i::SharedFunctionInfo> CompileStreamedSource(
+    i::Isolate* isolate, i::StreamedSource* source,
+    i::Handle<i::String> str, const ScriptOrigin& origin) {
   i::Handle<i::Script> script = isolate->factory()->NewScript(str);
   if (!origin.ResourceName().IsEmpty()) {
     script->set_name(*Utils::OpenHandle(*(origin.ResourceName())));
@@ -2264,11 +2291,27 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
     result = i::Compiler::GetSharedFunctionInfoForStreamedScript(
         script, source->info.get(), str->length());
   }
-  has_pending_exception = result.is_null();
-  if (has_pending_exception) isolate->ReportPendingMessages();
+  if (result.is_null()) isolate->ReportPendingMessages();
 
   source->Release();
+  return result;
+}
+
+}  // namespace
+
 
+MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
+                                           StreamedSource* v8_source,
+                                           Local<String> full_source_string,
+                                           const ScriptOrigin& origin) {
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, Compile, Script);
+  TRACE_EVENT0("v8", "V8.ScriptCompiler");
+  i::StreamedSource* source = v8_source->impl();
+  DCHECK(!source->info->is_module());
+  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::Handle<i::SharedFunctionInfo> result =
+      CompileStreamedSource(isolate, source, str, origin);
+  has_pending_exception = result.is_null();
   RETURN_ON_FAILED_EXECUTION(Script);
 
   Local<UnboundScript> generic = ToApiHandle<UnboundScript>(result);
@@ -2289,6 +2332,47 @@ Local<Script> ScriptCompiler::Compile(Isolate* v8_isolate,
 }
 
 
+MaybeLocal<Module> ScriptCompiler::CompileModule(
+    Local<Context> context, StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  PREPARE_FOR_EXECUTION(context, ScriptCompiler, CompileModule, Module);
+  TRACE_EVENT0("v8", "V8.ScriptCompiler");
+  i::StreamedSource* source = v8_source->impl();
+  DCHECK(source->info->is_module());
+  i::Handle<i::String> str = Utils::OpenHandle(*(full_source_string));
+  i::Handle<i::SharedFunctionInfo> result =
+      CompileStreamedSource(isolate, source, str, origin);
+  has_pending_exception = result.is_null();
+  RETURN_ON_FAILED_EXECUTION(Module);
+  RETURN_ESCAPED(ToApiHandle<Module>(isolate->factory()->NewModule(result)));
+}
+
+
+ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
+    Isolate* v8_isolate, Source* source) {
+  if (source->cached_data == nullptr) return nullptr;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::Handle<i::String> str = Utils::OpenHandle(*(source->source_string));
+  source->cached_data_checked = false;
+  return new i::BackgroundCodeCacheCheckTask(
+      isolate, source, i::SerializedCodeData::SourceHash(str));
+}
+
+ScriptCompiler::CachedData* ScriptCompiler::CreateCompileHints(
+    Local<UnboundScript> unbound_script) {
+  i::Handle<i::SharedFunctionInfo> shared = Utils::OpenHandle(*unbound_script);
+  i::Isolate* isolate = shared->GetIsolate();
+  ENTER_V8(isolate);
+  i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+  i::ScriptData* script_data = i::CompileHints::Create(script);
+  CachedData* result = new CachedData(
+      script_data->data(), script_data->length(), CachedData::BufferOwned);
+  script_data->ReleaseDataOwnership();
+  delete script_data;
+  return result;
+}
+
+
 uint32_t ScriptCompiler::CachedDataVersionTag() {
   return static_cast<uint32_t>(base::hash_combine(
       internal::Version::Hash(), internal::FlagList::Hash(),
@@ -2918,6 +3002,17 @@ Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
   return Nothing<bool>();
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetSharedArrayBufferId(
+    Isolate* v8_isolate, Local<SharedArrayBuffer> shared_array_buffer) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::Handle<i::String> message = i::MessageTemplate::FormatMessage(
+      isolate,
+      i::MessageTemplate::kDataCloneErrorSharedArrayBufferNotTransferred,
+      isolate->factory()->empty_string());
+  ThrowDataCloneError(Utils::ToLocal(message));
+  return Nothing<uint32_t>();
+}
+
 struct ValueSerializer::PrivateData {
   explicit PrivateData(i::Isolate* i, ValueSerializer::Delegate* delegate)
       : isolate(i), serializer(i, delegate) {}
@@ -3927,6 +4022,28 @@ Maybe<bool> v8::Object::CreateDataProperty(v8::Local<v8::Context> context,
 }
 
 
+Maybe<bool> v8::Object::CreateDataProperties(v8::Local<v8::Context> context,
+                                             int count,
+                                             const v8::Local<Name> keys[],
+                                             const v8::Local<Value> values[]) {
+  PREPARE_FOR_EXECUTION_PRIMITIVE(context, Object, CreateDataProperties, bool);
+  i::Handle<i::JSReceiver> self = Utils::OpenHandle(this);
+  for (int i = 0; i < count; i++) {
+    i::HandleScope property_scope(isolate);
+    i::Handle<i::Name> key_obj = Utils::OpenHandle(*keys[i]);
+    i::Handle<i::Object> value_obj = Utils::OpenHandle(*values[i]);
+    i::LookupIterator it = i::LookupIterator::PropertyOrElement(
+        isolate, self, key_obj, self, i::LookupIterator::OWN);
+    Maybe<bool> result = i::JSReceiver::CreateDataProperty(
+        &it, value_obj, i::Object::DONT_THROW);
+    has_pending_exception = result.IsNothing();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    if (!result.FromJust()) return Just(false);
+  }
+  return Just(true);
+}
+
+
 Maybe<bool> v8::Object::CreateDataProperty(v8::Local<v8::Context> context,
                                            uint32_t index,
                                            v8::Local<Value> value) {
@@ -4158,6 +4275,31 @@ MaybeLocal<Value> v8::Object::Get(Local<v8::Context> context,
 }
 
 
+Maybe<bool> v8::Object::GetMultiple(Local<v8::Context> context, int count,
+                                    const Local<Name> keys[],
+                                    Local<Value> values[]) {
+  // The values live in the caller's handle scope, so their handles are
+  // created before the handle scope for the lookups is opened.
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  for (int i = 0; i < count; i++) {
+    values[i] = Utils::ToLocal(i::Handle<i::Object>(
+        i_isolate->heap()->undefined_value(), i_isolate));
+  }
+  PREPARE_FOR_EXECUTION_PRIMITIVE(context, Object, GetMultiple, bool);
+  i::Handle<i::JSReceiver> self = Utils::OpenHandle(this);
+  for (int i = 0; i < count; i++) {
+    i::HandleScope property_scope(isolate);
+    i::LookupIterator it = i::LookupIterator::PropertyOrElement(
+        isolate, self, Utils::OpenHandle(*keys[i]));
+    i::Handle<i::Object> result;
+    has_pending_exception = !i::Object::GetProperty(&it).ToHandle(&result);
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+    *Utils::OpenHandle(*values[i]).location() = *result;
+  }
+  return Just(true);
+}
+
+
 Local<Value> v8::Object::Get(v8::Local<Value> key) {
   auto context = ContextFromHeapObject(Utils::OpenHandle(this));
   RETURN_TO_LOCAL_UNCHECKED(Get(context, key), Value);
@@ -5485,9 +5627,18 @@ class Utf8WriterVisitor {
       }
       // Write the characters to the stream.
       if (sizeof(Char) == 1) {
-        for (; i < fast_length; i++) {
+        while (i < fast_length) {
+          // Runs of ASCII characters are copied as they are.
+          int ascii_length = i::String::NonAsciiStart(
+              reinterpret_cast<const char*>(chars), fast_length - i);
+          i::CopyChars(buffer, chars, ascii_length);
+          buffer += ascii_length;
+          chars += ascii_length;
+          i += ascii_length;
+          if (i == fast_length) break;
           buffer += unibrow::Utf8::EncodeOneByte(
               buffer, static_cast<uint8_t>(*chars++));
+          i++;
           DCHECK(capacity_ == -1 || (buffer - start_) <= capacity_);
         }
       } else {
@@ -5946,6 +6097,27 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(0) {}
 
+GCStatistics::GCStatistics()
+    : type_(kGCTypeScavenge),
+      total_time_(0),
+      scavenge_time_(0),
+      mark_time_(0),
+      sweep_time_(0),
+      evacuate_time_(0),
+      weak_processing_time_(0),
+      external_time_(0),
+      heap_size_before_(0),
+      heap_size_after_(0),
+      survival_ratio_(0),
+      allocation_throughput_(0) {}
+
+CompilePhaseStatistics::CompilePhaseStatistics()
+    : phase_kind_name_(nullptr),
+      phase_name_(nullptr),
+      time_(0),
+      total_allocated_bytes_(0),
+      max_allocated_bytes_(0) {}
+
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
                                             space_used_size_(0),
@@ -6128,6 +6300,25 @@ MaybeLocal<Context> v8::Context::FromSnapshot(
                     global_object, context_snapshot_index);
 }
 
+Local<Context> v8::Context::Reset(
+    v8::Local<Context> context,
+    v8::MaybeLocal<ObjectTemplate> global_template) {
+  i::Handle<i::Context> old_context = Utils::OpenHandle(*context);
+  i::Isolate* isolate = old_context->GetIsolate();
+  i::Handle<i::JSObject> global_proxy(old_context->global_proxy(), isolate);
+  i::Handle<i::Object> token(old_context->security_token(), isolate);
+  bool has_custom_token = *token != old_context->global_object();
+  isolate->compilation_cache()->RemoveContext(old_context);
+  context->DetachGlobal();
+  Local<Context> result =
+      NewContext(reinterpret_cast<v8::Isolate*>(isolate), nullptr,
+                 global_template, Utils::ToLocal(global_proxy), 0);
+  if (!result.IsEmpty() && has_custom_token) {
+    result->SetSecurityToken(Utils::ToLocal(token));
+  }
+  return result;
+}
+
 MaybeLocal<Object> v8::Context::NewRemoteContext(
     v8::Isolate* external_isolate, v8::Local<ObjectTemplate> global_template,
     v8::MaybeLocal<v8::Value> global_object) {
@@ -6245,6 +6436,11 @@ size_t Context::EstimatedSize() {
 }
 
 
+size_t Context::LiveSizeAtLastGC() {
+  return static_cast<size_t>(Utils::OpenHandle(this)->GetLiveSize());
+}
+
+
 MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
   PREPARE_FOR_EXECUTION(context, ObjectTemplate, NewInstance, Object);
   auto self = Utils::OpenHandle(this);
@@ -7191,12 +7387,9 @@ WasmCompiledModule::SerializedModule WasmCompiledModule::Serialize() {
   i::Handle<i::wasm::WasmCompiledModule> compiled_part =
       i::handle(i::wasm::WasmCompiledModule::cast(obj->GetInternalField(0)));
 
-  i::Handle<i::SeqOneByteString> wire_bytes = compiled_part->module_bytes();
-  compiled_part->reset_module_bytes();
   std::unique_ptr<i::ScriptData> script_data =
       i::WasmCompiledModuleSerializer::SerializeWasmModule(obj->GetIsolate(),
                                                            compiled_part);
-  compiled_part->set_module_bytes(wire_bytes);
   script_data->ReleaseDataOwnership();
 
   size_t size = static_cast<size_t>(script_data->length());
@@ -7207,17 +7400,21 @@ MaybeLocal<WasmCompiledModule> WasmCompiledModule::Deserialize(
     Isolate* isolate,
     const WasmCompiledModule::SerializedModule& serialized_module) {
   return Deserialize(isolate,
-                     {serialized_module.first.get(), serialized_module.second});
+                     {serialized_module.first.get(), serialized_module.second},
+                     {nullptr, 0});
 }
 
 MaybeLocal<WasmCompiledModule> WasmCompiledModule::Deserialize(
     Isolate* isolate,
-    const WasmCompiledModule::CallerOwnedBuffer& serialized_module) {
+    const WasmCompiledModule::CallerOwnedBuffer& serialized_module,
+    const WasmCompiledModule::CallerOwnedBuffer& wire_bytes) {
   int size = static_cast<int>(serialized_module.second);
   i::ScriptData sc(serialized_module.first, size);
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
   i::MaybeHandle<i::FixedArray> maybe_compiled_part =
-      i::WasmCompiledModuleSerializer::DeserializeWasmModule(i_isolate, &sc);
+      i::WasmCompiledModuleSerializer::DeserializeWasmModule(
+          i_isolate, &sc,
+          {wire_bytes.first, static_cast<int>(wire_bytes.second)});
   i::Handle<i::FixedArray> compiled_part;
   if (!maybe_compiled_part.ToHandle(&compiled_part)) {
     return MaybeLocal<WasmCompiledModule>();
@@ -7233,7 +7430,8 @@ MaybeLocal<WasmCompiledModule> WasmCompiledModule::DeserializeOrCompile(
     Isolate* isolate,
     const WasmCompiledModule::CallerOwnedBuffer& serialized_module,
     const WasmCompiledModule::CallerOwnedBuffer& wire_bytes) {
-  MaybeLocal<WasmCompiledModule> ret = Deserialize(isolate, serialized_module);
+  MaybeLocal<WasmCompiledModule> ret =
+      Deserialize(isolate, serialized_module, wire_bytes);
   if (!ret.IsEmpty()) return ret;
   return Compile(isolate, wire_bytes.first, wire_bytes.second);
 }
@@ -7997,6 +8195,46 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
 }
 
 
+bool Isolate::GetLastGCStatistics(GCStatistics* gc_statistics) {
+  if (!gc_statistics) return false;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::GCTracer* tracer = isolate->heap()->tracer();
+  const i::GCTracer::Event& event = tracer->LastCompletedEvent();
+  typedef i::GCTracer::Scope GCScope;
+  switch (event.type) {
+    case i::GCTracer::Event::SCAVENGER:
+      gc_statistics->type_ = kGCTypeScavenge;
+      break;
+    case i::GCTracer::Event::MARK_COMPACTOR:
+    case i::GCTracer::Event::INCREMENTAL_MARK_COMPACTOR:
+      gc_statistics->type_ = kGCTypeMarkSweepCompact;
+      break;
+    case i::GCTracer::Event::START:
+      return false;
+  }
+  gc_statistics->total_time_ = event.end_time - event.start_time;
+  gc_statistics->scavenge_time_ = event.scopes[GCScope::SCAVENGER_SCAVENGE];
+  gc_statistics->mark_time_ =
+      event.scopes[GCScope::MC_MARK] + event.scopes[GCScope::MC_INCREMENTAL];
+  gc_statistics->sweep_time_ = event.scopes[GCScope::MC_SWEEP];
+  gc_statistics->evacuate_time_ = event.scopes[GCScope::MC_EVACUATE];
+  gc_statistics->weak_processing_time_ =
+      event.scopes[GCScope::MC_CLEAR] + event.scopes[GCScope::SCAVENGER_WEAK];
+  gc_statistics->external_time_ = i::GCTracer::TotalExternalTime(event);
+  gc_statistics->heap_size_before_ = event.start_object_size;
+  gc_statistics->heap_size_after_ = event.end_object_size;
+  gc_statistics->survival_ratio_ =
+      event.type == i::GCTracer::Event::SCAVENGER &&
+              event.new_space_object_size > 0
+          ? static_cast<double>(event.survived_new_space_object_size) /
+                event.new_space_object_size
+          : 0;
+  gc_statistics->allocation_throughput_ =
+      tracer->CurrentAllocationThroughputInBytesPerMillisecond();
+  return true;
+}
+
+
 size_t Isolate::NumberOfHeapSpaces() {
   return i::LAST_SPACE - i::FIRST_SPACE + 1;
 }
@@ -8021,6 +8259,45 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
 }
 
 
+void Isolate::SetCompilePhaseStatisticsEnabled(bool enabled) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->set_turbo_statistics_enabled(enabled);
+  // Compilation jobs which are still running hold on to the statistics
+  // object, so it is only reset here and deleted when the isolate is torn
+  // down.
+  if (!enabled && !i::FLAG_turbo_stats && !i::FLAG_turbo_stats_nvp &&
+      isolate->turbo_statistics() != nullptr) {
+    isolate->turbo_statistics()->Reset();
+  }
+}
+
+
+size_t Isolate::NumberOfCompilePhases() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::CompilationStatistics* statistics = isolate->turbo_statistics();
+  return statistics == nullptr ? 0 : statistics->NumberOfPhases();
+}
+
+
+bool Isolate::GetCompilePhaseStatistics(
+    CompilePhaseStatistics* phase_statistics, size_t index) {
+  if (!phase_statistics) return false;
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::CompilationStatistics* statistics = isolate->turbo_statistics();
+  if (statistics == nullptr) return false;
+  i::CompilationStatistics::BasicStats stats;
+  if (!statistics->GetPhaseStats(index, &stats,
+                                 &phase_statistics->phase_kind_name_,
+                                 &phase_statistics->phase_name_)) {
+    return false;
+  }
+  phase_statistics->time_ = stats.delta_.InMillisecondsF();
+  phase_statistics->total_allocated_bytes_ = stats.total_allocated_bytes_;
+  phase_statistics->max_allocated_bytes_ = stats.absolute_max_allocated_bytes_;
+  return true;
+}
+
+
 size_t Isolate::NumberOfTrackedHeapObjectTypes() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   i::Heap* heap = isolate->heap();
@@ -8399,6 +8676,18 @@ void Isolate::VisitExternalResources(ExternalResourceVisitor* visitor) {
 }
 
 
+void Isolate::VisitRuntimeCallStats(RuntimeCallStatsVisitor* visitor) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->Visit(visitor);
+}
+
+
+void Isolate::ResetRuntimeCallStats() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->ResetCounters();
+}
+
+
 bool Isolate::IsInUse() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsInUse();
@@ -8932,6 +9221,93 @@ void CpuProfiler::SetIdle(bool is_idle) {
   }
 }
 
+namespace {
+
+template <typename Nexus>
+void VisitInlineCache(InlineCacheVisitor* visitor,
+                      InlineCacheVisitor::Kind kind,
+                      i::Handle<i::TypeFeedbackVector> vector,
+                      i::FeedbackVectorSlot slot) {
+  Nexus nexus(vector, slot);
+  i::MapHandleList maps;
+  int map_count = nexus.ExtractMaps(&maps);
+  visitor->VisitInlineCache(
+      slot.ToInt(), kind,
+      static_cast<InlineCacheVisitor::State>(nexus.StateFromFeedback()),
+      map_count);
+}
+
+}  // namespace
+
+void CpuProfiler::VisitInlineCaches(Local<Function> function,
+                                    InlineCacheVisitor* visitor) {
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kUninitialized) ==
+                i::UNINITIALIZED);
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kPremonomorphic) ==
+                i::PREMONOMORPHIC);
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kMonomorphic) ==
+                i::MONOMORPHIC);
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kRecomputeHandler) ==
+                i::RECOMPUTE_HANDLER);
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kPolymorphic) ==
+                i::POLYMORPHIC);
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kMegamorphic) ==
+                i::MEGAMORPHIC);
+  STATIC_ASSERT(static_cast<int>(InlineCacheVisitor::kGeneric) == i::GENERIC);
+
+  i::Handle<i::JSReceiver> receiver = Utils::OpenHandle(*function);
+  if (!receiver->IsJSFunction()) return;
+  i::Handle<i::JSFunction> func = i::Handle<i::JSFunction>::cast(receiver);
+  i::Isolate* isolate = func->GetIsolate();
+  i::HandleScope scope(isolate);
+  i::Handle<i::TypeFeedbackVector> vector(func->feedback_vector(), isolate);
+
+  i::TypeFeedbackMetadataIterator iter(vector->metadata());
+  while (iter.HasNext()) {
+    i::FeedbackVectorSlot slot = iter.Next();
+    switch (iter.kind()) {
+      case i::FeedbackVectorSlotKind::CALL_IC:
+        VisitInlineCache<i::CallICNexus>(visitor, InlineCacheVisitor::kCall,
+                                         vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::LOAD_IC:
+        VisitInlineCache<i::LoadICNexus>(visitor, InlineCacheVisitor::kLoad,
+                                         vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::LOAD_GLOBAL_IC:
+        VisitInlineCache<i::LoadGlobalICNexus>(
+            visitor, InlineCacheVisitor::kLoadGlobal, vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::KEYED_LOAD_IC:
+        VisitInlineCache<i::KeyedLoadICNexus>(
+            visitor, InlineCacheVisitor::kKeyedLoad, vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::STORE_IC:
+        VisitInlineCache<i::StoreICNexus>(visitor, InlineCacheVisitor::kStore,
+                                          vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::KEYED_STORE_IC:
+        VisitInlineCache<i::KeyedStoreICNexus>(
+            visitor, InlineCacheVisitor::kKeyedStore, vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::INTERPRETER_BINARYOP_IC:
+        VisitInlineCache<i::BinaryOpICNexus>(
+            visitor, InlineCacheVisitor::kBinaryOperation, vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::INTERPRETER_COMPARE_IC:
+        VisitInlineCache<i::CompareICNexus>(
+            visitor, InlineCacheVisitor::kCompareOperation, vector, slot);
+        break;
+      case i::FeedbackVectorSlotKind::GENERAL:
+        break;
+      case i::FeedbackVectorSlotKind::INVALID:
+      case i::FeedbackVectorSlotKind::KINDS_NUMBER:
+        UNREACHABLE();
+        break;
+    }
+  }
+}
+
 
 static i::HeapGraphEdge* ToInternal(const HeapGraphEdge* edge) {
   return const_cast<i::HeapGraphEdge*>(
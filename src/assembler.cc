@@ -1908,7 +1908,8 @@ int ConstantPoolBuilder::Emit(Assembler* assm) {
 
 void Assembler::RecordDeoptReason(DeoptimizeReason reason, int raw_position,
                                   int id) {
-  if (FLAG_trace_deopt || isolate()->is_profiling()) {
+  if (FLAG_trace_deopt || FLAG_trace_deopt_storms ||
+      FLAG_max_deopts_per_site > 0 || isolate()->is_profiling()) {
     EnsureSpace ensure_space(this);
     RecordRelocInfo(RelocInfo::DEOPT_POSITION, raw_position);
     RecordRelocInfo(RelocInfo::DEOPT_REASON, static_cast<int>(reason));
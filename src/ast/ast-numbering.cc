@@ -419,6 +419,7 @@ void AstNumberingVisitor::VisitForOfStatement(ForOfStatement* node) {
   Visit(node->assign_each());
   Visit(node->body());
   node->set_yield_count(yield_count_ - node->first_yield_id());
+  ReserveFeedbackSlots(node);
 }
 
 
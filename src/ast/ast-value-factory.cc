@@ -220,6 +220,38 @@ void AstValue::Internalize(Isolate* isolate) {
 }
 
 
+AstStringConstants::AstStringConstants(Isolate* isolate, uint32_t hash_seed)
+    : zone_(isolate->allocator()), hash_seed_(hash_seed) {
+  DCHECK(ThreadId::Current().Equals(isolate->thread_id()));
+#define F(name, str)                                                       \
+  {                                                                        \
+    const char* data = str;                                                \
+    Vector<const uint8_t> literal(reinterpret_cast<const uint8_t*>(data),  \
+                                  static_cast<int>(strlen(data)));         \
+    uint32_t hash = StringHasher::HashSequentialString<uint8_t>(           \
+        literal.start(), literal.length(), hash_seed_);                    \
+    name##_string_ = new (&zone_) AstRawString(true, literal, hash);       \
+    /* The handle points into the root list, so it stays valid. */         \
+    name##_string_->string_ = isolate->factory()->name##_string();         \
+  }
+  STRING_CONSTANTS(F)
+#undef F
+}
+
+void AstValueFactory::InitializeStringConstants(
+    const AstStringConstants* string_constants) {
+  DCHECK_EQ(hash_seed_, string_constants->hash_seed());
+  // The constants are already internalized, so they are not added to
+  // strings_, only to the table which GetString looks them up in.
+#define F(name, str)                                                        \
+  name##_string_ = string_constants->name##_string();                       \
+  string_table_.LookupOrInsert(const_cast<AstRawString*>(name##_string_),   \
+                               name##_string_->hash())                      \
+      ->value = reinterpret_cast<void*>(1);
+  STRING_CONSTANTS(F)
+#undef F
+}
+
 AstRawString* AstValueFactory::GetOneByteStringInternal(
     Vector<const uint8_t> literal) {
   uint32_t hash = StringHasher::HashSequentialString<uint8_t>(
@@ -105,8 +105,9 @@ class AstRawString final : public AstString {
   }
 
  private:
-  friend class AstValueFactory;
   friend class AstRawStringInternalizationKey;
+  friend class AstStringConstants;
+  friend class AstValueFactory;
 
   AstRawString(bool is_one_byte, const Vector<const byte>& literal_bytes,
                uint32_t hash)
@@ -319,18 +320,53 @@ class AstValue : public ZoneObject {
   F(undefined_value)       \
   F(the_hole_value)
 
+// The AstRawStrings for the STRING_CONSTANTS, created once per isolate and
+// shared by all AstValueFactories using the same hash seed, so that they are
+// not allocated and hashed anew for every parse. They are backed by the
+// strings of the same name in the root list and are therefore internalized
+// from the start; they can be read from any thread.
+class AstStringConstants final {
+ public:
+  AstStringConstants(Isolate* isolate, uint32_t hash_seed);
+
+  uint32_t hash_seed() const { return hash_seed_; }
+
+#define F(name, str) \
+  const AstRawString* name##_string() const { return name##_string_; }
+  STRING_CONSTANTS(F)
+#undef F
+
+ private:
+  Zone zone_;
+  uint32_t hash_seed_;
+
+#define F(name, str) AstRawString* name##_string_;
+  STRING_CONSTANTS(F)
+#undef F
+
+  DISALLOW_COPY_AND_ASSIGN(AstStringConstants);
+};
+
 class AstValueFactory {
  public:
   AstValueFactory(Zone* zone, uint32_t hash_seed)
+      : AstValueFactory(zone, nullptr, hash_seed) {}
+
+  AstValueFactory(Zone* zone, const AstStringConstants* string_constants,
+                  uint32_t hash_seed)
       : string_table_(AstRawStringCompare),
         values_(nullptr),
         strings_end_(&strings_),
         zone_(zone),
         hash_seed_(hash_seed) {
     ResetStrings();
+    if (string_constants != nullptr) {
+      InitializeStringConstants(string_constants);
+    } else {
 #define F(name, str) name##_string_ = NULL;
-    STRING_CONSTANTS(F)
+      STRING_CONSTANTS(F)
 #undef F
+    }
 #define F(name) name##_ = NULL;
     OTHER_CONSTANTS(F)
 #undef F
@@ -395,6 +431,7 @@ class AstValueFactory {
     strings_ = nullptr;
     strings_end_ = &strings_;
   }
+  void InitializeStringConstants(const AstStringConstants* string_constants);
   AstRawString* GetOneByteStringInternal(Vector<const uint8_t> literal);
   AstRawString* GetTwoByteStringInternal(Vector<const uint16_t> literal);
   AstRawString* GetString(uint32_t hash, bool is_one_byte,
@@ -426,7 +463,6 @@ class AstValueFactory {
 }  // namespace internal
 }  // namespace v8
 
-#undef STRING_CONSTANTS
 #undef OTHER_CONSTANTS
 
 #endif  // V8_AST_AST_VALUE_FACTORY_H_
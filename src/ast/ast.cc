@@ -242,6 +242,15 @@ void ForInStatement::AssignFeedbackVectorSlots(Isolate* isolate,
   for_in_feedback_slot_ = spec->AddGeneralSlot();
 }
 
+void ForOfStatement::AssignFeedbackVectorSlots(Isolate* isolate,
+                                               FeedbackVectorSpec* spec,
+                                               FeedbackVectorSlotCache* cache) {
+  length_slot_ = spec->AddLoadICSlot();
+  element_slot_ = spec->AddKeyedLoadICSlot();
+  // Used only in ignition for the index increment.
+  index_slot_ = spec->AddInterpreterBinaryOpICSlot();
+}
+
 Assignment::Assignment(Token::Value op, Expression* target, Expression* value,
                        int pos)
     : Expression(pos, kAssignment),
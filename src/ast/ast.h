@@ -118,6 +118,7 @@ class BreakableStatement;
 class Expression;
 class IterationStatement;
 class MaterializedLiteral;
+class PreParsedScopeData;
 class Statement;
 class TypeFeedbackOracle;
 
@@ -782,11 +783,12 @@ class ForInStatement final : public ForEachStatement {
 
 class ForOfStatement final : public ForEachStatement {
  public:
-  void Initialize(Statement* body, Variable* iterator,
+  void Initialize(Statement* body, Variable* iterator, Variable* index,
                   Expression* assign_iterator, Expression* next_result,
                   Expression* result_done, Expression* assign_each) {
     ForEachStatement::Initialize(body);
     iterator_ = iterator;
+    index_ = index;
     assign_iterator_ = assign_iterator;
     next_result_ = next_result;
     result_done_ = result_done;
@@ -797,7 +799,11 @@ class ForOfStatement final : public ForEachStatement {
     return iterator_;
   }
 
-  // iterator = subject[Symbol.iterator]()
+  // Index of the next element while an array is iterated by index, undefined
+  // otherwise.
+  Variable* index() const { return index_; }
+
+  // .iterable = subject, iterator = .iterable[Symbol.iterator]()
   Expression* assign_iterator() const {
     return assign_iterator_;
   }
@@ -812,7 +818,7 @@ class ForOfStatement final : public ForEachStatement {
     return result_done_;
   }
 
-  // each = result.value
+  // .value = result.value, each = .value
   Expression* assign_each() const {
     return assign_each_;
   }
@@ -822,6 +828,13 @@ class ForOfStatement final : public ForEachStatement {
   void set_result_done(Expression* e) { result_done_ = e; }
   void set_assign_each(Expression* e) { assign_each_ = e; }
 
+  // Type feedback information for iterating arrays by index.
+  void AssignFeedbackVectorSlots(Isolate* isolate, FeedbackVectorSpec* spec,
+                                 FeedbackVectorSlotCache* cache);
+  FeedbackVectorSlot LengthFeedbackSlot() const { return length_slot_; }
+  FeedbackVectorSlot ElementFeedbackSlot() const { return element_slot_; }
+  FeedbackVectorSlot IndexFeedbackSlot() const { return index_slot_; }
+
   BailoutId ContinueId() const { return EntryId(); }
   BailoutId StackCheckId() const { return BackEdgeId(); }
 
@@ -834,6 +847,7 @@ class ForOfStatement final : public ForEachStatement {
   ForOfStatement(ZoneList<const AstRawString*>* labels, int pos)
       : ForEachStatement(labels, pos, kForOfStatement),
         iterator_(NULL),
+        index_(NULL),
         assign_iterator_(NULL),
         next_result_(NULL),
         result_done_(NULL),
@@ -842,10 +856,14 @@ class ForOfStatement final : public ForEachStatement {
   int local_id(int n) const { return base_id() + parent_num_ids() + n; }
 
   Variable* iterator_;
+  Variable* index_;
   Expression* assign_iterator_;
   Expression* next_result_;
   Expression* result_done_;
   Expression* assign_each_;
+  FeedbackVectorSlot length_slot_;
+  FeedbackVectorSlot element_slot_;
+  FeedbackVectorSlot index_slot_;
 };
 
 
@@ -2661,6 +2679,15 @@ class FunctionLiteral final : public Expression {
     bit_field_ = ShouldNotBeUsedOnceHintField::update(bit_field_, true);
   }
 
+  // A hint that this function was optimized the last time this script ran,
+  // recorded in the compile hints.
+  bool should_optimize_early() const {
+    return ShouldOptimizeEarlyField::decode(bit_field_);
+  }
+  void set_should_optimize_early() {
+    bit_field_ = ShouldOptimizeEarlyField::update(bit_field_, true);
+  }
+
   FunctionType function_type() const {
     return FunctionTypeBits::decode(bit_field_);
   }
@@ -2704,6 +2731,15 @@ class FunctionLiteral final : public Expression {
         IsClassFieldInitializer::update(bit_field_, is_class_field_initializer);
   }
 
+  // The data recorded for the inner functions of a lazily parsed inner
+  // function, which is stored on its SharedFunctionInfo.
+  PreParsedScopeData* preparsed_scope_data() const {
+    return preparsed_scope_data_;
+  }
+  void set_preparsed_scope_data(PreParsedScopeData* preparsed_scope_data) {
+    preparsed_scope_data_ = preparsed_scope_data;
+  }
+
  private:
   friend class AstNodeFactory;
 
@@ -2726,7 +2762,8 @@ class FunctionLiteral final : public Expression {
         scope_(scope),
         body_(body),
         raw_inferred_name_(ast_value_factory->empty_string()),
-        ast_properties_(zone) {
+        ast_properties_(zone),
+        preparsed_scope_data_(nullptr) {
     bit_field_ |=
         FunctionTypeBits::encode(function_type) | Pretenure::encode(false) |
         HasDuplicateParameters::encode(has_duplicate_parameters ==
@@ -2735,7 +2772,8 @@ class FunctionLiteral final : public Expression {
         RequiresClassFieldInit::encode(false) |
         ShouldNotBeUsedOnceHintField::encode(false) |
         DontOptimizeReasonField::encode(kNoReason) |
-        IsClassFieldInitializer::encode(false);
+        IsClassFieldInitializer::encode(false) |
+        ShouldOptimizeEarlyField::encode(false);
     if (eager_compile_hint == kShouldEagerCompile) SetShouldEagerCompile();
   }
 
@@ -2752,6 +2790,8 @@ class FunctionLiteral final : public Expression {
       : public BitField<bool, RequiresClassFieldInit::kNext, 1> {};
   class DontOptimizeReasonField
       : public BitField<BailoutReason, IsClassFieldInitializer::kNext, 8> {};
+  class ShouldOptimizeEarlyField
+      : public BitField<bool, DontOptimizeReasonField::kNext, 1> {};
 
   int materialized_literal_count_;
   int expected_property_count_;
@@ -2766,6 +2806,7 @@ class FunctionLiteral final : public Expression {
   const AstString* raw_inferred_name_;
   Handle<String> inferred_name_;
   AstProperties ast_properties_;
+  PreParsedScopeData* preparsed_scope_data_;
 };
 
 // Property is used for passing information
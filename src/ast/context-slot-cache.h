@@ -50,7 +50,7 @@ class ContextSlotCache {
                      MaybeAssignedFlag maybe_assigned_flag, int slot_index);
 #endif
 
-  static const int kLength = 256;
+  static const int kLength = 1024;
   struct Key {
     Object* data;
     String* name;
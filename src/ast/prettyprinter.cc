@@ -22,6 +22,8 @@ CallPrinter::CallPrinter(Isolate* isolate, bool is_builtin)
   found_ = false;
   done_ = false;
   is_builtin_ = is_builtin;
+  for_of_iterable_ = nullptr;
+  for_of_subject_ = nullptr;
   InitializeAstVisitor(isolate);
 }
 
@@ -155,7 +157,21 @@ void CallPrinter::VisitForInStatement(ForInStatement* node) {
 
 
 void CallPrinter::VisitForOfStatement(ForOfStatement* node) {
-  Find(node->assign_iterator());
+  // The parser splits the loop setup into (.iterable = subject, iterator =
+  // GetIterator(.iterable)), errors in the latter refer to the subject.
+  BinaryOperation* assign_iterator =
+      node->assign_iterator()->AsBinaryOperation();
+  Assignment* assign_iterable = assign_iterator->left()->AsAssignment();
+  Find(assign_iterable->value());
+  {
+    Variable* prev_iterable = for_of_iterable_;
+    Expression* prev_subject = for_of_subject_;
+    for_of_iterable_ = assign_iterable->target()->AsVariableProxy()->var();
+    for_of_subject_ = assign_iterable->value();
+    Find(assign_iterator->right());
+    for_of_iterable_ = prev_iterable;
+    for_of_subject_ = prev_subject;
+  }
   Find(node->next_result());
   Find(node->result_done());
   Find(node->assign_each());
@@ -239,7 +255,9 @@ void CallPrinter::VisitArrayLiteral(ArrayLiteral* node) {
 
 
 void CallPrinter::VisitVariableProxy(VariableProxy* node) {
-  if (is_builtin_) {
+  if (node->is_resolved() && node->var() == for_of_iterable_) {
+    Find(for_of_subject_, true);
+  } else if (is_builtin_) {
     // Variable names of builtins are meaningless due to minification.
     Print("(var)");
   } else {
@@ -39,6 +39,10 @@ class CallPrinter final : public AstVisitor<CallPrinter> {
   bool found_;
   bool done_;
   bool is_builtin_;
+  // Temporary holding the subject of the for-of loop being visited, and the
+  // subject itself, which is printed in place of the temporary.
+  Variable* for_of_iterable_;
+  Expression* for_of_subject_;
 
   DEFINE_AST_VISITOR_SUBCLASS_MEMBERS();
 
@@ -1033,6 +1033,18 @@ bool Scope::RemoveUnresolved(const AstRawString* name) {
   return false;
 }
 
+void Scope::CollectUnresolvedNames(ZoneHashMap* names, Zone* zone) {
+  for (VariableProxy* proxy = unresolved_; proxy != nullptr;
+       proxy = proxy->next_unresolved()) {
+    const AstRawString* name = proxy->raw_name();
+    names->LookupOrInsert(const_cast<AstRawString*>(name), name->hash(),
+                          ZoneAllocationPolicy(zone));
+  }
+  for (Scope* scope = inner_scope_; scope != nullptr; scope = scope->sibling_) {
+    scope->CollectUnresolvedNames(names, zone);
+  }
+}
+
 Variable* Scope::NewTemporary(const AstRawString* name) {
   DeclarationScope* scope = GetClosureScope();
   Variable* var = new (zone())
@@ -1654,10 +1666,33 @@ void Scope::ResolveTo(ParseInfo* info, VariableProxy* proxy, Variable* var) {
 void Scope::ResolveVariablesRecursively(ParseInfo* info) {
   DCHECK(info->script_scope()->is_script_scope());
 
-  // Resolve unresolved variables for this scope.
-  for (VariableProxy* proxy = unresolved_; proxy != nullptr;
-       proxy = proxy->next_unresolved()) {
-    ResolveVariable(info, proxy);
+  // Resolve unresolved variables for this scope. All references to a name
+  // resolve to the same variable, so only the first one walks the scope chain,
+  // which is costly for deep chains of deserialized scopes. Assignments are
+  // always looked up, as they may additionally mark outer variables as maybe
+  // assigned.
+  if (unresolved_ != nullptr && unresolved_->next_unresolved() != nullptr) {
+    ZoneHashMap resolved(ZoneHashMap::kDefaultHashMapCapacity,
+                         ZoneAllocationPolicy(zone()));
+    for (VariableProxy* proxy = unresolved_; proxy != nullptr;
+         proxy = proxy->next_unresolved()) {
+      if (proxy->is_assigned()) {
+        ResolveVariable(info, proxy);
+        continue;
+      }
+      const AstRawString* name = proxy->raw_name();
+      ZoneHashMap::Entry* entry =
+          resolved.LookupOrInsert(const_cast<AstRawString*>(name),
+                                  name->hash(), ZoneAllocationPolicy(zone()));
+      if (entry->value != nullptr) {
+        ResolveTo(info, proxy, reinterpret_cast<Variable*>(entry->value));
+      } else {
+        ResolveVariable(info, proxy);
+        entry->value = proxy->var();
+      }
+    }
+  } else if (unresolved_ != nullptr) {
+    ResolveVariable(info, unresolved_);
   }
 
   // Resolve unresolved variables for inner scopes.
@@ -174,6 +174,10 @@ class Scope: public ZoneObject {
   bool RemoveUnresolved(VariableProxy* var);
   bool RemoveUnresolved(const AstRawString* name);
 
+  // Adds the names of the unresolved variables of this scope and its inner
+  // scopes to the set |names|, which is keyed by AstRawString*.
+  void CollectUnresolvedNames(ZoneHashMap* names, Zone* zone);
+
   // Creates a new temporary variable in this scope's TemporaryScope.  The
   // name is only used for printing and cannot be used to find the variable.
   // In particular, the only way to get hold of the temporary is by keeping the
@@ -208,6 +212,11 @@ class Scope: public ZoneObject {
   // whether we parsed eagerly or not which is undesirable.
   void RecordEvalCall() {
     scope_calls_eval_ = true;
+    RecordInnerScopeEvalCall();
+  }
+
+  // Inform the scope and its outer scopes that an inner scope calls eval.
+  void RecordInnerScopeEvalCall() {
     inner_scope_calls_eval_ = true;
     for (Scope* scope = outer_scope(); scope && !scope->is_script_scope();
          scope = scope->outer_scope()) {
@@ -295,6 +304,7 @@ class Scope: public ZoneObject {
 
   // Information about which scopes calls eval.
   bool calls_eval() const { return scope_calls_eval_; }
+  bool inner_scope_calls_eval() const { return inner_scope_calls_eval_; }
   bool calls_sloppy_eval() const {
     return scope_calls_eval_ && is_sloppy(language_mode());
   }
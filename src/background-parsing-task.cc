@@ -18,7 +18,7 @@ void StreamedSource::Release() {
 
 BackgroundParsingTask::BackgroundParsingTask(
     StreamedSource* source, ScriptCompiler::CompileOptions options,
-    int stack_size, Isolate* isolate)
+    int stack_size, Isolate* isolate, bool is_module)
     : source_(source), stack_size_(stack_size), script_data_(nullptr) {
   // We don't set the context to the CompilationInfo yet, because the background
   // thread cannot do anything with it anyway. We set it just before compilation
@@ -26,12 +26,14 @@ BackgroundParsingTask::BackgroundParsingTask(
   DCHECK(options == ScriptCompiler::kProduceParserCache ||
          options == ScriptCompiler::kProduceCodeCache ||
          options == ScriptCompiler::kNoCompileOptions);
+  DCHECK(!is_module || options == ScriptCompiler::kNoCompileOptions);
 
   // Prepare the data for the internalization phase and compilation phase, which
   // will happen in the main thread after parsing.
   Zone* zone = new Zone(isolate->allocator());
   ParseInfo* info = new ParseInfo(zone);
   info->set_toplevel();
+  if (is_module) info->set_module();
   source->zone.reset(zone);
   source->info.reset(info);
   info->set_isolate(isolate);
@@ -39,6 +41,7 @@ BackgroundParsingTask::BackgroundParsingTask(
   info->set_source_stream_encoding(source->encoding);
   info->set_hash_seed(isolate->heap()->HashSeed());
   info->set_unicode_cache(&source_->unicode_cache);
+  info->set_ast_string_constants(isolate->ast_string_constants());
   info->set_compile_options(options);
   info->set_allow_lazy_parsing();
 
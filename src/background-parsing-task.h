@@ -52,7 +52,7 @@ class BackgroundParsingTask : public ScriptCompiler::ScriptStreamingTask {
  public:
   BackgroundParsingTask(StreamedSource* source,
                         ScriptCompiler::CompileOptions options, int stack_size,
-                        Isolate* isolate);
+                        Isolate* isolate, bool is_module);
 
   virtual void Run();
 
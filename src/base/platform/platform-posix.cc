@@ -130,6 +130,27 @@ void OS::Guard(void* address, const size_t size) {
 }
 
 
+bool OS::AdviseHugePages(void* address, const size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+
+bool OS::DiscardSystemPages(void* address, const size_t size) {
+#if V8_OS_CYGWIN
+  return VirtualAlloc(address, size, MEM_RESET, PAGE_READWRITE) != NULL;
+#elif defined(MADV_FREE) && !V8_OS_LINUX
+  // MADV_FREE is lazy on Linux, so RSS would only drop under memory pressure.
+  return madvise(address, size, MADV_FREE) == 0;
+#else
+  return madvise(address, size, MADV_DONTNEED) == 0;
+#endif
+}
+
+
 static LazyInstance<RandomNumberGenerator>::type
     platform_random_number_generator = LAZY_INSTANCE_INITIALIZER;
 
@@ -274,14 +295,17 @@ class PosixMemoryMappedFile final : public OS::MemoryMappedFile {
 
 
 // static
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
-  if (FILE* file = fopen(name, "r+")) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                 FileMode mode) {
+  const bool read_only = mode == FileMode::kReadOnly;
+  if (FILE* file = fopen(name, read_only ? "r" : "r+")) {
     if (fseek(file, 0, SEEK_END) == 0) {
       long size = ftell(file);  // NOLINT(runtime/int)
       if (size >= 0) {
         void* const memory =
-            mmap(OS::GetRandomMmapAddr(), size, PROT_READ | PROT_WRITE,
-                 MAP_SHARED, fileno(file), 0);
+            mmap(OS::GetRandomMmapAddr(), size,
+                 read_only ? PROT_READ : PROT_READ | PROT_WRITE,
+                 read_only ? MAP_PRIVATE : MAP_SHARED, fileno(file), 0);
         if (memory != MAP_FAILED) {
           return new PosixMemoryMappedFile(file, memory, size);
         }
@@ -822,6 +822,17 @@ void OS::Guard(void* address, const size_t size) {
 }
 
 
+bool OS::AdviseHugePages(void* address, const size_t size) {
+  // Large pages on Windows must be allocated up front with MEM_LARGE_PAGES.
+  return false;
+}
+
+
+bool OS::DiscardSystemPages(void* address, const size_t size) {
+  return VirtualAlloc(address, size, MEM_RESET, PAGE_READWRITE) != NULL;
+}
+
+
 void OS::Sleep(TimeDelta interval) {
   ::Sleep(static_cast<DWORD>(interval.InMilliseconds()));
 }
@@ -872,21 +883,25 @@ class Win32MemoryMappedFile final : public OS::MemoryMappedFile {
 
 
 // static
-OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name) {
+OS::MemoryMappedFile* OS::MemoryMappedFile::open(const char* name,
+                                                 FileMode mode) {
+  const bool read_only = mode == FileMode::kReadOnly;
   // Open a physical file
-  HANDLE file = CreateFileA(name, GENERIC_READ | GENERIC_WRITE,
+  HANDLE file = CreateFileA(
+      name, read_only ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE),
       FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, 0, NULL);
   if (file == INVALID_HANDLE_VALUE) return NULL;
 
   DWORD size = GetFileSize(file, NULL);
 
   // Create a file mapping for the physical file
-  HANDLE file_mapping =
-      CreateFileMapping(file, NULL, PAGE_READWRITE, 0, size, NULL);
+  HANDLE file_mapping = CreateFileMapping(
+      file, NULL, read_only ? PAGE_READONLY : PAGE_READWRITE, 0, size, NULL);
   if (file_mapping == NULL) return NULL;
 
   // Map a view of the file into memory
-  void* memory = MapViewOfFile(file_mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+  DWORD access = read_only ? FILE_MAP_READ : FILE_MAP_ALL_ACCESS;
+  void* memory = MapViewOfFile(file_mapping, access, 0, 0, size);
   return new Win32MemoryMappedFile(file, file_mapping, memory, size);
 }
 
@@ -188,6 +188,15 @@ class V8_BASE_EXPORT OS {
   // Assign memory as a guard page so that access will cause an exception.
   static void Guard(void* address, const size_t size);
 
+  // Advise the OS to back committed memory with transparent huge pages.
+  // Returns false if the hint is not supported or was rejected.
+  static bool AdviseHugePages(void* address, const size_t size);
+
+  // Release the physical pages backing committed memory. The memory stays
+  // committed; its contents become undefined and the pages are repopulated
+  // on the next access.
+  static bool DiscardSystemPages(void* address, const size_t size);
+
   // Generate a random address to be used for hinting mmap().
   static void* GetRandomMmapAddr();
 
@@ -214,11 +223,16 @@ class V8_BASE_EXPORT OS {
 
   class V8_BASE_EXPORT MemoryMappedFile {
    public:
+    // A kReadOnly file is mapped without write access and does not require
+    // write permission on the file.
+    enum class FileMode { kReadOnly, kReadWrite };
+
     virtual ~MemoryMappedFile() {}
     virtual void* memory() const = 0;
     virtual size_t size() const = 0;
 
-    static MemoryMappedFile* open(const char* name);
+    static MemoryMappedFile* open(const char* name,
+                                  FileMode mode = FileMode::kReadWrite);
     static MemoryMappedFile* create(const char* name, size_t size,
                                     void* initial);
   };
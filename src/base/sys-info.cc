@@ -16,6 +16,10 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <stdio.h>
+#endif
+
 #include <limits>
 
 #include "src/base/logging.h"
@@ -27,6 +31,30 @@
 namespace v8 {
 namespace base {
 
+#if V8_OS_LINUX
+namespace {
+
+// Returns the memory limit of the cgroup the process runs in, or 0 if there is
+// none. cgroup v2 exposes the limit in memory.max, which reads "max" when
+// unlimited; cgroup v1 reports a huge value instead.
+int64_t CGroupMemoryLimit() {
+  static const char* const kLimitFiles[] = {
+      "/sys/fs/cgroup/memory.max",
+      "/sys/fs/cgroup/memory/memory.limit_in_bytes"};
+  for (size_t i = 0; i < arraysize(kLimitFiles); i++) {
+    FILE* file = fopen(kLimitFiles[i], "r");
+    if (file == nullptr) continue;
+    long long limit = 0;  // NOLINT(runtime/int)
+    int matched = fscanf(file, "%lld", &limit);
+    fclose(file);
+    if (matched == 1 && limit > 0) return static_cast<int64_t>(limit);
+  }
+  return 0;
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
 // static
 int SysInfo::NumberOfProcessors() {
 #if V8_OS_OPENBSD
@@ -94,7 +122,13 @@ int64_t SysInfo::AmountOfPhysicalMemory() {
   if (pages == -1 || page_size == -1) {
     return 0;
   }
-  return static_cast<int64_t>(pages) * page_size;
+  int64_t result = static_cast<int64_t>(pages) * page_size;
+#if V8_OS_LINUX
+  // Inside a container, the cgroup limit is what the process can actually use.
+  int64_t cgroup_limit = CGroupMemoryLimit();
+  if (cgroup_limit > 0 && cgroup_limit < result) result = cgroup_limit;
+#endif
+  return result;
 #endif
 }
 
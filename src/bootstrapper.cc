@@ -19,6 +19,7 @@
 #include "src/isolate-inl.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/snapshot.h"
+#include "src/tracing/trace-event.h"
 #include "src/wasm/wasm-js.h"
 
 namespace v8 {
@@ -311,6 +312,7 @@ Handle<Context> Bootstrapper::CreateEnvironment(
     v8::Local<v8::ObjectTemplate> global_proxy_template,
     v8::ExtensionConfiguration* extensions, size_t context_snapshot_index,
     GlobalContextType context_type) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"), "V8.CreateEnvironment");
   HandleScope scope(isolate_);
   Genesis genesis(isolate_, maybe_global_proxy, global_proxy_template,
                   extensions, context_snapshot_index, context_type);
@@ -1176,7 +1178,7 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
     native_context()->set_object_is_sealed(*object_is_sealed);
 
     Handle<JSFunction> object_keys = SimpleInstallFunction(
-        object_function, "keys", Builtins::kObjectKeys, 1, false);
+        object_function, "keys", Builtins::kObjectKeys, 1, true);
     native_context()->set_object_keys(*object_keys);
 
     SimpleInstallFunction(isolate->initial_object_prototype(),
@@ -2128,37 +2130,53 @@ void Genesis::InitializeGlobal(Handle<JSGlobalObject> global_object,
                         kDataViewByteOffset);
 
     SimpleInstallFunction(prototype, "getInt8",
-                          Builtins::kDataViewPrototypeGetInt8, 1, false);
+                          Builtins::kDataViewPrototypeGetInt8, 1, false,
+                          kDataViewGetInt8);
     SimpleInstallFunction(prototype, "setInt8",
-                          Builtins::kDataViewPrototypeSetInt8, 2, false);
+                          Builtins::kDataViewPrototypeSetInt8, 2, false,
+                          kDataViewSetInt8);
     SimpleInstallFunction(prototype, "getUint8",
-                          Builtins::kDataViewPrototypeGetUint8, 1, false);
+                          Builtins::kDataViewPrototypeGetUint8, 1, false,
+                          kDataViewGetUint8);
     SimpleInstallFunction(prototype, "setUint8",
-                          Builtins::kDataViewPrototypeSetUint8, 2, false);
+                          Builtins::kDataViewPrototypeSetUint8, 2, false,
+                          kDataViewSetUint8);
     SimpleInstallFunction(prototype, "getInt16",
-                          Builtins::kDataViewPrototypeGetInt16, 1, false);
+                          Builtins::kDataViewPrototypeGetInt16, 1, false,
+                          kDataViewGetInt16);
     SimpleInstallFunction(prototype, "setInt16",
-                          Builtins::kDataViewPrototypeSetInt16, 2, false);
+                          Builtins::kDataViewPrototypeSetInt16, 2, false,
+                          kDataViewSetInt16);
     SimpleInstallFunction(prototype, "getUint16",
-                          Builtins::kDataViewPrototypeGetUint16, 1, false);
+                          Builtins::kDataViewPrototypeGetUint16, 1, false,
+                          kDataViewGetUint16);
     SimpleInstallFunction(prototype, "setUint16",
-                          Builtins::kDataViewPrototypeSetUint16, 2, false);
+                          Builtins::kDataViewPrototypeSetUint16, 2, false,
+                          kDataViewSetUint16);
     SimpleInstallFunction(prototype, "getInt32",
-                          Builtins::kDataViewPrototypeGetInt32, 1, false);
+                          Builtins::kDataViewPrototypeGetInt32, 1, false,
+                          kDataViewGetInt32);
     SimpleInstallFunction(prototype, "setInt32",
-                          Builtins::kDataViewPrototypeSetInt32, 2, false);
+                          Builtins::kDataViewPrototypeSetInt32, 2, false,
+                          kDataViewSetInt32);
     SimpleInstallFunction(prototype, "getUint32",
-                          Builtins::kDataViewPrototypeGetUint32, 1, false);
+                          Builtins::kDataViewPrototypeGetUint32, 1, false,
+                          kDataViewGetUint32);
     SimpleInstallFunction(prototype, "setUint32",
-                          Builtins::kDataViewPrototypeSetUint32, 2, false);
+                          Builtins::kDataViewPrototypeSetUint32, 2, false,
+                          kDataViewSetUint32);
     SimpleInstallFunction(prototype, "getFloat32",
-                          Builtins::kDataViewPrototypeGetFloat32, 1, false);
+                          Builtins::kDataViewPrototypeGetFloat32, 1, false,
+                          kDataViewGetFloat32);
     SimpleInstallFunction(prototype, "setFloat32",
-                          Builtins::kDataViewPrototypeSetFloat32, 2, false);
+                          Builtins::kDataViewPrototypeSetFloat32, 2, false,
+                          kDataViewSetFloat32);
     SimpleInstallFunction(prototype, "getFloat64",
-                          Builtins::kDataViewPrototypeGetFloat64, 1, false);
+                          Builtins::kDataViewPrototypeGetFloat64, 1, false,
+                          kDataViewGetFloat64);
     SimpleInstallFunction(prototype, "setFloat64",
-                          Builtins::kDataViewPrototypeSetFloat64, 2, false);
+                          Builtins::kDataViewPrototypeSetFloat64, 2, false,
+                          kDataViewSetFloat64);
   }
 
   {  // -- M a p
@@ -2589,6 +2607,7 @@ bool Bootstrapper::CompileNative(Isolate* isolate, Vector<const char> name,
                                  Handle<String> source, int argc,
                                  Handle<Object> argv[],
                                  NativesFlag natives_flag) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"), "V8.CompileNative");
   SuppressDebug compiling_natives(isolate->debug());
   // During genesis, the boilerplate for stack overflow won't work until the
   // environment has been at least partially initialized. Add a stack check
@@ -3119,7 +3138,6 @@ EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_regexp_property)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_function_sent)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_tailcalls)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_restrictive_declarations)
-EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(harmony_string_padding)
 #ifdef V8_I18N_SUPPORT
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(datetime_format_to_parts)
 EMPTY_INITIALIZE_GLOBAL_FOR_FEATURE(icu_case_mapping)
@@ -3232,6 +3250,17 @@ void Genesis::InitializeGlobal_harmony_object_own_property_descriptors() {
                         Builtins::kObjectGetOwnPropertyDescriptors, 1, false);
 }
 
+void Genesis::InitializeGlobal_harmony_string_padding() {
+  if (!FLAG_harmony_string_padding) return;
+  Handle<JSFunction> string_fun(native_context()->string_function());
+  Handle<JSObject> string_prototype(
+      JSObject::cast(string_fun->initial_map()->prototype()));
+  SimpleInstallFunction(string_prototype, "padEnd",
+                        Builtins::kStringPrototypePadEnd, 1, false);
+  SimpleInstallFunction(string_prototype, "padStart",
+                        Builtins::kStringPrototypePadStart, 1, false);
+}
+
 void Genesis::InitializeGlobal_harmony_array_prototype_values() {
   if (!FLAG_harmony_array_prototype_values) return;
   Handle<JSFunction> array_constructor(native_context()->array_function());
@@ -3714,8 +3743,7 @@ bool Genesis::InstallExperimentalNatives() {
   static const char* harmony_object_own_property_descriptors_natives[] = {
       nullptr};
   static const char* harmony_array_prototype_values_natives[] = {nullptr};
-  static const char* harmony_string_padding_natives[] = {
-      "native harmony-string-padding.js", nullptr};
+  static const char* harmony_string_padding_natives[] = {nullptr};
 #ifdef V8_I18N_SUPPORT
   static const char* icu_case_mapping_natives[] = {"native icu-case-mapping.js",
                                                    nullptr};
@@ -4337,6 +4365,7 @@ Genesis::Genesis(Isolate* isolate,
     // Re-initialize the counter because it got incremented during snapshot
     // creation.
     isolate->native_context()->set_errors_thrown(Smi::kZero);
+    isolate->native_context()->set_live_size(Smi::kZero);
   }
 
   // Install experimental natives. Do not include them into the
@@ -158,7 +158,7 @@ BUILTIN(AsyncFunctionConstructor) {
   // determined after the function is resumed.
   Handle<JSFunction> func = Handle<JSFunction>::cast(maybe_func);
   Handle<Script> script = handle(Script::cast(func->shared()->script()));
-  int position = script->GetEvalPosition();
+  int position = Script::GetEvalPosition(script);
   USE(position);
 
   return *func;
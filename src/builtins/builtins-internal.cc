@@ -97,6 +97,84 @@ void Builtins::Generate_CopyFastSmiOrObjectElements(
   }
 }
 
+void Builtins::Generate_NewUnmappedArgumentsElements(
+    CodeStubAssembler* assembler) {
+  typedef CodeStubAssembler::Label Label;
+  typedef CodeStubAssembler::Variable Variable;
+  typedef compiler::Node Node;
+  typedef NewArgumentsElementsDescriptor Descriptor;
+
+  Node* frame = assembler->Parameter(Descriptor::kFrame);
+  Node* length = assembler->Parameter(Descriptor::kLength);
+
+  // Check if we can allocate in new space.
+  ElementsKind kind = FAST_ELEMENTS;
+  int max_elements = FixedArrayBase::GetMaxLengthForNewSpaceAllocation(kind);
+  Label if_newspace(assembler), if_oldspace(assembler, Label::kDeferred);
+  assembler->Branch(assembler->SmiLessThan(
+                        length, assembler->SmiConstant(
+                                    Smi::FromInt(max_elements))),
+                    &if_newspace, &if_oldspace);
+
+  assembler->Bind(&if_newspace);
+  {
+    // Prefer the canonical empty FixedArray for zero {length}.
+    Label if_empty(assembler), if_notempty(assembler);
+    assembler->Branch(
+        assembler->SmiEqual(length, assembler->SmiConstant(Smi::kZero)),
+        &if_empty, &if_notempty);
+
+    assembler->Bind(&if_empty);
+    assembler->Return(assembler->EmptyFixedArrayConstant());
+
+    assembler->Bind(&if_notempty);
+    {
+      Node* index_length = assembler->SmiUntag(length);
+      Node* result = assembler->AllocateFixedArray(
+          kind, index_length, CodeStubAssembler::INTPTR_PARAMETERS);
+
+      // The parameters are pushed in order onto the stack above the {frame},
+      // so the last of the {length} parameters is closest to the {frame}.
+      Node* offset = assembler->IntPtrAdd(
+          index_length,
+          assembler->IntPtrConstant(
+              StandardFrameConstants::kCallerSPOffset / kPointerSize - 1));
+
+      // Copy the parameters from the {frame} to the {result}.
+      Variable var_index(assembler, MachineType::PointerRepresentation());
+      Label loop(assembler, &var_index), done_loop(assembler);
+      var_index.Bind(assembler->IntPtrConstant(0));
+      assembler->Goto(&loop);
+      assembler->Bind(&loop);
+      {
+        Node* index = var_index.value();
+        assembler->GotoIf(assembler->WordEqual(index, index_length),
+                          &done_loop);
+        Node* value = assembler->Load(
+            MachineType::AnyTagged(), frame,
+            assembler->WordShl(assembler->IntPtrSub(offset, index),
+                               assembler->IntPtrConstant(kPointerSizeLog2)));
+        assembler->StoreFixedArrayElement(
+            result, index, value, SKIP_WRITE_BARRIER,
+            CodeStubAssembler::INTPTR_PARAMETERS);
+        var_index.Bind(
+            assembler->IntPtrAdd(index, assembler->IntPtrConstant(1)));
+        assembler->Goto(&loop);
+      }
+
+      assembler->Bind(&done_loop);
+      assembler->Return(result);
+    }
+  }
+
+  assembler->Bind(&if_oldspace);
+  {
+    // Allocate in old space (or large object space) via the runtime.
+    assembler->TailCallRuntime(Runtime::kNewArgumentsElements,
+                               assembler->NoContextConstant(), frame, length);
+  }
+}
+
 void Builtins::Generate_GrowFastDoubleElements(CodeStubAssembler* assembler) {
   typedef CodeStubAssembler::Label Label;
   typedef compiler::Node Node;
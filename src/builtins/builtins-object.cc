@@ -472,8 +472,7 @@ BUILTIN(ObjectCreate) {
 
   // Generate the map with the specified {prototype} based on the Object
   // function's initial map from the current native context.
-  // TODO(bmeurer): Use a dedicated cache for Object.create; think about
-  // slack tracking for Object.create.
+  // TODO(bmeurer): Use a dedicated cache for Object.create.
   Handle<Map> map(isolate->native_context()->object_function()->initial_map(),
                   isolate);
   if (map->prototype() != *prototype) {
@@ -486,12 +485,21 @@ BUILTIN(ObjectCreate) {
       }
       Handle<PrototypeInfo> info =
           Map::GetOrCreatePrototypeInfo(js_prototype, isolate);
-      // TODO(verwaest): Use inobject slack tracking for this map.
       if (info->HasObjectCreateMap()) {
         map = handle(info->ObjectCreateMap(), isolate);
       } else {
-        map = Map::CopyInitialMap(map);
+        // Start out with generous in-object space, so that the properties
+        // added after Object.create stay in-object, and let in-object slack
+        // tracking reclaim what the first instances didn't use.
+        int const in_object_properties =
+            JSObject::kInitialObjectCreateInObjectProperties;
+        int const instance_size =
+            JSObject::kHeaderSize + in_object_properties * kPointerSize;
+        map = Map::CopyInitialMap(map, instance_size, in_object_properties,
+                                  in_object_properties);
         Map::SetPrototype(map, prototype, FAST_PROTOTYPE);
+        map->set_construction_counter(Map::kNoSlackTracking);
+        map->StartInobjectSlackTracking();
         PrototypeInfo::SetObjectCreateMap(info, map);
       }
     } else {
@@ -786,38 +794,78 @@ BUILTIN(ObjectIsSealed) {
 }
 
 // ES6 section 19.1.2.14 Object.keys ( O )
-BUILTIN(ObjectKeys) {
-  HandleScope scope(isolate);
-  Handle<Object> object = args.atOrUndefined(isolate, 1);
-  Handle<JSReceiver> receiver;
-  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, receiver,
-                                     Object::ToObject(isolate, object));
+void Builtins::Generate_ObjectKeys(CodeStubAssembler* assembler) {
+  typedef compiler::Node Node;
+  typedef CodeStubAssembler::Label Label;
 
-  Handle<FixedArray> keys;
-  int enum_length = receiver->map()->EnumLength();
-  if (enum_length != kInvalidEnumCacheSentinel &&
-      JSObject::cast(*receiver)->elements() ==
-          isolate->heap()->empty_fixed_array()) {
-    DCHECK(receiver->IsJSObject());
-    DCHECK(!JSObject::cast(*receiver)->HasNamedInterceptor());
-    DCHECK(!JSObject::cast(*receiver)->IsAccessCheckNeeded());
-    DCHECK(!receiver->map()->has_hidden_prototype());
-    DCHECK(JSObject::cast(*receiver)->HasFastProperties());
-    if (enum_length == 0) {
-      keys = isolate->factory()->empty_fixed_array();
-    } else {
-      Handle<FixedArray> cache(
-          receiver->map()->instance_descriptors()->GetEnumCache());
-      keys = isolate->factory()->CopyFixedArrayUpTo(cache, enum_length);
-    }
-  } else {
-    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
-        isolate, keys,
-        KeyAccumulator::GetKeys(receiver, KeyCollectionMode::kOwnOnly,
-                                ENUMERABLE_STRINGS,
-                                GetKeysConversion::kConvertToString));
+  Node* object = assembler->Parameter(1);
+  Node* context = assembler->Parameter(4);
+
+  Label if_empty(assembler), if_fast(assembler), call_runtime(assembler);
+
+  // The enum cache of the map can be used if it is valid and {object} has no
+  // elements. A valid enum length implies a JSObject in fast mode without
+  // interceptors or access checks.
+  assembler->GotoIf(assembler->TaggedIsSmi(object), &call_runtime);
+  Node* map = assembler->LoadMap(object);
+  assembler->GotoUnless(
+      assembler->IsJSReceiverInstanceType(assembler->LoadMapInstanceType(map)),
+      &call_runtime);
+  Node* enum_length = assembler->BitFieldDecode<Map::EnumLengthBits>(
+      assembler->LoadMapBitField3(map));
+  Node* invalid_enum_length =
+      assembler->Int32Constant(kInvalidEnumCacheSentinel);
+  assembler->GotoIf(assembler->Word32Equal(enum_length, invalid_enum_length),
+                    &call_runtime);
+  assembler->GotoUnless(
+      assembler->WordEqual(assembler->LoadElements(object),
+                           assembler->EmptyFixedArrayConstant()),
+      &call_runtime);
+  Node* native_context = assembler->LoadNativeContext(context);
+  Node* array_map =
+      assembler->LoadJSArrayElementsMap(FAST_ELEMENTS, native_context);
+  assembler->Branch(assembler->Word32Equal(enum_length,
+                                           assembler->Int32Constant(0)),
+                    &if_empty, &if_fast);
+
+  assembler->Bind(&if_empty);
+  {
+    Node* array = assembler->AllocateUninitializedJSArrayWithoutElements(
+        FAST_ELEMENTS, array_map, assembler->SmiConstant(Smi::kZero), nullptr);
+    assembler->StoreObjectFieldRoot(array, JSArray::kElementsOffset,
+                                    Heap::kEmptyFixedArrayRootIndex);
+    assembler->Return(array);
   }
-  return *isolate->factory()->NewJSArrayWithElements(keys, FAST_ELEMENTS);
+
+  assembler->Bind(&if_fast);
+  {
+    // Copy the enum cache, which may be longer than {enum_length}.
+    Node* descriptors = assembler->LoadMapDescriptors(map);
+    Node* cache_bridge = assembler->LoadObjectField(
+        descriptors, DescriptorArray::kEnumCacheOffset);
+    Node* cache = assembler->LoadObjectField(
+        cache_bridge, DescriptorArray::kEnumCacheBridgeCacheOffset);
+    Node* length =
+        assembler->SmiTag(assembler->ChangeUint32ToWord(enum_length));
+    Node* array;
+    Node* elements;
+    std::tie(array, elements) =
+        assembler->AllocateUninitializedJSArrayWithElements(
+            FAST_ELEMENTS, array_map, length, nullptr, length,
+            CodeStubAssembler::SMI_PARAMETERS);
+    assembler->StoreMapNoWriteBarrier(
+        elements, assembler->LoadRoot(Heap::kFixedArrayMapRootIndex));
+    assembler->StoreObjectFieldNoWriteBarrier(
+        elements, FixedArray::kLengthOffset, length);
+    assembler->CopyFixedArrayElements(FAST_ELEMENTS, cache, elements, length,
+                                      SKIP_WRITE_BARRIER,
+                                      CodeStubAssembler::SMI_PARAMETERS);
+    assembler->Return(array);
+  }
+
+  assembler->Bind(&call_runtime);
+  assembler->Return(
+      assembler->CallRuntime(Runtime::kObjectKeys, context, object));
 }
 
 BUILTIN(ObjectValues) {
@@ -783,6 +783,39 @@ void Builtins::Generate_StringPrototypeCharCodeAt(
   assembler->Return(result);
 }
 
+namespace {  // for String.prototype.startsWith and endsWith
+
+template <typename Char>
+bool MatchesAt(Vector<const Char> subject, String::FlatContent search,
+               int start) {
+  if (search.IsOneByte()) {
+    Vector<const uint8_t> chars = search.ToOneByteVector();
+    return CompareChars(subject.start() + start, chars.start(),
+                        chars.length()) == 0;
+  }
+  Vector<const uc16> chars = search.ToUC16Vector();
+  return CompareChars(subject.start() + start, chars.start(),
+                      chars.length()) == 0;
+}
+
+// Checks whether the characters of {search} appear in {subject} at
+// {start}, comparing the flat contents directly instead of going through
+// a FlatStringReader per character.
+bool MatchesAt(Handle<String> subject, Handle<String> search, int start) {
+  DCHECK_LE(start + search->length(), subject->length());
+  subject = String::Flatten(subject);
+  search = String::Flatten(search);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent subject_content = subject->GetFlatContent();
+  String::FlatContent search_content = search->GetFlatContent();
+  if (subject_content.IsOneByte()) {
+    return MatchesAt(subject_content.ToOneByteVector(), search_content, start);
+  }
+  return MatchesAt(subject_content.ToUC16Vector(), search_content, start);
+}
+
+}  // namespace
+
 // ES6 section 21.1.3.6
 // String.prototype.endsWith ( searchString [ , endPosition ] )
 BUILTIN(StringPrototypeEndsWith) {
@@ -822,15 +855,7 @@ BUILTIN(StringPrototypeEndsWith) {
   int start = end - search_string->length();
   if (start < 0) return *isolate->factory()->false_value();
 
-  FlatStringReader str_reader(isolate, String::Flatten(str));
-  FlatStringReader search_reader(isolate, String::Flatten(search_string));
-
-  for (int i = 0; i < search_string->length(); i++) {
-    if (str_reader.Get(start + i) != search_reader.Get(i)) {
-      return *isolate->factory()->false_value();
-    }
-  }
-  return *isolate->factory()->true_value();
+  return isolate->heap()->ToBoolean(MatchesAt(str, search_string, start));
 }
 
 // ES6 section 21.1.3.7
@@ -971,6 +996,87 @@ BUILTIN(StringPrototypeNormalize) {
   return *string;
 }
 
+namespace {  // for String.prototype.padStart and padEnd
+
+enum class StringPaddingPlacement { kStart, kEnd };
+
+template <typename Char>
+void WritePaddedString(String* string, String* filler, int fill_length,
+                       StringPaddingPlacement placement, Char* chars) {
+  DisallowHeapAllocation no_gc;
+  int string_length = string->length();
+  int filler_length = filler->length();
+  if (placement == StringPaddingPlacement::kStart) {
+    String::WriteToFlat(string, chars + fill_length, 0, string_length);
+  } else {
+    String::WriteToFlat(string, chars, 0, string_length);
+    chars += string_length;
+  }
+  for (int i = 0; i < fill_length; i += filler_length) {
+    int count = std::min(filler_length, fill_length - i);
+    String::WriteToFlat(filler, chars + i, 0, count);
+  }
+}
+
+// Builds the padded string in a single sequential string of the final
+// length, instead of concatenating repeated copies of the filler.
+Object* StringPad(Isolate* isolate, BuiltinArguments* args,
+                  Handle<String> string, StringPaddingPlacement placement) {
+  Handle<Object> max_length = args->atOrUndefined(isolate, 1);
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, max_length,
+                                     Object::ToLength(isolate, max_length));
+  int string_length = string->length();
+  if (max_length->Number() <= string_length) return *string;
+
+  Handle<String> filler;
+  Handle<Object> fill_string = args->atOrUndefined(isolate, 2);
+  if (fill_string->IsUndefined(isolate)) {
+    filler = isolate->factory()->LookupSingleCharacterStringFromCode(' ');
+  } else {
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, filler,
+                                       Object::ToString(isolate, fill_string));
+    if (filler->length() == 0) return *string;
+  }
+
+  if (max_length->Number() > String::kMaxLength) {
+    THROW_NEW_ERROR_RETURN_FAILURE(isolate, NewInvalidStringLengthError());
+  }
+  int length = static_cast<int>(max_length->Number());
+  int fill_length = length - string_length;
+  filler = String::Flatten(filler);
+
+  if (string->IsOneByteRepresentation() && filler->IsOneByteRepresentation()) {
+    Handle<SeqOneByteString> result;
+    ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+        isolate, result, isolate->factory()->NewRawOneByteString(length));
+    WritePaddedString(*string, *filler, fill_length, placement,
+                      result->GetChars());
+    return *result;
+  }
+  Handle<SeqTwoByteString> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, result, isolate->factory()->NewRawTwoByteString(length));
+  WritePaddedString(*string, *filler, fill_length, placement,
+                    result->GetChars());
+  return *result;
+}
+
+}  // namespace
+
+// String.prototype.padEnd ( maxLength [ , fillString ] )
+BUILTIN(StringPrototypePadEnd) {
+  HandleScope handle_scope(isolate);
+  TO_THIS_STRING(string, "String.prototype.padEnd");
+  return StringPad(isolate, &args, string, StringPaddingPlacement::kEnd);
+}
+
+// String.prototype.padStart ( maxLength [ , fillString ] )
+BUILTIN(StringPrototypePadStart) {
+  HandleScope handle_scope(isolate);
+  TO_THIS_STRING(string, "String.prototype.padStart");
+  return StringPad(isolate, &args, string, StringPaddingPlacement::kStart);
+}
+
 // ES6 section B.2.3.1 String.prototype.substr ( start, length )
 void Builtins::Generate_StringPrototypeSubstr(CodeStubAssembler* a) {
   typedef CodeStubAssembler::Label Label;
@@ -1242,15 +1348,7 @@ BUILTIN(StringPrototypeStartsWith) {
     return *isolate->factory()->false_value();
   }
 
-  FlatStringReader str_reader(isolate, String::Flatten(str));
-  FlatStringReader search_reader(isolate, String::Flatten(search_string));
-
-  for (int i = 0; i < search_string->length(); i++) {
-    if (str_reader.Get(start + i) != search_reader.Get(i)) {
-      return *isolate->factory()->false_value();
-    }
-  }
-  return *isolate->factory()->true_value();
+  return isolate->heap()->ToBoolean(MatchesAt(str, search_string, start));
 }
 
 // ES6 section 21.1.3.25 String.prototype.toString ()
@@ -150,6 +150,8 @@ namespace internal {
   /* TurboFan support builtins */                                             \
   TFS(CopyFastSmiOrObjectElements, BUILTIN, kNoExtraICState,                  \
       CopyFastSmiOrObjectElements)                                            \
+  TFS(NewUnmappedArgumentsElements, BUILTIN, kNoExtraICState,                 \
+      NewArgumentsElements)                                                   \
   TFS(GrowFastDoubleElements, BUILTIN, kNoExtraICState, GrowArrayElements)    \
   TFS(GrowFastSmiOrObjectElements, BUILTIN, kNoExtraICState,                  \
       GrowArrayElements)                                                      \
@@ -531,7 +533,8 @@ namespace internal {
   CPP(ObjectIsExtensible)                                                     \
   CPP(ObjectIsFrozen)                                                         \
   CPP(ObjectIsSealed)                                                         \
-  CPP(ObjectKeys)                                                             \
+  /* ES6 section 19.1.2.14 Object.keys ( O ) */                              \
+  TFJ(ObjectKeys, 2)                                                          \
   CPP(ObjectLookupGetter)                                                     \
   CPP(ObjectLookupSetter)                                                     \
   CPP(ObjectPreventExtensions)                                                \
@@ -630,6 +633,10 @@ namespace internal {
   CPP(StringPrototypeLocaleCompare)                                           \
   /* ES6 section 21.1.3.12 String.prototype.normalize ( [form] ) */           \
   CPP(StringPrototypeNormalize)                                               \
+  /* String.prototype.padEnd ( maxLength [ , fillString ] ) */                \
+  CPP(StringPrototypePadEnd)                                                  \
+  /* String.prototype.padStart ( maxLength [ , fillString ] ) */              \
+  CPP(StringPrototypePadStart)                                                \
   /* ES6 section B.2.3.1 String.prototype.substr ( start, length ) */         \
   TFJ(StringPrototypeSubstr, 3)                                               \
   /* ES6 section 21.1.3.19 String.prototype.substring ( start, end ) */       \
@@ -400,6 +400,12 @@ Callable CodeFactory::CopyFastSmiOrObjectElements(Isolate* isolate) {
                   CopyFastSmiOrObjectElementsDescriptor(isolate));
 }
 
+// static
+Callable CodeFactory::NewUnmappedArgumentsElements(Isolate* isolate) {
+  return Callable(isolate->builtins()->NewUnmappedArgumentsElements(),
+                  NewArgumentsElementsDescriptor(isolate));
+}
+
 // static
 Callable CodeFactory::GrowFastDoubleElements(Isolate* isolate) {
   return Callable(isolate->builtins()->GrowFastDoubleElements(),
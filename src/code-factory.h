@@ -136,6 +136,7 @@ class CodeFactory final {
                                          bool skip_stub_frame = false);
 
   static Callable CopyFastSmiOrObjectElements(Isolate* isolate);
+  static Callable NewUnmappedArgumentsElements(Isolate* isolate);
   static Callable GrowFastDoubleElements(Isolate* isolate);
   static Callable GrowFastSmiOrObjectElements(Isolate* isolate);
 
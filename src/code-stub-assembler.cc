@@ -4903,6 +4903,28 @@ void CodeStubAssembler::HandleLoadICHandlerCase(
       Comment("property_load");
     }
 
+    Label constant(this), field(this);
+    Node* constant_bit =
+        WordAnd(handler_word, IntPtrConstant(LoadHandlerIsConstant::kMask));
+    Branch(WordEqual(constant_bit, IntPtrConstant(0)), &field, &constant);
+
+    Bind(&constant);
+    {
+      Comment("constant_load");
+      Node* descriptors = LoadMapDescriptors(LoadMap(holder));
+      Node* descriptor = WordShr(
+          WordAnd(handler_word, IntPtrConstant(ConstantDescriptorIndex::kMask)),
+          IntPtrConstant(ConstantDescriptorIndex::kShift));
+      Node* value_index =
+          IntPtrAdd(IntPtrMul(descriptor,
+                              IntPtrConstant(DescriptorArray::kDescriptorSize)),
+                    IntPtrConstant(DescriptorArray::ToValueIndex(0)));
+      Return(LoadFixedArrayElement(descriptors, value_index, 0,
+                                   INTPTR_PARAMETERS));
+    }
+
+    Bind(&field);
+    Comment("field_load");
     // |handler_word| is a field index as obtained by
     // FieldIndex.GetLoadByFieldOffset():
     Label inobject_double(this), out_of_object(this),
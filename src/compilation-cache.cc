@@ -13,8 +13,9 @@ namespace v8 {
 namespace internal {
 
 
-// The number of generations for each sub cache.
-static const int kRegExpGenerations = 2;
+// The minimum number of generations of the regexp sub cache. A single
+// generation would never be aged, as regexp entries carry no age of their own.
+static const int kMinRegExpGenerations = 2;
 
 // Initial size of each compilation cache table allocated.
 static const int kInitialCacheSize = 64;
@@ -25,10 +26,12 @@ CompilationCache::CompilationCache(Isolate* isolate)
       script_(isolate, 1),
       eval_global_(isolate, 1),
       eval_contextual_(isolate, 1),
-      reg_exp_(isolate, kRegExpGenerations),
+      reg_exp_(isolate,
+               Max(kMinRegExpGenerations, FLAG_regexp_cache_generations)),
+      functions_(isolate, 1),
       enabled_(true) {
   CompilationSubCache* subcaches[kSubCacheCount] =
-    {&script_, &eval_global_, &eval_contextual_, &reg_exp_};
+    {&script_, &eval_global_, &eval_contextual_, &reg_exp_, &functions_};
   for (int i = 0; i < kSubCacheCount; ++i) {
     subcaches_[i] = subcaches[i];
   }
@@ -104,6 +107,15 @@ void CompilationSubCache::Remove(Handle<SharedFunctionInfo> function_info) {
 }
 
 
+void CompilationSubCache::RemoveOuter(SharedFunctionInfo* outer_info) {
+  Object* undefined = isolate()->heap()->undefined_value();
+  for (int generation = 0; generation < generations(); generation++) {
+    if (tables_[generation] == undefined) continue;
+    CompilationCacheTable::cast(tables_[generation])->RemoveOuter(outer_info);
+  }
+}
+
+
 CompilationCacheScript::CompilationCacheScript(Isolate* isolate,
                                                int generations)
     : CompilationSubCache(isolate, generations) {}
@@ -324,6 +336,17 @@ MaybeHandle<FixedArray> CompilationCache::LookupRegExp(Handle<String> source,
 }
 
 
+MaybeHandle<SharedFunctionInfo> CompilationCache::LookupFunction(
+    Handle<String> source, Handle<Context> context, LanguageMode language_mode,
+    int position) {
+  if (!IsEnabled()) return MaybeHandle<SharedFunctionInfo>();
+
+  DCHECK(context->IsNativeContext());
+  Handle<SharedFunctionInfo> outer_info(context->closure()->shared());
+  return functions_.Lookup(source, outer_info, language_mode, position);
+}
+
+
 void CompilationCache::PutScript(Handle<String> source,
                                  Handle<Context> context,
                                  LanguageMode language_mode,
@@ -363,6 +386,29 @@ void CompilationCache::PutRegExp(Handle<String> source,
 }
 
 
+void CompilationCache::PutFunction(Handle<String> source,
+                                   Handle<Context> context,
+                                   Handle<SharedFunctionInfo> function_info,
+                                   int position) {
+  if (!IsEnabled()) return;
+
+  HandleScope scope(isolate());
+  DCHECK(context->IsNativeContext());
+  Handle<SharedFunctionInfo> outer_info(context->closure()->shared());
+  functions_.Put(source, outer_info, function_info, position);
+}
+
+
+void CompilationCache::RemoveContext(Handle<Context> context) {
+  // Script and function entries are keyed by the closure of the native
+  // context they were compiled in.
+  DCHECK(context->IsNativeContext());
+  SharedFunctionInfo* outer_info = context->closure()->shared();
+  script_.RemoveOuter(outer_info);
+  functions_.RemoveOuter(outer_info);
+}
+
+
 void CompilationCache::Clear() {
   for (int i = 0; i < kSubCacheCount; i++) {
     subcaches_[i]->Clear();
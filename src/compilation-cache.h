@@ -56,6 +56,9 @@ class CompilationSubCache {
   // Remove given shared function info from sub-cache.
   void Remove(Handle<SharedFunctionInfo> function_info);
 
+  // Remove the entries whose key refers to |outer_info|.
+  void RemoveOuter(SharedFunctionInfo* outer_info);
+
   // Number of generations in this sub-cache.
   inline int generations() { return generations_; }
 
@@ -142,8 +145,8 @@ class CompilationCacheRegExp: public CompilationSubCache {
 
 
 // The compilation cache keeps shared function infos for compiled
-// scripts and evals. The shared function infos are looked up using
-// the source string as the key. For regular expressions the
+// scripts, evals and functions. The shared function infos are looked up
+// using the source string as the key. For regular expressions the
 // compilation data is cached.
 class CompilationCache {
  public:
@@ -167,6 +170,15 @@ class CompilationCache {
   MaybeHandle<FixedArray> LookupRegExp(
       Handle<String> source, JSRegExp::Flags flags);
 
+  // Finds the shared function info of a compiled function whose source
+  // string is |source| and which starts at |position| of a script compiled
+  // in the native |context|. Returns an empty handle if the cache doesn't
+  // contain such a function.
+  MaybeHandle<SharedFunctionInfo> LookupFunction(Handle<String> source,
+                                                 Handle<Context> context,
+                                                 LanguageMode language_mode,
+                                                 int position);
+
   // Associate the (source, kind) pair to the shared function
   // info. This may overwrite an existing mapping.
   void PutScript(Handle<String> source,
@@ -186,12 +198,22 @@ class CompilationCache {
                  JSRegExp::Flags flags,
                  Handle<FixedArray> data);
 
+  // Associate the (source, context->closure()->shared(), kind, position)
+  // tuple with the shared function info of a compiled function. As for
+  // evals, the first put only records the key, so that only functions which
+  // are compiled in more than one script occupy the cache.
+  void PutFunction(Handle<String> source, Handle<Context> context,
+                   Handle<SharedFunctionInfo> function_info, int position);
+
   // Clear the cache - also used to initialize the cache at startup.
   void Clear();
 
   // Remove given shared function info from all caches.
   void Remove(Handle<SharedFunctionInfo> function_info);
 
+  // Remove the scripts and functions compiled in the native |context|.
+  void RemoveContext(Handle<Context> context);
+
   // GC support.
   void Iterate(ObjectVisitor* v);
   void IterateFunctions(ObjectVisitor* v);
@@ -213,7 +235,7 @@ class CompilationCache {
   base::HashMap* EagerOptimizingSet();
 
   // The number of sub caches covering the different types to cache.
-  static const int kSubCacheCount = 4;
+  static const int kSubCacheCount = 5;
 
   bool IsEnabled() { return FLAG_compilation_cache && enabled_; }
 
@@ -225,6 +247,7 @@ class CompilationCache {
   CompilationCacheEval eval_global_;
   CompilationCacheEval eval_contextual_;
   CompilationCacheRegExp reg_exp_;
+  CompilationCacheEval functions_;
   CompilationSubCache* subcaches_[kSubCacheCount];
 
   // Current enable state of the compilation cache.
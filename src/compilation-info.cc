@@ -183,6 +183,19 @@ CompilationInfo::SourcePositionRecordingMode() const {
              : SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS;
 }
 
+SourcePositionTableBuilder::RecordingMode
+CompilationInfo::BytecodeSourcePositionRecordingMode() const {
+  SourcePositionTableBuilder::RecordingMode mode =
+      SourcePositionRecordingMode();
+  if (mode == SourcePositionTableBuilder::RECORD_SOURCE_POSITIONS &&
+      FLAG_lazy_source_positions && !is_debug() &&
+      !is_source_positions_enabled() && !parse_info()->is_toplevel() &&
+      !isolate()->NeedsSourcePositionsForProfiling()) {
+    return SourcePositionTableBuilder::LAZY_SOURCE_POSITIONS;
+  }
+  return mode;
+}
+
 bool CompilationInfo::ExpectsJSReceiverAsReceiver() {
   return is_sloppy(parse_info()->language_mode()) && !parse_info()->is_native();
 }
@@ -216,8 +229,12 @@ void CompilationInfo::SetOptimizing() {
 
 void CompilationInfo::AddInlinedFunction(
     Handle<SharedFunctionInfo> inlined_function) {
+  Handle<BytecodeArray> bytecode;
+  if (inlined_function->HasBytecodeArray()) {
+    bytecode = handle(inlined_function->bytecode_array());
+  }
   inlined_functions_.push_back(InlinedFunctionHolder(
-      inlined_function, handle(inlined_function->code())));
+      inlined_function, handle(inlined_function->code()), bytecode));
 }
 
 Code::Kind CompilationInfo::output_code_kind() const {
@@ -51,6 +51,7 @@ class CompilationInfo final {
     kBailoutOnUninitialized = 1 << 15,
     kOptimizeFromBytecode = 1 << 16,
     kTypeFeedbackEnabled = 1 << 17,
+    kFastCompilation = 1 << 18,
   };
 
   CompilationInfo(ParseInfo* parse_info, Handle<JSFunction> closure);
@@ -186,6 +187,11 @@ class CompilationInfo final {
     return GetFlag(kOptimizeFromBytecode);
   }
 
+  // Skips optional backend passes, trading code quality for compile time.
+  void MarkAsFastCompilation() { SetFlag(kFastCompilation); }
+
+  bool is_fast_compilation() const { return GetFlag(kFastCompilation); }
+
   bool GeneratePreagedPrologue() const {
     // Generate a pre-aged prologue if we are optimizing for size, which
     // will make code flushing more aggressive. Only apply to Code::FUNCTION,
@@ -290,10 +296,16 @@ class CompilationInfo final {
     // Do not remove.
     Handle<Code> inlined_code_object_root;
 
+    // Root that holds the bytecode of the inlined function alive (and out of
+    // reach of bytecode flushing), or a null handle if it has no bytecode.
+    Handle<BytecodeArray> inlined_bytecode_root;
+
     InlinedFunctionHolder(Handle<SharedFunctionInfo> inlined_shared_info,
-                          Handle<Code> inlined_code_object_root)
+                          Handle<Code> inlined_code_object_root,
+                          Handle<BytecodeArray> inlined_bytecode_root)
         : shared_info(inlined_shared_info),
-          inlined_code_object_root(inlined_code_object_root) {}
+          inlined_code_object_root(inlined_code_object_root),
+          inlined_bytecode_root(inlined_bytecode_root) {}
   };
 
   typedef std::vector<InlinedFunctionHolder> InlinedFunctionList;
@@ -313,6 +325,12 @@ class CompilationInfo final {
 
   SourcePositionTableBuilder::RecordingMode SourcePositionRecordingMode() const;
 
+  // Like the above, but allows the source positions of bytecode to be
+  // omitted, since they can be collected later by generating the same
+  // bytecode again (see Compiler::CollectSourcePositions).
+  SourcePositionTableBuilder::RecordingMode
+  BytecodeSourcePositionRecordingMode() const;
+
  private:
   // Compilation mode.
   // BASE is generated by the full codegen, optionally prepared for bailouts.
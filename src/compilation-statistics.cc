@@ -14,6 +14,7 @@ namespace internal {
 void CompilationStatistics::RecordPhaseStats(const char* phase_kind_name,
                                              const char* phase_name,
                                              const BasicStats& stats) {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
   std::string phase_name_str(phase_name);
   auto it = phase_map_.find(phase_name_str);
   if (it == phase_map_.end()) {
@@ -26,6 +27,7 @@ void CompilationStatistics::RecordPhaseStats(const char* phase_kind_name,
 
 void CompilationStatistics::RecordPhaseKindStats(const char* phase_kind_name,
                                                  const BasicStats& stats) {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
   std::string phase_kind_name_str(phase_kind_name);
   auto it = phase_kind_map_.find(phase_kind_name_str);
   if (it == phase_kind_map_.end()) {
@@ -39,11 +41,65 @@ void CompilationStatistics::RecordPhaseKindStats(const char* phase_kind_name,
 
 void CompilationStatistics::RecordTotalStats(size_t source_size,
                                              const BasicStats& stats) {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
   source_size += source_size;
   total_stats_.Accumulate(stats);
 }
 
 
+void CompilationStatistics::BeginJob() {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+  active_jobs_++;
+}
+
+
+void CompilationStatistics::EndJob() {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+  DCHECK_GT(active_jobs_, 0);
+  active_jobs_--;
+  if (active_jobs_ == 0 && reset_pending_) ClearLocked();
+}
+
+
+void CompilationStatistics::Reset() {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+  if (active_jobs_ > 0) {
+    reset_pending_ = true;
+  } else {
+    ClearLocked();
+  }
+}
+
+
+void CompilationStatistics::ClearLocked() {
+  total_stats_ = TotalStats();
+  phase_kind_map_.clear();
+  phase_map_.clear();
+  reset_pending_ = false;
+}
+
+
+size_t CompilationStatistics::NumberOfPhases() const {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+  return phase_map_.size();
+}
+
+
+bool CompilationStatistics::GetPhaseStats(size_t index, BasicStats* stats,
+                                          const char** phase_kind_name,
+                                          const char** phase_name) const {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+  for (auto it = phase_map_.begin(); it != phase_map_.end(); ++it) {
+    if (it->second.insert_order_ != index) continue;
+    *stats = it->second;
+    *phase_kind_name = it->second.phase_kind_name_.c_str();
+    *phase_name = it->first.c_str();
+    return true;
+  }
+  return false;
+}
+
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -111,6 +167,7 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   // phase_kind_map_ and phase_map_ don't get mutated, so store a bunch of
   // pointers into them.
   const CompilationStatistics& s = ps.s;
+  base::LockGuard<base::Mutex> guard(&s.record_mutex_);
 
   typedef std::vector<CompilationStatistics::PhaseKindMap::const_iterator>
       SortedPhaseKinds;
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "src/allocation.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 
 namespace v8 {
@@ -24,7 +25,7 @@ struct AsPrintableStatistics {
 
 class CompilationStatistics final : public Malloced {
  public:
-  CompilationStatistics() {}
+  CompilationStatistics() : active_jobs_(0), reset_pending_(false) {}
 
   class BasicStats {
    public:
@@ -50,6 +51,24 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(size_t source_size, const BasicStats& stats);
 
+  // Called around each compilation job that records into this object. Jobs
+  // can run concurrently, so all accesses are guarded by record_mutex_.
+  void BeginJob();
+  void EndJob();
+
+  // Discards the statistics recorded so far. If jobs are still recording,
+  // this happens once the last of them ends.
+  void Reset();
+
+  size_t NumberOfPhases() const;
+
+  // Copies the stats of the phase first recorded as the index'th one into
+  // |stats|, or returns false if index is out of range. The names stay valid
+  // until the statistics are reset.
+  bool GetPhaseStats(size_t index, BasicStats* stats,
+                     const char** phase_kind_name,
+                     const char** phase_name) const;
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -77,9 +96,14 @@ class CompilationStatistics final : public Malloced {
   typedef std::map<std::string, PhaseKindStats> PhaseKindMap;
   typedef std::map<std::string, PhaseStats> PhaseMap;
 
+  void ClearLocked();
+
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  int active_jobs_;
+  bool reset_pending_;
+  mutable base::Mutex record_mutex_;
 
   DISALLOW_COPY_AND_ASSIGN(CompilationStatistics);
 };
@@ -72,6 +72,7 @@ void CompilerDispatcherJob::PrepareToParseOnMainThread() {
   parse_info_->set_start_position(shared_->start_position());
   parse_info_->set_end_position(shared_->end_position());
   parse_info_->set_unicode_cache(unicode_cache_.get());
+  parse_info_->set_ast_string_constants(isolate_->ast_string_constants());
   parse_info_->set_language_mode(shared_->language_mode());
 
   parser_.reset(new Parser(parse_info_.get()));
@@ -43,6 +43,7 @@ class CompilerDispatcherJob {
   ~CompilerDispatcherJob();
 
   CompileJobStatus status() const { return status_; }
+  Handle<SharedFunctionInfo> shared() const { return shared_; }
   bool can_parse_on_background_thread() const {
     return can_parse_on_background_thread_;
   }
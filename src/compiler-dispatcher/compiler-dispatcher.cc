@@ -0,0 +1,414 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
+
+#include <algorithm>
+
+#include "include/v8-platform.h"
+#include "include/v8.h"
+#include "src/cancelable-task.h"
+#include "src/compiler-dispatcher/compiler-dispatcher-job.h"
+#include "src/debug/debug.h"
+#include "src/flags.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+std::pair<int, int> JobKeyFor(Handle<SharedFunctionInfo> shared) {
+  return std::make_pair(Script::cast(shared->script())->id(),
+                        shared->start_position());
+}
+
+}  // namespace
+
+class CompilerDispatcher::BackgroundTask : public CancelableTask {
+ public:
+  BackgroundTask(Isolate* isolate, CompilerDispatcher* dispatcher)
+      : CancelableTask(isolate), dispatcher_(dispatcher) {}
+  ~BackgroundTask() override {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override { dispatcher_->DoBackgroundWork(id()); }
+
+  CompilerDispatcher* dispatcher_;
+  DISALLOW_COPY_AND_ASSIGN(BackgroundTask);
+};
+
+class CompilerDispatcher::IdleTask : public CancelableIdleTask {
+ public:
+  IdleTask(Isolate* isolate, CompilerDispatcher* dispatcher)
+      : CancelableIdleTask(isolate), dispatcher_(dispatcher) {}
+  ~IdleTask() override {}
+
+ private:
+  // v8::internal::CancelableIdleTask overrides.
+  void RunInternal(double deadline_in_seconds) override {
+    dispatcher_->DoIdleWork(deadline_in_seconds);
+  }
+
+  CompilerDispatcher* dispatcher_;
+  DISALLOW_COPY_AND_ASSIGN(IdleTask);
+};
+
+// Idle tasks can only be posted from the main thread. Background threads post
+// this task instead, which then posts the idle task.
+class CompilerDispatcher::IdleTaskScheduler : public CancelableTask {
+ public:
+  IdleTaskScheduler(Isolate* isolate, CompilerDispatcher* dispatcher)
+      : CancelableTask(isolate), dispatcher_(dispatcher) {}
+  ~IdleTaskScheduler() override {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    {
+      base::LockGuard<base::Mutex> lock(&dispatcher_->mutex_);
+      dispatcher_->idle_task_scheduled_ = false;
+    }
+    dispatcher_->ScheduleIdleTaskIfNeeded();
+  }
+
+  CompilerDispatcher* dispatcher_;
+  DISALLOW_COPY_AND_ASSIGN(IdleTaskScheduler);
+};
+
+CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
+                                       size_t max_stack_size)
+    : isolate_(isolate),
+      platform_(platform),
+      max_stack_size_(max_stack_size),
+      idle_task_scheduled_(false),
+      idle_task_id_(0) {}
+
+CompilerDispatcher::~CompilerDispatcher() {
+  // Jobs may still be pending, e.g. when the isolate is torn down in tests.
+  AbortAll();
+}
+
+bool CompilerDispatcher::Enqueue(Handle<SharedFunctionInfo> function) {
+  if (!IsEnabled()) return false;
+  if (function->is_compiled()) return false;
+  if (!function->script()->IsScript()) return false;
+  Script* script = Script::cast(function->script());
+  if (script->type() == Script::TYPE_NATIVE) return false;
+  // Jobs rely on the scope chain of the function being known.
+  if (function->outer_scope_info()->IsTheHole(isolate_)) return false;
+  // The debugger needs debug code, which is not what jobs produce.
+  if (isolate_->debug()->is_active()) return false;
+  if (IsEnqueued(function)) return true;
+
+  if (FLAG_trace_compiler_dispatcher) {
+    PrintF("CompilerDispatcher: enqueuing ");
+    function->ShortPrint();
+    PrintF("\n");
+  }
+  std::unique_ptr<CompilerDispatcherJob> job(
+      new CompilerDispatcherJob(isolate_, function, max_stack_size_));
+  jobs_.insert(std::make_pair(JobKeyFor(function), std::move(job)));
+  ScheduleIdleTaskIfNeeded();
+  return true;
+}
+
+bool CompilerDispatcher::EnqueueAndStep(Handle<SharedFunctionInfo> function) {
+  if (!Enqueue(function)) return false;
+  JobMap::const_iterator it = GetJobFor(function);
+  DCHECK(it != jobs_.end());
+  CompilerDispatcherJob* job = it->second.get();
+  if (job->status() != CompileJobStatus::kInitial) return true;
+
+  if (FLAG_trace_compiler_dispatcher) {
+    PrintF("CompilerDispatcher: stepping ");
+    function->ShortPrint();
+    PrintF("\n");
+  }
+  HandleScope scope(isolate_);
+  if (!DoNextStepOnMainThread(job)) {
+    isolate_->clear_pending_exception();
+    RemoveJob(it);
+    return false;
+  }
+  ConsiderJobForBackgroundProcessing(job);
+  return true;
+}
+
+bool CompilerDispatcher::IsEnqueued(Handle<SharedFunctionInfo> function) const {
+  return GetJobFor(function) != jobs_.end();
+}
+
+bool CompilerDispatcher::FinishNow(Handle<SharedFunctionInfo> function) {
+  JobMap::const_iterator it = GetJobFor(function);
+  CHECK(it != jobs_.end());
+  CompilerDispatcherJob* job = it->second.get();
+  WaitForJobIfRunningOnBackground(job);
+
+  if (FLAG_trace_compiler_dispatcher) {
+    PrintF("CompilerDispatcher: finishing ");
+    function->ShortPrint();
+    PrintF(" now\n");
+  }
+  bool result = true;
+  while (job->status() != CompileJobStatus::kDone) {
+    if (!DoNextStepOnMainThread(job)) {
+      result = false;
+      break;
+    }
+  }
+  RemoveJob(it);
+  return result;
+}
+
+void CompilerDispatcher::AbortAll() {
+  DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
+  CancelableTaskManager* task_manager = isolate_->cancelable_task_manager();
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    pending_background_jobs_.clear();
+    // Background tasks that did not start yet are aborted. The others are
+    // waited for, since they access their job.
+    for (auto it = background_task_ids_.begin();
+         it != background_task_ids_.end();) {
+      if (task_manager->TryAbort(*it)) {
+        it = background_task_ids_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    while (!background_task_ids_.empty()) {
+      background_task_finished_.Wait(&mutex_);
+    }
+    if (idle_task_scheduled_) {
+      task_manager->TryAbort(idle_task_id_);
+      idle_task_scheduled_ = false;
+    }
+  }
+  for (auto it = jobs_.begin(); it != jobs_.end();) {
+    it = RemoveJob(it);
+  }
+}
+
+bool CompilerDispatcher::IsEnabled() const {
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  return FLAG_compiler_dispatcher && platform_->IdleTasksEnabled(v8_isolate);
+}
+
+CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::GetJobFor(
+    Handle<SharedFunctionInfo> shared) const {
+  if (!shared->script()->IsScript()) return jobs_.end();
+  auto range = jobs_.equal_range(JobKeyFor(shared));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (*it->second->shared() == *shared) return it;
+  }
+  return jobs_.end();
+}
+
+CompilerDispatcher::JobMap::iterator CompilerDispatcher::RemoveJob(
+    JobMap::const_iterator it) {
+  CompilerDispatcherJob* job = it->second.get();
+  WaitForJobIfRunningOnBackground(job);
+  job->ResetOnMainThread();
+  return jobs_.erase(it);
+}
+
+void CompilerDispatcher::WaitForJobIfRunningOnBackground(
+    CompilerDispatcherJob* job) {
+  base::LockGuard<base::Mutex> lock(&mutex_);
+  pending_background_jobs_.erase(job);
+  while (running_background_jobs_.find(job) !=
+         running_background_jobs_.end()) {
+    background_task_finished_.Wait(&mutex_);
+  }
+}
+
+bool CompilerDispatcher::CanRunOnAnyThread(CompilerDispatcherJob* job) const {
+  return (job->status() == CompileJobStatus::kReadyToParse &&
+          job->can_parse_on_background_thread()) ||
+         (job->status() == CompileJobStatus::kReadyToCompile &&
+          job->can_compile_on_background_thread());
+}
+
+void CompilerDispatcher::ScheduleIdleTaskIfNeeded() {
+  DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
+  if (jobs_.empty()) return;
+  IdleTask* task = nullptr;
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    if (idle_task_scheduled_) return;
+    idle_task_scheduled_ = true;
+    task = new IdleTask(isolate_, this);
+    idle_task_id_ = task->id();
+  }
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  platform_->CallIdleOnForegroundThread(v8_isolate, task);
+}
+
+void CompilerDispatcher::ScheduleIdleTaskFromAnyThread() {
+  IdleTaskScheduler* task = nullptr;
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    if (idle_task_scheduled_) return;
+    idle_task_scheduled_ = true;
+    task = new IdleTaskScheduler(isolate_, this);
+    idle_task_id_ = task->id();
+  }
+  v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+  platform_->CallOnForegroundThread(v8_isolate, task);
+}
+
+void CompilerDispatcher::ScheduleMoreBackgroundTasksIfNeeded() {
+  BackgroundTask* task = nullptr;
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    if (pending_background_jobs_.size() <= background_task_ids_.size()) {
+      return;
+    }
+    if (background_task_ids_.size() >=
+        platform_->NumberOfAvailableBackgroundThreads()) {
+      return;
+    }
+    task = new BackgroundTask(isolate_, this);
+    background_task_ids_.push_back(task->id());
+  }
+  platform_->CallOnBackgroundThread(task, v8::Platform::kShortRunningTask);
+}
+
+void CompilerDispatcher::ConsiderJobForBackgroundProcessing(
+    CompilerDispatcherJob* job) {
+  if (!CanRunOnAnyThread(job)) return;
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    pending_background_jobs_.insert(job);
+  }
+  ScheduleMoreBackgroundTasksIfNeeded();
+}
+
+bool CompilerDispatcher::DoNextStepOnMainThread(CompilerDispatcherJob* job) {
+  DCHECK(ThreadId::Current().Equals(isolate_->thread_id()));
+  switch (job->status()) {
+    case CompileJobStatus::kInitial:
+      job->PrepareToParseOnMainThread();
+      break;
+    case CompileJobStatus::kReadyToParse:
+      job->Parse();
+      break;
+    case CompileJobStatus::kParsed:
+      job->FinalizeParsingOnMainThread();
+      break;
+    case CompileJobStatus::kReadyToAnalyse:
+      job->PrepareToCompileOnMainThread();
+      break;
+    case CompileJobStatus::kReadyToCompile:
+      job->Compile();
+      break;
+    case CompileJobStatus::kCompiled:
+      job->FinalizeCompilingOnMainThread();
+      break;
+    case CompileJobStatus::kFailed:
+    case CompileJobStatus::kDone:
+      break;
+  }
+  DCHECK_EQ(job->status() == CompileJobStatus::kFailed,
+            isolate_->has_pending_exception());
+  return job->status() != CompileJobStatus::kFailed;
+}
+
+void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
+  {
+    base::LockGuard<base::Mutex> lock(&mutex_);
+    idle_task_scheduled_ = false;
+  }
+  HandleScope scope(isolate_);
+  bool needs_more_idle_time = false;
+  for (auto it = jobs_.begin(); it != jobs_.end();) {
+    if (platform_->MonotonicallyIncreasingTime() >= deadline_in_seconds) {
+      needs_more_idle_time = true;
+      break;
+    }
+    CompilerDispatcherJob* job = it->second.get();
+    {
+      base::LockGuard<base::Mutex> lock(&mutex_);
+      if (pending_background_jobs_.find(job) !=
+              pending_background_jobs_.end() ||
+          running_background_jobs_.find(job) !=
+              running_background_jobs_.end()) {
+        ++it;
+        continue;
+      }
+    }
+    // The function may have been compiled through another path meanwhile.
+    if (job->shared()->is_compiled()) {
+      it = RemoveJob(it);
+      continue;
+    }
+    if (!DoNextStepOnMainThread(job)) {
+      // The error is reported once the function is compiled on first call.
+      isolate_->clear_pending_exception();
+      it = RemoveJob(it);
+      continue;
+    }
+    if (job->status() == CompileJobStatus::kDone) {
+      if (FLAG_trace_compiler_dispatcher) {
+        PrintF("CompilerDispatcher: finished ");
+        job->shared()->ShortPrint();
+        PrintF(" in idle time\n");
+      }
+      it = RemoveJob(it);
+      continue;
+    }
+    // Advance the same job again, unless its next step was handed to a
+    // background thread.
+    ConsiderJobForBackgroundProcessing(job);
+  }
+  if (needs_more_idle_time) ScheduleIdleTaskIfNeeded();
+}
+
+void CompilerDispatcher::DoBackgroundWork(uint32_t task_id) {
+  // Keep taking jobs until none are left, since the number of background
+  // tasks is capped and jobs beyond that cap are only picked up here.
+  for (;;) {
+    CompilerDispatcherJob* job = nullptr;
+    {
+      base::LockGuard<base::Mutex> lock(&mutex_);
+      if (pending_background_jobs_.empty()) {
+        // Unregister while still holding the lock, so that a job queued
+        // from now on makes ScheduleMoreBackgroundTasksIfNeeded() post a new
+        // task. Unregistering has to happen last, as the dispatcher may be
+        // gone afterwards.
+        background_task_ids_.erase(std::find(background_task_ids_.begin(),
+                                             background_task_ids_.end(),
+                                             task_id));
+        background_task_finished_.NotifyAll();
+        return;
+      }
+      auto it = pending_background_jobs_.begin();
+      job = *it;
+      pending_background_jobs_.erase(it);
+      running_background_jobs_.insert(job);
+    }
+
+    DCHECK(CanRunOnAnyThread(job));
+    if (job->status() == CompileJobStatus::kReadyToParse) {
+      job->Parse();
+    } else {
+      DCHECK(job->status() == CompileJobStatus::kReadyToCompile);
+      job->Compile();
+    }
+    // The next step of the job has to be done on the main thread.
+    ScheduleIdleTaskFromAnyThread();
+
+    {
+      base::LockGuard<base::Mutex> lock(&mutex_);
+      running_background_jobs_.erase(job);
+      background_task_finished_.NotifyAll();
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,141 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
+#define V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
+
+#include <map>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/globals.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"
+
+namespace v8 {
+
+class Platform;
+
+namespace internal {
+
+class CompilerDispatcherJob;
+class Isolate;
+class SharedFunctionInfo;
+
+template <typename T>
+class Handle;
+
+// The CompilerDispatcher uses a combination of idle tasks and background tasks
+// to parse and compile lazily parsed functions ahead of their first call.
+//
+// Parsing and compiling both require a preparation and a finalization step on
+// the main thread. These steps are done in idle time. Depending on the
+// properties of a job, the parse and compile steps in between run on
+// background threads, or in idle time as well.
+//
+// jobs_ holds all jobs the dispatcher knows about. pending_background_jobs_
+// holds the jobs whose next step can run on a background thread, and
+// running_background_jobs_ the jobs that are currently advanced by a
+// background task. The main thread never touches a job while it is running on
+// a background thread. At most one background task per available background
+// thread is posted, and each task keeps taking pending jobs until there are
+// none left, so independent functions are parsed in parallel.
+//
+// When an enqueued function is called before its job is done, FinishNow()
+// advances the job on the main thread, so that CompileLazy picks up the
+// result instead of compiling the function from scratch.
+class V8_EXPORT_PRIVATE CompilerDispatcher {
+ public:
+  CompilerDispatcher(Isolate* isolate, Platform* platform,
+                     size_t max_stack_size);
+  ~CompilerDispatcher();
+
+  // Returns true if a job was enqueued.
+  bool Enqueue(Handle<SharedFunctionInfo> function);
+
+  // Like Enqueue, but also prepares the job on the main thread right away, so
+  // that it can be parsed on a background thread without waiting for idle
+  // time. Returns true if a job was enqueued.
+  bool EnqueueAndStep(Handle<SharedFunctionInfo> function);
+
+  // Returns true if there is a pending job for the given function.
+  bool IsEnqueued(Handle<SharedFunctionInfo> function) const;
+
+  // Blocks until the given function is compiled. Returns false if the job
+  // failed, in which case an exception is pending. The job is removed in
+  // either case.
+  bool FinishNow(Handle<SharedFunctionInfo> function);
+
+  // Aborts all jobs, waiting for jobs running on background threads.
+  void AbortAll();
+
+ private:
+  FRIEND_TEST(CompilerDispatcherTest, IdleTask);
+  FRIEND_TEST(CompilerDispatcherTest, ParseOnBackgroundThread);
+  FRIEND_TEST(CompilerDispatcherTest, EnqueueAndStep);
+  FRIEND_TEST(CompilerDispatcherTest, ParseManyOnBackgroundThreads);
+
+  class BackgroundTask;
+  class IdleTask;
+  class IdleTaskScheduler;
+
+  typedef std::multimap<std::pair<int, int>,
+                        std::unique_ptr<CompilerDispatcherJob>>
+      JobMap;
+
+  bool IsEnabled() const;
+  JobMap::const_iterator GetJobFor(Handle<SharedFunctionInfo> shared) const;
+  JobMap::iterator RemoveJob(JobMap::const_iterator it);
+  void WaitForJobIfRunningOnBackground(CompilerDispatcherJob* job);
+  bool CanRunOnAnyThread(CompilerDispatcherJob* job) const;
+  void ScheduleIdleTaskIfNeeded();
+  void ScheduleIdleTaskFromAnyThread();
+  void ScheduleMoreBackgroundTasksIfNeeded();
+  void ConsiderJobForBackgroundProcessing(CompilerDispatcherJob* job);
+
+  // Advances {job} by one step on the main thread. Returns false if the job
+  // failed, in which case an exception is pending.
+  bool DoNextStepOnMainThread(CompilerDispatcherJob* job);
+
+  // Task entry points.
+  void DoIdleWork(double deadline_in_seconds);
+  void DoBackgroundWork(uint32_t task_id);
+
+  Isolate* isolate_;
+  Platform* platform_;
+  size_t max_stack_size_;
+
+  // Only accessed on the main thread.
+  JobMap jobs_;
+
+  // Guards all of the members below.
+  mutable base::Mutex mutex_;
+
+  // Whether an idle task, or a task that schedules one, has been posted.
+  bool idle_task_scheduled_;
+  uint32_t idle_task_id_;
+
+  // Jobs whose next step can run on a background thread.
+  std::unordered_set<CompilerDispatcherJob*> pending_background_jobs_;
+
+  // Jobs that are currently advanced by a background task.
+  std::unordered_set<CompilerDispatcherJob*> running_background_jobs_;
+
+  // Ids of background tasks that have been posted but have not finished.
+  std::vector<uint32_t> background_task_ids_;
+
+  // Signaled whenever a background task finishes.
+  base::ConditionVariable background_task_finished_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompilerDispatcher);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_DISPATCHER_COMPILER_DISPATCHER_H_
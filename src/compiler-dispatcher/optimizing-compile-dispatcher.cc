@@ -4,9 +4,12 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/compilation-info.h"
 #include "src/compiler.h"
+#include "src/counters.h"
 #include "src/full-codegen/full-codegen.h"
 #include "src/isolate.h"
 #include "src/tracing/trace-event.h"
@@ -18,7 +21,8 @@ namespace internal {
 namespace {
 
 void DisposeCompilationJob(CompilationJob* job, bool restore_function_code) {
-  if (restore_function_code) {
+  // OSR jobs never replaced the code of their function.
+  if (restore_function_code && !job->info()->is_osr()) {
     Handle<JSFunction> function = job->info()->closure();
     function->ReplaceCode(function->shared()->code());
     // TODO(mvstanton): We can't call ensureliterals here due to allocation,
@@ -29,6 +33,22 @@ void DisposeCompilationJob(CompilationJob* job, bool restore_function_code) {
   delete job;
 }
 
+// Arms all back edges of the unoptimized code of {function}, so that the
+// next back edge check of a running activation asks for OSR again.
+void ArmBackEdgesForOSR(Isolate* isolate, JSFunction* function) {
+  SharedFunctionInfo* shared = function->shared();
+  if (shared->HasBaselineCode()) {
+    Code* code = shared->code();
+    for (int i = code->allow_osr_at_loop_nesting_level();
+         i < AbstractCode::kMaxLoopNestingMarker; i++) {
+      BackEdgeTable::Patch(isolate, code);
+    }
+  } else if (shared->HasBytecodeArray() && FLAG_ignition_osr) {
+    shared->bytecode_array()->set_osr_loop_nesting_level(
+        AbstractCode::kMaxLoopNestingMarker);
+  }
+}
+
 }  // namespace
 
 class OptimizingCompileDispatcher::CompileTask : public v8::Task {
@@ -85,16 +105,61 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
   }
 #endif
   DCHECK_EQ(0, input_queue_length_);
+  DCHECK(pending_osr_jobs_.empty());
+  DCHECK(ready_osr_jobs_.empty());
   DeleteArray(input_queue_);
 }
 
+int OptimizingCompileDispatcher::HighestPriorityInput() {
+  DCHECK_LT(0, input_queue_length_);
+  // Ties are broken in favor of the job that was queued first.
+  int result = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_[InputQueueIndex(i)].priority >
+        input_queue_[InputQueueIndex(result)].priority) {
+      result = i;
+    }
+  }
+  return result;
+}
+
+int OptimizingCompileDispatcher::LowestPriorityInput() {
+  DCHECK_LT(0, input_queue_length_);
+  // Ties are broken in favor of the job that was queued last.
+  int result = 0;
+  for (int i = 1; i < input_queue_length_; i++) {
+    if (input_queue_[InputQueueIndex(i)].priority <=
+        input_queue_[InputQueueIndex(result)].priority) {
+      result = i;
+    }
+  }
+  return result;
+}
+
+OptimizingCompileDispatcher::QueuedJob OptimizingCompileDispatcher::RemoveInput(
+    int i) {
+  DCHECK_LE(0, i);
+  DCHECK_LT(i, input_queue_length_);
+  QueuedJob result = input_queue_[InputQueueIndex(i)];
+  // Close the gap by moving the jobs in front of it back by one.
+  for (int j = i; j > 0; j--) {
+    input_queue_[InputQueueIndex(j)] = input_queue_[InputQueueIndex(j - 1)];
+  }
+  input_queue_shift_ = InputQueueIndex(1);
+  input_queue_length_--;
+  return result;
+}
+
 CompilationJob* OptimizingCompileDispatcher::NextInput(bool check_if_flushing) {
   base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
   if (input_queue_length_ == 0) return NULL;
-  CompilationJob* job = input_queue_[InputQueueIndex(0)];
+  QueuedJob input = RemoveInput(HighestPriorityInput());
+  CompilationJob* job = input.job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  // Counters may only be updated on the main thread, see
+  // UpdateQueueCounters().
+  input_queue_wait_times_.push_back(static_cast<int>(
+      (base::TimeTicks::Now() - input.queued_at).InMilliseconds()));
   if (check_if_flushing) {
     if (static_cast<ModeFlag>(base::Acquire_Load(&mode_)) == FLUSH) {
       AllowHandleDereference allow_handle_dereference;
@@ -134,6 +199,59 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
   }
 }
 
+void OptimizingCompileDispatcher::FlushOSRJobs() {
+  // All pending OSR jobs have been disposed of together with the queues.
+  pending_osr_jobs_.clear();
+  for (CompilationJob* job : ready_osr_jobs_) {
+    DisposeCompilationJob(job, false);
+  }
+  ready_osr_jobs_.clear();
+}
+
+void OptimizingCompileDispatcher::AddToReadyOSRJobs(CompilationJob* job) {
+  if (ready_osr_jobs_.size() >= kMaxReadyOSRJobs) {
+    CompilationJob* stale = ready_osr_jobs_.front();
+    if (FLAG_trace_osr) {
+      PrintF("[COSR - Discarding compilation of ");
+      stale->info()->closure()->PrintName();
+      PrintF(" at AST id %d]\n", stale->info()->osr_ast_id().ToInt());
+    }
+    DisposeCompilationJob(stale, false);
+    ready_osr_jobs_.erase(ready_osr_jobs_.begin());
+  }
+  ready_osr_jobs_.push_back(job);
+}
+
+CompilationJob* OptimizingCompileDispatcher::FindReadyOSRCandidate(
+    Handle<JSFunction> function, BailoutId osr_ast_id) {
+  for (auto it = ready_osr_jobs_.begin(); it != ready_osr_jobs_.end(); ++it) {
+    CompilationInfo* info = (*it)->info();
+    if (*info->closure() == *function && info->osr_ast_id() == osr_ast_id) {
+      CompilationJob* job = *it;
+      ready_osr_jobs_.erase(it);
+      return job;
+    }
+  }
+  return NULL;
+}
+
+bool OptimizingCompileDispatcher::IsQueuedForOSR(Handle<JSFunction> function,
+                                                 BailoutId osr_ast_id) {
+  for (CompilationJob* job : pending_osr_jobs_) {
+    CompilationInfo* info = job->info();
+    if (*info->closure() == *function && info->osr_ast_id() == osr_ast_id) {
+      return true;
+    }
+  }
+  for (CompilationJob* job : ready_osr_jobs_) {
+    CompilationInfo* info = job->info();
+    if (*info->closure() == *function && info->osr_ast_id() == osr_ast_id) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void OptimizingCompileDispatcher::Flush() {
   base::Release_Store(&mode_, static_cast<base::AtomicWord>(FLUSH));
   if (FLAG_block_concurrent_recompilation) Unblock();
@@ -143,6 +261,7 @@ void OptimizingCompileDispatcher::Flush() {
     base::Release_Store(&mode_, static_cast<base::AtomicWord>(COMPILE));
   }
   FlushOutputQueue(true);
+  FlushOSRJobs();
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Flushed concurrent recompilation queues.\n");
   }
@@ -165,10 +284,27 @@ void OptimizingCompileDispatcher::Stop() {
   } else {
     FlushOutputQueue(false);
   }
+  FlushOSRJobs();
+}
+
+void OptimizingCompileDispatcher::UpdateQueueCounters() {
+  std::vector<int> wait_times;
+  int queue_depth;
+  {
+    base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+    wait_times.swap(input_queue_wait_times_);
+    queue_depth = input_queue_length_;
+  }
+  Counters* counters = isolate_->counters();
+  counters->concurrent_recompilation_queue_depth()->Set(queue_depth);
+  for (int wait_time : wait_times) {
+    counters->concurrent_recompilation_wait_time_in_ms()->AddSample(wait_time);
+  }
 }
 
 void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   HandleScope handle_scope(isolate_);
+  UpdateQueueCounters();
 
   for (;;) {
     CompilationJob* job = NULL;
@@ -180,6 +316,25 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
     }
     CompilationInfo* info = job->info();
     Handle<JSFunction> function(*info->closure());
+    if (info->is_osr()) {
+      pending_osr_jobs_.erase(std::find(pending_osr_jobs_.begin(),
+                                        pending_osr_jobs_.end(), job));
+      if (job->state() != CompilationJob::State::kReadyToFinalize) {
+        // Report the failure and dispose of the job.
+        Compiler::FinalizeCompilationJob(job);
+        continue;
+      }
+      if (FLAG_trace_osr) {
+        PrintF("[COSR - Ready for ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", info->osr_ast_id().ToInt());
+      }
+      // The job is finalized once a running activation of the function
+      // reaches the next back edge check.
+      AddToReadyOSRJobs(job);
+      ArmBackEdgesForOSR(isolate_, *function);
+      continue;
+    }
     if (function->IsOptimized()) {
       if (FLAG_trace_concurrent_recompilation) {
         PrintF("  ** Aborting compilation for ");
@@ -193,14 +348,40 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
-void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job) {
-  DCHECK(IsQueueAvailable());
+void OptimizingCompileDispatcher::QueueForOptimization(CompilationJob* job,
+                                                       int priority) {
+  DCHECK(IsQueueAvailable(priority));
+  if (job->info()->is_osr()) pending_osr_jobs_.push_back(job);
+  CompilationJob* dropped = NULL;
   {
     // Add job to the back of the input queue.
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+    if (input_queue_length_ == input_queue_capacity_) {
+      dropped = RemoveInput(LowestPriorityInput()).job;
+    }
     DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
+    QueuedJob& input = input_queue_[InputQueueIndex(input_queue_length_)];
+    input.job = job;
+    input.priority = priority;
+    input.queued_at = base::TimeTicks::Now();
     input_queue_length_++;
+    isolate_->counters()->concurrent_recompilation_queue_depth()->Set(
+        input_queue_length_);
+  }
+  if (dropped != NULL) {
+    if (FLAG_trace_concurrent_recompilation) {
+      PrintF("  ** Dropped ");
+      dropped->info()->closure()->ShortPrint();
+      PrintF(" from the full compilation queue.\n");
+    }
+    isolate_->counters()->concurrent_recompilation_drops()->Increment();
+    if (dropped->info()->is_osr()) {
+      pending_osr_jobs_.erase(std::find(pending_osr_jobs_.begin(),
+                                        pending_osr_jobs_.end(), dropped));
+    }
+    DisposeCompilationJob(dropped, true);
+    // The task posted for the dropped job compiles the new one.
+    return;
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
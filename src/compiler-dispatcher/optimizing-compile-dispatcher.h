@@ -6,18 +6,23 @@
 #define V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 
 #include <queue>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/flags.h"
+#include "src/handles.h"
 #include "src/list.h"
+#include "src/utils.h"
 
 namespace v8 {
 namespace internal {
 
 class CompilationJob;
+class JSFunction;
 class SharedFunctionInfo;
 
 class OptimizingCompileDispatcher {
@@ -31,7 +36,7 @@ class OptimizingCompileDispatcher {
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
     base::NoBarrier_Store(&mode_, static_cast<base::AtomicWord>(COMPILE));
-    input_queue_ = NewArray<CompilationJob*>(input_queue_capacity_);
+    input_queue_ = NewArray<QueuedJob>(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -39,15 +44,30 @@ class OptimizingCompileDispatcher {
   void Run();
   void Stop();
   void Flush();
-  void QueueForOptimization(CompilationJob* job);
+  // Jobs with higher {priority} are compiled first. If the queue is full, the
+  // queued job with the lowest priority is dropped to make room.
+  void QueueForOptimization(CompilationJob* job, int priority);
   void Unblock();
   void InstallOptimizedFunctions();
 
-  inline bool IsQueueAvailable() {
+  // Returns true if a job with the given {priority} would be queued, i.e. the
+  // queue is not full or holds a job with a lower priority.
+  inline bool IsQueueAvailable(int priority) {
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    if (input_queue_length_ < input_queue_capacity_) return true;
+    return input_queue_[InputQueueIndex(LowestPriorityInput())].priority <
+           priority;
   }
 
+  // Returns the finished OSR job for {function} at {osr_ast_id}, or NULL. The
+  // caller takes ownership of the job.
+  CompilationJob* FindReadyOSRCandidate(Handle<JSFunction> function,
+                                        BailoutId osr_ast_id);
+
+  // Returns true if an OSR job for {function} at {osr_ast_id} is queued,
+  // running, or finished but not yet picked up.
+  bool IsQueuedForOSR(Handle<JSFunction> function, BailoutId osr_ast_id);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
@@ -55,10 +75,32 @@ class OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct QueuedJob {
+    CompilationJob* job;
+    int priority;
+    base::TimeTicks queued_at;
+  };
+
+  // Maximum number of finished OSR jobs kept around until the function
+  // reaches a back edge check. The oldest job is dropped when exceeded.
+  static const size_t kMaxReadyOSRJobs = 4;
+
   void FlushOutputQueue(bool restore_function_code);
+  void FlushOSRJobs();
+  void AddToReadyOSRJobs(CompilationJob* job);
   void CompileNext(CompilationJob* job);
   CompilationJob* NextInput(bool check_if_flushing = false);
 
+  // The following require the input queue mutex to be held. Indices are
+  // relative to the front of the queue.
+  int HighestPriorityInput();
+  int LowestPriorityInput();
+  QueuedJob RemoveInput(int i);
+
+  // Reports the queue depth and the wait times of the jobs taken out of the
+  // queue since the last call. Must be called on the main thread.
+  void UpdateQueueCounters();
+
   inline int InputQueueIndex(int i) {
     int result = (i + input_queue_shift_) % input_queue_capacity_;
     DCHECK_LE(0, result);
@@ -68,12 +110,16 @@ class OptimizingCompileDispatcher {
 
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  CompilationJob** input_queue_;
+  // Circular queue of incoming recompilation tasks (including OSR). Jobs are
+  // appended at the back and taken out by priority.
+  QueuedJob* input_queue_;
   int input_queue_capacity_;
   int input_queue_length_;
   int input_queue_shift_;
   base::Mutex input_queue_mutex_;
+  // Time in milliseconds that the jobs taken out of the input queue by
+  // background tasks had been waiting. Guarded by the input queue mutex.
+  std::vector<int> input_queue_wait_times_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
   std::queue<CompilationJob*> output_queue_;
@@ -89,6 +135,12 @@ class OptimizingCompileDispatcher {
   base::Mutex ref_count_mutex_;
   base::ConditionVariable ref_count_zero_;
 
+  // OSR jobs that were queued but have not been installed yet, and OSR jobs
+  // that finished compiling and wait for their function to re-enter the
+  // runtime at a back edge. Only accessed on the main thread.
+  std::vector<CompilationJob*> pending_osr_jobs_;
+  std::vector<CompilationJob*> ready_osr_jobs_;
+
   // Copy of FLAG_concurrent_recompilation_delay that will be used from the
   // background thread.
   //
@@ -15,6 +15,7 @@
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/compiler/pipeline.h"
 #include "src/crankshaft/hydrogen.h"
@@ -30,10 +31,12 @@
 #include "src/log-inl.h"
 #include "src/messages.h"
 #include "src/parsing/parser.h"
+#include "src/parsing/preparsed-scope-data.h"
 #include "src/parsing/rewriter.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/snapshot/shared-code-cache.h"
 #include "src/vm-state-inl.h"
 
 namespace v8 {
@@ -372,6 +375,10 @@ void InstallSharedCompilationResult(CompilationInfo* info,
   if (info->is_debug() && info->has_bytecode_array()) {
     shared->ClearBytecodeArray();
   }
+  // Compiled code supersedes code left in the code cache.
+  if (shared->HasLazyDeserializationData()) {
+    shared->ClearLazyDeserializationData();
+  }
   DCHECK(!info->code().is_null());
   shared->ReplaceCode(*info->code());
   if (info->has_bytecode_array()) {
@@ -576,16 +583,17 @@ bool GetOptimizedCodeNow(CompilationJob* job) {
   return true;
 }
 
-bool GetOptimizedCodeLater(CompilationJob* job) {
+bool GetOptimizedCodeLater(CompilationJob* job, int priority) {
   CompilationInfo* info = job->info();
   Isolate* isolate = info->isolate();
 
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable(priority)) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       info->closure()->ShortPrint();
       PrintF(" later.\n");
     }
+    isolate->counters()->concurrent_recompilation_drops()->Increment();
     return false;
   }
 
@@ -613,7 +621,7 @@ bool GetOptimizedCodeLater(CompilationJob* job) {
                "V8.RecompileSynchronous");
 
   if (job->PrepareJob() != CompilationJob::SUCCEEDED) return false;
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job);
+  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job, priority);
 
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
@@ -654,6 +662,20 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
     return cached_code;
   }
 
+  // Hotter functions are compiled first. OSR requests come from a loop that
+  // is running right now, hence they go before everything else.
+  int priority = kMaxInt;
+  if (osr_ast_id.IsNone()) {
+    if (shared->is_compiled() && shared->code()->kind() == Code::FUNCTION) {
+      priority = shared->code()->profiler_ticks();
+    } else if (shared->HasBytecodeArray()) {
+      // Ignition counts ticks on the shared function info.
+      priority = shared->profiler_ticks();
+    } else {
+      priority = 0;
+    }
+  }
+
   // Reset profiler ticks, function is no longer considered hot.
   if (shared->is_compiled()) {
     shared->code()->set_profiler_ticks(0);
@@ -669,7 +691,10 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   CompilationInfo* info = job->info();
   ParseInfo* parse_info = info->parse_info();
 
-  info->SetOptimizingForOsr(osr_ast_id, osr_frame);
+  // The frame can only be inspected on the main thread, concurrent OSR jobs
+  // do not specialize to it.
+  info->SetOptimizingForOsr(osr_ast_id,
+                            mode == Compiler::CONCURRENT ? nullptr : osr_frame);
 
   // Do not use Crankshaft/TurboFan if we need to be able to set break points.
   if (info->shared_info()->HasDebugInfo()) {
@@ -726,7 +751,7 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   parse_info->ReopenHandlesInNewHandleScope();
 
   if (mode == Compiler::CONCURRENT) {
-    if (GetOptimizedCodeLater(job.get())) {
+    if (GetOptimizedCodeLater(job.get(), priority)) {
       job.release();  // The background recompile job owns this now.
       return isolate->builtins()->InOptimizationQueue();
     }
@@ -777,7 +802,8 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
         info->closure()->ShortPrint();
         PrintF("]\n");
       }
-      info->closure()->ReplaceCode(*info->code());
+      // Code generated for entry via OSR is returned to the caller instead.
+      if (!info->is_osr()) info->closure()->ReplaceCode(*info->code());
       return CompilationJob::SUCCEEDED;
     }
   }
@@ -788,7 +814,7 @@ CompilationJob::Status FinalizeOptimizedCompilationJob(CompilationJob* job) {
     info->closure()->ShortPrint();
     PrintF(" because: %s]\n", GetBailoutReason(info->bailout_reason()));
   }
-  info->closure()->ReplaceCode(shared->code());
+  if (!info->is_osr()) info->closure()->ReplaceCode(shared->code());
   return CompilationJob::FAILED;
 }
 
@@ -955,6 +981,88 @@ MaybeHandle<Code> GetBaselineCode(Handle<JSFunction> function) {
   return info.code();
 }
 
+// Returns whether any of the inner scopes of |scope| is a function scope.
+bool HasInnerFunctions(Scope* scope) {
+  for (Scope* inner = scope->inner_scope(); inner != nullptr;
+       inner = inner->sibling()) {
+    if (inner->is_function_scope() || HasInnerFunctions(inner)) return true;
+  }
+  return false;
+}
+
+// The unoptimized code of a function can be shared with an identical
+// function of another script if it depends on nothing but the source text of
+// the function: there is no outer scope with a context whose slots the code
+// could refer to, and the code does not refer to the shared function infos
+// of inner functions, which belong to the script.
+bool IsFunctionCacheable(Isolate* isolate, SharedFunctionInfo* shared) {
+  if (!FLAG_function_cache) return false;
+  if (isolate->debug()->is_active()) return false;
+  if (isolate->logger()->is_logging_code_events()) return false;
+  if (isolate->is_profiling()) return false;
+  if (!shared->outer_scope_info()->IsTheHole(isolate)) return false;
+  if (!shared->HasSourceCode() || shared->HasDebugInfo()) return false;
+  return Script::cast(shared->script())->type() == Script::TYPE_NORMAL;
+}
+
+// Functions with the same source text at the same position can still differ
+// in how they were declared, e.g. as a method or as a generator, or in
+// whether the name of a function expression is bound in its body.
+bool IsSameFunction(SharedFunctionInfo* shared, SharedFunctionInfo* cached) {
+  return shared->kind() == cached->kind() &&
+         shared->end_position() == cached->end_position() &&
+         shared->is_named_expression() == cached->is_named_expression() &&
+         String::cast(shared->name())->Equals(String::cast(cached->name()));
+}
+
+MaybeHandle<Code> GetCodeFromFunctionCache(Handle<JSFunction> function) {
+  Isolate* isolate = function->GetIsolate();
+  Handle<SharedFunctionInfo> shared(function->shared());
+  if (!IsFunctionCacheable(isolate, *shared)) return MaybeHandle<Code>();
+  Handle<String> source = Handle<String>::cast(shared->GetSourceCode());
+  Handle<Context> context(function->native_context());
+  Handle<SharedFunctionInfo> cached;
+  if (!isolate->compilation_cache()
+           ->LookupFunction(source, context, shared->language_mode(),
+                            shared->start_position())
+           .ToHandle(&cached)) {
+    return MaybeHandle<Code>();
+  }
+  if (!cached->is_compiled() || cached->HasDebugInfo() ||
+      cached->HasAsmWasmData() || !IsSameFunction(*shared, *cached)) {
+    return MaybeHandle<Code>();
+  }
+
+  // Install what the compilation of the function would have installed.
+  DCHECK(cached->outer_scope_info()->IsTheHole(isolate));
+  if (shared->HasLazyDeserializationData()) {
+    shared->ClearLazyDeserializationData();
+  }
+  shared->set_scope_info(cached->scope_info());
+  shared->set_feedback_metadata(cached->feedback_metadata());
+  shared->set_ast_node_count(cached->ast_node_count());
+  if (cached->optimization_disabled()) {
+    shared->DisableOptimization(cached->disable_optimization_reason());
+  }
+  shared->set_dont_crankshaft(cached->dont_crankshaft());
+  if (cached->HasBytecodeArray()) {
+    shared->set_bytecode_array(cached->bytecode_array());
+  }
+  shared->ReplaceCode(cached->code());
+  return handle(shared->code());
+}
+
+void PutCodeInFunctionCache(CompilationInfo* info) {
+  Isolate* isolate = info->isolate();
+  Handle<SharedFunctionInfo> shared = info->shared_info();
+  if (!IsFunctionCacheable(isolate, *shared)) return;
+  if (shared->HasAsmWasmData() || HasInnerFunctions(info->scope())) return;
+  Handle<String> source = Handle<String>::cast(shared->GetSourceCode());
+  Handle<Context> context(info->closure()->native_context());
+  isolate->compilation_cache()->PutFunction(source, context, shared,
+                                            shared->start_position());
+}
+
 MaybeHandle<Code> GetLazyCode(Handle<JSFunction> function) {
   Isolate* isolate = function->GetIsolate();
   DCHECK(!isolate->has_pending_exception());
@@ -987,11 +1095,41 @@ MaybeHandle<Code> GetLazyCode(Handle<JSFunction> function) {
     return entry;
   }
 
-  Zone zone(isolate->allocator());
-  ParseInfo parse_info(&zone, function);
-  CompilationInfo info(&parse_info, function);
+  if (function->shared()->HasLazyDeserializationData()) {
+    Handle<SharedFunctionInfo> shared(function->shared());
+    Handle<Code> code;
+    if (!isolate->debug()->is_active() &&
+        CodeSerializer::DeserializeLazyFunction(isolate, shared)
+            .ToHandle(&code)) {
+      shared->ReplaceCode(*code);
+      return code;
+    }
+    // Deserializing failed or the debugger needs debug code. Fall through
+    // to compile.
+  }
+
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (dispatcher != nullptr && !function->shared()->is_compiled()) {
+    Handle<SharedFunctionInfo> shared(function->shared());
+    if (dispatcher->IsEnqueued(shared)) {
+      if (dispatcher->FinishNow(shared)) {
+        DCHECK(shared->is_compiled());
+        return handle(shared->code());
+      }
+      // The job failed, compile the function again to report the error.
+      isolate->clear_pending_exception();
+    }
+  }
+
   Handle<Code> result;
-  ASSIGN_RETURN_ON_EXCEPTION(isolate, result, GetUnoptimizedCode(&info), Code);
+  if (!GetCodeFromFunctionCache(function).ToHandle(&result)) {
+    Zone zone(isolate->allocator());
+    ParseInfo parse_info(&zone, function);
+    CompilationInfo info(&parse_info, function);
+    ASSIGN_RETURN_ON_EXCEPTION(isolate, result, GetUnoptimizedCode(&info),
+                               Code);
+    PutCodeInFunctionCache(&info);
+  }
 
   if (FLAG_always_opt) {
     Handle<Code> opt_code;
@@ -1235,6 +1373,53 @@ bool Compiler::CompileDebugCode(Handle<SharedFunctionInfo> shared) {
   return true;
 }
 
+void Compiler::CollectSourcePositions(Handle<SharedFunctionInfo> shared) {
+  Isolate* isolate = shared->GetIsolate();
+  DCHECK(AllowCompilation::IsAllowed(isolate));
+  DCHECK(shared->HasBytecodeArray());
+  Handle<BytecodeArray> bytecode(shared->bytecode_array(), isolate);
+  DCHECK(!bytecode->HasSourcePositionTable());
+
+  // Try again later instead of failing on a stack overflow.
+  StackLimitCheck check(isolate);
+  if (check.HasOverflowed()) return;
+
+  // Bytecode generation does not depend on whether source positions are
+  // recorded, so the table recorded for the regenerated bytecode also
+  // describes the existing bytecode. The regenerated bytecode is dropped.
+  Handle<ByteArray> source_position_table =
+      isolate->factory()->empty_byte_array();
+  {
+    VMState<COMPILER> state(isolate);
+    PostponeInterruptsScope postpone(isolate);
+    Zone zone(isolate->allocator());
+    ParseInfo parse_info(&zone, shared);
+    CompilationInfo info(&parse_info, Handle<JSFunction>::null());
+    info.MarkAsSourcePositionsEnabled();
+    if (Parse(&parse_info) && Compiler::Analyze(&parse_info)) {
+      EnsureFeedbackMetadata(&info);
+      std::unique_ptr<CompilationJob> job(
+          interpreter::Interpreter::NewCompilationJob(&info));
+      if (job->PrepareJob() == CompilationJob::SUCCEEDED &&
+          job->ExecuteJob() == CompilationJob::SUCCEEDED &&
+          job->FinalizeJob() == CompilationJob::SUCCEEDED &&
+          info.bytecode_array()->length() == bytecode->length()) {
+        source_position_table =
+            handle(info.bytecode_array()->source_position_table(), isolate);
+      }
+    }
+  }
+  // The source positions are left empty if they could not be collected.
+  if (isolate->has_pending_exception()) isolate->clear_pending_exception();
+
+  bytecode->set_source_position_table(*source_position_table);
+  if (shared->HasDebugInfo() &&
+      shared->GetDebugInfo()->HasDebugBytecodeArray()) {
+    shared->GetDebugInfo()->DebugBytecodeArray()->set_source_position_table(
+        *source_position_table);
+  }
+}
+
 MaybeHandle<JSArray> Compiler::CompileForLiveEdit(Handle<Script> script) {
   Isolate* isolate = script->GetIsolate();
   DCHECK(AllowCompilation::IsAllowed(isolate));
@@ -1498,7 +1683,8 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     DCHECK(!isolate->debug()->is_loaded());
   } else {
     DCHECK(compile_options == ScriptCompiler::kConsumeParserCache ||
-           compile_options == ScriptCompiler::kConsumeCodeCache);
+           compile_options == ScriptCompiler::kConsumeCodeCache ||
+           compile_options == ScriptCompiler::kConsumeCompileHints);
     DCHECK(cached_data && *cached_data);
     DCHECK(extension == NULL);
   }
@@ -1509,6 +1695,19 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
   LanguageMode language_mode = construct_language_mode(FLAG_use_strict);
   CompilationCache* compilation_cache = isolate->compilation_cache();
 
+  // The process-wide code cache is only used where the embedder could have
+  // used a code cache itself.
+  bool use_shared_code_cache =
+      FLAG_shared_code_cache && FLAG_serialize_toplevel && extension == NULL &&
+      natives == NOT_NATIVES_CODE && !is_module &&
+      compile_options == ScriptCompiler::kNoCompileOptions &&
+      !isolate->debug()->is_loaded() && !isolate->serializer_enabled();
+  SharedCodeCache::Key shared_code_cache_key;
+  if (use_shared_code_cache) {
+    shared_code_cache_key = SharedCodeCache::KeyFor(
+        source, script_name, line_offset, column_offset, resource_options);
+  }
+
   // Do a lookup in the compilation cache but not for extensions.
   MaybeHandle<SharedFunctionInfo> maybe_result;
   Handle<SharedFunctionInfo> result;
@@ -1535,6 +1734,26 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
       }
       // Deserializer failed. Fall through to compile.
     }
+    if (maybe_result.is_null() && use_shared_code_cache) {
+      // Then check the code cache shared with other isolates.
+      std::unique_ptr<ScriptData> shared_data(
+          SharedCodeCache::Lookup(shared_code_cache_key));
+      if (shared_data) {
+        HistogramTimerScope timer(isolate->counters()->compile_deserialize());
+        RuntimeCallTimerScope runtimeTimer(
+            isolate, &RuntimeCallStats::CompileDeserialize);
+        TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                     "V8.CompileDeserialize");
+        Handle<SharedFunctionInfo> result;
+        if (CodeSerializer::Deserialize(isolate, shared_data.get(), source)
+                .ToHandle(&result)) {
+          // Promote to per-isolate compilation cache.
+          compilation_cache->PutScript(source, context, language_mode, result);
+          return result;
+        }
+        // Deserializer failed. Fall through to compile.
+      }
+    }
   }
 
   base::ElapsedTimer timer;
@@ -1580,8 +1799,12 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     if (!context->IsNativeContext()) {
       parse_info.set_outer_scope_info(handle(context->scope_info()));
     }
-    if (FLAG_serialize_toplevel &&
-        compile_options == ScriptCompiler::kProduceCodeCache) {
+    bool produce_shared_code_cache =
+        use_shared_code_cache &&
+        !SharedCodeCache::Contains(shared_code_cache_key);
+    if ((FLAG_serialize_toplevel &&
+         compile_options == ScriptCompiler::kProduceCodeCache) ||
+        produce_shared_code_cache) {
       info.PrepareForSerializing();
     }
 
@@ -1604,6 +1827,17 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
                  timer.Elapsed().InMillisecondsF());
         }
       }
+      if (produce_shared_code_cache) {
+        HistogramTimerScope histogram_timer(
+            isolate->counters()->compile_serialize());
+        RuntimeCallTimerScope runtimeTimer(isolate,
+                                           &RuntimeCallStats::CompileSerialize);
+        TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                     "V8.CompileSerialize");
+        std::unique_ptr<ScriptData> data(
+            CodeSerializer::Serialize(isolate, result, source));
+        SharedCodeCache::Insert(shared_code_cache_key, data.get());
+      }
     }
 
     if (result.is_null()) {
@@ -1704,6 +1938,16 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
     if (outer_scope) {
       result->set_outer_scope_info(*outer_scope->scope_info());
     }
+    // Only attach the data before the function is first compiled, so that all
+    // compilations of the function make the same context allocation decisions
+    // for its variables.
+    if (literal->preparsed_scope_data() != nullptr &&
+        result->never_compiled() &&
+        result->preparsed_scope_data()->IsUndefined(isolate)) {
+      Handle<FixedArray> preparsed_scope_data =
+          literal->preparsed_scope_data()->Serialize(isolate);
+      result->set_preparsed_scope_data(*preparsed_scope_data);
+    }
   } else if (Renumber(info.parse_info()) && GenerateUnoptimizedCode(&info)) {
     // Code generation will ensure that the feedback vector is present and
     // appropriately sized.
@@ -1719,6 +1963,18 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfo(
     RecordFunctionCompilation(CodeEventListener::FUNCTION_TAG, &info);
   }
 
+  // Lazy functions declared at the top level of a script are likely to be
+  // called soon, so let the compiler dispatcher compile them ahead of time.
+  // They are independent of each other, so their parse steps are started on
+  // background threads right away instead of waiting for idle time.
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (dispatcher != nullptr && maybe_existing.is_null() &&
+      !literal->ShouldEagerCompile() && !outer_info->will_serialize() &&
+      !outer_info->is_debug() &&
+      literal->scope()->outer_scope()->is_script_scope()) {
+    dispatcher->EnqueueAndStep(result);
+  }
+
   return result;
 }
 
@@ -1756,10 +2012,27 @@ Handle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForNative(
 
 MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    BailoutId osr_ast_id,
-                                                   JavaScriptFrame* osr_frame) {
+                                                   JavaScriptFrame* osr_frame,
+                                                   ConcurrencyMode mode) {
   DCHECK(!osr_ast_id.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(function, NOT_CONCURRENT, osr_ast_id, osr_frame);
+  return GetOptimizedCode(function, mode, osr_ast_id, osr_frame);
+}
+
+MaybeHandle<Code> Compiler::FinalizeOSRCompilationJob(CompilationJob* raw_job) {
+  // Take ownership of compilation job.  Deleting job also tears down the zone.
+  std::unique_ptr<CompilationJob> job(raw_job);
+  CompilationInfo* info = job->info();
+  Isolate* isolate = info->isolate();
+  DCHECK(info->is_osr());
+
+  VMState<COMPILER> state(isolate);
+  if (FinalizeOptimizedCompilationJob(job.get()) !=
+      CompilationJob::SUCCEEDED) {
+    return MaybeHandle<Code>();
+  }
+  // The code handle lives in the deferred handles of the job.
+  return handle(*info->code(), isolate);
 }
 
 CompilationJob* Compiler::PrepareUnoptimizedCompilationJob(
@@ -52,6 +52,10 @@ class Compiler : public AllStatic {
   static bool CompileDebugCode(Handle<SharedFunctionInfo> shared);
   static MaybeHandle<JSArray> CompileForLiveEdit(Handle<Script> script);
 
+  // Installs the source position table on the bytecode of {shared}, which was
+  // generated without one, by generating the same bytecode again.
+  static void CollectSourcePositions(Handle<SharedFunctionInfo> shared);
+
   // Prepare a compilation job for unoptimized code. Requires ParseAndAnalyse.
   static CompilationJob* PrepareUnoptimizedCompilationJob(
       CompilationInfo* info);
@@ -132,9 +136,17 @@ class Compiler : public AllStatic {
   // instead of generating JIT code for a function at all.
 
   // Generate and return optimized code for OSR, or empty handle on failure.
+  // In concurrent mode, a job is queued for the OptimizingCompileDispatcher
+  // instead and the InOptimizationQueue builtin is returned, unless cached
+  // code is found.
   MUST_USE_RESULT static MaybeHandle<Code> GetOptimizedCodeForOSR(
       Handle<JSFunction> function, BailoutId osr_ast_id,
-      JavaScriptFrame* osr_frame);
+      JavaScriptFrame* osr_frame, ConcurrencyMode mode = NOT_CONCURRENT);
+
+  // Finalize a concurrent OSR compilation job and return the code, or empty
+  // handle on failure.
+  MUST_USE_RESULT static MaybeHandle<Code> FinalizeOSRCompilationJob(
+      CompilationJob* job);
 };
 
 // A base class for compilation jobs intended to run concurrent to the main
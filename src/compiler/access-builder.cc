@@ -575,6 +575,14 @@ FieldAccess AccessBuilder::ForValue() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForCellValue() {
+  FieldAccess access = {
+      kTaggedBase, Cell::kValueOffset,       Handle<Name>(),
+      Type::Any(), MachineType::AnyTagged(), kFullWriteBarrier};
+  return access;
+}
+
 
 // static
 FieldAccess AccessBuilder::ForArgumentsLength() {
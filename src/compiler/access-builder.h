@@ -191,6 +191,9 @@ class AccessBuilder final : public AllStatic {
   // Provides access to JSValue::value() field.
   static FieldAccess ForValue();
 
+  // Provides access to Cell::value() field.
+  static FieldAccess ForCellValue();
+
   // Provides access to arguments object fields.
   static FieldAccess ForArgumentsLength();
   static FieldAccess ForArgumentsCallee();
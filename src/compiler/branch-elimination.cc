@@ -36,6 +36,8 @@ Reduction BranchElimination::Reduce(Node* node) {
       return ReduceLoop(node);
     case IrOpcode::kBranch:
       return ReduceBranch(node);
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
     case IrOpcode::kIfFalse:
       return ReduceIf(node, false);
     case IrOpcode::kIfTrue:
@@ -79,6 +81,28 @@ Reduction BranchElimination::ReduceBranch(Node* node) {
   return TakeConditionsFromFirstControl(node);
 }
 
+Reduction BranchElimination::ReduceCheckBounds(Node* node) {
+  // A bounds check is redundant if it is dominated by a comparison which
+  // established that the {index} is below the {length}, and both are known
+  // to be non-negative integers. This is the common case for loops like
+  // for (i = 0; i < a.length; ++i) { ... a[i] ... }, once load elimination
+  // has unified the loads of the length.
+  Node* index = NodeProperties::GetValueInput(node, 0);
+  Node* length = NodeProperties::GetValueInput(node, 1);
+  if (!NodeProperties::IsTyped(index) || !NodeProperties::IsTyped(length) ||
+      !NodeProperties::GetType(index)->Is(Type::Unsigned32()) ||
+      !NodeProperties::GetType(length)->Is(Type::Unsigned32())) {
+    return NoChange();
+  }
+  Node* control = NodeProperties::GetControlInput(node);
+  ControlPathConditions const* conditions = node_conditions_.Get(control);
+  if (conditions == nullptr || !conditions->IsLessThan(index, length)) {
+    return NoChange();
+  }
+  ReplaceWithValue(node, index);
+  return Replace(index);
+}
+
 Reduction BranchElimination::ReduceDeoptimizeConditional(Node* node) {
   DCHECK(node->opcode() == IrOpcode::kDeoptimizeIf ||
          node->opcode() == IrOpcode::kDeoptimizeUnless);
@@ -284,6 +308,37 @@ Maybe<bool> BranchElimination::ControlPathConditions::LookupCondition(
 }
 
 
+bool BranchElimination::ControlPathConditions::IsLessThan(Node* left,
+                                                           Node* right) const {
+  for (BranchCondition* current = head_; current != nullptr;
+       current = current->next) {
+    Node* condition = current->condition;
+    switch (condition->opcode()) {
+      case IrOpcode::kNumberLessThan:
+      case IrOpcode::kSpeculativeNumberLessThan:
+        // left < right
+        if (current->is_true && condition->InputAt(0) == left &&
+            condition->InputAt(1) == right) {
+          return true;
+        }
+        break;
+      case IrOpcode::kNumberLessThanOrEqual:
+      case IrOpcode::kSpeculativeNumberLessThanOrEqual:
+        // !(right <= left), which means left < right unless one of them
+        // is NaN. The caller rules that out.
+        if (!current->is_true && condition->InputAt(0) == right &&
+            condition->InputAt(1) == left) {
+          return true;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return false;
+}
+
+
 bool BranchElimination::ControlPathConditions::operator==(
     const ControlPathConditions& other) const {
   if (condition_count_ != other.condition_count_) return false;
@@ -39,6 +39,9 @@ class BranchElimination final : public AdvancedReducer {
   class ControlPathConditions {
    public:
     Maybe<bool> LookupCondition(Node* condition) const;
+    // Returns true if a numeric comparison on this path establishes that
+    // {left} is less than {right}, assuming that neither of them is NaN.
+    bool IsLessThan(Node* left, Node* right) const;
 
     const ControlPathConditions* AddCondition(Zone* zone, Node* condition,
                                               bool is_true) const;
@@ -75,6 +78,7 @@ class BranchElimination final : public AdvancedReducer {
   };
 
   Reduction ReduceBranch(Node* node);
+  Reduction ReduceCheckBounds(Node* node);
   Reduction ReduceDeoptimizeConditional(Node* node);
   Reduction ReduceIf(Node* node, bool is_true_branch);
   Reduction ReduceLoop(Node* node);
@@ -1821,6 +1821,13 @@ void BytecodeGraphBuilder::VisitDebugger() {
 DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK);
 #undef DEBUG_BREAK
 
+// Fused test and jump bytecodes have no frame state between the test and the
+// jump, and are not emitted when graphs are built from bytecode.
+#define TEST_AND_JUMP(Name) \
+  void BytecodeGraphBuilder::Visit##Name() { UNREACHABLE(); }
+TEST_AND_JUMP_BYTECODE_LIST(TEST_AND_JUMP);
+#undef TEST_AND_JUMP
+
 void BytecodeGraphBuilder::BuildForInPrepare() {
   FrameStateBeforeAndAfter states(this);
   Node* receiver =
@@ -33,8 +33,10 @@ class CodeGenerator::JumpTable final : public ZoneObject {
   size_t const target_count_;
 };
 
-CodeGenerator::CodeGenerator(Frame* frame, Linkage* linkage,
-                             InstructionSequence* code, CompilationInfo* info)
+CodeGenerator::CodeGenerator(
+    Frame* frame, Linkage* linkage, InstructionSequence* code,
+    CompilationInfo* info,
+    ZoneVector<trap_handler::ProtectedInstructionData>* protected_instructions)
     : frame_access_state_(nullptr),
       linkage_(linkage),
       code_(code),
@@ -57,7 +59,9 @@ CodeGenerator::CodeGenerator(Frame* frame, Linkage* linkage,
       ools_(nullptr),
       osr_pc_offset_(-1),
       source_position_table_builder_(code->zone(),
-                                     info->SourcePositionRecordingMode()) {
+                                     info->SourcePositionRecordingMode()),
+      protected_instructions_(protected_instructions),
+      result_(kSuccess) {
   for (int i = 0; i < code->InstructionBlockCount(); ++i) {
     new (&labels_[i]) Label;
   }
@@ -66,12 +70,22 @@ CodeGenerator::CodeGenerator(Frame* frame, Linkage* linkage,
 
 Isolate* CodeGenerator::isolate() const { return info_->isolate(); }
 
+void CodeGenerator::AddProtectedInstruction(int instr_offset,
+                                            int landing_offset) {
+  if (protected_instructions_ != nullptr) {
+    trap_handler::ProtectedInstructionData data = {
+        static_cast<uint32_t>(instr_offset),
+        static_cast<uint32_t>(landing_offset)};
+    protected_instructions_->push_back(data);
+  }
+}
+
 void CodeGenerator::CreateFrameAccessState(Frame* frame) {
   FinishFrame(frame);
   frame_access_state_ = new (code()->zone()) FrameAccessState(frame);
 }
 
-Handle<Code> CodeGenerator::GenerateCode() {
+void CodeGenerator::AssembleCode() {
   CompilationInfo* info = this->info();
 
   // Open a frame scope to indicate that there is a frame on the stack.  The
@@ -105,6 +119,17 @@ Handle<Code> CodeGenerator::GenerateCode() {
     }
   }
 
+  // Likewise keep the bytecode of inlined functions alive, as deoptimization
+  // might continue in the interpreter. This includes recursive inlining of
+  // the function itself. The bytecode of the outermost function is kept by
+  // the closure, or by the stack once the code is running.
+  for (const CompilationInfo::InlinedFunctionHolder& inlined :
+       info->inlined_functions()) {
+    if (!inlined.inlined_bytecode_root.is_null()) {
+      DefineDeoptimizationLiteral(inlined.inlined_bytecode_root);
+    }
+  }
+
   unwinding_info_writer_.SetNumberOfInstructionBlocks(
       code()->InstructionBlockCount());
 
@@ -170,7 +195,10 @@ Handle<Code> CodeGenerator::GenerateCode() {
       } else {
         result = AssembleBlock(block);
       }
-      if (result != kSuccess) return Handle<Code>();
+      if (result != kSuccess) {
+        result_ = result;
+        return;
+      }
       unwinding_info_writer_.EndInstructionBlock(block);
     }
   }
@@ -214,6 +242,11 @@ Handle<Code> CodeGenerator::GenerateCode() {
   safepoints()->Emit(masm(), frame()->GetTotalFrameSlotCount());
 
   unwinding_info_writer_.Finish(masm()->pc_offset());
+}
+
+Handle<Code> CodeGenerator::FinalizeCode() {
+  if (result_ != kSuccess) return Handle<Code>();
+  CompilationInfo* info = this->info();
 
   Handle<Code> result = v8::internal::CodeGenerator::MakeCodeEpilogue(
       masm(), unwinding_info_writer_.eh_frame_writer(), info, Handle<Object>());
@@ -232,6 +265,8 @@ Handle<Code> CodeGenerator::GenerateCode() {
             HandlerTable::LengthForReturn(static_cast<int>(handlers_.size())),
             TENURED));
     for (size_t i = 0; i < handlers_.size(); ++i) {
+      // HandlerTable::LookupReturn relies on the table being sorted.
+      DCHECK(i == 0 || handlers_[i - 1].pc_offset < handlers_[i].pc_offset);
       table->SetReturnOffset(static_cast<int>(i), handlers_[i].pc_offset);
       table->SetReturnHandler(static_cast<int>(i), handlers_[i].handler->pos());
     }
@@ -12,6 +12,7 @@
 #include "src/macro-assembler.h"
 #include "src/safepoint-table.h"
 #include "src/source-position-table.h"
+#include "src/trap-handler/trap-handler.h"
 
 namespace v8 {
 namespace internal {
@@ -51,11 +52,18 @@ class InstructionOperandIterator {
 // Generates native code for a sequence of instructions.
 class CodeGenerator final : public GapResolver::Assembler {
  public:
-  explicit CodeGenerator(Frame* frame, Linkage* linkage,
-                         InstructionSequence* code, CompilationInfo* info);
-
-  // Generate native code.
-  Handle<Code> GenerateCode();
+  explicit CodeGenerator(
+      Frame* frame, Linkage* linkage, InstructionSequence* code,
+      CompilationInfo* info,
+      ZoneVector<trap_handler::ProtectedInstructionData>*
+          protected_instructions = nullptr);
+
+  // Generate native code. After assembling the instructions the remaining
+  // data (safepoints, source positions, handlers and deoptimization
+  // translations) is fully built in zone memory; FinalizeCode only allocates
+  // the heap objects and copies it over.
+  void AssembleCode();
+  Handle<Code> FinalizeCode();
 
   InstructionSequence* code() const { return code_; }
   FrameAccessState* frame_access_state() const { return frame_access_state_; }
@@ -65,6 +73,10 @@ class CodeGenerator final : public GapResolver::Assembler {
 
   Label* GetLabel(RpoNumber rpo) { return &labels_[rpo.ToSize()]; }
 
+  // Records a memory access whose faults are turned into traps by the trap
+  // handler, and the out-of-line code which throws the trap.
+  void AddProtectedInstruction(int instr_offset, int landing_offset);
+
  private:
   MacroAssembler* masm() { return &masm_; }
   GapResolver* resolver() { return &resolver_; }
@@ -280,6 +292,8 @@ class CodeGenerator final : public GapResolver::Assembler {
   OutOfLineCode* ools_;
   int osr_pc_offset_;
   SourcePositionTableBuilder source_position_table_builder_;
+  ZoneVector<trap_handler::ProtectedInstructionData>* protected_instructions_;
+  CodeGenResult result_;
 };
 
 }  // namespace compiler
@@ -12,6 +12,7 @@
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
 #include "src/compiler/schedule.h"
+#include "src/fast-accessor-assembler.h"
 
 namespace v8 {
 namespace internal {
@@ -713,6 +714,15 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kObjectIsUndetectable:
       state = LowerObjectIsUndetectable(node, *effect, *control);
       break;
+    case IrOpcode::kArgumentsFrame:
+      state = LowerArgumentsFrame(node, *effect, *control);
+      break;
+    case IrOpcode::kArgumentsLength:
+      state = LowerArgumentsLength(node, *effect, *control);
+      break;
+    case IrOpcode::kNewUnmappedArgumentsElements:
+      state = LowerNewUnmappedArgumentsElements(node, *effect, *control);
+      break;
     case IrOpcode::kArrayBufferWasNeutered:
       state = LowerArrayBufferWasNeutered(node, *effect, *control);
       break;
@@ -761,12 +771,27 @@ bool EffectControlLinearizer::TryWireInStateEffect(Node* node,
     case IrOpcode::kTransitionElementsKind:
       state = LowerTransitionElementsKind(node, *effect, *control);
       break;
+    case IrOpcode::kLoadFastAccessor:
+      state = LowerLoadFastAccessor(node, *effect, *control);
+      break;
     case IrOpcode::kLoadTypedElement:
       state = LowerLoadTypedElement(node, *effect, *control);
       break;
     case IrOpcode::kStoreTypedElement:
       state = LowerStoreTypedElement(node, *effect, *control);
       break;
+    case IrOpcode::kLoadDataViewElement:
+      state = LowerLoadDataViewElement(node, *effect, *control);
+      break;
+    case IrOpcode::kStoreDataViewElement:
+      state = LowerStoreDataViewElement(node, *effect, *control);
+      break;
+    case IrOpcode::kAtomicLoadTypedElement:
+      state = LowerAtomicLoadTypedElement(node, *effect, *control);
+      break;
+    case IrOpcode::kAtomicStoreTypedElement:
+      state = LowerAtomicStoreTypedElement(node, *effect, *control);
+      break;
     case IrOpcode::kFloat64RoundUp:
       state = LowerFloat64RoundUp(node, *effect, *control);
       break;
@@ -2143,6 +2168,102 @@ EffectControlLinearizer::LowerObjectIsUndetectable(Node* node, Node* effect,
   return ValueEffectControl(value, effect, control);
 }
 
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerArgumentsFrame(Node* node, Node* effect,
+                                             Node* control) {
+  // The parameters of the outermost frame live above the arguments adaptor
+  // frame if there is one, and above the current frame otherwise.
+  Node* frame = graph()->NewNode(machine()->LoadFramePointer());
+  Node* parent_frame = effect = graph()->NewNode(
+      machine()->Load(MachineType::Pointer()), frame,
+      jsgraph()->IntPtrConstant(StandardFrameConstants::kCallerFPOffset),
+      effect, control);
+  Node* parent_frame_type = effect = graph()->NewNode(
+      machine()->Load(MachineType::AnyTagged()), parent_frame,
+      jsgraph()->IntPtrConstant(
+          CommonFrameConstants::kContextOrFrameTypeOffset),
+      effect, control);
+  Node* check = graph()->NewNode(
+      machine()->WordEqual(), parent_frame_type,
+      jsgraph()->SmiConstant(StackFrame::ARGUMENTS_ADAPTOR));
+  Node* value =
+      graph()->NewNode(common()->Select(MachineType::PointerRepresentation(),
+                                        BranchHint::kFalse),
+                       check, parent_frame, frame);
+
+  return ValueEffectControl(value, effect, control);
+}
+
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerArgumentsLength(Node* node, Node* effect,
+                                              Node* control) {
+  Node* arguments_frame = node->InputAt(0);
+  ArgumentsLengthParameters const& p = ArgumentsLengthParametersOf(node->op());
+  int const formal_parameter_count = p.formal_parameter_count();
+
+  // Without an arguments adaptor frame, the actual number of parameters
+  // matches the {formal_parameter_count}.
+  Node* frame = graph()->NewNode(machine()->LoadFramePointer());
+  Node* check =
+      graph()->NewNode(machine()->WordEqual(), arguments_frame, frame);
+  Node* branch =
+      graph()->NewNode(common()->Branch(BranchHint::kTrue), check, control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* etrue = effect;
+  Node* vtrue = jsgraph()->SmiConstant(
+      p.is_rest_length() ? 0 : formal_parameter_count);
+
+  // Otherwise load the actual number of parameters from the adaptor frame.
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* efalse = effect;
+  Node* vfalse = efalse = graph()->NewNode(
+      machine()->Load(MachineType::TaggedSigned()), arguments_frame,
+      jsgraph()->IntPtrConstant(ArgumentsAdaptorFrameConstants::kLengthOffset),
+      efalse, if_false);
+  if (p.is_rest_length()) {
+    // The rest length is max(0, actual - formal), computed on the Smis.
+    vfalse = graph()->NewNode(machine()->IntSub(), vfalse,
+                              jsgraph()->SmiConstant(formal_parameter_count));
+    vfalse = graph()->NewNode(
+        common()->Select(MachineRepresentation::kTaggedSigned),
+        graph()->NewNode(machine()->IntLessThan(), vfalse,
+                         jsgraph()->SmiConstant(0)),
+        jsgraph()->SmiConstant(0), vfalse);
+  }
+
+  control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  effect = graph()->NewNode(common()->EffectPhi(2), etrue, efalse, control);
+  Node* value =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTaggedSigned, 2),
+                       vtrue, vfalse, control);
+
+  return ValueEffectControl(value, effect, control);
+}
+
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerNewUnmappedArgumentsElements(Node* node,
+                                                           Node* effect,
+                                                           Node* control) {
+  Node* frame = node->InputAt(0);
+  Node* length = node->InputAt(1);
+
+  // The {frame} is aligned and thus looks like a Smi to the GC.
+  frame = graph()->NewNode(machine()->BitcastWordToTagged(), frame);
+
+  Callable const callable =
+      CodeFactory::NewUnmappedArgumentsElements(isolate());
+  Operator::Properties const properties = node->op()->properties();
+  CallDescriptor::Flags const flags = CallDescriptor::kNoFlags;
+  CallDescriptor const* const desc = Linkage::GetStubCallDescriptor(
+      isolate(), graph()->zone(), callable.descriptor(), 0, flags, properties);
+  Node* value = effect = graph()->NewNode(
+      common()->Call(desc), jsgraph()->HeapConstant(callable.code()), frame,
+      length, jsgraph()->NoContextConstant(), effect);
+
+  return ValueEffectControl(value, effect, control);
+}
+
 EffectControlLinearizer::ValueEffectControl
 EffectControlLinearizer::LowerArrayBufferWasNeutered(Node* node, Node* effect,
                                                      Node* control) {
@@ -3231,6 +3352,214 @@ EffectControlLinearizer::LowerTransitionElementsKind(Node* node, Node* effect,
   return ValueEffectControl(nullptr, effect, control);
 }
 
+namespace {
+
+// The paths which reach a label, or the end of a fast accessor.
+struct FastAccessorEdges {
+  explicit FastAccessorEdges(Zone* zone)
+      : values(zone), effects(zone), controls(zone) {}
+
+  void Add(Node* value, Node* effect, Node* control) {
+    values.push_back(value);
+    effects.push_back(effect);
+    controls.push_back(control);
+  }
+
+  ZoneVector<Node*> values;
+  ZoneVector<Node*> effects;
+  ZoneVector<Node*> controls;
+};
+
+}  // namespace
+
+// Builds the graph for a FastAccessorAssembler program, with the same machine
+// operations as the code generated by the FastAccessorAssembler itself.
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerLoadFastAccessor(Node* node, Node* effect,
+                                               Node* control) {
+  Handle<FixedArray> program = FastAccessorProgramOf(node->op());
+  DCHECK(FastAccessorAssembler::IsInlineable(*program));
+  Node* receiver = node->InputAt(0);
+  Zone* zone = graph()->zone();
+
+  ZoneVector<Node*> values(zone);
+  ZoneVector<FastAccessorEdges> labels(zone);
+  FastAccessorEdges returns(zone);
+  // Code after a return or a jump is only reachable through a label.
+  bool reachable = true;
+
+  // Continues with {control} and {effect} if {check} is false, and returns
+  // null otherwise.
+  auto return_null_if = [&](Node* check) {
+    Node* branch =
+        graph()->NewNode(common()->Branch(BranchHint::kFalse), check, control);
+    returns.Add(jsgraph()->NullConstant(), effect,
+                graph()->NewNode(common()->IfTrue(), branch));
+    control = graph()->NewNode(common()->IfFalse(), branch);
+  };
+
+  for (int i = 0; i < program->length();
+       i += FastAccessorAssembler::kOperationSize) {
+    int opcode = Smi::cast(program->get(i))->value();
+    int operand0 = Smi::cast(program->get(i + 1))->value();
+    int operand1 = Smi::cast(program->get(i + 2))->value();
+    switch (opcode) {
+      case FastAccessorAssembler::kIntegerConstant:
+        values.push_back(jsgraph()->SmiConstant(operand0));
+        break;
+      case FastAccessorAssembler::kGetReceiver:
+        values.push_back(receiver);
+        break;
+      case FastAccessorAssembler::kLoadInternalField: {
+        // Return null for anything but JSObjects and JSApiObjects.
+        Node* value = values[operand0];
+        Node* branch0 = graph()->NewNode(common()->Branch(BranchHint::kFalse),
+                                         ObjectIsSmi(value), control);
+        Node* if_true0 = graph()->NewNode(common()->IfTrue(), branch0);
+        Node* if_false0 = graph()->NewNode(common()->IfFalse(), branch0);
+        Node* efalse0 = effect;
+        Node* value_map = efalse0 =
+            graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                             value, efalse0, if_false0);
+        Node* value_instance_type = efalse0 = graph()->NewNode(
+            simplified()->LoadField(AccessBuilder::ForMapInstanceType()),
+            value_map, efalse0, if_false0);
+        Node* check1 = graph()->NewNode(
+            machine()->Word32Or(),
+            graph()->NewNode(machine()->Word32Equal(), value_instance_type,
+                             jsgraph()->Int32Constant(JS_OBJECT_TYPE)),
+            graph()->NewNode(machine()->Word32Equal(), value_instance_type,
+                             jsgraph()->Int32Constant(JS_API_OBJECT_TYPE)));
+        Node* branch1 = graph()->NewNode(common()->Branch(BranchHint::kTrue),
+                                         check1, if_false0);
+        Node* if_true1 = graph()->NewNode(common()->IfTrue(), branch1);
+        Node* if_false1 = graph()->NewNode(common()->IfFalse(), branch1);
+        FieldAccess access = {kTaggedBase,
+                              JSObject::kHeaderSize + kPointerSize * operand1,
+                              MaybeHandle<Name>(),
+                              Type::Any(),
+                              MachineType::Pointer(),
+                              kNoWriteBarrier};
+        Node* etrue1 = efalse0;
+        Node* vtrue1 = etrue1 = graph()->NewNode(
+            simplified()->LoadField(access), value, etrue1, if_true1);
+
+        control = graph()->NewNode(common()->Merge(3), if_true0, if_true1,
+                                   if_false1);
+        effect = graph()->NewNode(common()->EffectPhi(3), effect, etrue1,
+                                  efalse0, control);
+        values.push_back(
+            graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 3),
+                             jsgraph()->NullConstant(), vtrue1,
+                             jsgraph()->NullConstant(), control));
+        break;
+      }
+      case FastAccessorAssembler::kLoadInternalFieldUnchecked: {
+        FieldAccess access = {kTaggedBase,
+                              JSObject::kHeaderSize + kPointerSize * operand1,
+                              MaybeHandle<Name>(),
+                              Type::Any(),
+                              MachineType::Pointer(),
+                              kNoWriteBarrier};
+        Node* value = effect = graph()->NewNode(
+            simplified()->LoadField(access), values[operand0], effect, control);
+        values.push_back(value);
+        break;
+      }
+      case FastAccessorAssembler::kLoadValue: {
+        Node* value = effect = graph()->NewNode(
+            machine()->Load(MachineType::IntPtr()), values[operand0],
+            jsgraph()->IntPtrConstant(operand1), effect, control);
+        values.push_back(value);
+        break;
+      }
+      case FastAccessorAssembler::kLoadObject: {
+        Node* pointer = effect = graph()->NewNode(
+            machine()->Load(MachineType::Pointer()), values[operand0],
+            jsgraph()->IntPtrConstant(operand1), effect, control);
+        Node* value = effect = graph()->NewNode(
+            machine()->Load(MachineType::AnyTagged()), pointer,
+            jsgraph()->IntPtrConstant(0), effect, control);
+        values.push_back(value);
+        break;
+      }
+      case FastAccessorAssembler::kToSmi:
+        values.push_back(graph()->NewNode(
+            machine()->WordShl(), values[operand0], SmiShiftBitsConstant()));
+        break;
+      case FastAccessorAssembler::kReturnValue:
+        returns.Add(values[operand0], effect, control);
+        reachable = false;
+        break;
+      case FastAccessorAssembler::kCheckFlagSetOrReturnNull:
+        return_null_if(graph()->NewNode(
+            machine()->Word32Equal(),
+            graph()->NewNode(machine()->Word32And(), values[operand0],
+                             jsgraph()->Int32Constant(operand1)),
+            jsgraph()->Int32Constant(0)));
+        break;
+      case FastAccessorAssembler::kCheckNotZeroOrReturnNull:
+        return_null_if(graph()->NewNode(machine()->WordEqual(),
+                                        values[operand0],
+                                        jsgraph()->IntPtrConstant(0)));
+        break;
+      case FastAccessorAssembler::kMakeLabel:
+        labels.push_back(FastAccessorEdges(zone));
+        break;
+      case FastAccessorAssembler::kSetLabel: {
+        FastAccessorEdges& label = labels[operand0];
+        if (reachable) label.Add(nullptr, effect, control);
+        int const count = static_cast<int>(label.controls.size());
+        reachable = count > 0;
+        if (count == 1) {
+          effect = label.effects[0];
+          control = label.controls[0];
+        } else if (count > 1) {
+          control = graph()->NewNode(common()->Merge(count), count,
+                                     label.controls.data());
+          label.effects.push_back(control);
+          effect = graph()->NewNode(common()->EffectPhi(count), count + 1,
+                                    label.effects.data());
+        }
+        break;
+      }
+      case FastAccessorAssembler::kGoto:
+        labels[operand0].Add(nullptr, effect, control);
+        reachable = false;
+        break;
+      case FastAccessorAssembler::kCheckNotZeroOrJump: {
+        Node* check = graph()->NewNode(machine()->WordEqual(), values[operand0],
+                                       jsgraph()->IntPtrConstant(0));
+        Node* branch = graph()->NewNode(common()->Branch(), check, control);
+        labels[operand1].Add(nullptr, effect,
+                             graph()->NewNode(common()->IfTrue(), branch));
+        control = graph()->NewNode(common()->IfFalse(), branch);
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  // Merge the values returned on all paths.
+  int const count = static_cast<int>(returns.controls.size());
+  DCHECK_LT(0, count);
+  if (count == 1) {
+    return ValueEffectControl(returns.values[0], returns.effects[0],
+                              returns.controls[0]);
+  }
+  control = graph()->NewNode(common()->Merge(count), count,
+                             returns.controls.data());
+  returns.effects.push_back(control);
+  effect = graph()->NewNode(common()->EffectPhi(count), count + 1,
+                            returns.effects.data());
+  returns.values.push_back(control);
+  Node* value =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, count),
+                       count + 1, returns.values.data());
+  return ValueEffectControl(value, effect, control);
+}
+
 EffectControlLinearizer::ValueEffectControl
 EffectControlLinearizer::LowerLoadTypedElement(Node* node, Node* effect,
                                                Node* control) {
@@ -3284,6 +3613,273 @@ EffectControlLinearizer::LowerStoreTypedElement(Node* node, Node* effect,
   return ValueEffectControl(nullptr, effect, control);
 }
 
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerLoadDataViewElement(Node* node, Node* effect,
+                                                  Node* control) {
+  ExternalArrayType array_type = ExternalArrayTypeOf(node->op());
+  Node* buffer = node->InputAt(0);
+  Node* storage = node->InputAt(1);
+  Node* index = node->InputAt(2);
+  Node* is_little_endian = node->InputAt(3);
+
+  // We need to keep the {buffer} alive so that the GC will not release the
+  // ArrayBuffer as long as we are still operating on it.
+  effect = graph()->NewNode(common()->Retain(), buffer, effect);
+
+  // The {index} is a byte offset into the {storage}, so the access is not
+  // necessarily aligned for the element type.
+  MachineType const machine_type =
+      AccessBuilder::ForTypedArrayElement(array_type, true).machine_type;
+  if (machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+  Operator const* const op =
+      machine()->UnalignedLoadSupported(machine_type, 1)
+          ? machine()->Load(machine_type)
+          : machine()->UnalignedLoad(machine_type);
+  Node* value = effect = graph()->NewNode(op, storage, index, effect, control);
+
+  // Convert the {value} from the requested byte order.
+  value = BuildDataViewEndiannessSwap(array_type, value, is_little_endian,
+                                      &control);
+
+  return ValueEffectControl(value, effect, control);
+}
+
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerStoreDataViewElement(Node* node, Node* effect,
+                                                   Node* control) {
+  ExternalArrayType array_type = ExternalArrayTypeOf(node->op());
+  Node* buffer = node->InputAt(0);
+  Node* storage = node->InputAt(1);
+  Node* index = node->InputAt(2);
+  Node* value = node->InputAt(3);
+  Node* is_little_endian = node->InputAt(4);
+
+  // We need to keep the {buffer} alive so that the GC will not release the
+  // ArrayBuffer as long as we are still operating on it.
+  effect = graph()->NewNode(common()->Retain(), buffer, effect);
+
+  // Convert the {value} to the requested byte order.
+  value = BuildDataViewEndiannessSwap(array_type, value, is_little_endian,
+                                      &control);
+
+  // The {index} is a byte offset into the {storage}, so the access is not
+  // necessarily aligned for the element type.
+  MachineType const machine_type =
+      AccessBuilder::ForTypedArrayElement(array_type, true).machine_type;
+  MachineRepresentation const rep = machine_type.representation();
+  if (machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+  Operator const* const op =
+      machine()->UnalignedStoreSupported(machine_type, 1)
+          ? machine()->Store(StoreRepresentation(rep, kNoWriteBarrier))
+          : machine()->UnalignedStore(rep);
+  effect = graph()->NewNode(op, storage, index, value, effect, control);
+
+  return ValueEffectControl(nullptr, effect, control);
+}
+
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerAtomicLoadTypedElement(Node* node, Node* effect,
+                                                     Node* control) {
+  ExternalArrayType array_type = ExternalArrayTypeOf(node->op());
+  Node* buffer = node->InputAt(0);
+  Node* external = node->InputAt(1);
+  Node* index = node->InputAt(2);
+
+  // We need to keep the {buffer} alive so that the GC will not release the
+  // ArrayBuffer as long as we are still operating on it.
+  effect = graph()->NewNode(common()->Retain(), buffer, effect);
+
+  MachineType const machine_type =
+      AccessBuilder::ForTypedArrayElement(array_type, true).machine_type;
+  Node* offset = BuildTypedElementOffset(machine_type.representation(), index);
+  Node* value = effect =
+      graph()->NewNode(machine()->AtomicLoad(machine_type), external, offset,
+                       effect, control);
+
+  return ValueEffectControl(value, effect, control);
+}
+
+EffectControlLinearizer::ValueEffectControl
+EffectControlLinearizer::LowerAtomicStoreTypedElement(Node* node, Node* effect,
+                                                      Node* control) {
+  ExternalArrayType array_type = ExternalArrayTypeOf(node->op());
+  Node* buffer = node->InputAt(0);
+  Node* external = node->InputAt(1);
+  Node* index = node->InputAt(2);
+  Node* value = node->InputAt(3);
+
+  // We need to keep the {buffer} alive so that the GC will not release the
+  // ArrayBuffer as long as we are still operating on it.
+  effect = graph()->NewNode(common()->Retain(), buffer, effect);
+
+  MachineRepresentation const rep =
+      AccessBuilder::ForTypedArrayElement(array_type, true)
+          .machine_type.representation();
+  Node* offset = BuildTypedElementOffset(rep, index);
+  effect = graph()->NewNode(machine()->AtomicStore(rep), external, offset,
+                            value, effect, control);
+
+  return ValueEffectControl(nullptr, effect, control);
+}
+
+Node* EffectControlLinearizer::BuildTypedElementOffset(
+    MachineRepresentation rep, Node* index) {
+  int const element_size_shift = ElementSizeLog2Of(rep);
+  if (element_size_shift) {
+    index = graph()->NewNode(machine()->Word32Shl(), index,
+                             jsgraph()->Int32Constant(element_size_shift));
+  }
+  if (machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+  return index;
+}
+
+Node* EffectControlLinearizer::BuildDataViewEndiannessSwap(
+    ExternalArrayType array_type, Node* value, Node* is_little_endian,
+    Node** control) {
+  // Use the native byte order if the {is_little_endian} input is known.
+  Int32Matcher m(is_little_endian);
+  if (m.HasValue()) {
+#if V8_TARGET_LITTLE_ENDIAN
+    bool const native = m.Value() != 0;
+#else
+    bool const native = m.Value() == 0;
+#endif
+    return native ? value : BuildReverseBytes(array_type, value);
+  }
+
+  Node* branch =
+      graph()->NewNode(common()->Branch(), is_little_endian, *control);
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+#if V8_TARGET_LITTLE_ENDIAN
+  Node* vtrue = value;
+  Node* vfalse = BuildReverseBytes(array_type, value);
+#else
+  Node* vtrue = BuildReverseBytes(array_type, value);
+  Node* vfalse = value;
+#endif
+
+  MachineRepresentation rep = MachineRepresentation::kWord32;
+  if (array_type == kExternalFloat32Array) {
+    rep = MachineRepresentation::kFloat32;
+  } else if (array_type == kExternalFloat64Array) {
+    rep = MachineRepresentation::kFloat64;
+  }
+  *control = graph()->NewNode(common()->Merge(2), if_true, if_false);
+  return graph()->NewNode(common()->Phi(rep, 2), vtrue, vfalse, *control);
+}
+
+Node* EffectControlLinearizer::BuildReverseBytes(ExternalArrayType array_type,
+                                                 Node* value) {
+  switch (array_type) {
+    case kExternalInt8Array:
+    case kExternalUint8Array:
+    case kExternalUint8ClampedArray:
+      return value;
+
+    case kExternalInt16Array: {
+      if (machine()->Word32ReverseBytes().IsSupported()) {
+        return graph()->NewNode(
+            machine()->Word32Sar(),
+            graph()->NewNode(machine()->Word32ReverseBytes().op(), value),
+            jsgraph()->Int32Constant(16));
+      }
+      Node* high = graph()->NewNode(
+          machine()->Word32Sar(),
+          graph()->NewNode(machine()->Word32Shl(), value,
+                           jsgraph()->Int32Constant(24)),
+          jsgraph()->Int32Constant(16));
+      Node* low = graph()->NewNode(
+          machine()->Word32And(),
+          graph()->NewNode(machine()->Word32Shr(), value,
+                           jsgraph()->Int32Constant(8)),
+          jsgraph()->Int32Constant(0xff));
+      return graph()->NewNode(machine()->Word32Or(), high, low);
+    }
+
+    case kExternalUint16Array: {
+      if (machine()->Word32ReverseBytes().IsSupported()) {
+        return graph()->NewNode(
+            machine()->Word32Shr(),
+            graph()->NewNode(machine()->Word32ReverseBytes().op(), value),
+            jsgraph()->Int32Constant(16));
+      }
+      Node* high = graph()->NewNode(
+          machine()->Word32And(),
+          graph()->NewNode(machine()->Word32Shl(), value,
+                           jsgraph()->Int32Constant(8)),
+          jsgraph()->Int32Constant(0xff00));
+      Node* low = graph()->NewNode(
+          machine()->Word32And(),
+          graph()->NewNode(machine()->Word32Shr(), value,
+                           jsgraph()->Int32Constant(8)),
+          jsgraph()->Int32Constant(0xff));
+      return graph()->NewNode(machine()->Word32Or(), high, low);
+    }
+
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+      return BuildWord32ReverseBytes(value);
+
+    case kExternalFloat32Array: {
+      value = graph()->NewNode(machine()->BitcastFloat32ToInt32(), value);
+      value = BuildWord32ReverseBytes(value);
+      return graph()->NewNode(machine()->BitcastInt32ToFloat32(), value);
+    }
+
+    case kExternalFloat64Array: {
+      if (machine()->Is64() && machine()->Word64ReverseBytes().IsSupported()) {
+        value = graph()->NewNode(machine()->BitcastFloat64ToInt64(), value);
+        value = graph()->NewNode(machine()->Word64ReverseBytes().op(), value);
+        return graph()->NewNode(machine()->BitcastInt64ToFloat64(), value);
+      }
+      // Swap the bytes of both words and exchange the words.
+      Node* low = BuildWord32ReverseBytes(
+          graph()->NewNode(machine()->Float64ExtractLowWord32(), value));
+      Node* high = BuildWord32ReverseBytes(
+          graph()->NewNode(machine()->Float64ExtractHighWord32(), value));
+      Node* result = jsgraph()->Float64Constant(0.0);
+      result =
+          graph()->NewNode(machine()->Float64InsertLowWord32(), result, high);
+      return graph()->NewNode(machine()->Float64InsertHighWord32(), result,
+                              low);
+    }
+  }
+  UNREACHABLE();
+  return nullptr;
+}
+
+Node* EffectControlLinearizer::BuildWord32ReverseBytes(Node* value) {
+  if (machine()->Word32ReverseBytes().IsSupported()) {
+    return graph()->NewNode(machine()->Word32ReverseBytes().op(), value);
+  }
+  Node* byte0 = graph()->NewNode(machine()->Word32Shl(), value,
+                                 jsgraph()->Int32Constant(24));
+  Node* byte1 = graph()->NewNode(
+      machine()->Word32And(),
+      graph()->NewNode(machine()->Word32Shl(), value,
+                       jsgraph()->Int32Constant(8)),
+      jsgraph()->Int32Constant(0xff0000));
+  Node* byte2 = graph()->NewNode(
+      machine()->Word32And(),
+      graph()->NewNode(machine()->Word32Shr(), value,
+                       jsgraph()->Int32Constant(8)),
+      jsgraph()->Int32Constant(0xff00));
+  Node* byte3 = graph()->NewNode(machine()->Word32Shr(), value,
+                                 jsgraph()->Int32Constant(24));
+  return graph()->NewNode(
+      machine()->Word32Or(),
+      graph()->NewNode(machine()->Word32Or(), byte0, byte1),
+      graph()->NewNode(machine()->Word32Or(), byte2, byte3));
+}
+
 EffectControlLinearizer::ValueEffectControl
 EffectControlLinearizer::LowerFloat64RoundUp(Node* node, Node* effect,
                                              Node* control) {
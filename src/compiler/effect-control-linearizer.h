@@ -136,6 +136,12 @@ class EffectControlLinearizer {
                                          Node* control);
   ValueEffectControl LowerObjectIsUndetectable(Node* node, Node* effect,
                                                Node* control);
+  ValueEffectControl LowerArgumentsFrame(Node* node, Node* effect,
+                                         Node* control);
+  ValueEffectControl LowerArgumentsLength(Node* node, Node* effect,
+                                          Node* control);
+  ValueEffectControl LowerNewUnmappedArgumentsElements(Node* node, Node* effect,
+                                                       Node* control);
   ValueEffectControl LowerArrayBufferWasNeutered(Node* node, Node* effect,
                                                  Node* control);
   ValueEffectControl LowerStringCharCodeAt(Node* node, Node* effect,
@@ -167,10 +173,20 @@ class EffectControlLinearizer {
                                                 Node* effect, Node* control);
   ValueEffectControl LowerTransitionElementsKind(Node* node, Node* effect,
                                                  Node* control);
+  ValueEffectControl LowerLoadFastAccessor(Node* node, Node* effect,
+                                           Node* control);
   ValueEffectControl LowerLoadTypedElement(Node* node, Node* effect,
                                            Node* control);
   ValueEffectControl LowerStoreTypedElement(Node* node, Node* effect,
                                             Node* control);
+  ValueEffectControl LowerLoadDataViewElement(Node* node, Node* effect,
+                                              Node* control);
+  ValueEffectControl LowerStoreDataViewElement(Node* node, Node* effect,
+                                               Node* control);
+  ValueEffectControl LowerAtomicLoadTypedElement(Node* node, Node* effect,
+                                                 Node* control);
+  ValueEffectControl LowerAtomicStoreTypedElement(Node* node, Node* effect,
+                                                  Node* control);
 
   // Lowering of optional operators.
   ValueEffectControl LowerFloat64RoundUp(Node* node, Node* effect,
@@ -190,6 +206,11 @@ class EffectControlLinearizer {
       Node* control);
   ValueEffectControl LowerStringComparison(Callable const& callable, Node* node,
                                            Node* effect, Node* control);
+  Node* BuildDataViewEndiannessSwap(ExternalArrayType array_type, Node* value,
+                                    Node* is_little_endian, Node** control);
+  Node* BuildReverseBytes(ExternalArrayType array_type, Node* value);
+  Node* BuildWord32ReverseBytes(Node* value);
+  Node* BuildTypedElementOffset(MachineRepresentation rep, Node* index);
 
   Node* ChangeInt32ToSmi(Node* value);
   Node* ChangeUint32ToSmi(Node* value);
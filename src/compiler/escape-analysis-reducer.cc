@@ -7,6 +7,7 @@
 #include "src/compiler/all-nodes.h"
 #include "src/compiler/js-graph.h"
 #include "src/counters.h"
+#include "src/objects-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -52,6 +53,12 @@ Reduction EscapeAnalysisReducer::Reduce(Node* node) {
       return ReduceReferenceEqual(node);
     case IrOpcode::kObjectIsSmi:
       return ReduceObjectIsSmi(node);
+    case IrOpcode::kObjectIsCallable:
+    case IrOpcode::kObjectIsNumber:
+    case IrOpcode::kObjectIsReceiver:
+    case IrOpcode::kObjectIsString:
+    case IrOpcode::kObjectIsUndetectable:
+      return ReduceObjectIsType(node);
     // FrameStates and Value nodes are preprocessed here,
     // and visited via ReduceFrameStateUses from their user nodes.
     case IrOpcode::kFrameState:
@@ -202,7 +209,7 @@ Reduction EscapeAnalysisReducer::ReduceReferenceEqual(Node* node) {
         escape_analysis()->CompareVirtualObjects(left, right)) {
       ReplaceWithValue(node, jsgraph()->TrueConstant());
       TRACE("Replaced ref eq #%d with true\n", node->id());
-      Replace(jsgraph()->TrueConstant());
+      return Replace(jsgraph()->TrueConstant());
     }
     // Right-hand side is not a virtual object, or a different one.
     ReplaceWithValue(node, jsgraph()->FalseConstant());
@@ -230,6 +237,43 @@ Reduction EscapeAnalysisReducer::ReduceObjectIsSmi(Node* node) {
 }
 
 
+Reduction EscapeAnalysisReducer::ReduceObjectIsType(Node* node) {
+  Node* input = NodeProperties::GetValueInput(node, 0);
+  if (!escape_analysis()->IsVirtual(input)) return NoChange();
+  Node* map_constant = EscapeAnalysis::GetAllocationMap(input);
+  if (map_constant == nullptr) return NoChange();
+  Handle<Map> map =
+      Handle<Map>::cast(OpParameter<Handle<HeapObject>>(map_constant));
+  bool result;
+  switch (node->opcode()) {
+    case IrOpcode::kObjectIsCallable:
+      result = map->is_callable() && !map->is_undetectable();
+      break;
+    case IrOpcode::kObjectIsNumber:
+      result = map->instance_type() == HEAP_NUMBER_TYPE;
+      break;
+    case IrOpcode::kObjectIsReceiver:
+      result = map->IsJSReceiverMap();
+      break;
+    case IrOpcode::kObjectIsString:
+      result = map->instance_type() < FIRST_NONSTRING_TYPE;
+      break;
+    case IrOpcode::kObjectIsUndetectable:
+      result = map->is_undetectable();
+      break;
+    default:
+      UNREACHABLE();
+      return NoChange();
+  }
+  Node* value =
+      result ? jsgraph()->TrueConstant() : jsgraph()->FalseConstant();
+  ReplaceWithValue(node, value);
+  TRACE("Replaced %s #%d with %s\n", node->op()->mnemonic(), node->id(),
+        result ? "true" : "false");
+  return Replace(value);
+}
+
+
 Reduction EscapeAnalysisReducer::ReduceFrameStateUses(Node* node) {
   DCHECK_GE(node->op()->EffectInputCount(), 1);
   if (node->id() < static_cast<NodeId>(fully_reduced_.length())) {
@@ -34,6 +34,7 @@ class EscapeAnalysisReducer final : public AdvancedReducer {
   Reduction ReduceFinishRegion(Node* node);
   Reduction ReduceReferenceEqual(Node* node);
   Reduction ReduceObjectIsSmi(Node* node);
+  Reduction ReduceObjectIsType(Node* node);
   Reduction ReduceFrameStateUses(Node* node);
   Node* ReduceDeoptState(Node* node, Node* effect, bool multiple_users);
   Node* ReduceStateValueInput(Node* node, int node_index, Node* effect,
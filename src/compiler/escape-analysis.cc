@@ -10,6 +10,7 @@
 #include "src/bootstrapper.h"
 #include "src/compilation-dependencies.h"
 #include "src/compiler/common-operator.h"
+#include "src/compiler/frame-states.h"
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/js-operator.h"
 #include "src/compiler/node-matchers.h"
@@ -756,6 +757,19 @@ bool EscapeStatusAnalysis::CheckUsesForEscape(Node* uses, Node* rep,
     if (edge.index() >= use->op()->ValueInputCount() +
                             OperatorProperties::GetContextInputCount(use->op()))
       continue;
+    if (use->opcode() == IrOpcode::kFrameState &&
+        edge.index() == kFrameStateFunctionInput) {
+      // Stack walks read the function of an optimized frame from the stack,
+      // so it cannot be captured, e.g. when inlining a closure created here.
+      if (SetEscaped(rep)) {
+        TRACE(
+            "Setting #%d (%s) to escaped because of use as function of frame "
+            "state #%d\n",
+            rep->id(), rep->op()->mnemonic(), use->id());
+        return true;
+      }
+      continue;
+    }
     switch (use->opcode()) {
       case IrOpcode::kPhi:
         if (phi_escaping && SetEscaped(rep)) {
@@ -792,6 +806,21 @@ bool EscapeStatusAnalysis::CheckUsesForEscape(Node* uses, Node* rep,
           return true;
         }
         break;
+      case IrOpcode::kObjectIsCallable:
+      case IrOpcode::kObjectIsNumber:
+      case IrOpcode::kObjectIsReceiver:
+      case IrOpcode::kObjectIsString:
+      case IrOpcode::kObjectIsUndetectable:
+        // The EscapeAnalysisReducer folds these checks if the map of the
+        // allocation is known.
+        if (!(IsAllocation(rep) && EscapeAnalysis::GetAllocationMap(rep)) &&
+            SetEscaped(rep)) {
+          TRACE("Setting #%d (%s) to escaped because of use by #%d (%s)\n",
+                rep->id(), rep->op()->mnemonic(), use->id(),
+                use->op()->mnemonic());
+          return true;
+        }
+        break;
       case IrOpcode::kSelect:
       // TODO(mstarzinger): The following list of operators will eventually be
       // handled by the EscapeAnalysisReducer (similar to ObjectIsSmi).
@@ -802,11 +831,6 @@ bool EscapeStatusAnalysis::CheckUsesForEscape(Node* uses, Node* rep,
       case IrOpcode::kPlainPrimitiveToWord32:
       case IrOpcode::kPlainPrimitiveToFloat64:
       case IrOpcode::kStringCharCodeAt:
-      case IrOpcode::kObjectIsCallable:
-      case IrOpcode::kObjectIsNumber:
-      case IrOpcode::kObjectIsReceiver:
-      case IrOpcode::kObjectIsString:
-      case IrOpcode::kObjectIsUndetectable:
         if (SetEscaped(rep)) {
           TRACE("Setting #%d (%s) to escaped because of use by #%d (%s)\n",
                 rep->id(), rep->op()->mnemonic(), use->id(),
@@ -1338,6 +1362,47 @@ bool EscapeAnalysis::CompareVirtualObjects(Node* left, Node* right) {
 
 namespace {
 
+// Merges the values of all map stores to {object} into {map}. Returns false if
+// one of them is not the same HeapConstant.
+bool CollectMapStores(Node* object, Node** map) {
+  for (Edge edge : object->use_edges()) {
+    Node* use = edge.from();
+    if (use->opcode() != IrOpcode::kStoreField || edge.index() != 0 ||
+        FieldAccessOf(use->op()).offset != HeapObject::kMapOffset) {
+      continue;
+    }
+    Node* value = NodeProperties::GetValueInput(use, 1);
+    if (value->opcode() != IrOpcode::kHeapConstant ||
+        (*map != nullptr && *map != value)) {
+      return false;
+    }
+    *map = value;
+  }
+  return true;
+}
+
+}  // namespace
+
+Node* EscapeAnalysis::GetAllocationMap(Node* node) {
+  if (node->opcode() == IrOpcode::kFinishRegion) {
+    node = NodeProperties::GetValueInput(node, 0);
+  }
+  if (node->opcode() != IrOpcode::kAllocate) return nullptr;
+  // Map stores happen on the allocation inside the region, or on the
+  // FinishRegion after it (e.g. for map transitions).
+  Node* map = nullptr;
+  if (!CollectMapStores(node, &map)) return nullptr;
+  for (Node* use : node->uses()) {
+    if (use->opcode() == IrOpcode::kFinishRegion &&
+        !CollectMapStores(use, &map)) {
+      return nullptr;
+    }
+  }
+  return map;
+}
+
+namespace {
+
 int OffsetForFieldAccess(Node* node) {
   FieldAccess access = FieldAccessOf(node->op());
   DCHECK_EQ(access.offset % kPointerSize, 0);
@@ -35,6 +35,10 @@ class EscapeAnalysis {
   bool IsCyclicObjectState(Node* effect, Node* node);
   bool ExistsVirtualAllocate();
 
+  // Returns the HeapConstant stored as the map of the allocation {node}, or
+  // nullptr if the map is not a single known constant.
+  static Node* GetAllocationMap(Node* node);
+
  private:
   void RunObjectAnalysis();
   bool Process(Node* node);
@@ -321,40 +321,34 @@ Reduction JSBuiltinReducer::ReduceArrayPush(Node* node) {
 
 namespace {
 
-bool HasInstanceTypeWitness(Node* receiver, Node* effect,
-                            InstanceType instance_type) {
+// Returns the CheckMaps node for {receiver} which dominates {effect}, or
+// nullptr if there's no such check.
+Node* FindCheckMapsWitness(Node* receiver, Node* effect) {
   for (Node* dominator = effect;;) {
     if (dominator->opcode() == IrOpcode::kCheckMaps &&
         dominator->InputAt(0) == receiver) {
-      // Check if all maps have the given {instance_type}.
-      for (int i = 1; i < dominator->op()->ValueInputCount(); ++i) {
-        Node* const map = NodeProperties::GetValueInput(dominator, i);
-        Type* const map_type = NodeProperties::GetType(map);
-        if (!map_type->IsHeapConstant()) return false;
-        Handle<Map> const map_value =
-            Handle<Map>::cast(map_type->AsHeapConstant()->Value());
-        if (map_value->instance_type() != instance_type) return false;
-      }
-      return true;
+      return dominator;
     }
     switch (dominator->opcode()) {
       case IrOpcode::kStoreField: {
         FieldAccess const& access = FieldAccessOf(dominator->op());
         if (access.base_is_tagged == kTaggedBase &&
             access.offset == HeapObject::kMapOffset) {
-          return false;
+          return nullptr;
         }
         break;
       }
       case IrOpcode::kStoreElement:
       case IrOpcode::kStoreTypedElement:
+      case IrOpcode::kStoreDataViewElement:
+      case IrOpcode::kAtomicStoreTypedElement:
         break;
       default: {
         DCHECK_EQ(1, dominator->op()->EffectOutputCount());
         if (dominator->op()->EffectInputCount() != 1 ||
             !dominator->op()->HasProperty(Operator::kNoWrite)) {
           // Didn't find any appropriate CheckMaps node.
-          return false;
+          return nullptr;
         }
         break;
       }
@@ -363,6 +357,48 @@ bool HasInstanceTypeWitness(Node* receiver, Node* effect,
   }
 }
 
+bool HasInstanceTypeWitness(Node* receiver, Node* effect,
+                            InstanceType instance_type) {
+  Node* check = FindCheckMapsWitness(receiver, effect);
+  if (check == nullptr) return false;
+  // Check if all maps have the given {instance_type}.
+  for (int i = 1; i < check->op()->ValueInputCount(); ++i) {
+    Node* const map = NodeProperties::GetValueInput(check, i);
+    Type* const map_type = NodeProperties::GetType(map);
+    if (!map_type->IsHeapConstant()) return false;
+    Handle<Map> const map_value =
+        Handle<Map>::cast(map_type->AsHeapConstant()->Value());
+    if (map_value->instance_type() != instance_type) return false;
+  }
+  return true;
+}
+
+// Checks if {receiver} is known to be a JSTypedArray, and if so, whether all
+// its possible maps have the same elements kind, which is returned in
+// {elements_kind}.
+bool HasTypedArrayWitness(Node* receiver, Node* effect,
+                          ElementsKind* elements_kind) {
+  HeapObjectMatcher m(receiver);
+  if (m.HasValue()) {
+    if (!m.Value()->IsJSTypedArray()) return false;
+    *elements_kind = m.Value()->map()->elements_kind();
+    return true;
+  }
+  Node* check = FindCheckMapsWitness(receiver, effect);
+  if (check == nullptr) return false;
+  for (int i = 1; i < check->op()->ValueInputCount(); ++i) {
+    Node* const map = NodeProperties::GetValueInput(check, i);
+    Type* const map_type = NodeProperties::GetType(map);
+    if (!map_type->IsHeapConstant()) return false;
+    Handle<Map> const map_value =
+        Handle<Map>::cast(map_type->AsHeapConstant()->Value());
+    if (map_value->instance_type() != JS_TYPED_ARRAY_TYPE) return false;
+    if (i > 1 && map_value->elements_kind() != *elements_kind) return false;
+    *elements_kind = map_value->elements_kind();
+  }
+  return true;
+}
+
 }  // namespace
 
 // ES6 section 20.3.4.10 Date.prototype.getTime ( )
@@ -1188,6 +1224,202 @@ Reduction JSBuiltinReducer::ReduceArrayBufferViewAccessor(
   return NoChange();
 }
 
+Reduction JSBuiltinReducer::ReduceDataViewAccess(
+    Node* node, DataViewAccess access, ExternalArrayType element_type) {
+  // We need the {value} parameter for stores.
+  int const value_count = node->op()->ValueInputCount();
+  int const little_endian_index = access == DataViewAccess::kGet ? 3 : 4;
+  if (access == DataViewAccess::kSet && value_count < 4) return NoChange();
+  if (!(flags() & kDeoptimizationEnabled)) return NoChange();
+
+  Node* receiver = NodeProperties::GetValueInput(node, 1);
+  Node* offset = value_count > 2 ? NodeProperties::GetValueInput(node, 2)
+                                 : jsgraph()->ZeroConstant();
+  Node* is_little_endian =
+      value_count > little_endian_index
+          ? NodeProperties::GetValueInput(node, little_endian_index)
+          : jsgraph()->FalseConstant();
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  if (!HasInstanceTypeWitness(receiver, effect, JS_DATA_VIEW_TYPE)) {
+    return NoChange();
+  }
+
+  int element_size = 0;
+  switch (element_type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size) \
+  case kExternal##Type##Array:                          \
+    element_size = size;                                \
+    break;
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+
+  // Load the {receiver}s byte length, which is zero if the {receiver}s buffer
+  // was neutered.
+  Node* buffer = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayBufferViewBuffer()),
+      receiver, effect, control);
+  Node* check = effect = graph()->NewNode(
+      simplified()->ArrayBufferWasNeutered(), buffer, effect, control);
+  Node* byte_length = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayBufferViewByteLength()),
+      receiver, effect, control);
+  byte_length = graph()->NewNode(
+      common()->Select(MachineRepresentation::kTagged, BranchHint::kFalse),
+      check, jsgraph()->ZeroConstant(), byte_length);
+  Node* byte_offset = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayBufferViewByteOffset()),
+      receiver, effect, control);
+
+  // Check that the byte length and byte offset are in Smi range, so that
+  // all of the index computations below can be done in word32 arithmetic.
+  byte_length = effect = graph()->NewNode(
+      simplified()->CheckBounds(), byte_length,
+      jsgraph()->Constant(Smi::kMaxValue), effect, control);
+  byte_offset = effect = graph()->NewNode(
+      simplified()->CheckBounds(), byte_offset,
+      jsgraph()->Constant(Smi::kMaxValue), effect, control);
+
+  // Check that the element at {offset} is within the {receiver}s bounds.
+  offset = effect = graph()->NewNode(simplified()->CheckBounds(), offset,
+                                     byte_length, effect, control);
+  if (element_size > 1) {
+    Node* last = graph()->NewNode(simplified()->NumberAdd(), offset,
+                                  jsgraph()->Constant(element_size - 1));
+    effect = graph()->NewNode(simplified()->CheckBounds(), last, byte_length,
+                              effect, control);
+  }
+
+  // Compute the byte index into the backing store of the {buffer}.
+  Node* index =
+      graph()->NewNode(simplified()->NumberAdd(), byte_offset, offset);
+  Node* storage = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayBufferBackingStore()),
+      buffer, effect, control);
+
+  Node* value;
+  if (access == DataViewAccess::kGet) {
+    value = effect = graph()->NewNode(
+        simplified()->LoadDataViewElement(element_type), buffer, storage,
+        index, is_little_endian, effect, control);
+  } else {
+    // Ensure that the {value} is actually a Number.
+    value = effect = graph()->NewNode(simplified()->CheckNumber(),
+                                      NodeProperties::GetValueInput(node, 3),
+                                      effect, control);
+    effect = graph()->NewNode(simplified()->StoreDataViewElement(element_type),
+                              buffer, storage, index, value, is_little_endian,
+                              effect, control);
+    value = jsgraph()->UndefinedConstant();
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
+Reduction JSBuiltinReducer::ReduceAtomicsAccess(Node* node,
+                                                AtomicsAccess access) {
+  // We need the {array} and {index} parameters, and the {value} for stores.
+  int const value_count = node->op()->ValueInputCount();
+  if (value_count < (access == AtomicsAccess::kLoad ? 4 : 5)) {
+    return NoChange();
+  }
+  if (!(flags() & kDeoptimizationEnabled)) return NoChange();
+
+  Node* array = NodeProperties::GetValueInput(node, 2);
+  Node* index = NodeProperties::GetValueInput(node, 3);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  ElementsKind elements_kind;
+  if (!HasTypedArrayWitness(array, effect, &elements_kind)) return NoChange();
+
+  // Only the integer typed arrays other than Uint8ClampedArray are valid
+  // Atomics operands.
+  ExternalArrayType array_type;
+  switch (elements_kind) {
+    case INT8_ELEMENTS:
+      array_type = kExternalInt8Array;
+      break;
+    case UINT8_ELEMENTS:
+      array_type = kExternalUint8Array;
+      break;
+    case INT16_ELEMENTS:
+      array_type = kExternalInt16Array;
+      break;
+    case UINT16_ELEMENTS:
+      array_type = kExternalUint16Array;
+      break;
+    case INT32_ELEMENTS:
+      array_type = kExternalInt32Array;
+      break;
+    case UINT32_ELEMENTS:
+      array_type = kExternalUint32Array;
+      break;
+    default:
+      return NoChange();
+  }
+
+  // The {array} must be backed by a SharedArrayBuffer, which cannot be
+  // neutered. This is known upfront for constant {array}s.
+  Node* buffer = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSArrayBufferViewBuffer()),
+      array, effect, control);
+  HeapObjectMatcher m(array);
+  if (m.HasValue()) {
+    Handle<JSTypedArray> array_value = Handle<JSTypedArray>::cast(m.Value());
+    if (!array_value->GetBuffer()->is_shared()) return NoChange();
+  } else {
+    Node* bit_field = effect = graph()->NewNode(
+        simplified()->LoadField(AccessBuilder::ForJSArrayBufferBitField()),
+        buffer, effect, control);
+    Node* mask = jsgraph()->Constant(JSArrayBuffer::IsShared::kMask);
+    Node* check = graph()->NewNode(
+        simplified()->NumberEqual(),
+        graph()->NewNode(simplified()->NumberBitwiseAnd(), bit_field, mask),
+        mask);
+    effect = graph()->NewNode(simplified()->CheckIf(), check, effect, control);
+  }
+
+  // Check that the {index} is in the valid range for the {array}.
+  Node* length = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSTypedArrayLength()), array,
+      effect, control);
+  index = effect = graph()->NewNode(simplified()->CheckBounds(), index, length,
+                                    effect, control);
+
+  // The elements of typed arrays on a SharedArrayBuffer are never on-heap, so
+  // the external pointer is the address of the first element.
+  Node* elements = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSObjectElements()), array,
+      effect, control);
+  Node* external_pointer = effect = graph()->NewNode(
+      simplified()->LoadField(
+          AccessBuilder::ForFixedTypedArrayBaseExternalPointer()),
+      elements, effect, control);
+
+  Node* value;
+  if (access == AtomicsAccess::kLoad) {
+    value = effect = graph()->NewNode(
+        simplified()->AtomicLoadTypedElement(array_type), buffer,
+        external_pointer, index, effect, control);
+  } else {
+    // Atomics.store returns ToInteger(value), which is the {value} itself
+    // for small integers; anything else goes to the builtin after a deopt.
+    value = NodeProperties::GetValueInput(node, 4);
+    if (!NodeProperties::GetType(value)->Is(Type::Integral32())) {
+      value = effect =
+          graph()->NewNode(simplified()->CheckSmi(), value, effect, control);
+    }
+    effect = graph()->NewNode(
+        simplified()->AtomicStoreTypedElement(array_type), buffer,
+        external_pointer, index, value, effect, control);
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSBuiltinReducer::Reduce(Node* node) {
   Reduction reduction = NoChange();
   JSCallReduction r(node);
@@ -1338,6 +1570,54 @@ Reduction JSBuiltinReducer::Reduce(Node* node) {
       return ReduceArrayBufferViewAccessor(
           node, JS_DATA_VIEW_TYPE,
           AccessBuilder::ForJSArrayBufferViewByteOffset());
+    case kDataViewGetInt8:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalInt8Array);
+    case kDataViewGetUint8:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalUint8Array);
+    case kDataViewGetInt16:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalInt16Array);
+    case kDataViewGetUint16:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalUint16Array);
+    case kDataViewGetInt32:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalInt32Array);
+    case kDataViewGetUint32:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalUint32Array);
+    case kDataViewGetFloat32:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalFloat32Array);
+    case kDataViewGetFloat64:
+      return ReduceDataViewAccess(node, DataViewAccess::kGet,
+                                  kExternalFloat64Array);
+    case kDataViewSetInt8:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalInt8Array);
+    case kDataViewSetUint8:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalUint8Array);
+    case kDataViewSetInt16:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalInt16Array);
+    case kDataViewSetUint16:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalUint16Array);
+    case kDataViewSetInt32:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalInt32Array);
+    case kDataViewSetUint32:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalUint32Array);
+    case kDataViewSetFloat32:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalFloat32Array);
+    case kDataViewSetFloat64:
+      return ReduceDataViewAccess(node, DataViewAccess::kSet,
+                                  kExternalFloat64Array);
     case kTypedArrayByteLength:
       return ReduceArrayBufferViewAccessor(
           node, JS_TYPED_ARRAY_TYPE,
@@ -1349,6 +1629,10 @@ Reduction JSBuiltinReducer::Reduce(Node* node) {
     case kTypedArrayLength:
       return ReduceArrayBufferViewAccessor(
           node, JS_TYPED_ARRAY_TYPE, AccessBuilder::ForJSTypedArrayLength());
+    case kAtomicsLoad:
+      return ReduceAtomicsAccess(node, AtomicsAccess::kLoad);
+    case kAtomicsStore:
+      return ReduceAtomicsAccess(node, AtomicsAccess::kStore);
     default:
       break;
   }
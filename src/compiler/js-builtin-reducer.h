@@ -92,6 +92,13 @@ class JSBuiltinReducer final : public AdvancedReducer {
                                           InstanceType instance_type,
                                           FieldAccess const& access);
 
+  enum class DataViewAccess { kGet, kSet };
+  Reduction ReduceDataViewAccess(Node* node, DataViewAccess access,
+                                 ExternalArrayType element_type);
+
+  enum class AtomicsAccess { kLoad, kStore };
+  Reduction ReduceAtomicsAccess(Node* node, AtomicsAccess access);
+
   Node* ToNumber(Node* value);
   Node* ToUint32(Node* value);
 
@@ -5,8 +5,10 @@
 #include "src/compiler/js-call-reducer.h"
 
 #include "src/compiler/js-graph.h"
+#include "src/compiler/linkage.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/ic/call-optimization.h"
 #include "src/objects-inl.h"
 #include "src/type-feedback-vector-inl.h"
 
@@ -189,6 +191,169 @@ Reduction JSCallReducer::ReduceFunctionPrototypeCall(Node* node) {
   return reduction.Changed() ? reduction : Changed(node);
 }
 
+namespace {
+
+// Returns the map of {value} if {effect} is dominated by a CheckMaps with a
+// single map for it.
+MaybeHandle<Map> GetMapWitness(Node* value, Node* effect) {
+  for (Node* dominator = effect;;) {
+    if (dominator->opcode() == IrOpcode::kCheckMaps &&
+        dominator->InputAt(0) == value) {
+      if (dominator->op()->ValueInputCount() == 2) {
+        HeapObjectMatcher m(dominator->InputAt(1));
+        if (m.HasValue()) return Handle<Map>::cast(m.Value());
+      }
+      return MaybeHandle<Map>();
+    }
+    if (dominator->op()->EffectInputCount() != 1) {
+      // Didn't find any appropriate CheckMaps node.
+      return MaybeHandle<Map>();
+    }
+    dominator = NodeProperties::GetEffectInput(dominator);
+  }
+}
+
+// Checks that objects with {map} keep the pointer passed for a
+// kFastCallWrappedObject in their first internal field.
+bool HasWrappedPointer(Handle<Map> map) {
+  return (map->instance_type() == JS_API_OBJECT_TYPE ||
+          map->instance_type() == JS_SPECIAL_API_OBJECT_TYPE) &&
+         JSObject::GetInternalFieldCount(*map) > 0;
+}
+
+}  // namespace
+
+// Calls the fast C function registered for an API function directly, with the
+// receiver and the arguments converted as described by its signature. Values
+// which don't match the signature deoptimize, so that the regular callback is
+// called by the unoptimized code instead.
+Reduction JSCallReducer::ReduceCallApiFunction(Node* node,
+                                               Handle<JSFunction> function) {
+  DCHECK_EQ(IrOpcode::kJSCallFunction, node->opcode());
+  CallFunctionParameters const& p = CallFunctionParametersOf(node->op());
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  // Not much we can do if deoptimization support is disabled.
+  if (!(flags() & kDeoptimizationEnabled)) return NoChange();
+  if (p.tail_call_mode() == TailCallMode::kAllow) return NoChange();
+
+  CallOptimization call_optimization(function);
+  if (!call_optimization.is_simple_api_call()) return NoChange();
+  Handle<CallHandlerInfo> call_info = call_optimization.api_call_info();
+  if (!call_info->fast_call_target()->IsForeign()) return NoChange();
+  Handle<Foreign> target(Foreign::cast(call_info->fast_call_target()),
+                         isolate());
+  Handle<ByteArray> signature(ByteArray::cast(call_info->fast_call_signature()),
+                              isolate());
+
+  // The signature holds the result type, followed by the types of the
+  // receiver and the arguments, which must all be passed.
+  DCHECK_LE(2u, p.arity());
+  int const parameter_count = signature->length() - 1;
+  if (static_cast<int>(p.arity()) - 1 != parameter_count) return NoChange();
+
+  // Make sure that the receiver is compatible with the signature of the
+  // function template, and that all wrapped objects keep their pointer in an
+  // internal field, before changing the graph.
+  bool const check_receiver =
+      !call_optimization.expected_receiver_type().is_null();
+  for (int i = 0; i < parameter_count; ++i) {
+    Node* value = NodeProperties::GetValueInput(node, i + 1);
+    bool const is_wrapped =
+        signature->get(i + 1) == CallHandlerInfo::kFastCallWrappedObject;
+    if (!is_wrapped && !(i == 0 && check_receiver)) continue;
+    Handle<Map> map;
+    if (!GetMapWitness(value, effect).ToHandle(&map)) return NoChange();
+    if (is_wrapped && !HasWrappedPointer(map)) return NoChange();
+    if (i == 0) {
+      if (map->is_access_check_needed()) return NoChange();
+      CallOptimization::HolderLookup lookup;
+      call_optimization.LookupHolderOfExpectedType(map, &lookup);
+      if (lookup != CallOptimization::kHolderIsReceiver) return NoChange();
+    }
+  }
+
+  // Convert the receiver and the arguments to the C types.
+  int const return_type = signature->get(0);
+  MachineSignature::Builder builder(
+      graph()->zone(), return_type == CallHandlerInfo::kFastCallVoid ? 0 : 1,
+      parameter_count);
+  if (return_type == CallHandlerInfo::kFastCallInt32) {
+    builder.AddReturn(MachineType::Int32());
+  } else if (return_type == CallHandlerInfo::kFastCallBool) {
+    // Only the lowest byte of a bool result is defined.
+    builder.AddReturn(MachineType::Uint32());
+  } else {
+    DCHECK_EQ(CallHandlerInfo::kFastCallVoid, return_type);
+  }
+  int const input_count = parameter_count + 3;
+  Node** inputs = graph()->zone()->NewArray<Node*>(input_count);
+  ApiFunction api_function(target->foreign_address());
+  inputs[0] = jsgraph()->ExternalConstant(ExternalReference(
+      &api_function, ExternalReference::BUILTIN_CALL, isolate()));
+  for (int i = 0; i < parameter_count; ++i) {
+    Node* value = NodeProperties::GetValueInput(node, i + 1);
+    switch (signature->get(i + 1)) {
+      case CallHandlerInfo::kFastCallBool: {
+        value = effect = graph()->NewNode(simplified()->CheckHeapObject(),
+                                          value, effect, control);
+        Node* boolean_map =
+            jsgraph()->HeapConstant(isolate()->factory()->boolean_map());
+        effect = graph()->NewNode(simplified()->CheckMaps(1), value,
+                                  boolean_map, effect, control);
+        value = graph()->NewNode(simplified()->ReferenceEqual(), value,
+                                 jsgraph()->TrueConstant());
+        builder.AddParam(MachineType::Bool());
+        break;
+      }
+      case CallHandlerInfo::kFastCallInt32: {
+        value = effect = graph()->NewNode(simplified()->CheckNumber(), value,
+                                          effect, control);
+        builder.AddParam(MachineType::Int32());
+        break;
+      }
+      case CallHandlerInfo::kFastCallWrappedObject: {
+        Handle<Map> map = GetMapWitness(value, effect).ToHandleChecked();
+        FieldAccess access = {kTaggedBase,
+                              JSObject::GetHeaderSize(map->instance_type()),
+                              MaybeHandle<Name>(),
+                              Type::OtherInternal(),
+                              MachineType::Pointer(),
+                              kNoWriteBarrier};
+        value = effect = graph()->NewNode(simplified()->LoadField(access),
+                                          value, effect, control);
+        builder.AddParam(MachineType::Pointer());
+        break;
+      }
+      default:
+        UNREACHABLE();
+    }
+    inputs[i + 1] = value;
+  }
+  inputs[parameter_count + 1] = effect;
+  inputs[parameter_count + 2] = control;
+  CallDescriptor const* const descriptor =
+      Linkage::GetSimplifiedCDescriptor(graph()->zone(), builder.Build());
+  Node* call = effect = control =
+      graph()->NewNode(common()->Call(descriptor), input_count, inputs);
+
+  // Convert the result back to a JavaScript value.
+  Node* value = jsgraph()->UndefinedConstant();
+  if (return_type == CallHandlerInfo::kFastCallInt32) {
+    value = call;
+  } else if (return_type == CallHandlerInfo::kFastCallBool) {
+    value = graph()->NewNode(simplified()->NumberBitwiseAnd(), call,
+                             jsgraph()->Constant(0xff));
+    value = graph()->NewNode(
+        simplified()->BooleanNot(),
+        graph()->NewNode(simplified()->NumberEqual(), value,
+                         jsgraph()->ZeroConstant()));
+  }
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 
 Reduction JSCallReducer::ReduceJSCallFunction(Node* node) {
   DCHECK_EQ(IrOpcode::kJSCallFunction, node->opcode());
@@ -234,6 +399,11 @@ Reduction JSCallReducer::ReduceJSCallFunction(Node* node) {
       if (*function == function->native_context()->number_function()) {
         return ReduceNumberConstructor(node);
       }
+
+      // Check for API functions with a fast C function.
+      if (shared->IsApiFunction()) {
+        return ReduceCallApiFunction(node, function);
+      }
     } else if (m.Value()->IsJSBoundFunction()) {
       Handle<JSBoundFunction> function =
           Handle<JSBoundFunction>::cast(m.Value());
@@ -6,6 +6,7 @@
 
 #include "src/compilation-info.h"
 #include "src/compiler/common-operator.h"
+#include "src/compiler/js-operator.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/objects-inl.h"
@@ -22,13 +23,25 @@ namespace compiler {
 namespace {
 
 int CollectFunctions(Node* node, Handle<JSFunction>* functions,
-                     int functions_size) {
+                     int functions_size, CompilationInfo* info) {
   DCHECK_NE(0u, functions_size);
   HeapObjectMatcher m(node);
   if (m.HasValue() && m.Value()->IsJSFunction()) {
     functions[0] = Handle<JSFunction>::cast(m.Value());
     return 1;
   }
+  if (m.IsJSCreateClosure()) {
+    // The closure is created in this function, so the actual JSFunction is
+    // not known. Closures for the same SharedFunctionInfo share the literals
+    // (and thus the type feedback) within a native context, so a template
+    // closure in the native context is enough to build the inlinee. The
+    // inliner takes the context from the {node} itself.
+    CreateClosureParameters const& p = CreateClosureParametersOf(m.op());
+    Factory* const factory = info->isolate()->factory();
+    functions[0] = factory->NewFunctionFromSharedFunctionInfo(
+        p.shared_info(), handle(info->context()->native_context()), TENURED);
+    return 1;
+  }
   if (m.IsPhi()) {
     int const value_input_count = m.node()->op()->ValueInputCount();
     if (value_input_count > functions_size) return 0;
@@ -72,8 +85,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   Node* callee = node->InputAt(0);
   Candidate candidate;
   candidate.node = node;
-  candidate.num_functions =
-      CollectFunctions(callee, candidate.functions, kMaxCallPolymorphism);
+  candidate.num_functions = CollectFunctions(
+      callee, candidate.functions, kMaxCallPolymorphism, info_);
   if (candidate.num_functions == 0) {
     return NoChange();
   } else if (candidate.num_functions > 1 && !FLAG_polymorphic_inlining) {
@@ -125,6 +138,17 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
     candidate.frequency = p.frequency();
   }
 
+  // Don't spend the inlining budget on rarely executed call sites.
+  if (mode_ == kGeneralInlining &&
+      candidate.frequency < FLAG_min_inlining_frequency) {
+    TRACE(
+        "Not considering call site #%d:%s, because its frequency %g is "
+        "below %g\n",
+        node->id(), node->op()->mnemonic(), candidate.frequency,
+        FLAG_min_inlining_frequency);
+    return NoChange();
+  }
+
   // Handling of special inlining modes right away:
   //  - For restricted inlining: stop all handling at this point.
   //  - For stressing inlining: immediately handle all functions.
@@ -151,15 +175,25 @@ void JSInliningHeuristic::Finalize() {
   // on things that aren't called very often.
   // TODO(bmeurer): Use std::priority_queue instead of std::set here.
   while (!candidates_.empty()) {
-    if (cumulative_count_ > FLAG_max_inlined_nodes_cumulative) return;
     auto i = candidates_.begin();
     Candidate candidate = *i;
     candidates_.erase(i);
     // Make sure we don't try to inline dead candidate nodes.
-    if (!candidate.node->IsDead()) {
-      Reduction const reduction = InlineCandidate(candidate);
-      if (reduction.Changed()) return;
+    if (candidate.node->IsDead()) continue;
+    // Skip candidates that don't fit into the remaining budget. All targets
+    // of a polymorphic call site are inlined together, so they are accounted
+    // together. Less frequent but smaller candidates may still fit.
+    int const size = CandidateSize(candidate);
+    if (cumulative_count_ + size > FLAG_max_inlined_nodes_cumulative) {
+      TRACE(
+          "Not inlining call site #%d:%s, because its size %d exceeds the "
+          "remaining budget of %d\n",
+          candidate.node->id(), candidate.node->op()->mnemonic(), size,
+          FLAG_max_inlined_nodes_cumulative - cumulative_count_);
+      continue;
     }
+    Reduction const reduction = InlineCandidate(candidate);
+    if (reduction.Changed()) return;
   }
 }
 
@@ -264,6 +298,18 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate) {
   return Replace(value);
 }
 
+// static
+int JSInliningHeuristic::CandidateSize(Candidate const& candidate) {
+  int size = 0;
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    Handle<JSFunction> function = candidate.functions[i];
+    if (CanInlineFunction(function)) {
+      size += function->shared()->ast_node_count();
+    }
+  }
+  return size;
+}
+
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
   if (left.frequency > right.frequency) {
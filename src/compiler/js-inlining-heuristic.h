@@ -18,6 +18,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
                       CompilationInfo* info, JSGraph* jsgraph)
       : AdvancedReducer(editor),
         mode_(mode),
+        info_(info),
         inliner_(editor, local_zone, info, jsgraph),
         candidates_(local_zone),
         seen_(local_zone),
@@ -49,6 +50,9 @@ class JSInliningHeuristic final : public AdvancedReducer {
   // Candidates are kept in a sorted set of unique candidates.
   typedef ZoneSet<Candidate, CandidateCompare> Candidates;
 
+  // Returns the number of AST nodes that inlining {candidate} would add.
+  static int CandidateSize(Candidate const& candidate);
+
   // Dumps candidates to console.
   void PrintCandidates();
   Reduction InlineCandidate(Candidate const& candidate);
@@ -59,6 +63,7 @@ class JSInliningHeuristic final : public AdvancedReducer {
   SimplifiedOperatorBuilder* simplified() const;
 
   Mode const mode_;
+  CompilationInfo* const info_;
   JSInliner inliner_;
   Candidates candidates_;
   ZoneSet<NodeId> seen_;
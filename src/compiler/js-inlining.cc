@@ -8,6 +8,7 @@
 #include "src/ast/ast.h"
 #include "src/compilation-info.h"
 #include "src/compiler.h"
+#include "src/compiler/access-builder.h"
 #include "src/compiler/all-nodes.h"
 #include "src/compiler/ast-graph-builder.h"
 #include "src/compiler/ast-loop-assignment-analyzer.h"
@@ -317,6 +318,8 @@ bool NeedsConvertReceiver(Node* receiver, Node* effect) {
       }
       case IrOpcode::kStoreElement:
       case IrOpcode::kStoreTypedElement:
+      case IrOpcode::kStoreDataViewElement:
+      case IrOpcode::kAtomicStoreTypedElement:
         break;
       default: {
         DCHECK_EQ(1, dominator->op()->EffectOutputCount());
@@ -627,11 +630,31 @@ Reduction JSInliner::ReduceJSCall(Node* node, Handle<JSFunction> function) {
         FrameStateType::kConstructStub, info.shared_info());
   }
 
-  // The inlinee specializes to the context from the JSFunction object.
+  // The inlinee specializes to the context from the JSFunction object, unless
+  // the target is created by a JSCreateClosure in this function, in which case
+  // the {function} is only a template and the context is the one that would
+  // be stored into the new closure. This way neither the closure nor the
+  // context has to escape when the call is the only use of the closure.
   // TODO(turbofan): We might want to load the context from the JSFunction at
   // runtime in case we only know the SharedFunctionInfo once we have dynamic
   // type feedback in the compiler.
-  Node* context = jsgraph()->Constant(handle(function->context()));
+  Node* context;
+  if (call.target()->opcode() == IrOpcode::kJSCreateClosure) {
+    context = NodeProperties::GetContextInput(call.target());
+    // The new closure only gets its literals once it is called for the first
+    // time, but a deoptimization in the inlinee materializes a frame for it
+    // before that, so install the literals shared by all closures for the
+    // {shared_info} ahead of the call.
+    Node* effect = NodeProperties::GetEffectInput(node);
+    Node* control = NodeProperties::GetControlInput(node);
+    effect = graph()->NewNode(
+        simplified()->StoreField(AccessBuilder::ForJSFunctionLiterals()),
+        call.target(), jsgraph()->HeapConstant(handle(function->literals())),
+        effect, control);
+    NodeProperties::ReplaceEffectInput(node, effect);
+  } else {
+    context = jsgraph()->Constant(handle(function->context()));
+  }
 
   // Insert a JSConvertReceiver node for sloppy callees. Note that the context
   // passed into this node has to be the callees context (loaded above). Note
@@ -30,6 +30,8 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
       Runtime::FunctionForId(CallRuntimeParametersOf(node->op()).id());
   if (f->intrinsic_type != Runtime::IntrinsicType::INLINE) return NoChange();
   switch (f->function_id) {
+    case Runtime::kInlineArrayIteratorProtector:
+      return ReduceArrayIteratorProtector(node);
     case Runtime::kInlineCreateIterResultObject:
       return ReduceCreateIterResultObject(node);
     case Runtime::kInlineDeoptimizeNow:
@@ -87,6 +89,22 @@ Reduction JSIntrinsicLowering::Reduce(Node* node) {
 }
 
 
+Reduction JSIntrinsicLowering::ReduceArrayIteratorProtector(Node* node) {
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  Node* const cell =
+      jsgraph()->HeapConstant(isolate()->factory()->array_iterator_protector());
+  Node* const protector = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForCellValue()), cell, effect,
+      control);
+
+  // Replace all effect uses of {node} with the {protector} load.
+  ReplaceWithValue(node, node, protector);
+  return Change(node, simplified()->ReferenceEqual(), protector,
+                jsgraph()->Constant(Isolate::kArrayProtectorValid));
+}
+
+
 Reduction JSIntrinsicLowering::ReduceCreateIterResultObject(Node* node) {
   Node* const value = NodeProperties::GetValueInput(node, 0);
   Node* const done = NodeProperties::GetValueInput(node, 1);
@@ -14,7 +14,9 @@
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/type-cache.h"
+#include "src/fast-accessor-assembler.h"
 #include "src/field-index-inl.h"
+#include "src/ic/call-optimization.h"
 #include "src/isolate-inl.h"
 #include "src/type-feedback-vector.h"
 
@@ -53,6 +55,32 @@ bool HasOnlyStringMaps(T const& maps) {
   return true;
 }
 
+// Returns the FastAccessorAssembler program of the API function {getter}, if
+// it can be inlined for receivers with the {receiver_maps}.
+MaybeHandle<FixedArray> GetInlineableFastAccessorProgram(
+    Handle<Object> getter, MapList const& receiver_maps) {
+  CallOptimization call_optimization(getter);
+  if (!call_optimization.is_simple_api_call()) {
+    return MaybeHandle<FixedArray>();
+  }
+  Object* program = call_optimization.api_call_info()->fast_handler_program();
+  if (!program->IsFixedArray() ||
+      !FastAccessorAssembler::IsInlineable(FixedArray::cast(program))) {
+    return MaybeHandle<FixedArray>();
+  }
+  // The program uses the receiver as the holder, so the receivers must be
+  // compatible with the signature of the getter themselves.
+  for (auto map : receiver_maps) {
+    if (map->is_access_check_needed()) return MaybeHandle<FixedArray>();
+    CallOptimization::HolderLookup lookup;
+    call_optimization.LookupHolderOfExpectedType(map, &lookup);
+    if (lookup != CallOptimization::kHolderIsReceiver) {
+      return MaybeHandle<FixedArray>();
+    }
+  }
+  return handle(FixedArray::cast(program));
+}
+
 }  // namespace
 
 JSNativeContextSpecialization::JSNativeContextSpecialization(
@@ -794,6 +822,7 @@ JSNativeContextSpecialization::BuildPropertyAccess(
   }
 
   // Generate the actual property access.
+  Handle<FixedArray> program;
   if (access_info.IsNotFound()) {
     DCHECK_EQ(AccessMode::kLoad, access_mode);
     value = jsgraph()->UndefinedConstant();
@@ -805,6 +834,15 @@ JSNativeContextSpecialization::BuildPropertyAccess(
       effect =
           graph()->NewNode(simplified()->CheckIf(), check, effect, control);
     }
+  } else if (access_info.IsAccessorConstant() &&
+             access_mode == AccessMode::kLoad &&
+             GetInlineableFastAccessorProgram(access_info.constant(),
+                                              access_info.receiver_maps())
+                 .ToHandle(&program)) {
+    // Inline the program of the fast accessor, which neither calls out nor
+    // throws. The {receiver} maps have been checked above.
+    value = effect = graph()->NewNode(simplified()->LoadFastAccessor(program),
+                                      receiver, effect, control);
   } else if (access_info.IsAccessorConstant()) {
     // TODO(bmeurer): Properly rewire the IfException edge here if there's any.
     Node* target = jsgraph()->Constant(access_info.constant());
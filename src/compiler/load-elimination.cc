@@ -111,6 +111,7 @@ Reduction LoadElimination::Reduce(Node* node) {
     case IrOpcode::kStoreElement:
       return ReduceStoreElement(node);
     case IrOpcode::kStoreTypedElement:
+    case IrOpcode::kStoreDataViewElement:
       return ReduceStoreTypedElement(node);
     case IrOpcode::kEffectPhi:
       return ReduceEffectPhi(node);
@@ -867,7 +868,8 @@ LoadElimination::AbstractState const* LoadElimination::ComputeLoopState(
             break;
           }
           case IrOpcode::kStoreBuffer:
-          case IrOpcode::kStoreTypedElement: {
+          case IrOpcode::kStoreTypedElement:
+          case IrOpcode::kStoreDataViewElement: {
             // Doesn't affect anything we track with the state currently.
             break;
           }
@@ -301,20 +301,28 @@
   V(LoadBuffer)                     \
   V(LoadElement)                    \
   V(LoadTypedElement)               \
+  V(LoadDataViewElement)            \
   V(StoreField)                     \
   V(StoreBuffer)                    \
   V(StoreElement)                   \
   V(StoreTypedElement)              \
+  V(StoreDataViewElement)           \
+  V(AtomicLoadTypedElement)         \
+  V(AtomicStoreTypedElement)        \
   V(ObjectIsCallable)               \
   V(ObjectIsNumber)                 \
   V(ObjectIsReceiver)               \
   V(ObjectIsSmi)                    \
   V(ObjectIsString)                 \
   V(ObjectIsUndetectable)           \
+  V(ArgumentsFrame)                 \
+  V(ArgumentsLength)                \
+  V(NewUnmappedArgumentsElements)   \
   V(ArrayBufferWasNeutered)         \
   V(EnsureWritableFastElements)     \
   V(MaybeGrowFastElements)          \
-  V(TransitionElementsKind)
+  V(TransitionElementsKind)         \
+  V(LoadFastAccessor)
 
 #define SIMPLIFIED_OP_LIST(V)                 \
   SIMPLIFIED_CHANGE_OP_LIST(V)                \
@@ -246,6 +246,11 @@ struct OpEqualTo<Handle<ScopeInfo>> : public Handle<ScopeInfo>::equal_to {};
 template <>
 struct OpHash<Handle<ScopeInfo>> : public Handle<ScopeInfo>::hash {};
 
+template <>
+struct OpEqualTo<Handle<FixedArray>> : public Handle<FixedArray>::equal_to {};
+template <>
+struct OpHash<Handle<FixedArray>> : public Handle<FixedArray>::hash {};
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -58,6 +58,7 @@ PipelineStatistics::PipelineStatistics(CompilationInfo* info,
         info->shared_info()->DebugName()->ToCString();
     function_name_ = name.get();
   }
+  compilation_stats_->BeginJob();
   total_stats_.Begin(this);
 }
 
@@ -67,6 +68,7 @@ PipelineStatistics::~PipelineStatistics() {
   CompilationStatistics::BasicStats diff;
   total_stats_.End(this, &diff);
   compilation_stats_->RecordTotalStats(source_size_, diff);
+  compilation_stats_->EndJob();
 }
 
 
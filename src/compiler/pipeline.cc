@@ -115,7 +115,9 @@ class PipelineData {
 
   // For WASM compile entry point.
   PipelineData(ZoneStats* zone_stats, CompilationInfo* info, Graph* graph,
-               SourcePositionTable* source_positions)
+               SourcePositionTable* source_positions,
+               ZoneVector<trap_handler::ProtectedInstructionData>*
+                   protected_instructions)
       : isolate_(info->isolate()),
         info_(info),
         debug_name_(info_->GetDebugName()),
@@ -126,7 +128,8 @@ class PipelineData {
         instruction_zone_scope_(zone_stats_),
         instruction_zone_(instruction_zone_scope_.zone()),
         register_allocation_zone_scope_(zone_stats_),
-        register_allocation_zone_(register_allocation_zone_scope_.zone()) {}
+        register_allocation_zone_(register_allocation_zone_scope_.zone()),
+        protected_instructions_(protected_instructions) {}
 
   // For machine graph testing entry point.
   PipelineData(ZoneStats* zone_stats, CompilationInfo* info, Graph* graph,
@@ -182,6 +185,10 @@ class PipelineData {
   Zone* graph_zone() const { return graph_zone_; }
   Graph* graph() const { return graph_; }
   SourcePositionTable* source_positions() const { return source_positions_; }
+  ZoneVector<trap_handler::ProtectedInstructionData>* protected_instructions()
+      const {
+    return protected_instructions_;
+  }
   MachineOperatorBuilder* machine() const { return machine_; }
   CommonOperatorBuilder* common() const { return common_; }
   JSOperatorBuilder* javascript() const { return javascript_; }
@@ -355,6 +362,10 @@ class PipelineData {
   // Source position output for --trace-turbo.
   std::string source_position_output_;
 
+  // The protected instructions of wasm code, owned by the compilation unit.
+  ZoneVector<trap_handler::ProtectedInstructionData>* protected_instructions_ =
+      nullptr;
+
   int CalculateFixedFrameSize(CallDescriptor* descriptor) {
     if (descriptor->IsJSFunctionCall()) {
       return StandardFrameConstants::kFixedSlotCount;
@@ -531,7 +542,7 @@ PipelineStatistics* CreatePipelineStatistics(CompilationInfo* info,
                                              ZoneStats* zone_stats) {
   PipelineStatistics* pipeline_statistics = nullptr;
 
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (info->isolate()->ShouldRecordTurboStatistics()) {
     pipeline_statistics = new PipelineStatistics(info, zone_stats);
     pipeline_statistics->BeginPhaseKind("initializing");
   }
@@ -560,6 +571,47 @@ PipelineStatistics* CreatePipelineStatistics(CompilationInfo* info,
   return pipeline_statistics;
 }
 
+// Prints the number of spill slots and of the gap moves which remain after
+// register allocation, with the moves inside of loops counted separately
+// since those are the ones that matter for hot code.
+void PrintRegisterAllocationStatistics(Isolate* isolate,
+                                       const char* debug_name,
+                                       const InstructionSequence* code,
+                                       const Frame* frame) {
+  int moves = 0, loop_moves = 0;
+  int stack_moves = 0, loop_stack_moves = 0;
+  for (const InstructionBlock* block : code->instruction_blocks()) {
+    bool in_loop = block->IsLoopHeader() || block->loop_header().IsValid();
+    for (int i = block->code_start(); i < block->code_end(); ++i) {
+      const Instruction* instr = code->InstructionAt(i);
+      for (int pos = Instruction::FIRST_GAP_POSITION;
+           pos <= Instruction::LAST_GAP_POSITION; ++pos) {
+        const ParallelMove* parallel_move =
+            instr->GetParallelMove(static_cast<Instruction::GapPosition>(pos));
+        if (parallel_move == nullptr) continue;
+        for (const MoveOperands* move : *parallel_move) {
+          if (move->IsRedundant()) continue;
+          bool is_stack_move =
+              move->source().IsAnyStackSlot() ||
+              move->destination().IsAnyStackSlot();
+          moves++;
+          if (is_stack_move) stack_moves++;
+          if (in_loop) {
+            loop_moves++;
+            if (is_stack_move) loop_stack_moves++;
+          }
+        }
+      }
+    }
+  }
+  CodeTracer::Scope tracing_scope(isolate->GetCodeTracer());
+  OFStream os(tracing_scope.file());
+  os << "Register allocation for " << debug_name << ": "
+     << frame->GetSpillSlotCount() << " spill slots, " << moves
+     << " gap moves (" << loop_moves << " in loops), " << stack_moves
+     << " stack moves (" << loop_stack_moves << " in loops)" << std::endl;
+}
+
 }  // namespace
 
 class PipelineCompilationJob final : public CompilationJob {
@@ -654,13 +706,16 @@ PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl() {
 
 class PipelineWasmCompilationJob final : public CompilationJob {
  public:
-  explicit PipelineWasmCompilationJob(CompilationInfo* info, Graph* graph,
-                                      CallDescriptor* descriptor,
-                                      SourcePositionTable* source_positions)
+  explicit PipelineWasmCompilationJob(
+      CompilationInfo* info, Graph* graph, CallDescriptor* descriptor,
+      SourcePositionTable* source_positions,
+      ZoneVector<trap_handler::ProtectedInstructionData>*
+          protected_instructions)
       : CompilationJob(info->isolate(), info, "TurboFan",
                        State::kReadyToExecute),
         zone_stats_(info->isolate()->allocator()),
-        data_(&zone_stats_, info, graph, source_positions),
+        data_(&zone_stats_, info, graph, source_positions,
+              protected_instructions),
         pipeline_(&data_),
         linkage_(descriptor) {}
 
@@ -1438,8 +1493,9 @@ struct GenerateCodePhase {
 
   void Run(PipelineData* data, Zone* temp_zone, Linkage* linkage) {
     CodeGenerator generator(data->frame(), linkage, data->sequence(),
-                            data->info());
-    data->set_code(generator.GenerateCode());
+                            data->info(), data->protected_instructions());
+    generator.AssembleCode();
+    data->set_code(generator.FinalizeCode());
   }
 };
 
@@ -1669,7 +1725,7 @@ Handle<Code> Pipeline::GenerateCodeForCodeStub(Isolate* isolate,
   ZoneStats zone_stats(isolate->allocator());
   PipelineData data(&zone_stats, &info, graph, schedule);
   std::unique_ptr<PipelineStatistics> pipeline_statistics;
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (isolate->ShouldRecordTurboStatistics()) {
     pipeline_statistics.reset(new PipelineStatistics(&info, &zone_stats));
     pipeline_statistics->BeginPhaseKind("stub codegen");
   }
@@ -1723,7 +1779,7 @@ Handle<Code> Pipeline::GenerateCodeForTesting(CompilationInfo* info,
   ZoneStats zone_stats(info->isolate()->allocator());
   PipelineData data(&zone_stats, info, graph, schedule);
   std::unique_ptr<PipelineStatistics> pipeline_statistics;
-  if (FLAG_turbo_stats || FLAG_turbo_stats_nvp) {
+  if (info->isolate()->ShouldRecordTurboStatistics()) {
     pipeline_statistics.reset(new PipelineStatistics(info, &zone_stats));
     pipeline_statistics->BeginPhaseKind("test codegen");
   }
@@ -1749,9 +1805,12 @@ CompilationJob* Pipeline::NewCompilationJob(Handle<JSFunction> function) {
 // static
 CompilationJob* Pipeline::NewWasmCompilationJob(
     CompilationInfo* info, Graph* graph, CallDescriptor* descriptor,
-    SourcePositionTable* source_positions) {
+    SourcePositionTable* source_positions,
+    ZoneVector<trap_handler::ProtectedInstructionData>*
+        protected_instructions) {
   return new PipelineWasmCompilationJob(info, graph, descriptor,
-                                        source_positions);
+                                        source_positions,
+                                        protected_instructions);
 }
 
 bool Pipeline::AllocateRegistersForTesting(const RegisterConfiguration* config,
@@ -1832,7 +1891,7 @@ bool PipelineImpl::ScheduleAndSelectInstructions(Linkage* linkage) {
   bool generate_frame_at_start =
       data_->sequence()->instruction_blocks().front()->must_construct_frame();
   // Optimimize jumps.
-  if (FLAG_turbo_jt) {
+  if (FLAG_turbo_jt && !info()->is_fast_compilation()) {
     Run<JumpThreadingPhase>(generate_frame_at_start);
   }
 
@@ -1940,14 +1999,16 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
               ->RangesDefinedInDeferredStayInDeferred());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  bool preprocess_ranges =
+      FLAG_turbo_preprocess_ranges && !info()->is_fast_compilation();
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
   }
 
   Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
   Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -1957,12 +2018,18 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<PopulateReferenceMapsPhase>();
   Run<ConnectRangesPhase>();
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !info()->is_fast_compilation()) {
     Run<OptimizeMovesPhase>();
   }
 
   Run<LocateSpillSlotsPhase>();
 
+  if (FLAG_trace_turbo_alloc_stats) {
+    AllowHandleDereference allow_deref;
+    PrintRegisterAllocationStatistics(isolate(), info()->GetDebugName().get(),
+                                      data->sequence(), data->frame());
+  }
+
   if (FLAG_trace_turbo_graph) {
     AllowHandleDereference allow_deref;
     CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
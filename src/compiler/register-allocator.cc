@@ -2707,20 +2707,20 @@ void LinearScanAllocator::AddToUnhandledSorted(LiveRange* range) {
   if (range == nullptr || range->IsEmpty()) return;
   DCHECK(!range->HasRegisterAssigned() && !range->spilled());
   DCHECK(allocation_finger_ <= range->Start());
-  for (int i = static_cast<int>(unhandled_live_ranges().size() - 1); i >= 0;
-       --i) {
-    LiveRange* cur_range = unhandled_live_ranges().at(i);
-    if (!range->ShouldBeAllocatedBefore(cur_range)) continue;
-    TRACE("Add live range %d:%d to unhandled at %d\n",
-          range->TopLevel()->vreg(), range->relative_id(), i + 1);
-    auto it = unhandled_live_ranges().begin() + (i + 1);
-    unhandled_live_ranges().insert(it, range);
-    DCHECK(UnhandledIsSorted());
-    return;
-  }
-  TRACE("Add live range %d:%d to unhandled at start\n",
-        range->TopLevel()->vreg(), range->relative_id());
-  unhandled_live_ranges().insert(unhandled_live_ranges().begin(), range);
+  // The unhandled ranges are sorted so that the ranges to be allocated last
+  // come first, hence {range} goes right after the last range that it should
+  // be allocated before. Split tails are added here for every spill, so use
+  // a binary search instead of scanning what can be thousands of ranges in
+  // large functions.
+  auto it = std::partition_point(
+      unhandled_live_ranges().begin(), unhandled_live_ranges().end(),
+      [range](LiveRange* cur_range) {
+        return range->ShouldBeAllocatedBefore(cur_range);
+      });
+  TRACE("Add live range %d:%d to unhandled at %d\n", range->TopLevel()->vreg(),
+        range->relative_id(),
+        static_cast<int>(it - unhandled_live_ranges().begin()));
+  unhandled_live_ranges().insert(it, range);
   DCHECK(UnhandledIsSorted());
 }
 
@@ -8,6 +8,7 @@
 #include "src/compiler/opcodes.h"
 #include "src/compiler/operator.h"
 #include "src/compiler/types.h"
+#include "src/handles-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -183,7 +184,11 @@ const ElementAccess& ElementAccessOf(const Operator* op) {
 
 ExternalArrayType ExternalArrayTypeOf(const Operator* op) {
   DCHECK(op->opcode() == IrOpcode::kLoadTypedElement ||
-         op->opcode() == IrOpcode::kStoreTypedElement);
+         op->opcode() == IrOpcode::kStoreTypedElement ||
+         op->opcode() == IrOpcode::kLoadDataViewElement ||
+         op->opcode() == IrOpcode::kStoreDataViewElement ||
+         op->opcode() == IrOpcode::kAtomicLoadTypedElement ||
+         op->opcode() == IrOpcode::kAtomicStoreTypedElement);
   return OpParameter<ExternalArrayType>(op);
 }
 
@@ -294,6 +299,38 @@ ElementsTransition ElementsTransitionOf(const Operator* op) {
   return OpParameter<ElementsTransition>(op);
 }
 
+Handle<FixedArray> FastAccessorProgramOf(const Operator* op) {
+  DCHECK_EQ(IrOpcode::kLoadFastAccessor, op->opcode());
+  return OpParameter<Handle<FixedArray>>(op);
+}
+
+bool operator==(ArgumentsLengthParameters const& lhs,
+                ArgumentsLengthParameters const& rhs) {
+  return lhs.formal_parameter_count() == rhs.formal_parameter_count() &&
+         lhs.is_rest_length() == rhs.is_rest_length();
+}
+
+bool operator!=(ArgumentsLengthParameters const& lhs,
+                ArgumentsLengthParameters const& rhs) {
+  return !(lhs == rhs);
+}
+
+size_t hash_value(ArgumentsLengthParameters const& p) {
+  return base::hash_combine(p.formal_parameter_count(), p.is_rest_length());
+}
+
+std::ostream& operator<<(std::ostream& os, ArgumentsLengthParameters const& p) {
+  os << p.formal_parameter_count();
+  if (p.is_rest_length()) os << ", rest length";
+  return os;
+}
+
+ArgumentsLengthParameters const& ArgumentsLengthParametersOf(
+    const Operator* op) {
+  DCHECK_EQ(IrOpcode::kArgumentsLength, op->opcode());
+  return OpParameter<ArgumentsLengthParameters>(op);
+}
+
 std::ostream& operator<<(std::ostream& os, NumberOperationHint hint) {
   switch (hint) {
     case NumberOperationHint::kSignedSmall:
@@ -492,6 +529,21 @@ struct SimplifiedOperatorGlobalCache final {
   };
   ArrayBufferWasNeuteredOperator kArrayBufferWasNeutered;
 
+  struct ArgumentsFrameOperator final : public Operator {
+    ArgumentsFrameOperator()
+        : Operator(IrOpcode::kArgumentsFrame, Operator::kPure, "ArgumentsFrame",
+                   0, 0, 0, 1, 0, 0) {}
+  };
+  ArgumentsFrameOperator kArgumentsFrame;
+
+  struct NewUnmappedArgumentsElementsOperator final : public Operator {
+    NewUnmappedArgumentsElementsOperator()
+        : Operator(IrOpcode::kNewUnmappedArgumentsElements,
+                   Operator::kEliminatable, "NewUnmappedArgumentsElements", 2,
+                   1, 0, 1, 1, 0) {}
+  };
+  NewUnmappedArgumentsElementsOperator kNewUnmappedArgumentsElements;
+
   template <CheckForMinusZeroMode kMode>
   struct CheckedInt32MulOperator final
       : public Operator1<CheckForMinusZeroMode> {
@@ -636,6 +688,8 @@ SimplifiedOperatorBuilder::SimplifiedOperatorBuilder(Zone* zone)
 PURE_OP_LIST(GET_FROM_CACHE)
 CHECKED_OP_LIST(GET_FROM_CACHE)
 GET_FROM_CACHE(ArrayBufferWasNeutered)
+GET_FROM_CACHE(ArgumentsFrame)
+GET_FROM_CACHE(NewUnmappedArgumentsElements)
 #undef GET_FROM_CACHE
 
 const Operator* SimplifiedOperatorBuilder::CheckedInt32Mul(
@@ -710,6 +764,17 @@ const Operator* SimplifiedOperatorBuilder::CheckFloat64Hole(
   return nullptr;
 }
 
+const Operator* SimplifiedOperatorBuilder::ArgumentsLength(
+    int formal_parameter_count, bool is_rest_length) {
+  return new (zone()) Operator1<ArgumentsLengthParameters>(  // --
+      IrOpcode::kArgumentsLength,                            // opcode
+      Operator::kPure,                                       // flags
+      "ArgumentsLength",                                     // name
+      1, 0, 0, 1, 0, 0,                                      // counts
+      ArgumentsLengthParameters(formal_parameter_count,
+                                is_rest_length));  // parameter
+}
+
 const Operator* SimplifiedOperatorBuilder::EnsureWritableFastElements() {
   return &cache_.kEnsureWritableFastElements;
 }
@@ -734,6 +799,17 @@ const Operator* SimplifiedOperatorBuilder::TransitionElementsKind(
       transition);                                    // parameter
 }
 
+const Operator* SimplifiedOperatorBuilder::LoadFastAccessor(
+    Handle<FixedArray> program) {
+  return new (zone()) Operator1<Handle<FixedArray>>(  // --
+      IrOpcode::kLoadFastAccessor,                    // opcode
+      Operator::kNoDeopt | Operator::kNoThrow |       // flags
+          Operator::kNoWrite,                         // flags
+      "LoadFastAccessor",                             // name
+      1, 1, 1, 1, 1, 0,                               // counts
+      program);                                       // parameter
+}
+
 const Operator* SimplifiedOperatorBuilder::Allocate(PretenureFlag pretenure) {
   switch (pretenure) {
     case NOT_TENURED:
@@ -801,13 +877,21 @@ const Operator* SimplifiedOperatorBuilder::StringFromCodePoint(
 SPECULATIVE_NUMBER_BINOP_LIST(SPECULATIVE_NUMBER_BINOP)
 #undef SPECULATIVE_NUMBER_BINOP
 
-#define ACCESS_OP_LIST(V)                                             \
-  V(LoadField, FieldAccess, Operator::kNoWrite, 1, 1, 1)              \
-  V(StoreField, FieldAccess, Operator::kNoRead, 2, 1, 0)              \
-  V(LoadElement, ElementAccess, Operator::kNoWrite, 2, 1, 1)          \
-  V(StoreElement, ElementAccess, Operator::kNoRead, 3, 1, 0)          \
-  V(LoadTypedElement, ExternalArrayType, Operator::kNoWrite, 4, 1, 1) \
-  V(StoreTypedElement, ExternalArrayType, Operator::kNoRead, 5, 1, 0)
+// The atomic accesses are sequentially consistent, so they neither read nor
+// write only; nothing may be moved across them or eliminated around them.
+#define ACCESS_OP_LIST(V)                                                      \
+  V(LoadField, FieldAccess, Operator::kNoWrite, 1, 1, 1)                       \
+  V(StoreField, FieldAccess, Operator::kNoRead, 2, 1, 0)                       \
+  V(LoadElement, ElementAccess, Operator::kNoWrite, 2, 1, 1)                   \
+  V(StoreElement, ElementAccess, Operator::kNoRead, 3, 1, 0)                   \
+  V(LoadTypedElement, ExternalArrayType, Operator::kNoWrite, 4, 1, 1)          \
+  V(StoreTypedElement, ExternalArrayType, Operator::kNoRead, 5, 1, 0)          \
+  V(LoadDataViewElement, ExternalArrayType, Operator::kNoWrite, 4, 1, 1)       \
+  V(StoreDataViewElement, ExternalArrayType, Operator::kNoRead, 5, 1, 0)       \
+  V(AtomicLoadTypedElement, ExternalArrayType, Operator::kNoProperties, 3, 1,  \
+    1)                                                                         \
+  V(AtomicStoreTypedElement, ExternalArrayType, Operator::kNoProperties, 4, 1, \
+    0)
 
 #define ACCESS(Name, Type, properties, value_input_count, control_input_count, \
                output_count)                                                   \
@@ -168,6 +168,37 @@ std::ostream& operator<<(std::ostream&, ElementsTransition);
 
 ElementsTransition ElementsTransitionOf(const Operator* op) WARN_UNUSED_RESULT;
 
+// The FastAccessorAssembler program inlined by a LoadFastAccessor.
+Handle<FixedArray> FastAccessorProgramOf(const Operator* op)
+    WARN_UNUSED_RESULT;
+
+// A descriptor for the number of (rest) parameters of the outermost frame.
+class ArgumentsLengthParameters final {
+ public:
+  ArgumentsLengthParameters(int formal_parameter_count, bool is_rest_length)
+      : formal_parameter_count_(formal_parameter_count),
+        is_rest_length_(is_rest_length) {}
+
+  int formal_parameter_count() const { return formal_parameter_count_; }
+  bool is_rest_length() const { return is_rest_length_; }
+
+ private:
+  int const formal_parameter_count_;
+  bool const is_rest_length_;
+};
+
+bool operator==(ArgumentsLengthParameters const&,
+                ArgumentsLengthParameters const&);
+bool operator!=(ArgumentsLengthParameters const&,
+                ArgumentsLengthParameters const&);
+
+size_t hash_value(ArgumentsLengthParameters const&);
+
+std::ostream& operator<<(std::ostream&, ArgumentsLengthParameters const&);
+
+ArgumentsLengthParameters const& ArgumentsLengthParametersOf(
+    const Operator* op) WARN_UNUSED_RESULT;
+
 // A hint for speculative number operations.
 enum class NumberOperationHint : uint8_t {
   kSignedSmall,      // Inputs were always Smi so far, output was in Smi range.
@@ -351,6 +382,16 @@ class SimplifiedOperatorBuilder final : public ZoneObject {
   // array-buffer-was-neutered buffer
   const Operator* ArrayBufferWasNeutered();
 
+  // arguments-frame
+  const Operator* ArgumentsFrame();
+
+  // arguments-length arguments-frame
+  const Operator* ArgumentsLength(int formal_parameter_count,
+                                  bool is_rest_length);
+
+  // new-unmapped-arguments-elements arguments-frame, arguments-length
+  const Operator* NewUnmappedArgumentsElements();
+
   // ensure-writable-fast-elements object, elements
   const Operator* EnsureWritableFastElements();
 
@@ -360,6 +401,9 @@ class SimplifiedOperatorBuilder final : public ZoneObject {
   // transition-elements-kind object, from-map, to-map
   const Operator* TransitionElementsKind(ElementsTransition transition);
 
+  // load-fast-accessor receiver
+  const Operator* LoadFastAccessor(Handle<FixedArray> program);
+
   const Operator* Allocate(PretenureFlag pretenure = NOT_TENURED);
 
   const Operator* LoadField(FieldAccess const&);
@@ -383,6 +427,18 @@ class SimplifiedOperatorBuilder final : public ZoneObject {
   // store-typed-element buffer, [base + external + index], value
   const Operator* StoreTypedElement(ExternalArrayType const&);
 
+  // load-data-view-element buffer, [storage + index], is_little_endian
+  const Operator* LoadDataViewElement(ExternalArrayType const&);
+
+  // store-data-view-element buffer, [storage + index], value, is_little_endian
+  const Operator* StoreDataViewElement(ExternalArrayType const&);
+
+  // atomic-load-typed-element buffer, [external + index]
+  const Operator* AtomicLoadTypedElement(ExternalArrayType const&);
+
+  // atomic-store-typed-element buffer, [external + index], value
+  const Operator* AtomicStoreTypedElement(ExternalArrayType const&);
+
  private:
   Zone* zone() const { return zone_; }
 
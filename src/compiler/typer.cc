@@ -11,6 +11,7 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/js-operator.h"
+#include "src/compiler/linkage.h"
 #include "src/compiler/loop-variable-optimizer.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/node.h"
@@ -757,6 +758,10 @@ Type* Typer::Visitor::TypeLoopExitEffect(Node* node) {
   return nullptr;
 }
 
+Type* Typer::Visitor::TypeLoadFastAccessor(Node* node) {
+  return Type::NonInternal();
+}
+
 Type* Typer::Visitor::TypeEnsureWritableFastElements(Node* node) {
   return Operand(node, 1);
 }
@@ -798,7 +803,17 @@ Type* Typer::Visitor::TypeTypedStateValues(Node* node) {
 }
 
 
-Type* Typer::Visitor::TypeCall(Node* node) { return Type::Any(); }
+Type* Typer::Visitor::TypeCall(Node* node) {
+  // Untagged results, as returned by C functions, must keep their type, so
+  // that they can be converted to tagged values.
+  CallDescriptor const* descriptor = CallDescriptorOf(node->op());
+  if (descriptor->ReturnCount() == 1) {
+    MachineType const type = descriptor->GetReturnType(0);
+    if (type == MachineType::Int32()) return Type::Signed32();
+    if (type == MachineType::Uint32()) return Type::Unsigned32();
+  }
+  return Type::Any();
+}
 
 
 Type* Typer::Visitor::TypeProjection(Node* node) {
@@ -1353,6 +1368,33 @@ Type* Typer::Visitor::JSCallFunctionTyper(Type* fun, Typer* t) {
         case kStringIteratorNext:
           return Type::OtherObject();
 
+        // DataView functions.
+        case kDataViewGetInt8:
+          return t->cache_.kInt8;
+        case kDataViewGetUint8:
+          return t->cache_.kUint8;
+        case kDataViewGetInt16:
+          return t->cache_.kInt16;
+        case kDataViewGetUint16:
+          return t->cache_.kUint16;
+        case kDataViewGetInt32:
+          return t->cache_.kInt32;
+        case kDataViewGetUint32:
+          return t->cache_.kUint32;
+        case kDataViewGetFloat32:
+          return t->cache_.kFloat32;
+        case kDataViewGetFloat64:
+          return t->cache_.kFloat64;
+        case kDataViewSetInt8:
+        case kDataViewSetUint8:
+        case kDataViewSetInt16:
+        case kDataViewSetUint16:
+        case kDataViewSetInt32:
+        case kDataViewSetUint32:
+        case kDataViewSetFloat32:
+        case kDataViewSetFloat64:
+          return Type::Undefined();
+
         // Array functions.
         case kArrayIndexOf:
         case kArrayLastIndexOf:
@@ -1646,6 +1688,14 @@ Type* Typer::Visitor::TypeLoadTypedElement(Node* node) {
   return nullptr;
 }
 
+Type* Typer::Visitor::TypeLoadDataViewElement(Node* node) {
+  return TypeLoadTypedElement(node);
+}
+
+Type* Typer::Visitor::TypeAtomicLoadTypedElement(Node* node) {
+  return TypeLoadTypedElement(node);
+}
+
 Type* Typer::Visitor::TypeStoreField(Node* node) {
   UNREACHABLE();
   return nullptr;
@@ -1668,6 +1718,16 @@ Type* Typer::Visitor::TypeStoreTypedElement(Node* node) {
   return nullptr;
 }
 
+Type* Typer::Visitor::TypeStoreDataViewElement(Node* node) {
+  UNREACHABLE();
+  return nullptr;
+}
+
+Type* Typer::Visitor::TypeAtomicStoreTypedElement(Node* node) {
+  UNREACHABLE();
+  return nullptr;
+}
+
 Type* Typer::Visitor::TypeObjectIsCallable(Node* node) {
   return TypeUnaryOp(node, ObjectIsCallable);
 }
@@ -1694,6 +1754,18 @@ Type* Typer::Visitor::TypeObjectIsUndetectable(Node* node) {
   return TypeUnaryOp(node, ObjectIsUndetectable);
 }
 
+Type* Typer::Visitor::TypeArgumentsFrame(Node* node) {
+  return Type::OtherInternal();
+}
+
+Type* Typer::Visitor::TypeArgumentsLength(Node* node) {
+  return Type::Range(0.0, Code::kMaxArguments, zone());
+}
+
+Type* Typer::Visitor::TypeNewUnmappedArgumentsElements(Node* node) {
+  return Type::OtherInternal();
+}
+
 Type* Typer::Visitor::TypeArrayBufferWasNeutered(Node* node) {
   return Type::Boolean();
 }
@@ -240,6 +240,7 @@ Type::bitset BitsetType::Lub(i::Map* map) {
     case FOREIGN_TYPE:
     case SCRIPT_TYPE:
     case CODE_TYPE:
+    case CELL_TYPE:
     case PROPERTY_CELL_TYPE:
     case MODULE_TYPE:
       return kOtherInternal;
@@ -269,7 +270,6 @@ Type::bitset BitsetType::Lub(i::Map* map) {
     case PROMISE_REACTION_JOB_INFO_TYPE:
     case DEBUG_INFO_TYPE:
     case BREAK_POINT_INFO_TYPE:
-    case CELL_TYPE:
     case WEAK_CELL_TYPE:
     case PROTOTYPE_INFO_TYPE:
     case TUPLE3_TYPE:
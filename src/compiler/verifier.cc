@@ -884,9 +884,25 @@ void Verifier::Visitor::Check(Node* node) {
       CheckValueInputIs(node, 0, Type::Any());
       CheckTypeIs(node, Type::Boolean());
       break;
+    case IrOpcode::kArgumentsFrame:
+      CheckTypeIs(node, Type::OtherInternal());
+      break;
+    case IrOpcode::kArgumentsLength:
+      CheckValueInputIs(node, 0, Type::OtherInternal());
+      CheckTypeIs(node, Type::Unsigned31());
+      break;
+    case IrOpcode::kNewUnmappedArgumentsElements:
+      CheckValueInputIs(node, 0, Type::OtherInternal());
+      CheckValueInputIs(node, 1, Type::Unsigned31());
+      CheckTypeIs(node, Type::OtherInternal());
+      break;
     case IrOpcode::kAllocate:
       CheckValueInputIs(node, 0, Type::PlainNumber());
       break;
+    case IrOpcode::kLoadFastAccessor:
+      CheckValueInputIs(node, 0, Type::Any());
+      CheckTypeIs(node, Type::NonInternal());
+      break;
     case IrOpcode::kEnsureWritableFastElements:
       CheckValueInputIs(node, 0, Type::Any());
       CheckValueInputIs(node, 1, Type::Internal());
@@ -1096,6 +1112,8 @@ void Verifier::Visitor::Check(Node* node) {
       // CheckTypeIs(node, ElementAccessOf(node->op()).type));
       break;
     case IrOpcode::kLoadTypedElement:
+    case IrOpcode::kLoadDataViewElement:
+    case IrOpcode::kAtomicLoadTypedElement:
       break;
     case IrOpcode::kStoreField:
       // (Object, fieldtype) -> _|_
@@ -1114,6 +1132,8 @@ void Verifier::Visitor::Check(Node* node) {
       CheckNotTyped(node);
       break;
     case IrOpcode::kStoreTypedElement:
+    case IrOpcode::kStoreDataViewElement:
+    case IrOpcode::kAtomicStoreTypedElement:
       CheckNotTyped(node);
       break;
     case IrOpcode::kNumberSilenceNaN:
@@ -2455,14 +2455,54 @@ Node* WasmGraphBuilder::BuildChangeTaggedToFloat64(Node* value) {
   return phi;
 }
 
+// Converts {node} to a float64 like a JavaScript ToNumber. Smis and heap
+// numbers are converted inline, only other values call the ToNumber stub.
+Node* WasmGraphBuilder::BuildJavaScriptToFloat64(Node* node, Node* context) {
+  MachineOperatorBuilder* machine = jsgraph()->machine();
+  CommonOperatorBuilder* common = jsgraph()->common();
+  Node* effect = *effect_;
+
+  Node* branch_smi = graph()->NewNode(common->Branch(BranchHint::kFalse),
+                                      BuildTestNotSmi(node), *control_);
+
+  Node* if_smi = graph()->NewNode(common->IfFalse(), branch_smi);
+  Node* vsmi = BuildChangeSmiToFloat64(node);
+
+  Node* if_not_smi = graph()->NewNode(common->IfTrue(), branch_smi);
+  Node* map = graph()->NewNode(
+      machine->Load(MachineType::AnyTagged()), node,
+      jsgraph()->IntPtrConstant(HeapObject::kMapOffset - kHeapObjectTag),
+      effect, if_not_smi);
+  Node* check_heap_number =
+      graph()->NewNode(machine->WordEqual(), map,
+                       jsgraph()->HeapNumberMapConstant());
+  Node* branch_heap_number =
+      graph()->NewNode(common->Branch(BranchHint::kTrue), check_heap_number,
+                       if_not_smi);
+
+  Node* if_heap_number = graph()->NewNode(common->IfTrue(), branch_heap_number);
+  Node* vheap_number = graph()->NewNode(
+      machine->Load(MachineType::Float64()), node,
+      BuildHeapNumberValueIndexConstant(), map, if_heap_number);
+
+  Node* if_other = graph()->NewNode(common->IfFalse(), branch_heap_number);
+  Node* vother = BuildJavaScriptToNumber(node, context, map, if_other);
+  Node* eother = vother;
+  vother = BuildChangeTaggedToFloat64(vother);
+
+  Node* merge =
+      graph()->NewNode(common->Merge(3), if_smi, if_heap_number, if_other);
+  *control_ = merge;
+  *effect_ = graph()->NewNode(common->EffectPhi(3), effect, vheap_number,
+                              eother, merge);
+  return graph()->NewNode(common->Phi(MachineRepresentation::kFloat64, 3),
+                          vsmi, vheap_number, vother, merge);
+}
+
 Node* WasmGraphBuilder::FromJS(Node* node, Node* context,
                                wasm::LocalType type) {
-  // Do a JavaScript ToNumber.
-  Node* num = BuildJavaScriptToNumber(node, context, *effect_, *control_);
-
-  // Change representation.
-  SimplifiedOperatorBuilder simplified(jsgraph()->zone());
-  num = BuildChangeTaggedToFloat64(num);
+  // Do a JavaScript ToNumber and change the representation.
+  Node* num = BuildJavaScriptToFloat64(node, context);
 
   switch (type) {
     case wasm::kAstI32: {
@@ -2739,6 +2779,8 @@ void WasmGraphBuilder::BuildWasmToJSWrapper(Handle<JSReceiver> target,
   }
 
   // Convert the return value back.
+  *effect_ = call;
+  *control_ = call;
   Node* ret;
   Node* val =
       FromJS(call, HeapConstant(isolate->native_context()),
@@ -2748,14 +2790,53 @@ void WasmGraphBuilder::BuildWasmToJSWrapper(Handle<JSReceiver> target,
     ret = graph()->NewNode(jsgraph()->common()->Return(), val,
                            graph()->NewNode(jsgraph()->machine()->Word32Sar(),
                                             val, jsgraph()->Int32Constant(31)),
-                           call, start);
+                           *effect_, *control_);
   } else {
-    ret = graph()->NewNode(jsgraph()->common()->Return(), val, call, start);
+    ret = graph()->NewNode(jsgraph()->common()->Return(), val, *effect_,
+                           *control_);
   }
 
   MergeControlToEnd(jsgraph(), ret);
 }
 
+void WasmGraphBuilder::BuildWasmLazyCompileStub(wasm::FunctionSig* sig) {
+  int wasm_count = static_cast<int>(sig->parameter_count());
+  Node* start = Start(wasm_count + 1);
+  *effect_ = start;
+  *control_ = start;
+
+  // The runtime returns the code of the now compiled function.
+  Node* code = BuildCallToRuntime(Runtime::kWasmCompileLazy, jsgraph(),
+                                  module_->instance->context, nullptr, 0,
+                                  effect_, *control_);
+
+  // Forward the parameters to the compiled function.
+  Node** args = Buffer(wasm_count + 3);
+  int pos = 0;
+  args[pos++] = code;
+  for (int i = 0; i < wasm_count; ++i) {
+    args[pos++] = Param(i, sig->GetParam(i));
+  }
+  args[pos++] = *effect_;
+  args[pos++] = *control_;
+  CallDescriptor* desc =
+      wasm::ModuleEnv::GetWasmCallDescriptor(jsgraph()->zone(), sig);
+  Node* call = graph()->NewNode(jsgraph()->common()->Call(desc), pos, args);
+  *effect_ = call;
+
+  unsigned ret_count = static_cast<unsigned>(sig->return_count());
+  Node** rets = Buffer(ret_count);
+  if (ret_count == 1) {
+    rets[0] = call;
+  } else {
+    for (unsigned i = 0; i < ret_count; ++i) {
+      rets[i] = graph()->NewNode(jsgraph()->common()->Projection(i), call,
+                                 graph()->start());
+    }
+  }
+  Return(ret_count, rets);
+}
+
 Node* WasmGraphBuilder::MemBuffer(uint32_t offset) {
   DCHECK(module_ && module_->instance);
   if (offset == 0) {
@@ -2906,8 +2987,11 @@ Node* WasmGraphBuilder::LoadMem(wasm::LocalType type, MachineType memtype,
                                 wasm::WasmCodePosition position) {
   Node* load;
 
-  // WASM semantics throw on OOB. Introduce explicit bounds check.
-  if (!FLAG_wasm_trap_handler) {
+  // WASM semantics throw on OOB. Introduce explicit bounds check, unless the
+  // memory is surrounded by guard regions and the trap handler catches the
+  // fault of an out of bounds access.
+  bool use_trap_handler = trap_handler::UseTrapHandler();
+  if (!use_trap_handler) {
     BoundsCheckMem(memtype, index, offset, position);
   }
   bool aligned = static_cast<int>(alignment) >=
@@ -2915,18 +2999,22 @@ Node* WasmGraphBuilder::LoadMem(wasm::LocalType type, MachineType memtype,
 
   if (aligned ||
       jsgraph()->machine()->UnalignedLoadSupported(memtype, alignment)) {
-    if (FLAG_wasm_trap_handler) {
+    if (use_trap_handler) {
       Node* context = HeapConstant(module_->instance->context);
       Node* position_node = jsgraph()->Int32Constant(position);
+      // The index is unsigned, so that any access lands in the guard regions
+      // following the memory.
+      Node* index64 = graph()->NewNode(
+          jsgraph()->machine()->ChangeUint32ToUint64(), index);
       load = graph()->NewNode(jsgraph()->machine()->ProtectedLoad(memtype),
-                              MemBuffer(offset), index, context, position_node,
-                              *effect_, *control_);
+                              MemBuffer(offset), index64, context,
+                              position_node, *effect_, *control_);
     } else {
       load = graph()->NewNode(jsgraph()->machine()->Load(memtype),
                               MemBuffer(offset), index, *effect_, *control_);
     }
   } else {
-    DCHECK(!FLAG_wasm_trap_handler);
+    DCHECK(!use_trap_handler);
     load = graph()->NewNode(jsgraph()->machine()->UnalignedLoad(memtype),
                             MemBuffer(offset), index, *effect_, *control_);
   }
@@ -2988,6 +3076,35 @@ Node* WasmGraphBuilder::StoreMem(MachineType memtype, Node* index,
   return store;
 }
 
+// Atomic accesses are always bounds checked explicitly; the trap handler
+// does not cover them.
+Node* WasmGraphBuilder::AtomicLoadMem(MachineType memtype, Node* index,
+                                      uint32_t offset,
+                                      wasm::WasmCodePosition position) {
+  BoundsCheckMem(memtype, index, offset, position);
+  Node* load = graph()->NewNode(jsgraph()->machine()->AtomicLoad(memtype),
+                                MemBuffer(offset), index, *effect_, *control_);
+  *effect_ = load;
+#if defined(V8_TARGET_BIG_ENDIAN)
+  load = BuildChangeEndianness(load, memtype, wasm::kAstI32);
+#endif
+  return load;
+}
+
+Node* WasmGraphBuilder::AtomicStoreMem(MachineType memtype, Node* index,
+                                       uint32_t offset, Node* val,
+                                       wasm::WasmCodePosition position) {
+  BoundsCheckMem(memtype, index, offset, position);
+#if defined(V8_TARGET_BIG_ENDIAN)
+  val = BuildChangeEndianness(val, memtype);
+#endif
+  Node* store = graph()->NewNode(
+      jsgraph()->machine()->AtomicStore(memtype.representation()),
+      MemBuffer(offset), index, val, *effect_, *control_);
+  *effect_ = store;
+  return store;
+}
+
 Node* WasmGraphBuilder::BuildAsmjsLoadMem(MachineType type, Node* index) {
   // TODO(turbofan): fold bounds checks for constant asm.js loads.
   // asm.js semantics use CheckedLoad (i.e. OOB reads return 0ish).
@@ -3049,9 +3166,27 @@ Node* WasmGraphBuilder::CreateS128Value(int32_t value) {
 Node* WasmGraphBuilder::SimdOp(wasm::WasmOpcode opcode,
                                const NodeVector& inputs) {
   switch (opcode) {
+    case wasm::kExprF32x4Splat:
+      return graph()->NewNode(jsgraph()->machine()->CreateFloat32x4(),
+                              inputs[0], inputs[0], inputs[0], inputs[0]);
+    case wasm::kExprF32x4Add:
+      return graph()->NewNode(jsgraph()->machine()->Float32x4Add(), inputs[0],
+                              inputs[1]);
+    case wasm::kExprF32x4Sub:
+      return graph()->NewNode(jsgraph()->machine()->Float32x4Sub(), inputs[0],
+                              inputs[1]);
+    case wasm::kExprF32x4Mul:
+      return graph()->NewNode(jsgraph()->machine()->Float32x4Mul(), inputs[0],
+                              inputs[1]);
     case wasm::kExprI32x4Splat:
       return graph()->NewNode(jsgraph()->machine()->CreateInt32x4(), inputs[0],
                               inputs[0], inputs[0], inputs[0]);
+    case wasm::kExprI32x4Add:
+      return graph()->NewNode(jsgraph()->machine()->Int32x4Add(), inputs[0],
+                              inputs[1]);
+    case wasm::kExprI32x4Sub:
+      return graph()->NewNode(jsgraph()->machine()->Int32x4Sub(), inputs[0],
+                              inputs[1]);
     default:
       return graph()->NewNode(UnsupportedOpcode(opcode), nullptr);
   }
@@ -3060,6 +3195,9 @@ Node* WasmGraphBuilder::SimdOp(wasm::WasmOpcode opcode,
 Node* WasmGraphBuilder::SimdExtractLane(wasm::WasmOpcode opcode, uint8_t lane,
                                         Node* input) {
   switch (opcode) {
+    case wasm::kExprF32x4ExtractLane:
+      return graph()->NewNode(jsgraph()->machine()->Float32x4ExtractLane(),
+                              input, Int32Constant(lane));
     case wasm::kExprI32x4ExtractLane:
       return graph()->NewNode(jsgraph()->machine()->Int32x4ExtractLane(), input,
                               Int32Constant(lane));
@@ -3243,6 +3381,62 @@ Handle<Code> CompileWasmToJSWrapper(Isolate* isolate, Handle<JSReceiver> target,
   return code;
 }
 
+Handle<Code> CompileWasmLazyCompileStub(Isolate* isolate,
+                                        wasm::ModuleEnv* module,
+                                        wasm::FunctionSig* sig) {
+  //----------------------------------------------------------------------------
+  // Create the Graph
+  //----------------------------------------------------------------------------
+  Zone zone(isolate->allocator());
+  Graph graph(&zone);
+  CommonOperatorBuilder common(&zone);
+  MachineOperatorBuilder machine(&zone);
+  JSGraph jsgraph(isolate, &graph, &common, nullptr, nullptr, &machine);
+
+  Node* control = nullptr;
+  Node* effect = nullptr;
+
+  WasmGraphBuilder builder(&zone, &jsgraph, sig);
+  builder.set_control_ptr(&control);
+  builder.set_effect_ptr(&effect);
+  builder.set_module(module);
+  builder.BuildWasmLazyCompileStub(sig);
+
+  //----------------------------------------------------------------------------
+  // Run the compilation pipeline.
+  //----------------------------------------------------------------------------
+  if (FLAG_trace_turbo_graph) {  // Simple textual RPO.
+    OFStream os(stdout);
+    os << "-- Graph after change lowering -- " << std::endl;
+    os << AsRPO(graph);
+  }
+
+  // Schedule and compile to machine code.
+  CallDescriptor* incoming = wasm::ModuleEnv::GetWasmCallDescriptor(&zone, sig);
+  if (machine.Is32()) {
+    Int64Lowering r(&graph, &machine, &common, &zone, sig);
+    r.LowerGraph();
+    incoming = wasm::ModuleEnv::GetI32WasmCallDescriptor(&zone, incoming);
+  }
+  Code::Flags flags = Code::ComputeFlags(Code::WASM_FUNCTION);
+  Vector<const char> func_name = ArrayVector("wasm-lazy-compile");
+  CompilationInfo info(func_name, isolate, &zone, flags);
+  Handle<Code> code = Pipeline::GenerateCodeForTesting(&info, incoming, &graph);
+#ifdef ENABLE_DISASSEMBLER
+  if (FLAG_print_opt_code && !code.is_null()) {
+    OFStream os(stdout);
+    code->Disassemble(func_name.start(), os);
+  }
+#endif
+
+  if (isolate->logger()->is_logging_code_events() || isolate->is_profiling()) {
+    RecordFunctionCompilation(CodeEventListener::FUNCTION_TAG, isolate, code,
+                              "wasm-lazy-compile", 0, wasm::WasmName("stub"),
+                              wasm::WasmName());
+  }
+  return code;
+}
+
 SourcePositionTable* WasmCompilationUnit::BuildGraphForWasmFunction(
     double* decode_ms) {
   base::ElapsedTimer decode_timer;
@@ -3316,7 +3510,9 @@ WasmCompilationUnit::WasmCompilationUnit(wasm::ErrorThrower* thrower,
             Code::ComputeFlags(Code::WASM_FUNCTION)),
       job_(),
       index_(index),
-      ok_(true) {
+      ok_(true),
+      protected_instructions_(&compilation_zone_) {
+  if (FLAG_wasm_fast_compilation) info_.MarkAsFastCompilation();
   // Create and cache this node in the main thread.
   jsgraph_->CEntryStubConstant(1);
 }
@@ -3357,7 +3553,8 @@ void WasmCompilationUnit::ExecuteCompilation() {
         module_env_->GetI32WasmCallDescriptor(&compilation_zone_, descriptor);
   }
   job_.reset(Pipeline::NewWasmCompilationJob(&info_, jsgraph_->graph(),
-                                             descriptor, source_positions));
+                                             descriptor, source_positions,
+                                             &protected_instructions_));
   ok_ = job_->ExecuteJob() == CompilationJob::SUCCEEDED;
   // TODO(bradnelson): Improve histogram handling of size_t.
   // TODO(ahaas): The counters are not thread-safe at the moment.
@@ -3400,6 +3597,22 @@ Handle<Code> WasmCompilationUnit::FinishCompilation() {
   Handle<Code> code = info_.code();
   DCHECK(!code.is_null());
 
+  if (!protected_instructions_.empty()) {
+    // Stored as instruction and landing pad offset pairs; the code is
+    // registered with the trap handler once it is instantiated.
+    int length = static_cast<int>(protected_instructions_.size()) * 2;
+    Handle<FixedArray> protected_instructions =
+        isolate_->factory()->NewFixedArray(length, TENURED);
+    for (size_t i = 0; i < protected_instructions_.size(); ++i) {
+      const trap_handler::ProtectedInstructionData& data =
+          protected_instructions_[i];
+      int index = static_cast<int>(i) * 2;
+      protected_instructions->set(index, Smi::FromInt(data.instr_offset));
+      protected_instructions->set(index + 1, Smi::FromInt(data.landing_offset));
+    }
+    code->set_protected_instructions(*protected_instructions);
+  }
+
   if (isolate_->logger()->is_logging_code_events() ||
       isolate_->is_profiling()) {
     RecordFunctionCompilation(
@@ -11,8 +11,10 @@
 // Do not include anything from src/compiler here!
 #include "src/compilation-info.h"
 #include "src/compiler.h"
+#include "src/trap-handler/trap-handler.h"
 #include "src/wasm/wasm-opcodes.h"
 #include "src/wasm/wasm-result.h"
+#include "src/zone/zone-containers.h"
 #include "src/zone/zone.h"
 
 namespace v8 {
@@ -77,6 +79,9 @@ class WasmCompilationUnit final {
   uint32_t index_;
   wasm::Result<wasm::DecodeStruct*> graph_construction_result_;
   bool ok_;
+  // The memory accesses which are bounds checked by the trap handler, filled
+  // in by the code generator.
+  ZoneVector<trap_handler::ProtectedInstructionData> protected_instructions_;
 
   DISALLOW_COPY_AND_ASSIGN(WasmCompilationUnit);
 };
@@ -91,6 +96,14 @@ Handle<Code> CompileWasmToJSWrapper(Isolate* isolate, Handle<JSReceiver> target,
 Handle<Code> CompileJSToWasmWrapper(Isolate* isolate, wasm::ModuleEnv* module,
                                     Handle<Code> wasm_code, uint32_t index);
 
+// Compiles a stub for functions of signature {sig} which compiles the called
+// function with Runtime::kWasmCompileLazy and then calls it. The stub finds
+// the function through its deoptimization data, so there has to be one copy
+// of it per function.
+Handle<Code> CompileWasmLazyCompileStub(Isolate* isolate,
+                                        wasm::ModuleEnv* module,
+                                        wasm::FunctionSig* sig);
+
 // Abstracts details of building TurboFan graph nodes for WASM to separate
 // the WASM decoder from the internal details of TurboFan.
 class WasmTrapHelper;
@@ -163,6 +176,7 @@ class WasmGraphBuilder {
 
   void BuildJSToWasmWrapper(Handle<Code> wasm_code, wasm::FunctionSig* sig);
   void BuildWasmToJSWrapper(Handle<JSReceiver> target, wasm::FunctionSig* sig);
+  void BuildWasmLazyCompileStub(wasm::FunctionSig* sig);
 
   Node* ToJS(Node* node, wasm::LocalType type);
   Node* FromJS(Node* node, Node* context, wasm::LocalType type);
@@ -181,6 +195,10 @@ class WasmGraphBuilder {
   Node* StoreMem(MachineType type, Node* index, uint32_t offset,
                  uint32_t alignment, Node* val,
                  wasm::WasmCodePosition position);
+  Node* AtomicLoadMem(MachineType memtype, Node* index, uint32_t offset,
+                      wasm::WasmCodePosition position);
+  Node* AtomicStoreMem(MachineType memtype, Node* index, uint32_t offset,
+                       Node* val, wasm::WasmCodePosition position);
 
   static void PrintDebugName(Node* node);
 
@@ -314,6 +332,7 @@ class WasmGraphBuilder {
   Node* BuildChangeInt32ToTagged(Node* value);
   Node* BuildChangeFloat64ToTagged(Node* value);
   Node* BuildChangeTaggedToFloat64(Node* value);
+  Node* BuildJavaScriptToFloat64(Node* node, Node* context);
 
   Node* BuildChangeInt32ToSmi(Node* value);
   Node* BuildChangeSmiToInt32(Node* value);
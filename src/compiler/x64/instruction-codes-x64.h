@@ -56,6 +56,8 @@ namespace compiler {
   V(X64Tzcnt32)                    \
   V(X64Popcnt)                     \
   V(X64Popcnt32)                   \
+  V(X64Bswap)                      \
+  V(X64Bswap32)                    \
   V(SSEFloat32Cmp)                 \
   V(SSEFloat32Add)                 \
   V(SSEFloat32Sub)                 \
@@ -128,7 +130,6 @@ namespace compiler {
   V(X64Movzxwq)                    \
   V(X64Movw)                       \
   V(X64Movl)                       \
-  V(X64TrapMovl)                   \
   V(X64Movsxlq)                    \
   V(X64Movq)                       \
   V(X64Movsd)                      \
@@ -147,8 +148,15 @@ namespace compiler {
   V(X64Xchgb)                      \
   V(X64Xchgw)                      \
   V(X64Xchgl)                      \
+  V(X64Float32x4Create)            \
+  V(X64Float32x4ExtractLane)       \
+  V(X64Float32x4Add)               \
+  V(X64Float32x4Sub)               \
+  V(X64Float32x4Mul)               \
   V(X64Int32x4Create)              \
-  V(X64Int32x4ExtractLane)
+  V(X64Int32x4ExtractLane)         \
+  V(X64Int32x4Add)                 \
+  V(X64Int32x4Sub)
 
 // Addressing modes represent the "shape" of inputs to an instruction.
 // Many instructions support multiple addressing modes. Addressing modes
@@ -183,6 +191,11 @@ namespace compiler {
   V(M8I)  /* [      %r2*8 + K] */      \
   V(Root) /* [%root       + K] */
 
+// Stored in the MiscField of the loads selected for ProtectedLoad nodes. The
+// code generator emits out-of-line code which throws the wasm trap, and
+// records the load so that the trap handler can redirect a fault to it.
+enum X64MemoryProtection { kUnprotected = 0, kProtected = 1 };
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -54,6 +54,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Tzcnt32:
     case kX64Popcnt:
     case kX64Popcnt32:
+    case kX64Bswap:
+    case kX64Bswap32:
     case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
@@ -123,8 +125,15 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Lea:
     case kX64Dec32:
     case kX64Inc32:
+    case kX64Float32x4Create:
+    case kX64Float32x4ExtractLane:
+    case kX64Float32x4Add:
+    case kX64Float32x4Sub:
+    case kX64Float32x4Mul:
     case kX64Int32x4Create:
     case kX64Int32x4ExtractLane:
+    case kX64Int32x4Add:
+    case kX64Int32x4Sub:
       return (instr->addressing_mode() == kMode_None)
           ? kNoOpcodeFlags
           : kIsLoadOperation | kHasSideEffect;
@@ -155,7 +164,6 @@ int InstructionScheduler::GetTargetInstructionFlags(
       return kHasSideEffect;
 
     case kX64Movl:
-    case kX64TrapMovl:
       if (instr->HasOutput()) {
         DCHECK(instr->InputCount() >= 1);
         return instr->InputAt(0)->IsRegister() ? kNoOpcodeFlags
@@ -194,8 +202,135 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // TODO(all): Add instruction cost modeling.
-  return 1;
+  // Basic latency modeling for x64 instructions. The numbers are rough
+  // estimates for recent out-of-order cores; instructions with a memory
+  // operand additionally pay for the load.
+  const int kLoadLatency = 4;
+  int memory_latency =
+      instr->addressing_mode() == kMode_None ? 0 : kLoadLatency;
+  switch (instr->arch_opcode()) {
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
+      return memory_latency + 3;
+
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return memory_latency + 26;
+
+    case kX64Idiv:
+    case kX64Udiv:
+      return memory_latency + 40;
+
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+    case kAVXFloat32Cmp:
+    case kAVXFloat64Cmp:
+      return memory_latency + 2;
+
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kSSEFloat32Max:
+    case kSSEFloat64Max:
+    case kSSEFloat32Min:
+    case kSSEFloat64Min:
+      return memory_latency + 3;
+
+    case kSSEFloat32Mul:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Mul:
+      return memory_latency + 5;
+
+    case kSSEFloat32Div:
+    case kAVXFloat32Div:
+      return memory_latency + 11;
+
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+      return memory_latency + 15;
+
+    case kSSEFloat32Sqrt:
+      return memory_latency + 12;
+
+    case kSSEFloat64Sqrt:
+      return memory_latency + 18;
+
+    case kSSEFloat64Mod:
+      return 50;
+
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToUint64:
+    case kSSEFloat32ToUint64:
+    case kSSEInt32ToFloat64:
+    case kSSEInt32ToFloat32:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+    case kSSEUint32ToFloat64:
+    case kSSEUint32ToFloat32:
+      return memory_latency + 5;
+
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+      // With a memory operand, input 0 is the base register, so loads are
+      // told apart by their addressing mode.
+      return instr->addressing_mode() != kMode_None ? kLoadLatency : 1;
+
+    case kX64Movl:
+      if (instr->HasOutput()) {
+        return instr->addressing_mode() != kMode_None ? kLoadLatency : 1;
+      }
+      return 1;
+
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+      return instr->HasOutput() ? memory_latency + 1 : 1;
+
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+    case kCheckedLoadWord64:
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+      return kLoadLatency + 1;
+
+    default:
+      return memory_latency + 1;
+  }
 }
 
 }  // namespace compiler
@@ -593,5 +593,7 @@ void Context::IncrementErrorsThrown() {
 
 int Context::GetErrorsThrown() { return errors_thrown()->value(); }
 
+int Context::GetLiveSize() { return live_size()->value(); }
+
 }  // namespace internal
 }  // namespace v8
@@ -63,6 +63,7 @@ enum ContextLookupFlags {
 
 #define NATIVE_CONTEXT_IMPORTED_FIELDS(V)                                 \
   V(ARRAY_CONCAT_INDEX, JSFunction, array_concat)                         \
+  V(ARRAY_ITERATOR_PROTOTYPE_INDEX, JSObject, array_iterator_prototype)   \
   V(ARRAY_POP_INDEX, JSFunction, array_pop)                               \
   V(ARRAY_PUSH_INDEX, JSFunction, array_push)                             \
   V(ARRAY_SHIFT_INDEX, JSFunction, array_shift)                           \
@@ -187,6 +188,7 @@ enum ContextLookupFlags {
   V(JS_SET_MAP_INDEX, Map, js_set_map)                                         \
   V(JS_WEAK_MAP_FUN_INDEX, JSFunction, js_weak_map_fun)                        \
   V(JS_WEAK_SET_FUN_INDEX, JSFunction, js_weak_set_fun)                        \
+  V(LIVE_SIZE_INDEX, Smi, live_size)                                           \
   V(MAP_CACHE_INDEX, Object, map_cache)                                        \
   V(MAP_ITERATOR_MAP_INDEX, Map, map_iterator_map)                             \
   V(STRING_ITERATOR_MAP_INDEX, Map, string_iterator_map)                       \
@@ -407,6 +409,10 @@ class Context: public FixedArray {
   void IncrementErrorsThrown();
   int GetErrorsThrown();
 
+  // The size in bytes of the live objects attributed to this native context by
+  // the last mark-compact. Only maintained with --track-context-live-size.
+  int GetLiveSize();
+
   // Direct slot access.
   inline JSFunction* closure();
   inline void set_closure(JSFunction* closure);
@@ -126,6 +126,21 @@ const char* DoubleToCString(double v, Vector<char> buffer) {
     case FP_ZERO: return "0";
     default: {
       SimpleStringBuilder builder(buffer.start(), buffer.length());
+      // Safe integers print as their decimal digits: no shorter string rounds
+      // to them, and they are below the exponential threshold of 10^21. This
+      // covers values like timestamps without the shortest dtoa search.
+      if (std::fabs(v) <= kMaxSafeInteger && v == std::floor(v)) {
+        if (v < 0) builder.AddCharacter('-');
+        char digits[kBase10MaximalLength];
+        int length = 0;
+        for (uint64_t n = static_cast<uint64_t>(std::fabs(v)); n != 0;
+             n /= 10) {
+          digits[length++] = '0' + static_cast<char>(n % 10);
+        }
+        while (length > 0) builder.AddCharacter(digits[--length]);
+        return builder.Finalize();
+      }
+
       int decimal_point;
       int sign;
       const int kV8DtoaBufferCapacity = kBase10MaximalLength + 1;
@@ -281,6 +281,11 @@ void RuntimeCallCounter::Dump(std::stringstream& out) {
       << "],";
 }
 
+void RuntimeCallCounter::Visit(v8::RuntimeCallStatsVisitor* visitor) {
+  if (count == 0) return;
+  visitor->VisitRuntimeCallCounter(name, count, time.InMicroseconds());
+}
+
 // static
 void RuntimeCallStats::Enter(RuntimeCallStats* stats, RuntimeCallTimer* timer,
                              CounterId counter_id) {
@@ -341,6 +346,11 @@ void RuntimeCallStats::Reset() {
   if (!FLAG_runtime_call_stats &&
       !TRACE_EVENT_RUNTIME_CALL_STATS_TRACING_ENABLED())
     return;
+  ResetCounters();
+  in_use_ = true;
+}
+
+void RuntimeCallStats::ResetCounters() {
 #define RESET_COUNTER(name) this->name.Reset();
   FOR_EACH_MANUAL_COUNTER(RESET_COUNTER)
 #undef RESET_COUNTER
@@ -360,8 +370,6 @@ void RuntimeCallStats::Reset() {
 #define RESET_COUNTER(name) this->Handler_##name.Reset();
   FOR_EACH_HANDLER_COUNTER(RESET_COUNTER)
 #undef RESET_COUNTER
-
-  in_use_ = true;
 }
 
 std::string RuntimeCallStats::Dump() {
@@ -397,5 +405,28 @@ std::string RuntimeCallStats::Dump() {
   return buffer_.str();
 }
 
+void RuntimeCallStats::Visit(v8::RuntimeCallStatsVisitor* visitor) {
+#define VISIT_COUNTER(name) this->name.Visit(visitor);
+  FOR_EACH_MANUAL_COUNTER(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name, nargs, result_size) \
+  this->Runtime_##name.Visit(visitor);
+  FOR_EACH_INTRINSIC(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name) this->Builtin_##name.Visit(visitor);
+  BUILTIN_LIST_C(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name) this->API_##name.Visit(visitor);
+  FOR_EACH_API_COUNTER(VISIT_COUNTER)
+#undef VISIT_COUNTER
+
+#define VISIT_COUNTER(name) this->Handler_##name.Visit(visitor);
+  FOR_EACH_HANDLER_COUNTER(VISIT_COUNTER)
+#undef VISIT_COUNTER
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -486,6 +486,8 @@ struct RuntimeCallCounter {
   void Reset();
   V8_NOINLINE void Dump(std::stringstream& out);
 
+  void Visit(v8::RuntimeCallStatsVisitor* visitor);
+
   const char* name;
   int64_t count = 0;
   base::TimeDelta time;
@@ -574,6 +576,7 @@ class RuntimeCallTimer {
   V(NumberObject_NumberValue)                              \
   V(Object_CallAsConstructor)                              \
   V(Object_CallAsFunction)                                 \
+  V(Object_CreateDataProperties)                           \
   V(Object_CreateDataProperty)                             \
   V(Object_DefineOwnProperty)                              \
   V(Object_DefineProperty)                                 \
@@ -581,6 +584,7 @@ class RuntimeCallTimer {
   V(Object_DeleteProperty)                                 \
   V(Object_ForceSet)                                       \
   V(Object_Get)                                            \
+  V(Object_GetMultiple)                                    \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
   V(Object_GetPropertyAttributes)                          \
@@ -628,6 +632,7 @@ class RuntimeCallTimer {
   V(RegExp_New)                                            \
   V(ScriptCompiler_Compile)                                \
   V(ScriptCompiler_CompileFunctionInContext)               \
+  V(ScriptCompiler_CompileModule)                          \
   V(ScriptCompiler_CompileUnbound)                         \
   V(Script_Run)                                            \
   V(Set_Add)                                               \
@@ -728,6 +733,8 @@ class RuntimeCallTimer {
   V(LoadIC_LoadApiGetterStub)                   \
   V(LoadIC_LoadCallback)                        \
   V(LoadIC_LoadConstant)                        \
+  V(LoadIC_LoadConstantDH)                      \
+  V(LoadIC_LoadConstantFromPrototypeDH)         \
   V(LoadIC_LoadConstantStub)                    \
   V(LoadIC_LoadFieldDH)                         \
   V(LoadIC_LoadFieldFromPrototypeDH)            \
@@ -794,8 +801,12 @@ class RuntimeCallStats {
                                       CounterId counter_id);
 
   void Reset();
+  // Like Reset(), but does not affect nested tracing scopes.
+  void ResetCounters();
   V8_NOINLINE void Print(std::ostream& os);
   V8_NOINLINE std::string Dump();
+  // Calls {visitor} for every counter that was entered since the last reset.
+  V8_NOINLINE void Visit(v8::RuntimeCallStatsVisitor* visitor);
 
   RuntimeCallStats() {
     Reset();
@@ -839,6 +850,9 @@ class RuntimeCallStats {
   HR(incremental_marking_reason, V8.GCIncrementalMarkingReason, 0, 21, 22)    \
   HR(mark_compact_reason, V8.GCMarkCompactReason, 0, 21, 22)                  \
   HR(scavenge_reason, V8.GCScavengeReason, 0, 21, 22)                         \
+  /* Time jobs wait in the concurrent recompilation queue. */                 \
+  HR(concurrent_recompilation_wait_time_in_ms,                               \
+     V8.ConcurrentRecompilationWaitTimeInMS, 0, 10000, 101)                   \
   /* Asm/Wasm. */                                                             \
   HR(wasm_functions_per_module, V8.WasmFunctionsPerModule, 1, 10000, 51)
 
@@ -948,6 +962,10 @@ class RuntimeCallStats {
   SC(arguments_adaptors, V8.ArgumentsAdaptors)                        \
   SC(compilation_cache_hits, V8.CompilationCacheHits)                 \
   SC(compilation_cache_misses, V8.CompilationCacheMisses)             \
+  /* Concurrent recompilation queue. */                               \
+  SC(concurrent_recompilation_queue_depth,                            \
+     V8.ConcurrentRecompilationQueueDepth)                            \
+  SC(concurrent_recompilation_drops, V8.ConcurrentRecompilationDrops) \
   /* Amount of evaled source code. */                                 \
   SC(total_eval_size, V8.TotalEvalSize)                               \
   /* Amount of loaded source code. */                                 \
@@ -968,7 +986,11 @@ class RuntimeCallStats {
   SC(pc_to_code, V8.PcToCode)                                         \
   SC(pc_to_code_cached, V8.PcToCodeCached)                            \
   /* The store-buffer implementation of the write barrier. */         \
-  SC(store_buffer_overflows, V8.StoreBufferOverflows)
+  SC(store_buffer_overflows, V8.StoreBufferOverflows)                 \
+  /* Paged space allocations that missed the free list. */            \
+  SC(paged_space_slow_allocations, V8.PagedSpaceSlowAllocations)      \
+  /* Of those, the ones that waited for the sweeper to finish. */     \
+  SC(paged_space_sweeper_waits, V8.PagedSpaceSweeperWaits)
 
 #define STATS_COUNTER_LIST_2(SC)                                               \
   /* Number of code stubs. */                                                  \
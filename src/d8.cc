@@ -1971,31 +1971,32 @@ void SerializationData::ReadSharedArrayBufferContents(
 
 void SerializationDataQueue::Enqueue(SerializationData* data) {
   base::LockGuard<base::Mutex> lock_guard(&mutex_);
-  data_.Add(data);
+  data_.push_back(data);
 }
 
 
 bool SerializationDataQueue::Dequeue(SerializationData** data) {
   base::LockGuard<base::Mutex> lock_guard(&mutex_);
   *data = NULL;
-  if (data_.is_empty()) return false;
-  *data = data_.Remove(0);
+  if (data_.empty()) return false;
+  *data = data_.front();
+  data_.pop_front();
   return true;
 }
 
 
 bool SerializationDataQueue::IsEmpty() {
   base::LockGuard<base::Mutex> lock_guard(&mutex_);
-  return data_.is_empty();
+  return data_.empty();
 }
 
 
 void SerializationDataQueue::Clear() {
   base::LockGuard<base::Mutex> lock_guard(&mutex_);
-  for (int i = 0; i < data_.length(); ++i) {
-    delete data_[i];
+  for (SerializationData* data : data_) {
+    delete data;
   }
-  data_.Clear();
+  data_.clear();
 }
 
 
@@ -2252,6 +2253,12 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strncmp(argv[i], "--trace-config=", 15) == 0) {
       options.trace_config = argv[i] + 15;
       argv[i] = NULL;
+    } else if (strncmp(argv[i], "--benchmark-warmup=", 19) == 0) {
+      options.benchmark_warmup_runs = atoi(argv[i] + 19);
+      argv[i] = NULL;
+    } else if (strncmp(argv[i], "--benchmark=", 12) == 0) {
+      options.benchmark_runs = atoi(argv[i] + 12);
+      argv[i] = NULL;
     }
   }
 
@@ -2319,6 +2326,126 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
 }
 
 
+namespace {
+
+// GC time and peak heap size of the current benchmark run.
+double benchmark_gc_start = 0;
+double benchmark_gc_time = 0;
+size_t benchmark_peak_heap_size = 0;
+
+// Pause times of all measured runs, by kind of GC.
+std::vector<double> benchmark_scavenge_pauses_ms;
+std::vector<double> benchmark_mark_compact_pauses_ms;
+
+void UpdateBenchmarkPeakHeapSize(Isolate* isolate) {
+  HeapStatistics heap_statistics;
+  isolate->GetHeapStatistics(&heap_statistics);
+  benchmark_peak_heap_size =
+      std::max(benchmark_peak_heap_size, heap_statistics.used_heap_size());
+}
+
+void BenchmarkGCPrologue(Isolate* isolate, GCType type,
+                         GCCallbackFlags flags) {
+  UpdateBenchmarkPeakHeapSize(isolate);
+  benchmark_gc_start = g_platform->MonotonicallyIncreasingTime();
+}
+
+void BenchmarkGCEpilogue(Isolate* isolate, GCType type,
+                         GCCallbackFlags flags) {
+  double pause = g_platform->MonotonicallyIncreasingTime() - benchmark_gc_start;
+  benchmark_gc_time += pause;
+  if (type == kGCTypeScavenge) {
+    benchmark_scavenge_pauses_ms.push_back(pause * 1000);
+  } else if (type == kGCTypeMarkSweepCompact) {
+    benchmark_mark_compact_pauses_ms.push_back(pause * 1000);
+  }
+}
+
+// Returns the nearest-rank percentile of the sorted |values|.
+double Percentile(const std::vector<double>& values, int percent) {
+  size_t rank = (values.size() * percent + 99) / 100;
+  return values[rank == 0 ? 0 : rank - 1];
+}
+
+void PrintJSONList(const char* name, const std::vector<double>& values) {
+  printf("  \"%s\": [", name);
+  for (size_t i = 0; i < values.size(); i++) {
+    printf("%s%.3f", i == 0 ? "" : ", ", values[i]);
+  }
+  printf("],\n");
+}
+
+void PrintJSONPauses(const char* name, std::vector<double>* pauses_ms) {
+  printf("  \"%s\": {\"count\": %" PRIuS, name, pauses_ms->size());
+  if (!pauses_ms->empty()) {
+    std::sort(pauses_ms->begin(), pauses_ms->end());
+    printf(", \"median_ms\": %.3f, \"p90_ms\": %.3f, \"max_ms\": %.3f",
+           Percentile(*pauses_ms, 50), Percentile(*pauses_ms, 90),
+           pauses_ms->back());
+  }
+  printf("},\n");
+}
+
+void PrintJSONList(const char* name, const std::vector<size_t>& values) {
+  printf("  \"%s\": [", name);
+  for (size_t i = 0; i < values.size(); i++) {
+    printf("%s%" PRIuS, i == 0 ? "" : ", ", values[i]);
+  }
+  printf("],\n");
+}
+
+}  // namespace
+
+// Runs the scripts --benchmark-warmup times without measuring, then
+// --benchmark times with a fresh context each, and prints the wall time, GC
+// time and peak heap size of the measured runs, and the distribution of their
+// scavenge and mark-compact pauses as JSON.
+int Shell::RunBenchmark(Isolate* isolate, int argc, char* argv[]) {
+  int result = 0;
+  for (int i = 0; i < options.benchmark_warmup_runs && result == 0; i++) {
+    result = RunMain(isolate, argc, argv, false);
+  }
+  benchmark_scavenge_pauses_ms.clear();
+  benchmark_mark_compact_pauses_ms.clear();
+  isolate->AddGCPrologueCallback(BenchmarkGCPrologue);
+  isolate->AddGCEpilogueCallback(BenchmarkGCEpilogue);
+  std::vector<double> times_ms;
+  std::vector<double> gc_times_ms;
+  std::vector<size_t> peak_heap_sizes;
+  for (int i = 0; i < options.benchmark_runs && result == 0; i++) {
+    bool last_run = i == options.benchmark_runs - 1;
+    benchmark_gc_time = 0;
+    benchmark_peak_heap_size = 0;
+    double start = g_platform->MonotonicallyIncreasingTime();
+    result = RunMain(isolate, argc, argv, last_run);
+    double end = g_platform->MonotonicallyIncreasingTime();
+    UpdateBenchmarkPeakHeapSize(isolate);
+    times_ms.push_back((end - start) * 1000);
+    gc_times_ms.push_back(benchmark_gc_time * 1000);
+    peak_heap_sizes.push_back(benchmark_peak_heap_size);
+  }
+  isolate->RemoveGCPrologueCallback(BenchmarkGCPrologue);
+  isolate->RemoveGCEpilogueCallback(BenchmarkGCEpilogue);
+  if (result != 0 || times_ms.empty()) return result;
+
+  std::vector<double> sorted_times_ms(times_ms);
+  std::sort(sorted_times_ms.begin(), sorted_times_ms.end());
+  printf("{\n");
+  printf("  \"warmup_runs\": %d,\n", options.benchmark_warmup_runs);
+  printf("  \"runs\": %d,\n", options.benchmark_runs);
+  PrintJSONList("times_ms", times_ms);
+  PrintJSONList("gc_times_ms", gc_times_ms);
+  PrintJSONList("peak_heap_sizes", peak_heap_sizes);
+  PrintJSONPauses("scavenge_pauses", &benchmark_scavenge_pauses_ms);
+  PrintJSONPauses("mark_compact_pauses", &benchmark_mark_compact_pauses_ms);
+  printf("  \"min_ms\": %.3f,\n", sorted_times_ms.front());
+  printf("  \"median_ms\": %.3f,\n", Percentile(sorted_times_ms, 50));
+  printf("  \"p90_ms\": %.3f,\n", Percentile(sorted_times_ms, 90));
+  printf("  \"max_ms\": %.3f\n", sorted_times_ms.back());
+  printf("}\n");
+  return result;
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     const double kLongIdlePauseInSeconds = 1.0;
@@ -2769,6 +2896,8 @@ int Shell::Main(int argc, char* argv[]) {
       }
       printf("======== Full Deoptimization =======\n");
       Testing::DeoptimizeAll(isolate);
+    } else if (options.benchmark_runs > 0) {
+      result = RunBenchmark(isolate, argc, argv);
     } else if (i::FLAG_stress_runs > 0) {
       options.stress_runs = i::FLAG_stress_runs;
       for (int i = 0; i < options.stress_runs && result == 0; i++) {
@@ -5,6 +5,7 @@
 #ifndef V8_D8_H_
 #define V8_D8_H_
 
+#include <deque>
 #include <string>
 
 #include "src/allocation.h"
@@ -203,7 +204,7 @@ class SerializationDataQueue {
 
  private:
   base::Mutex mutex_;
-  i::List<SerializationData*> data_;
+  std::deque<SerializationData*> data_;
 };
 
 
@@ -281,7 +282,9 @@ class ShellOptions {
         natives_blob(NULL),
         snapshot_blob(NULL),
         trace_enabled(false),
-        trace_config(NULL) {}
+        trace_config(NULL),
+        benchmark_warmup_runs(0),
+        benchmark_runs(0) {}
 
   ~ShellOptions() {
     delete[] isolate_sources;
@@ -311,6 +314,8 @@ class ShellOptions {
   const char* snapshot_blob;
   bool trace_enabled;
   const char* trace_config;
+  int benchmark_warmup_runs;
+  int benchmark_runs;
 };
 
 class Shell : public i::AllStatic {
@@ -327,6 +332,7 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, int argc, char* argv[], bool last_run);
+  static int RunBenchmark(Isolate* isolate, int argc, char* argv[]);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
@@ -16,6 +16,7 @@ template <typename Char>
 bool DateParser::Parse(Isolate* isolate, Vector<Char> str, FixedArray* out) {
   UnicodeCache* unicode_cache = isolate->unicode_cache();
   DCHECK(out->length() >= OUTPUT_SIZE);
+  if (ParseISODateTimeFast(str, out)) return true;
   InputReader<Char> in(unicode_cache, str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -240,6 +241,57 @@ bool DateParser::InputReader<Char>::SkipParentheses() {
 }
 
 
+template <typename Char>
+bool DateParser::ParseISODateTimeFast(Vector<Char> str, FixedArray* out) {
+  // The format produced by Date.prototype.toISOString and Date.prototype.
+  // toJSON for years 0000..9999, where 'd' stands for a decimal digit.
+  static const char kFormat[] = "dddd-dd-ddTdd:dd:dd.dddZ";
+  static const int kLength = arraysize(kFormat) - 1;
+  if (str.length() != kLength) return false;
+  for (int i = 0; i < kLength; i++) {
+    if (kFormat[i] == 'd' ? !IsDecimalDigit(str[i]) : str[i] != kFormat[i]) {
+      return false;
+    }
+  }
+  int year = ReadFixedDigits(str, 0, 4);
+  int month = ReadFixedDigits(str, 5, 2);
+  int day = ReadFixedDigits(str, 8, 2);
+  int hour = ReadFixedDigits(str, 11, 2);
+  int minute = ReadFixedDigits(str, 14, 2);
+  int second = ReadFixedDigits(str, 17, 2);
+  int millisecond = ReadFixedDigits(str, 20, 3);
+  // Leave the corner cases (e.g. 24:00:00.000) to the general parser.
+  if (!DayComposer::IsMonth(month) || !DayComposer::IsDay(day) ||
+      !TimeComposer::IsHour(hour) || !TimeComposer::IsMinute(minute) ||
+      !TimeComposer::IsSecond(second)) {
+    return false;
+  }
+  DayComposer day_composer;
+  day_composer.Add(year);
+  day_composer.Add(month);
+  day_composer.Add(day);
+  day_composer.set_iso_date();
+  TimeComposer time_composer;
+  time_composer.Add(hour);
+  time_composer.Add(minute);
+  time_composer.Add(second);
+  time_composer.AddFinal(millisecond);
+  TimeZoneComposer tz_composer;
+  tz_composer.Set(0);
+  return day_composer.Write(out) && time_composer.Write(out) &&
+         tz_composer.Write(out);
+}
+
+template <typename Char>
+int DateParser::ReadFixedDigits(Vector<Char> str, int start, int length) {
+  int value = 0;
+  for (int i = start; i < start + length; i++) {
+    DCHECK(IsDecimalDigit(str[i]));
+    value = value * 10 + (str[i] - '0');
+  }
+  return value;
+}
+
 template <typename Char>
 DateParser::DateToken DateParser::ParseES5DateTime(
     DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
@@ -352,6 +352,16 @@ class DateParser : public AllStatic {
     bool is_iso_date_;
   };
 
+  // Parses the exact format "YYYY-MM-DDTHH:mm:ss.sssZ" that toISOString
+  // produces, without going through the tokenizer. Returns false if the
+  // string has any other shape; the general parser handles it then.
+  template <typename Char>
+  static bool ParseISODateTimeFast(Vector<Char> str, FixedArray* output);
+
+  // Reads a number from |length| decimal digits starting at |start|.
+  template <typename Char>
+  static int ReadFixedDigits(Vector<Char> str, int start, int length);
+
   // Tries to parse an ES5 Date Time String. Returns the next token
   // to continue with in the legacy date string parser. If parsing is
   // complete, returns DateToken::EndOfInput(). If terminally unsuccessful,
@@ -1270,13 +1270,14 @@ bool Debug::PrepareFunctionForBreakPoints(Handle<SharedFunctionInfo> shared) {
   List<Handle<JSFunction> > functions;
   List<Handle<JSGeneratorObject> > suspended_generators;
 
-  // Flush all optimized code maps. Note that the below heap iteration does not
-  // cover this, because the given function might have been inlined into code
-  // for which no JSFunction exists.
+  // Flush the optimized code which inlines the given function from all
+  // optimized code maps. Note that the below heap iteration does not cover
+  // this, because the given function might have been inlined into code for
+  // which no JSFunction exists. Optimized code of unrelated functions stays.
   {
     SharedFunctionInfo::Iterator iterator(isolate_);
-    while (SharedFunctionInfo* shared = iterator.Next()) {
-      shared->ClearCodeFromOptimizedCodeMap();
+    while (SharedFunctionInfo* candidate = iterator.Next()) {
+      candidate->ClearCodeInliningFromOptimizedCodeMap(*shared);
     }
   }
 
@@ -1507,6 +1508,10 @@ bool Debug::EnsureDebugInfo(Handle<SharedFunctionInfo> shared,
     return false;
   }
 
+  // Break locations are found through the source positions, which the debug
+  // copy of the bytecode shares with the original.
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
+
   // To prepare bytecode for debugging, we already need to have the debug
   // info (containing the debug copy) upfront, but since we do not recompile,
   // preparing for break points cannot fail.
@@ -1030,6 +1030,8 @@ void LiveEdit::ReplaceFunctionCode(
   int end_position = compile_info_wrapper.GetEndPosition();
   shared_info->set_start_position(start_position);
   shared_info->set_end_position(end_position);
+  // The preparsed data of inner functions refers to the old source positions.
+  shared_info->set_preparsed_scope_data(isolate->heap()->undefined_value());
 
   LiteralFixer::PatchLiterals(&compile_info_wrapper, shared_info,
                               feedback_metadata_changed, isolate);
@@ -1139,8 +1141,13 @@ void LiveEdit::PatchFunctionPositions(Handle<JSArray> shared_info_array,
   info->set_start_position(new_function_start);
   info->set_end_position(new_function_end);
   info->set_function_token_position(new_function_token_pos);
+  info->set_preparsed_scope_data(info->GetHeap()->undefined_value());
 
-  if (info->HasBytecodeArray()) {
+  // Source positions that have not been collected yet will be collected from
+  // the new source at the new function positions, so there is nothing to
+  // translate for them.
+  if (info->HasBytecodeArray() &&
+      info->bytecode_array()->HasSourcePositionTable()) {
     TranslateSourcePositionTable(
         Handle<AbstractCode>(AbstractCode::cast(info->bytecode_array())),
         position_change_array);
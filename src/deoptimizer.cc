@@ -230,11 +230,52 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(Context* context) {
     }
   };
 
+  Isolate* isolate = context->GetHeap()->isolate();
+
+  // Move marked code from the optimized code list to the deoptimized
+  // code list, collecting them into a ZoneList.
+  Zone zone(isolate->allocator());
+  ZoneList<Code*> codes(10, &zone);
+
+  // Walk over all optimized code objects in this native context.
+  Code* prev = NULL;
+  Object* element = context->OptimizedCodeListHead();
+  while (!element->IsUndefined(isolate)) {
+    Code* code = Code::cast(element);
+    CHECK_EQ(code->kind(), Code::OPTIMIZED_FUNCTION);
+    Object* next = code->next_code_link();
+
+    if (code->marked_for_deoptimization()) {
+      // Put the code into the list for later patching.
+      codes.Add(code, &zone);
+
+      if (prev != NULL) {
+        // Skip this code in the optimized code list.
+        prev->set_next_code_link(next);
+      } else {
+        // There was no previous node, the next node is the new head.
+        context->SetOptimizedCodeListHead(next);
+      }
+
+      // Move the code to the _deoptimized_ code list.
+      code->set_next_code_link(context->DeoptimizedCodeListHead());
+      context->SetDeoptimizedCodeListHead(code);
+    } else {
+      // Not marked; preserve this element.
+      prev = code;
+    }
+    element = next;
+  }
+
+  // Most calls come from DeoptimizeMarkedCode, which visits every native
+  // context, while the marked code usually belongs to only one of them. Skip
+  // the walk over all optimized functions of the others.
+  if (codes.is_empty()) return;
+
   // Unlink all functions that refer to marked code.
   SelectedCodeUnlinker unlinker;
   VisitAllOptimizedFunctionsForContext(context, &unlinker);
 
-  Isolate* isolate = context->GetHeap()->isolate();
 #ifdef DEBUG
   Code* topmost_optimized_code = NULL;
   bool safe_to_deopt_topmost_optimized_code = false;
@@ -274,41 +315,6 @@ void Deoptimizer::DeoptimizeMarkedCodeForContext(Context* context) {
   }
 #endif
 
-  // Move marked code from the optimized code list to the deoptimized
-  // code list, collecting them into a ZoneList.
-  Zone zone(isolate->allocator());
-  ZoneList<Code*> codes(10, &zone);
-
-  // Walk over all optimized code objects in this native context.
-  Code* prev = NULL;
-  Object* element = context->OptimizedCodeListHead();
-  while (!element->IsUndefined(isolate)) {
-    Code* code = Code::cast(element);
-    CHECK_EQ(code->kind(), Code::OPTIMIZED_FUNCTION);
-    Object* next = code->next_code_link();
-
-    if (code->marked_for_deoptimization()) {
-      // Put the code into the list for later patching.
-      codes.Add(code, &zone);
-
-      if (prev != NULL) {
-        // Skip this code in the optimized code list.
-        prev->set_next_code_link(next);
-      } else {
-        // There was no previous node, the next node is the new head.
-        context->SetOptimizedCodeListHead(next);
-      }
-
-      // Move the code to the _deoptimized_ code list.
-      code->set_next_code_link(context->DeoptimizedCodeListHead());
-      context->SetDeoptimizedCodeListHead(code);
-    } else {
-      // Not marked; preserve this element.
-      prev = code;
-    }
-    element = next;
-  }
-
   // We need a handle scope only because of the macro assembler,
   // which is used in code patching in EnsureCodeForDeoptimizationEntry.
   HandleScope scope(isolate);
@@ -476,6 +482,10 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
     }
   }
   compiled_code_ = FindOptimizedCode(function);
+  if (function != nullptr && function->IsOptimized() && type == EAGER &&
+      compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
+    RecordDeoptSite(function);
+  }
 #if DEBUG
   DCHECK(compiled_code_ != NULL);
   if (type == EAGER || type == SOFT || type == LAZY) {
@@ -513,6 +523,43 @@ Code* Deoptimizer::FindOptimizedCode(JSFunction* function) {
 }
 
 
+void Deoptimizer::RecordDeoptSite(JSFunction* function) {
+  if (FLAG_max_deopts_per_site <= 0 && !FLAG_trace_deopt_storms) return;
+  // Bound the size of the table; sites of long-lived deopt loops are quickly
+  // recorded again.
+  static const size_t kMaxDeoptSites = 1024;
+  std::map<DeoptimizerData::DeoptSite, int>& counts =
+      isolate_->deoptimizer_data()->deopt_site_counts_;
+  if (counts.size() >= kMaxDeoptSites) counts.clear();
+
+  SharedFunctionInfo* shared = function->shared();
+  DeoptInfo info = GetDeoptInfo(compiled_code_, from_);
+  int script_id = shared->script()->IsScript()
+                      ? Script::cast(shared->script())->id()
+                      : -1;
+  // Source positions are only tracked when profiling, but the bailout id of
+  // the deopt is always available and stable across recompilations.
+  DeoptimizationInputData* input_data =
+      DeoptimizationInputData::cast(compiled_code_->deoptimization_data());
+  DeoptimizerData::DeoptSite site(script_id, shared->start_position(),
+                                  input_data->AstId(bailout_id_).ToInt(),
+                                  info.deopt_reason);
+  int count = ++counts[site];
+
+  if (FLAG_trace_deopt_storms && count > 1) {
+    CodeTracer::Scope scope(isolate_->GetCodeTracer());
+    OFStream os(scope.file());
+    os << "[deopt storm: " << Brief(function) << " deoptimized " << count
+       << " times at " << info.position << " ("
+       << DeoptimizeReasonToString(info.deopt_reason) << ")]" << std::endl;
+  }
+  if (FLAG_max_deopts_per_site > 0 && count >= FLAG_max_deopts_per_site &&
+      !shared->optimization_disabled()) {
+    shared->DisableOptimization(kDeoptimizedTooOftenAtSameSite);
+  }
+}
+
+
 void Deoptimizer::PrintFunctionName() {
   if (function_ != nullptr && function_->IsJSFunction()) {
     function_->ShortPrint(trace_scope_->file());
@@ -5,6 +5,9 @@
 #ifndef V8_DEOPTIMIZER_H_
 #define V8_DEOPTIMIZER_H_
 
+#include <map>
+#include <tuple>
+
 #include "src/allocation.h"
 #include "src/deoptimize-reason.h"
 #include "src/macro-assembler.h"
@@ -515,6 +518,9 @@ class Deoptimizer : public Malloced {
               unsigned bailout_id, Address from, int fp_to_sp_delta);
   Code* FindOptimizedCode(JSFunction* function);
   void PrintFunctionName();
+  // Counts eager deopts per site and reason, and disables optimization of
+  // {function} if it keeps deoptimizing at the same site.
+  void RecordDeoptSite(JSFunction* function);
   void DeleteFrameDescriptions();
 
   void DoComputeOutputFrames();
@@ -836,6 +842,12 @@ class DeoptimizerData {
 
   Deoptimizer* current_;
 
+  // Eager deopts per site, used to detect deopt loops. A site is identified
+  // by the script id and start position of the function, and the bailout id
+  // and reason of the deopt.
+  typedef std::tuple<int, int, int, DeoptimizeReason> DeoptSite;
+  std::map<DeoptSite, int> deopt_site_counts_;
+
   friend class Deoptimizer;
 
   DISALLOW_COPY_AND_ASSIGN(DeoptimizerData);
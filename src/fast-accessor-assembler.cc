@@ -4,6 +4,8 @@
 
 #include "src/fast-accessor-assembler.h"
 
+#include <algorithm>
+
 #include "src/base/logging.h"
 #include "src/code-stub-assembler.h"
 #include "src/code-stubs.h"  // For CallApiCallbackStub.
@@ -29,11 +31,13 @@ FastAccessorAssembler::~FastAccessorAssembler() { Clear(); }
 FastAccessorAssembler::ValueId FastAccessorAssembler::IntegerConstant(
     int const_value) {
   CHECK_EQ(kBuilding, state_);
+  Record(kIntegerConstant, const_value);
   return FromRaw(assembler_->NumberConstant(const_value));
 }
 
 FastAccessorAssembler::ValueId FastAccessorAssembler::GetReceiver() {
   CHECK_EQ(kBuilding, state_);
+  Record(kGetReceiver);
 
   // For JS functions, the receiver is parameter 0.
   return FromRaw(assembler_->Parameter(0));
@@ -42,13 +46,14 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::GetReceiver() {
 FastAccessorAssembler::ValueId FastAccessorAssembler::LoadInternalField(
     ValueId value, int field_no) {
   CHECK_EQ(kBuilding, state_);
+  Record(kLoadInternalField, static_cast<int>(value.value_id), field_no);
 
   CodeStubAssembler::Variable result(assembler_.get(),
                                      MachineRepresentation::kTagged);
-  LabelId is_not_jsobject = MakeLabel();
+  CodeStubAssembler::Label is_not_jsobject(assembler_.get());
   CodeStubAssembler::Label merge(assembler_.get(), &result);
 
-  CheckIsJSObjectOrJump(value, is_not_jsobject);
+  CheckIsJSObjectOrJump(FromId(value), &is_not_jsobject);
 
   Node* internal_field = assembler_->LoadObjectField(
       FromId(value), JSObject::kHeaderSize + kPointerSize * field_no,
@@ -58,7 +63,7 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::LoadInternalField(
   assembler_->Goto(&merge);
 
   // Return null, mimicking the C++ counterpart.
-  SetLabel(is_not_jsobject);
+  assembler_->Bind(&is_not_jsobject);
   result.Bind(assembler_->NullConstant());
   assembler_->Goto(&merge);
 
@@ -70,19 +75,21 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::LoadInternalField(
 FastAccessorAssembler::ValueId
 FastAccessorAssembler::LoadInternalFieldUnchecked(ValueId value, int field_no) {
   CHECK_EQ(kBuilding, state_);
+  Record(kLoadInternalFieldUnchecked, static_cast<int>(value.value_id),
+         field_no);
 
   // Defensive debug checks.
   if (FLAG_debug_code) {
-    LabelId is_jsobject = MakeLabel();
-    LabelId is_not_jsobject = MakeLabel();
-    CheckIsJSObjectOrJump(value, is_not_jsobject);
-    assembler_->Goto(FromId(is_jsobject));
+    CodeStubAssembler::Label is_jsobject(assembler_.get());
+    CodeStubAssembler::Label is_not_jsobject(assembler_.get());
+    CheckIsJSObjectOrJump(FromId(value), &is_not_jsobject);
+    assembler_->Goto(&is_jsobject);
 
-    SetLabel(is_not_jsobject);
+    assembler_->Bind(&is_not_jsobject);
     assembler_->DebugBreak();
-    assembler_->Goto(FromId(is_jsobject));
+    assembler_->Goto(&is_jsobject);
 
-    SetLabel(is_jsobject);
+    assembler_->Bind(&is_jsobject);
   }
 
   Node* result = assembler_->LoadObjectField(
@@ -95,6 +102,7 @@ FastAccessorAssembler::LoadInternalFieldUnchecked(ValueId value, int field_no) {
 FastAccessorAssembler::ValueId FastAccessorAssembler::LoadValue(ValueId value,
                                                                 int offset) {
   CHECK_EQ(kBuilding, state_);
+  Record(kLoadValue, static_cast<int>(value.value_id), offset);
   return FromRaw(assembler_->LoadBufferObject(FromId(value), offset,
                                               MachineType::IntPtr()));
 }
@@ -102,6 +110,7 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::LoadValue(ValueId value,
 FastAccessorAssembler::ValueId FastAccessorAssembler::LoadObject(ValueId value,
                                                                  int offset) {
   CHECK_EQ(kBuilding, state_);
+  Record(kLoadObject, static_cast<int>(value.value_id), offset);
   return FromRaw(assembler_->LoadBufferObject(
       assembler_->LoadBufferObject(FromId(value), offset,
                                    MachineType::Pointer()),
@@ -110,16 +119,19 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::LoadObject(ValueId value,
 
 FastAccessorAssembler::ValueId FastAccessorAssembler::ToSmi(ValueId value) {
   CHECK_EQ(kBuilding, state_);
+  Record(kToSmi, static_cast<int>(value.value_id));
   return FromRaw(assembler_->SmiTag(FromId(value)));
 }
 
 void FastAccessorAssembler::ReturnValue(ValueId value) {
   CHECK_EQ(kBuilding, state_);
+  Record(kReturnValue, static_cast<int>(value.value_id));
   assembler_->Return(FromId(value));
 }
 
 void FastAccessorAssembler::CheckFlagSetOrReturnNull(ValueId value, int mask) {
   CHECK_EQ(kBuilding, state_);
+  Record(kCheckFlagSetOrReturnNull, static_cast<int>(value.value_id), mask);
   CodeStubAssembler::Label pass(assembler_.get());
   CodeStubAssembler::Label fail(assembler_.get());
   assembler_->Branch(
@@ -134,6 +146,7 @@ void FastAccessorAssembler::CheckFlagSetOrReturnNull(ValueId value, int mask) {
 
 void FastAccessorAssembler::CheckNotZeroOrReturnNull(ValueId value) {
   CHECK_EQ(kBuilding, state_);
+  Record(kCheckNotZeroOrReturnNull, static_cast<int>(value.value_id));
   CodeStubAssembler::Label is_null(assembler_.get());
   CodeStubAssembler::Label not_null(assembler_.get());
   assembler_->Branch(
@@ -146,22 +159,27 @@ void FastAccessorAssembler::CheckNotZeroOrReturnNull(ValueId value) {
 
 FastAccessorAssembler::LabelId FastAccessorAssembler::MakeLabel() {
   CHECK_EQ(kBuilding, state_);
+  Record(kMakeLabel);
   return FromRaw(new CodeStubAssembler::Label(assembler_.get()));
 }
 
 void FastAccessorAssembler::SetLabel(LabelId label_id) {
   CHECK_EQ(kBuilding, state_);
+  Record(kSetLabel, static_cast<int>(label_id.label_id));
   assembler_->Bind(FromId(label_id));
 }
 
 void FastAccessorAssembler::Goto(LabelId label_id) {
   CHECK_EQ(kBuilding, state_);
+  Record(kGoto, static_cast<int>(label_id.label_id));
   assembler_->Goto(FromId(label_id));
 }
 
 void FastAccessorAssembler::CheckNotZeroOrJump(ValueId value_id,
                                                LabelId label_id) {
   CHECK_EQ(kBuilding, state_);
+  Record(kCheckNotZeroOrJump, static_cast<int>(value_id.value_id),
+         static_cast<int>(label_id.label_id));
   CodeStubAssembler::Label pass(assembler_.get());
   assembler_->Branch(
       assembler_->WordEqual(FromId(value_id), assembler_->IntPtrConstant(0)),
@@ -172,6 +190,7 @@ void FastAccessorAssembler::CheckNotZeroOrJump(ValueId value_id,
 FastAccessorAssembler::ValueId FastAccessorAssembler::Call(
     FunctionCallback callback_function, ValueId arg) {
   CHECK_EQ(kBuilding, state_);
+  Record(kCall, static_cast<int>(arg.value_id));
 
   // Wrap the FunctionCallback in an ExternalReference.
   ApiFunction callback_api_function(FUNCTION_ADDR(callback_function));
@@ -212,14 +231,13 @@ FastAccessorAssembler::ValueId FastAccessorAssembler::Call(
   return FromRaw(call);
 }
 
-void FastAccessorAssembler::CheckIsJSObjectOrJump(ValueId value_id,
-                                                  LabelId label_id) {
+void FastAccessorAssembler::CheckIsJSObjectOrJump(
+    Node* value, CodeStubAssembler::Label* label) {
   CHECK_EQ(kBuilding, state_);
 
   // Determine the 'value' object's instance type.
   Node* object_map = assembler_->LoadObjectField(
-      FromId(value_id), Internals::kHeapObjectMapOffset,
-      MachineType::Pointer());
+      value, Internals::kHeapObjectMapOffset, MachineType::Pointer());
 
   Node* instance_type = assembler_->WordAnd(
       assembler_->LoadObjectField(object_map,
@@ -239,7 +257,7 @@ void FastAccessorAssembler::CheckIsJSObjectOrJump(ValueId value_id,
   assembler_->GotoUnless(
       assembler_->WordEqual(instance_type, assembler_->IntPtrConstant(
                                                Internals::kJSApiObjectType)),
-      FromId(label_id));
+      label);
 
   // Continue.
   assembler_->Goto(&is_jsobject);
@@ -250,10 +268,71 @@ MaybeHandle<Code> FastAccessorAssembler::Build() {
   CHECK_EQ(kBuilding, state_);
   Handle<Code> code = assembler_->GenerateCode();
   state_ = !code.is_null() ? kBuilt : kError;
+  // Programs with operands which don't fit into a Smi are just not recorded.
+  if (state_ == kBuilt &&
+      std::all_of(operations_.begin(), operations_.end(), Smi::IsValid)) {
+    Handle<FixedArray> program = isolate()->factory()->NewFixedArray(
+        static_cast<int>(operations_.size()), TENURED);
+    for (size_t i = 0; i < operations_.size(); ++i) {
+      program->set(static_cast<int>(i), Smi::FromInt(operations_[i]));
+    }
+    program_ = program;
+  }
   Clear();
   return code;
 }
 
+// static
+bool FastAccessorAssembler::IsInlineable(FixedArray* program) {
+  // The state of each label: whether it was set, and whether it is jumped to.
+  std::vector<bool> label_set;
+  std::vector<bool> label_used;
+  bool reachable = true;
+  for (int i = 0; i < program->length(); i += kOperationSize) {
+    Opcode opcode = static_cast<Opcode>(Smi::cast(program->get(i))->value());
+    int operand0 = Smi::cast(program->get(i + 1))->value();
+    int operand1 = Smi::cast(program->get(i + 2))->value();
+    // Code after a return or a jump is only reachable through a label.
+    if (!reachable && opcode != kMakeLabel && opcode != kSetLabel) {
+      return false;
+    }
+    switch (opcode) {
+      case kCall:
+        return false;
+      case kReturnValue:
+        reachable = false;
+        break;
+      case kMakeLabel:
+        label_set.push_back(false);
+        label_used.push_back(false);
+        break;
+      case kSetLabel:
+        if (label_set[operand0]) return false;
+        label_set[operand0] = true;
+        reachable = reachable || label_used[operand0];
+        break;
+      case kGoto:
+        if (label_set[operand0]) return false;
+        label_used[operand0] = true;
+        reachable = false;
+        break;
+      case kCheckNotZeroOrJump:
+        if (label_set[operand1]) return false;
+        label_used[operand1] = true;
+        break;
+      default:
+        break;
+    }
+  }
+  return !reachable;
+}
+
+void FastAccessorAssembler::Record(Opcode opcode, int operand0, int operand1) {
+  operations_.push_back(opcode);
+  operations_.push_back(operand0);
+  operations_.push_back(operand1);
+}
+
 FastAccessorAssembler::ValueId FastAccessorAssembler::FromRaw(Node* node) {
   nodes_.push_back(node);
   ValueId value = {nodes_.size() - 1};
@@ -20,6 +20,7 @@ namespace v8 {
 namespace internal {
 
 class Code;
+class FixedArray;
 class Isolate;
 class Zone;
 
@@ -41,12 +42,37 @@ class Node;
 //
 // You cannot call any result getters before Build() was called & successful;
 // and you cannot call any builder functions after Build() was called.
+//
+// Besides the code, Build() records the sequence of builder calls as a
+// program, which TurboFan uses to inline the accessor into optimized code.
 class FastAccessorAssembler {
  public:
   typedef v8::experimental::FastAccessorBuilder::ValueId ValueId;
   typedef v8::experimental::FastAccessorBuilder::LabelId LabelId;
   typedef v8::FunctionCallback FunctionCallback;
 
+  // The operations of a program. Each operation takes kOperationSize entries:
+  // the opcode, followed by its operands. Operations which produce a value or
+  // a label implicitly number them in order, starting at 0.
+  enum Opcode {
+    kIntegerConstant,             // constant
+    kGetReceiver,                 //
+    kLoadInternalField,           // value, field_no
+    kLoadInternalFieldUnchecked,  // value, field_no
+    kLoadValue,                   // value, offset
+    kLoadObject,                  // value, offset
+    kToSmi,                       // value
+    kReturnValue,                 // value
+    kCheckFlagSetOrReturnNull,    // value, mask
+    kCheckNotZeroOrReturnNull,    // value
+    kMakeLabel,                   //
+    kSetLabel,                    // label
+    kGoto,                        // label
+    kCheckNotZeroOrJump,          // value, label
+    kCall                         // value
+  };
+  static const int kOperationSize = 3;
+
   explicit FastAccessorAssembler(Isolate* isolate);
   ~FastAccessorAssembler();
 
@@ -84,13 +110,23 @@ class FastAccessorAssembler {
   // Assemble the code.
   MaybeHandle<Code> Build();
 
+  // The recorded program, or a null handle if it could not be recorded. Only
+  // valid after a successful Build().
+  MaybeHandle<FixedArray> program() const { return program_; }
+
+  // Checks whether a program can be inlined: it must not call back into the
+  // embedder, jump only forward, and return on all paths.
+  static bool IsInlineable(FixedArray* program);
+
  private:
   ValueId FromRaw(compiler::Node* node);
   LabelId FromRaw(CodeStubAssembler::Label* label);
   compiler::Node* FromId(ValueId value) const;
   CodeStubAssembler::Label* FromId(LabelId value) const;
 
-  void CheckIsJSObjectOrJump(ValueId value, LabelId label_id);
+  void CheckIsJSObjectOrJump(compiler::Node* value,
+                             CodeStubAssembler::Label* label);
+  void Record(Opcode opcode, int operand0 = 0, int operand1 = 0);
 
   void Clear();
   Zone* zone() { return &zone_; }
@@ -106,6 +142,10 @@ class FastAccessorAssembler {
   std::vector<compiler::Node*> nodes_;
   std::vector<CodeStubAssembler::Label*> labels_;
 
+  // The builder calls so far, kOperationSize entries each.
+  std::vector<int> operations_;
+  MaybeHandle<FixedArray> program_;
+
   // Remember the current state for easy error checking. (We prefer to be
   // strict as this class will be exposed at the API.)
   enum { kBuilding, kBuilt, kError } state_;
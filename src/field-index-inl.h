@@ -86,7 +86,7 @@ inline int FieldIndex::GetLoadByFieldIndex() const {
 }
 
 // Returns the offset format consumed by TurboFan stubs:
-// (offset << 3) | (is_double << 2) | (is_inobject << 1) | is_property
+// (offset << 4) | (is_double << 3) | (is_inobject << 2) | is_property
 // Where |offset| is relative to object start or FixedArray start, respectively.
 inline int FieldIndex::GetLoadByFieldOffset() const {
   return FieldOffsetIsInobject::encode(is_inobject()) |
@@ -300,11 +300,20 @@ DEFINE_BOOL(ignition_deadcode, true,
             "use ignition dead code elimination optimizer")
 DEFINE_BOOL(ignition_osr, false, "enable support for OSR from ignition code")
 DEFINE_BOOL(ignition_peephole, true, "use ignition peephole optimizer")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse common bytecode pairs into superinstructions")
+// The fused bytecodes have no frame state between the test and the jump, so
+// they cannot be lowered by the bytecode graph builder.
+DEFINE_NEG_IMPLICATION(ignition_superinstructions, turbo_from_bytecode)
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_reo_across_jumps, false,
+            "keep register equivalences across conditional jumps")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_preserve_bytecode, true,
             "preserve generated bytecode even when switching tiers")
+DEFINE_BOOL(lazy_source_positions, false,
+            "omit source positions of bytecode and collect them when needed")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_BOOL(trace_ignition, false,
@@ -418,6 +427,8 @@ DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
             "block queued jobs until released")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile code for on-stack replacement on a separate thread")
 
 DEFINE_BOOL(omit_map_checks_for_leaf_maps, true,
             "do not emit check maps for constant values that have a leaf map, "
@@ -444,6 +455,8 @@ DEFINE_BOOL(trace_turbo_scheduler, false, "trace TurboFan's scheduler")
 DEFINE_BOOL(trace_turbo_reduction, false, "trace TurboFan's various reducers")
 DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
+DEFINE_BOOL(trace_turbo_alloc_stats, false,
+            "print TurboFan's spill slot and gap move counts per function")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
 DEFINE_BOOL(turbo_asm, true, "enable TurboFan for asm.js code")
@@ -464,6 +477,8 @@ DEFINE_IMPLICATION(trace_turbo, turbo_source_positions)
 DEFINE_BOOL(function_context_specialization, false,
             "enable function context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
+DEFINE_FLOAT(min_inlining_frequency, 0.0,
+             "minimum relative call site frequency for TurboFan inlining")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
 DEFINE_BOOL(turbo_load_elimination, true, "enable load elimination in TurboFan")
 DEFINE_BOOL(trace_turbo_load_elimination, false,
@@ -513,6 +528,9 @@ DEFINE_BOOL(wasm_break_on_decoder_error, false,
             "debug break when wasm decoder encounters an error")
 DEFINE_BOOL(wasm_loop_assignment_analysis, true,
             "perform loop assignment analysis for WASM")
+DEFINE_BOOL(wasm_fast_compilation, false,
+            "compile WASM functions with a reduced TurboFan backend for faster "
+            "startup")
 
 DEFINE_BOOL(validate_asm, false, "validate asm.js modules before compiling")
 
@@ -528,10 +546,18 @@ DEFINE_BOOL(wasm_eh_prototype, false,
             "enable prototype exception handling opcodes for wasm")
 DEFINE_BOOL(wasm_mv_prototype, false,
             "enable prototype multi-value support for wasm")
+DEFINE_BOOL(wasm_lazy_compilation, false,
+            "compile wasm functions on their first call instead of when the "
+            "module is compiled")
+DEFINE_BOOL(wasm_atomics_prototype, false,
+            "enable prototype atomic opcodes and shared memory for wasm")
 
 DEFINE_BOOL(wasm_trap_handler, false,
             "use signal handlers to catch out of bounds memory access in wasm"
             " (currently Linux x86_64 only)")
+DEFINE_BOOL(wasm_guard_regions, false,
+            "reserve 8 GiB of address space for each wasm memory on 64-bit "
+            "hosts, so that memories grow in place")
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
@@ -625,13 +651,27 @@ DEFINE_BOOL(trace_file_names, false,
 DEFINE_BOOL(opt, true, "use adaptive optimizations")
 DEFINE_BOOL(always_opt, false, "always try to optimize functions")
 DEFINE_BOOL(always_osr, false, "always try to OSR functions")
+DEFINE_BOOL(compiler_dispatcher, false,
+            "compile likely-to-run lazy functions in idle time and on "
+            "background threads")
+DEFINE_BOOL(trace_compiler_dispatcher, false,
+            "trace compiler dispatcher activity")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
 DEFINE_BOOL(trace_deopt, false, "trace optimize function deoptimization")
+DEFINE_INT(max_deopts_per_site, 0,
+           "number of eager deopts at the same site and for the same reason "
+           "before optimization of the function is disabled (0 = no limit)")
+DEFINE_BOOL(trace_deopt_storms, false,
+            "trace repeated deopts at the same site and for the same reason")
 DEFINE_BOOL(trace_stub_failures, false,
             "trace deoptimization of generated code stubs")
 
 DEFINE_BOOL(serialize_toplevel, true, "enable caching of toplevel scripts")
+DEFINE_BOOL(serialize_lazy_functions, false,
+            "deserialize inner functions in the code cache on first call")
 DEFINE_BOOL(serialize_eager, false, "compile eagerly when caching scripts")
+DEFINE_BOOL(shared_code_cache, false,
+            "share cached code of toplevel scripts between isolates")
 DEFINE_BOOL(serialize_age_code, false, "pre age code in the code cache")
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
 
@@ -643,6 +683,11 @@ DEFINE_INT(max_opt_count, 10,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_INT(regexp_cache_generations, 2,
+           "number of mark-compacts a cached regexp survives without being "
+           "used (at least 2)")
+DEFINE_BOOL(function_cache, true,
+            "share the code of identical functions of different scripts")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -720,6 +765,8 @@ DEFINE_BOOL(trace_fragmentation, false, "report fragmentation for old space")
 DEFINE_BOOL(trace_fragmentation_verbose, false,
             "report fragmentation for old space (detailed)")
 DEFINE_BOOL(trace_evacuation, false, "report evacuation statistics")
+DEFINE_BOOL(trace_parallel_scavenge, false,
+            "report parallel scavenge statistics")
 DEFINE_BOOL(trace_mutator_utilization, false,
             "print mutator utilization, allocation speed, gc speed")
 DEFINE_BOOL(weak_embedded_maps_in_optimized_code, true,
@@ -727,6 +774,8 @@ DEFINE_BOOL(weak_embedded_maps_in_optimized_code, true,
 DEFINE_BOOL(weak_embedded_objects_in_optimized_code, true,
             "make objects embedded in optimized code weak")
 DEFINE_BOOL(flush_code, true, "flush code that we expect not to use again")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush bytecode that we expect not to use again")
 DEFINE_BOOL(trace_code_flushing, false, "trace code flushing progress")
 DEFINE_BOOL(age_code, true,
             "track un-executed functions to age code and flush only "
@@ -740,8 +789,14 @@ DEFINE_INT(min_progress_during_incremental_marking_finalization, 32,
 DEFINE_INT(max_incremental_marking_finalization_rounds, 3,
            "at most try this many times to finalize incremental marking")
 DEFINE_BOOL(black_allocation, false, "use black allocation")
+DEFINE_BOOL(concurrent_marking, false, "use concurrent marking")
+DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_store_buffer, false,
+            "use concurrent store buffer processing")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_BOOL(parallel_marking, false,
+            "use parallel marking in the atomic pause of full GCs")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(trace_incremental_marking, false,
@@ -752,6 +807,8 @@ DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_NEG_IMPLICATION(trace_gc_object_stats, incremental_marking)
+DEFINE_BOOL(track_context_live_size, false,
+            "attribute live objects to native contexts after mark-compact")
 DEFINE_BOOL(track_detached_contexts, true,
             "track native contexts that are expected to be garbage collected")
 DEFINE_BOOL(trace_detached_contexts, false,
@@ -764,8 +821,14 @@ DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
 DEFINE_BOOL(scavenge_reclaim_unmodified_objects, true,
             "remove unmodified and unreferenced objects")
+DEFINE_BOOL(parallel_scavenge, false,
+            "scavenge objects reachable from old-to-new slots in parallel")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
+DEFINE_BOOL(huge_pages, false,
+            "advise the OS to back committed heap memory with transparent "
+            "huge pages, where supported")
+DEFINE_BOOL(trace_huge_pages, false, "trace transparent huge page hints")
 
 // execution.cc, messages.cc
 DEFINE_BOOL(clear_exceptions_on_js_entry, false,
@@ -911,7 +974,12 @@ DEFINE_BOOL(profile_hydrogen_code_stub_compilation, false,
 DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_NEG_IMPLICATION(predictable, concurrent_recompilation)
 DEFINE_NEG_IMPLICATION(predictable, concurrent_sweeping)
+DEFINE_NEG_IMPLICATION(predictable, concurrent_store_buffer)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compaction)
+DEFINE_NEG_IMPLICATION(predictable, parallel_scavenge)
+DEFINE_NEG_IMPLICATION(predictable, concurrent_marking)
+DEFINE_NEG_IMPLICATION(predictable, parallel_marking)
+DEFINE_NEG_IMPLICATION(predictable, compiler_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, memory_reducer)
 
 // mark-compact.cc
@@ -1072,7 +1140,6 @@ DEFINE_BOOL(perf_basic_prof_only_functions, false,
 DEFINE_IMPLICATION(perf_basic_prof_only_functions, perf_basic_prof)
 DEFINE_BOOL(perf_prof, false,
             "Enable perf linux profiler (experimental annotate support).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 DEFINE_BOOL(perf_prof_debug_info, false,
             "Enable debug info for perf linux profiler (experimental).")
 DEFINE_BOOL(perf_prof_unwinding_info, false,
@@ -1106,6 +1106,13 @@ FrameSummary FrameSummary::GetFirst(JavaScriptFrame* frame) {
   return frames.first();
 }
 
+void FrameSummary::EnsureSourcePositionsAvailable() {
+  if (abstract_code()->IsBytecodeArray()) {
+    Handle<SharedFunctionInfo> shared(function()->shared());
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
+  }
+}
+
 void FrameSummary::Print() {
   PrintF("receiver: ");
   receiver_->ShortPrint();
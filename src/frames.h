@@ -715,6 +715,10 @@ class FrameSummary BASE_EMBEDDED {
   int code_offset() const { return code_offset_; }
   bool is_constructor() const { return is_constructor_; }
 
+  // Makes sure that source positions can be looked up in the abstract code.
+  // This might compile and hence allocate.
+  void EnsureSourcePositionsAvailable();
+
   void Print();
 
  private:
@@ -16,24 +16,33 @@
 namespace v8 {
 namespace internal {
 
-base::LazyMutex FutexEmulation::mutex_ = LAZY_MUTEX_INITIALIZER;
-base::LazyInstance<FutexWaitList>::type FutexEmulation::wait_list_ =
+base::LazyInstance<FutexWaitTable>::type FutexEmulation::wait_table_ =
     LAZY_INSTANCE_INITIALIZER;
 
 
 void FutexWaitListNode::NotifyWake() {
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
+  // Lock the mutex of the wait list before notifying. We know that the mutex
   // will have been unlocked if we are currently waiting on the condition
   // variable.
   //
   // The mutex may also not be locked if the other thread is currently handling
-  // interrupts, or if FutexEmulation::Wait was just called and the mutex
-  // hasn't been locked yet. In either of those cases, we set the interrupted
-  // flag to true, which will be tested after the mutex is re-locked.
-  base::LockGuard<base::Mutex> lock_guard(FutexEmulation::mutex_.Pointer());
-  if (waiting_) {
-    cond_.NotifyOne();
-    interrupted_ = true;
+  // interrupts. In that case, we set the interrupted flag to true, which will
+  // be tested after the mutex is re-locked.
+  //
+  // If FutexEmulation::Wait hasn't put this node on a wait list yet, the
+  // notification is dropped like before.
+  while (true) {
+    FutexWaitList* wait_list = wait_list_.Value();
+    if (wait_list == nullptr) return;
+    base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+    // The node may have left the list before we got the mutex, and may even be
+    // waiting on a different list already; in that case, try again.
+    if (wait_list_.Value() != wait_list) continue;
+    if (waiting_) {
+      cond_.NotifyOne();
+      interrupted_ = true;
+    }
+    return;
   }
 }
 
@@ -72,6 +81,14 @@ void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
 }
 
 
+FutexWaitList* FutexWaitTable::ListFor(void* backing_store, size_t addr) {
+  // Wait addresses are 4-byte aligned, so the low bits carry no information.
+  uintptr_t key = reinterpret_cast<uintptr_t>(backing_store) + addr;
+  uint32_t hash = ComputeIntegerHash(static_cast<uint32_t>(key >> 2), 0);
+  return &lists_[hash & (kNumLists - 1)];
+}
+
+
 Object* FutexEmulation::Wait(Isolate* isolate,
                              Handle<JSArrayBuffer> array_buffer, size_t addr,
                              int32_t value, double rel_timeout_ms) {
@@ -81,7 +98,10 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   int32_t* p =
       reinterpret_cast<int32_t*>(static_cast<int8_t*>(backing_store) + addr);
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitList* wait_list =
+      wait_table_.Pointer()->ListFor(backing_store, addr);
+  base::Mutex* mutex = &wait_list->mutex_;
+  base::LockGuard<base::Mutex> lock_guard(mutex);
 
   if (*p != value) {
     return isolate->heap()->not_equal();
@@ -89,6 +109,7 @@ Object* FutexEmulation::Wait(Isolate* isolate,
 
   FutexWaitListNode* node = isolate->futex_wait_list_node();
 
+  node->wait_list_.SetValue(wait_list);
   node->backing_store_ = backing_store;
   node->wait_addr_ = addr;
   node->waiting_ = true;
@@ -116,7 +137,7 @@ Object* FutexEmulation::Wait(Isolate* isolate,
   base::TimeTicks timeout_time = start_time + rel_timeout;
   base::TimeTicks current_time = start_time;
 
-  wait_list_.Pointer()->AddNode(node);
+  wait_list->AddNode(node);
 
   Object* result;
 
@@ -125,18 +146,18 @@ Object* FutexEmulation::Wait(Isolate* isolate,
     node->interrupted_ = false;
 
     // Unlock the mutex here to prevent deadlock from lock ordering between
-    // mutex_ and mutexes locked by HandleInterrupts.
-    mutex_.Pointer()->Unlock();
+    // the wait list mutex and mutexes locked by HandleInterrupts.
+    mutex->Unlock();
 
     // Because the mutex is unlocked, we have to be careful about not dropping
     // an interrupt. The notification can happen in three different places:
     // 1) Before Wait is called: the notification will be dropped, but
     //    interrupted_ will be set to 1. This will be checked below.
-    // 2) After interrupted has been checked here, but before mutex_ is
-    //    acquired: interrupted is checked again below, with mutex_ locked.
-    //    Because the wakeup signal also acquires mutex_, we know it will not
-    //    be able to notify until mutex_ is released below, when waiting on the
-    //    condition variable.
+    // 2) After interrupted has been checked here, but before the mutex is
+    //    acquired: interrupted is checked again below, with the mutex locked.
+    //    Because the wakeup signal also acquires the mutex, we know it will
+    //    not be able to notify until the mutex is released below, when
+    //    waiting on the condition variable.
     // 3) After the mutex is released in the call to WaitFor(): this
     // notification will wake up the condition variable. node->waiting() will
     // be false, so we'll loop and then check interrupts.
@@ -144,15 +165,15 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       Object* interrupt_object = isolate->stack_guard()->HandleInterrupts();
       if (interrupt_object->IsException(isolate)) {
         result = interrupt_object;
-        mutex_.Pointer()->Lock();
+        mutex->Lock();
         break;
       }
     }
 
-    mutex_.Pointer()->Lock();
+    mutex->Lock();
 
     if (node->interrupted_) {
-      // An interrupt occured while the mutex_ was unlocked. Don't wait yet.
+      // An interrupt occured while the mutex was unlocked. Don't wait yet.
       continue;
     }
 
@@ -172,17 +193,18 @@ Object* FutexEmulation::Wait(Isolate* isolate,
       base::TimeDelta time_until_timeout = timeout_time - current_time;
       DCHECK(time_until_timeout.InMicroseconds() >= 0);
       bool wait_for_result =
-          node->cond_.WaitFor(mutex_.Pointer(), time_until_timeout);
+          node->cond_.WaitFor(mutex, time_until_timeout);
       USE(wait_for_result);
     } else {
-      node->cond_.Wait(mutex_.Pointer());
+      node->cond_.Wait(mutex);
     }
 
     // Spurious wakeup, interrupt or timeout.
   }
 
-  wait_list_.Pointer()->RemoveNode(node);
+  wait_list->RemoveNode(node);
   node->waiting_ = false;
+  node->wait_list_.SetValue(nullptr);
 
   return result;
 }
@@ -196,8 +218,10 @@ Object* FutexEmulation::Wake(Isolate* isolate,
   int waiters_woken = 0;
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitList* wait_list =
+      wait_table_.Pointer()->ListFor(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
+  FutexWaitListNode* node = wait_list->head_;
   while (node && num_waiters_to_wake > 0) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
       node->waiting_ = false;
@@ -219,10 +243,12 @@ Object* FutexEmulation::NumWaitersForTesting(Isolate* isolate,
   DCHECK(addr < NumberToSize(array_buffer->byte_length()));
   void* backing_store = array_buffer->backing_store();
 
-  base::LockGuard<base::Mutex> lock_guard(mutex_.Pointer());
+  FutexWaitList* wait_list =
+      wait_table_.Pointer()->ListFor(backing_store, addr);
+  base::LockGuard<base::Mutex> lock_guard(&wait_list->mutex_);
 
   int waiters = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitListNode* node = wait_list->head_;
   while (node) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
@@ -8,6 +8,7 @@
 #include <stdint.h>
 
 #include "src/allocation.h"
+#include "src/base/atomic-utils.h"
 #include "src/base/atomicops.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
@@ -31,6 +32,7 @@ class TimeDelta;
 
 namespace internal {
 
+class FutexWaitList;
 class Isolate;
 class JSArrayBuffer;
 
@@ -42,7 +44,8 @@ class FutexWaitListNode {
         backing_store_(nullptr),
         wait_addr_(0),
         waiting_(false),
-        interrupted_(false) {}
+        interrupted_(false),
+        wait_list_(nullptr) {}
 
   void NotifyWake();
 
@@ -57,11 +60,17 @@ class FutexWaitListNode {
   size_t wait_addr_;
   bool waiting_;
   bool interrupted_;
+  // The list this node is on while its thread is in FutexEmulation::Wait, or
+  // nullptr. It is only written with the mutex of that list held, but can be
+  // read without a lock by NotifyWake to find the mutex to take.
+  base::AtomicValue<FutexWaitList*> wait_list_;
 
   DISALLOW_COPY_AND_ASSIGN(FutexWaitListNode);
 };
 
 
+// The waiters of all locations which hash to the same bucket of the
+// FutexWaitTable, guarded by their own mutex.
 class FutexWaitList {
  public:
   FutexWaitList();
@@ -71,7 +80,9 @@ class FutexWaitList {
 
  private:
   friend class FutexEmulation;
+  friend class FutexWaitListNode;
 
+  base::Mutex mutex_;
   FutexWaitListNode* head_;
   FutexWaitListNode* tail_;
 
@@ -79,6 +90,24 @@ class FutexWaitList {
 };
 
 
+// Maps a (backing store, address) pair to the wait list its waiters are kept
+// on. Waits and wakes on locations in different buckets don't contend for the
+// same mutex, and a wake only visits the waiters of its own bucket.
+class FutexWaitTable {
+ public:
+  FutexWaitTable() {}
+
+  FutexWaitList* ListFor(void* backing_store, size_t addr);
+
+ private:
+  static const int kNumLists = 64;
+
+  FutexWaitList lists_[kNumLists];
+
+  DISALLOW_COPY_AND_ASSIGN(FutexWaitTable);
+};
+
+
 class FutexEmulation : public AllStatic {
  public:
   // Check that array_buffer[addr] == value, and return "not-equal" if not. If
@@ -103,10 +132,7 @@ class FutexEmulation : public AllStatic {
                                       size_t addr);
 
  private:
-  friend class FutexWaitListNode;
-
-  static base::LazyMutex mutex_;
-  static base::LazyInstance<FutexWaitList>::type wait_list_;
+  static base::LazyInstance<FutexWaitTable>::type wait_table_;
 };
 }  // namespace internal
 }  // namespace v8
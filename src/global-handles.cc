@@ -675,6 +675,7 @@ void GlobalHandles::IterateWeakRoots(ObjectVisitor* v) {
         node->CollectPhantomCallbackData(isolate(),
                                          &pending_phantom_callbacks_);
       } else {
+        if (node->state() == Node::PENDING) pending_weak_nodes_.Add(node);
         v->VisitPointer(node->location());
       }
     }
@@ -1000,25 +1001,33 @@ int GlobalHandles::PostScavengeProcessing(
 
 int GlobalHandles::PostMarkSweepProcessing(
     const int initial_post_gc_processing_count) {
-  int freed_nodes = 0;
-  for (NodeIterator it(this); !it.done(); it.Advance()) {
-    if (!it.node()->IsRetainer()) {
-      // Free nodes do not have weak callbacks. Do not use them to compute
-      // the freed_nodes.
-      continue;
-    }
+  // The active and partially dependent flags are only ever set on nodes in
+  // the new space list, so there is no need to walk all the other nodes.
+  for (int i = 0; i < new_space_nodes_.length(); ++i) {
+    Node* node = new_space_nodes_[i];
+    if (!node->IsRetainer()) continue;
     if (FLAG_scavenge_reclaim_unmodified_objects) {
-      it.node()->set_active(false);
+      node->set_active(false);
     } else {
-      it.node()->clear_partially_dependent();
+      node->clear_partially_dependent();
     }
-    if (it.node()->PostGarbageCollectionProcessing(isolate_)) {
+  }
+
+  // Only the nodes IterateWeakRoots found pending can have weak callbacks to
+  // run. Nodes which are left over because a callback triggered another GC
+  // are still pending, so the next mark-compact picks them up again.
+  List<Node*> pending_weak_nodes;
+  pending_weak_nodes.Swap(&pending_weak_nodes_);
+  int freed_nodes = 0;
+  for (int i = 0; i < pending_weak_nodes.length(); ++i) {
+    Node* node = pending_weak_nodes[i];
+    if (node->PostGarbageCollectionProcessing(isolate_)) {
       if (initial_post_gc_processing_count != post_gc_processing_count_) {
         // See the comment above.
         return freed_nodes;
       }
     }
-    if (!it.node()->IsRetainer()) {
+    if (!node->IsRetainer()) {
       freed_nodes++;
     }
   }
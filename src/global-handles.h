@@ -341,6 +341,10 @@ class GlobalHandles {
   // is accessed, some of the objects may have been promoted already.
   List<Node*> new_space_nodes_;
 
+  // Nodes which IterateWeakRoots found pending and kept alive for their weak
+  // callbacks. PostMarkSweepProcessing only has to look at these nodes.
+  List<Node*> pending_weak_nodes_;
+
   int post_gc_processing_count_;
 
   size_t number_of_phantom_handle_resets_;
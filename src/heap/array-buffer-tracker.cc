@@ -5,6 +5,7 @@
 #include "src/heap/array-buffer-tracker.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/heap.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -62,7 +63,7 @@ void LocalArrayBufferTracker::Process(Callback callback) {
       it = array_buffers_.erase(it);
     } else if (result == kRemoveEntry) {
       const size_t len = it->second;
-      heap_->isolate()->array_buffer_allocator()->Free(
+      heap_->array_buffer_freer()->AddBackingStoreSafe(
           it->first->backing_store(), len);
       freed_memory += len;
       it = array_buffers_.erase(it);
@@ -83,6 +84,7 @@ void ArrayBufferTracker::FreeDeadInNewSpace(Heap* heap) {
     bool empty = ProcessBuffers(page, kUpdateForwardedRemoveOthers);
     CHECK(empty);
   }
+  heap->array_buffer_freer()->FreeQueued();
   heap->account_external_memory_concurrently_freed();
 }
 
@@ -135,5 +137,69 @@ bool ArrayBufferTracker::IsTracked(JSArrayBuffer* buffer) {
   }
 }
 
+class ArrayBufferFreer::FreeBackingStoresTask : public v8::Task {
+ public:
+  explicit FreeBackingStoresTask(ArrayBufferFreer* freer) : freer_(freer) {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    freer_->PerformFreeQueued();
+    freer_->pending_freeing_tasks_semaphore_.Signal();
+  }
+
+  ArrayBufferFreer* freer_;
+  DISALLOW_COPY_AND_ASSIGN(FreeBackingStoresTask);
+};
+
+void ArrayBufferFreer::AddBackingStoreSafe(void* data, size_t length) {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  queued_.push_back(std::make_pair(data, length));
+}
+
+void ArrayBufferFreer::FreeQueued() {
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (queued_.empty()) return;
+  }
+  if (FLAG_concurrent_sweeping) {
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        new FreeBackingStoresTask(this), v8::Platform::kShortRunningTask);
+    concurrent_freeing_tasks_active_++;
+  } else {
+    PerformFreeQueued();
+  }
+}
+
+bool ArrayBufferFreer::WaitUntilCompleted() {
+  bool waited = false;
+  while (concurrent_freeing_tasks_active_ > 0) {
+    pending_freeing_tasks_semaphore_.Wait();
+    concurrent_freeing_tasks_active_--;
+    waited = true;
+  }
+  return waited;
+}
+
+void ArrayBufferFreer::TearDown() {
+  WaitUntilCompleted();
+  PerformFreeQueued();
+}
+
+void ArrayBufferFreer::PerformFreeQueued() {
+  // Take the whole batch at once, so that the allocator is not called under
+  // the lock.
+  BackingStores backing_stores;
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    backing_stores.swap(queued_);
+  }
+  v8::ArrayBuffer::Allocator* allocator =
+      heap_->isolate()->array_buffer_allocator();
+  for (const auto& backing_store : backing_stores) {
+    allocator->Free(backing_store.first, backing_store.second);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
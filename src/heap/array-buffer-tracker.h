@@ -6,9 +6,12 @@
 #define V8_HEAP_ARRAY_BUFFER_TRACKER_H_
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "src/allocation.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
 #include "src/globals.h"
 
 namespace v8 {
@@ -54,6 +57,44 @@ class ArrayBufferTracker : public AllStatic {
   static bool IsTracked(JSArrayBuffer* buffer);
 };
 
+// Frees the backing stores of array buffers that died during a scavenge or
+// during evacuation. Freeing is deferred to a background task, so that large
+// backing stores do not have to be released by the allocator during the pause.
+// The external memory accounting is updated when a buffer is found dead.
+class ArrayBufferFreer {
+ public:
+  explicit ArrayBufferFreer(Heap* heap)
+      : heap_(heap),
+        pending_freeing_tasks_semaphore_(0),
+        concurrent_freeing_tasks_active_(0) {}
+
+  // Queues a backing store for freeing. Can be called from parallel
+  // evacuation tasks.
+  void AddBackingStoreSafe(void* data, size_t length);
+
+  // Frees all queued backing stores, on a background thread if concurrent
+  // sweeping is enabled.
+  void FreeQueued();
+
+  bool WaitUntilCompleted();
+  void TearDown();
+
+ private:
+  class FreeBackingStoresTask;
+
+  typedef std::vector<std::pair<void*, size_t>> BackingStores;
+
+  void PerformFreeQueued();
+
+  Heap* heap_;
+  base::Mutex mutex_;
+  BackingStores queued_;
+  base::Semaphore pending_freeing_tasks_semaphore_;
+  intptr_t concurrent_freeing_tasks_active_;
+
+  DISALLOW_COPY_AND_ASSIGN(ArrayBufferFreer);
+};
+
 // LocalArrayBufferTracker tracks internalized array buffers.
 //
 // Never use directly but instead always call through |ArrayBufferTracker|.
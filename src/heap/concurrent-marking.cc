@@ -0,0 +1,216 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/concurrent-marking.h"
+
+#include "src/base/atomicops.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/incremental-marking.h"
+#include "src/heap/mark-compact-inl.h"
+#include "src/heap/marking.h"
+#include "src/heap/objects-visiting.h"
+#include "src/isolate.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+class ConcurrentMarking::Task : public v8::Task {
+ public:
+  explicit Task(ConcurrentMarking* concurrent_marking)
+      : concurrent_marking_(concurrent_marking) {}
+
+ private:
+  // v8::Task overrides.
+  void Run() override {
+    concurrent_marking_->Run();
+    concurrent_marking_->pending_task_semaphore_.Signal();
+  }
+
+  ConcurrentMarking* concurrent_marking_;
+  DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+ConcurrentMarking::ConcurrentMarking(Heap* heap)
+    : heap_(heap),
+      bytes_marked_(0),
+      stop_requested_(false),
+      task_pending_(false),
+      pending_task_semaphore_(0) {}
+
+ConcurrentMarking::~ConcurrentMarking() { DCHECK(!task_pending_); }
+
+bool ConcurrentMarking::CanVisitConcurrently(Heap* heap, HeapObject* object,
+                                             Map* map) {
+  if (map->visitor_id() != StaticVisitorBase::kVisitFixedArray) return false;
+  // Large object pages may use a progress bar and new space objects move
+  // during scavenges, so only regular old space pages qualify.
+  MemoryChunk* chunk = MemoryChunk::FromAddress(object->address());
+  return chunk->owner()->identity() == OLD_SPACE;
+}
+
+void ConcurrentMarking::Push(HeapObject* object) {
+  DCHECK(Marking::IsGrey(ObjectMarking::MarkBitFrom(object)));
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  shared_.Add(object);
+}
+
+void ConcurrentMarking::ScheduleTask() {
+  if (!TryJoinTask()) return;
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (shared_.is_empty()) return;
+  }
+  task_pending_ = true;
+  V8::GetCurrentPlatform()->CallOnBackgroundThread(
+      new Task(this), v8::Platform::kShortRunningTask);
+}
+
+void ConcurrentMarking::TransferBailoutObjects() {
+  List<HeapObject*> bailout;
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    bailout.Swap(&bailout_);
+  }
+  for (int i = 0; i < bailout.length(); i++) {
+    IncrementalMarking::MarkGrey(heap_, bailout[i]);
+  }
+}
+
+void ConcurrentMarking::Stop() {
+  WaitForTask();
+  TransferBailoutObjects();
+}
+
+void ConcurrentMarking::Finish() {
+  Stop();
+  MarkingDeque* marking_deque = heap_->mark_compact_collector()->marking_deque();
+  for (int i = 0; i < shared_.length(); i++) {
+    marking_deque->Push(shared_[i]);
+  }
+  shared_.Clear();
+}
+
+void ConcurrentMarking::Abort() {
+  WaitForTask();
+  shared_.Clear();
+  bailout_.Clear();
+}
+
+bool ConcurrentMarking::HasPendingWork() {
+  if (!TryJoinTask()) return true;
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  return !shared_.is_empty() || !bailout_.is_empty();
+}
+
+void ConcurrentMarking::Run() {
+  const int kBatchSize = 64;
+  while (!stop_requested_.Value()) {
+    if (local_.is_empty()) {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      bailout_.AddAll(local_bailout_);
+      local_bailout_.Clear();
+      for (int i = 0; i < kBatchSize && !shared_.is_empty(); i++) {
+        local_.Add(shared_.RemoveLast());
+      }
+      if (local_.is_empty()) break;
+    }
+    VisitFixedArray(local_.RemoveLast());
+  }
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  bailout_.AddAll(local_bailout_);
+  local_bailout_.Clear();
+}
+
+void ConcurrentMarking::VisitFixedArray(HeapObject* object) {
+  MarkBit mark_bit = ObjectMarking::MarkBitFrom(object);
+  // The object is turned black before its body is visited. Stores into it
+  // that race with the visitor are caught by the write barrier.
+  if (!Marking::GreyToBlackAtomic(mark_bit)) return;
+  FixedArray* array = reinterpret_cast<FixedArray*>(object);
+  int length = array->synchronized_length();
+  int size = FixedArray::SizeFor(length);
+  live_bytes_[MemoryChunk::FromAddress(object->address())] += size;
+  bytes_marked_ += size;
+  // Maps are never on evacuation candidates, hence no slot is recorded.
+  MarkObject(object, nullptr, object->synchronized_map());
+  Object** start = array->data_start();
+  Object** end = start + length;
+  for (Object** slot = start; slot < end; slot++) {
+    Object* value = reinterpret_cast<Object*>(
+        base::NoBarrier_Load(reinterpret_cast<base::AtomicWord*>(slot)));
+    if (!value->IsHeapObject()) continue;
+    MarkObject(object, slot, HeapObject::cast(value));
+  }
+}
+
+void ConcurrentMarking::MarkObject(HeapObject* host, Object** slot,
+                                   HeapObject* object) {
+  if (slot != nullptr && MarkCompactCollector::IsOnEvacuationCandidate(object)) {
+    recorded_slots_.Add(RecordedSlot(host, slot));
+  }
+  if (heap_->InNewSpace(object)) {
+    local_bailout_.Add(object);
+    return;
+  }
+  MarkBit mark_bit = ObjectMarking::MarkBitFrom(object);
+  if (!Marking::IsWhite(mark_bit)) return;
+  if (!CanVisitConcurrently(heap_, object, object->synchronized_map())) {
+    local_bailout_.Add(object);
+    return;
+  }
+  if (Marking::WhiteToGreyAtomic(mark_bit)) {
+    local_.Add(object);
+  }
+}
+
+bool ConcurrentMarking::TryJoinTask() {
+  if (!task_pending_) return true;
+  if (!pending_task_semaphore_.WaitFor(base::TimeDelta::FromSeconds(0))) {
+    return false;
+  }
+  task_pending_ = false;
+  MergeTaskState();
+  return true;
+}
+
+void ConcurrentMarking::WaitForTask() {
+  if (task_pending_) {
+    stop_requested_.SetValue(true);
+    pending_task_semaphore_.Wait();
+    stop_requested_.SetValue(false);
+    task_pending_ = false;
+  }
+  MergeTaskState();
+}
+
+void ConcurrentMarking::MergeTaskState() {
+  DCHECK(!task_pending_);
+  shared_.AddAll(local_);
+  local_.Clear();
+  bailout_.AddAll(local_bailout_);
+  local_bailout_.Clear();
+  for (auto& entry : live_bytes_) {
+    entry.first->IncrementLiveBytes(static_cast<int>(entry.second));
+  }
+  live_bytes_.clear();
+  MarkCompactCollector* collector = heap_->mark_compact_collector();
+  for (int i = 0; i < recorded_slots_.length(); i++) {
+    HeapObject* host = recorded_slots_[i].first;
+    Object** slot = recorded_slots_[i].second;
+    // The mutator may have overwritten the slot in the meantime, in which
+    // case the write barrier already took care of it.
+    if ((*slot)->IsHeapObject()) collector->RecordSlot(host, slot, *slot);
+  }
+  recorded_slots_.Clear();
+  if (FLAG_trace_concurrent_marking && bytes_marked_ > 0) {
+    heap_->isolate()->PrintWithTimestamp(
+        "[ConcurrentMarking] Marked %" V8PRIdPTR " bytes concurrently\n",
+        bytes_marked_);
+  }
+  bytes_marked_ = 0;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,114 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_MARKING_H_
+#define V8_HEAP_CONCURRENT_MARKING_H_
+
+#include <unordered_map>
+#include <utility>
+
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/list.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+class HeapObject;
+class Map;
+class MemoryChunk;
+class Object;
+
+// Drains grey objects discovered by incremental marking on a background
+// thread while the mutator is running.
+//
+// Only objects whose layout cannot change under the marker are visited
+// concurrently: plain FixedArrays in old space. The marker turns an object
+// black before visiting its body, so every store into it afterwards goes
+// through the incremental marking write barrier. All other objects discovered
+// by the background task are handed back to the main thread via the bailout
+// list and are marked by the regular incremental marking steps.
+//
+// The background task has to be stopped before every garbage collection, see
+// Stop(), and its worklist has to be flushed when incremental marking
+// finishes, see Finish().
+class ConcurrentMarking {
+ public:
+  explicit ConcurrentMarking(Heap* heap);
+  ~ConcurrentMarking();
+
+  // Returns true if the given grey {object} can be marked concurrently.
+  static bool CanVisitConcurrently(Heap* heap, HeapObject* object, Map* map);
+
+  // Adds a grey object to the shared worklist of the background task.
+  void Push(HeapObject* object);
+
+  // Posts the background task if there is work and it is not running yet.
+  void ScheduleTask();
+
+  // Moves objects that the background task could not handle onto the marking
+  // deque of the main thread.
+  void TransferBailoutObjects();
+
+  // Waits for the background task and merges its state back, i.e. live bytes
+  // are accounted, recorded slots are inserted and bailout objects are
+  // transferred. Grey objects left in the worklist stay there.
+  void Stop();
+
+  // Like Stop() but additionally transfers all remaining grey objects onto the
+  // marking deque of the main thread.
+  void Finish();
+
+  // Waits for the background task and discards all of its state. Used when
+  // incremental marking is aborted.
+  void Abort();
+
+  // Returns true if the background task is running or there are objects
+  // left that still need to be processed.
+  bool HasPendingWork();
+
+ private:
+  class Task;
+
+  typedef std::pair<HeapObject*, Object**> RecordedSlot;
+
+  // Entry point of the background task.
+  void Run();
+
+  void VisitFixedArray(HeapObject* object);
+  void MarkObject(HeapObject* host, Object** slot, HeapObject* object);
+  // Joins the background task if it has completed. Returns true if no task
+  // is pending afterwards.
+  bool TryJoinTask();
+  void WaitForTask();
+  void MergeTaskState();
+
+  Heap* heap_;
+
+  // Protects the shared worklist and the bailout list.
+  base::Mutex mutex_;
+  List<HeapObject*> shared_;
+  List<HeapObject*> bailout_;
+
+  // State of the background task. Only accessed by the main thread when no
+  // task is pending.
+  List<HeapObject*> local_;
+  List<HeapObject*> local_bailout_;
+  List<RecordedSlot> recorded_slots_;
+  std::unordered_map<MemoryChunk*, intptr_t> live_bytes_;
+  intptr_t bytes_marked_;
+
+  base::AtomicValue<bool> stop_requested_;
+  bool task_pending_;
+  base::Semaphore pending_task_semaphore_;
+
+  DISALLOW_COPY_AND_ASSIGN(ConcurrentMarking);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_MARKING_H_
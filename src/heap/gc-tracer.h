@@ -352,6 +352,23 @@ class GCTracer {
 
   void NotifyIncrementalMarkingStart();
 
+  // Returns the event of the last garbage collection that finished. While a
+  // garbage collection is running, this is the one before it.
+  const Event& LastCompletedEvent() const {
+    return start_counter_ == 0 ? current_ : previous_;
+  }
+
+  // Returns the time spent in embedder callbacks during the given event.
+  static double TotalExternalTime(const Event& event) {
+    return event.scopes[Scope::EXTERNAL_WEAK_GLOBAL_HANDLES] +
+           event.scopes[Scope::MC_EXTERNAL_EPILOGUE] +
+           event.scopes[Scope::MC_EXTERNAL_PROLOGUE] +
+           event.scopes[Scope::MC_INCREMENTAL_EXTERNAL_EPILOGUE] +
+           event.scopes[Scope::MC_INCREMENTAL_EXTERNAL_PROLOGUE] +
+           event.scopes[Scope::SCAVENGER_EXTERNAL_EPILOGUE] +
+           event.scopes[Scope::SCAVENGER_EXTERNAL_PROLOGUE];
+  }
+
   V8_INLINE void AddScopeSample(Scope::ScopeId scope, double duration) {
     DCHECK(scope < Scope::NUMBER_OF_SCOPES);
     if (scope >= Scope::FIRST_INCREMENTAL_SCOPE &&
@@ -397,16 +414,6 @@ class GCTracer {
   // it can be included in later crash dumps.
   void PRINTF_FORMAT(2, 3) Output(const char* format, ...) const;
 
-  double TotalExternalTime() const {
-    return current_.scopes[Scope::EXTERNAL_WEAK_GLOBAL_HANDLES] +
-           current_.scopes[Scope::MC_EXTERNAL_EPILOGUE] +
-           current_.scopes[Scope::MC_EXTERNAL_PROLOGUE] +
-           current_.scopes[Scope::MC_INCREMENTAL_EXTERNAL_EPILOGUE] +
-           current_.scopes[Scope::MC_INCREMENTAL_EXTERNAL_PROLOGUE] +
-           current_.scopes[Scope::SCAVENGER_EXTERNAL_EPILOGUE] +
-           current_.scopes[Scope::SCAVENGER_EXTERNAL_PROLOGUE];
-  }
-
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
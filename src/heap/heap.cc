@@ -20,6 +20,7 @@
 #include "src/global-handles.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/code-stats.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/incremental-marking.h"
@@ -127,6 +128,7 @@ Heap::Heap()
       last_idle_notification_time_(0.0),
       last_gc_time_(0.0),
       scavenge_collector_(nullptr),
+      concurrent_marking_(nullptr),
       mark_compact_collector_(nullptr),
       memory_allocator_(nullptr),
       store_buffer_(nullptr),
@@ -136,6 +138,7 @@ Heap::Heap()
       live_object_stats_(nullptr),
       dead_object_stats_(nullptr),
       scavenge_job_(nullptr),
+      array_buffer_freer_(nullptr),
       idle_scavenge_observer_(nullptr),
       full_codegen_bytes_generated_(0),
       crankshaft_codegen_bytes_generated_(0),
@@ -407,6 +410,9 @@ void Heap::GarbageCollectionPrologue() {
     AllowHeapAllocation for_the_first_part_of_prologue;
     gc_count_++;
 
+    // The concurrent marker must not run while objects are moved.
+    if (FLAG_concurrent_marking) concurrent_marking_->Stop();
+
 #ifdef VERIFY_HEAP
     if (FLAG_verify_heap) {
       Verify();
@@ -439,7 +445,7 @@ void Heap::GarbageCollectionPrologue() {
   }
   CheckNewSpaceExpansionCriteria();
   UpdateNewSpaceAllocationCounter();
-  store_buffer()->MoveEntriesToRememberedSet();
+  store_buffer()->MoveAllEntriesToRememberedSet();
 }
 
 
@@ -1647,6 +1653,18 @@ void Heap::Scavenge() {
         &IsUnmodifiedHeapObject);
   }
 
+  const bool parallel_scavenge = scavenge_collector_->CanScavengeInParallel();
+  if (parallel_scavenge) {
+    // Copy objects reachable from untyped old-to-new slots in parallel. This
+    // has to happen before any other object is copied. The parallel tasks
+    // process all objects they copy, so the queue of unprocessed objects in
+    // to-space starts at the current top.
+    TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
+    scavenge_collector_->ScavengeOldToNewSlotsInParallel();
+    new_space_front = new_space_->top();
+    promotion_queue_.SetNewLimit(new_space_front);
+  }
+
   {
     // Copy roots.
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_ROOTS);
@@ -1656,9 +1674,11 @@ void Heap::Scavenge() {
   {
     // Copy objects reachable from the old generation.
     TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_OLD_TO_NEW_POINTERS);
-    RememberedSet<OLD_TO_NEW>::Iterate(this, [this](Address addr) {
-      return Scavenger::CheckAndScavengeObject(this, addr);
-    });
+    if (!parallel_scavenge) {
+      RememberedSet<OLD_TO_NEW>::Iterate(this, [this](Address addr) {
+        return Scavenger::CheckAndScavengeObject(this, addr);
+      });
+    }
 
     RememberedSet<OLD_TO_NEW>::IterateTyped(
         this, [this](SlotType type, Address host_addr, Address addr) {
@@ -2877,6 +2897,10 @@ void Heap::CreateInitialObjects() {
       handle(Smi::FromInt(Isolate::kArrayProtectorValid), isolate()));
   set_species_protector(*species_cell);
 
+  Handle<Cell> array_iterator_cell = factory->NewCell(
+      handle(Smi::FromInt(Isolate::kArrayProtectorValid), isolate()));
+  set_array_iterator_protector(*array_iterator_cell);
+
   cell = factory->NewPropertyCell();
   cell->set_value(Smi::FromInt(Isolate::kArrayProtectorValid));
   set_string_length_protector(*cell);
@@ -3061,6 +3085,7 @@ AllocationResult Heap::AllocateBytecodeArray(int length,
   instance->set_parameter_count(parameter_count);
   instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
   instance->set_osr_loop_nesting_level(0);
+  instance->set_bytecode_age(BytecodeArray::kNoAgeBytecodeAge);
   instance->set_constant_pool(constant_pool);
   instance->set_handler_table(empty_fixed_array());
   instance->set_source_position_table(empty_byte_array());
@@ -3116,6 +3141,11 @@ bool Heap::CanMoveObjectStart(HeapObject* object) {
 
   if (lo_space()->Contains(object)) return false;
 
+  // The concurrent marker may be visiting the object.
+  if (FLAG_concurrent_marking && incremental_marking()->IsMarking()) {
+    return false;
+  }
+
   // We can move the object start if the page was already swept.
   return Page::FromAddress(address)->SweepingDone();
 }
@@ -3391,6 +3421,8 @@ AllocationResult Heap::CopyCode(Code* code) {
   Address new_addr = result->address();
   CopyBlock(new_addr, old_addr, obj_size);
   Code* new_code = Code::cast(result);
+  // The copy is registered with the trap handler separately, if at all.
+  new_code->set_trap_handler_index(-1);
 
   // Relocate the copy.
   DCHECK(IsAligned(bit_cast<intptr_t>(new_code->address()), kCodeAlignment));
@@ -3421,9 +3453,14 @@ AllocationResult Heap::CopyBytecodeArray(BytecodeArray* bytecode_array) {
   copy->set_parameter_count(bytecode_array->parameter_count());
   copy->set_constant_pool(bytecode_array->constant_pool());
   copy->set_handler_table(bytecode_array->handler_table());
-  copy->set_source_position_table(bytecode_array->source_position_table());
+  if (bytecode_array->HasSourcePositionTable()) {
+    copy->set_source_position_table(bytecode_array->source_position_table());
+  } else {
+    copy->ClearSourcePositionTable();
+  }
   copy->set_interrupt_budget(bytecode_array->interrupt_budget());
   copy->set_osr_loop_nesting_level(bytecode_array->osr_loop_nesting_level());
+  copy->set_bytecode_age(bytecode_array->bytecode_age());
   bytecode_array->CopyBytecodesTo(copy);
   return copy;
 }
@@ -5486,6 +5523,8 @@ bool Heap::SetUp() {
 
   tracer_ = new GCTracer(this);
   scavenge_collector_ = new Scavenger(this);
+
+  concurrent_marking_ = new ConcurrentMarking(this);
   mark_compact_collector_ = new MarkCompactCollector(this);
   gc_idle_time_handler_ = new GCIdleTimeHandler();
   memory_reducer_ = new MemoryReducer(this);
@@ -5494,6 +5533,7 @@ bool Heap::SetUp() {
     dead_object_stats_ = new ObjectStats(this);
   }
   scavenge_job_ = new ScavengeJob();
+  array_buffer_freer_ = new ArrayBufferFreer(this);
 
   LOG(isolate_, IntPtrTEvent("heap-capacity", Capacity()));
   LOG(isolate_, IntPtrTEvent("heap-available", Available()));
@@ -5641,6 +5681,10 @@ void Heap::TearDown() {
     PrintAlloctionsHash();
   }
 
+  // The store buffer task must not move entries to pages of the spaces that
+  // are deleted below.
+  store_buffer()->StopConcurrentProcessing();
+
   new_space()->RemoveAllocationObserver(idle_scavenge_observer_);
   delete idle_scavenge_observer_;
   idle_scavenge_observer_ = nullptr;
@@ -5648,6 +5692,12 @@ void Heap::TearDown() {
   delete scavenge_collector_;
   scavenge_collector_ = nullptr;
 
+  if (concurrent_marking_ != nullptr) {
+    concurrent_marking_->Abort();
+    delete concurrent_marking_;
+    concurrent_marking_ = nullptr;
+  }
+
   if (mark_compact_collector_ != nullptr) {
     mark_compact_collector_->TearDown();
     delete mark_compact_collector_;
@@ -5679,6 +5729,12 @@ void Heap::TearDown() {
   delete scavenge_job_;
   scavenge_job_ = nullptr;
 
+  if (array_buffer_freer_ != nullptr) {
+    array_buffer_freer_->TearDown();
+    delete array_buffer_freer_;
+    array_buffer_freer_ = nullptr;
+  }
+
   isolate_->global_handles()->TearDown();
 
   external_string_table_.TearDown();
@@ -5922,7 +5978,7 @@ void Heap::CheckHandleCount() {
 
 void Heap::ClearRecordedSlot(HeapObject* object, Object** slot) {
   if (!InNewSpace(object)) {
-    store_buffer()->MoveEntriesToRememberedSet();
+    store_buffer()->MoveAllEntriesToRememberedSet();
     Address slot_addr = reinterpret_cast<Address>(slot);
     Page* page = Page::FromAddress(slot_addr);
     DCHECK_EQ(page->owner()->identity(), OLD_SPACE);
@@ -5934,7 +5990,7 @@ void Heap::ClearRecordedSlot(HeapObject* object, Object** slot) {
 void Heap::ClearRecordedSlotRange(Address start, Address end) {
   Page* page = Page::FromAddress(start);
   if (!page->InNewSpace()) {
-    store_buffer()->MoveEntriesToRememberedSet();
+    store_buffer()->MoveAllEntriesToRememberedSet();
     DCHECK_EQ(page->owner()->identity(), OLD_SPACE);
     RememberedSet<OLD_TO_NEW>::RemoveRange(page, start, end,
                                            SlotSet::PREFREE_EMPTY_BUCKETS);
@@ -6497,6 +6553,13 @@ bool Heap::GetObjectTypeName(size_t index, const char** object_type,
     *object_sub_type = "CODE_AGE/" #name;                              \
     return true;
     CODE_AGE_LIST_COMPLETE(COMPARE_AND_RETURN_NAME)
+#undef COMPARE_AND_RETURN_NAME
+#define COMPARE_AND_RETURN_NAME(name)           \
+  case ObjectStats::FIRST_MAP_SUB_TYPE + name: \
+    *object_type = "MAP_TYPE";                  \
+    *object_sub_type = #name;                   \
+    return true;
+    MAP_SUB_INSTANCE_TYPE_LIST(COMPARE_AND_RETURN_NAME)
 #undef COMPARE_AND_RETURN_NAME
   }
   return false;
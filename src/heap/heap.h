@@ -166,6 +166,7 @@ using v8::MemoryPressureLevel;
   V(Cell, is_concat_spreadable_protector, IsConcatSpreadableProtector)         \
   V(PropertyCell, has_instance_protector, HasInstanceProtector)                \
   V(Cell, species_protector, SpeciesProtector)                                 \
+  V(Cell, array_iterator_protector, ArrayIteratorProtector)                    \
   V(PropertyCell, string_length_protector, StringLengthProtector)              \
   /* Special numbers */                                                        \
   V(HeapNumber, nan_value, NanValue)                                           \
@@ -257,6 +258,7 @@ using v8::MemoryPressureLevel;
   V(TrueValue)                          \
   V(FalseValue)                         \
   V(UninitializedValue)                 \
+  V(StaleRegister)                      \
   V(CellMap)                            \
   V(GlobalPropertyCellMap)              \
   V(SharedFunctionInfoMap)              \
@@ -317,7 +319,9 @@ using v8::MemoryPressureLevel;
 
 // Forward declarations.
 class AllocationObserver;
+class ArrayBufferFreer;
 class ArrayBufferTracker;
+class ConcurrentMarking;
 class GCIdleTimeAction;
 class GCIdleTimeHandler;
 class GCIdleTimeHeapState;
@@ -804,6 +808,11 @@ class Heap {
   template <FindMementoMode mode>
   inline AllocationMemento* FindAllocationMemento(HeapObject* object);
 
+  // Same as above, but uses the given {map} instead of reading it from the
+  // {object}, whose map word might already hold a forwarding address.
+  template <FindMementoMode mode>
+  inline AllocationMemento* FindAllocationMemento(Map* map, HeapObject* object);
+
   // Returns false if not able to reserve.
   bool ReserveSpace(Reservation* reservations, List<Address>* maps);
 
@@ -978,6 +987,8 @@ class Heap {
 
   MemoryAllocator* memory_allocator() { return memory_allocator_; }
 
+  ArrayBufferFreer* array_buffer_freer() { return array_buffer_freer_; }
+
   PromotionQueue* promotion_queue() { return &promotion_queue_; }
 
   inline Isolate* isolate();
@@ -1181,6 +1192,8 @@ class Heap {
 
   IncrementalMarking* incremental_marking() { return incremental_marking_; }
 
+  ConcurrentMarking* concurrent_marking() { return concurrent_marking_; }
+
   // ===========================================================================
   // Embedder heap tracer support. =============================================
   // ===========================================================================
@@ -1457,6 +1470,12 @@ class Heap {
   inline void UpdateAllocationSite(HeapObject* object,
                                    base::HashMap* pretenuring_feedback);
 
+  // Same as above, but uses the given {map} of the {object}. Used by the
+  // parallel scavenger, which may race with other tasks on the map word.
+  template <UpdateAllocationSiteMode mode>
+  inline void UpdateAllocationSite(Map* map, HeapObject* object,
+                                   base::HashMap* pretenuring_feedback);
+
   // Removes an entry from the global pretenuring storage.
   inline void RemoveAllocationSitePretenuringFeedback(AllocationSite* site);
 
@@ -2224,6 +2243,8 @@ class Heap {
 
   Scavenger* scavenge_collector_;
 
+  ConcurrentMarking* concurrent_marking_;
+
   MarkCompactCollector* mark_compact_collector_;
 
   MemoryAllocator* memory_allocator_;
@@ -2241,6 +2262,8 @@ class Heap {
 
   ScavengeJob* scavenge_job_;
 
+  ArrayBufferFreer* array_buffer_freer_;
+
   AllocationObserver* idle_scavenge_observer_;
 
   // These two counters are monotomically increasing and never reset.
@@ -7,6 +7,7 @@
 #include "src/code-stubs.h"
 #include "src/compilation-cache.h"
 #include "src/conversions.h"
+#include "src/heap/concurrent-marking.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/mark-compact-inl.h"
@@ -119,6 +120,14 @@ void IncrementalMarking::RecordWriteIntoCodeSlow(Code* host, RelocInfo* rinfo,
 
 
 void IncrementalMarking::WhiteToGreyAndPush(HeapObject* obj, MarkBit mark_bit) {
+  if (FLAG_concurrent_marking && IsMarking() &&
+      heap_->gc_state() == Heap::NOT_IN_GC &&
+      ConcurrentMarking::CanVisitConcurrently(heap_, obj, obj->map())) {
+    if (Marking::WhiteToGreyAtomic(mark_bit)) {
+      heap_->concurrent_marking()->Push(obj);
+    }
+    return;
+  }
   Marking::WhiteToGrey(mark_bit);
   heap_->mark_compact_collector()->marking_deque()->Push(obj);
 }
@@ -901,6 +910,7 @@ intptr_t IncrementalMarking::ProcessMarkingDeque(
 
 
 void IncrementalMarking::Hurry() {
+  if (FLAG_concurrent_marking) heap_->concurrent_marking()->Finish();
   // A scavenge may have pushed new objects on the marking deque (due to black
   // allocation) even in COMPLETE state. This may happen if scavenges are
   // forced e.g. in tests. It should not happen when COMPLETE was set when
@@ -978,6 +988,7 @@ void IncrementalMarking::Stop() {
     DeactivateIncrementalWriteBarrier();
   }
   heap_->isolate()->stack_guard()->ClearGC();
+  if (FLAG_concurrent_marking) heap_->concurrent_marking()->Abort();
   state_ = STOPPED;
   is_compacting_ = false;
   FinishBlackAllocation();
@@ -1132,21 +1143,33 @@ size_t IncrementalMarking::Step(size_t bytes_to_process,
 
   size_t bytes_processed = 0;
   if (state_ == MARKING) {
+    if (FLAG_concurrent_marking) {
+      heap_->concurrent_marking()->TransferBailoutObjects();
+    }
     const bool incremental_wrapper_tracing =
         FLAG_incremental_marking_wrappers && heap_->UsingEmbedderHeapTracer();
-    const bool process_wrappers =
-        incremental_wrapper_tracing &&
-        (heap_->RequiresImmediateWrapperProcessing() ||
-         heap_->mark_compact_collector()->marking_deque()->IsEmpty());
     bool wrapper_work_left = incremental_wrapper_tracing;
-    if (!process_wrappers) {
+    double wrapper_deadline = start + kStepSizeInMs;
+    if (incremental_wrapper_tracing &&
+        heap_->RequiresImmediateWrapperProcessing()) {
+      // Too many wrappers were discovered; give the whole step to the
+      // embedder so that the buffer does not keep growing.
+      wrapper_deadline =
+          heap_->MonotonicallyIncreasingTimeInMs() + kStepSizeInMs;
+    } else {
       bytes_processed = ProcessMarkingDeque(bytes_to_process);
       if (step_origin == StepOrigin::kTask) {
         bytes_marked_ahead_of_schedule_ += bytes_processed;
       }
-    } else {
-      const double wrapper_deadline =
-          heap_->MonotonicallyIncreasingTimeInMs() + kStepSizeInMs;
+    }
+    // Trace wrappers in whatever is left of the step once the marking deque
+    // is drained, instead of waiting for the next step. This keeps the
+    // embedder busy during incremental marking, so that the final pause only
+    // has to deal with the wrappers discovered last.
+    if (incremental_wrapper_tracing &&
+        (heap_->RequiresImmediateWrapperProcessing() ||
+         heap_->mark_compact_collector()->marking_deque()->IsEmpty()) &&
+        heap_->MonotonicallyIncreasingTimeInMs() < wrapper_deadline) {
       TRACE_GC(heap()->tracer(),
                GCTracer::Scope::MC_INCREMENTAL_WRAPPER_TRACING);
       heap_->RegisterWrappersWithEmbedderHeapTracer();
@@ -1156,8 +1179,14 @@ size_t IncrementalMarking::Step(size_t bytes_to_process,
                                     DO_NOT_FORCE_COMPLETION));
     }
 
+    bool concurrent_work_left = false;
+    if (FLAG_concurrent_marking) {
+      heap_->concurrent_marking()->ScheduleTask();
+      concurrent_work_left = heap_->concurrent_marking()->HasPendingWork();
+    }
+
     if (heap_->mark_compact_collector()->marking_deque()->IsEmpty() &&
-        !wrapper_work_left) {
+        !wrapper_work_left && !concurrent_work_left) {
       if (completion == FORCE_COMPLETION ||
           IsIdleMarkingDelayCounterLimitReached()) {
         if (!finalize_marking_completed_) {
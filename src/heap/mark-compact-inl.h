@@ -88,6 +88,11 @@ void CodeFlusher::AddCandidate(JSFunction* function) {
 }
 
 
+void CodeFlusher::AddBytecodeCandidate(SharedFunctionInfo* shared_info) {
+  bytecode_candidates_.Add(shared_info);
+}
+
+
 JSFunction** CodeFlusher::GetNextCandidateSlot(JSFunction* candidate) {
   return reinterpret_cast<JSFunction**>(
       HeapObject::RawField(candidate, JSFunction::kNextFunctionLinkOffset));
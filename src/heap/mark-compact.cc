@@ -4,6 +4,8 @@
 
 #include "src/heap/mark-compact.h"
 
+#include <unordered_map>
+
 #include "src/base/atomicops.h"
 #include "src/base/bits.h"
 #include "src/base/sys-info.h"
@@ -22,6 +24,7 @@
 #include "src/heap/objects-visiting-inl.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/page-parallel-job.h"
+#include "src/heap/parallel-marking.h"
 #include "src/heap/spaces-inl.h"
 #include "src/ic/ic.h"
 #include "src/ic/stub-cache.h"
@@ -58,6 +61,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       compacting_(false),
       black_allocation_(false),
       have_code_to_deoptimize_(false),
+      last_scanned_weak_collection_(Smi::kZero),
       marking_deque_memory_(NULL),
       marking_deque_memory_committed_(0),
       code_flusher_(nullptr),
@@ -315,6 +319,8 @@ void MarkCompactCollector::CollectGarbage() {
 
   RecordObjectStats();
 
+  RecordContextLiveSizes();
+
 #ifdef VERIFY_HEAP
   if (FLAG_verify_heap) {
     VerifyMarking(heap_);
@@ -989,6 +995,46 @@ void CodeFlusher::ProcessSharedFunctionInfoCandidates() {
 }
 
 
+void CodeFlusher::ProcessBytecodeCandidates() {
+  Code* lazy_compile = isolate_->builtins()->builtin(Builtins::kCompileLazy);
+  Code* interpreter_entry_trampoline =
+      isolate_->builtins()->builtin(Builtins::kInterpreterEntryTrampoline);
+
+  for (int i = 0; i < bytecode_candidates_.length(); i++) {
+    SharedFunctionInfo* candidate = bytecode_candidates_[i];
+    // Candidates of an aborted marking cycle might have died since, and
+    // functions might have been recompiled since they became candidates.
+    if (Marking::IsWhite(ObjectMarking::MarkBitFrom(candidate))) continue;
+    if (!candidate->HasBytecodeArray()) continue;
+
+    BytecodeArray* bytecode = candidate->bytecode_array();
+    MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+    if (Marking::IsWhite(bytecode_mark) &&
+        candidate->code() == interpreter_entry_trampoline &&
+        !candidate->HasDebugInfo()) {
+      if (FLAG_trace_code_flushing) {
+        PrintF("[code-flushing clears bytecode: ");
+        candidate->ShortPrint();
+        PrintF(" - age: %d]\n", bytecode->bytecode_age());
+      }
+      // Always flush the optimized code map if there is one.
+      if (!candidate->OptimizedCodeMapIsCleared()) {
+        candidate->ClearOptimizedCodeMap();
+      }
+      candidate->ClearBytecodeArray();
+      candidate->set_code(lazy_compile);
+    }
+
+    Object** data_slot = HeapObject::RawField(
+        candidate, SharedFunctionInfo::kFunctionDataOffset);
+    isolate_->heap()->mark_compact_collector()->RecordSlot(candidate, data_slot,
+                                                           *data_slot);
+  }
+
+  bytecode_candidates_.Rewind(0);
+}
+
+
 void CodeFlusher::EvictCandidate(SharedFunctionInfo* shared_info) {
   // Make sure previous flushing decisions are revisited.
   isolate_->heap()->incremental_marking()->IterateBlackObject(shared_info);
@@ -1279,6 +1325,11 @@ class SharedFunctionInfoMarkingVisitor : public ObjectVisitor {
       MarkBit shared_mark = ObjectMarking::MarkBitFrom(shared);
       MarkBit code_mark = ObjectMarking::MarkBitFrom(shared->code());
       collector_->MarkObject(shared->code(), code_mark);
+      if (shared->HasBytecodeArray()) {
+        BytecodeArray* bytecode = shared->bytecode_array();
+        MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+        collector_->MarkObject(bytecode, bytecode_mark);
+      }
       collector_->MarkObject(shared, shared_mark);
     }
   }
@@ -1299,10 +1350,28 @@ void MarkCompactCollector::PrepareThreadForCodeFlushing(Isolate* isolate,
     Code* code = frame->unchecked_code();
     MarkBit code_mark = ObjectMarking::MarkBitFrom(code);
     MarkObject(code, code_mark);
+    if (frame->is_interpreted()) {
+      BytecodeArray* bytecode =
+          reinterpret_cast<InterpretedFrame*>(frame)->GetBytecodeArray();
+      MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+      MarkObject(bytecode, bytecode_mark);
+    }
     if (frame->is_optimized()) {
       Code* optimized_code = frame->LookupCode();
       MarkBit optimized_code_mark = ObjectMarking::MarkBitFrom(optimized_code);
       MarkObject(optimized_code, optimized_code_mark);
+      // The frame might deoptimize into the interpreter, so keep the bytecode
+      // of the outermost function and of all inlined ones. The closure does
+      // not do that for OSR frames or for frames with a pending lazy deopt.
+      List<JSFunction*> functions;
+      JavaScriptFrame::cast(frame)->GetFunctions(&functions);
+      for (int i = 0; i < functions.length(); i++) {
+        SharedFunctionInfo* shared = functions[i]->shared();
+        if (!shared->HasBytecodeArray()) continue;
+        BytecodeArray* bytecode = shared->bytecode_array();
+        MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+        MarkObject(bytecode, bytecode_mark);
+      }
     }
   }
 }
@@ -2003,6 +2072,10 @@ void MarkCompactCollector::MarkImplicitRefGroups(
 // After: the marking stack is empty, and all objects reachable from the
 // marking stack have been marked, or are overflowed in the heap.
 void MarkCompactCollector::EmptyMarkingDeque() {
+  if (FLAG_parallel_marking) {
+    EmptyMarkingDequeInParallel();
+    return;
+  }
   while (!marking_deque()->IsEmpty()) {
     HeapObject* object = marking_deque()->Pop();
 
@@ -2020,6 +2093,55 @@ void MarkCompactCollector::EmptyMarkingDeque() {
 }
 
 
+void MarkCompactCollector::EmptyMarkingDequeInParallel() {
+  List<HeapObject*> seeds;
+  List<HeapObject*> bailout;
+  while (!marking_deque()->IsEmpty()) {
+    while (!marking_deque()->IsEmpty()) {
+      HeapObject* object = marking_deque()->Pop();
+
+      DCHECK(!object->IsFiller());
+      DCHECK(object->IsHeapObject());
+      DCHECK(heap()->Contains(object));
+      DCHECK(!Marking::IsWhite(ObjectMarking::MarkBitFrom(object)));
+
+      Map* map = object->map();
+      MarkBit map_mark = ObjectMarking::MarkBitFrom(map);
+      MarkObject(map, map_mark);
+
+      if (ParallelMarking::CanVisitInParallel(map)) {
+        seeds.Add(object);
+      } else {
+        MarkCompactMarkingVisitor::IterateBody(map, object);
+      }
+    }
+    if (seeds.is_empty()) break;
+
+    ParallelMarking parallel_marking(heap(), &page_parallel_job_semaphore_);
+    parallel_marking.Run(NumberOfParallelMarkingTasks(seeds.length()), &seeds,
+                         &bailout);
+    seeds.Clear();
+
+    // Objects that were discovered by the tasks but cannot be visited in
+    // parallel are pushed onto the marking deque and visited by the next
+    // iteration.
+    for (int i = 0; i < bailout.length(); i++) {
+      HeapObject* object = bailout[i];
+      MarkObject(object, ObjectMarking::MarkBitFrom(object));
+    }
+    bailout.Clear();
+  }
+}
+
+int MarkCompactCollector::NumberOfParallelMarkingTasks(int seeds) {
+  // Small amounts of work are not worth the overhead of posting tasks.
+  const int kMinSeedsPerTask = 64;
+  const int available_cores = Max(
+      1, static_cast<int>(
+             V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()));
+  return Max(1, Min(available_cores, seeds / kMinSeedsPerTask));
+}
+
 // Sweep the heap for overflowed objects, clear their overflow bits, and
 // push them on the marking stack.  Stop early if the marking stack fills
 // before sweeping completes.  If sweeping completes, there are no remaining
@@ -2245,6 +2367,78 @@ void MarkCompactCollector::RecordObjectStats() {
   }
 }
 
+class MarkCompactCollector::ContextLiveSizeVisitor
+    : public MarkCompactCollector::HeapObjectVisitor {
+ public:
+  explicit ContextLiveSizeVisitor(Heap* heap) : heap_(heap) {}
+
+  bool Visit(HeapObject* obj) override {
+    if (!Marking::IsBlack(ObjectMarking::MarkBitFrom(obj))) return true;
+    Context* native_context = NativeContextOf(obj);
+    if (native_context != nullptr) sizes_[native_context] += OwnedSize(obj);
+    return true;
+  }
+
+  size_t SizeOf(Context* native_context) const {
+    auto it = sizes_.find(native_context);
+    return it == sizes_.end() ? 0 : it->second;
+  }
+
+ private:
+  // Objects are attributed through the function that created them; objects
+  // which are not JSReceivers or contexts are shared or owned by another
+  // object, and are left out.
+  Context* NativeContextOf(HeapObject* obj) {
+    if (obj->IsContext()) return Context::cast(obj)->native_context();
+    if (obj->IsJSFunction()) {
+      return JSFunction::cast(obj)->context()->native_context();
+    }
+    if (obj->IsJSObject()) {
+      Object* constructor = obj->map()->GetConstructor();
+      if (constructor->IsJSFunction()) {
+        return JSFunction::cast(constructor)->context()->native_context();
+      }
+    }
+    return nullptr;
+  }
+
+  // The object's own size plus the backing stores which only it refers to.
+  int OwnedSize(HeapObject* obj) {
+    int size = obj->Size();
+    if (!obj->IsJSObject()) return size;
+    JSObject* object = JSObject::cast(obj);
+    FixedArray* properties = object->properties();
+    if (properties->length() > 0) size += properties->Size();
+    FixedArrayBase* elements = object->elements();
+    if (elements->length() > 0 &&
+        elements->map() != heap_->fixed_cow_array_map()) {
+      size += elements->Size();
+    }
+    return size;
+  }
+
+  Heap* heap_;
+  std::unordered_map<Context*, size_t> sizes_;
+};
+
+void MarkCompactCollector::RecordContextLiveSizes() {
+  if (!FLAG_track_context_live_size) return;
+  ContextLiveSizeVisitor visitor(heap());
+  VisitAllObjects(&visitor);
+  Object* context = heap()->native_contexts_list();
+  while (!context->IsUndefined(isolate())) {
+    Context* native_context = Context::cast(context);
+    if (Marking::IsBlack(ObjectMarking::MarkBitFrom(native_context))) {
+      size_t size = std::min(visitor.SizeOf(native_context),
+                             static_cast<size_t>(Smi::kMaxValue));
+      native_context->set(Context::LIVE_SIZE_INDEX,
+                          Smi::FromInt(static_cast<int>(size)),
+                          SKIP_WRITE_BARRIER);
+    }
+    context = native_context->get(Context::NEXT_CONTEXT_LINK);
+  }
+}
+
 void MarkCompactCollector::MarkLiveObjects() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_MARK);
   // The recursive GC marker detects when it is nearing stack overflow,
@@ -2622,9 +2816,40 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 }
 
 
+void MarkCompactCollector::MarkWeakCollectionEntry(ObjectHashTable* table,
+                                                   int entry) {
+  Object** key_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(entry));
+  RecordSlot(table, key_slot, *key_slot);
+  Object** value_slot =
+      table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(entry));
+  MarkCompactMarkingVisitor::MarkObjectByPointer(this, table, value_slot);
+}
+
+
 void MarkCompactCollector::ProcessWeakCollections() {
+  // Revisit the entries whose keys were unmarked so far, and drop the ones
+  // whose key got marked in the meantime. This keeps the work per round
+  // proportional to the number of unresolved entries, rather than to the
+  // total capacity of all weak collections.
+  size_t remaining = 0;
+  for (size_t i = 0; i < pending_ephemerons_.size(); i++) {
+    Ephemeron ephemeron = pending_ephemerons_[i];
+    HeapObject* key = HeapObject::cast(ephemeron.table->KeyAt(ephemeron.entry));
+    if (MarkCompactCollector::IsMarked(key)) {
+      MarkWeakCollectionEntry(ephemeron.table, ephemeron.entry);
+    } else {
+      pending_ephemerons_[remaining++] = ephemeron;
+    }
+  }
+  pending_ephemerons_.resize(remaining);
+
+  // Scan the weak collections encountered since the last round. They are
+  // prepended to the list, so they come before the previous head.
   Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::kZero) {
+  Object* const scanned_head = weak_collection_obj;
+  while (weak_collection_obj != last_scanned_weak_collection_) {
+    DCHECK_NE(Smi::kZero, weak_collection_obj);
     JSWeakCollection* weak_collection =
         reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
     DCHECK(MarkCompactCollector::IsMarked(weak_collection));
@@ -2632,18 +2857,15 @@ void MarkCompactCollector::ProcessWeakCollections() {
       ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
       for (int i = 0; i < table->Capacity(); i++) {
         if (MarkCompactCollector::IsMarked(HeapObject::cast(table->KeyAt(i)))) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(table, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          MarkCompactMarkingVisitor::MarkObjectByPointer(this, table,
-                                                         value_slot);
+          MarkWeakCollectionEntry(table, i);
+        } else {
+          pending_ephemerons_.push_back({table, i});
         }
       }
     }
     weak_collection_obj = weak_collection->next();
   }
+  last_scanned_weak_collection_ = scanned_head;
 }
 
 
@@ -2667,6 +2889,8 @@ void MarkCompactCollector::ClearWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::kZero);
+  pending_ephemerons_.clear();
+  last_scanned_weak_collection_ = Smi::kZero;
 }
 
 
@@ -2679,6 +2903,8 @@ void MarkCompactCollector::AbortWeakCollections() {
     weak_collection->set_next(heap()->undefined_value());
   }
   heap()->set_encountered_weak_collections(Smi::kZero);
+  pending_ephemerons_.clear();
+  last_scanned_weak_collection_ = Smi::kZero;
 }
 
 
@@ -3316,6 +3542,25 @@ class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
   }
 };
 
+// Free ranges of at least this size are returned to the OS when sweeping
+// during memory-reducing GCs.
+static const size_t kMinDiscardableFreeSize = 64 * KB;
+
+// Returns the OS pages inside a free range to the OS while keeping them
+// committed, so they are repopulated on the next access. The free space
+// header at the start of the range is preserved. This must happen before the
+// range is added to the free list, where it could be allocated from
+// concurrently.
+static void DiscardFreeMemory(Address start, size_t size) {
+  if (size < kMinDiscardableFreeSize) return;
+  const size_t page_size = static_cast<size_t>(base::OS::CommitPageSize());
+  Address discard_start = RoundUp(start + FreeSpace::kSize, page_size);
+  Address discard_end = RoundDown(start + size, page_size);
+  if (discard_start >= discard_end) return;
+  base::OS::DiscardSystemPages(
+      discard_start, static_cast<size_t>(discard_end - discard_start));
+}
+
 int MarkCompactCollector::Sweeper::RawSweep(
     Page* p, FreeListRebuildingMode free_list_mode,
     FreeSpaceTreatmentMode free_space_mode) {
@@ -3350,6 +3595,9 @@ int MarkCompactCollector::Sweeper::RawSweep(
   intptr_t max_freed_bytes = 0;
   int curr_region = -1;
 
+  const bool discard_free_memory =
+      free_list_mode == REBUILD_FREE_LIST && p->heap()->ShouldReduceMemory();
+
   LiveObjectIterator<kBlackObjects> it(p);
   HeapObject* object = NULL;
   bool clear_slots =
@@ -3363,6 +3611,7 @@ int MarkCompactCollector::Sweeper::RawSweep(
       if (free_space_mode == ZAP_FREE_SPACE) {
         memset(free_start, 0xcc, size);
       }
+      if (discard_free_memory) DiscardFreeMemory(free_start, size);
       if (free_list_mode == REBUILD_FREE_LIST) {
         freed_bytes = reinterpret_cast<PagedSpace*>(space)->UnaccountedFree(
             free_start, size);
@@ -3397,6 +3646,7 @@ int MarkCompactCollector::Sweeper::RawSweep(
     if (free_space_mode == ZAP_FREE_SPACE) {
       memset(free_start, 0xcc, size);
     }
+    if (discard_free_memory) DiscardFreeMemory(free_start, size);
     if (free_list_mode == REBUILD_FREE_LIST) {
       freed_bytes = reinterpret_cast<PagedSpace*>(space)->UnaccountedFree(
           free_start, size);
@@ -3522,6 +3772,7 @@ void MarkCompactCollector::EvacuateNewSpaceAndCandidates() {
 
     EvacuateNewSpacePrologue();
     EvacuatePagesInParallel();
+    heap()->array_buffer_freer()->FreeQueued();
     heap()->new_space()->set_age_mark(heap()->new_space()->top());
   }
 
@@ -6,6 +6,7 @@
 #define V8_HEAP_MARK_COMPACT_H_
 
 #include <deque>
+#include <vector>
 
 #include "src/base/bits.h"
 #include "src/heap/marking.h"
@@ -151,12 +152,19 @@ class CodeFlusher {
   inline void AddCandidate(SharedFunctionInfo* shared_info);
   inline void AddCandidate(JSFunction* function);
 
+  // Bytecode candidates cannot be linked through their code, which is the
+  // interpreter entry trampoline they all share, so they are kept in a list.
+  // Whether the bytecode is flushed is decided from the state of the
+  // function when processing the candidates, so they never need evicting.
+  inline void AddBytecodeCandidate(SharedFunctionInfo* shared_info);
+
   void EvictCandidate(SharedFunctionInfo* shared_info);
   void EvictCandidate(JSFunction* function);
 
   void ProcessCandidates() {
     ProcessSharedFunctionInfoCandidates();
     ProcessJSFunctionCandidates();
+    ProcessBytecodeCandidates();
   }
 
   void IteratePointersToFromSpace(ObjectVisitor* v);
@@ -164,6 +172,7 @@ class CodeFlusher {
  private:
   void ProcessJSFunctionCandidates();
   void ProcessSharedFunctionInfoCandidates();
+  void ProcessBytecodeCandidates();
 
   static inline JSFunction** GetNextCandidateSlot(JSFunction* candidate);
   static inline JSFunction* GetNextCandidate(JSFunction* candidate);
@@ -181,6 +190,7 @@ class CodeFlusher {
   Isolate* isolate_;
   JSFunction* jsfunction_candidates_head_;
   SharedFunctionInfo* shared_function_info_candidates_head_;
+  List<SharedFunctionInfo*> bytecode_candidates_;
 
   DISALLOW_COPY_AND_ASSIGN(CodeFlusher);
 };
@@ -498,6 +508,7 @@ class MarkCompactCollector {
   class EvacuateVisitorBase;
   class HeapObjectVisitor;
   class ObjectStatsVisitor;
+  class ContextLiveSizeVisitor;
 
   explicit MarkCompactCollector(Heap* heap);
 
@@ -511,6 +522,10 @@ class MarkCompactCollector {
 
   void RecordObjectStats();
 
+  // Stores the size of the live objects attributed to each native context in
+  // the context, see Context::GetLiveSize().
+  void RecordContextLiveSizes();
+
   // Finishes GC, performs heap verification if enabled.
   void Finish();
 
@@ -590,6 +605,11 @@ class MarkCompactCollector {
   // overflow flag will be set.
   void EmptyMarkingDeque();
 
+  // Like EmptyMarkingDeque() but objects that can be visited in parallel are
+  // collected and marked transitively by parallel marking tasks.
+  void EmptyMarkingDequeInParallel();
+  int NumberOfParallelMarkingTasks(int seeds);
+
   // Refill the marking stack with overflowed objects from the heap.  This
   // function either leaves the marking stack full or clears the overflow
   // flag on the marking stack.
@@ -625,9 +645,14 @@ class MarkCompactCollector {
 
   // Mark all values associated with reachable keys in weak collections
   // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
+  // the marking stack.  Each weak collection is scanned once; entries whose
+  // key is not marked yet are kept in pending_ephemerons_ and revisited in
+  // later rounds, until their key gets marked.
   void ProcessWeakCollections();
 
+  // Mark the value of the given weak collection entry, whose key is marked.
+  void MarkWeakCollectionEntry(ObjectHashTable* table, int entry);
+
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
   // The linked list of all encountered weak maps is destroyed.
@@ -725,6 +750,18 @@ class MarkCompactCollector {
 
   bool have_code_to_deoptimize_;
 
+  // An entry of a weak collection with a key that was not marked when the
+  // weak collection was scanned.
+  struct Ephemeron {
+    ObjectHashTable* table;
+    int entry;
+  };
+  std::vector<Ephemeron> pending_ephemerons_;
+
+  // The head of the encountered weak collections list the last time it was
+  // scanned by ProcessWeakCollections. New weak collections are prepended.
+  Object* last_scanned_weak_collection_;
+
   base::VirtualMemory* marking_deque_memory_;
   size_t marking_deque_memory_committed_;
   MarkingDeque marking_deque_;
@@ -5,6 +5,8 @@
 #ifndef V8_MARKING_H
 #define V8_MARKING_H
 
+#include "src/base/atomicops.h"
+#include "src/flags.h"
 #include "src/utils.h"
 
 namespace v8 {
@@ -35,13 +37,54 @@ class MarkBit {
     }
   }
 
-  inline void Set() { *cell_ |= mask_; }
+  // The concurrent marker races with the main thread on the cells, so all
+  // updates have to be atomic while it is enabled.
+  inline void Set() {
+    if (FLAG_concurrent_marking) {
+      SetAtomic();
+    } else {
+      *cell_ |= mask_;
+    }
+  }
   inline bool Get() { return (*cell_ & mask_) != 0; }
-  inline void Clear() { *cell_ &= ~mask_; }
+  inline void Clear() {
+    if (FLAG_concurrent_marking) {
+      ClearAtomic();
+    } else {
+      *cell_ &= ~mask_;
+    }
+  }
+
+  // Atomically sets the bit. Returns false if the bit was already set. Bitmap
+  // also uses this with masks of several bits, which are all set; the result
+  // is then only false if all of them were set already.
+  inline bool SetAtomic() {
+    base::Atomic32* cell = reinterpret_cast<base::Atomic32*>(cell_);
+    base::Atomic32 old_value;
+    do {
+      old_value = base::NoBarrier_Load(cell);
+      if ((static_cast<CellType>(old_value) & mask_) == mask_) return false;
+    } while (base::Release_CompareAndSwap(
+                 cell, old_value,
+                 static_cast<base::Atomic32>(old_value | mask_)) != old_value);
+    return true;
+  }
+
+  inline void ClearAtomic() {
+    base::Atomic32* cell = reinterpret_cast<base::Atomic32*>(cell_);
+    base::Atomic32 old_value;
+    do {
+      old_value = base::NoBarrier_Load(cell);
+      if ((static_cast<CellType>(old_value) & mask_) == 0) return;
+    } while (base::Release_CompareAndSwap(
+                 cell, old_value,
+                 static_cast<base::Atomic32>(old_value & ~mask_)) != old_value);
+  }
 
   CellType* cell_;
   CellType mask_;
 
+  friend class Bitmap;
   friend class IncrementalMarking;
   friend class Marking;
 };
@@ -117,15 +160,15 @@ class Bitmap {
     if (start_cell_index != end_cell_index) {
       // Firstly, fill all bits from the start address to the end of the first
       // cell with 1s.
-      cells()[start_cell_index] |= ~(start_index_mask - 1);
+      SetBitsInCell(start_cell_index, ~(start_index_mask - 1));
       // Then fill all in between cells with 1s.
       for (unsigned int i = start_cell_index + 1; i < end_cell_index; i++) {
         cells()[i] = ~0u;
       }
       // Finally, fill all bits until the end address in the last cell with 1s.
-      cells()[end_cell_index] |= (end_index_mask - 1);
+      SetBitsInCell(end_cell_index, end_index_mask - 1);
     } else {
-      cells()[start_cell_index] |= end_index_mask - start_index_mask;
+      SetBitsInCell(start_cell_index, end_index_mask - start_index_mask);
     }
   }
 
@@ -140,15 +183,15 @@ class Bitmap {
     if (start_cell_index != end_cell_index) {
       // Firstly, fill all bits from the start address to the end of the first
       // cell with 0s.
-      cells()[start_cell_index] &= (start_index_mask - 1);
+      ClearBitsInCell(start_cell_index, ~(start_index_mask - 1));
       // Then fill all in between cells with 0s.
       for (unsigned int i = start_cell_index + 1; i < end_cell_index; i++) {
         cells()[i] = 0;
       }
       // Finally, set all bits until the end address in the last cell with 0s.
-      cells()[end_cell_index] &= ~(end_index_mask - 1);
+      ClearBitsInCell(end_cell_index, end_index_mask - 1);
     } else {
-      cells()[start_cell_index] &= ~(end_index_mask - start_index_mask);
+      ClearBitsInCell(start_cell_index, end_index_mask - start_index_mask);
     }
   }
 
@@ -265,6 +308,25 @@ class Bitmap {
     }
     return true;
   }
+
+ private:
+  // Cells at the boundary of a range may be shared with objects that are
+  // concurrently marked, see MarkBit::Set.
+  void SetBitsInCell(uint32_t cell_index, MarkBit::CellType mask) {
+    if (FLAG_concurrent_marking) {
+      MarkBit(cells() + cell_index, mask).SetAtomic();
+    } else {
+      cells()[cell_index] |= mask;
+    }
+  }
+
+  void ClearBitsInCell(uint32_t cell_index, MarkBit::CellType mask) {
+    if (FLAG_concurrent_marking) {
+      MarkBit(cells() + cell_index, mask).ClearAtomic();
+    } else {
+      cells()[cell_index] &= ~mask;
+    }
+  }
 };
 
 class Marking : public AllStatic {
@@ -346,6 +408,23 @@ class Marking : public AllStatic {
     markbit.Next().Clear();
   }
 
+  // Transitions that may race with other marking threads. They return true
+  // iff the calling thread performed the transition.
+  INLINE(static bool WhiteToGreyAtomic(MarkBit markbit)) {
+    return markbit.SetAtomic();
+  }
+
+  INLINE(static bool GreyToBlackAtomic(MarkBit markbit)) {
+    DCHECK(markbit.Get());
+    return markbit.Next().SetAtomic();
+  }
+
+  INLINE(static bool WhiteToBlackAtomic(MarkBit markbit)) {
+    if (!markbit.SetAtomic()) return false;
+    markbit.Next().SetAtomic();
+    return true;
+  }
+
   enum ObjectColor {
     BLACK_OBJECT,
     WHITE_OBJECT,
@@ -36,7 +36,7 @@ void ObjectStats::ClearObjectStats(bool clear_last_time_stats) {
 V8_NOINLINE static void PrintJSONArray(size_t* array, const int len) {
   PrintF("[ ");
   for (int i = 0; i < len; i++) {
-    PrintF("%zu", array[i]);
+    PrintF("%" PRIuS, array[i]);
     if (i != (len - 1)) PrintF(", ");
   }
   PrintF(" ]");
@@ -63,7 +63,10 @@ void ObjectStats::PrintJSON(const char* key) {
   // gc_descriptor
   PrintF("{ ");
   PRINT_KEY_AND_ID();
-  PrintF("\"type\": \"gc_descriptor\", \"time\": %f }\n", time);
+  PrintF("\"type\": \"gc_descriptor\", \"time\": %f, ", time);
+  PrintF("\"map_space_size\": %" V8PRIdPTR ", ", heap()->map_space()->Size());
+  PrintF("\"map_space_committed\": %" PRIuS " }\n",
+         heap()->map_space()->CommittedMemory());
   // bucket_sizes
   PrintF("{ ");
   PRINT_KEY_AND_ID();
@@ -80,9 +83,9 @@ void ObjectStats::PrintJSON(const char* key) {
   PrintF("\"type\": \"instance_type_data\", ");                       \
   PrintF("\"instance_type\": %d, ", index);                           \
   PrintF("\"instance_type_name\": \"%s\", ", name);                   \
-  PrintF("\"overall\": %zu, ", object_sizes_[index]);                 \
-  PrintF("\"count\": %zu, ", object_counts_[index]);                  \
-  PrintF("\"over_allocated\": %zu, ", over_allocated_[index]);        \
+  PrintF("\"overall\": %" PRIuS ", ", object_sizes_[index]);          \
+  PrintF("\"count\": %" PRIuS ", ", object_counts_[index]);           \
+  PrintF("\"over_allocated\": %" PRIuS ", ", over_allocated_[index]); \
   PrintF("\"histogram\": ");                                          \
   PrintJSONArray(size_histogram_[index], kNumberOfBuckets);           \
   PrintF(",");                                                        \
@@ -101,16 +104,20 @@ void ObjectStats::PrintJSON(const char* key) {
   PRINT_INSTANCE_TYPE_DATA(    \
       "*CODE_AGE_" #name,      \
       FIRST_CODE_AGE_SUB_TYPE + Code::k##name##CodeAge - Code::kFirstCodeAge)
+#define MAP_SUB_INSTANCE_TYPE_WRAPPER(name) \
+  PRINT_INSTANCE_TYPE_DATA("*MAP_" #name, FIRST_MAP_SUB_TYPE + name)
 
   INSTANCE_TYPE_LIST(INSTANCE_TYPE_WRAPPER)
   CODE_KIND_LIST(CODE_KIND_WRAPPER)
   FIXED_ARRAY_SUB_INSTANCE_TYPE_LIST(FIXED_ARRAY_SUB_INSTANCE_TYPE_WRAPPER)
   CODE_AGE_LIST_COMPLETE(CODE_AGE_WRAPPER)
+  MAP_SUB_INSTANCE_TYPE_LIST(MAP_SUB_INSTANCE_TYPE_WRAPPER)
 
 #undef INSTANCE_TYPE_WRAPPER
 #undef CODE_KIND_WRAPPER
 #undef FIXED_ARRAY_SUB_INSTANCE_TYPE_WRAPPER
 #undef CODE_AGE_WRAPPER
+#undef MAP_SUB_INSTANCE_TYPE_WRAPPER
 #undef PRINT_INSTANCE_TYPE_DATA
 #undef PRINT_KEY_AND_ID
 }
@@ -123,6 +130,9 @@ void ObjectStats::Dump(std::stringstream& stream) {
   stream << "\"isolate\":\"" << reinterpret_cast<void*>(isolate()) << "\",";
   stream << "\"id\":" << gc_count << ",";
   stream << "\"time\":" << time << ",";
+  stream << "\"map_space_size\":" << heap()->map_space()->Size() << ",";
+  stream << "\"map_space_committed\":"
+         << heap()->map_space()->CommittedMemory() << ",";
   stream << "\"bucket_sizes\":[";
   for (int i = 0; i < kNumberOfBuckets; i++) {
     stream << (1 << (kFirstBucketShift + i));
@@ -154,17 +164,21 @@ void ObjectStats::Dump(std::stringstream& stream) {
   PRINT_INSTANCE_TYPE_DATA(    \
       "*CODE_AGE_" #name,      \
       FIRST_CODE_AGE_SUB_TYPE + Code::k##name##CodeAge - Code::kFirstCodeAge)
+#define MAP_SUB_INSTANCE_TYPE_WRAPPER(name) \
+  PRINT_INSTANCE_TYPE_DATA("*MAP_" #name, FIRST_MAP_SUB_TYPE + name)
 
   INSTANCE_TYPE_LIST(INSTANCE_TYPE_WRAPPER);
   CODE_KIND_LIST(CODE_KIND_WRAPPER);
   FIXED_ARRAY_SUB_INSTANCE_TYPE_LIST(FIXED_ARRAY_SUB_INSTANCE_TYPE_WRAPPER);
   CODE_AGE_LIST_COMPLETE(CODE_AGE_WRAPPER);
+  MAP_SUB_INSTANCE_TYPE_LIST(MAP_SUB_INSTANCE_TYPE_WRAPPER);
   stream << "\"END\":{}}}";
 
 #undef INSTANCE_TYPE_WRAPPER
 #undef CODE_KIND_WRAPPER
 #undef FIXED_ARRAY_SUB_INSTANCE_TYPE_WRAPPER
 #undef CODE_AGE_WRAPPER
+#undef MAP_SUB_INSTANCE_TYPE_WRAPPER
 #undef PRINT_INSTANCE_TYPE_DATA
 }
 
@@ -440,6 +454,20 @@ void ObjectStatsCollector::RecordScriptDetails(Script* obj) {
 }
 
 void ObjectStatsCollector::RecordMapDetails(Map* map_obj) {
+  int map_sub_type;
+  if (map_obj->is_deprecated()) {
+    map_sub_type = DEPRECATED_MAP_SUB_TYPE;
+  } else if (map_obj->is_prototype_map()) {
+    map_sub_type = PROTOTYPE_MAP_SUB_TYPE;
+  } else if (map_obj->is_dictionary_map()) {
+    map_sub_type = DICTIONARY_MAP_SUB_TYPE;
+  } else if (map_obj->is_stable()) {
+    map_sub_type = STABLE_MAP_SUB_TYPE;
+  } else {
+    map_sub_type = UNSTABLE_MAP_SUB_TYPE;
+  }
+  stats_->RecordMapSubTypeStats(map_sub_type, map_obj->Size());
+
   DescriptorArray* array = map_obj->instance_descriptors();
   if (map_obj->owns_descriptors() && array != heap_->empty_descriptor_array() &&
       SameLiveness(map_obj, array)) {
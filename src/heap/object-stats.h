@@ -28,7 +28,8 @@ class ObjectStats {
         FIRST_CODE_KIND_SUB_TYPE + Code::NUMBER_OF_KINDS,
     FIRST_CODE_AGE_SUB_TYPE =
         FIRST_FIXED_ARRAY_SUB_TYPE + LAST_FIXED_ARRAY_SUB_TYPE + 1,
-    OBJECT_STATS_COUNT = FIRST_CODE_AGE_SUB_TYPE + Code::kCodeAgeCount + 1
+    FIRST_MAP_SUB_TYPE = FIRST_CODE_AGE_SUB_TYPE + Code::kCodeAgeCount + 1,
+    OBJECT_STATS_COUNT = FIRST_MAP_SUB_TYPE + LAST_MAP_SUB_TYPE + 1
   };
 
   void ClearObjectStats(bool clear_last_time_stats = false);
@@ -61,6 +62,14 @@ class ObjectStats {
     size_histogram_[code_age_index][idx]++;
   }
 
+  void RecordMapSubTypeStats(int map_sub_type, size_t size) {
+    DCHECK(map_sub_type <= LAST_MAP_SUB_TYPE);
+    object_counts_[FIRST_MAP_SUB_TYPE + map_sub_type]++;
+    object_sizes_[FIRST_MAP_SUB_TYPE + map_sub_type] += size;
+    size_histogram_[FIRST_MAP_SUB_TYPE + map_sub_type]
+                   [HistogramIndexFromSize(size)]++;
+  }
+
   bool RecordFixedArraySubTypeStats(FixedArrayBase* array, int array_sub_type,
                                     size_t size, size_t over_allocated) {
     auto it = visited_fixed_array_sub_types_.insert(array);
@@ -154,10 +154,7 @@ void StaticMarkingVisitor<StaticVisitor>::Initialize() {
 
   table_.Register(kVisitByteArray, &DataObjectVisitor::Visit);
 
-  table_.Register(
-      kVisitBytecodeArray,
-      &FixedBodyVisitor<StaticVisitor, BytecodeArray::MarkingBodyDescriptor,
-                        void>::Visit);
+  table_.Register(kVisitBytecodeArray, &VisitBytecodeArray);
 
   table_.Register(kVisitFreeSpace, &DataObjectVisitor::Visit);
 
@@ -424,6 +421,19 @@ void StaticMarkingVisitor<StaticVisitor>::VisitCode(Map* map,
 }
 
 
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::VisitBytecodeArray(
+    Map* map, HeapObject* object) {
+  typedef FixedBodyVisitor<StaticVisitor, BytecodeArray::MarkingBodyDescriptor,
+                           void> BytecodeArrayBodyVisitor;
+  Heap* heap = map->GetHeap();
+  if (FLAG_age_code && !heap->isolate()->serializer_enabled()) {
+    BytecodeArray::cast(object)->MakeOlder();
+  }
+  BytecodeArrayBodyVisitor::Visit(map, object);
+}
+
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
     Map* map, HeapObject* object) {
@@ -440,6 +450,15 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfo(
   }
   MarkCompactCollector* collector = heap->mark_compact_collector();
   if (collector->is_code_flushing_enabled()) {
+    if (IsFlushableBytecode(heap, shared)) {
+      // This function's bytecode looks flushable. But we have to postpone
+      // the decision until marking is done, because the bytecode might
+      // still be referenced from the stack or by optimized code.
+      collector->code_flusher()->AddBytecodeCandidate(shared);
+      // Treat the reference to the bytecode array weakly.
+      VisitSharedFunctionInfoWeakBytecode(map, object);
+      return;
+    }
     if (IsFlushable(heap, shared)) {
       // This function's code looks flushable. But we have to postpone
       // the decision until we see all functions that point to the same
@@ -480,7 +499,17 @@ void StaticMarkingVisitor<StaticVisitor>::VisitJSFunction(Map* map,
       return;
     } else {
       // Visit all unoptimized code objects to prevent flushing them.
-      StaticVisitor::MarkObject(heap, function->shared()->code());
+      SharedFunctionInfo* shared = function->shared();
+      StaticVisitor::MarkObject(heap, shared->code());
+      // Closures running other code than their function, e.g. optimized
+      // code, might deoptimize to the bytecode, so it must be kept. Closures
+      // running the interpreter entry trampoline heal themselves when the
+      // bytecode of their function has been flushed.
+      if (shared->HasBytecodeArray() && function->code() != shared->code() &&
+          function->code() !=
+              heap->isolate()->builtins()->builtin(Builtins::kCompileLazy)) {
+        StaticVisitor::MarkObject(heap, shared->bytecode_array());
+      }
     }
   }
   VisitJSFunctionStrongCode(map, object);
@@ -621,6 +650,73 @@ bool StaticMarkingVisitor<StaticVisitor>::IsFlushable(
   return true;
 }
 
+template <typename StaticVisitor>
+bool StaticMarkingVisitor<StaticVisitor>::IsFlushableBytecode(
+    Heap* heap, SharedFunctionInfo* shared_info) {
+  if (!FLAG_flush_bytecode || !shared_info->HasBytecodeArray()) {
+    return false;
+  }
+
+  // Only flush bytecode for functions which are interpreted, i.e. have no
+  // baseline code that was compiled alongside the bytecode.
+  if (shared_info->code() !=
+      heap->isolate()->builtins()->builtin(
+          Builtins::kInterpreterEntryTrampoline)) {
+    return false;
+  }
+
+  // Bytecode is either on stack, in compilation cache or referenced
+  // by optimized code.
+  BytecodeArray* bytecode = shared_info->bytecode_array();
+  MarkBit bytecode_mark = ObjectMarking::MarkBitFrom(bytecode);
+  if (Marking::IsBlackOrGrey(bytecode_mark)) {
+    return false;
+  }
+
+  // The function must have the source code available, to be able to
+  // recompile it in case we need the function again.
+  if (!HasSourceCode(heap, shared_info)) {
+    return false;
+  }
+
+  // Function must be lazy compilable.
+  if (!shared_info->allows_lazy_compilation()) {
+    return false;
+  }
+
+  // We do not flush bytecode for generator functions, or async functions,
+  // because we don't know if there are still live activations (generator
+  // objects) on the heap.
+  if (IsResumableFunction(shared_info->kind())) {
+    return false;
+  }
+
+  // If this is a full script wrapped in a function we do not flush the
+  // bytecode.
+  if (shared_info->is_toplevel()) {
+    return false;
+  }
+
+  // The function must not be a builtin.
+  if (shared_info->IsBuiltin()) {
+    return false;
+  }
+
+  // Maintain the bytecode that the debugger copied for break points.
+  if (shared_info->HasDebugInfo()) {
+    return false;
+  }
+
+  // If this is a function initialized with %SetCode then the one-to-one
+  // relation between SharedFunctionInfo and bytecode is broken.
+  if (shared_info->dont_flush()) {
+    return false;
+  }
+
+  // Check age of bytecode. If code aging is disabled we never flush.
+  return FLAG_age_code && bytecode->IsOld();
+}
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoStrongCode(
     Map* map, HeapObject* object) {
@@ -638,6 +734,22 @@ void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakCode(
                    void>::Visit(map, object);
 }
 
+template <typename StaticVisitor>
+void StaticMarkingVisitor<StaticVisitor>::VisitSharedFunctionInfoWeakBytecode(
+    Map* map, HeapObject* object) {
+  // Skip visiting kFunctionDataOffset as it is treated weakly here.
+  Heap* heap = map->GetHeap();
+  StaticVisitor::VisitPointers(
+      heap, object,
+      HeapObject::RawField(object, SharedFunctionInfo::kCodeOffset),
+      HeapObject::RawField(object, SharedFunctionInfo::kFunctionDataOffset));
+  StaticVisitor::VisitPointers(
+      heap, object,
+      HeapObject::RawField(object, SharedFunctionInfo::kScriptOffset),
+      HeapObject::RawField(object,
+                           SharedFunctionInfo::BodyDescriptor::kEndOffset));
+}
+
 template <typename StaticVisitor>
 void StaticMarkingVisitor<StaticVisitor>::VisitJSFunctionStrongCode(
     Map* map, HeapObject* object) {
@@ -0,0 +1,327 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/parallel-marking.h"
+
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+#include "src/cancelable-task.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/mark-compact-inl.h"
+#include "src/heap/marking.h"
+#include "src/heap/objects-visiting.h"
+#include "src/isolate.h"
+#include "src/macro-assembler.h"
+#include "src/objects-body-descriptors-inl.h"
+#include "src/v8.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Idle tasks poll for stealable work and for termination. They poll right
+// away for a while, then sleep for exponentially growing intervals, so that
+// they do not keep cores busy while the last tasks finish their work.
+class IdleBackoff {
+ public:
+  IdleBackoff() : polls_(0) {}
+
+  void Wait() {
+    const int kPollsBeforeSleeping = 64;
+    const int kMaxSleepShift = 7;  // 128 microseconds.
+    polls_++;
+    if (polls_ <= kPollsBeforeSleeping) return;
+    int shift = Min(polls_ - kPollsBeforeSleeping - 1, kMaxSleepShift);
+    base::OS::Sleep(base::TimeDelta::FromMicroseconds(1 << shift));
+  }
+
+ private:
+  int polls_;
+};
+
+}  // namespace
+
+// Marking state of a single task.
+class ParallelMarking::Marker {
+ public:
+  typedef std::pair<HeapObject*, Object**> RecordedSlot;
+
+  Marker() : stealable_size_(0) {}
+
+  void Initialize(Heap* heap) { heap_ = heap; }
+
+  void Push(HeapObject* object) {
+    local_.Add(object);
+    // Make work available to other tasks once the private stack grows and
+    // all previously published work was taken.
+    if (local_.length() >= kPublishThreshold && stealable_size_.Value() == 0) {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      int half = local_.length() / 2;
+      for (int i = 0; i < half; i++) {
+        stealable_.Add(local_.RemoveLast());
+      }
+      stealable_size_.SetValue(stealable_.length());
+    }
+  }
+
+  // Adds an object directly to the stealable stack.
+  void Publish(HeapObject* object) {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    stealable_.Add(object);
+    stealable_size_.SetValue(stealable_.length());
+  }
+
+  bool Pop(HeapObject** object) {
+    if (local_.is_empty()) return false;
+    *object = local_.RemoveLast();
+    return true;
+  }
+
+  // Moves published work of this marker to the private stack of {thief}.
+  // Other tasks take half of the published work, the owner takes all of it.
+  bool StealInto(Marker* thief) {
+    if (stealable_size_.Value() == 0) return false;
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (stealable_.is_empty()) return false;
+    int count = stealable_.length();
+    if (thief != this) count = Max(1, count / 2);
+    for (int i = 0; i < count; i++) {
+      thief->local_.Add(stealable_.RemoveLast());
+    }
+    stealable_size_.SetValue(stealable_.length());
+    return true;
+  }
+
+  bool HasStealableWork() { return stealable_size_.Value() > 0; }
+
+  inline void VisitObject(HeapObject* object);
+
+  void MarkObjectByPointer(HeapObject* host, Object** slot) {
+    if (!(*slot)->IsHeapObject()) return;
+    HeapObject* object = HeapObject::cast(*slot);
+    if (MarkCompactCollector::IsOnEvacuationCandidate(object)) {
+      recorded_slots_.Add(RecordedSlot(host, slot));
+    }
+    MarkBit mark_bit = ObjectMarking::MarkBitFrom(object);
+    if (!Marking::IsWhite(mark_bit)) return;
+    Map* map = object->map();
+    if (!CanVisitInParallel(map)) {
+      bailout_.Add(object);
+      return;
+    }
+    if (Marking::WhiteToBlackAtomic(mark_bit)) {
+      live_bytes_[MemoryChunk::FromAddress(object->address())] +=
+          object->SizeFromMap(map);
+      Push(object);
+    }
+  }
+
+  // Merges live bytes and recorded slots and hands out bailout objects. Must
+  // be called on the main thread after all tasks finished.
+  void Finalize(List<HeapObject*>* bailout) {
+    DCHECK(local_.is_empty());
+    DCHECK(stealable_.is_empty());
+    for (auto& entry : live_bytes_) {
+      entry.first->IncrementLiveBytes(static_cast<int>(entry.second));
+    }
+    live_bytes_.clear();
+    MarkCompactCollector* collector = heap_->mark_compact_collector();
+    for (int i = 0; i < recorded_slots_.length(); i++) {
+      HeapObject* host = recorded_slots_[i].first;
+      Object** slot = recorded_slots_[i].second;
+      collector->RecordSlot(host, slot, *slot);
+    }
+    recorded_slots_.Clear();
+    bailout->AddAll(bailout_);
+    bailout_.Clear();
+  }
+
+ private:
+  static const int kPublishThreshold = 128;
+
+  Heap* heap_;
+  List<HeapObject*> local_;
+  base::Mutex mutex_;
+  List<HeapObject*> stealable_;
+  base::AtomicNumber<int> stealable_size_;
+  List<HeapObject*> bailout_;
+  List<RecordedSlot> recorded_slots_;
+  std::unordered_map<MemoryChunk*, intptr_t> live_bytes_;
+};
+
+class ParallelMarking::MarkingVisitor : public ObjectVisitor {
+ public:
+  MarkingVisitor(Marker* marker, HeapObject* host)
+      : marker_(marker), host_(host) {}
+
+  void VisitPointer(Object** p) override {
+    marker_->MarkObjectByPointer(host_, p);
+  }
+
+  void VisitPointers(Object** start, Object** end) override {
+    for (Object** p = start; p < end; p++) {
+      marker_->MarkObjectByPointer(host_, p);
+    }
+  }
+
+ private:
+  Marker* marker_;
+  HeapObject* host_;
+};
+
+void ParallelMarking::Marker::VisitObject(HeapObject* object) {
+  Map* map = object->map();
+  MarkBit map_mark = ObjectMarking::MarkBitFrom(map);
+  if (Marking::IsWhite(map_mark)) bailout_.Add(map);
+  MarkingVisitor visitor(this, object);
+  object->IterateBodyFast(map->instance_type(), object->SizeFromMap(map),
+                          &visitor);
+}
+
+class ParallelMarking::Task : public CancelableTask {
+ public:
+  Task(Isolate* isolate, ParallelMarking* parallel_marking, int task_index)
+      : CancelableTask(isolate),
+        parallel_marking_(parallel_marking),
+        task_index_(task_index) {}
+
+  virtual ~Task() {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    parallel_marking_->ProcessWork(task_index_);
+    parallel_marking_->on_finish_->Signal();
+  }
+
+  ParallelMarking* parallel_marking_;
+  int task_index_;
+  DISALLOW_COPY_AND_ASSIGN(Task);
+};
+
+ParallelMarking::ParallelMarking(Heap* heap, base::Semaphore* on_finish)
+    : heap_(heap),
+      on_finish_(on_finish),
+      markers_(new Marker[kMaxNumberOfTasks]),
+      num_tasks_(0),
+      active_tasks_(0) {
+  for (int i = 0; i < kMaxNumberOfTasks; i++) {
+    markers_[i].Initialize(heap);
+  }
+}
+
+ParallelMarking::~ParallelMarking() { delete[] markers_; }
+
+bool ParallelMarking::CanVisitInParallel(Map* map) {
+  int id = map->visitor_id();
+  switch (id) {
+    case StaticVisitorBase::kVisitSeqOneByteString:
+    case StaticVisitorBase::kVisitSeqTwoByteString:
+    case StaticVisitorBase::kVisitShortcutCandidate:
+    case StaticVisitorBase::kVisitConsString:
+    case StaticVisitorBase::kVisitSlicedString:
+    case StaticVisitorBase::kVisitSymbol:
+    case StaticVisitorBase::kVisitByteArray:
+    case StaticVisitorBase::kVisitFixedArray:
+    case StaticVisitorBase::kVisitFixedDoubleArray:
+      return true;
+    default:
+      break;
+  }
+  return (id >= StaticVisitorBase::kVisitDataObject &&
+          id <= StaticVisitorBase::kVisitDataObjectGeneric) ||
+         (id >= StaticVisitorBase::kVisitJSObject &&
+          id <= StaticVisitorBase::kVisitJSObjectGeneric) ||
+         (id >= StaticVisitorBase::kVisitStruct &&
+          id <= StaticVisitorBase::kVisitStructGeneric);
+}
+
+void ParallelMarking::Run(int num_tasks, List<HeapObject*>* seeds,
+                          List<HeapObject*>* bailout) {
+  if (seeds->is_empty()) return;
+  DCHECK_GE(num_tasks, 1);
+  const int max_num_tasks = Min(
+      kMaxNumberOfTasks,
+      static_cast<int>(
+          V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()));
+  num_tasks_ = Max(1, Min(num_tasks, max_num_tasks));
+  // The seeds are distributed round robin over the stealable stacks, so that
+  // tasks that are already running pick up the work of tasks that have not
+  // started yet.
+  for (int i = 0; i < seeds->length(); i++) {
+    HeapObject* object = seeds->at(i);
+    DCHECK(Marking::IsBlack(ObjectMarking::MarkBitFrom(object)));
+    DCHECK(CanVisitInParallel(object->map()));
+    markers_[i % num_tasks_].Publish(object);
+  }
+  uint32_t task_ids[kMaxNumberOfTasks];
+  for (int i = 1; i < num_tasks_; i++) {
+    Task* task = new Task(heap_->isolate(), this, i);
+    task_ids[i] = task->id();
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+  // Contribute on main thread.
+  ProcessWork(0);
+  // Wait for background tasks. Work of aborted tasks was stolen by the
+  // remaining tasks before they terminated.
+  CancelableTaskManager* cancelable_task_manager =
+      heap_->isolate()->cancelable_task_manager();
+  for (int i = 1; i < num_tasks_; i++) {
+    if (!cancelable_task_manager->TryAbort(task_ids[i])) {
+      on_finish_->Wait();
+    }
+  }
+  for (int i = 0; i < num_tasks_; i++) {
+    markers_[i].Finalize(bailout);
+  }
+}
+
+void ParallelMarking::ProcessWork(int task_index) {
+  Marker* marker = &markers_[task_index];
+  active_tasks_.Increment(1);
+  while (true) {
+    HeapObject* object = nullptr;
+    while (marker->Pop(&object)) {
+      marker->VisitObject(object);
+    }
+    if (Steal(task_index)) continue;
+    // Out of work. A task only terminates when all tasks are idle and no
+    // published work is left. Idle tasks cannot publish work, so the
+    // stealable stacks cannot be refilled afterwards.
+    active_tasks_.Increment(-1);
+    IdleBackoff backoff;
+    bool found_work = false;
+    while (!found_work) {
+      if (active_tasks_.Value() == 0 && !HasStealableWork()) return;
+      if (HasStealableWork()) {
+        active_tasks_.Increment(1);
+        found_work = Steal(task_index);
+        if (found_work) break;
+        active_tasks_.Increment(-1);
+      }
+      backoff.Wait();
+    }
+  }
+}
+
+bool ParallelMarking::Steal(int task_index) {
+  Marker* thief = &markers_[task_index];
+  for (int i = 0; i < num_tasks_; i++) {
+    Marker* victim = &markers_[(task_index + i) % num_tasks_];
+    if (victim->StealInto(thief)) return true;
+  }
+  return false;
+}
+
+bool ParallelMarking::HasStealableWork() {
+  for (int i = 0; i < num_tasks_; i++) {
+    if (markers_[i].HasStealableWork()) return true;
+  }
+  return false;
+}
+
+}  // namespace internal
+}  // namespace v8
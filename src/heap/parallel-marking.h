@@ -0,0 +1,76 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PARALLEL_MARKING_H_
+#define V8_HEAP_PARALLEL_MARKING_H_
+
+#include <unordered_map>
+#include <utility>
+
+#include "src/base/atomic-utils.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/list.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+class HeapObject;
+class Map;
+class MemoryChunk;
+class Object;
+
+// Computes the transitive closure of a set of black objects with multiple
+// threads during the atomic pause of a full garbage collection.
+//
+// Every task owns a private marking stack and a stealable stack. Tasks
+// publish part of their private work once it grows beyond a threshold and
+// steal published work from other tasks when they run out of work.
+//
+// Only objects whose marking visitor has no side effects besides marking and
+// slot recording are visited in parallel, see CanVisitInParallel(). Unmarked
+// objects of other types that are discovered by the tasks are returned to the
+// caller as bailouts and need to be marked on the main thread.
+class ParallelMarking {
+ public:
+  ParallelMarking(Heap* heap, base::Semaphore* on_finish);
+  ~ParallelMarking();
+
+  // Returns true if objects with the given map can be visited by marking
+  // tasks.
+  static bool CanVisitInParallel(Map* map);
+
+  // Visits all objects in {seeds} and everything transitively reachable from
+  // them using the given number of tasks. All objects in {seeds} need to be
+  // black and visitable in parallel. Unmarked objects that cannot be visited
+  // in parallel are added to {bailout}. Blocks until marking has finished.
+  void Run(int num_tasks, List<HeapObject*>* seeds,
+           List<HeapObject*>* bailout);
+
+ private:
+  class Marker;
+  class MarkingVisitor;
+  class Task;
+
+  static const int kMaxNumberOfTasks = 8;
+
+  // Marking loop of the task with the given index, including termination.
+  void ProcessWork(int task_index);
+  bool Steal(int task_index);
+  bool HasStealableWork();
+
+  Heap* heap_;
+  base::Semaphore* on_finish_;
+  Marker* markers_;
+  int num_tasks_;
+  base::AtomicNumber<int> active_tasks_;
+
+  DISALLOW_COPY_AND_ASSIGN(ParallelMarking);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PARALLEL_MARKING_H_
@@ -29,9 +29,11 @@ void ScavengeJob::IdleTask::RunInternal(double deadline_in_seconds) {
   size_t new_space_capacity = heap->new_space()->Capacity();
 
   job_->NotifyIdleTask();
+  job_->RecordIdleTime(idle_time_in_ms);
 
   if (ReachedIdleAllocationLimit(scavenge_speed_in_bytes_per_ms, new_space_size,
-                                 new_space_capacity)) {
+                                 new_space_capacity,
+                                 job_->average_idle_time_ms())) {
     if (EnoughIdleTimeForScavenge(
             idle_time_in_ms, scavenge_speed_in_bytes_per_ms, new_space_size)) {
       heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kIdleTask);
@@ -42,16 +44,23 @@ void ScavengeJob::IdleTask::RunInternal(double deadline_in_seconds) {
   }
 }
 
+void ScavengeJob::RecordIdleTime(double idle_time_ms) {
+  if (idle_time_ms <= 0) return;
+  idle_time_ms = Min<double>(idle_time_ms, kMaxIdleTimeMs);
+  average_idle_time_ms_ = (average_idle_time_ms_ + idle_time_ms) / 2;
+}
+
 bool ScavengeJob::ReachedIdleAllocationLimit(
     double scavenge_speed_in_bytes_per_ms, size_t new_space_size,
-    size_t new_space_capacity) {
+    size_t new_space_capacity, double average_idle_time_ms) {
   if (scavenge_speed_in_bytes_per_ms == 0) {
     scavenge_speed_in_bytes_per_ms = kInitialScavengeSpeedInBytesPerMs;
   }
 
   // Set the allocation limit to the number of bytes we can scavenge in an
   // average idle task.
-  double allocation_limit = kAverageIdleTimeMs * scavenge_speed_in_bytes_per_ms;
+  double allocation_limit =
+      average_idle_time_ms * scavenge_speed_in_bytes_per_ms;
 
   // Keep the limit smaller than the new space capacity.
   allocation_limit =
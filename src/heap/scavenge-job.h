@@ -32,7 +32,8 @@ class ScavengeJob {
   ScavengeJob()
       : idle_task_pending_(false),
         idle_task_rescheduled_(false),
-        bytes_allocated_since_the_last_task_(0) {}
+        bytes_allocated_since_the_last_task_(0),
+        average_idle_time_ms_(kAverageIdleTimeMs) {}
 
   // Posts an idle task if the cumulative bytes allocated since the last
   // idle task exceed kBytesAllocatedBeforeNextIdleTask.
@@ -47,9 +48,15 @@ class ScavengeJob {
   void NotifyIdleTask() { idle_task_pending_ = false; }
   bool IdleTaskRescheduled() { return idle_task_rescheduled_; }
 
-  static bool ReachedIdleAllocationLimit(double scavenge_speed_in_bytes_per_ms,
-                                         size_t new_space_size,
-                                         size_t new_space_capacity);
+  // Updates the running average of the idle time that idle tasks get, so
+  // that the allocation limit follows the idle windows of the embedder.
+  void RecordIdleTime(double idle_time_ms);
+  double average_idle_time_ms() const { return average_idle_time_ms_; }
+
+  static bool ReachedIdleAllocationLimit(
+      double scavenge_speed_in_bytes_per_ms, size_t new_space_size,
+      size_t new_space_capacity,
+      double average_idle_time_ms = kAverageIdleTimeMs);
 
   static bool EnoughIdleTimeForScavenge(double idle_time_ms,
                                         double scavenge_speed_in_bytes_per_ms,
@@ -58,8 +65,12 @@ class ScavengeJob {
   // If we haven't recorded any scavenger events yet, we use a conservative
   // lower bound for the scavenger speed.
   static const int kInitialScavengeSpeedInBytesPerMs = 256 * KB;
-  // Estimate of the average idle time that an idle task gets.
+  // Estimate of the average idle time that an idle task gets, used until idle
+  // tasks have run.
   static const int kAverageIdleTimeMs = 5;
+  // Idle times are capped when averaging, so that a single long idle period
+  // does not delay scavenges for many short ones.
+  static const int kMaxIdleTimeMs = 50;
   // The number of bytes to be allocated in new space before the next idle
   // task is posted.
   static const size_t kBytesAllocatedBeforeNextIdleTask = 512 * KB;
@@ -73,6 +84,7 @@ class ScavengeJob {
   bool idle_task_pending_;
   bool idle_task_rescheduled_;
   int bytes_allocated_since_the_last_task_;
+  double average_idle_time_ms_;
 };
 }  // namespace internal
 }  // namespace v8
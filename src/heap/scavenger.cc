@@ -7,7 +7,10 @@
 #include "src/contexts.h"
 #include "src/heap/heap.h"
 #include "src/heap/objects-visiting-inl.h"
+#include "src/heap/page-parallel-job.h"
+#include "src/heap/remembered-set.h"
 #include "src/heap/scavenger-inl.h"
+#include "src/heap/spaces-inl.h"
 #include "src/isolate.h"
 #include "src/log.h"
 
@@ -360,6 +363,306 @@ template <MarksHandling marks_handling,
 VisitorDispatchTable<ScavengingCallback>
     ScavengingVisitor<marks_handling, logging_and_profiling_mode>::table_;
 
+// Thread-local state of a parallel scavenging task. Objects are copied into a
+// local allocation buffer in to-space or promoted into a local compaction
+// space. The forwarding address is installed with a compare-and-swap on the
+// map word, so an object reachable from slots processed by different tasks is
+// copied exactly once. Every task processes the bodies of the objects it
+// copied itself, which yields the transitive closure of its slots.
+class Scavenger::LocalScavenger : public Malloced {
+ public:
+  explicit LocalScavenger(Heap* heap)
+      : heap_(heap),
+        compaction_spaces_(heap),
+        buffer_(LocalAllocationBuffer::InvalidBuffer()),
+        local_pretenuring_feedback_(kInitialLocalPretenuringFeedbackCapacity),
+        promoted_size_(0),
+        semispace_copied_size_(0) {}
+
+  // Scavenges all objects reachable from the untyped OLD_TO_NEW slots of the
+  // given {chunk}.
+  void ScavengePage(MemoryChunk* chunk) {
+    RememberedSet<OLD_TO_NEW>::Iterate(chunk, [this](Address slot_address) {
+      return CheckAndScavengeObject(slot_address);
+    });
+    ProcessCopiedObjects();
+  }
+
+  // Merges back locally cached state. Note that this method needs to be
+  // called from the main thread.
+  void Finalize() {
+    DCHECK(copied_list_.is_empty());
+    DCHECK(promoted_list_.is_empty());
+    // Closes the buffer and fills its unused part with a filler object.
+    buffer_ = LocalAllocationBuffer::InvalidBuffer();
+    heap_->old_space()->MergeCompactionSpace(
+        compaction_spaces_.Get(OLD_SPACE));
+    heap_->IncrementPromotedObjectsSize(promoted_size_);
+    heap_->IncrementSemiSpaceCopiedObjectSize(semispace_copied_size_);
+    heap_->MergeAllocationSitePretenuringFeedback(local_pretenuring_feedback_);
+    for (int i = 0; i < recorded_slots_.length(); i++) {
+      Address slot_address = recorded_slots_[i];
+      if (heap_->InNewSpace(*reinterpret_cast<Object**>(slot_address))) {
+        RememberedSet<OLD_TO_NEW>::Insert(Page::FromAddress(slot_address),
+                                          slot_address);
+      }
+    }
+  }
+
+ private:
+  static const int kLabSize = 4 * KB;
+  static const int kMaxLabObjectSize = 256;
+  static const int kInitialLocalPretenuringFeedbackCapacity = 256;
+
+  class ObjectBodyVisitor final : public ObjectVisitor {
+   public:
+    ObjectBodyVisitor(LocalScavenger* scavenger, bool record_slots)
+        : scavenger_(scavenger), record_slots_(record_slots) {}
+
+    void VisitPointers(Object** start, Object** end) override {
+      Heap* heap = scavenger_->heap_;
+      for (Object** p = start; p < end; p++) {
+        Object* object = *p;
+        if (!heap->InFromSpace(object)) continue;
+        scavenger_->ScavengeObject(reinterpret_cast<HeapObject**>(p),
+                                   reinterpret_cast<HeapObject*>(object));
+        if (record_slots_ && heap->InNewSpace(*p)) {
+          // Slot sets are not thread-safe. Promoted slots are inserted into
+          // the remembered set when finalizing the task.
+          scavenger_->recorded_slots_.Add(reinterpret_cast<Address>(p));
+        }
+      }
+    }
+
+    // Code objects never live in new space.
+    void VisitCodeEntry(Address code_entry_slot) override {}
+
+   private:
+    LocalScavenger* scavenger_;
+    bool record_slots_;
+  };
+
+  // Same as HeapObject::RequiredAlignment, but does not read the map word.
+  static AllocationAlignment RequiredAlignment(Map* map, HeapObject* object) {
+#ifdef V8_HOST_ARCH_32_BIT
+    InstanceType instance_type = map->instance_type();
+    if ((instance_type == FIXED_FLOAT64_ARRAY_TYPE ||
+         instance_type == FIXED_DOUBLE_ARRAY_TYPE) &&
+        reinterpret_cast<FixedArrayBase*>(object)->length() != 0) {
+      return kDoubleAligned;
+    }
+    if (instance_type == HEAP_NUMBER_TYPE) return kDoubleUnaligned;
+    if (instance_type == SIMD128_VALUE_TYPE) return kSimd128Unaligned;
+#endif  // V8_HOST_ARCH_32_BIT
+    return kWordAligned;
+  }
+
+  SlotCallbackResult CheckAndScavengeObject(Address slot_address) {
+    Object** slot = reinterpret_cast<Object**>(slot_address);
+    Object* object = *slot;
+    if (heap_->InFromSpace(object)) {
+      ScavengeObject(reinterpret_cast<HeapObject**>(slot),
+                     reinterpret_cast<HeapObject*>(object));
+      // See Scavenger::CheckAndScavengeObject.
+      if (heap_->InToSpace(*slot)) return KEEP_SLOT;
+    }
+    return REMOVE_SLOT;
+  }
+
+  void ScavengeObject(HeapObject** slot, HeapObject* object) {
+    DCHECK(heap_->InFromSpace(object));
+    MapWord first_word = object->synchronized_map_word();
+    if (first_word.IsForwardingAddress()) {
+      *slot = first_word.ToForwardingAddress();
+      return;
+    }
+    Map* map = first_word.ToMap();
+    // AllocationMementos are unrooted and shouldn't survive a scavenge
+    DCHECK(map != heap_->allocation_memento_map());
+    int size = object->SizeFromMap(map);
+    AllocationAlignment alignment = RequiredAlignment(map, object);
+
+    if (!heap_->ShouldBePromoted(object->address(), size)) {
+      // A semi-space copy may fail due to fragmentation. In that case, we
+      // try to promote the object.
+      if (SemiSpaceCopyObject(map, slot, object, size, alignment)) return;
+    }
+    if (PromoteObject(map, slot, object, size, alignment)) return;
+    // If promotion failed, we try to copy the object to the other semi-space
+    if (SemiSpaceCopyObject(map, slot, object, size, alignment)) return;
+
+    FatalProcessOutOfMemory("Scavenger: parallel semi-space copy\n");
+  }
+
+  // Copies {source} to {target} and tries to install the forwarding pointer.
+  // Returns false if another task has already forwarded {source}, in which
+  // case {target} is turned into a filler and {slot} is updated to point to
+  // the winning copy.
+  bool MigrateObject(Map* map, HeapObject** slot, HeapObject* source,
+                     HeapObject* target, int size) {
+    // The map word of {source} may change concurrently, so copy the map
+    // explicitly.
+    target->set_map_word(MapWord::FromMap(map));
+    heap_->CopyBlock(target->address() + kPointerSize,
+                     source->address() + kPointerSize, size - kPointerSize);
+    if (!source->release_compare_and_swap_map_word(
+            MapWord::FromMap(map), MapWord::FromForwardingAddress(target))) {
+      heap_->CreateFillerObjectAt(target->address(), size,
+                                  ClearRecordedSlots::kNo);
+      MapWord map_word = source->synchronized_map_word();
+      DCHECK(map_word.IsForwardingAddress());
+      *slot = map_word.ToForwardingAddress();
+      return false;
+    }
+    *slot = target;
+    heap_->UpdateAllocationSite<Heap::kCached>(map, source,
+                                               &local_pretenuring_feedback_);
+    return true;
+  }
+
+  bool SemiSpaceCopyObject(Map* map, HeapObject** slot, HeapObject* object,
+                           int size, AllocationAlignment alignment) {
+    DCHECK(heap_->AllowedToBeMigrated(object, NEW_SPACE));
+    AllocationResult allocation = size > kMaxLabObjectSize
+                                      ? AllocateInNewSpace(size, alignment)
+                                      : AllocateInLab(size, alignment);
+    HeapObject* target = nullptr;
+    if (!allocation.To(&target)) return false;
+    if (MigrateObject(map, slot, object, target, size)) {
+      copied_list_.Add(target);
+      semispace_copied_size_ += size;
+    }
+    return true;
+  }
+
+  bool PromoteObject(Map* map, HeapObject** slot, HeapObject* object,
+                     int size, AllocationAlignment alignment) {
+    AllocationResult allocation =
+        compaction_spaces_.Get(OLD_SPACE)->AllocateRaw(size, alignment);
+    HeapObject* target = nullptr;
+    if (!allocation.To(&target)) return false;
+    if (MigrateObject(map, slot, object, target, size)) {
+      promoted_list_.Add(target);
+      promoted_size_ += size;
+    }
+    return true;
+  }
+
+  AllocationResult AllocateInNewSpace(int size, AllocationAlignment alignment) {
+    AllocationResult allocation =
+        heap_->new_space()->AllocateRawSynchronized(size, alignment);
+    if (allocation.IsRetry() &&
+        heap_->new_space()->AddFreshPageSynchronized()) {
+      allocation = heap_->new_space()->AllocateRawSynchronized(size, alignment);
+    }
+    return allocation;
+  }
+
+  AllocationResult AllocateInLab(int size, AllocationAlignment alignment) {
+    AllocationResult allocation;
+    if (buffer_.IsValid()) {
+      allocation = buffer_.AllocateRawAligned(size, alignment);
+      if (!allocation.IsRetry()) return allocation;
+    }
+    LocalAllocationBuffer saved_old_buffer = buffer_;
+    buffer_ = LocalAllocationBuffer::FromResult(
+        heap_, AllocateInNewSpace(kLabSize, kWordAligned), kLabSize);
+    if (!buffer_.IsValid()) return AllocationResult::Retry(NEW_SPACE);
+    buffer_.TryMerge(&saved_old_buffer);
+    return buffer_.AllocateRawAligned(size, alignment);
+  }
+
+  void ProcessCopiedObjects() {
+    ObjectBodyVisitor copied_visitor(this, false);
+    ObjectBodyVisitor promoted_visitor(this, true);
+    while (!copied_list_.is_empty() || !promoted_list_.is_empty()) {
+      while (!copied_list_.is_empty()) {
+        HeapObject* target = copied_list_.RemoveLast();
+        Map* map = target->map();
+        target->IterateBody(map->instance_type(), target->SizeFromMap(map),
+                            &copied_visitor);
+      }
+      while (!promoted_list_.is_empty()) {
+        HeapObject* target = promoted_list_.RemoveLast();
+        Map* map = target->map();
+        target->IterateBody(map->instance_type(), target->SizeFromMap(map),
+                            &promoted_visitor);
+      }
+    }
+  }
+
+  Heap* heap_;
+  CompactionSpaceCollection compaction_spaces_;
+  LocalAllocationBuffer buffer_;
+  base::HashMap local_pretenuring_feedback_;
+  List<HeapObject*> copied_list_;
+  List<HeapObject*> promoted_list_;
+  List<Address> recorded_slots_;
+  intptr_t promoted_size_;
+  intptr_t semispace_copied_size_;
+};
+
+class ParallelScavengeJobTraits {
+ public:
+  typedef int PerPageData;  // Per page data is not used in this job.
+  typedef Scavenger::LocalScavenger* PerTaskData;
+
+  static const bool NeedSequentialFinalization = false;
+
+  static bool ProcessPageInParallel(Heap* heap, PerTaskData scavenger,
+                                    MemoryChunk* chunk, PerPageData) {
+    scavenger->ScavengePage(chunk);
+    return true;
+  }
+
+  static void FinalizePageSequentially(Heap*, MemoryChunk*, bool, PerPageData) {
+  }
+};
+
+bool Scavenger::CanScavengeInParallel() {
+  // Incremental marking and logging require the serial visitors. Compaction
+  // spaces may only take over swept pages while sweeping is not running.
+  return FLAG_parallel_scavenge &&
+         !heap()->incremental_marking()->IsMarking() &&
+         !heap()->mark_compact_collector()->sweeping_in_progress() &&
+         !IsLoggingOrProfiling();
+}
+
+int Scavenger::NumberOfParallelScavengeTasks(int pages) {
+  const int available_cores = Max(
+      1, static_cast<int>(
+             V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads()));
+  return Min(available_cores, pages);
+}
+
+void Scavenger::ScavengeOldToNewSlotsInParallel() {
+  DCHECK(CanScavengeInParallel());
+  DCHECK_EQ(heap()->new_space()->ToSpaceStart(), heap()->new_space()->top());
+  PageParallelJob<ParallelScavengeJobTraits> job(
+      heap(), isolate()->cancelable_task_manager(),
+      &page_parallel_job_semaphore_);
+  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+      heap(), [&job](MemoryChunk* chunk) { job.AddPage(chunk, 0); });
+  if (job.NumberOfPages() == 0) return;
+
+  const int num_tasks = NumberOfParallelScavengeTasks(job.NumberOfPages());
+  LocalScavenger** scavengers = new LocalScavenger*[num_tasks];
+  for (int i = 0; i < num_tasks; i++) {
+    scavengers[i] = new LocalScavenger(heap());
+  }
+  job.Run(num_tasks, [scavengers](int i) { return scavengers[i]; });
+  for (int i = 0; i < num_tasks; i++) {
+    scavengers[i]->Finalize();
+    delete scavengers[i];
+  }
+  delete[] scavengers;
+
+  if (FLAG_trace_parallel_scavenge) {
+    PrintIsolate(isolate(), "parallel scavenge: pages=%d tasks=%d\n",
+                 job.NumberOfPages(), job.NumberOfTasks());
+  }
+}
+
 // static
 void Scavenger::Initialize() {
   ScavengingVisitor<TRANSFER_MARKS,
@@ -382,12 +685,16 @@ void Scavenger::ScavengeObjectSlow(HeapObject** p, HeapObject* object) {
 }
 
 
+bool Scavenger::IsLoggingOrProfiling() {
+  return FLAG_verify_predictable || isolate()->logger()->is_logging() ||
+         isolate()->is_profiling() ||
+         (isolate()->heap_profiler() != NULL &&
+          isolate()->heap_profiler()->is_tracking_object_moves());
+}
+
+
 void Scavenger::SelectScavengingVisitorsTable() {
-  bool logging_and_profiling =
-      FLAG_verify_predictable || isolate()->logger()->is_logging() ||
-      isolate()->is_profiling() ||
-      (isolate()->heap_profiler() != NULL &&
-       isolate()->heap_profiler()->is_tracking_object_moves());
+  bool logging_and_profiling = IsLoggingOrProfiling();
 
   if (!heap()->incremental_marking()->IsMarking()) {
     if (!logging_and_profiling) {
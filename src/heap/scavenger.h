@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_SCAVENGER_H_
 #define V8_HEAP_SCAVENGER_H_
 
+#include "src/base/platform/semaphore.h"
 #include "src/heap/objects-visiting.h"
 #include "src/heap/slot-set.h"
 
@@ -16,7 +17,8 @@ typedef void (*ScavengingCallback)(Map* map, HeapObject** slot,
 
 class Scavenger {
  public:
-  explicit Scavenger(Heap* heap) : heap_(heap) {}
+  explicit Scavenger(Heap* heap)
+      : heap_(heap), page_parallel_job_semaphore_(0) {}
 
   // Initializes static visitor dispatch tables.
   static void Initialize();
@@ -36,12 +38,30 @@ class Scavenger {
   // of the heap (i.e. incremental marking, logging and profiling).
   void SelectScavengingVisitorsTable();
 
+  // Returns true if the objects reachable from the OLD_TO_NEW remembered set
+  // can be scavenged by parallel tasks in the current state of the heap.
+  bool CanScavengeInParallel();
+
+  // Scavenges the objects reachable from untyped OLD_TO_NEW slots, including
+  // their transitive closure, using parallel tasks. Has to be called before
+  // any other object is copied in this scavenge. Afterwards, all objects in
+  // to-space below the allocation top have already been processed.
+  void ScavengeOldToNewSlotsInParallel();
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
  private:
+  class LocalScavenger;
+
+  bool IsLoggingOrProfiling();
+  int NumberOfParallelScavengeTasks(int pages);
+
   Heap* heap_;
   VisitorDispatchTable<ScavengingCallback> scavenging_visitors_table_;
+  base::Semaphore page_parallel_job_semaphore_;
+
+  friend class ParallelScavengeJobTraits;
 };
 
 
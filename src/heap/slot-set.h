@@ -56,8 +56,12 @@ class SlotSet : public Malloced {
     SlotToIndices(slot_offset, &bucket_index, &cell_index, &bit_index);
     base::AtomicValue<uint32_t>* current_bucket = bucket[bucket_index].Value();
     if (current_bucket == nullptr) {
+      // Slots may be inserted concurrently by the store buffer task.
       current_bucket = AllocateBucket();
-      bucket[bucket_index].SetValue(current_bucket);
+      if (!bucket[bucket_index].TrySetValue(nullptr, current_bucket)) {
+        DeleteArray<base::AtomicValue<uint32_t>>(current_bucket);
+        current_bucket = bucket[bucket_index].Value();
+      }
     }
     if (!(current_bucket[cell_index].Value() & (1u << bit_index))) {
       current_bucket[cell_index].SetBit(bit_index);
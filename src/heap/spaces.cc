@@ -76,6 +76,26 @@ PauseAllocationObserversScope::~PauseAllocationObserversScope() {
   }
 }
 
+namespace {
+
+// Committing maps fresh memory over the region, so the hint has to be given
+// for every commit. Only 2 MB aligned extents of a mapping can be huge pages.
+// Large object chunks of that size qualify on their own. Smaller chunks only
+// do when the kernel merges them with adjacent commits that have the same
+// protection and hint; code pages never merge, as their guard pages split
+// the mapping.
+void MaybeAdviseHugePages(Address base, size_t size) {
+  if (!FLAG_huge_pages) return;
+  bool advised = base::OS::AdviseHugePages(base, size);
+  if (FLAG_trace_huge_pages) {
+    PrintF("[huge-pages] %s %p-%p (%" PRIuS " KB)\n",
+           advised ? "advised" : "failed to advise", static_cast<void*>(base),
+           static_cast<void*>(base + size), size / KB);
+  }
+}
+
+}  // namespace
+
 // -----------------------------------------------------------------------------
 // CodeRange
 
@@ -408,6 +428,7 @@ bool MemoryAllocator::CommitMemory(Address base, size_t size,
                                          executable == EXECUTABLE)) {
     return false;
   }
+  MaybeAdviseHugePages(base, size);
   UpdateAllocatedSpaceLimits(base, base + size);
   return true;
 }
@@ -468,6 +489,7 @@ Address MemoryAllocator::AllocateAlignedMemory(
     }
   } else {
     if (reservation.Commit(base, commit_size, false)) {
+      MaybeAdviseHugePages(base, commit_size);
       UpdateAllocatedSpaceLimits(base, base + commit_size);
     } else {
       base = NULL;
@@ -1044,6 +1066,7 @@ bool MemoryAllocator::CommitExecutableMemory(base::VirtualMemory* vm,
       Address body = start + CodePageAreaStartOffset();
       size_t body_size = commit_size - CodePageGuardStartOffset();
       if (vm->Commit(body, body_size, true)) {
+        MaybeAdviseHugePages(body, body_size);
         // Create guard page before the end.
         if (vm->Guard(start + reserved_size - CodePageGuardSize())) {
           UpdateAllocatedSpaceLimits(start, start + CodePageAreaStartOffset() +
@@ -1090,8 +1113,12 @@ static SlotSet* AllocateSlotSet(size_t size, Address page_start) {
 }
 
 void MemoryChunk::AllocateOldToNewSlots() {
-  DCHECK(nullptr == old_to_new_slots_.Value());
-  old_to_new_slots_.SetValue(AllocateSlotSet(size_, address()));
+  // The store buffer task may race with the main thread to allocate the slot
+  // set; the loser frees its copy.
+  SlotSet* slot_set = AllocateSlotSet(size_, address());
+  if (!old_to_new_slots_.TrySetValue(nullptr, slot_set)) {
+    delete[] slot_set;
+  }
 }
 
 void MemoryChunk::ReleaseOldToNewSlots() {
@@ -2817,6 +2844,7 @@ void PagedSpace::EvictEvacuationCandidatesFromLinearAllocationArea() {
 HeapObject* PagedSpace::SweepAndRetryAllocation(int size_in_bytes) {
   MarkCompactCollector* collector = heap()->mark_compact_collector();
   if (collector->sweeping_in_progress()) {
+    heap()->isolate()->counters()->paged_space_sweeper_waits()->Increment();
     // Wait for the sweeper threads here and complete the sweeping phase.
     collector->EnsureSweepingCompleted();
 
@@ -2841,6 +2869,9 @@ HeapObject* PagedSpace::SlowAllocateRaw(int size_in_bytes) {
   const int kMaxPagesToSweep = 1;
 
   // Allocation in this space has failed.
+  if (!is_local()) {
+    heap()->isolate()->counters()->paged_space_slow_allocations()->Increment();
+  }
 
   MarkCompactCollector* collector = heap()->mark_compact_collector();
   // Sweeping is still in progress.
@@ -3041,6 +3072,7 @@ Object* LargeObjectSpace::FindObject(Address a) {
 
 LargePage* LargeObjectSpace::FindPage(Address a) {
   uintptr_t key = reinterpret_cast<uintptr_t>(a) / MemoryChunk::kAlignment;
+  base::LockGuard<base::Mutex> guard(&chunk_map_mutex_);
   base::HashMap::Entry* e = chunk_map_.Lookup(reinterpret_cast<void*>(key),
                                               static_cast<uint32_t>(key));
   if (e != NULL) {
@@ -3074,6 +3106,7 @@ void LargeObjectSpace::InsertChunkMapEntries(LargePage* page) {
   uintptr_t start = reinterpret_cast<uintptr_t>(page) / MemoryChunk::kAlignment;
   uintptr_t limit = (reinterpret_cast<uintptr_t>(page) + (page->size() - 1)) /
                     MemoryChunk::kAlignment;
+  base::LockGuard<base::Mutex> guard(&chunk_map_mutex_);
   for (uintptr_t key = start; key <= limit; key++) {
     base::HashMap::Entry* entry = chunk_map_.InsertNew(
         reinterpret_cast<void*>(key), static_cast<uint32_t>(key));
@@ -3093,6 +3126,7 @@ void LargeObjectSpace::RemoveChunkMapEntries(LargePage* page,
                     MemoryChunk::kAlignment;
   uintptr_t limit = (reinterpret_cast<uintptr_t>(page) + (page->size() - 1)) /
                     MemoryChunk::kAlignment;
+  base::LockGuard<base::Mutex> guard(&chunk_map_mutex_);
   for (uintptr_t key = start; key <= limit; key++) {
     chunk_map_.Remove(reinterpret_cast<void*>(key), static_cast<uint32_t>(key));
   }
@@ -2896,6 +2896,9 @@ class LargeObjectSpace : public Space {
   intptr_t objects_size_;  // size of objects
   // Map MemoryChunk::kAlignment-aligned chunks to large pages covering them
   base::HashMap chunk_map_;
+  // Guards chunk_map_, which the concurrent store buffer task reads through
+  // FindPage() while the main thread allocates and frees large objects.
+  base::Mutex chunk_map_mutex_;
 
   friend class LargeObjectIterator;
 };
@@ -8,6 +8,7 @@
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/base/platform/platform.h"
+#include "src/cancelable-task.h"
 #include "src/globals.h"
 #include "src/heap/slot-set.h"
 
@@ -15,11 +16,16 @@ namespace v8 {
 namespace internal {
 
 // Intermediate buffer that accumulates old-to-new stores from the generated
-// code. On buffer overflow the slots are moved to the remembered set.
+// code. The store buffer consists of two halves: the generated code fills the
+// current one, and on overflow the halves are flipped and the full one is
+// moved to the remembered set by a background task. The main thread only
+// processes a half itself if the task has not finished with it yet when the
+// halves are flipped again, or before the remembered set is used.
 class StoreBuffer {
  public:
   static const int kStoreBufferSize = 1 << (14 + kPointerSizeLog2);
   static const int kStoreBufferMask = kStoreBufferSize - 1;
+  static const int kStoreBuffers = 2;
 
   static void StoreBufferOverflow(Isolate* isolate);
 
@@ -30,17 +36,67 @@ class StoreBuffer {
   // Used to add entries from generated code.
   inline Address* top_address() { return reinterpret_cast<Address*>(&top_); }
 
-  void MoveEntriesToRememberedSet();
+  // Moves the entries of both halves to the remembered set. This has to be
+  // called before the remembered set is iterated or slots are removed from it.
+  void MoveAllEntriesToRememberedSet();
+
+  // Drains both halves and aborts the task if it has not started yet. Has to
+  // be called before the spaces are torn down. A task that is already running
+  // finishes under mutex_ and then finds both halves empty. It does not touch
+  // the heap afterwards, and the isolate waits for it before it is deleted.
+  void StopConcurrentProcessing();
 
  private:
+  class Task : public CancelableTask {
+   public:
+    Task(Isolate* isolate, StoreBuffer* store_buffer)
+        : CancelableTask(isolate), store_buffer_(store_buffer) {}
+    virtual ~Task() {}
+
+   private:
+    void RunInternal() override {
+      store_buffer_->ConcurrentlyProcessStoreBuffer();
+    }
+    StoreBuffer* store_buffer_;
+    DISALLOW_COPY_AND_ASSIGN(Task);
+  };
+
+  // Switches the generated code to the other half and schedules the task to
+  // process the full one. Called on buffer overflow.
+  void FlipStoreBuffers();
+
+  // Moves the entries of the given half up to its lazy top to the remembered
+  // set. The caller has to hold mutex_.
+  void MoveEntriesToRememberedSet(int index);
+
+  void ConcurrentlyProcessStoreBuffer();
+
   Heap* heap_;
 
   Address* top_;
 
-  // The start and the limit of the buffer that contains store slots
-  // added from the generated code.
-  Address* start_;
-  Address* limit_;
+  // The start and the limit of the two halves of the buffer that contain
+  // store slots added from the generated code.
+  Address* start_[kStoreBuffers];
+  Address* limit_[kStoreBuffers];
+
+  // The top of a half that is waiting to be processed, or nullptr if the half
+  // is empty or currently filled by the generated code.
+  Address* lazy_top_[kStoreBuffers];
+
+  // Guards lazy_top_, current_ and task_running_, and is held while entries
+  // are moved to the remembered set.
+  base::Mutex mutex_;
+
+  // Whether a task to process the store buffer has been posted and has not
+  // finished yet.
+  bool task_running_;
+
+  // The id of the last task that was posted.
+  uint32_t task_id_;
+
+  // The half that is currently filled by the generated code.
+  int current_;
 
   base::VirtualMemory* virtual_memory_;
 };
@@ -20,15 +20,26 @@ enum LoadHandlerType {
 class LoadHandlerTypeBit : public BitField<bool, 0, 1> {};
 
 // Encoding for configuration Smis for property loads:
-class FieldOffsetIsInobject
+class LoadHandlerIsConstant
     : public BitField<bool, LoadHandlerTypeBit::kNext, 1> {};
+
+// Encoding for configuration Smis for field loads:
+class FieldOffsetIsInobject
+    : public BitField<bool, LoadHandlerIsConstant::kNext, 1> {};
 class FieldOffsetIsDouble
     : public BitField<bool, FieldOffsetIsInobject::kNext, 1> {};
-class FieldOffsetOffset : public BitField<int, FieldOffsetIsDouble::kNext, 27> {
+class FieldOffsetOffset : public BitField<int, FieldOffsetIsDouble::kNext, 26> {
 };
 // Make sure we don't overflow into the sign bit.
 STATIC_ASSERT(FieldOffsetOffset::kNext <= kSmiValueSize - 1);
 
+// Encoding for configuration Smis for constant loads, i.e. loads of
+// DATA_CONSTANT properties from the holder's descriptor array:
+class ConstantDescriptorIndex
+    : public BitField<int, LoadHandlerIsConstant::kNext, 20> {};
+// Make sure we don't overflow into the sign bit.
+STATIC_ASSERT(ConstantDescriptorIndex::kNext <= kSmiValueSize - 1);
+
 // Encoding for configuration Smis for elements loads:
 class KeyedLoadIsJsArray : public BitField<bool, LoadHandlerTypeBit::kNext, 1> {
 };
@@ -856,10 +856,19 @@ Handle<Object> LoadIC::SimpleFieldLoad(FieldIndex index) {
   return stub.GetCode();
 }
 
-Handle<Object> LoadIC::SimpleFieldLoadFromPrototype(FieldIndex index,
-                                                    Handle<Map> receiver_map,
-                                                    Handle<JSObject> holder) {
+Handle<Object> LoadIC::SimpleConstantLoad(int descriptor) {
+  DCHECK(FLAG_tf_load_ic_stub);
+  int config = LoadHandlerTypeBit::encode(kLoadICHandlerForProperties) |
+               LoadHandlerIsConstant::encode(true) |
+               ConstantDescriptorIndex::encode(descriptor);
+  return handle(Smi::FromInt(config), isolate());
+}
+
+Handle<Object> LoadIC::SimpleLoadFromPrototype(Handle<Object> smi_handler,
+                                               Handle<Map> receiver_map,
+                                               Handle<JSObject> holder) {
   if (!FLAG_tf_load_ic_stub) return Handle<Object>::null();
+  DCHECK(smi_handler->IsSmi());
 
   DCHECK(holder->HasFastProperties());
 
@@ -883,18 +892,14 @@ Handle<Object> LoadIC::SimpleFieldLoadFromPrototype(FieldIndex index,
     // Only objects that do not require access checks are allowed in stubs.
     DCHECK(!current_map->is_access_check_needed());
   }
-  TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldFromPrototypeDH);
   Handle<Cell> validity_cell =
       Map::GetOrCreatePrototypeChainValidityCell(receiver_map, isolate());
   DCHECK(!validity_cell.is_null());
 
-  Handle<Object> handler(Smi::FromInt(index.GetLoadByFieldOffset()), isolate());
-  DCHECK(handler->IsSmi());
-
   Factory* factory = isolate()->factory();
 
   Handle<WeakCell> holder_cell = factory->NewWeakCell(holder);
-  return factory->NewTuple3(validity_cell, holder_cell, handler);
+  return factory->NewTuple3(validity_cell, holder_cell, smi_handler);
 }
 
 bool IsCompatibleReceiver(LookupIterator* lookup, Handle<Map> receiver_map) {
@@ -1200,9 +1205,12 @@ Handle<Object> LoadIC::GetMapIndependentHandler(LookupIterator* lookup) {
         if (receiver_is_holder) {
           return SimpleFieldLoad(field);
         }
+        Handle<Object> smi_handler(
+            Smi::FromInt(field.GetLoadByFieldOffset()), isolate());
         Handle<Object> handler =
-            SimpleFieldLoadFromPrototype(field, map, holder);
+            SimpleLoadFromPrototype(smi_handler, map, holder);
         if (!handler.is_null()) {
+          TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldFromPrototypeDH);
           return handler;
         }
         break;  // Custom-compiled handler.
@@ -1210,7 +1218,20 @@ Handle<Object> LoadIC::GetMapIndependentHandler(LookupIterator* lookup) {
 
       // -------------- Constant properties --------------
       DCHECK(lookup->property_details().type() == DATA_CONSTANT);
-      if (receiver_is_holder) {
+      if (FLAG_tf_load_ic_stub) {
+        Handle<Object> smi_handler =
+            SimpleConstantLoad(lookup->GetConstantIndex());
+        if (receiver_is_holder) {
+          TRACE_HANDLER_STATS(isolate(), LoadIC_LoadConstantDH);
+          return smi_handler;
+        }
+        Handle<Object> handler =
+            SimpleLoadFromPrototype(smi_handler, map, holder);
+        if (!handler.is_null()) {
+          TRACE_HANDLER_STATS(isolate(), LoadIC_LoadConstantFromPrototypeDH);
+          return handler;
+        }
+      } else if (receiver_is_holder) {
         TRACE_HANDLER_STATS(isolate(), LoadIC_LoadConstantStub);
         LoadConstantStub stub(isolate(), lookup->GetConstantIndex());
         return stub.GetCode();
@@ -310,9 +310,14 @@ class LoadIC : public IC {
 
  private:
   Handle<Object> SimpleFieldLoad(FieldIndex index);
-  Handle<Object> SimpleFieldLoadFromPrototype(FieldIndex index,
-                                              Handle<Map> receiver_map,
-                                              Handle<JSObject> holder);
+  Handle<Object> SimpleConstantLoad(int descriptor);
+
+  // Wraps the Smi {smi_handler} so that it is applied to {holder} on the
+  // prototype chain of {receiver_map}. Returns a null handle if the chain
+  // requires a custom compiled handler.
+  Handle<Object> SimpleLoadFromPrototype(Handle<Object> smi_handler,
+                                         Handle<Map> receiver_map,
+                                         Handle<JSObject> holder);
 
   friend class IC;
 };
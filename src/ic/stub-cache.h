@@ -92,9 +92,12 @@ class StubCache {
   // automatically discards the hash bit field.
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
+  // The table sizes are baked into the generated probing code, so they cannot
+  // change at runtime. Entries evicted from the primary table move to the
+  // secondary one, which is what gives the cache its associativity.
+  static const int kPrimaryTableBits = 12;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  static const int kSecondaryTableBits = 10;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   // Some magic number used in primary and secondary hash computations.
@@ -926,11 +926,42 @@ void V8Debugger::asyncTaskScheduled(const String16& taskName, void* task,
       this, contextGroupId, V8StackTraceImpl::maxCallStackSizeToCapture,
       taskName);
   if (chain) {
-    m_asyncTaskStacks[task] = std::move(chain);
+    std::shared_ptr<V8StackTraceImpl> stack(std::move(chain));
+    m_asyncTaskStacks[task] = stack;
     if (recurring) m_recurringTasks.insert(task);
+    m_asyncTaskOrder.push_back(std::make_pair(task, stack));
+    collectOldAsyncStacksIfNeeded();
   }
 }
 
+bool V8Debugger::isCurrentAsyncTaskStack(const AsyncTaskOrderEntry& entry) {
+  // Task ids are reused, e.g. by recurring tasks or for reused addresses, so
+  // an entry only stands for the task's stack that was scheduled with it.
+  AsyncTaskToStackTrace::iterator it = m_asyncTaskStacks.find(entry.first);
+  if (it == m_asyncTaskStacks.end()) return false;
+  return !entry.second.owner_before(it->second) &&
+         !it->second.owner_before(entry.second);
+}
+
+void V8Debugger::collectOldAsyncStacksIfNeeded() {
+  // Drop the stacks of the tasks scheduled longest ago.
+  while (m_asyncTaskStacks.size() > kMaxAsyncTaskStacks) {
+    AsyncTaskOrderEntry entry = m_asyncTaskOrder.front();
+    m_asyncTaskOrder.pop_front();
+    if (!isCurrentAsyncTaskStack(entry)) continue;
+    m_asyncTaskStacks.erase(entry.first);
+    m_recurringTasks.erase(entry.first);
+  }
+  // Forget the entries of tasks which finished, were canceled or were
+  // scheduled again in the meantime.
+  if (m_asyncTaskOrder.size() <= 2 * kMaxAsyncTaskStacks) return;
+  std::deque<AsyncTaskOrderEntry> order;
+  for (const AsyncTaskOrderEntry& entry : m_asyncTaskOrder) {
+    if (isCurrentAsyncTaskStack(entry)) order.push_back(entry);
+  }
+  m_asyncTaskOrder.swap(order);
+}
+
 void V8Debugger::asyncTaskCanceled(void* task) {
   if (!m_maxAsyncCallStackDepth) return;
   m_asyncTaskStacks.erase(task);
@@ -948,9 +979,10 @@ void V8Debugger::asyncTaskStarted(void* task) {
   // - asyncTaskCanceled <-- canceled before finished
   //   <-- async stack requested here -->
   // - asyncTaskFinished
-  std::unique_ptr<V8StackTraceImpl> stack;
-  if (stackIt != m_asyncTaskStacks.end() && stackIt->second)
-    stack = stackIt->second->cloneImpl();
+  // The stack is shared rather than copied; it is never modified once
+  // captured.
+  std::shared_ptr<V8StackTraceImpl> stack;
+  if (stackIt != m_asyncTaskStacks.end()) stack = stackIt->second;
   m_currentStacks.push_back(std::move(stack));
 }
 
@@ -969,6 +1001,7 @@ void V8Debugger::asyncTaskFinished(void* task) {
 
 void V8Debugger::allAsyncTasksCanceled() {
   m_asyncTaskStacks.clear();
+  m_asyncTaskOrder.clear();
   m_recurringTasks.clear();
   m_currentStacks.clear();
   m_currentTasks.clear();
@@ -5,6 +5,9 @@
 #ifndef V8_INSPECTOR_V8DEBUGGER_H_
 #define V8_INSPECTOR_V8DEBUGGER_H_
 
+#include <deque>
+#include <memory>
+#include <utility>
 #include <vector>
 
 #include "src/base/macros.h"
@@ -101,7 +104,18 @@ class V8Debugger {
   V8InspectorImpl* inspector() { return m_inspector; }
 
  private:
+  // Upper bound on the number of scheduled tasks whose async stacks are
+  // retained. Tasks which are never started or canceled (e.g. promises that
+  // never settle) would otherwise keep their stacks forever.
+  static const size_t kMaxAsyncTaskStacks = 128 * 1024;
+
+  // A scheduled task and the stack it was scheduled with.
+  using AsyncTaskOrderEntry =
+      std::pair<void*, std::weak_ptr<V8StackTraceImpl>>;
+
   void compileDebuggerScript();
+  bool isCurrentAsyncTaskStack(const AsyncTaskOrderEntry&);
+  void collectOldAsyncStacksIfNeeded();
   v8::MaybeLocal<v8::Value> callDebuggerMethod(const char* functionName,
                                                int argc,
                                                v8::Local<v8::Value> argv[]);
@@ -144,12 +158,15 @@ class V8Debugger {
   int m_ignoreScriptParsedEventsCounter;
 
   using AsyncTaskToStackTrace =
-      protocol::HashMap<void*, std::unique_ptr<V8StackTraceImpl>>;
+      protocol::HashMap<void*, std::shared_ptr<V8StackTraceImpl>>;
   AsyncTaskToStackTrace m_asyncTaskStacks;
+  // Tasks in the order they were scheduled. May contain entries whose stacks
+  // are gone or were replaced already.
+  std::deque<AsyncTaskOrderEntry> m_asyncTaskOrder;
   protocol::HashSet<void*> m_recurringTasks;
   int m_maxAsyncCallStackDepth;
   std::vector<void*> m_currentTasks;
-  std::vector<std::unique_ptr<V8StackTraceImpl>> m_currentStacks;
+  std::vector<std::shared_ptr<V8StackTraceImpl>> m_currentStacks;
   protocol::HashMap<V8DebuggerAgentImpl*, int> m_maxAsyncCallStackDepthMap;
 
   DISALLOW_COPY_AND_ASSIGN(V8Debugger);
@@ -28,6 +28,14 @@ static const char samplingHeapProfilerInterval[] =
     "samplingHeapProfilerInterval";
 }
 
+// Interval of the heap stats timer.
+const double kTimerIntervalSeconds = 0.05;
+
+// Each heap stats update collects garbage and walks the whole heap. When that
+// takes longer than a few milliseconds, timer ticks are skipped so that no
+// more than about a tenth of the time is spent on updates.
+const double kUpdateTimeFraction = 0.1;
+
 class HeapSnapshotProgress final : public v8::ActivityControl {
  public:
   explicit HeapSnapshotProgress(protocol::HeapProfiler::Frontend* frontend)
@@ -150,7 +158,8 @@ V8HeapProfilerAgentImpl::V8HeapProfilerAgentImpl(
       m_isolate(session->inspector()->isolate()),
       m_frontend(frontendChannel),
       m_state(state),
-      m_hasTimer(false) {}
+      m_hasTimer(false),
+      m_timerTicksToSkip(0) {}
 
 V8HeapProfilerAgentImpl::~V8HeapProfilerAgentImpl() {}
 
@@ -307,7 +316,19 @@ void V8HeapProfilerAgentImpl::requestHeapStatsUpdate() {
 
 // static
 void V8HeapProfilerAgentImpl::onTimer(void* data) {
-  reinterpret_cast<V8HeapProfilerAgentImpl*>(data)->requestHeapStatsUpdate();
+  V8HeapProfilerAgentImpl* agent =
+      reinterpret_cast<V8HeapProfilerAgentImpl*>(data);
+  if (agent->m_timerTicksToSkip > 0) {
+    agent->m_timerTicksToSkip--;
+    return;
+  }
+  V8InspectorClient* client = agent->m_session->inspector()->client();
+  double startMS = client->currentTimeMS();
+  agent->requestHeapStatsUpdate();
+  double durationMS = client->currentTimeMS() - startMS;
+  double busyTicks = durationMS / (kTimerIntervalSeconds * 1000);
+  agent->m_timerTicksToSkip =
+      static_cast<int>(busyTicks * (1 / kUpdateTimeFraction - 1));
 }
 
 void V8HeapProfilerAgentImpl::startTrackingHeapObjectsInternal(
@@ -315,8 +336,10 @@ void V8HeapProfilerAgentImpl::startTrackingHeapObjectsInternal(
   m_isolate->GetHeapProfiler()->StartTrackingHeapObjects(trackAllocations);
   if (!m_hasTimer) {
     m_hasTimer = true;
+    m_timerTicksToSkip = 0;
     m_session->inspector()->client()->startRepeatingTimer(
-        0.05, &V8HeapProfilerAgentImpl::onTimer, reinterpret_cast<void*>(this));
+        kTimerIntervalSeconds, &V8HeapProfilerAgentImpl::onTimer,
+        reinterpret_cast<void*>(this));
   }
 }
 
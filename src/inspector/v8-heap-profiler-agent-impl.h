@@ -64,6 +64,7 @@ class V8HeapProfilerAgentImpl : public protocol::HeapProfiler::Backend {
   protocol::HeapProfiler::Frontend m_frontend;
   protocol::DictionaryValue* m_state;
   bool m_hasTimer;
+  int m_timerTicksToSkip;
 
   DISALLOW_COPY_AND_ASSIGN(V8HeapProfilerAgentImpl);
 };
@@ -50,6 +50,7 @@ class PlatformInterfaceDescriptor;
   V(RegExpExec)                           \
   V(RegExpConstructResult)                \
   V(CopyFastSmiOrObjectElements)          \
+  V(NewArgumentsElements)                 \
   V(TransitionElementsKind)               \
   V(AllocateHeapNumber)                   \
   V(AllocateFloat32x4)                    \
@@ -583,6 +584,13 @@ class CopyFastSmiOrObjectElementsDescriptor : public CallInterfaceDescriptor {
                              CallInterfaceDescriptor, kParameterCount)
 };
 
+class NewArgumentsElementsDescriptor : public CallInterfaceDescriptor {
+ public:
+  DEFINE_PARAMETERS(kFrame, kLength)
+  DECLARE_DEFAULT_DESCRIPTOR(NewArgumentsElementsDescriptor,
+                             CallInterfaceDescriptor, kParameterCount)
+};
+
 class TransitionElementsKindDescriptor : public CallInterfaceDescriptor {
  public:
   DEFINE_PARAMETERS(kObject, kMap)
@@ -44,6 +44,10 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
       bytecode_size, &bytecodes()->front(), frame_size, parameter_count,
       constant_pool);
   bytecode_array->set_handler_table(*handler_table);
+  if (source_position_table_builder()->Lazy()) {
+    bytecode_array->ClearSourcePositionTable();
+    return bytecode_array;
+  }
   Handle<ByteArray> source_position_table =
       source_position_table_builder()->ToSourcePositionTable(
           isolate, Handle<AbstractCode>::cast(bytecode_array));
@@ -163,6 +167,18 @@ Bytecode GetJumpWithConstantOperand(Bytecode jump_bytecode) {
       return Bytecode::kJumpIfNullConstant;
     case Bytecode::kJumpIfUndefined:
       return Bytecode::kJumpIfUndefinedConstant;
+    case Bytecode::kTestEqualJumpIfTrue:
+      return Bytecode::kTestEqualJumpIfTrueConstant;
+    case Bytecode::kTestEqualJumpIfFalse:
+      return Bytecode::kTestEqualJumpIfFalseConstant;
+    case Bytecode::kTestEqualStrictJumpIfTrue:
+      return Bytecode::kTestEqualStrictJumpIfTrueConstant;
+    case Bytecode::kTestEqualStrictJumpIfFalse:
+      return Bytecode::kTestEqualStrictJumpIfFalseConstant;
+    case Bytecode::kTestLessThanJumpIfTrue:
+      return Bytecode::kTestLessThanJumpIfTrueConstant;
+    case Bytecode::kTestLessThanJumpIfFalse:
+      return Bytecode::kTestLessThanJumpIfFalseConstant;
     default:
       UNREACHABLE();
       return Bytecode::kIllegal;
@@ -298,6 +314,8 @@ void BytecodeArrayWriter::EmitJump(BytecodeNode* node, BytecodeLabel* label) {
     // when the label is bound. The reservation means the maximum size
     // of the operand for the constant is known and the jump can
     // be emitted into the bytecode stream with space for the operand.
+    // Only the jump offset, which is always operand 0, is updated as fused
+    // test and jump bytecodes have further operands.
     unbound_jumps_++;
     label->set_referrer(current_offset);
     OperandSize reserved_operand_size =
@@ -308,13 +326,13 @@ void BytecodeArrayWriter::EmitJump(BytecodeNode* node, BytecodeLabel* label) {
         UNREACHABLE();
         break;
       case OperandSize::kByte:
-        node->set_bytecode(node->bytecode(), k8BitJumpPlaceholder);
+        node->UpdateOperand(0, k8BitJumpPlaceholder);
         break;
       case OperandSize::kShort:
-        node->set_bytecode(node->bytecode(), k16BitJumpPlaceholder);
+        node->UpdateOperand(0, k16BitJumpPlaceholder);
         break;
       case OperandSize::kQuad:
-        node->set_bytecode(node->bytecode(), k32BitJumpPlaceholder);
+        node->UpdateOperand(0, k32BitJumpPlaceholder);
         break;
     }
   }
@@ -557,7 +557,7 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
           info->isolate(), info->zone(), info->num_parameters_including_this(),
           info->scope()->MaxNestedContextChainLength(),
           info->scope()->num_stack_slots(), info->literal(),
-          info->SourcePositionRecordingMode())),
+          info->BytecodeSourcePositionRecordingMode())),
       info_(info),
       scope_(info->scope()),
       globals_builder_(new (zone()) GlobalDeclarationsBuilder(info->zone())),
@@ -571,7 +571,8 @@ BytecodeGenerator::BytecodeGenerator(CompilationInfo* info)
       generator_state_(),
       loop_depth_(0),
       home_object_symbol_(info->isolate()->factory()->home_object_symbol()),
-      prototype_string_(info->isolate()->factory()->prototype_string()) {
+      prototype_string_(info->isolate()->factory()->prototype_string()),
+      length_string_(info->isolate()->factory()->length_string()) {
 }
 
 Handle<BytecodeArray> BytecodeGenerator::FinalizeBytecode(Isolate* isolate) {
@@ -1252,16 +1253,99 @@ void BytecodeGenerator::VisitForInStatement(ForInStatement* stmt) {
 void BytecodeGenerator::VisitForOfStatement(ForOfStatement* stmt) {
   LoopBuilder loop_builder(builder());
 
+  // The parser splits the loop setup into (.iterable = subject, iterator =
+  // GetIterator(.iterable)) and the value assignment into (.value =
+  // result.value, each = .value). While the array iterator lookup chain is
+  // intact, arrays with the initial Array.prototype are iterated by index
+  // without allocating the iterator and its result objects. The index lives
+  // in a variable, so that the loop finalization can still close the iterator
+  // if the lookup chain is modified by the body (see FinalizeForOfStatement).
+  BinaryOperation* assign_iterator =
+      stmt->assign_iterator()->AsBinaryOperation();
+  BinaryOperation* assign_each = stmt->assign_each()->AsBinaryOperation();
+  DCHECK_EQ(Token::COMMA, assign_iterator->op());
+  DCHECK_EQ(Token::COMMA, assign_each->op());
+  Variable* value = assign_each->left()
+                        ->AsAssignment()
+                        ->target()
+                        ->AsVariableProxy()
+                        ->var();
+
+  // Used as the arguments of %CreateArrayValuesIterator. The {index} holds a
+  // copy of the index variable, which is undefined when iterating with the
+  // {iterator}.
+  RegisterList iterable_and_index = register_allocator()->NewRegisterList(2);
+  Register iterable = iterable_and_index[0];
+  Register index = iterable_and_index[1];
+
+  BytecodeLabel slow_iterator, iterator_done;
   builder()->SetExpressionAsStatementPosition(stmt->assign_iterator());
-  VisitForEffect(stmt->assign_iterator());
+  VisitForRegisterValue(assign_iterator->left(), iterable);
+  builder()
+      ->CallRuntime(Runtime::kInlineIsFastArrayIterable, iterable)
+      .JumpIfFalse(&slow_iterator);
+  // Keep the {iterator} undefined until it becomes observable.
+  builder()->LoadUndefined();
+  VisitVariableAssignment(stmt->iterator(), Token::ASSIGN,
+                          FeedbackVectorSlot::Invalid());
+  builder()->LoadLiteral(Smi::kZero);
+  VisitVariableAssignment(stmt->index(), Token::ASSIGN,
+                          FeedbackVectorSlot::Invalid());
+  builder()->Jump(&iterator_done);
+  builder()->Bind(&slow_iterator);
+  builder()->LoadUndefined();
+  VisitVariableAssignment(stmt->index(), Token::ASSIGN,
+                          FeedbackVectorSlot::Invalid());
+  VisitForEffect(assign_iterator->right());
+  builder()->Bind(&iterator_done);
 
   VisitIterationHeader(stmt, &loop_builder);
+  BytecodeLabel fast_next, value_done;
+  BytecodeLabels slow_next(zone());
   builder()->SetExpressionAsStatementPosition(stmt->next_result());
+  VisitVariableLoadForAccumulatorValue(stmt->index(),
+                                       FeedbackVectorSlot::Invalid());
+  builder()->StoreAccumulatorInRegister(index).JumpIfUndefined(
+      slow_next.New());
+  builder()
+      ->CallRuntime(Runtime::kInlineArrayIteratorProtector)
+      .JumpIfTrue(&fast_next);
+  // The lookup chain was modified by the loop, so continue with the iterator
+  // that the loop would have been using all along.
+  builder()->CallRuntime(Runtime::kCreateArrayValuesIterator,
+                         iterable_and_index);
+  VisitVariableAssignment(stmt->iterator(), Token::ASSIGN,
+                          FeedbackVectorSlot::Invalid());
+  builder()->LoadUndefined();
+  VisitVariableAssignment(stmt->index(), Token::ASSIGN,
+                          FeedbackVectorSlot::Invalid());
+  builder()->Jump(slow_next.New());
+
+  builder()->Bind(&fast_next);
+  builder()
+      ->LoadNamedProperty(iterable, length_string(),
+                          feedback_index(stmt->LengthFeedbackSlot()))
+      .CompareOperation(Token::LT, index);
+  loop_builder.BreakIfFalse();
+  builder()
+      ->LoadAccumulatorWithRegister(index)
+      .LoadKeyedProperty(iterable, feedback_index(stmt->ElementFeedbackSlot()));
+  VisitVariableAssignment(value, Token::ASSIGN, FeedbackVectorSlot::Invalid());
+  builder()
+      ->LoadAccumulatorWithRegister(index)
+      .CountOperation(Token::ADD, feedback_index(stmt->IndexFeedbackSlot()));
+  VisitVariableAssignment(stmt->index(), Token::ASSIGN,
+                          FeedbackVectorSlot::Invalid());
+  builder()->Jump(&value_done);
+
+  slow_next.Bind(builder());
   VisitForEffect(stmt->next_result());
   VisitForAccumulatorValue(stmt->result_done());
   loop_builder.BreakIfTrue();
+  VisitForEffect(assign_each->left());
+  builder()->Bind(&value_done);
 
-  VisitForEffect(stmt->assign_each());
+  VisitForEffect(assign_each->right());
   VisitIterationBody(stmt, &loop_builder);
   loop_builder.JumpToHeader(loop_depth_);
   loop_builder.EndLoop();
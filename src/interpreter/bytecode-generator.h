@@ -195,6 +195,7 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
 
   Handle<Name> home_object_symbol() const { return home_object_symbol_; }
   Handle<Name> prototype_string() const { return prototype_string_; }
+  Handle<Name> length_string() const { return length_string_; }
 
   Zone* zone_;
   BytecodeArrayBuilder* builder_;
@@ -217,6 +218,7 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
 
   Handle<Name> home_object_symbol_;
   Handle<Name> prototype_string_;
+  Handle<Name> length_string_;
 };
 
 }  // namespace interpreter
@@ -4,6 +4,7 @@
 
 #include "src/interpreter/bytecode-peephole-optimizer.h"
 
+#include "src/flags.h"
 #include "src/objects-inl.h"
 #include "src/objects.h"
 
@@ -319,6 +320,37 @@ void BytecodePeepholeOptimizer::ElideLastBeforeJumpAction(
   InvalidateLast();
 }
 
+void BytecodePeepholeOptimizer::TransformTestAndJumpAction(
+    BytecodeNode* const node, const PeepholeActionAndData* action_data) {
+  DCHECK(LastIsValid());
+  DCHECK(Bytecodes::IsJump(node->bytecode()));
+
+  // The fused bytecode takes the jump offset as its first operand, which must
+  // be patched in place, so only tests with single byte operands are fused.
+  if (FLAG_ignition_superinstructions &&
+      last()->operand_scale() == OperandScale::kSingle &&
+      CanElideLastBasedOnSourcePosition(node)) {
+    //
+    //   TestEqual r0, [1]  ____\  TestEqualJumpIfTrue [0], r0, [1]
+    //   JumpIfTrue [0]     ====/
+    //
+    node->set_bytecode(action_data->bytecode, node->operand(0),
+                       last()->operand(0), last()->operand(1));
+    if (last()->source_info().is_valid()) {
+      node->source_info_ptr()->Clone(last()->source_info());
+    }
+    InvalidateLast();
+    return;
+  }
+
+  next_stage()->Write(last());
+  InvalidateLast();
+  if (Bytecodes::IsJumpIfToBoolean(node->bytecode())) {
+    node->set_bytecode(Bytecodes::GetJumpWithoutToBoolean(node->bytecode()),
+                       node->operand(0));
+  }
+}
+
 void BytecodePeepholeOptimizer::ApplyPeepholeAction(BytecodeNode* const node) {
   // A single table is used for looking up peephole optimization
   // matches as it is observed to have better performance. This is
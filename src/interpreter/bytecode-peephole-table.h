@@ -27,7 +27,8 @@ namespace interpreter {
   V(DefaultJumpAction)               \
   V(UpdateLastJumpAction)            \
   V(ChangeJumpBytecodeAction)        \
-  V(ElideLastBeforeJumpAction)
+  V(ElideLastBeforeJumpAction)       \
+  V(TransformTestAndJumpAction)
 
 #define PEEPHOLE_ACTION_LIST(V)    \
   PEEPHOLE_NON_JUMP_ACTION_LIST(V) \
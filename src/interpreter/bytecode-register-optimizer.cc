@@ -4,6 +4,8 @@
 
 #include "src/interpreter/bytecode-register-optimizer.h"
 
+#include "src/flags.h"
+
 namespace v8 {
 namespace internal {
 namespace interpreter {
@@ -286,7 +288,15 @@ void BytecodeRegisterOptimizer::Write(BytecodeNode* node) {
 // override
 void BytecodeRegisterOptimizer::WriteJump(BytecodeNode* node,
                                           BytecodeLabel* label) {
-  FlushState();
+  if (FLAG_ignition_reo_across_jumps &&
+      Bytecodes::IsConditionalJump(node->bytecode())) {
+    // A conditional jump does not modify any registers, so the
+    // equivalences remain valid on the fall-through path. Only the
+    // jump target needs every live register to be materialized.
+    MaterializeState();
+  } else {
+    FlushState();
+  }
   next_stage_->WriteJump(node, label);
 }
 
@@ -330,6 +340,26 @@ void BytecodeRegisterOptimizer::FlushState() {
   flush_required_ = false;
 }
 
+void BytecodeRegisterOptimizer::MaterializeState() {
+  if (!flush_required_) {
+    return;
+  }
+
+  // Materialize all live registers, but keep the equivalences.
+  size_t count = register_info_table_.size();
+  for (size_t i = 0; i < count; ++i) {
+    RegisterInfo* reg_info = register_info_table_[i];
+    if (reg_info->materialized()) {
+      for (RegisterInfo* equivalent = reg_info->GetEquivalent();
+           equivalent != reg_info; equivalent = equivalent->GetEquivalent()) {
+        if (equivalent->allocated() && !equivalent->materialized()) {
+          OutputRegisterTransfer(reg_info, equivalent);
+        }
+      }
+    }
+  }
+}
+
 void BytecodeRegisterOptimizer::OutputRegisterTransfer(
     RegisterInfo* input_info, RegisterInfo* output_info,
     BytecodeSourceInfo* source_info) {
@@ -47,6 +47,7 @@ class BytecodeRegisterOptimizer final
 
   // Helpers for BytecodePipelineStage interface.
   void FlushState();
+  void MaterializeState();
 
   // Update internal state for register transfer from |input| to
   // |output| using |source_info| as source position information if
@@ -136,6 +136,38 @@ Bytecode Bytecodes::GetJumpWithoutToBoolean(Bytecode bytecode) {
   return Bytecode::kIllegal;
 }
 
+// static
+Bytecode Bytecodes::GetTestAndJump(Bytecode test, Bytecode jump) {
+  // The tests write a boolean to the accumulator, so jumps coercing the
+  // accumulator to a boolean are equivalent to the plain conditional jumps.
+  bool jump_if_true;
+  switch (jump) {
+    case Bytecode::kJumpIfTrue:
+    case Bytecode::kJumpIfToBooleanTrue:
+      jump_if_true = true;
+      break;
+    case Bytecode::kJumpIfFalse:
+    case Bytecode::kJumpIfToBooleanFalse:
+      jump_if_true = false;
+      break;
+    default:
+      return Bytecode::kIllegal;
+  }
+  switch (test) {
+    case Bytecode::kTestEqual:
+      return jump_if_true ? Bytecode::kTestEqualJumpIfTrue
+                          : Bytecode::kTestEqualJumpIfFalse;
+    case Bytecode::kTestEqualStrict:
+      return jump_if_true ? Bytecode::kTestEqualStrictJumpIfTrue
+                          : Bytecode::kTestEqualStrictJumpIfFalse;
+    case Bytecode::kTestLessThan:
+      return jump_if_true ? Bytecode::kTestLessThanJumpIfTrue
+                          : Bytecode::kTestLessThanJumpIfFalse;
+    default:
+      return Bytecode::kIllegal;
+  }
+}
+
 // static
 bool Bytecodes::IsDebugBreak(Bytecode bytecode) {
   switch (bytecode) {
@@ -229,6 +229,32 @@ namespace interpreter {
   V(JumpIfNotHoleConstant, AccumulatorUse::kRead, OperandType::kIdx)           \
   V(JumpLoop, AccumulatorUse::kNone, OperandType::kImm, OperandType::kImm)     \
                                                                                \
+  /* Fused test and jump, only emitted by the peephole optimizer */            \
+  V(TestEqualJumpIfTrue, AccumulatorUse::kReadWrite,                           \
+    OperandType::kImm, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualJumpIfTrueConstant, AccumulatorUse::kReadWrite,                   \
+    OperandType::kIdx, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualJumpIfFalse, AccumulatorUse::kReadWrite,                          \
+    OperandType::kImm, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualJumpIfFalseConstant, AccumulatorUse::kReadWrite,                  \
+    OperandType::kIdx, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualStrictJumpIfTrue, AccumulatorUse::kReadWrite,                     \
+    OperandType::kImm, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualStrictJumpIfTrueConstant, AccumulatorUse::kReadWrite,             \
+    OperandType::kIdx, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualStrictJumpIfFalse, AccumulatorUse::kReadWrite,                    \
+    OperandType::kImm, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestEqualStrictJumpIfFalseConstant, AccumulatorUse::kReadWrite,            \
+    OperandType::kIdx, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestLessThanJumpIfTrue, AccumulatorUse::kReadWrite,                        \
+    OperandType::kImm, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestLessThanJumpIfTrueConstant, AccumulatorUse::kReadWrite,                \
+    OperandType::kIdx, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestLessThanJumpIfFalse, AccumulatorUse::kReadWrite,                       \
+    OperandType::kImm, OperandType::kReg, OperandType::kIdx)                   \
+  V(TestLessThanJumpIfFalseConstant, AccumulatorUse::kReadWrite,               \
+    OperandType::kIdx, OperandType::kReg, OperandType::kIdx)                   \
+                                                                               \
   /* Complex flow control For..in */                                           \
   V(ForInPrepare, AccumulatorUse::kNone, OperandType::kReg,                    \
     OperandType::kRegOutTriple)                                                \
@@ -294,6 +320,21 @@ namespace interpreter {
   DEBUG_BREAK_PLAIN_BYTECODE_LIST(V) \
   DEBUG_BREAK_PREFIX_BYTECODE_LIST(V)
 
+// List of fused test and jump bytecodes.
+#define TEST_AND_JUMP_BYTECODE_LIST(V)  \
+  V(TestEqualJumpIfTrue)                \
+  V(TestEqualJumpIfTrueConstant)        \
+  V(TestEqualJumpIfFalse)               \
+  V(TestEqualJumpIfFalseConstant)       \
+  V(TestEqualStrictJumpIfTrue)          \
+  V(TestEqualStrictJumpIfTrueConstant)  \
+  V(TestEqualStrictJumpIfFalse)         \
+  V(TestEqualStrictJumpIfFalseConstant) \
+  V(TestLessThanJumpIfTrue)             \
+  V(TestLessThanJumpIfTrueConstant)     \
+  V(TestLessThanJumpIfFalse)            \
+  V(TestLessThanJumpIfFalseConstant)
+
 // Enumeration of interpreter bytecodes.
 enum class Bytecode : uint8_t {
 #define DECLARE_BYTECODE(Name, ...) k##Name,
@@ -433,6 +474,34 @@ class Bytecodes final {
            bytecode == Bytecode::kLdrUndefined;
   }
 
+  // Returns true if the bytecode is a fused test and conditional jump
+  // taking an immediate byte operand (OperandType::kImm).
+  static CONSTEXPR bool IsTestAndJumpImmediate(Bytecode bytecode) {
+    return bytecode == Bytecode::kTestEqualJumpIfTrue ||
+           bytecode == Bytecode::kTestEqualJumpIfFalse ||
+           bytecode == Bytecode::kTestEqualStrictJumpIfTrue ||
+           bytecode == Bytecode::kTestEqualStrictJumpIfFalse ||
+           bytecode == Bytecode::kTestLessThanJumpIfTrue ||
+           bytecode == Bytecode::kTestLessThanJumpIfFalse;
+  }
+
+  // Returns true if the bytecode is a fused test and conditional jump
+  // taking a constant pool entry (OperandType::kIdx).
+  static CONSTEXPR bool IsTestAndJumpConstant(Bytecode bytecode) {
+    return bytecode == Bytecode::kTestEqualJumpIfTrueConstant ||
+           bytecode == Bytecode::kTestEqualJumpIfFalseConstant ||
+           bytecode == Bytecode::kTestEqualStrictJumpIfTrueConstant ||
+           bytecode == Bytecode::kTestEqualStrictJumpIfFalseConstant ||
+           bytecode == Bytecode::kTestLessThanJumpIfTrueConstant ||
+           bytecode == Bytecode::kTestLessThanJumpIfFalseConstant;
+  }
+
+  // Returns true if the bytecode is a fused test and conditional jump
+  // taking any kind of operand.
+  static CONSTEXPR bool IsTestAndJump(Bytecode bytecode) {
+    return IsTestAndJumpImmediate(bytecode) || IsTestAndJumpConstant(bytecode);
+  }
+
   // Returns true if the bytecode is a conditional jump taking
   // an immediate byte operand (OperandType::kImm).
   static CONSTEXPR bool IsConditionalJumpImmediate(Bytecode bytecode) {
@@ -442,7 +511,8 @@ class Bytecodes final {
            bytecode == Bytecode::kJumpIfToBooleanFalse ||
            bytecode == Bytecode::kJumpIfNotHole ||
            bytecode == Bytecode::kJumpIfNull ||
-           bytecode == Bytecode::kJumpIfUndefined;
+           bytecode == Bytecode::kJumpIfUndefined ||
+           IsTestAndJumpImmediate(bytecode);
   }
 
   // Returns true if the bytecode is a conditional jump taking
@@ -454,7 +524,8 @@ class Bytecodes final {
            bytecode == Bytecode::kJumpIfToBooleanFalseConstant ||
            bytecode == Bytecode::kJumpIfNotHoleConstant ||
            bytecode == Bytecode::kJumpIfNullConstant ||
-           bytecode == Bytecode::kJumpIfUndefinedConstant;
+           bytecode == Bytecode::kJumpIfUndefinedConstant ||
+           IsTestAndJumpConstant(bytecode);
   }
 
   // Returns true if the bytecode is a conditional jump taking
@@ -500,9 +571,10 @@ class Bytecodes final {
 
   // Return true if |bytecode| is a jump without effects,
   // e.g.  any jump excluding those that include type coercion like
-  // JumpIfTrueToBoolean.
+  // JumpIfTrueToBoolean or a comparison like TestEqualJumpIfTrue.
   static CONSTEXPR bool IsJumpWithoutEffects(Bytecode bytecode) {
-    return IsJump(bytecode) && !IsJumpIfToBoolean(bytecode);
+    return IsJump(bytecode) && !IsJumpIfToBoolean(bytecode) &&
+           !IsTestAndJump(bytecode);
   }
 
   // Returns true if |bytecode| has no effects. These bytecodes only manipulate
@@ -631,6 +703,11 @@ class Bytecodes final {
   // Returns the equivalent jump bytecode without the accumulator coercion.
   static Bytecode GetJumpWithoutToBoolean(Bytecode bytecode);
 
+  // Returns the fused test and jump bytecode replacing the test |test|
+  // followed by the conditional jump |jump|, or Bytecode::kIllegal if there
+  // is none.
+  static Bytecode GetTestAndJump(Bytecode test, Bytecode jump);
+
   // Returns true if the bytecode is a debug break.
   static bool IsDebugBreak(Bytecode bytecode);
 
@@ -1350,7 +1350,8 @@ Node* InterpreterAssembler::ImportRegisterFile(Node* array) {
   var_index.Bind(Int32Constant(0));
 
   // Iterate over array and write values into register file.  Also erase the
-  // array contents to not keep them alive artificially.
+  // array contents to not keep them alive artificially. The stale register
+  // marker is an immortal immovable root, so erasing needs no write barrier.
   Label loop(this, &var_index), done_loop(this);
   Goto(&loop);
   Bind(&loop);
@@ -1365,7 +1366,8 @@ Node* InterpreterAssembler::ImportRegisterFile(Node* array) {
         Int32Sub(Int32Constant(Register(0).ToOperand()), index);
     StoreRegister(value, ChangeInt32ToIntPtr(reg_index));
 
-    StoreFixedArrayElement(array, index, StaleRegisterConstant());
+    StoreFixedArrayElement(array, index, StaleRegisterConstant(),
+                           SKIP_WRITE_BARRIER);
 
     var_index.Bind(Int32Add(index, Int32Constant(1)));
     Goto(&loop);
@@ -146,6 +146,75 @@ Node* IntrinsicsHelper::IsInstanceType(Node* input, int type) {
   return return_value.value();
 }
 
+Node* IntrinsicsHelper::IsArrayIteratorLookupChainIntact() {
+  Node* protector_cell = __ LoadRoot(Heap::kArrayIteratorProtectorRootIndex);
+  Node* protector = __ LoadObjectField(protector_cell, Cell::kValueOffset);
+  Node* valid = __ SmiConstant(Smi::FromInt(Isolate::kArrayProtectorValid));
+  return __ WordEqual(protector, valid);
+}
+
+Node* IntrinsicsHelper::ArrayIteratorProtector(Node* input, Node* arg_count,
+                                               Node* context) {
+  InterpreterAssembler::Variable return_value(assembler_,
+                                              MachineRepresentation::kTagged);
+  InterpreterAssembler::Label return_true(assembler_), return_false(assembler_),
+      end(assembler_);
+
+  __ Branch(IsArrayIteratorLookupChainIntact(), &return_true, &return_false);
+
+  __ Bind(&return_true);
+  {
+    return_value.Bind(__ BooleanConstant(true));
+    __ Goto(&end);
+  }
+
+  __ Bind(&return_false);
+  {
+    return_value.Bind(__ BooleanConstant(false));
+    __ Goto(&end);
+  }
+
+  __ Bind(&end);
+  return return_value.value();
+}
+
+Node* IntrinsicsHelper::IsFastArrayIterable(Node* input, Node* arg_count,
+                                            Node* context) {
+  InterpreterAssembler::Variable return_value(assembler_,
+                                              MachineRepresentation::kTagged);
+  InterpreterAssembler::Label return_true(assembler_), return_false(assembler_),
+      end(assembler_);
+
+  Node* arg = __ LoadRegister(input);
+  __ GotoIf(__ TaggedIsSmi(arg), &return_false);
+  __ GotoUnless(CompareInstanceType(arg, JS_ARRAY_TYPE, kInstanceTypeEqual),
+                &return_false);
+  __ GotoUnless(IsArrayIteratorLookupChainIntact(), &return_false);
+
+  // Arrays with a different prototype may have a different iterator.
+  Node* native_context = __ LoadNativeContext(context);
+  Node* initial_array_prototype = __ LoadContextElement(
+      native_context, Context::INITIAL_ARRAY_PROTOTYPE_INDEX);
+  Node* prototype = __ LoadMapPrototype(__ LoadMap(arg));
+  __ Branch(__ WordEqual(prototype, initial_array_prototype), &return_true,
+            &return_false);
+
+  __ Bind(&return_true);
+  {
+    return_value.Bind(__ BooleanConstant(true));
+    __ Goto(&end);
+  }
+
+  __ Bind(&return_false);
+  {
+    return_value.Bind(__ BooleanConstant(false));
+    __ Goto(&end);
+  }
+
+  __ Bind(&end);
+  return return_value.value();
+}
+
 Node* IntrinsicsHelper::IsJSReceiver(Node* input, Node* arg_count,
                                      Node* context) {
   InterpreterAssembler::Variable return_value(assembler_,
@@ -942,11 +942,20 @@ void Interpreter::DoBinaryOpWithFeedback(InterpreterAssembler* assembler) {
 
 void Interpreter::DoCompareOpWithFeedback(Token::Value compare_op,
                                           InterpreterAssembler* assembler) {
-  Node* reg_index = __ BytecodeOperandReg(0);
+  Node* result = BuildCompareOpWithFeedback(compare_op, 0, 1, assembler);
+  __ SetAccumulator(result);
+  __ Dispatch();
+}
+
+Node* Interpreter::BuildCompareOpWithFeedback(Token::Value compare_op,
+                                              int reg_operand_index,
+                                              int slot_operand_index,
+                                              InterpreterAssembler* assembler) {
+  Node* reg_index = __ BytecodeOperandReg(reg_operand_index);
   Node* lhs = __ LoadRegister(reg_index);
   Node* rhs = __ GetAccumulator();
   Node* context = __ GetContext();
-  Node* slot_index = __ BytecodeOperandIdx(1);
+  Node* slot_index = __ BytecodeOperandIdx(slot_operand_index);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
 
   // TODO(interpreter): the only reason this check is here is because we
@@ -1042,8 +1051,23 @@ void Interpreter::DoCompareOpWithFeedback(Token::Value compare_op,
     default:
       UNREACHABLE();
   }
+  return result;
+}
+
+void Interpreter::DoTestAndJump(Token::Value compare_op, bool jump_if_true,
+                                bool constant_offset,
+                                InterpreterAssembler* assembler) {
+  Node* result = BuildCompareOpWithFeedback(compare_op, 1, 2, assembler);
   __ SetAccumulator(result);
-  __ Dispatch();
+  Node* relative_jump;
+  if (constant_offset) {
+    Node* index = __ BytecodeOperandIdx(0);
+    relative_jump = __ LoadAndUntagConstantPoolEntry(index);
+  } else {
+    relative_jump = __ BytecodeOperandImm(0);
+  }
+  Node* expected_value = __ BooleanConstant(jump_if_true);
+  __ JumpIfWordEqual(result, expected_value, relative_jump);
 }
 
 // Add <src>
@@ -2027,6 +2051,121 @@ void Interpreter::DoJumpLoop(InterpreterAssembler* assembler) {
   }
 }
 
+// TestEqualJumpIfTrue <imm> <src> <slot>
+//
+// Test if the value in the <src> register equals the accumulator, leaving the
+// result in the accumulator, and jump by the number of bytes represented by the
+// immediate operand |imm| if the result is true.
+void Interpreter::DoTestEqualJumpIfTrue(InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ, true, false, assembler);
+}
+
+// TestEqualJumpIfTrueConstant <idx> <src> <slot>
+//
+// Test if the value in the <src> register equals the accumulator, leaving the
+// result in the accumulator, and jump by the number of bytes in the Smi in the
+// |idx| entry in the constant pool if the result is true.
+void Interpreter::DoTestEqualJumpIfTrueConstant(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ, true, true, assembler);
+}
+
+// TestEqualJumpIfFalse <imm> <src> <slot>
+//
+// Test if the value in the <src> register equals the accumulator, leaving the
+// result in the accumulator, and jump by the number of bytes represented by the
+// immediate operand |imm| if the result is false.
+void Interpreter::DoTestEqualJumpIfFalse(InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ, false, false, assembler);
+}
+
+// TestEqualJumpIfFalseConstant <idx> <src> <slot>
+//
+// Test if the value in the <src> register equals the accumulator, leaving the
+// result in the accumulator, and jump by the number of bytes in the Smi in the
+// |idx| entry in the constant pool if the result is false.
+void Interpreter::DoTestEqualJumpIfFalseConstant(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ, false, true, assembler);
+}
+
+// TestEqualStrictJumpIfTrue <imm> <src> <slot>
+//
+// Test if the value in the <src> register is strictly equal to the accumulator,
+// leaving the result in the accumulator, and jump by the number of bytes
+// represented by the immediate operand |imm| if the result is true.
+void Interpreter::DoTestEqualStrictJumpIfTrue(InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ_STRICT, true, false, assembler);
+}
+
+// TestEqualStrictJumpIfTrueConstant <idx> <src> <slot>
+//
+// Test if the value in the <src> register is strictly equal to the accumulator,
+// leaving the result in the accumulator, and jump by the number of bytes in the
+// Smi in the |idx| entry in the constant pool if the result is true.
+void Interpreter::DoTestEqualStrictJumpIfTrueConstant(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ_STRICT, true, true, assembler);
+}
+
+// TestEqualStrictJumpIfFalse <imm> <src> <slot>
+//
+// Test if the value in the <src> register is strictly equal to the accumulator,
+// leaving the result in the accumulator, and jump by the number of bytes
+// represented by the immediate operand |imm| if the result is false.
+void Interpreter::DoTestEqualStrictJumpIfFalse(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ_STRICT, false, false, assembler);
+}
+
+// TestEqualStrictJumpIfFalseConstant <idx> <src> <slot>
+//
+// Test if the value in the <src> register is strictly equal to the accumulator,
+// leaving the result in the accumulator, and jump by the number of bytes in the
+// Smi in the |idx| entry in the constant pool if the result is false.
+void Interpreter::DoTestEqualStrictJumpIfFalseConstant(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::EQ_STRICT, false, true, assembler);
+}
+
+// TestLessThanJumpIfTrue <imm> <src> <slot>
+//
+// Test if the value in the <src> register is less than the accumulator, leaving
+// the result in the accumulator, and jump by the number of bytes represented by
+// the immediate operand |imm| if the result is true.
+void Interpreter::DoTestLessThanJumpIfTrue(InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::LT, true, false, assembler);
+}
+
+// TestLessThanJumpIfTrueConstant <idx> <src> <slot>
+//
+// Test if the value in the <src> register is less than the accumulator, leaving
+// the result in the accumulator, and jump by the number of bytes in the Smi in
+// the |idx| entry in the constant pool if the result is true.
+void Interpreter::DoTestLessThanJumpIfTrueConstant(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::LT, true, true, assembler);
+}
+
+// TestLessThanJumpIfFalse <imm> <src> <slot>
+//
+// Test if the value in the <src> register is less than the accumulator, leaving
+// the result in the accumulator, and jump by the number of bytes represented by
+// the immediate operand |imm| if the result is false.
+void Interpreter::DoTestLessThanJumpIfFalse(InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::LT, false, false, assembler);
+}
+
+// TestLessThanJumpIfFalseConstant <idx> <src> <slot>
+//
+// Test if the value in the <src> register is less than the accumulator, leaving
+// the result in the accumulator, and jump by the number of bytes in the Smi in
+// the |idx| entry in the constant pool if the result is false.
+void Interpreter::DoTestLessThanJumpIfFalseConstant(
+    InterpreterAssembler* assembler) {
+  DoTestAndJump(Token::Value::LT, false, true, assembler);
+}
+
 // CreateRegExpLiteral <pattern_idx> <literal_idx> <flags>
 //
 // Creates a regular expression literal for literal index <literal_idx> with
@@ -85,6 +85,21 @@ class Interpreter {
   void DoCompareOpWithFeedback(Token::Value compare_op,
                                InterpreterAssembler* assembler);
 
+  // Generates code to perform the comparison corresponding to |compare_op|
+  // while gathering type feedback, reading the register and feedback slot
+  // from the given operands. Returns the result of the comparison.
+  compiler::Node* BuildCompareOpWithFeedback(Token::Value compare_op,
+                                             int reg_operand_index,
+                                             int slot_operand_index,
+                                             InterpreterAssembler* assembler);
+
+  // Generates code for a fused test and conditional jump bytecode, which
+  // performs the comparison corresponding to |compare_op| and jumps if the
+  // result is |jump_if_true|. The jump offset is read from the constant pool
+  // if |constant_offset| is true.
+  void DoTestAndJump(Token::Value compare_op, bool jump_if_true,
+                     bool constant_offset, InterpreterAssembler* assembler);
+
   // Generates code to perform the bitwise binary operation corresponding to
   // |bitwise_op| while gathering type feedback.
   void DoBitwiseBinaryOp(Token::Value bitwise_op,
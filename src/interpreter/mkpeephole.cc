@@ -149,6 +149,14 @@ PeepholeActionAndData PeepholeActionTableWriter::LookupActionAndData(
   // TODO(rmcilroy): Add elide for consecutive mov to and from the same
   // register.
 
+  // Fuse common tests with the conditional jump consuming their result.
+  // The action only fuses when superinstructions are enabled, otherwise it
+  // just removes any ToBoolean coercion from the jump.
+  if (Bytecodes::GetTestAndJump(last, current) != Bytecode::kIllegal) {
+    return {PeepholeAction::kTransformTestAndJumpAction,
+            Bytecodes::GetTestAndJump(last, current)};
+  }
+
   // Remove ToBoolean coercion from conditional jumps where possible.
   if (Bytecodes::WritesBooleanToAccumulator(last)) {
     if (Bytecodes::IsJumpIfToBoolean(current)) {
@@ -133,6 +133,13 @@ bool Isolate::IsArraySpeciesLookupChainIntact() {
          Smi::cast(species_cell->value())->value() == kArrayProtectorValid;
 }
 
+bool Isolate::IsArrayIteratorLookupChainIntact() {
+  Cell* array_iterator_cell = heap()->array_iterator_protector();
+  return array_iterator_cell->value()->IsSmi() &&
+         Smi::cast(array_iterator_cell->value())->value() ==
+             kArrayProtectorValid;
+}
+
 bool Isolate::IsHasInstanceLookupChainIntact() {
   PropertyCell* has_instance_cell = heap()->has_instance_protector();
   return has_instance_cell->value() == Smi::FromInt(kArrayProtectorValid);
@@ -9,6 +9,7 @@
 #include <fstream>  // NOLINT(readability/streams)
 #include <sstream>
 
+#include "src/ast/ast-value-factory.h"
 #include "src/ast/context-slot-cache.h"
 #include "src/base/hashmap.h"
 #include "src/base/platform/platform.h"
@@ -20,6 +21,7 @@
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
 #include "src/compilation-statistics.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/crankshaft/hydrogen.h"
 #include "src/debug/debug.h"
@@ -619,6 +621,7 @@ class CaptureStackTraceHelper {
   }
 
   Handle<JSObject> NewStackFrameObject(FrameSummary& summ) {
+    summ.EnsureSourcePositionsAvailable();
     int position = summ.abstract_code()->SourcePosition(summ.code_offset());
     return NewStackFrameObject(summ.function(), position,
                                summ.is_constructor());
@@ -1451,7 +1454,7 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   StandardFrame* frame = it.frame();
   // TODO(clemensh): handle wasm frames
   if (!frame->is_java_script()) return false;
-  JSFunction* fun = JavaScriptFrame::cast(frame)->function();
+  Handle<JSFunction> fun(JavaScriptFrame::cast(frame)->function(), this);
   Object* script = fun->shared()->script();
   if (!script->IsScript() ||
       (Script::cast(script)->source()->IsUndefined(this))) {
@@ -1464,8 +1467,9 @@ bool Isolate::ComputeLocation(MessageLocation* target) {
   List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
   JavaScriptFrame::cast(frame)->Summarize(&frames);
   FrameSummary& summary = frames.last();
+  summary.EnsureSourcePositionsAvailable();
   int pos = summary.abstract_code()->SourcePosition(summary.code_offset());
-  *target = MessageLocation(casted_script, pos, pos + 1, handle(fun, this));
+  *target = MessageLocation(casted_script, pos, pos + 1, fun);
   return true;
 }
 
@@ -1520,11 +1524,15 @@ bool Isolate::ComputeLocationFromStackTrace(MessageLocation* target,
     Object* script = fun->shared()->script();
     if (script->IsScript() &&
         !(Script::cast(script)->source()->IsUndefined(this))) {
-      AbstractCode* abstract_code = elements->Code(i);
+      Handle<Script> casted_script(Script::cast(script));
+      Handle<AbstractCode> abstract_code(elements->Code(i), this);
       const int code_offset = elements->Offset(i)->value();
+      if (abstract_code->IsBytecodeArray()) {
+        Handle<SharedFunctionInfo> shared(fun->shared(), this);
+        SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
+      }
       const int pos = abstract_code->SourcePosition(code_offset);
 
-      Handle<Script> casted_script(Script::cast(script));
       *target = MessageLocation(casted_script, pos, pos + 1);
       return true;
     }
@@ -1867,16 +1875,14 @@ char* Isolate::RestoreThread(char* from) {
 }
 
 
-Isolate::ThreadDataTable::ThreadDataTable()
-    : list_(NULL) {
-}
+Isolate::ThreadDataTable::ThreadDataTable() {}
 
 
 Isolate::ThreadDataTable::~ThreadDataTable() {
   // TODO(svenpanne) The assertion below would fire if an embedder does not
   // cleanly dispose all Isolates before disposing v8, so we are conservative
   // and leave it out for now.
-  // DCHECK_NULL(list_);
+  // DCHECK(table_.empty());
 }
 
 
@@ -1890,34 +1896,37 @@ Isolate::PerIsolateThreadData::~PerIsolateThreadData() {
 Isolate::PerIsolateThreadData*
     Isolate::ThreadDataTable::Lookup(Isolate* isolate,
                                      ThreadId thread_id) {
-  for (PerIsolateThreadData* data = list_; data != NULL; data = data->next_) {
-    if (data->Matches(isolate, thread_id)) return data;
-  }
-  return NULL;
+  auto it = table_.find(Key(isolate, thread_id.ToInteger()));
+  if (it == table_.end()) return NULL;
+  DCHECK(it->second->Matches(isolate, thread_id));
+  return it->second;
 }
 
 
 void Isolate::ThreadDataTable::Insert(Isolate::PerIsolateThreadData* data) {
-  if (list_ != NULL) list_->prev_ = data;
-  data->next_ = list_;
-  list_ = data;
+  bool inserted =
+      table_
+          .insert(std::make_pair(
+              Key(data->isolate(), data->thread_id().ToInteger()), data))
+          .second;
+  CHECK(inserted);
 }
 
 
 void Isolate::ThreadDataTable::Remove(PerIsolateThreadData* data) {
-  if (list_ == data) list_ = data->next_;
-  if (data->next_ != NULL) data->next_->prev_ = data->prev_;
-  if (data->prev_ != NULL) data->prev_->next_ = data->next_;
+  table_.erase(Key(data->isolate(), data->thread_id().ToInteger()));
   delete data;
 }
 
 
 void Isolate::ThreadDataTable::RemoveAllThreads(Isolate* isolate) {
-  PerIsolateThreadData* data = list_;
-  while (data != NULL) {
-    PerIsolateThreadData* next = data->next_;
-    if (data->isolate() == isolate) Remove(data);
-    data = next;
+  for (auto it = table_.begin(); it != table_.end();) {
+    if (it->first.first == isolate) {
+      delete it->second;
+      it = table_.erase(it);
+    } else {
+      ++it;
+    }
   }
 }
 
@@ -2059,6 +2068,7 @@ Isolate::Isolate(bool enable_serializer)
       descriptor_lookup_cache_(NULL),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
+      ast_string_constants_(NULL),
       allocator_(FLAG_trace_gc_object_stats ? new VerboseAccountingAllocator(
                                                   &heap_, 256 * KB, 128 * KB)
                                             : new AccountingAllocator()),
@@ -2085,6 +2095,7 @@ Isolate::Isolate(bool enable_serializer)
       function_entry_hook_(NULL),
       deferred_handles_head_(NULL),
       optimizing_compile_dispatcher_(NULL),
+      compiler_dispatcher_(nullptr),
       stress_deopt_count_(0),
       next_optimization_id_(0),
       js_calls_from_api_counter_(0),
@@ -2192,6 +2203,12 @@ void Isolate::Deinit() {
     optimizing_compile_dispatcher_ = NULL;
   }
 
+  if (compiler_dispatcher_ != nullptr) {
+    compiler_dispatcher_->AbortAll();
+    delete compiler_dispatcher_;
+    compiler_dispatcher_ = nullptr;
+  }
+
   if (heap_.mark_compact_collector()->sweeping_in_progress()) {
     heap_.mark_compact_collector()->EnsureSweepingCompleted();
   }
@@ -2265,6 +2282,9 @@ Isolate::~Isolate() {
   delete unicode_cache_;
   unicode_cache_ = NULL;
 
+  delete ast_string_constants_;
+  ast_string_constants_ = NULL;
+
   delete date_cache_;
   date_cache_ = NULL;
 
@@ -2398,6 +2418,7 @@ void Isolate::InitializeLoggingAndCounters() {
 
 bool Isolate::Init(Deserializer* des) {
   TRACE_ISOLATE(init);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"), "V8.IsolateInit");
 
   stress_deopt_count_ = FLAG_deopt_every_n_times;
 
@@ -2469,9 +2490,12 @@ bool Isolate::Init(Deserializer* des) {
 
   // SetUp the object heap.
   DCHECK(!heap_.HasBeenSetUp());
-  if (!heap_.SetUp()) {
-    V8::FatalProcessOutOfMemory("heap setup");
-    return false;
+  {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"), "V8.HeapSetUp");
+    if (!heap_.SetUp()) {
+      V8::FatalProcessOutOfMemory("heap setup");
+      return false;
+    }
   }
 
 // Initialize the interface descriptors ahead of time.
@@ -2496,7 +2520,10 @@ bool Isolate::Init(Deserializer* des) {
   InitializeThreadLocal();
 
   bootstrapper_->Initialize(create_heap_objects);
-  builtins_.SetUp(this, create_heap_objects);
+  {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"), "V8.BuiltinsSetUp");
+    builtins_.SetUp(this, create_heap_objects);
+  }
   if (create_heap_objects) {
     heap_.CreateFixedStubs();
   }
@@ -2511,6 +2538,10 @@ bool Isolate::Init(Deserializer* des) {
   } else if (OptimizingCompileDispatcher::Enabled()) {
     optimizing_compile_dispatcher_ = new OptimizingCompileDispatcher(this);
   }
+  if (FLAG_compiler_dispatcher) {
+    compiler_dispatcher_ = new CompilerDispatcher(
+        this, V8::GetCurrentPlatform(), FLAG_stack_size);
+  }
 
   // Initialize runtime profiler before deserialization, because collections may
   // occur, clearing/updating ICs.
@@ -2521,17 +2552,24 @@ bool Isolate::Init(Deserializer* des) {
     AlwaysAllocateScope always_allocate(this);
 
     if (!create_heap_objects) {
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"),
+                   "V8.DeserializeIsolate");
       des->Deserialize(this);
     }
     load_stub_cache_->Initialize();
     store_stub_cache_->Initialize();
     if (FLAG_ignition || serializer_enabled()) {
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"),
+                   "V8.InterpreterInit");
       interpreter_->Initialize();
     }
 
     heap_.NotifyDeserializationComplete();
   }
 
+  // The string constants of the parser refer to strings in the root list.
+  ast_string_constants_ = new AstStringConstants(this, heap()->HashSeed());
+
   // Finish initialization of ThreadLocal after deserialization is done.
   clear_pending_exception();
   clear_pending_message();
@@ -2688,8 +2726,6 @@ void Isolate::UnlinkDeferredHandles(DeferredHandles* deferred) {
 
 void Isolate::DumpAndResetCompilationStats() {
   if (turbo_statistics() != nullptr) {
-    DCHECK(FLAG_turbo_stats || FLAG_turbo_stats_nvp);
-
     OFStream os(stdout);
     if (FLAG_turbo_stats) {
       AsPrintableStatistics ps = {*turbo_statistics(), false};
@@ -2783,6 +2819,12 @@ bool Isolate::IsInAnyContext(Object* object, uint32_t index) {
   return false;
 }
 
+bool Isolate::NeedsSourcePositionsForProfiling() {
+  return FLAG_trace_deopt || FLAG_trace_turbo || FLAG_turbo_profiling ||
+         FLAG_perf_prof || is_profiling() || debug_->is_active() ||
+         logger_->is_logging_code_events();
+}
+
 bool Isolate::IsFastArrayConstructorPrototypeChainIntact() {
   PropertyCell* no_elements_cell = heap()->array_protector();
   bool cell_reports_intact =
@@ -2884,6 +2926,19 @@ void Isolate::UpdateArrayProtectorOnSetElement(Handle<JSObject> object) {
       handle(Smi::FromInt(kArrayProtectorInvalid), this));
 }
 
+void Isolate::UpdateArrayIteratorProtectorOnSetPrototype(
+    Handle<JSObject> object) {
+  DisallowHeapAllocation no_gc;
+  if (!object->map()->is_prototype_map()) return;
+  if (!IsArrayIteratorLookupChainIntact()) return;
+  // A new prototype of %ArrayIteratorPrototype% or %IteratorPrototype% can
+  // provide a "return" method for array iterators.
+  if (IsInAnyContext(*object, Context::ARRAY_ITERATOR_PROTOTYPE_INDEX) ||
+      IsInAnyContext(*object, Context::INITIAL_ITERATOR_PROTOTYPE_INDEX)) {
+    InvalidateArrayIteratorProtector();
+  }
+}
+
 void Isolate::InvalidateHasInstanceProtector() {
   DCHECK(factory()->has_instance_protector()->value()->IsSmi());
   DCHECK(IsHasInstanceLookupChainIntact());
@@ -2909,6 +2964,14 @@ void Isolate::InvalidateArraySpeciesProtector() {
   DCHECK(!IsArraySpeciesLookupChainIntact());
 }
 
+void Isolate::InvalidateArrayIteratorProtector() {
+  DCHECK(factory()->array_iterator_protector()->value()->IsSmi());
+  DCHECK(IsArrayIteratorLookupChainIntact());
+  factory()->array_iterator_protector()->set_value(
+      Smi::FromInt(kArrayProtectorInvalid));
+  DCHECK(!IsArrayIteratorLookupChainIntact());
+}
+
 void Isolate::InvalidateStringLengthOverflowProtector() {
   DCHECK(factory()->string_length_protector()->value()->IsSmi());
   DCHECK(IsStringLengthOverflowIntact());
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <queue>
+#include <unordered_map>
 
 #include "include/v8-debug.h"
 #include "src/allocation.h"
@@ -37,6 +38,7 @@ class AccessCompilerData;
 class BasicBlockProfiler;
 class Bootstrapper;
 class CancelableTaskManager;
+class AstStringConstants;
 class CallInterfaceDescriptorData;
 class CodeAgingHelper;
 class CodeEventDispatcher;
@@ -44,6 +46,7 @@ class CodeGenerator;
 class CodeRange;
 class CodeStubDescriptor;
 class CodeTracer;
+class CompilerDispatcher;
 class CompilationCache;
 class CompilationStatistics;
 class ContextSlotCache;
@@ -415,6 +418,7 @@ typedef List<HeapObject*> DebugObjectCache;
   V(int, pending_microtask_count, 0)                                          \
   V(HStatistics*, hstatistics, nullptr)                                       \
   V(CompilationStatistics*, turbo_statistics, nullptr)                        \
+  V(bool, turbo_statistics_enabled, false)                                    \
   V(HTracer*, htracer, nullptr)                                               \
   V(CodeTracer*, code_tracer, nullptr)                                        \
   V(bool, fp_stubs_generated, false)                                          \
@@ -454,12 +458,11 @@ class Isolate {
         : isolate_(isolate),
           thread_id_(thread_id),
           stack_limit_(0),
-          thread_state_(NULL),
+          thread_state_(NULL) {
 #if USE_SIMULATOR
-          simulator_(NULL),
+      simulator_ = NULL;
 #endif
-          next_(NULL),
-          prev_(NULL) { }
+    }
     ~PerIsolateThreadData();
     Isolate* isolate() const { return isolate_; }
     ThreadId thread_id() const { return thread_id_; }
@@ -485,9 +488,6 @@ class Isolate {
     Simulator* simulator_;
 #endif
 
-    PerIsolateThreadData* next_;
-    PerIsolateThreadData* prev_;
-
     friend class Isolate;
     friend class ThreadDataTable;
     friend class EntryStackItem;
@@ -892,6 +892,10 @@ class Isolate {
     return unicode_cache_;
   }
 
+  const AstStringConstants* ast_string_constants() const {
+    return ast_string_constants_;
+  }
+
   InnerPointerToCodeCache* inner_pointer_to_code_cache() {
     return inner_pointer_to_code_cache_;
   }
@@ -996,11 +1000,16 @@ class Isolate {
 
   Map* get_initial_js_array_map(ElementsKind kind);
 
+  // Returns true if source positions must be recorded at compile time, e.g.
+  // because code events are logged or a debugger is attached.
+  bool NeedsSourcePositionsForProfiling();
+
   static const int kArrayProtectorValid = 1;
   static const int kArrayProtectorInvalid = 0;
 
   bool IsFastArrayConstructorPrototypeChainIntact();
   inline bool IsArraySpeciesLookupChainIntact();
+  inline bool IsArrayIteratorLookupChainIntact();
   inline bool IsHasInstanceLookupChainIntact();
   bool IsIsConcatSpreadableLookupChainIntact();
   bool IsIsConcatSpreadableLookupChainIntact(JSReceiver* receiver);
@@ -1020,7 +1029,9 @@ class Isolate {
   void UpdateArrayProtectorOnNormalizeElements(Handle<JSObject> object) {
     UpdateArrayProtectorOnSetElement(object);
   }
+  void UpdateArrayIteratorProtectorOnSetPrototype(Handle<JSObject> object);
   void InvalidateArraySpeciesProtector();
+  void InvalidateArrayIteratorProtector();
   void InvalidateHasInstanceProtector();
   void InvalidateIsConcatSpreadableProtector();
   void InvalidateStringLengthOverflowProtector();
@@ -1051,10 +1062,19 @@ class Isolate {
     return optimizing_compile_dispatcher_;
   }
 
+  // Only available with --compiler-dispatcher.
+  CompilerDispatcher* compiler_dispatcher() { return compiler_dispatcher_; }
+
   int id() const { return static_cast<int>(id_); }
 
   HStatistics* GetHStatistics();
   CompilationStatistics* GetTurboStatistics();
+  // Whether TurboFan records per-phase statistics, for --turbo-stats or for
+  // the API.
+  bool ShouldRecordTurboStatistics() const {
+    return FLAG_turbo_stats || FLAG_turbo_stats_nvp ||
+           turbo_statistics_enabled_;
+  }
   HTracer* GetHTracer();
   CodeTracer* GetCodeTracer();
 
@@ -1195,7 +1215,8 @@ class Isolate {
   Heap heap_;
 
   // The per-process lock should be acquired before the ThreadDataTable is
-  // modified.
+  // modified. Lookups are hashed on the isolate and thread id, since they
+  // happen for every Locker, Unlocker and isolate entry.
   class ThreadDataTable {
    public:
     ThreadDataTable();
@@ -1207,7 +1228,14 @@ class Isolate {
     void RemoveAllThreads(Isolate* isolate);
 
    private:
-    PerIsolateThreadData* list_;
+    typedef std::pair<Isolate*, int> Key;
+    struct Hasher {
+      size_t operator()(const Key& key) const {
+        return base::hash_combine(key.first, key.second);
+      }
+    };
+
+    std::unordered_map<Key, PerIsolateThreadData*, Hasher> table_;
   };
 
   // These items form a stack synchronously with threads Enter'ing and Exit'ing
@@ -1336,6 +1364,7 @@ class Isolate {
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_;
   UnicodeCache* unicode_cache_;
+  AstStringConstants* ast_string_constants_;
   AccountingAllocator* allocator_;
   InnerPointerToCodeCache* inner_pointer_to_code_cache_;
   GlobalHandles* global_handles_;
@@ -1415,6 +1444,7 @@ class Isolate {
 
   DeferredHandles* deferred_handles_head_;
   OptimizingCompileDispatcher* optimizing_compile_dispatcher_;
+  CompilerDispatcher* compiler_dispatcher_;
 
   // Counts deopt points if deopt_every_n_times is enabled.
   unsigned int stress_deopt_count_;
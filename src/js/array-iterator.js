@@ -163,6 +163,9 @@ utils.Export(function(to) {
   to.ArrayValues = ArrayValues;
 });
 
-%InstallToContext(["array_values_iterator", ArrayValues]);
+%InstallToContext([
+  "array_iterator_prototype", ArrayIterator.prototype,
+  "array_values_iterator", ArrayValues,
+]);
 
 })
@@ -998,6 +998,7 @@ function ArraySort(comparefn) {
   CHECK_OBJECT_COERCIBLE(this, "Array.prototype.sort");
 
   var array = TO_OBJECT(this);
+  if (IS_UNDEFINED(comparefn) && %ArraySortFast(array)) return array;
   var length = TO_LENGTH(array.length);
   return InnerArraySort(array, length, comparefn);
 }
@@ -13,9 +13,7 @@
 
 var AsyncFunctionNext;
 var AsyncFunctionThrow;
-var GlobalPromise;
 var IsPromise;
-var NewPromiseCapability;
 var PerformPromiseThen;
 var PromiseCreate;
 var PromiseNextMicrotaskID;
@@ -25,9 +23,7 @@ var ResolvePromise;
 utils.Import(function(from) {
   AsyncFunctionNext = from.AsyncFunctionNext;
   AsyncFunctionThrow = from.AsyncFunctionThrow;
-  GlobalPromise = from.GlobalPromise;
   IsPromise = from.IsPromise;
-  NewPromiseCapability = from.NewPromiseCapability;
   PerformPromiseThen = from.PerformPromiseThen;
   PromiseCreate = from.PromiseCreate;
   PromiseNextMicrotaskID = from.PromiseNextMicrotaskID;
@@ -91,8 +87,14 @@ function AsyncFunctionAwait(generator, awaited, outerPromise) {
     return;
   }
 
-  // Just forwarding the exception, so no debugEvent for throwawayCapability
-  var throwawayCapability = NewPromiseCapability(GlobalPromise, false);
+  // The throwaway Promise is only ever settled internally, by PromiseHandle,
+  // so it needs no resolving functions. Without them, rejections are also
+  // forwarded without a debugEvent.
+  var throwawayCapability = {
+    promise: PromiseCreate(),
+    resolve: UNDEFINED,
+    reject: UNDEFINED
+  };
 
   // The Promise will be thrown away and not handled, but it shouldn't trigger
   // unhandled reject events as its work is done
@@ -2003,10 +2003,24 @@ var defaultObjects = {
   'dateformattime': UNDEFINED,
 };
 
+// The last instance of each service created for a single locale string and
+// undefined options, e.g. by 'a'.localeCompare(b, 'de'), along with that
+// locale string.
+var singleLocaleObjects = {
+  'collator': UNDEFINED,
+  'numberformat': UNDEFINED,
+  'dateformatall': UNDEFINED,
+  'dateformatdate': UNDEFINED,
+  'dateformattime': UNDEFINED,
+};
+
 function clearDefaultObjects() {
   defaultObjects['dateformatall'] = UNDEFINED;
   defaultObjects['dateformatdate'] = UNDEFINED;
   defaultObjects['dateformattime'] = UNDEFINED;
+  singleLocaleObjects['dateformatall'] = UNDEFINED;
+  singleLocaleObjects['dateformatdate'] = UNDEFINED;
+  singleLocaleObjects['dateformattime'] = UNDEFINED;
 }
 
 var date_cache_version = 0;
@@ -2023,7 +2037,8 @@ function checkDateCacheCurrent() {
 
 /**
  * Returns cached or newly created instance of a given service.
- * We cache only default instances (where no locales or options are provided).
+ * We cache default instances (where no locales or options are provided) and
+ * the last instance created for a single locale string without options.
  */
 function cachedOrNewService(service, locales, options, defaults) {
   var useOptions = (IS_UNDEFINED(defaults)) ? options : defaults;
@@ -2034,6 +2049,18 @@ function cachedOrNewService(service, locales, options, defaults) {
     }
     return defaultObjects[service];
   }
+  if (IS_STRING(locales) && IS_UNDEFINED(options)) {
+    checkDateCacheCurrent();
+    var cached = singleLocaleObjects[service];
+    if (IS_UNDEFINED(cached) || cached.locale !== locales) {
+      cached = {
+        locale: locales,
+        object: new savedObjects[service](locales, useOptions)
+      };
+      singleLocaleObjects[service] = cached;
+    }
+    return cached.object;
+  }
   return new savedObjects[service](locales, useOptions);
 }
 
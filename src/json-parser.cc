@@ -256,7 +256,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonValue() {
 
   if (c0_ == '"') return ParseJsonString();
   if ((c0_ >= '0' && c0_ <= '9') || c0_ == '-') return ParseJsonNumber();
-  if (c0_ == '{') return ParseJsonObject();
+  if (c0_ == '{') return ParseJsonObject(Handle<Map>::null());
   if (c0_ == '[') return ParseJsonArray();
   if (c0_ == 'f') {
     if (AdvanceGetChar() == 'a' && AdvanceGetChar() == 'l' &&
@@ -323,7 +323,8 @@ ParseElementResult JsonParser<seq_one_byte>::ParseElement(
 
 // Parse a JSON object. Position must be right at '{'.
 template <bool seq_one_byte>
-Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
+Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject(
+    Handle<Map> feedback) {
   HandleScope scope(isolate());
   Handle<JSObject> json_object =
       factory()->NewJSObject(object_constructor(), pretenure_);
@@ -363,14 +364,28 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       // First check whether there is a single expected transition. If so, try
       // to parse it first.
       bool follow_expected = false;
+      bool follow_feedback = false;
       Handle<Map> target;
       if (seq_one_byte) {
         key = TransitionArray::ExpectedTransitionKey(map);
         follow_expected = !key.is_null() && ParseJsonString(key);
+        // Otherwise, guess that the key is the same as in the previous object
+        // of the enclosing array, which avoids hashing the key.
+        if (key.is_null() && !feedback.is_null() &&
+            descriptor < feedback->NumberOfOwnDescriptors()) {
+          Name* name = feedback->instance_descriptors()->GetKey(descriptor);
+          if (name->IsString()) {
+            key = handle(String::cast(name), isolate());
+            follow_feedback = ParseJsonString(key);
+          }
+        }
       }
       // If the expected transition hits, follow it.
       if (follow_expected) {
         target = TransitionArray::ExpectedTransitionTarget(map);
+      } else if (follow_feedback) {
+        target = TransitionArray::FindTransitionToField(map, key);
+        transitioning = !target.is_null();
       } else {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
@@ -495,9 +510,21 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonArray() {
 
   AdvanceSkipWhitespace();
   if (c0_ != ']') {
+    Handle<Map> feedback;
     do {
-      Handle<Object> element = ParseJsonValue();
-      if (element.is_null()) return ReportUnexpectedCharacter();
+      Handle<Object> element;
+      if (c0_ == '{') {
+        // Objects in an array usually share their keys, so the map of one
+        // object predicts the keys of the next.
+        element = ParseJsonObject(feedback);
+        if (element.is_null()) return ReportUnexpectedCharacter();
+        Map* map = JSObject::cast(*element)->map();
+        feedback = map->is_dictionary_map() ? Handle<Map>::null()
+                                            : handle(map, isolate());
+      } else {
+        element = ParseJsonValue();
+        if (element.is_null()) return ReportUnexpectedCharacter();
+      }
       elements.Add(element, zone());
     } while (MatchSkipWhiteSpace(','));
     if (c0_ != ']') {
@@ -113,7 +113,9 @@ class JsonParser BASE_EMBEDDED {
   // literal, the value is a JSON value, and the two are separated by a colon.
   // A JSON array doesn't allow numbers and identifiers as keys, like a
   // JavaScript array.
-  Handle<Object> ParseJsonObject();
+  // {feedback} is the map of the previous object in the enclosing array, if
+  // any. Its keys are tried first where the transition tree branches.
+  Handle<Object> ParseJsonObject(Handle<Map> feedback);
 
   // Helper for ParseJsonObject. Parses the form "123": obj, which is recorded
   // as an element, not a property.
@@ -631,13 +631,17 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
-  for (int i = 0; i < src.length(); i++) {
-    SrcChar c = src[i];
-    if (DoNotEscape(c)) {
-      dest->Append(c);
-    } else {
-      dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
-    }
+  const SrcChar* chars = src.start();
+  int length = src.length();
+  int i = 0;
+  while (i < length) {
+    // Copy runs of characters that need no escaping in one go.
+    int run = UnescapedPrefixLength(chars + i, length - i);
+    dest->AppendChars(chars + i, run);
+    i += run;
+    if (i == length) break;
+    SrcChar c = chars[i++];
+    dest->AppendCString(&JsonEscapeTable[c * kJsonEscapeTableEntrySize]);
   }
 }
 
@@ -681,6 +685,44 @@ bool JsonStringifier::DoNotEscape(uint16_t c) {
   return c >= '#' && c != '\\' && c != 0x7f;
 }
 
+template <>
+int JsonStringifier::UnescapedPrefixLength(const uint8_t* chars, int length) {
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+
+  if (length >= kIntptrSize) {
+    // Check unaligned bytes.
+    while (!IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+      if (!DoNotEscape(*chars)) return static_cast<int>(chars - start);
+      ++chars;
+    }
+    // Check aligned words. A byte needs escaping if it is below '#', above
+    // '~' or a backslash, each of which can be tested for all bytes of a word
+    // at once.
+    const uintptr_t ones = kUintptrAllBitsSet / 0xFF;
+    const uintptr_t high_bits = ones * 0x80;
+    while (chars + sizeof(uintptr_t) <= limit) {
+      uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+      uintptr_t no_backslash = word ^ (ones * '\\');
+      uintptr_t below = (word - ones * '#') & ~word;
+      uintptr_t above = (word + ones * (0x7F - '~')) | word;
+      uintptr_t backslash = (no_backslash - ones) & ~no_backslash;
+      if ((below | above | backslash) & high_bits) break;
+      chars += sizeof(uintptr_t);
+    }
+  }
+  // Check remaining bytes.
+  while (chars < limit && DoNotEscape(*chars)) ++chars;
+  return static_cast<int>(chars - start);
+}
+
+template <>
+int JsonStringifier::UnescapedPrefixLength(const uint16_t* chars, int length) {
+  int i = 0;
+  while (i < length && DoNotEscape(chars[i])) ++i;
+  return i;
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   builder_.AppendCharacter('\n');
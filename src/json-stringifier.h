@@ -94,6 +94,10 @@ class JsonStringifier BASE_EMBEDDED {
   template <typename Char>
   INLINE(static bool DoNotEscape(Char c));
 
+  // Returns the number of leading characters that need no escaping.
+  template <typename Char>
+  INLINE(static int UnescapedPrefixLength(const Char* chars, int length));
+
   INLINE(void NewLine());
   INLINE(void Indent() { indent_++; });
   INLINE(void Unindent() { indent_--; });
@@ -18,8 +18,11 @@ namespace v8 {
 namespace platform {
 
 
-v8::Platform* CreateDefaultPlatform(int thread_pool_size) {
-  DefaultPlatform* platform = new DefaultPlatform();
+v8::Platform* CreateDefaultPlatform(int thread_pool_size,
+                                    WorkStealingSupport work_stealing_support,
+                                    IdleTaskSupport idle_task_support) {
+  DefaultPlatform* platform =
+      new DefaultPlatform(work_stealing_support, idle_task_support);
   platform->SetThreadPoolSize(thread_pool_size);
   platform->EnsureInitialized();
   return platform;
@@ -30,6 +33,12 @@ bool PumpMessageLoop(v8::Platform* platform, v8::Isolate* isolate) {
   return reinterpret_cast<DefaultPlatform*>(platform)->PumpMessageLoop(isolate);
 }
 
+double RunIdleTasks(v8::Platform* platform, v8::Isolate* isolate,
+                    double idle_time_in_seconds) {
+  return reinterpret_cast<DefaultPlatform*>(platform)->RunIdleTasks(
+      isolate, idle_time_in_seconds);
+}
+
 void SetTracingController(
     v8::Platform* platform,
     v8::platform::tracing::TracingController* tracing_controller) {
@@ -39,8 +48,12 @@ void SetTracingController(
 
 const int DefaultPlatform::kMaxThreadPoolSize = 8;
 
-DefaultPlatform::DefaultPlatform()
-    : initialized_(false), thread_pool_size_(0) {}
+DefaultPlatform::DefaultPlatform(WorkStealingSupport work_stealing_support,
+                                 IdleTaskSupport idle_task_support)
+    : initialized_(false),
+      thread_pool_size_(0),
+      work_stealing_support_(work_stealing_support),
+      idle_task_support_(idle_task_support) {}
 
 DefaultPlatform::~DefaultPlatform() {
   if (tracing_controller_) {
@@ -50,6 +63,7 @@ DefaultPlatform::~DefaultPlatform() {
 
   base::LockGuard<base::Mutex> guard(&lock_);
   queue_.Terminate();
+  if (work_stealing_queue_) work_stealing_queue_->Terminate();
   if (initialized_) {
     for (auto i = thread_pool_.begin(); i != thread_pool_.end(); ++i) {
       delete *i;
@@ -69,6 +83,12 @@ DefaultPlatform::~DefaultPlatform() {
       i->second.pop();
     }
   }
+  for (auto& i : main_thread_idle_queue_) {
+    while (!i.second.empty()) {
+      delete i.second.front();
+      i.second.pop();
+    }
+  }
 }
 
 
@@ -88,6 +108,14 @@ void DefaultPlatform::EnsureInitialized() {
   if (initialized_) return;
   initialized_ = true;
 
+  if (work_stealing_support_ == WorkStealingSupport::kEnabled) {
+    work_stealing_queue_.reset(new WorkStealingTaskQueue(thread_pool_size_));
+    for (int i = 0; i < thread_pool_size_; ++i) {
+      thread_pool_.push_back(new WorkerThread(work_stealing_queue_.get(), i));
+    }
+    return;
+  }
+
   for (int i = 0; i < thread_pool_size_; ++i)
     thread_pool_.push_back(new WorkerThread(&queue_));
 }
@@ -118,6 +146,16 @@ Task* DefaultPlatform::PopTaskInMainThreadDelayedQueue(v8::Isolate* isolate) {
   return deadline_and_task.second;
 }
 
+IdleTask* DefaultPlatform::PopTaskInMainThreadIdleQueue(v8::Isolate* isolate) {
+  auto it = main_thread_idle_queue_.find(isolate);
+  if (it == main_thread_idle_queue_.end() || it->second.empty()) {
+    return nullptr;
+  }
+  IdleTask* task = it->second.front();
+  it->second.pop();
+  return task;
+}
+
 
 bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
   Task* task = NULL;
@@ -142,10 +180,36 @@ bool DefaultPlatform::PumpMessageLoop(v8::Isolate* isolate) {
   return true;
 }
 
+double DefaultPlatform::RunIdleTasks(v8::Isolate* isolate,
+                                     double idle_time_in_seconds) {
+  DCHECK(IdleTaskSupport::kEnabled == idle_task_support_);
+  double start_in_seconds = MonotonicallyIncreasingTime();
+  double deadline_in_seconds = start_in_seconds + idle_time_in_seconds;
+  double now_in_seconds = start_in_seconds;
+  while (deadline_in_seconds > now_in_seconds) {
+    IdleTask* task;
+    {
+      base::LockGuard<base::Mutex> guard(&lock_);
+      task = PopTaskInMainThreadIdleQueue(isolate);
+    }
+    if (task == nullptr) break;
+    // Idle tasks may post new idle tasks, which run in the same idle period
+    // as long as it has not expired.
+    task->Run(deadline_in_seconds);
+    delete task;
+    now_in_seconds = MonotonicallyIncreasingTime();
+  }
+  return now_in_seconds - start_in_seconds;
+}
+
 
 void DefaultPlatform::CallOnBackgroundThread(Task *task,
                                              ExpectedRuntime expected_runtime) {
   EnsureInitialized();
+  if (work_stealing_queue_) {
+    work_stealing_queue_->Append(task, expected_runtime);
+    return;
+  }
   queue_.Append(task);
 }
 
@@ -167,11 +231,15 @@ void DefaultPlatform::CallDelayedOnForegroundThread(Isolate* isolate,
 
 void DefaultPlatform::CallIdleOnForegroundThread(Isolate* isolate,
                                                  IdleTask* task) {
-  UNREACHABLE();
+  DCHECK(IdleTaskSupport::kEnabled == idle_task_support_);
+  base::LockGuard<base::Mutex> guard(&lock_);
+  main_thread_idle_queue_[isolate].push(task);
 }
 
 
-bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) { return false; }
+bool DefaultPlatform::IdleTasksEnabled(Isolate* isolate) {
+  return idle_task_support_ == IdleTaskSupport::kEnabled;
+}
 
 
 double DefaultPlatform::MonotonicallyIncreasingTime() {
@@ -0,0 +1,106 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/libplatform/work-stealing-task-queue.h"
+
+#include <algorithm>
+
+#include "src/base/logging.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace platform {
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(int num_workers)
+    : process_queue_semaphore_(0), next_deque_(0), terminated_(false) {
+  DCHECK_GT(num_workers, 0);
+  for (int i = 0; i < num_workers; ++i) {
+    deques_.push_back(new WorkerDeque());
+  }
+}
+
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() {
+  DCHECK(terminated_.Value());
+  for (auto i = deques_.begin(); i != deques_.end(); ++i) {
+    for (int priority = 0; priority < kNumPriorities; ++priority) {
+      DCHECK((*i)->tasks[priority].empty());
+    }
+    delete *i;
+  }
+}
+
+
+void WorkStealingTaskQueue::Append(
+    Task* task, Platform::ExpectedRuntime expected_runtime) {
+  DCHECK(!terminated_.Value());
+  int priority = expected_runtime == Platform::kShortRunningTask ? 0 : 1;
+  int index = static_cast<unsigned>(next_deque_.Increment(1)) % deques_.size();
+  WorkerDeque* deque = deques_[index];
+  {
+    base::LockGuard<base::Mutex> guard(&deque->lock);
+    deque->tasks[priority].push_back(task);
+  }
+  process_queue_semaphore_.Signal();
+}
+
+
+Task* WorkStealingTaskQueue::GetNext(int worker_index) {
+  DCHECK_LT(static_cast<size_t>(worker_index), deques_.size());
+  process_queue_semaphore_.Wait();
+  // Every signal of the semaphore corresponds to a task, unless the queue was
+  // terminated, so the deques are never empty here. A scan can still miss
+  // when another worker takes the task we were going for while a newer one
+  // lands in a deque we already looked at. Such misses are transient, but
+  // back off instead of spinning on the deque locks while they resolve.
+  const int kPollsBeforeSleeping = 16;
+  const int kMaxSleepShift = 7;  // 128 microseconds.
+  for (int polls = 0;; ++polls) {
+    Task* task = TryPop(worker_index);
+    if (task != NULL) return task;
+    if (terminated_.Value()) {
+      process_queue_semaphore_.Signal();
+      return NULL;
+    }
+    if (polls < kPollsBeforeSleeping) continue;
+    int shift = std::min(polls - kPollsBeforeSleeping, kMaxSleepShift);
+    base::OS::Sleep(base::TimeDelta::FromMicroseconds(1 << shift));
+  }
+}
+
+
+void WorkStealingTaskQueue::Terminate() {
+  DCHECK(!terminated_.Value());
+  terminated_.SetValue(true);
+  process_queue_semaphore_.Signal();
+}
+
+
+Task* WorkStealingTaskQueue::TryPop(int worker_index) {
+  const size_t num_deques = deques_.size();
+  for (int priority = 0; priority < kNumPriorities; ++priority) {
+    // Tasks of the own deque are taken from the front, tasks of other deques
+    // are stolen from the back.
+    for (size_t i = 0; i < num_deques; ++i) {
+      WorkerDeque* deque = deques_[(worker_index + i) % num_deques];
+      base::LockGuard<base::Mutex> guard(&deque->lock);
+      std::deque<Task*>& tasks = deque->tasks[priority];
+      if (tasks.empty()) continue;
+      Task* task;
+      if (i == 0) {
+        task = tasks.front();
+        tasks.pop_front();
+      } else {
+        task = tasks.back();
+        tasks.pop_back();
+      }
+      return task;
+    }
+  }
+  return NULL;
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -0,0 +1,67 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+#define V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
+
+#include <deque>
+#include <vector>
+
+#include "include/libplatform/libplatform-export.h"
+#include "include/v8-platform.h"
+#include "src/base/atomic-utils.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+
+namespace v8 {
+
+class Task;
+
+namespace platform {
+
+// A task queue with one deque per worker thread. Tasks are distributed round
+// robin over the deques, so posting threads and workers only contend on a
+// single deque at a time. Workers take tasks from their own deque first and
+// steal from the other deques when it is empty.
+//
+// Short running tasks take precedence over long running tasks, so that
+// latency sensitive tasks do not wait behind long jobs.
+class V8_PLATFORM_EXPORT WorkStealingTaskQueue {
+ public:
+  explicit WorkStealingTaskQueue(int num_workers);
+  ~WorkStealingTaskQueue();
+
+  // Appends a task to the queue. The queue takes ownership of |task|.
+  void Append(Task* task, Platform::ExpectedRuntime expected_runtime);
+
+  // Returns the next task to process for the worker with the given index.
+  // Blocks if no task is available. Returns NULL if the queue is terminated.
+  Task* GetNext(int worker_index);
+
+  // Terminate the queue.
+  void Terminate();
+
+ private:
+  static const int kNumPriorities = 2;
+
+  struct WorkerDeque {
+    base::Mutex lock;
+    std::deque<Task*> tasks[kNumPriorities];
+  };
+
+  Task* TryPop(int worker_index);
+
+  std::vector<WorkerDeque*> deques_;
+  base::Semaphore process_queue_semaphore_;
+  base::AtomicNumber<int> next_deque_;
+  base::AtomicValue<bool> terminated_;
+
+  DISALLOW_COPY_AND_ASSIGN(WorkStealingTaskQueue);
+};
+
+}  // namespace platform
+}  // namespace v8
+
+#endif  // V8_LIBPLATFORM_WORK_STEALING_TASK_QUEUE_H_
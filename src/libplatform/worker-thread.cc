@@ -6,12 +6,25 @@
 
 #include "include/v8-platform.h"
 #include "src/libplatform/task-queue.h"
+#include "src/libplatform/work-stealing-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
 WorkerThread::WorkerThread(TaskQueue* queue)
-    : Thread(Options("V8 WorkerThread")), queue_(queue) {
+    : Thread(Options("V8 WorkerThread")),
+      queue_(queue),
+      work_stealing_queue_(nullptr),
+      index_(0) {
+  Start();
+}
+
+
+WorkerThread::WorkerThread(WorkStealingTaskQueue* queue, int index)
+    : Thread(Options("V8 WorkerThread")),
+      queue_(nullptr),
+      work_stealing_queue_(queue),
+      index_(index) {
   Start();
 }
 
@@ -22,11 +35,19 @@ WorkerThread::~WorkerThread() {
 
 
 void WorkerThread::Run() {
-  while (Task* task = queue_->GetNext()) {
+  while (Task* task = GetNext()) {
     task->Run();
     delete task;
   }
 }
 
+
+Task* WorkerThread::GetNext() {
+  if (work_stealing_queue_ != nullptr) {
+    return work_stealing_queue_->GetNext(index_);
+  }
+  return queue_->GetNext();
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -14,13 +14,18 @@
 
 namespace v8 {
 
+class Task;
+
 namespace platform {
 
 class TaskQueue;
+class WorkStealingTaskQueue;
 
 class V8_PLATFORM_EXPORT WorkerThread : public NON_EXPORTED_BASE(base::Thread) {
  public:
   explicit WorkerThread(TaskQueue* queue);
+  // Creates the worker with the given index of a work stealing queue.
+  WorkerThread(WorkStealingTaskQueue* queue, int index);
   virtual ~WorkerThread();
 
   // Thread implementation.
@@ -29,7 +34,11 @@ class V8_PLATFORM_EXPORT WorkerThread : public NON_EXPORTED_BASE(base::Thread) {
  private:
   friend class QuitTask;
 
+  Task* GetNext();
+
   TaskQueue* queue_;
+  WorkStealingTaskQueue* work_stealing_queue_;
+  int index_;
 
   DISALLOW_COPY_AND_ASSIGN(WorkerThread);
 };
@@ -1630,6 +1630,9 @@ void Logger::LogCompiledFunctions() {
   for (int i = 0; i < compiled_funcs_count; ++i) {
     if (code_objects[i].is_identical_to(isolate_->builtins()->CompileLazy()))
       continue;
+    if (code_objects[i]->IsBytecodeArray()) {
+      SharedFunctionInfo::EnsureSourcePositionsAvailable(sfis[i]);
+    }
     LogExistingFunction(sfis[i], code_objects[i]);
   }
 }
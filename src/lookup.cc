@@ -193,6 +193,35 @@ void LookupIterator::InternalUpdateProtector() {
   } else if (*name_ == heap()->has_instance_symbol()) {
     if (!isolate_->IsHasInstanceLookupChainIntact()) return;
     isolate_->InvalidateHasInstanceProtector();
+  } else if (*name_ == heap()->iterator_symbol()) {
+    if (!isolate_->IsArrayIteratorLookupChainIntact()) return;
+    // Setting the Symbol.iterator property of an Array instance or of
+    // Array.prototype of any realm changes how arrays are iterated.
+    if (holder_->IsJSArray() ||
+        isolate_->IsInAnyContext(*holder_,
+                                 Context::INITIAL_ARRAY_PROTOTYPE_INDEX)) {
+      isolate_->InvalidateArrayIteratorProtector();
+    }
+  } else if (*name_ == heap()->next_string()) {
+    if (!isolate_->IsArrayIteratorLookupChainIntact()) return;
+    // Setting the "next" property of %ArrayIteratorPrototype% of any realm
+    // changes how arrays are iterated.
+    if (isolate_->IsInAnyContext(*holder_,
+                                 Context::ARRAY_ITERATOR_PROTOTYPE_INDEX)) {
+      isolate_->InvalidateArrayIteratorProtector();
+    }
+  } else if (*name_ == heap()->return_string()) {
+    if (!isolate_->IsArrayIteratorLookupChainIntact()) return;
+    // Setting a "return" property anywhere on the prototype chain of array
+    // iterators of any realm makes for-of loops close them on abrupt exits.
+    if (isolate_->IsInAnyContext(*holder_,
+                                 Context::ARRAY_ITERATOR_PROTOTYPE_INDEX) ||
+        isolate_->IsInAnyContext(*holder_,
+                                 Context::INITIAL_ITERATOR_PROTOTYPE_INDEX) ||
+        isolate_->IsInAnyContext(*holder_,
+                                 Context::INITIAL_OBJECT_PROTOTYPE_INDEX)) {
+      isolate_->InvalidateArrayIteratorProtector();
+    }
   }
 }
 
@@ -256,7 +256,10 @@ class LookupIterator final BASE_EMBEDDED {
     if (*name_ == heap()->is_concat_spreadable_symbol() ||
         *name_ == heap()->constructor_string() ||
         *name_ == heap()->species_symbol() ||
-        *name_ == heap()->has_instance_symbol()) {
+        *name_ == heap()->has_instance_symbol() ||
+        *name_ == heap()->iterator_symbol() ||
+        *name_ == heap()->next_string() ||
+        *name_ == heap()->return_string()) {
       InternalUpdateProtector();
     }
   }
@@ -367,8 +367,8 @@ MaybeHandle<String> FormatEvalOrigin(Isolate* isolate, Handle<Script> script) {
         builder.AppendString(Handle<String>::cast(name_obj));
 
         Script::PositionInfo info;
-        if (eval_from_script->GetPositionInfo(script->GetEvalPosition(), &info,
-                                              Script::NO_OFFSET)) {
+        if (eval_from_script->GetPositionInfo(
+                Script::GetEvalPosition(script), &info, Script::NO_OFFSET)) {
           builder.AppendCString(":");
 
           Handle<String> str = isolate->factory()->NumberToString(
@@ -608,7 +608,13 @@ MaybeHandle<String> JSStackFrame::ToString() {
   RETURN_RESULT(isolate_, builder.Finish(), String);
 }
 
-int JSStackFrame::GetPosition() const { return code_->SourcePosition(offset_); }
+int JSStackFrame::GetPosition() const {
+  if (code_->IsBytecodeArray()) {
+    Handle<SharedFunctionInfo> shared(function_->shared(), isolate_);
+    SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
+  }
+  return code_->SourcePosition(offset_);
+}
 
 bool JSStackFrame::HasScript() const {
   return function_->shared()->script()->IsScript();
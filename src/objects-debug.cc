@@ -570,11 +570,15 @@ void SharedFunctionInfo::SharedFunctionInfoVerify() {
   VerifyObjectField(kCodeOffset);
   VerifyObjectField(kOptimizedCodeMapOffset);
   VerifyObjectField(kFeedbackMetadataOffset);
+  CHECK(preparsed_scope_data()->IsUndefined(GetIsolate()) ||
+        preparsed_scope_data()->IsFixedArray());
+  VerifyObjectField(kPreParsedScopeDataOffset);
   VerifyObjectField(kScopeInfoOffset);
   VerifyObjectField(kOuterScopeInfoOffset);
   VerifyObjectField(kInstanceClassNameOffset);
   CHECK(function_data()->IsUndefined(GetIsolate()) || IsApiFunction() ||
-        HasBytecodeArray() || HasAsmWasmData());
+        HasBytecodeArray() || HasAsmWasmData() ||
+        HasLazyDeserializationData());
   VerifyObjectField(kFunctionDataOffset);
   VerifyObjectField(kScriptOffset);
   VerifyObjectField(kDebugInfoOffset);
@@ -1037,6 +1041,9 @@ void CallHandlerInfo::CallHandlerInfoVerify() {
   CHECK(IsCallHandlerInfo());
   VerifyPointer(callback());
   VerifyPointer(data());
+  VerifyPointer(fast_handler_program());
+  VerifyPointer(fast_call_target());
+  VerifyPointer(fast_call_signature());
 }
 
 
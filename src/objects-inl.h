@@ -1435,6 +1435,16 @@ void HeapObject::synchronized_set_map_word(MapWord map_word) {
 }
 
 
+bool HeapObject::release_compare_and_swap_map_word(MapWord old_map_word,
+                                                   MapWord new_map_word) {
+  base::AtomicWord result = base::Release_CompareAndSwap(
+      reinterpret_cast<base::AtomicWord*>(FIELD_ADDR(this, kMapOffset)),
+      static_cast<base::AtomicWord>(old_map_word.value_),
+      static_cast<base::AtomicWord>(new_map_word.value_));
+  return result == static_cast<base::AtomicWord>(old_map_word.value_);
+}
+
+
 int HeapObject::Size() {
   return SizeFromMap(map());
 }
@@ -4166,6 +4176,17 @@ void BytecodeArray::set_osr_loop_nesting_level(int depth) {
   WRITE_INT8_FIELD(this, kOSRNestingLevelOffset, depth);
 }
 
+BytecodeArray::Age BytecodeArray::bytecode_age() const {
+  return static_cast<Age>(READ_INT8_FIELD(this, kBytecodeAgeOffset));
+}
+
+void BytecodeArray::set_bytecode_age(BytecodeArray::Age age) {
+  DCHECK_GE(age, kFirstBytecodeAge);
+  DCHECK_LE(age, kLastBytecodeAge);
+  STATIC_ASSERT(kLastBytecodeAge <= kMaxInt8);
+  WRITE_INT8_FIELD(this, kBytecodeAgeOffset, static_cast<int8_t>(age));
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
@@ -4175,8 +4196,28 @@ int BytecodeArray::parameter_count() const {
 
 ACCESSORS(BytecodeArray, constant_pool, FixedArray, kConstantPoolOffset)
 ACCESSORS(BytecodeArray, handler_table, FixedArray, kHandlerTableOffset)
-ACCESSORS(BytecodeArray, source_position_table, ByteArray,
-          kSourcePositionTableOffset)
+
+ByteArray* BytecodeArray::source_position_table() const {
+  Object* table = READ_FIELD(this, kSourcePositionTableOffset);
+  if (table->IsByteArray()) return ByteArray::cast(table);
+  DCHECK(table->IsUndefined(GetIsolate()));
+  return GetHeap()->empty_byte_array();
+}
+
+void BytecodeArray::set_source_position_table(ByteArray* value,
+                                              WriteBarrierMode mode) {
+  WRITE_FIELD(this, kSourcePositionTableOffset, value);
+  CONDITIONAL_WRITE_BARRIER(GetHeap(), this, kSourcePositionTableOffset, value,
+                            mode);
+}
+
+bool BytecodeArray::HasSourcePositionTable() {
+  return READ_FIELD(this, kSourcePositionTableOffset)->IsByteArray();
+}
+
+void BytecodeArray::ClearSourcePositionTable() {
+  WRITE_FIELD(this, kSourcePositionTableOffset, GetHeap()->undefined_value());
+}
 
 Address BytecodeArray::GetFirstBytecodeAddress() {
   return reinterpret_cast<Address>(this) - kHeapObjectTag + kHeaderSize;
@@ -5152,6 +5193,14 @@ void Code::set_builtin_index(int index) {
   WRITE_INT_FIELD(this, kBuiltinIndexOffset, index);
 }
 
+int Code::trap_handler_index() {
+  return READ_INT_FIELD(this, kTrapHandlerIndexOffset);
+}
+
+void Code::set_trap_handler_index(int index) {
+  WRITE_INT_FIELD(this, kTrapHandlerIndexOffset, index);
+}
+
 
 unsigned Code::stack_slots() {
   DCHECK(is_crankshafted());
@@ -5780,6 +5829,11 @@ BOOL_ACCESSORS(InterceptorInfo, flags, non_masking, kNonMasking)
 ACCESSORS(CallHandlerInfo, callback, Object, kCallbackOffset)
 ACCESSORS(CallHandlerInfo, data, Object, kDataOffset)
 ACCESSORS(CallHandlerInfo, fast_handler, Object, kFastHandlerOffset)
+ACCESSORS(CallHandlerInfo, fast_handler_program, Object,
+          kFastHandlerProgramOffset)
+ACCESSORS(CallHandlerInfo, fast_call_target, Object, kFastCallTargetOffset)
+ACCESSORS(CallHandlerInfo, fast_call_signature, Object,
+          kFastCallSignatureOffset)
 
 ACCESSORS(TemplateInfo, tag, Object, kTagOffset)
 ACCESSORS(TemplateInfo, serial_number, Object, kSerialNumberOffset)
@@ -5947,6 +6001,8 @@ ACCESSORS(SharedFunctionInfo, optimized_code_map, FixedArray,
 ACCESSORS(SharedFunctionInfo, construct_stub, Code, kConstructStubOffset)
 ACCESSORS(SharedFunctionInfo, feedback_metadata, TypeFeedbackMetadata,
           kFeedbackMetadataOffset)
+ACCESSORS(SharedFunctionInfo, preparsed_scope_data, Object,
+          kPreParsedScopeDataOffset)
 #if TRACE_MAPS
 SMI_ACCESSORS(SharedFunctionInfo, unique_id, kUniqueIdOffset)
 #endif
@@ -6317,6 +6373,21 @@ void SharedFunctionInfo::ClearAsmWasmData() {
   set_function_data(GetHeap()->undefined_value());
 }
 
+bool SharedFunctionInfo::HasLazyDeserializationData() {
+  return function_data()->IsTuple3();
+}
+
+Tuple3* SharedFunctionInfo::lazy_deserialization_data() {
+  DCHECK(HasLazyDeserializationData());
+  return Tuple3::cast(function_data());
+}
+
+void SharedFunctionInfo::ClearLazyDeserializationData() {
+  DCHECK(function_data()->IsUndefined(GetIsolate()) ||
+         HasLazyDeserializationData());
+  set_function_data(GetHeap()->undefined_value());
+}
+
 bool SharedFunctionInfo::HasBuiltinFunctionId() {
   return function_identifier()->IsSmi();
 }
@@ -6387,6 +6458,16 @@ void SharedFunctionInfo::set_opt_reenable_tries(int tries) {
 }
 
 
+bool SharedFunctionInfo::optimize_early() {
+  return OptimizeEarlyBit::decode(counters());
+}
+
+
+void SharedFunctionInfo::set_optimize_early(bool value) {
+  set_counters(OptimizeEarlyBit::update(counters(), value));
+}
+
+
 int SharedFunctionInfo::opt_count() {
   return OptCountBits::decode(opt_count_and_bailout_reason());
 }
@@ -6738,6 +6819,8 @@ ACCESSORS(Code, handler_table, FixedArray, kHandlerTableOffset)
 ACCESSORS(Code, deoptimization_data, FixedArray, kDeoptimizationDataOffset)
 ACCESSORS(Code, source_position_table, ByteArray, kSourcePositionTableOffset)
 ACCESSORS(Code, raw_type_feedback_info, Object, kTypeFeedbackInfoOffset)
+ACCESSORS(Code, protected_instructions, FixedArray,
+          kProtectedInstructionsOffset)
 ACCESSORS(Code, next_code_link, Object, kNextCodeLinkOffset)
 
 void Code::WipeOutHeader() {
@@ -6749,6 +6832,7 @@ void Code::WipeOutHeader() {
   if (!READ_FIELD(this, kTypeFeedbackInfoOffset)->IsSmi()) {
     WRITE_FIELD(this, kTypeFeedbackInfoOffset, NULL);
   }
+  WRITE_FIELD(this, kProtectedInstructionsOffset, NULL);
   WRITE_FIELD(this, kNextCodeLinkOffset, NULL);
   WRITE_FIELD(this, kGCMetadataOffset, NULL);
 }
@@ -6941,6 +7025,14 @@ void JSArrayBuffer::set_is_shared(bool value) {
   set_bit_field(IsShared::update(bit_field(), value));
 }
 
+bool JSArrayBuffer::has_guard_region() {
+  return HasGuardRegion::decode(bit_field());
+}
+
+void JSArrayBuffer::set_has_guard_region(bool value) {
+  set_bit_field(HasGuardRegion::update(bit_field(), value));
+}
+
 
 Object* JSArrayBufferView::byte_offset() const {
   if (WasNeutered()) return Smi::kZero;
@@ -7327,10 +7419,14 @@ inline void StringHasher::AddCharacters(const Char* chars, int length) {
       }
     }
   }
+  // Keep the running hash in a local, since the stores to the member would
+  // otherwise have to be interleaved with reloads of {chars}, which may alias.
+  DCHECK(i == length || !is_array_index_);
+  uint32_t running_hash = raw_running_hash_;
   for (; i < length; i++) {
-    DCHECK(!is_array_index_);
-    AddCharacter(chars[i]);
+    running_hash = AddCharacterCore(running_hash, chars[i]);
   }
+  raw_running_hash_ = running_hash;
 }
 
 
@@ -1037,6 +1037,7 @@ void SharedFunctionInfo::SharedFunctionInfoPrint(std::ostream& os) {  // NOLINT
   os << "\n - optimized_code_map = " << Brief(optimized_code_map());
   os << "\n - feedback_metadata = ";
   feedback_metadata()->TypeFeedbackMetadataPrint(os);
+  os << "\n - preparsed_scope_data = " << Brief(preparsed_scope_data());
   if (HasBytecodeArray()) {
     os << "\n - bytecode_array = " << bytecode_array();
   }
@@ -1258,6 +1259,9 @@ void CallHandlerInfo::CallHandlerInfoPrint(std::ostream& os) {  // NOLINT
   HeapObject::PrintHeader(os, "CallHandlerInfo");
   os << "\n - callback: " << Brief(callback());
   os << "\n - data: " << Brief(data());
+  os << "\n - fast_handler_program: " << Brief(fast_handler_program());
+  os << "\n - fast_call_target: " << Brief(fast_call_target());
+  os << "\n - fast_call_signature: " << Brief(fast_call_signature());
   os << "\n";
 }
 
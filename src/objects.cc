@@ -60,6 +60,7 @@
 #include "src/string-builder.h"
 #include "src/string-search.h"
 #include "src/string-stream.h"
+#include "src/trap-handler/trap-handler.h"
 #include "src/utils.h"
 #include "src/wasm/wasm-module.h"
 #include "src/zone/zone.h"
@@ -1006,6 +1007,30 @@ MaybeHandle<Object> Object::GetProperty(LookupIterator* it) {
 }
 
 
+namespace {
+
+// The invariants of the proxy traps only constrain non-configurable own
+// properties of the target. Returns true if {target} is known to have no such
+// property {name}, without running side effects. This avoids materializing the
+// full property descriptor of the target after every trap call in the common
+// case of ordinary targets with configurable properties.
+bool ProxyTargetHasNoNonConfigurableProperty(Handle<JSReceiver> target,
+                                             Handle<Name> name) {
+  if (!target->IsJSObject()) return false;
+  Map* map = target->map();
+  if (map->is_access_check_needed() || map->has_named_interceptor() ||
+      map->has_indexed_interceptor()) {
+    return false;
+  }
+  Maybe<PropertyAttributes> attributes =
+      JSReceiver::GetOwnPropertyAttributes(target, name);
+  DCHECK(attributes.IsJust());
+  return attributes.FromJust() == ABSENT ||
+         (attributes.FromJust() & DONT_DELETE) == 0;
+}
+
+}  // namespace
+
 // static
 MaybeHandle<Object> JSProxy::GetProperty(Isolate* isolate,
                                          Handle<JSProxy> proxy,
@@ -1055,6 +1080,9 @@ MaybeHandle<Object> JSProxy::GetProperty(Isolate* isolate,
   ASSIGN_RETURN_ON_EXCEPTION(
       isolate, trap_result,
       Execution::Call(isolate, trap, handler, arraysize(args), args), Object);
+  if (ProxyTargetHasNoNonConfigurableProperty(target, name)) {
+    return trap_result;
+  }
   // 9. Let targetDesc be ? target.[[GetOwnProperty]](P).
   PropertyDescriptor target_desc;
   Maybe<bool> target_found =
@@ -2159,6 +2187,78 @@ void Smi::SmiPrint(std::ostream& os) const {  // NOLINT
   os << value();
 }
 
+// static
+CompareResult Smi::LexicographicCompare(Smi* x, Smi* y) {
+  int x_value = x->value();
+  int y_value = y->value();
+
+  // If the integers are equal so are the string representations.
+  if (x_value == y_value) return EQUAL;
+
+  // If one of the integers is zero the normal integer order is the
+  // same as the lexicographic order of the string representations.
+  if (x_value == 0 || y_value == 0)
+    return x_value < y_value ? LESS : GREATER;
+
+  // If only one of the integers is negative the negative number is
+  // smallest because the char code of '-' is less than the char code
+  // of any digit.  Otherwise, we make both values positive.
+
+  // Use unsigned values otherwise the logic is incorrect for -MIN_INT on
+  // architectures using 32-bit Smis.
+  uint32_t x_scaled = x_value;
+  uint32_t y_scaled = y_value;
+  if (x_value < 0 || y_value < 0) {
+    if (y_value >= 0) return LESS;
+    if (x_value >= 0) return GREATER;
+    x_scaled = -x_value;
+    y_scaled = -y_value;
+  }
+
+  static const uint32_t kPowersOf10[] = {
+      1,                 10,                100,         1000,
+      10 * 1000,         100 * 1000,        1000 * 1000, 10 * 1000 * 1000,
+      100 * 1000 * 1000, 1000 * 1000 * 1000};
+
+  // If the integers have the same number of decimal digits they can be
+  // compared directly as the numeric order is the same as the
+  // lexicographic order.  If one integer has fewer digits, it is scaled
+  // by some power of 10 to have the same number of digits as the longer
+  // integer.  If the scaled integers are equal it means the shorter
+  // integer comes first in the lexicographic order.
+
+  // From http://graphics.stanford.edu/~seander/bithacks.html#IntegerLog10
+  int x_log2 = 31 - base::bits::CountLeadingZeros32(x_scaled);
+  int x_log10 = ((x_log2 + 1) * 1233) >> 12;
+  x_log10 -= x_scaled < kPowersOf10[x_log10];
+
+  int y_log2 = 31 - base::bits::CountLeadingZeros32(y_scaled);
+  int y_log10 = ((y_log2 + 1) * 1233) >> 12;
+  y_log10 -= y_scaled < kPowersOf10[y_log10];
+
+  CompareResult tie = EQUAL;
+
+  if (x_log10 < y_log10) {
+    // X has fewer digits.  We would like to simply scale up X but that
+    // might overflow, e.g when comparing 9 with 1_000_000_000, 9 would
+    // be scaled up to 9_000_000_000. So we scale up by the next
+    // smallest power and scale down Y to drop one digit. It is OK to
+    // drop one digit from the longer integer since the final digit is
+    // past the length of the shorter integer.
+    x_scaled *= kPowersOf10[y_log10 - x_log10 - 1];
+    y_scaled /= 10;
+    tie = LESS;
+  } else if (y_log10 < x_log10) {
+    y_scaled *= kPowersOf10[x_log10 - y_log10 - 1];
+    x_scaled /= 10;
+    tie = GREATER;
+  }
+
+  if (x_scaled < y_scaled) return LESS;
+  if (x_scaled > y_scaled) return GREATER;
+  return tie;
+}
+
 
 // Should a word be prefixed by 'a' or 'an' in order to read naturally in
 // English?  Returns false for non-ASCII or words that don't start with
@@ -5355,7 +5455,11 @@ Maybe<bool> JSProxy::HasProperty(Isolate* isolate, Handle<JSProxy> proxy,
       Nothing<bool>());
   bool boolean_trap_result = trap_result_obj->BooleanValue();
   // 9. If booleanTrapResult is false, then:
-  if (!boolean_trap_result) {
+  // (The checks below can only fail for a non-configurable property or a
+  // non-extensible target.)
+  if (!boolean_trap_result &&
+      !(ProxyTargetHasNoNonConfigurableProperty(target, name) &&
+        target->map()->is_extensible())) {
     // 9a. Let targetDesc be ? target.[[GetOwnProperty]](P).
     PropertyDescriptor target_desc;
     Maybe<bool> target_found = JSReceiver::GetOwnPropertyDescriptor(
@@ -5428,6 +5532,9 @@ Maybe<bool> JSProxy::SetProperty(Handle<JSProxy> proxy, Handle<Name> name,
   }
 
   // Enforce the invariant.
+  if (ProxyTargetHasNoNonConfigurableProperty(target, name)) {
+    return Just(true);
+  }
   PropertyDescriptor target_desc;
   Maybe<bool> owned =
       JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
@@ -5494,6 +5601,9 @@ Maybe<bool> JSProxy::DeletePropertyOrElement(Handle<JSProxy> proxy,
   }
 
   // Enforce the invariant.
+  if (ProxyTargetHasNoNonConfigurableProperty(target, name)) {
+    return Just(true);
+  }
   PropertyDescriptor target_desc;
   Maybe<bool> owned =
       JSReceiver::GetOwnPropertyDescriptor(isolate, target, name, &target_desc);
@@ -10567,14 +10677,23 @@ int HandlerTable::LookupRange(int pc_offset, int* data_out,
 }
 
 
-// TODO(turbofan): Make sure table is sorted and use binary search.
 int HandlerTable::LookupReturn(int pc_offset) {
-  for (int i = 0; i < length(); i += kReturnEntrySize) {
+  // The table is sorted by return address offset, so use binary search.
+  int low = 0;
+  int high = length() / kReturnEntrySize - 1;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    int i = mid * kReturnEntrySize;
     int return_offset = Smi::cast(get(i + kReturnOffsetIndex))->value();
-    int handler_field = Smi::cast(get(i + kReturnHandlerIndex))->value();
     if (pc_offset == return_offset) {
+      int handler_field = Smi::cast(get(i + kReturnHandlerIndex))->value();
       return HandlerOffsetField::decode(handler_field);
     }
+    if (pc_offset < return_offset) {
+      high = mid - 1;
+    } else {
+      low = mid + 1;
+    }
   }
   return -1;
 }
@@ -12170,9 +12289,16 @@ bool JSFunction::Inlines(SharedFunctionInfo* candidate) {
   DisallowHeapAllocation no_gc;
   if (shared() == candidate) return true;
   if (code()->kind() != Code::OPTIMIZED_FUNCTION) return false;
+  return code()->Inlines(candidate);
+}
+
+bool Code::Inlines(SharedFunctionInfo* candidate) {
+  DisallowHeapAllocation no_gc;
+  DCHECK_EQ(OPTIMIZED_FUNCTION, kind());
   DeoptimizationInputData* const data =
-      DeoptimizationInputData::cast(code()->deoptimization_data());
+      DeoptimizationInputData::cast(deoptimization_data());
   if (data->length() == 0) return false;
+  if (data->SharedFunctionInfo() == candidate) return true;
   FixedArray* const literals = data->LiteralArray();
   int const inlined_count = data->InlinedFunctionCount()->value();
   for (int i = 0; i < inlined_count; ++i) {
@@ -13288,22 +13414,24 @@ void Script::SetEvalOrigin(Handle<Script> script,
   script->set_eval_from_position(eval_position);
 }
 
-int Script::GetEvalPosition() {
-  DisallowHeapAllocation no_gc;
-  DCHECK(compilation_type() == Script::COMPILATION_TYPE_EVAL);
-  int position = eval_from_position();
+// static
+int Script::GetEvalPosition(Handle<Script> script) {
+  DCHECK(script->compilation_type() == Script::COMPILATION_TYPE_EVAL);
+  int position = script->eval_from_position();
   if (position < 0) {
     // Due to laziness, the position may not have been translated from code
     // offset yet, which would be encoded as negative integer. In that case,
     // translate and set the position.
-    if (eval_from_shared()->IsUndefined(GetIsolate())) {
+    if (script->eval_from_shared()->IsUndefined(script->GetIsolate())) {
       position = 0;
     } else {
-      SharedFunctionInfo* shared = SharedFunctionInfo::cast(eval_from_shared());
+      Handle<SharedFunctionInfo> shared(
+          SharedFunctionInfo::cast(script->eval_from_shared()));
+      SharedFunctionInfo::EnsureSourcePositionsAvailable(shared);
       position = shared->abstract_code()->SourcePosition(-position);
     }
     DCHECK(position >= 0);
-    set_eval_from_position(position);
+    script->set_eval_from_position(position);
   }
   return position;
 }
@@ -13769,6 +13897,15 @@ void SharedFunctionInfo::EnableDeoptimizationSupport(Code* recompiled) {
 }
 
 
+// static
+void SharedFunctionInfo::EnsureSourcePositionsAvailable(
+    Handle<SharedFunctionInfo> shared_info) {
+  if (!shared_info->HasBytecodeArray()) return;
+  if (shared_info->bytecode_array()->HasSourcePositionTable()) return;
+  Compiler::CollectSourcePositions(shared_info);
+}
+
+
 void SharedFunctionInfo::DisableOptimization(BailoutReason reason) {
   // Disable optimization for the shared function info and mark the
   // code as non-optimizable. The marker on the shared function info
@@ -13846,6 +13983,7 @@ void SharedFunctionInfo::InitFromFunctionLiteral(
   shared_info->set_needs_home_object(lit->scope()->NeedsHomeObject());
   shared_info->set_asm_function(lit->scope()->asm_function());
   shared_info->set_requires_class_field_init(lit->requires_class_field_init());
+  shared_info->set_optimize_early(lit->should_optimize_early());
   shared_info->set_is_class_field_initializer(
       lit->is_class_field_initializer());
   SetExpectedNofPropertiesFromEstimate(shared_info, lit);
@@ -13934,6 +14072,23 @@ void SharedFunctionInfo::ClearCodeFromOptimizedCodeMap() {
   }
 }
 
+void SharedFunctionInfo::ClearCodeInliningFromOptimizedCodeMap(
+    SharedFunctionInfo* inlined) {
+  if (OptimizedCodeMapIsCleared()) return;
+  FixedArray* optimized_code_map = this->optimized_code_map();
+  int length = optimized_code_map->length();
+  WeakCell* empty_weak_cell = GetHeap()->empty_weak_cell();
+  for (int i = kEntriesStart; i < length; i += kEntryLength) {
+    WeakCell* cell =
+        WeakCell::cast(optimized_code_map->get(i + kCachedCodeOffset));
+    if (cell->cleared()) continue;
+    if (Code::cast(cell->value())->Inlines(inlined)) {
+      optimized_code_map->set(i + kCachedCodeOffset, empty_weak_cell,
+                              SKIP_WRITE_BARRIER);
+    }
+  }
+}
+
 CodeAndLiterals SharedFunctionInfo::SearchOptimizedCodeMap(
     Context* native_context, BailoutId osr_ast_id) {
   CodeAndLiterals result = {nullptr, nullptr};
@@ -14057,6 +14212,12 @@ void Code::InvalidateEmbeddedObjects() {
 
 
 void Code::Relocate(intptr_t delta) {
+  if (trap_handler::UseTrapHandler() && kind() == WASM_FUNCTION) {
+    const int index = trap_handler_index();
+    if (index >= 0) {
+      trap_handler::UpdateHandlerDataCodePointer(index, instruction_start());
+    }
+  }
   for (RelocIterator it(this, RelocInfo::kApplyMask); !it.done(); it.next()) {
     it.rinfo()->apply(delta);
   }
@@ -15024,6 +15185,19 @@ void BytecodeArray::CopyBytecodesTo(BytecodeArray* to) {
             from->length());
 }
 
+void BytecodeArray::MakeOlder() {
+  Age age = bytecode_age();
+  if (age < kLastBytecodeAge) {
+    set_bytecode_age(static_cast<Age>(age + 1));
+  }
+  DCHECK(bytecode_age() >= kFirstBytecodeAge);
+  DCHECK(bytecode_age() <= kLastBytecodeAge);
+}
+
+bool BytecodeArray::IsOld() const {
+  return bytecode_age() >= kIsOldBytecodeAge;
+}
+
 int BytecodeArray::LookupRangeInHandlerTable(
     int code_offset, int* data, HandlerTable::CatchPrediction* prediction) {
   HandlerTable* table = HandlerTable::cast(handler_table());
@@ -15528,6 +15702,7 @@ Maybe<bool> JSObject::SetPrototype(Handle<JSObject> object,
   // Set the new prototype of the object.
 
   isolate->UpdateArrayProtectorOnSetPrototype(real_receiver);
+  isolate->UpdateArrayIteratorProtectorOnSetPrototype(real_receiver);
 
   PrototypeOptimizationMode mode =
       from_javascript ? REGULAR_PROTOTYPE : FAST_PROTOTYPE;
@@ -17841,6 +18016,22 @@ void CompilationCacheTable::Remove(Object* value) {
   return;
 }
 
+
+void CompilationCacheTable::RemoveOuter(SharedFunctionInfo* shared) {
+  DisallowHeapAllocation no_allocation;
+  Object* the_hole_value = GetHeap()->the_hole_value();
+  for (int entry = 0, size = Capacity(); entry < size; entry++) {
+    int entry_index = EntryToIndex(entry);
+    Object* key = get(entry_index);
+    // See StringSharedKey::AsHandle for the layout of the key.
+    if (key->IsFixedArray() && FixedArray::cast(key)->get(0) == shared) {
+      NoWriteBarrierSet(this, entry_index, the_hole_value);
+      NoWriteBarrierSet(this, entry_index + 1, the_hole_value);
+      ElementRemoved();
+    }
+  }
+}
+
 template <typename Derived, typename Shape, typename Key>
 Handle<Derived> Dictionary<Derived, Shape, Key>::New(
     Isolate* isolate, int at_least_space_for, PretenureFlag pretenure,
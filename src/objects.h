@@ -846,6 +846,22 @@ enum FixedArraySubInstanceType {
       LAST_FIXED_ARRAY_SUB_TYPE = WEAK_NEW_SPACE_OBJECT_TO_CODE_SUB_TYPE
 };
 
+// Disjoint classes of maps for the object statistics, to tell what a large
+// map space consists of. A map is in the first class that applies.
+#define MAP_SUB_INSTANCE_TYPE_LIST(V) \
+  V(DEPRECATED_MAP_SUB_TYPE)          \
+  V(PROTOTYPE_MAP_SUB_TYPE)           \
+  V(DICTIONARY_MAP_SUB_TYPE)          \
+  V(STABLE_MAP_SUB_TYPE)              \
+  V(UNSTABLE_MAP_SUB_TYPE)
+
+enum MapSubInstanceType {
+#define DEFINE_MAP_SUB_INSTANCE_TYPE(name) name,
+  MAP_SUB_INSTANCE_TYPE_LIST(DEFINE_MAP_SUB_INSTANCE_TYPE)
+#undef DEFINE_MAP_SUB_INSTANCE_TYPE
+      LAST_MAP_SUB_TYPE = UNSTABLE_MAP_SUB_TYPE
+};
+
 
 // TODO(bmeurer): Remove this in favor of the ComparisonResult below.
 enum CompareResult {
@@ -1525,6 +1541,10 @@ class Smi: public Object {
 
   DECLARE_CAST(Smi)
 
+  // Compares two Smis as if they were converted to strings and then compared
+  // lexicographically, which is the default order of Array.prototype.sort.
+  static CompareResult LexicographicCompare(Smi* x, Smi* y);
+
   // Dispatched behavior.
   void SmiPrint(std::ostream& os) const;  // NOLINT
   DECLARE_VERIFIER(Smi)
@@ -1608,6 +1628,11 @@ class HeapObject: public Object {
   inline void synchronized_set_map_no_write_barrier(Map* value);
   inline void synchronized_set_map_word(MapWord map_word);
 
+  // Replaces the map word with {new_map_word} iff it is still {old_map_word},
+  // using a compare-and-swap with release semantics. Returns true on success.
+  inline bool release_compare_and_swap_map_word(MapWord old_map_word,
+                                                MapWord new_map_word);
+
   // During garbage collection, the map word of a heap object does not
   // necessarily contain a map pointer.
   inline MapWord map_word() const;
@@ -2536,6 +2561,10 @@ class JSObject: public JSReceiver {
   // not to arbitrary other JSObject maps.
   static const int kInitialGlobalObjectUnusedPropertiesCount = 4;
 
+  // The number of in-object properties that maps for Object.create with a
+  // given prototype start with, until in-object slack tracking shrinks them.
+  static const int kInitialObjectCreateInObjectProperties = 16;
+
   static const int kMaxInstanceSize = 255 * kPointerSize;
   // When extending the backing storage for property values, we increase
   // its size by more than the 1 entry necessary, so sequentially adding fields
@@ -4707,7 +4736,8 @@ class HandlerTable : public FixedArray {
   // Lookup handler in a table based on ranges.
   int LookupRange(int pc_offset, int* data, CatchPrediction* prediction);
 
-  // Lookup handler in a table based on return addresses.
+  // Lookup handler in a table based on return addresses. The entries must be
+  // sorted by return address offset.
   int LookupReturn(int pc_offset);
 
   // Returns the number of entries in the table.
@@ -4802,6 +4832,18 @@ class ByteArray: public FixedArrayBase {
 // BytecodeArray represents a sequence of interpreter bytecodes.
 class BytecodeArray : public FixedArrayBase {
  public:
+#define DECLARE_BYTECODE_AGE_ENUM(X) k##X##BytecodeAge,
+  enum Age {
+    kNoAgeBytecodeAge = 0,
+    CODE_AGE_LIST(DECLARE_BYTECODE_AGE_ENUM)
+    kAfterLastBytecodeAge,
+    kFirstBytecodeAge = kNoAgeBytecodeAge,
+    kLastBytecodeAge = kAfterLastBytecodeAge - 1,
+    kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
+    kIsOldBytecodeAge = kSexagenarianBytecodeAge
+  };
+#undef DECLARE_BYTECODE_AGE_ENUM
+
   static int SizeFor(int length) {
     return OBJECT_POINTER_ALIGN(kHeaderSize + length);
   }
@@ -4832,6 +4874,11 @@ class BytecodeArray : public FixedArrayBase {
   inline int osr_loop_nesting_level() const;
   inline void set_osr_loop_nesting_level(int depth);
 
+  // Accessors for bytecode's code age. The age is reset by the interpreter
+  // entry trampoline whenever the function is entered.
+  inline Age bytecode_age() const;
+  inline void set_bytecode_age(Age age);
+
   // Accessors for the constant pool.
   DECL_ACCESSORS(constant_pool, FixedArray)
 
@@ -4839,8 +4886,12 @@ class BytecodeArray : public FixedArrayBase {
   DECL_ACCESSORS(handler_table, FixedArray)
 
   // Accessors for source position table containing mappings between byte code
-  // offset and source position.
+  // offset and source position. The table is undefined while the source
+  // positions have not been collected (see --lazy-source-positions), in which
+  // case the getter returns the empty byte array.
   DECL_ACCESSORS(source_position_table, ByteArray)
+  inline bool HasSourcePositionTable();
+  inline void ClearSourcePositionTable();
 
   DECLARE_CAST(BytecodeArray)
 
@@ -4863,6 +4914,10 @@ class BytecodeArray : public FixedArrayBase {
 
   void CopyBytecodesTo(BytecodeArray* to);
 
+  // Bytecode aging. Old bytecode can be flushed by the GC.
+  void MakeOlder();
+  bool IsOld() const;
+
   int LookupRangeInHandlerTable(int code_offset, int* data,
                                 HandlerTable::CatchPrediction* prediction);
 
@@ -4875,7 +4930,8 @@ class BytecodeArray : public FixedArrayBase {
   static const int kParameterSizeOffset = kFrameSizeOffset + kIntSize;
   static const int kInterruptBudgetOffset = kParameterSizeOffset + kIntSize;
   static const int kOSRNestingLevelOffset = kInterruptBudgetOffset + kIntSize;
-  static const int kHeaderSize = kOSRNestingLevelOffset + kCharSize;
+  static const int kBytecodeAgeOffset = kOSRNestingLevelOffset + kCharSize;
+  static const int kHeaderSize = kBytecodeAgeOffset + kCharSize;
 
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
@@ -5267,6 +5323,10 @@ class Code: public HeapObject {
   // [deoptimization_data]: Array containing data for deopt.
   DECL_ACCESSORS(deoptimization_data, FixedArray)
 
+  // Tells whether this optimized code is for, or inlines, the given shared
+  // function info.
+  bool Inlines(SharedFunctionInfo* candidate);
+
   // [source_position_table]: ByteArray for the source positions table.
   DECL_ACCESSORS(source_position_table, ByteArray)
 
@@ -5281,6 +5341,11 @@ class Code: public HeapObject {
   inline uint32_t stub_key();
   inline void set_stub_key(uint32_t key);
 
+  // [protected_instructions]: For WASM_FUNCTION kind, pairs of instruction and
+  // landing pad offsets of the memory accesses which are bounds checked by the
+  // trap handler (see src/trap-handler/trap-handler.h).
+  DECL_ACCESSORS(protected_instructions, FixedArray)
+
   // [next_code_link]: Link for lists of optimized or deoptimized code.
   // Note that storage for this field is overlapped with typefeedback_info.
   DECL_ACCESSORS(next_code_link, Object)
@@ -5394,6 +5459,11 @@ class Code: public HeapObject {
   inline int builtin_index();
   inline void set_builtin_index(int id);
 
+  // [trap_handler_index]: For WASM_FUNCTION kind, the index under which the
+  // protected instructions are registered with the trap handler, or -1.
+  inline int trap_handler_index();
+  inline void set_trap_handler_index(int index);
+
   // [stack_slots]: For kind OPTIMIZED_FUNCTION, the number of stack slots
   // reserved in the code prologue.
   inline unsigned stack_slots();
@@ -5639,7 +5709,10 @@ class Code: public HeapObject {
   // For FUNCTION kind, we store the type feedback info here.
   static const int kTypeFeedbackInfoOffset =
       kSourcePositionTableOffset + kPointerSize;
-  static const int kNextCodeLinkOffset = kTypeFeedbackInfoOffset + kPointerSize;
+  static const int kProtectedInstructionsOffset =
+      kTypeFeedbackInfoOffset + kPointerSize;
+  static const int kNextCodeLinkOffset =
+      kProtectedInstructionsOffset + kPointerSize;
   static const int kGCMetadataOffset = kNextCodeLinkOffset + kPointerSize;
   static const int kInstructionSizeOffset = kGCMetadataOffset + kPointerSize;
   static const int kICAgeOffset = kInstructionSizeOffset + kIntSize;
@@ -5652,7 +5725,8 @@ class Code: public HeapObject {
   static const int kConstantPoolOffset = kPrologueOffset + kIntSize;
   static const int kBuiltinIndexOffset =
       kConstantPoolOffset + kConstantPoolSize;
-  static const int kHeaderPaddingStart = kBuiltinIndexOffset + kIntSize;
+  static const int kTrapHandlerIndexOffset = kBuiltinIndexOffset + kIntSize;
+  static const int kHeaderPaddingStart = kTrapHandlerIndexOffset + kIntSize;
 
   // Add padding to align the instruction start following right after
   // the Code object header.
@@ -6983,7 +7057,7 @@ class Script: public Struct {
                             Handle<SharedFunctionInfo> outer,
                             int eval_position);
   // Retrieve source position from where eval was called.
-  int GetEvalPosition();
+  static int GetEvalPosition(Handle<Script> script);
 
   // Init line_ends array with source code positions of line ends.
   static void InitLineEnds(Handle<Script> script);
@@ -7167,6 +7241,22 @@ enum BuiltinFunctionId {
   kDataViewBuffer,
   kDataViewByteLength,
   kDataViewByteOffset,
+  kDataViewGetInt8,
+  kDataViewGetUint8,
+  kDataViewGetInt16,
+  kDataViewGetUint16,
+  kDataViewGetInt32,
+  kDataViewGetUint32,
+  kDataViewGetFloat32,
+  kDataViewGetFloat64,
+  kDataViewSetInt8,
+  kDataViewSetUint8,
+  kDataViewSetInt16,
+  kDataViewSetUint16,
+  kDataViewSetInt32,
+  kDataViewSetUint32,
+  kDataViewSetFloat32,
+  kDataViewSetFloat64,
   kGlobalDecodeURI,
   kGlobalDecodeURIComponent,
   kGlobalEncodeURI,
@@ -7225,6 +7315,10 @@ class SharedFunctionInfo: public HeapObject {
   // Like ClearOptimizedCodeMap, but preserves literals.
   void ClearCodeFromOptimizedCodeMap();
 
+  // Like ClearCodeFromOptimizedCodeMap, but only clears the optimized code
+  // which inlines the given shared function info.
+  void ClearCodeInliningFromOptimizedCodeMap(SharedFunctionInfo* inlined);
+
   // We have a special root FixedArray with the right shape and values
   // to represent the cleared optimized code map. This predicate checks
   // if that root is installed.
@@ -7318,6 +7412,12 @@ class SharedFunctionInfo: public HeapObject {
   // available.
   DECL_ACCESSORS(feedback_metadata, TypeFeedbackMetadata)
 
+  // [preparsed_scope_data]: Either undefined or a FixedArray with the data
+  // recorded by the PreParser for the inner functions of this function, which
+  // allows the Parser to skip them when this function is lazily compiled. See
+  // PreParsedScopeData for the layout.
+  DECL_ACCESSORS(preparsed_scope_data, Object)
+
 #if TRACE_MAPS
   // [unique_id] - For --trace-maps purposes, an identifier that's persistent
   // even if the GC moves this SharedFunctionInfo.
@@ -7333,6 +7433,8 @@ class SharedFunctionInfo: public HeapObject {
   //  - a FunctionTemplateInfo to make benefit the API [IsApiFunction()].
   //  - a BytecodeArray for the interpreter [HasBytecodeArray()].
   //  - a FixedArray with Asm->Wasm conversion [HasAsmWasmData()].
+  //  - a Tuple3 with the serialized code of a function whose code is only
+  //    deserialized on first call [HasLazyDeserializationData()].
   DECL_ACCESSORS(function_data, Object)
 
   inline bool IsApiFunction();
@@ -7342,10 +7444,18 @@ class SharedFunctionInfo: public HeapObject {
   inline BytecodeArray* bytecode_array();
   inline void set_bytecode_array(BytecodeArray* bytecode);
   inline void ClearBytecodeArray();
+  // Collects the source positions of the bytecode if they were omitted when
+  // the bytecode was generated. Needs to be called before source positions
+  // are looked up in bytecode that might have been compiled lazily.
+  static void EnsureSourcePositionsAvailable(
+      Handle<SharedFunctionInfo> shared_info);
   inline bool HasAsmWasmData();
   inline FixedArray* asm_wasm_data();
   inline void set_asm_wasm_data(FixedArray* data);
   inline void ClearAsmWasmData();
+  inline bool HasLazyDeserializationData();
+  inline Tuple3* lazy_deserialization_data();
+  inline void ClearLazyDeserializationData();
 
   // [function identifier]: This field holds an additional identifier for the
   // function.
@@ -7545,6 +7655,11 @@ class SharedFunctionInfo: public HeapObject {
   inline void set_opt_reenable_tries(int value);
   inline int opt_reenable_tries();
 
+  // Indicates that the function was optimized the last time the script ran,
+  // according to the compile hints it was compiled with.
+  inline bool optimize_early();
+  inline void set_optimize_early(bool value);
+
   inline void TryReenableOptimization();
 
   // Stores deopt_count, opt_reenable_tries and ic_age as bit-fields.
@@ -7621,13 +7736,15 @@ class SharedFunctionInfo: public HeapObject {
   static const int kFunctionIdentifierOffset = kDebugInfoOffset + kPointerSize;
   static const int kFeedbackMetadataOffset =
       kFunctionIdentifierOffset + kPointerSize;
+  static const int kPreParsedScopeDataOffset =
+      kFeedbackMetadataOffset + kPointerSize;
 #if TRACE_MAPS
-  static const int kUniqueIdOffset = kFeedbackMetadataOffset + kPointerSize;
+  static const int kUniqueIdOffset = kPreParsedScopeDataOffset + kPointerSize;
   static const int kLastPointerFieldOffset = kUniqueIdOffset;
 #else
   // Just to not break the postmortrem support with conditional offsets
-  static const int kUniqueIdOffset = kFeedbackMetadataOffset;
-  static const int kLastPointerFieldOffset = kFeedbackMetadataOffset;
+  static const int kUniqueIdOffset = kPreParsedScopeDataOffset;
+  static const int kLastPointerFieldOffset = kPreParsedScopeDataOffset;
 #endif
 
 #if V8_HOST_ARCH_32_BIT
@@ -7784,7 +7901,8 @@ class SharedFunctionInfo: public HeapObject {
   class FunctionKindBits : public BitField<FunctionKind, kFunctionKind, 10> {};
 
   class DeoptCountBits : public BitField<int, 0, 4> {};
-  class OptReenableTriesBits : public BitField<int, 4, 18> {};
+  class OptReenableTriesBits : public BitField<int, 4, 17> {};
+  class OptimizeEarlyBit : public BitField<bool, 21, 1> {};
   class ICAgeBits : public BitField<int, 22, 8> {};
 
   class OptCountBits : public BitField<int, 0, 22> {};
@@ -8766,6 +8884,8 @@ class CompilationCacheTable: public HashTable<CompilationCacheTable,
       Handle<CompilationCacheTable> cache, Handle<String> src,
       JSRegExp::Flags flags, Handle<FixedArray> value);
   void Remove(Object* value);
+  // Removes the entries whose key was created for |shared|.
+  void RemoveOuter(SharedFunctionInfo* shared);
   void Age();
   static const int kHashGenerations = 10;
 
@@ -10717,6 +10837,11 @@ class JSArrayBuffer: public JSObject {
   inline bool is_shared();
   inline void set_is_shared(bool value);
 
+  // [has_guard_region]: the backing store is the start of a reserved region
+  // of address space, see wasm::NewArrayBuffer.
+  inline bool has_guard_region();
+  inline void set_has_guard_region(bool value);
+
   DECLARE_CAST(JSArrayBuffer)
 
   void Neuter();
@@ -10755,6 +10880,7 @@ class JSArrayBuffer: public JSObject {
   class IsNeuterable : public BitField<bool, 2, 1> {};
   class WasNeutered : public BitField<bool, 3, 1> {};
   class IsShared : public BitField<bool, 4, 1> {};
+  class HasGuardRegion : public BitField<bool, 5, 1> {};
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(JSArrayBuffer);
@@ -11184,6 +11310,24 @@ class CallHandlerInfo: public Struct {
   DECL_ACCESSORS(callback, Object)
   DECL_ACCESSORS(data, Object)
   DECL_ACCESSORS(fast_handler, Object)
+  // The program recorded when {fast_handler} was assembled, which TurboFan
+  // inlines into optimized code, or undefined. See FastAccessorAssembler.
+  DECL_ACCESSORS(fast_handler_program, Object)
+  // A Foreign with the address of a C function which optimized code may call
+  // instead of {callback}, or undefined.
+  DECL_ACCESSORS(fast_call_target, Object)
+  // A ByteArray with the FastCallType of the result of {fast_call_target},
+  // followed by those of the receiver and the arguments, or undefined.
+  DECL_ACCESSORS(fast_call_signature, Object)
+
+  // The types a fast API call takes and returns. They match the values of
+  // v8::experimental::FastApiType.
+  enum FastCallType {
+    kFastCallVoid,
+    kFastCallBool,
+    kFastCallInt32,
+    kFastCallWrappedObject
+  };
 
   DECLARE_CAST(CallHandlerInfo)
 
@@ -11194,7 +11338,13 @@ class CallHandlerInfo: public Struct {
   static const int kCallbackOffset = HeapObject::kHeaderSize;
   static const int kDataOffset = kCallbackOffset + kPointerSize;
   static const int kFastHandlerOffset = kDataOffset + kPointerSize;
-  static const int kSize = kFastHandlerOffset + kPointerSize;
+  static const int kFastHandlerProgramOffset =
+      kFastHandlerOffset + kPointerSize;
+  static const int kFastCallTargetOffset =
+      kFastHandlerProgramOffset + kPointerSize;
+  static const int kFastCallSignatureOffset =
+      kFastCallTargetOffset + kPointerSize;
+  static const int kSize = kFastCallSignatureOffset + kPointerSize;
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(CallHandlerInfo);
@@ -0,0 +1,90 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/compile-hints.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/objects-inl.h"
+#include "src/parsing/preparse-data.h"
+#include "src/version.h"
+
+namespace v8 {
+namespace internal {
+
+ScriptData* CompileHints::Create(Handle<Script> script) {
+  std::vector<uint32_t> positions;
+  WeakFixedArray::Iterator iterator(script->shared_function_infos());
+  while (SharedFunctionInfo* shared = iterator.Next<SharedFunctionInfo>()) {
+    if (shared->is_toplevel() || !shared->is_compiled()) continue;
+    bool is_hot = shared->opt_count() > 0 || shared->optimize_early();
+    positions.push_back((static_cast<uint32_t>(shared->start_position()) << 1) |
+                        (is_hot ? 1 : 0));
+  }
+  std::sort(positions.begin(), positions.end());
+  // Several shared function infos of the script may have the same start
+  // position. Keep one entry per position, which is hot if any of them is.
+  size_t count = 0;
+  for (uint32_t entry : positions) {
+    if (count > 0 && (positions[count - 1] >> 1) == (entry >> 1)) {
+      positions[count - 1] |= entry;
+    } else {
+      positions[count++] = entry;
+    }
+  }
+  positions.resize(count);
+
+  int total_size = kHeaderSize + static_cast<int>(count);
+  uint32_t* data = NewArray<uint32_t>(total_size);
+  data[kMagicNumberOffset] = kMagicNumber;
+  data[kVersionHashOffset] = Version::Hash();
+  data[kSourceLengthOffset] =
+      static_cast<uint32_t>(String::cast(script->source())->length());
+  data[kPositionCountOffset] = static_cast<uint32_t>(count);
+  std::copy(positions.begin(), positions.end(), data + kHeaderSize);
+  DCHECK(IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment));
+  ScriptData* result = new ScriptData(reinterpret_cast<byte*>(data),
+                                      total_size * sizeof(uint32_t));
+  result->AcquireDataOwnership();
+  return result;
+}
+
+CompileHints* CompileHints::FromCachedData(ScriptData* cached_data,
+                                           int source_length) {
+  const uint32_t* data = reinterpret_cast<const uint32_t*>(cached_data->data());
+  int length = cached_data->length();
+  if (!IsAligned(length, sizeof(uint32_t)) ||
+      length < static_cast<int>(kHeaderSize * sizeof(uint32_t)) ||
+      data[kMagicNumberOffset] != kMagicNumber ||
+      data[kVersionHashOffset] != Version::Hash() ||
+      data[kSourceLengthOffset] != static_cast<uint32_t>(source_length) ||
+      data[kPositionCountOffset] !=
+          length / sizeof(uint32_t) - static_cast<uint32_t>(kHeaderSize)) {
+    cached_data->Reject();
+    return NULL;
+  }
+  return new CompileHints(data + kHeaderSize,
+                          static_cast<int>(data[kPositionCountOffset]));
+}
+
+const uint32_t* CompileHints::Find(int start_position) const {
+  uint32_t key = static_cast<uint32_t>(start_position) << 1;
+  const uint32_t* entry =
+      std::lower_bound(positions_, positions_ + count_, key);
+  if (entry == positions_ + count_ || (*entry >> 1) != (key >> 1)) return NULL;
+  return entry;
+}
+
+bool CompileHints::ShouldEagerCompile(int start_position) const {
+  return Find(start_position) != NULL;
+}
+
+bool CompileHints::IsHot(int start_position) const {
+  const uint32_t* entry = Find(start_position);
+  return entry != NULL && (*entry & 1) != 0;
+}
+
+}  // namespace internal
+}  // namespace v8
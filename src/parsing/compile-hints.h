@@ -0,0 +1,65 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_COMPILE_HINTS_H_
+#define V8_PARSING_COMPILE_HINTS_H_
+
+#include "src/globals.h"
+#include "src/handles.h"
+
+namespace v8 {
+namespace internal {
+
+class Script;
+class ScriptData;
+
+// CompileHints are the cached data behind ScriptCompiler::kConsumeCompileHints:
+// the start positions of the functions of a script which had been compiled by
+// the time the embedder asked for them, e.g. during the first seconds of a
+// page load. When the same source is compiled again with the hints, the Parser
+// marks these functions for eager compilation, instead of preparsing them now
+// and parsing them again on their first call. Functions which had been
+// optimized are also marked as hot; the RuntimeProfiler optimizes them as soon
+// as their type feedback is stable, without waiting for more ticks.
+class CompileHints {
+ public:
+  // Records the compiled and the optimized functions of |script|, apart from
+  // the top-level code.
+  static ScriptData* Create(Handle<Script> script);
+
+  // Returns NULL and rejects |cached_data| if it does not contain compile hints
+  // for a source of |source_length| characters.
+  static CompileHints* FromCachedData(ScriptData* cached_data,
+                                      int source_length);
+
+  bool ShouldEagerCompile(int start_position) const;
+  bool IsHot(int start_position) const;
+
+ private:
+  // The data consists of a header followed by the sorted start positions,
+  // shifted left by one. The lowest bit is set for hot functions.
+  static const int kMagicNumberOffset = 0;
+  static const int kVersionHashOffset = 1;
+  static const int kSourceLengthOffset = 2;
+  static const int kPositionCountOffset = 3;
+  static const int kHeaderSize = 4;
+
+  static const uint32_t kMagicNumber = 0xC0DEC0E0;
+
+  CompileHints(const uint32_t* positions, int count)
+      : positions_(positions), count_(count) {}
+
+  // Returns the entry for |start_position|, or NULL if there is none.
+  const uint32_t* Find(int start_position) const;
+
+  const uint32_t* positions_;
+  int count_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompileHints);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_COMPILE_HINTS_H_
@@ -20,6 +20,7 @@ ParseInfo::ParseInfo(Zone* zone)
       compile_options_(ScriptCompiler::kNoCompileOptions),
       script_scope_(nullptr),
       unicode_cache_(nullptr),
+      ast_string_constants_(nullptr),
       stack_limit_(0),
       hash_seed_(0),
       compiler_hints_(0),
@@ -48,6 +49,7 @@ ParseInfo::ParseInfo(Zone* zone, Handle<SharedFunctionInfo> shared)
   set_end_position(shared->end_position());
   set_stack_limit(isolate_->stack_guard()->real_climit());
   set_unicode_cache(isolate_->unicode_cache());
+  set_ast_string_constants(isolate_->ast_string_constants());
   set_language_mode(shared->language_mode());
   set_shared_info(shared);
 
@@ -72,6 +74,7 @@ ParseInfo::ParseInfo(Zone* zone, Handle<Script> script) : ParseInfo(zone) {
   set_hash_seed(isolate_->heap()->HashSeed());
   set_stack_limit(isolate_->stack_guard()->real_climit());
   set_unicode_cache(isolate_->unicode_cache());
+  set_ast_string_constants(isolate_->ast_string_constants());
   set_script(script);
 
   set_native(script->type() == Script::TYPE_NATIVE);
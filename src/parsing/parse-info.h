@@ -16,6 +16,7 @@ class Extension;
 namespace internal {
 
 class AstRawString;
+class AstStringConstants;
 class AstValueFactory;
 class DeclarationScope;
 class FunctionLiteral;
@@ -130,6 +131,14 @@ class ParseInfo {
     unicode_cache_ = unicode_cache;
   }
 
+  const AstStringConstants* ast_string_constants() const {
+    return ast_string_constants_;
+  }
+  void set_ast_string_constants(
+      const AstStringConstants* ast_string_constants) {
+    ast_string_constants_ = ast_string_constants;
+  }
+
   uintptr_t stack_limit() const { return stack_limit_; }
   void set_stack_limit(uintptr_t stack_limit) { stack_limit_ = stack_limit; }
 
@@ -224,6 +233,7 @@ class ParseInfo {
   ScriptCompiler::CompileOptions compile_options_;
   DeclarationScope* script_scope_;
   UnicodeCache* unicode_cache_;
+  const AstStringConstants* ast_string_constants_;
   uintptr_t stack_limit_;
   uint32_t hash_seed_;
   int compiler_hints_;
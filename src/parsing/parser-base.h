@@ -3962,7 +3962,7 @@ ParserBase<Impl>::ParseArrowFunctionLiteral(
         bookmark.Set();
         LazyParsingResult result = impl()->SkipLazyFunctionBody(
             &materialized_literal_count, &expected_property_count, false, true,
-            CHECK_OK);
+            nullptr, CHECK_OK);
         formal_parameters.scope->ResetAfterPreparsing(
             ast_value_factory_, result == kLazyParsingAborted);
 
@@ -28,7 +28,11 @@ namespace v8 {
 namespace internal {
 
 ScriptData::ScriptData(const byte* data, int length)
-    : owns_data_(false), rejected_(false), data_(data), length_(length) {
+    : owns_data_(false),
+      rejected_(false),
+      checked_(false),
+      data_(data),
+      length_(length) {
   if (!IsAligned(reinterpret_cast<intptr_t>(data), kPointerAlignment)) {
     byte* copy = NewArray<byte>(length);
     DCHECK(IsAligned(reinterpret_cast<intptr_t>(copy), kPointerAlignment));
@@ -156,6 +160,13 @@ void Parser::SetCachedData(ParseInfo* info) {
     if (cached_parse_data_ == nullptr) {
       compile_options_ = ScriptCompiler::kNoCompileOptions;
     }
+  } else if (compile_options_ == ScriptCompiler::kConsumeCompileHints) {
+    int source_length = String::cast(info->script()->source())->length();
+    compile_hints_ =
+        CompileHints::FromCachedData(*info->cached_data(), source_length);
+    if (compile_hints_ == nullptr) {
+      compile_options_ = ScriptCompiler::kNoCompileOptions;
+    }
   }
 }
 
@@ -638,6 +649,8 @@ Parser::Parser(ParseInfo* info)
       target_stack_(NULL),
       compile_options_(info->compile_options()),
       cached_parse_data_(nullptr),
+      compile_hints_(nullptr),
+      consumed_preparsed_scope_data_(nullptr),
       total_preparse_skipped_(0),
       pre_parse_timer_(NULL),
       parsing_on_main_thread_(true) {
@@ -687,7 +700,8 @@ Parser::Parser(ParseInfo* info)
   }
   if (info->ast_value_factory() == NULL) {
     // info takes ownership of AstValueFactory.
-    info->set_ast_value_factory(new AstValueFactory(zone(), info->hash_seed()));
+    info->set_ast_value_factory(new AstValueFactory(
+        zone(), info->ast_string_constants(), info->hash_seed()));
     info->set_ast_value_factory_owned();
     ast_value_factory_ = info->ast_value_factory();
     ast_node_factory_.set_ast_value_factory(ast_value_factory_);
@@ -896,6 +910,11 @@ FunctionLiteral* Parser::ParseLazy(Isolate* isolate, ParseInfo* info) {
   }
   Handle<SharedFunctionInfo> shared_info = info->shared_info();
   DeserializeScopeChain(info, info->maybe_outer_scope_info());
+  if (shared_info->preparsed_scope_data()->IsFixedArray()) {
+    consumed_preparsed_scope_data_ = new (zone()) PreParsedScopeData(
+        zone(),
+        handle(FixedArray::cast(shared_info->preparsed_scope_data()), isolate));
+  }
 
   // Initialize parser state.
   source = String::Flatten(source);
@@ -2086,13 +2105,29 @@ Statement* Parser::InitializeForOfStatement(ForOfStatement* for_of,
   Variable* iterator = NewTemporary(ast_value_factory()->dot_iterator_string());
   Variable* result = NewTemporary(ast_value_factory()->dot_result_string());
   Variable* completion = NewTemporary(avfactory->empty_string());
-
-  // iterator = iterable[Symbol.iterator]()
+  Variable* iterable_var = NewTemporary(avfactory->empty_string());
+  Variable* index = NewTemporary(avfactory->empty_string());
+  Variable* value = NewTemporary(avfactory->empty_string());
+  // The bytecode generator refers to the index without a VariableProxy, and
+  // only the finalization of the loop creates one, so make sure it gets a
+  // location either way.
+  index->set_is_used();
+
+  // .iterable = iterable, iterator = .iterable[Symbol.iterator]()
+  // The two halves are kept apart so that the bytecode generator can iterate
+  // arrays by index instead, as long as that is unobservable.
   Expression* assign_iterator;
   {
-    assign_iterator = factory()->NewAssignment(
+    Expression* assign_iterable = factory()->NewAssignment(
+        Token::ASSIGN, factory()->NewVariableProxy(iterable_var), iterable,
+        iterable->position());
+    Expression* get_iterator = factory()->NewAssignment(
         Token::ASSIGN, factory()->NewVariableProxy(iterator),
-        GetIterator(iterable, iterable->position()), iterable->position());
+        GetIterator(factory()->NewVariableProxy(iterable_var),
+                    iterable->position()),
+        iterable->position());
+    assign_iterator = factory()->NewBinaryOperation(
+        Token::COMMA, assign_iterable, get_iterator, iterable->position());
   }
 
   // !%_IsJSReceiver(result = iterator.next()) &&
@@ -2114,15 +2149,20 @@ Statement* Parser::InitializeForOfStatement(ForOfStatement* for_of,
         factory()->NewProperty(result_proxy, done_literal, kNoSourcePosition);
   }
 
-  // result.value
-  Expression* result_value;
+  // .value = result.value
+  Expression* assign_value;
   {
     Expression* value_literal =
         factory()->NewStringLiteral(avfactory->value_string(), nopos);
     Expression* result_proxy = factory()->NewVariableProxy(result);
-    result_value = factory()->NewProperty(result_proxy, value_literal, nopos);
+    assign_value = factory()->NewAssignment(
+        Token::ASSIGN, factory()->NewVariableProxy(value),
+        factory()->NewProperty(result_proxy, value_literal, nopos), nopos);
   }
 
+  // .value
+  Expression* result_value = factory()->NewVariableProxy(value);
+
   // {{completion = kAbruptCompletion;}}
   Statement* set_completion_abrupt;
   if (finalize) {
@@ -2153,7 +2193,7 @@ Statement* Parser::InitializeForOfStatement(ForOfStatement* for_of,
     result_value = factory()->NewDoExpression(block, var_tmp, nopos);
   }
 
-  // each = #result_value;
+  // .value = result.value, each = #result_value;
   Expression* assign_each;
   {
     assign_each =
@@ -2162,6 +2202,8 @@ Statement* Parser::InitializeForOfStatement(ForOfStatement* for_of,
       assign_each = PatternRewriter::RewriteDestructuringAssignment(
           this, assign_each->AsAssignment(), scope());
     }
+    assign_each = factory()->NewBinaryOperation(Token::COMMA, assign_value,
+                                                assign_each, nopos);
   }
 
   // {{completion = kNormalCompletion;}}
@@ -2187,9 +2229,11 @@ Statement* Parser::InitializeForOfStatement(ForOfStatement* for_of,
     body = block;
   }
 
-  for_of->Initialize(body, iterator, assign_iterator, next_result, result_done,
-                     assign_each);
-  return finalize ? FinalizeForOfStatement(for_of, completion, nopos) : for_of;
+  for_of->Initialize(body, iterator, index, assign_iterator, next_result,
+                     result_done, assign_each);
+  return finalize
+             ? FinalizeForOfStatement(for_of, iterable_var, completion, nopos)
+             : for_of;
 }
 
 Statement* Parser::DesugarLexicalBindingsInForStatement(
@@ -2579,6 +2623,17 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
           ? FunctionLiteral::kShouldEagerCompile
           : default_eager_compile_hint();
 
+  // Functions which were compiled the last time this script ran are compiled
+  // eagerly if the embedder passed the compile hints recorded back then. The
+  // next token is the '(' at the start position of the function.
+  if (compile_hints_ != nullptr &&
+      eager_compile_hint == FunctionLiteral::kShouldLazyCompile &&
+      compile_hints_->ShouldEagerCompile(peek_position())) {
+    eager_compile_hint = FunctionLiteral::kShouldEagerCompile;
+  }
+  bool should_optimize_early =
+      compile_hints_ != nullptr && compile_hints_->IsHot(peek_position());
+
   // Determine if the function can be parsed lazily. Lazy parsing is
   // different from lazy compilation; we need to parse more eagerly than we
   // compile.
@@ -2656,6 +2711,7 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   ZoneList<Statement*>* body = nullptr;
   int materialized_literal_count = -1;
   int expected_property_count = -1;
+  PreParsedScopeData* preparsed_scope_data = nullptr;
   DuplicateFinder duplicate_finder(scanner()->unicode_cache());
   bool should_be_used_once_hint = false;
   bool has_duplicate_parameters;
@@ -2708,7 +2764,8 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       bookmark.Set();
       LazyParsingResult result = SkipLazyFunctionBody(
           &materialized_literal_count, &expected_property_count,
-          is_lazy_inner_function, is_lazy_top_level_function, CHECK_OK);
+          is_lazy_inner_function, is_lazy_top_level_function,
+          &preparsed_scope_data, CHECK_OK);
 
       materialized_literal_count += formals.materialized_literals_count +
                                     function_state.materialized_literal_count();
@@ -2786,6 +2843,10 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   function_literal->set_function_token_position(function_token_pos);
   if (should_be_used_once_hint)
     function_literal->set_should_be_used_once_hint();
+  if (should_optimize_early) function_literal->set_should_optimize_early();
+  if (preparsed_scope_data != nullptr && !preparsed_scope_data->IsEmpty()) {
+    function_literal->set_preparsed_scope_data(preparsed_scope_data);
+  }
 
   if (should_infer_name) {
     DCHECK_NOT_NULL(fni_);
@@ -2796,12 +2857,41 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
 Parser::LazyParsingResult Parser::SkipLazyFunctionBody(
     int* materialized_literal_count, int* expected_property_count,
-    bool is_inner_function, bool may_abort, bool* ok) {
+    bool is_inner_function, bool may_abort,
+    PreParsedScopeData** preparsed_scope_data, bool* ok) {
   if (produce_cached_parse_data()) CHECK(log_);
 
   int function_block_pos = position();
   DeclarationScope* scope = function_state_->scope();
   DCHECK(scope->is_function_scope());
+  if (is_inner_function && consumed_preparsed_scope_data_ != nullptr) {
+    // If the inner function was seen when the function being compiled was
+    // preparsed, skip it using the recorded data instead of preparsing it
+    // again. Its free variables are migrated like those of a preparsed
+    // function, and its own inner functions are found in the same data.
+    PreParsedScopeData::FunctionData data;
+    ZoneList<const AstRawString*> free_variables(4, zone());
+    if (consumed_preparsed_scope_data_->FindSkippableFunction(
+            function_block_pos, ast_value_factory(), &data, &free_variables)) {
+      DCHECK_GT(data.end_position, function_block_pos);
+      scanner()->SeekForward(data.end_position - 1);
+
+      scope->set_end_position(data.end_position);
+      Expect(Token::RBRACE, CHECK_OK_VALUE(kLazyParsingComplete));
+      total_preparse_skipped_ += scope->end_position() - function_block_pos;
+      *materialized_literal_count = data.literal_count;
+      *expected_property_count = data.property_count;
+      SetLanguageMode(scope, data.language_mode);
+      if (data.uses_super_property) scope->RecordSuperPropertyUsage();
+      if (data.calls_eval) scope->RecordEvalCall();
+      if (data.inner_scope_calls_eval) scope->RecordInnerScopeEvalCall();
+      for (const AstRawString* name : free_variables) {
+        scope->NewUnresolved(factory(), name);
+      }
+      *preparsed_scope_data = consumed_preparsed_scope_data_;
+      return kLazyParsingComplete;
+    }
+  }
   // Inner functions are not part of the cached data.
   if (!is_inner_function && consume_cached_parse_data() &&
       !cached_parse_data_->rejected()) {
@@ -2828,10 +2918,17 @@ Parser::LazyParsingResult Parser::SkipLazyFunctionBody(
     cached_parse_data_->Reject();
   }
   // With no cached data, we partially parse the function, without building an
-  // AST. This gathers the data needed to build a lazy function.
+  // AST. This gathers the data needed to build a lazy function. For inner
+  // functions, the PreParser also records their own inner functions; the
+  // data lives in the Zone of the function's scope, which is the main Zone.
   SingletonLogger logger;
-  PreParser::PreParseResult result =
-      ParseLazyFunctionBodyWithPreParser(&logger, is_inner_function, may_abort);
+  PreParsedScopeData* produced_preparsed_scope_data = nullptr;
+  if (is_inner_function) {
+    produced_preparsed_scope_data =
+        new (scope->zone()) PreParsedScopeData(scope->zone());
+  }
+  PreParser::PreParseResult result = ParseLazyFunctionBodyWithPreParser(
+      &logger, is_inner_function, may_abort, produced_preparsed_scope_data);
 
   // Return immediately if pre-parser decided to abort parsing.
   if (result == PreParser::kPreParseAbort) return kLazyParsingAborted;
@@ -2856,6 +2953,7 @@ Parser::LazyParsingResult Parser::SkipLazyFunctionBody(
   SetLanguageMode(scope, logger.language_mode());
   if (logger.uses_super_property()) scope->RecordSuperPropertyUsage();
   if (logger.calls_eval()) scope->RecordEvalCall();
+  if (is_inner_function) *preparsed_scope_data = produced_preparsed_scope_data;
   if (!is_inner_function && produce_cached_parse_data()) {
     DCHECK(log_);
     // Position right after terminal '}'.
@@ -3292,7 +3390,8 @@ ZoneList<Statement*>* Parser::ParseEagerFunctionBody(
 }
 
 PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
-    SingletonLogger* logger, bool is_inner_function, bool may_abort) {
+    SingletonLogger* logger, bool is_inner_function, bool may_abort,
+    PreParsedScopeData* preparsed_scope_data) {
   // This function may be called on a background thread too; record only the
   // main thread preparse times.
   if (pre_parse_timer_ != NULL) {
@@ -3323,7 +3422,7 @@ PreParser::PreParseResult Parser::ParseLazyFunctionBodyWithPreParser(
   DeclarationScope* function_scope = function_state_->scope();
   PreParser::PreParseResult result = reusable_preparser_->PreParseLazyFunction(
       function_scope, parsing_module_, logger, is_inner_function, may_abort,
-      use_counts_);
+      use_counts_, preparsed_scope_data);
   if (pre_parse_timer_ != NULL) {
     pre_parse_timer_->Stop();
   }
@@ -3992,7 +4091,9 @@ ZoneList<Expression*>* Parser::PrepareSpreadArguments(
   ZoneList<Expression*>* args = new (zone()) ZoneList<Expression*>(1, zone());
   if (list->length() == 1) {
     // Spread-call with single spread argument produces an InternalArray
-    // containing the values from the array.
+    // containing the values from the array, unless the spread is a fast
+    // JSArray whose iteration is unobservable, in which case it is passed
+    // on as is.
     //
     // Function is called or constructed with the produced array of arguments
     //
@@ -4000,7 +4101,7 @@ ZoneList<Expression*>* Parser::PrepareSpreadArguments(
     ZoneList<Expression*>* spread_list =
         new (zone()) ZoneList<Expression*>(0, zone());
     spread_list->Add(list->at(0)->AsSpread()->expression(), zone());
-    args->Add(factory()->NewCallRuntime(Context::SPREAD_ITERABLE_INDEX,
+    args->Add(factory()->NewCallRuntime(Runtime::kSpreadIterablePrepare,
                                         spread_list, kNoSourcePosition),
               zone());
     return args;
@@ -5391,6 +5492,7 @@ void Parser::BuildIteratorCloseForCompletion(ZoneList<Statement*>* statements,
 }
 
 Statement* Parser::FinalizeForOfStatement(ForOfStatement* loop,
+                                          Variable* var_iterable,
                                           Variable* var_completion, int pos) {
   //
   // This function replaces the loop with the following wrapping:
@@ -5404,7 +5506,8 @@ Statement* Parser::FinalizeForOfStatement(ForOfStatement* loop,
   //       %ReThrow(e);
   //     }
   //   } finally {
-  //     if (!(completion === kNormalCompletion || IS_UNDEFINED(#iterator))) {
+  //     if (!(completion === kNormalCompletion ||
+  //           IS_UNDEFINED(#maybe_iterator))) {
   //       #BuildIteratorCloseForCompletion(#iterator, completion)
   //     }
   //   }
@@ -5415,14 +5518,46 @@ Statement* Parser::FinalizeForOfStatement(ForOfStatement* loop,
 
   const int nopos = kNoSourcePosition;
 
-  // !(completion === kNormalCompletion || IS_UNDEFINED(#iterator))
+  // While an array is iterated by index, the #iterator is undefined. Closing
+  // the iterator that the loop would have owned is only observable once the
+  // array iterator lookup chain was modified, so create it here then.
+  //
+  // IS_UNDEFINED(#index) || %_ArrayIteratorProtector()
+  //     ? #iterator
+  //     : #iterator = %CreateArrayValuesIterator(#iterable, #index)
+  Expression* maybe_iterator;
+  {
+    Expression* index_undefined = factory()->NewCompareOperation(
+        Token::EQ_STRICT, factory()->NewVariableProxy(loop->index()),
+        factory()->NewUndefinedLiteral(nopos), nopos);
+    Expression* protector_intact = factory()->NewCallRuntime(
+        Runtime::kInlineArrayIteratorProtector,
+        new (zone()) ZoneList<Expression*>(0, zone()), nopos);
+    Expression* condition = factory()->NewBinaryOperation(
+        Token::OR, index_undefined, protector_intact, nopos);
+
+    ZoneList<Expression*>* args = new (zone()) ZoneList<Expression*>(2, zone());
+    args->Add(factory()->NewVariableProxy(var_iterable), zone());
+    args->Add(factory()->NewVariableProxy(loop->index()), zone());
+    Expression* create_iterator = factory()->NewAssignment(
+        Token::ASSIGN, factory()->NewVariableProxy(loop->iterator()),
+        factory()->NewCallRuntime(Runtime::kCreateArrayValuesIterator, args,
+                                  nopos),
+        nopos);
+
+    maybe_iterator = factory()->NewConditional(
+        condition, factory()->NewVariableProxy(loop->iterator()),
+        create_iterator, nopos);
+  }
+
+  // !(completion === kNormalCompletion || IS_UNDEFINED(#maybe_iterator))
   Expression* closing_condition;
   {
     Expression* lhs = factory()->NewCompareOperation(
         Token::EQ_STRICT, factory()->NewVariableProxy(var_completion),
         factory()->NewSmiLiteral(Parser::kNormalCompletion, nopos), nopos);
     Expression* rhs = factory()->NewCompareOperation(
-        Token::EQ_STRICT, factory()->NewVariableProxy(loop->iterator()),
+        Token::EQ_STRICT, maybe_iterator,
         factory()->NewUndefinedLiteral(nopos), nopos);
     closing_condition = factory()->NewUnaryOperation(
         Token::NOT, factory()->NewBinaryOperation(Token::OR, lhs, rhs, nopos),
@@ -7,6 +7,7 @@
 
 #include "src/ast/ast.h"
 #include "src/ast/scopes.h"
+#include "src/parsing/compile-hints.h"
 #include "src/parsing/parser-base.h"
 #include "src/parsing/preparse-data.h"
 #include "src/parsing/preparse-data-format.h"
@@ -175,6 +176,8 @@ class Parser : public ParserBase<Parser> {
     reusable_preparser_ = NULL;
     delete cached_parse_data_;
     cached_parse_data_ = NULL;
+    delete compile_hints_;
+    compile_hints_ = NULL;
   }
 
   // Parses the source code represented by the compilation info and sets its
@@ -487,13 +490,16 @@ class Parser : public ParserBase<Parser> {
   // by parsing the function with PreParser. Consumes the ending }.
   // If may_abort == true, the (pre-)parser may decide to abort skipping
   // in order to force the function to be eagerly parsed, after all.
-  LazyParsingResult SkipLazyFunctionBody(int* materialized_literal_count,
-                                         int* expected_property_count,
-                                         bool is_inner_function, bool may_abort,
-                                         bool* ok);
+  // For inner functions, |preparsed_scope_data| is set to the data describing
+  // the inner functions of the skipped function, if there is any.
+  LazyParsingResult SkipLazyFunctionBody(
+      int* materialized_literal_count, int* expected_property_count,
+      bool is_inner_function, bool may_abort,
+      PreParsedScopeData** preparsed_scope_data, bool* ok);
 
   PreParser::PreParseResult ParseLazyFunctionBodyWithPreParser(
-      SingletonLogger* logger, bool is_inner_function, bool may_abort);
+      SingletonLogger* logger, bool is_inner_function, bool may_abort,
+      PreParsedScopeData* preparsed_scope_data);
 
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters, bool* ok);
@@ -595,8 +601,8 @@ class Parser : public ParserBase<Parser> {
   void FinalizeIteratorUse(Variable* completion, Expression* condition,
                            Variable* iter, Block* iterator_use, Block* result);
 
-  Statement* FinalizeForOfStatement(ForOfStatement* loop, Variable* completion,
-                                    int pos);
+  Statement* FinalizeForOfStatement(ForOfStatement* loop, Variable* iterable,
+                                    Variable* completion, int pos);
   void BuildIteratorClose(ZoneList<Statement*>* statements, Variable* iterator,
                           Variable* input, Variable* output);
   void BuildIteratorCloseForCompletion(ZoneList<Statement*>* statements,
@@ -1089,6 +1095,10 @@ class Parser : public ParserBase<Parser> {
 
   ScriptCompiler::CompileOptions compile_options_;
   ParseData* cached_parse_data_;
+  CompileHints* compile_hints_;
+  // The data recorded for the inner functions of the function being lazily
+  // parsed, if any.
+  PreParsedScopeData* consumed_preparsed_scope_data_;
 
   PendingCompilationErrorHandler pending_error_handler_;
 
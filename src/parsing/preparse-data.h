@@ -24,8 +24,11 @@ class ScriptData {
   const byte* data() const { return data_; }
   int length() const { return length_; }
   bool rejected() const { return rejected_; }
+  // Whether the data was already checked off the main thread.
+  bool checked() const { return checked_; }
 
   void Reject() { rejected_ = true; }
+  void MarkChecked() { checked_ = true; }
 
   void AcquireDataOwnership() {
     DCHECK(!owns_data_);
@@ -40,6 +43,7 @@ class ScriptData {
  private:
   bool owns_data_ : 1;
   bool rejected_ : 1;
+  bool checked_ : 1;
   const byte* data_;
   int length_;
 
@@ -0,0 +1,120 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/preparsed-scope-data.h"
+
+#include <algorithm>
+
+#include "src/ast/ast-value-factory.h"
+#include "src/ast/scopes.h"
+#include "src/factory.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+
+PreParsedScopeData::PreParsedScopeData(Zone* zone)
+    : zone_(zone), functions_(zone) {}
+
+PreParsedScopeData::PreParsedScopeData(Zone* zone,
+                                       Handle<FixedArray> serialized_data)
+    : zone_(zone), functions_(zone), serialized_data_(serialized_data) {
+  DCHECK_EQ(0, serialized_data->length() % kEntrySize);
+}
+
+void PreParsedScopeData::AddSkippableFunction(int start_position,
+                                              const FunctionData& data,
+                                              Scope* scope) {
+  DCHECK(serialized_data_.is_null());
+  ZoneHashMap names(ZoneHashMap::kDefaultHashMapCapacity,
+                    ZoneAllocationPolicy(zone_));
+  scope->CollectUnresolvedNames(&names, zone_);
+  ZoneList<const AstRawString*>* free_variables =
+      new (zone_) ZoneList<const AstRawString*>(names.occupancy(), zone_);
+  for (ZoneHashMap::Entry* p = names.Start(); p != nullptr;
+       p = names.Next(p)) {
+    free_variables->Add(reinterpret_cast<const AstRawString*>(p->key), zone_);
+  }
+  functions_.push_back({start_position, data, free_variables});
+}
+
+bool PreParsedScopeData::FindSkippableFunction(
+    int start_position, AstValueFactory* ast_value_factory, FunctionData* data,
+    ZoneList<const AstRawString*>* free_variables) const {
+  if (serialized_data_.is_null()) return false;
+  FixedArray* functions = *serialized_data_;
+  int low = 0;
+  int high = functions->length() / kEntrySize - 1;
+  while (low <= high) {
+    int mid = low + (high - low) / 2;
+    int index = mid * kEntrySize;
+    int position = Smi::cast(functions->get(index + kStartPositionIndex))
+                       ->value();
+    if (position < start_position) {
+      low = mid + 1;
+    } else if (position > start_position) {
+      high = mid - 1;
+    } else {
+      int flags = Smi::cast(functions->get(index + kFlagsIndex))->value();
+      data->end_position =
+          Smi::cast(functions->get(index + kEndPositionIndex))->value();
+      data->literal_count =
+          Smi::cast(functions->get(index + kLiteralCountIndex))->value();
+      data->property_count =
+          Smi::cast(functions->get(index + kPropertyCountIndex))->value();
+      data->language_mode = LanguageModeField::decode(flags);
+      data->uses_super_property = UsesSuperPropertyField::decode(flags);
+      data->calls_eval = CallsEvalField::decode(flags);
+      data->inner_scope_calls_eval = InnerScopeCallsEvalField::decode(flags);
+      Isolate* isolate = functions->GetIsolate();
+      Handle<FixedArray> names(
+          FixedArray::cast(functions->get(index + kFreeVariablesIndex)),
+          isolate);
+      for (int i = 0; i < names->length(); ++i) {
+        Handle<String> name(String::cast(names->get(i)), isolate);
+        free_variables->Add(ast_value_factory->GetString(name), zone_);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+Handle<FixedArray> PreParsedScopeData::Serialize(Isolate* isolate) {
+  if (!serialized_data_.is_null()) return serialized_data_;
+  std::sort(functions_.begin(), functions_.end(),
+            [](const SkippableFunction& a, const SkippableFunction& b) {
+              return a.start_position < b.start_position;
+            });
+  Factory* factory = isolate->factory();
+  int length = static_cast<int>(functions_.size()) * kEntrySize;
+  Handle<FixedArray> result = factory->NewFixedArray(length, TENURED);
+  int index = 0;
+  for (const SkippableFunction& function : functions_) {
+    const FunctionData& data = function.data;
+    int flags = LanguageModeField::encode(data.language_mode) |
+                UsesSuperPropertyField::encode(data.uses_super_property) |
+                CallsEvalField::encode(data.calls_eval) |
+                InnerScopeCallsEvalField::encode(data.inner_scope_calls_eval);
+    Handle<FixedArray> names = factory->NewFixedArray(
+        function.free_variables->length(), TENURED);
+    for (int i = 0; i < function.free_variables->length(); ++i) {
+      names->set(i, *function.free_variables->at(i)->string());
+    }
+    result->set(index + kStartPositionIndex,
+                Smi::FromInt(function.start_position));
+    result->set(index + kEndPositionIndex, Smi::FromInt(data.end_position));
+    result->set(index + kLiteralCountIndex, Smi::FromInt(data.literal_count));
+    result->set(index + kPropertyCountIndex, Smi::FromInt(data.property_count));
+    result->set(index + kFlagsIndex, Smi::FromInt(flags));
+    result->set(index + kFreeVariablesIndex, *names);
+    index += kEntrySize;
+  }
+  serialized_data_ = result;
+  return result;
+}
+
+}  // namespace internal
+}  // namespace v8
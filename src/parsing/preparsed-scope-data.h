@@ -0,0 +1,108 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PREPARSED_SCOPE_DATA_H_
+#define V8_PARSING_PREPARSED_SCOPE_DATA_H_
+
+#include "src/globals.h"
+#include "src/handles.h"
+#include "src/utils.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+class AstRawString;
+class AstValueFactory;
+class FixedArray;
+class Scope;
+
+// PreParsedScopeData records what the Parser needs to know about the inner
+// functions of a lazily parsed function in order to skip them without
+// preparsing them again: the end of the function body, the literal and
+// property counts, the scope flags, and the names of the variables which the
+// inner function references without resolving them. The Parser migrates these
+// names as free variables of the skipped function, the same way it migrates
+// the unresolved variables of a preparsed function (see
+// DeclarationScope::AnalyzePartially).
+//
+// The data is produced by the PreParser while it preparses an inner function
+// with unresolved variable tracking, and stored on the SharedFunctionInfo of
+// that inner function as a FixedArray. When the function is compiled, the
+// Parser skips the inner functions found in the data in O(1), and stores the
+// same FixedArray on their SharedFunctionInfos in turn, so that each function
+// body is preparsed with tracking at most once, however deeply it is nested.
+class PreParsedScopeData : public ZoneObject {
+ public:
+  struct FunctionData {
+    int end_position;
+    int literal_count;
+    int property_count;
+    LanguageMode language_mode;
+    bool uses_super_property;
+    bool calls_eval;
+    bool inner_scope_calls_eval;
+  };
+
+  // Creates empty data to be filled in by the PreParser.
+  explicit PreParsedScopeData(Zone* zone);
+
+  // Wraps data that was previously serialized onto a SharedFunctionInfo.
+  PreParsedScopeData(Zone* zone, Handle<FixedArray> serialized_data);
+
+  // Records the function whose body starts at |start_position|. The free
+  // variables are the unresolved variables of |scope| and its inner scopes.
+  void AddSkippableFunction(int start_position, const FunctionData& data,
+                            Scope* scope);
+
+  // Looks up the function whose body starts at |start_position|. If found,
+  // fills in |data|, adds the names of its free variables to |free_variables|
+  // and returns true.
+  bool FindSkippableFunction(
+      int start_position, AstValueFactory* ast_value_factory,
+      FunctionData* data, ZoneList<const AstRawString*>* free_variables) const;
+
+  bool IsEmpty() const {
+    return serialized_data_.is_null() && functions_.empty();
+  }
+
+  // Returns the data in the form stored on SharedFunctionInfos. The recorded
+  // names must have been internalized.
+  Handle<FixedArray> Serialize(Isolate* isolate);
+
+ private:
+  struct SkippableFunction {
+    int start_position;
+    FunctionData data;
+    ZoneList<const AstRawString*>* free_variables;
+  };
+
+  // The serialized data consists of kEntrySize elements per function, sorted
+  // by the start position of the function body. The free variables are stored
+  // as a FixedArray of internalized strings.
+  static const int kStartPositionIndex = 0;
+  static const int kEndPositionIndex = 1;
+  static const int kLiteralCountIndex = 2;
+  static const int kPropertyCountIndex = 3;
+  static const int kFlagsIndex = 4;
+  static const int kFreeVariablesIndex = 5;
+  static const int kEntrySize = 6;
+
+  class LanguageModeField : public BitField<LanguageMode, 0, 1> {};
+  class UsesSuperPropertyField : public BitField<bool, 1, 1> {};
+  class CallsEvalField : public BitField<bool, 2, 1> {};
+  class InnerScopeCallsEvalField : public BitField<bool, 3, 1> {};
+  STATIC_ASSERT(LANGUAGE_END == 2);
+
+  Zone* zone_;
+  ZoneVector<SkippableFunction> functions_;
+  Handle<FixedArray> serialized_data_;
+
+  DISALLOW_COPY_AND_ASSIGN(PreParsedScopeData);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PREPARSED_SCOPE_DATA_H_
@@ -85,13 +85,16 @@ PreParserIdentifier PreParser::GetSymbol() const {
 
 PreParser::PreParseResult PreParser::PreParseLazyFunction(
     DeclarationScope* function_scope, bool parsing_module, ParserRecorder* log,
-    bool is_inner_function, bool may_abort, int* use_counts) {
+    bool is_inner_function, bool may_abort, int* use_counts,
+    PreParsedScopeData* preparsed_scope_data) {
   DCHECK_EQ(FUNCTION_SCOPE, function_scope->scope_type());
+  DCHECK_IMPLIES(preparsed_scope_data != nullptr, is_inner_function);
   parsing_module_ = parsing_module;
   log_ = log;
   use_counts_ = use_counts;
   DCHECK(!track_unresolved_variables_);
   track_unresolved_variables_ = is_inner_function;
+  preparsed_scope_data_ = preparsed_scope_data;
 
   // The caller passes the function_scope which is not yet inserted into the
   // scope_state_. All scopes above the function_scope are ignored by the
@@ -104,6 +107,7 @@ PreParser::PreParseResult PreParser::PreParseLazyFunction(
   LazyParsingResult result = ParseLazyFunctionLiteralBody(may_abort, &ok);
   use_counts_ = nullptr;
   track_unresolved_variables_ = false;
+  preparsed_scope_data_ = nullptr;
   if (result == kLazyParsingAborted) {
     return kPreParseAbort;
   } else if (stack_overflow()) {
@@ -169,6 +173,8 @@ PreParser::Expression PreParser::ParseFunctionLiteral(
                            !function_state_->this_function_is_parenthesized());
 
   Expect(Token::LBRACE, CHECK_OK);
+  int body_start = scanner()->location().beg_pos;
+  int formals_literal_count = function_state_->materialized_literal_count();
   if (is_lazily_parsed) {
     ParseLazyFunctionLiteralBody(false, CHECK_OK);
   } else {
@@ -179,6 +185,21 @@ PreParser::Expression PreParser::ParseFunctionLiteral(
   // Parsing the body may change the language mode in our scope.
   language_mode = function_scope->language_mode();
 
+  if (preparsed_scope_data_ != nullptr) {
+    // Like the FunctionEntries logged for lazy functions, the literal count
+    // only covers the body; the Parser counts the literals of the formals.
+    PreParsedScopeData::FunctionData data = {
+        scanner()->location().end_pos,
+        function_state_->materialized_literal_count() - formals_literal_count,
+        function_state_->expected_property_count(),
+        language_mode,
+        function_scope->uses_super_property(),
+        function_scope->calls_eval(),
+        function_scope->inner_scope_calls_eval()};
+    preparsed_scope_data_->AddSkippableFunction(body_start, data,
+                                                function_scope);
+  }
+
   // Validate name and parameter names. We can do this only after parsing the
   // function, since the function can declare itself strict.
   CheckFunctionName(language_mode, function_name, function_name_validity,
@@ -7,6 +7,7 @@
 
 #include "src/ast/scopes.h"
 #include "src/parsing/parser-base.h"
+#include "src/parsing/preparsed-scope-data.h"
 
 namespace v8 {
 namespace internal {
@@ -842,7 +843,8 @@ class PreParser : public ParserBase<PreParser> {
       : ParserBase<PreParser>(zone, scanner, stack_limit, NULL,
                               ast_value_factory, log),
         use_counts_(nullptr),
-        track_unresolved_variables_(false) {}
+        track_unresolved_variables_(false),
+        preparsed_scope_data_(nullptr) {}
 
   // Pre-parse the program from the character stream; returns true on
   // success (even if parsing failed, the pre-parse data successfully
@@ -887,10 +889,13 @@ class PreParser : public ParserBase<PreParser> {
   // keyword and parameters, and have consumed the initial '{'.
   // At return, unless an error occurred, the scanner is positioned before the
   // the final '}'.
-  PreParseResult PreParseLazyFunction(DeclarationScope* function_scope,
-                                      bool parsing_module, ParserRecorder* log,
-                                      bool track_unresolved_variables,
-                                      bool may_abort, int* use_counts);
+  // If |preparsed_scope_data| is not null, the inner functions of an inner
+  // function are recorded into it, so that they can be skipped when the inner
+  // function is compiled.
+  PreParseResult PreParseLazyFunction(
+      DeclarationScope* function_scope, bool parsing_module,
+      ParserRecorder* log, bool track_unresolved_variables, bool may_abort,
+      int* use_counts, PreParsedScopeData* preparsed_scope_data = nullptr);
 
  private:
   // These types form an algebra over syntactic categories that is just
@@ -912,7 +917,8 @@ class PreParser : public ParserBase<PreParser> {
 
   V8_INLINE LazyParsingResult SkipLazyFunctionBody(
       int* materialized_literal_count, int* expected_property_count,
-      bool track_unresolved_variables, bool may_abort, bool* ok) {
+      bool track_unresolved_variables, bool may_abort,
+      PreParsedScopeData** preparsed_scope_data, bool* ok) {
     UNREACHABLE();
     return kLazyParsingComplete;
   }
@@ -1497,6 +1503,7 @@ class PreParser : public ParserBase<PreParser> {
 
   int* use_counts_;
   bool track_unresolved_variables_;
+  PreParsedScopeData* preparsed_scope_data_;
 };
 
 PreParserExpression PreParser::SpreadCall(PreParserExpression function,
@@ -393,8 +393,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  while (c0_ != kEndOfInput && !unicode_cache_->IsLineTerminator(c0_)) {
-    Advance();
+  if (c0_ != kEndOfInput && !unicode_cache_->IsLineTerminator(c0_)) {
+    c0_ = source_->AdvanceUntil(
+        [this](uc32 c0) { return unicode_cache_->IsLineTerminator(c0); });
   }
 
   return Token::WHITESPACE;
@@ -467,6 +468,13 @@ Token::Value Scanner::SkipMultiLineComment() {
   Advance();
 
   while (c0_ != kEndOfInput) {
+    // Skip ahead to the next '*' or line terminator.
+    if (c0_ != '*' && !unicode_cache_->IsLineTerminator(c0_)) {
+      c0_ = source_->AdvanceUntil([this](uc32 c0) {
+        return c0 == '*' || unicode_cache_->IsLineTerminator(c0);
+      });
+      if (c0_ == kEndOfInput) break;
+    }
     uc32 ch = c0_;
     Advance();
     if (c0_ != kEndOfInput && unicode_cache_->IsLineTerminator(ch)) {
@@ -1301,39 +1309,76 @@ uc32 Scanner::ScanUnicodeEscape() {
   KEYWORD_GROUP('y')                                        \
   KEYWORD("yield", Token::YIELD)
 
+struct KeywordEntry {
+  const char* string;
+  int length;
+  Token::Value token;
+};
+
+static constexpr KeywordEntry kKeywords[] = {
+#define KEYWORD_GROUP_ENTRY(ch)
+#define KEYWORD_ENTRY(keyword, token) {keyword, sizeof(keyword) - 1, token},
+    KEYWORDS(KEYWORD_GROUP_ENTRY, KEYWORD_ENTRY)
+#undef KEYWORD_GROUP_ENTRY
+#undef KEYWORD_ENTRY
+};
+
+static const int kMinKeywordLength = 2;
+static const int kMaxKeywordLength = 10;
+
+// A perfect hash of the keywords: the first two characters, the last
+// character and the length are combined into one word and multiplied with a
+// constant which was chosen such that the top 7 bits of the product differ
+// for all keywords.
+static constexpr uint32_t KeywordHash(uint32_t first, uint32_t second,
+                                      uint32_t last, uint32_t length) {
+  return ((first | second << 8 | last << 16 | length << 24) * 0xa268ee31u) >>
+         25;
+}
+
+static constexpr uint32_t KeywordHash(const char* keyword, int length) {
+  return KeywordHash(keyword[0], keyword[1], keyword[length - 1], length);
+}
+
+// The index in kKeywords of the keyword with a given hash, or -1.
+static constexpr int8_t kKeywordIndex[128] = {
+    -1, -1, -1, -1, 5, -1, 44, 39, 45, -1, 12, -1, 30, -1, 9, -1,
+    29, -1, -1, -1, -1, 43, -1, -1, 6, 1, 21, 33, -1, -1, 41, -1,
+    -1, 42, 32, -1, 4, -1, -1, 3, -1, -1, -1, 14, 13, -1, -1, 22,
+    -1, -1, 25, 16, 2, 26, -1, 23, 8, -1, -1, -1, 40, 27, -1, -1,
+    -1, -1, 24, -1, -1, 19, 31, -1, -1, -1, -1, -1, 11, 15, -1, -1,
+    -1, -1, 36, -1, -1, 17, -1, -1, -1, -1, 20, -1, -1, -1, -1, 0,
+    -1, -1, 34, -1, -1, -1, 46, 7, -1, -1, -1, -1, 18, -1, -1, -1,
+    -1, -1, -1, 38, -1, -1, -1, -1, 35, -1, -1, 10, -1, -1, 37, 28,
+};
+
+static constexpr bool KeywordIndexIsValid(int i) {
+  return i == static_cast<int>(arraysize(kKeywords)) ||
+         (kKeywords[i].length >= kMinKeywordLength &&
+          kKeywords[i].length <= kMaxKeywordLength &&
+          kKeywordIndex[KeywordHash(kKeywords[i].string,
+                                    kKeywords[i].length)] == i &&
+          KeywordIndexIsValid(i + 1));
+}
+// Adding a keyword requires finding a new multiplier for KeywordHash and
+// recomputing kKeywordIndex.
+STATIC_ASSERT(KeywordIndexIsValid(0));
+
 static Token::Value KeywordOrIdentifierToken(const uint8_t* input,
                                              int input_length) {
   DCHECK(input_length >= 1);
-  const int kMinLength = 2;
-  const int kMaxLength = 10;
-  if (input_length < kMinLength || input_length > kMaxLength) {
+  if (input_length < kMinKeywordLength || input_length > kMaxKeywordLength) {
     return Token::IDENTIFIER;
   }
-  switch (input[0]) {
-    default:
-#define KEYWORD_GROUP_CASE(ch)                                \
-      break;                                                  \
-    case ch:
-#define KEYWORD(keyword, token)                                     \
-  {                                                                 \
-    /* 'keyword' is a char array, so sizeof(keyword) is */          \
-    /* strlen(keyword) plus 1 for the NUL char. */                  \
-    const int keyword_length = sizeof(keyword) - 1;                 \
-    STATIC_ASSERT(keyword_length >= kMinLength);                    \
-    STATIC_ASSERT(keyword_length <= kMaxLength);                    \
-    if (input_length == keyword_length && input[1] == keyword[1] && \
-        (keyword_length <= 2 || input[2] == keyword[2]) &&          \
-        (keyword_length <= 3 || input[3] == keyword[3]) &&          \
-        (keyword_length <= 4 || input[4] == keyword[4]) &&          \
-        (keyword_length <= 5 || input[5] == keyword[5]) &&          \
-        (keyword_length <= 6 || input[6] == keyword[6]) &&          \
-        (keyword_length <= 7 || input[7] == keyword[7]) &&          \
-        (keyword_length <= 8 || input[8] == keyword[8]) &&          \
-        (keyword_length <= 9 || input[9] == keyword[9])) {          \
-      return token;                                                 \
-    }                                                               \
-  }
-    KEYWORDS(KEYWORD_GROUP_CASE, KEYWORD)
+  int index = kKeywordIndex[KeywordHash(input[0], input[1],
+                                        input[input_length - 1],
+                                        input_length)];
+  if (index >= 0) {
+    const KeywordEntry& entry = kKeywords[index];
+    if (entry.length == input_length &&
+        memcmp(entry.string, input, input_length) == 0) {
+      return entry.token;
+    }
   }
   return Token::IDENTIFIER;
 }
@@ -1356,23 +1401,13 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
   DCHECK(unicode_cache_->IsIdentifierStart(c0_));
   LiteralScope literal(this);
   if (IsInRange(c0_, 'a', 'z')) {
-    do {
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsInRange(c0_, 'a', 'z'));
+    AddAsciiLiteralCharsAdvance(
+        [](uc32 c) { return IsInRange(c, 'a', 'z'); });
 
     if (IsDecimalDigit(c0_) || IsInRange(c0_, 'A', 'Z') || c0_ == '_' ||
         c0_ == '$') {
       // Identifier starting with lowercase.
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-      while (IsAsciiIdentifier(c0_)) {
-        char first_char = static_cast<char>(c0_);
-        Advance<false, false>();
-        AddLiteralChar(first_char);
-      }
+      AddAsciiLiteralCharsAdvance([](uc32 c) { return IsAsciiIdentifier(c); });
       if (c0_ <= kMaxAscii && c0_ != '\\') {
         literal.Complete();
         return Token::IDENTIFIER;
@@ -1390,11 +1425,7 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
 
     HandleLeadSurrogate();
   } else if (IsInRange(c0_, 'A', 'Z') || c0_ == '_' || c0_ == '$') {
-    do {
-      char first_char = static_cast<char>(c0_);
-      Advance<false, false>();
-      AddLiteralChar(first_char);
-    } while (IsAsciiIdentifier(c0_));
+    AddAsciiLiteralCharsAdvance([](uc32 c) { return IsAsciiIdentifier(c); });
 
     if (c0_ <= kMaxAscii && c0_ != '\\') {
       literal.Complete();
@@ -7,6 +7,8 @@
 #ifndef V8_PARSING_SCANNER_H_
 #define V8_PARSING_SCANNER_H_
 
+#include <algorithm>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/char-predicates.h"
@@ -55,6 +57,56 @@ class Utf16CharacterStream {
     }
   }
 
+  // Returns and advances past the next UTF-16 code unit in the input stream
+  // for which {check} returns true, skipping all code units before it. If
+  // there is no such code unit it returns kEndOfInput. The buffer is searched
+  // directly, instead of going through Advance() for each code unit.
+  template <typename FunctionType>
+  inline uc32 AdvanceUntil(FunctionType check) {
+    while (true) {
+      const uint16_t* next_cursor =
+          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t c) {
+            return check(static_cast<uc32>(c));
+          });
+      if (next_cursor != buffer_end_) {
+        buffer_cursor_ = next_cursor + 1;
+        return static_cast<uc32>(*next_cursor);
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlock()) {
+        // See Advance().
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
+  // Advances past the code units for which {check} returns true, and returns
+  // and advances past the next code unit, or returns kEndOfInput. The code
+  // units which were skipped are passed to {consume} as ranges of the buffer,
+  // one range per buffered block.
+  template <typename FunctionType, typename ConsumeType>
+  inline uc32 AdvanceWhile(FunctionType check, ConsumeType consume) {
+    while (true) {
+      const uint16_t* start = buffer_cursor_;
+      const uint16_t* next_cursor =
+          std::find_if(start, buffer_end_, [&check](uint16_t c) {
+            return !check(static_cast<uc32>(c));
+          });
+      consume(start, next_cursor);
+      if (next_cursor != buffer_end_) {
+        buffer_cursor_ = next_cursor + 1;
+        return static_cast<uc32>(*next_cursor);
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlock()) {
+        // See Advance().
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -390,6 +442,17 @@ class Scanner {
       }
     }
 
+    // Adds the ASCII code units in [start, end).
+    void AddAsciiChars(const uint16_t* start, const uint16_t* end) {
+      DCHECK(is_one_byte_);
+      int length = static_cast<int>(end - start);
+      while (position_ + length > backing_store_.length()) ExpandBuffer();
+      for (const uint16_t* p = start; p < end; ++p) {
+        DCHECK_LE(*p, static_cast<uint16_t>(unibrow::Utf8::kMaxOneByteChar));
+        backing_store_[position_++] = static_cast<byte>(*p);
+      }
+    }
+
     bool is_one_byte() const { return is_one_byte_; }
 
     bool is_contextual_keyword(Vector<const char> keyword) const {
@@ -587,6 +650,21 @@ class Scanner {
     Advance();
   }
 
+  // Adds c0_ and the code units following it for which {check} returns true
+  // to the one-byte literal, and advances past them. {check} may only accept
+  // ASCII characters. The code units are read from the buffer of the source
+  // stream in bulk rather than one Advance() at a time.
+  template <typename FunctionType>
+  inline void AddAsciiLiteralCharsAdvance(FunctionType check) {
+    DCHECK(check(c0_));
+    AddLiteralChar(static_cast<char>(c0_));
+    LiteralBuffer* literal_chars = next_.literal_chars;
+    c0_ = source_->AdvanceWhile(
+        check, [literal_chars](const uint16_t* start, const uint16_t* end) {
+          literal_chars->AddAsciiChars(start, end);
+        });
+  }
+
   // Low-level scanning support.
   template <bool capture_raw = false, bool check_surrogate = true>
   void Advance() {
@@ -82,6 +82,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -112,6 +122,7 @@ base::LazyRecursiveMutex PerfJitLogger::file_mutex_;
 uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
+PerfJitLogger::CodeIdMap* PerfJitLogger::code_ids_ = nullptr;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
@@ -170,6 +181,7 @@ PerfJitLogger::PerfJitLogger() {
     OpenJitDumpFile();
     if (perf_output_handle_ == nullptr) return;
     LogWriteHeader();
+    code_ids_ = new CodeIdMap();
   }
 }
 
@@ -180,6 +192,8 @@ PerfJitLogger::~PerfJitLogger() {
   // If this was the last logger, close the file.
   if (reference_count_ == 0) {
     CloseJitDumpFile();
+    delete code_ids_;
+    code_ids_ = nullptr;
   }
 }
 
@@ -218,8 +232,7 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
 
   const char* code_name = name;
   uint8_t* code_pointer = reinterpret_cast<uint8_t*>(code->instruction_start());
-  uint32_t code_size = code->is_crankshafted() ? code->safepoint_table_offset()
-                                               : code->instruction_size();
+  uint32_t code_size = GetCodeSize(code);
 
   // Unwinding info comes right after debug info.
   if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(code);
@@ -238,6 +251,7 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  (*code_ids_)[code->instruction_start()] = code_index_;
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -361,8 +375,41 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code* code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode* from, Address to) {
-  // Code relocation not supported.
-  UNREACHABLE();
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Only code objects have load records that perf can relocate.
+  if (!from->IsCode()) return;
+  Code* code = from->GetCode();
+  CodeIdMap::iterator it = code_ids_->find(code->instruction_start());
+  if (it == code_ids_->end()) return;
+  uint64_t code_id = it->second;
+  code_ids_->erase(it);
+
+  Address new_code_address = to + Code::kHeaderSize;
+  (*code_ids_)[new_code_address] = code_id;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = 0x0;  //  Our addresses are absolute.
+  code_move.old_code_address_ =
+      reinterpret_cast<uint64_t>(code->instruction_start());
+  code_move.new_code_address_ = reinterpret_cast<uint64_t>(new_code_address);
+  code_move.code_size_ = GetCodeSize(code);
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
+uint32_t PerfJitLogger::GetCodeSize(Code* code) {
+  return code->is_crankshafted() ? code->safepoint_table_offset()
+                                 : code->instruction_size();
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -28,6 +28,8 @@
 #ifndef V8_PERF_JIT_H_
 #define V8_PERF_JIT_H_
 
+#include <unordered_map>
+
 #include "src/log.h"
 
 namespace v8 {
@@ -52,6 +54,7 @@ class PerfJitLogger : public CodeEventLogger {
   void CloseMarkerFile(void* marker_address);
 
   uint64_t GetTimestamp();
+  static uint32_t GetCodeSize(Code* code);
   void LogRecordedBuffer(AbstractCode* code, SharedFunctionInfo* shared,
                          const char* name, int length) override;
 
@@ -98,6 +101,11 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+
+  // Maps the instruction start of every logged code object to the code index
+  // of its load record, so that moves can refer to the same index.
+  typedef std::unordered_map<Address, uint64_t> CodeIdMap;
+  static CodeIdMap* code_ids_;
 };
 
 #else
@@ -1358,6 +1358,9 @@ void V8HeapExplorer::ExtractSharedFunctionInfoReferences(
   SetInternalReference(obj, entry, "feedback_metadata",
                        shared->feedback_metadata(),
                        SharedFunctionInfo::kFeedbackMetadataOffset);
+  SetInternalReference(obj, entry, "preparsed_scope_data",
+                       shared->preparsed_scope_data(),
+                       SharedFunctionInfo::kPreParsedScopeDataOffset);
 }
 
 
@@ -1446,6 +1449,11 @@ void V8HeapExplorer::ExtractCodeReferences(int entry, Code* code) {
                          code->type_feedback_info(),
                          Code::kTypeFeedbackInfoOffset);
   }
+  if (code->kind() == Code::WASM_FUNCTION) {
+    SetInternalReference(code, entry, "protected_instructions",
+                         code->protected_instructions(),
+                         Code::kProtectedInstructionsOffset);
+  }
   SetInternalReference(code, entry, "gc_metadata", code->gc_metadata(),
                        Code::kGCMetadataOffset);
 }
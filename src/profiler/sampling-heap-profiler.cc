@@ -196,12 +196,22 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
     SharedFunctionInfo* shared = *it;
-    const char* name = this->names()->GetFunctionName(shared->DebugName());
     int script_id = v8::UnboundScript::kNoScriptId;
     if (shared->script()->IsScript()) {
       Script* script = Script::cast(shared->script());
       script_id = script->id();
     }
+    if (script_id != v8::UnboundScript::kNoScriptId) {
+      // Functions in scripts are identified by their position only, so an
+      // existing node can be found without converting the function name.
+      auto child = node->children_.find(AllocationNode::function_id(
+          script_id, shared->start_position(), nullptr));
+      if (child != node->children_.end()) {
+        node = child->second;
+        continue;
+      }
+    }
+    const char* name = this->names()->GetFunctionName(shared->DebugName());
     node = node->FindOrAddChildNode(name, script_id, shared->start_position());
   }
   return node;
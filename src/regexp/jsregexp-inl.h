@@ -37,8 +37,17 @@ int32_t* RegExpImpl::GlobalCache::FetchNext() {
 
     int32_t* last_match =
         &register_array_[(current_match_index_ - 1) * registers_per_match_];
+    int last_start_index = last_match[0];
     int last_end_index = last_match[1];
 
+    // A full batch suggests many more matches, so fetch larger batches to
+    // reduce the number of calls into the regexp code. The initial state is
+    // recognized by its negative start index.
+    if (last_start_index >= 0 && max_matches_ > 1 &&
+        register_array_size_ < kMaxRegisterArraySize) {
+      GrowRegisterArray();
+    }
+
     if (regexp_->TypeTag() == JSRegExp::ATOM) {
       num_matches_ = RegExpImpl::AtomExecRaw(regexp_,
                                              subject_,
@@ -46,7 +55,6 @@ int32_t* RegExpImpl::GlobalCache::FetchNext() {
                                              register_array_,
                                              register_array_size_);
     } else {
-      int last_start_index = last_match[0];
       if (last_start_index == last_end_index) {
         // Zero-length match. Advance by one code point.
         last_end_index = AdvanceZeroLength(last_end_index);
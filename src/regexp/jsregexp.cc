@@ -708,6 +708,22 @@ int RegExpImpl::GlobalCache::AdvanceZeroLength(int last_index) {
   return last_index + 1;
 }
 
+void RegExpImpl::GlobalCache::GrowRegisterArray() {
+  int new_size = Min(2 * register_array_size_, kMaxRegisterArraySize);
+  int new_max_matches = new_size / registers_per_match_;
+  if (new_max_matches <= max_matches_) return;
+  int32_t* new_array = NewArray<int32_t>(new_size);
+  // Keep the previous results around, as they are still returned by
+  // LastSuccessfulMatch() if the next batch finds no match.
+  MemCopy(new_array, register_array_, register_array_size_ * sizeof(int32_t));
+  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    DeleteArray(register_array_);
+  }
+  register_array_ = new_array;
+  register_array_size_ = new_size;
+  max_matches_ = new_max_matches;
+}
+
 // -------------------------------------------------------------------
 // Implementation of the Irregexp regular expression engine.
 //
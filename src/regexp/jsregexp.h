@@ -129,7 +129,13 @@ class RegExpImpl {
     INLINE(bool HasException()) { return num_matches_ < 0; }
 
    private:
+    // Upper bound for the size of the register array, which is grown
+    // whenever a batch of matches filled it.
+    static const int kMaxRegisterArraySize =
+        16 * Isolate::kJSRegexpStaticOffsetsVectorSize;
+
     int AdvanceZeroLength(int last_index);
+    void GrowRegisterArray();
 
     int num_matches_;
     int max_matches_;
@@ -55,6 +55,15 @@ static const int kOSRCodeSizeAllowancePerTickIgnition =
 static const int kMaxSizeEarlyOpt =
     5 * FullCodeGenerator::kCodeSizeMultiplier;
 
+// The interrupt budget of interpreted functions is spent in proportion to the
+// bytecodes they execute, so larger functions get ticks for fewer invocations.
+// They need this many bytes of bytecode per additional tick to be optimized.
+static const int kBytecodeSizeAllowancePerTick = 1100;
+
+// Maximum size in bytes of bytecode for a function to be optimized the very
+// first time it is seen on the stack.
+static const int kMaxBytecodeSizeForEarlyOpt = 90;
+
 #define OPTIMIZATION_REASON_LIST(V)                            \
   V(DoNotOptimize, "do not optimize")                          \
   V(HotAndStable, "hot and stable")                            \
@@ -83,6 +92,18 @@ std::ostream& operator<<(std::ostream& os, OptimizationReason reason) {
   return os << OptimizationReasonToString(reason);
 }
 
+// Functions which were optimized the last time their script ran are optimized
+// on the first tick on which their type feedback is stable.
+static int TicksBeforeOptimization(SharedFunctionInfo* shared) {
+  return shared->optimize_early() ? 0 : kProfilerTicksBeforeOptimization;
+}
+
+static int TicksBeforeOptimizationIgnition(SharedFunctionInfo* shared) {
+  if (shared->optimize_early()) return 0;
+  return kProfilerTicksBeforeOptimization +
+         shared->bytecode_array()->length() / kBytecodeSizeAllowancePerTick;
+}
+
 RuntimeProfiler::RuntimeProfiler(Isolate* isolate)
     : isolate_(isolate),
       any_ic_changed_(false) {
@@ -268,7 +289,7 @@ void RuntimeProfiler::MaybeOptimizeFullCodegen(JSFunction* function,
 
   int ticks = shared_code->profiler_ticks();
 
-  if (ticks >= kProfilerTicksBeforeOptimization) {
+  if (ticks >= TicksBeforeOptimization(shared)) {
     int typeinfo, generic, total, type_percentage, generic_percentage;
     GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
                 &generic_percentage);
@@ -402,7 +423,7 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
   SharedFunctionInfo* shared = function->shared();
   int ticks = shared->profiler_ticks();
 
-  if (ticks >= kProfilerTicksBeforeOptimization) {
+  if (ticks >= TicksBeforeOptimizationIgnition(shared)) {
     int typeinfo, generic, total, type_percentage, generic_percentage;
     GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
                 &generic_percentage);
@@ -422,9 +443,19 @@ OptimizationReason RuntimeProfiler::ShouldOptimizeIgnition(
       }
       return OptimizationReason::kDoNotOptimize;
     }
+  } else if (!any_ic_changed_ &&
+             shared->bytecode_array()->length() <
+                 kMaxBytecodeSizeForEarlyOpt) {
+    // If no IC was patched since the last tick and this function is very
+    // small, optimistically optimize it now.
+    int typeinfo, generic, total, type_percentage, generic_percentage;
+    GetICCounts(function, &typeinfo, &generic, &total, &type_percentage,
+                &generic_percentage);
+    if (type_percentage >= FLAG_type_info_threshold &&
+        generic_percentage <= FLAG_generic_ic_threshold) {
+      return OptimizationReason::kSmallFunction;
+    }
   }
-  // TODO(rmcilroy): Consider whether we should optimize small functions when
-  // they are first seen on the stack (e.g., kMaxSizeEarlyOpt).
   return OptimizationReason::kDoNotOptimize;
 }
 
@@ -4,6 +4,8 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+
 #include "src/arguments.h"
 #include "src/code-stubs.h"
 #include "src/conversions-inl.h"
@@ -385,6 +387,35 @@ RUNTIME_FUNCTION(Runtime_GrowArrayElements) {
 }
 
 
+// Sorts a packed array of Smis in place, in the default order of
+// Array.prototype.sort. Returns false if the array does not qualify, in which
+// case the caller has to fall back to the generic sort.
+RUNTIME_FUNCTION(Runtime_ArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSReceiver, object, 0);
+  if (!object->IsJSArray()) return isolate->heap()->false_value();
+  Handle<JSArray> array = Handle<JSArray>::cast(object);
+  if (array->GetElementsKind() != FAST_SMI_ELEMENTS) {
+    return isolate->heap()->false_value();
+  }
+  uint32_t length = 0;
+  CHECK(array->length()->ToArrayLength(&length));
+  if (length < 2) return isolate->heap()->true_value();
+
+  JSObject::EnsureWritableFastElements(array);
+  DisallowHeapAllocation no_gc;
+  FixedArray* elements = FixedArray::cast(array->elements());
+  DCHECK_LE(length, static_cast<uint32_t>(elements->length()));
+  // Only Smis are moved, so no write barrier is needed.
+  Object** start = elements->data_start();
+  std::sort(start, start + length, [](Object* a, Object* b) {
+    return Smi::LexicographicCompare(Smi::cast(a), Smi::cast(b)) == LESS;
+  });
+  return isolate->heap()->true_value();
+}
+
+
 RUNTIME_FUNCTION(Runtime_HasComplexElements) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 1);
@@ -639,5 +670,78 @@ RUNTIME_FUNCTION(Runtime_ArrayIndexOf) {
   return Smi::FromInt(-1);
 }
 
+// Prepares the {spread} of a call with a single spread argument. The
+// {spread} is returned as is if iterating over it with the array iterator
+// cannot be observed and yields exactly its elements, so that the callee
+// arguments can be pushed straight from its backing store. Otherwise the
+// {spread} is iterated into a fresh InternalArray.
+RUNTIME_FUNCTION(Runtime_SpreadIterablePrepare) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(Object, spread, 0);
+
+  if (spread->IsJSArray()) {
+    Handle<JSArray> array = Handle<JSArray>::cast(spread);
+    if (array->HasFastElements() &&
+        array->map()->prototype() ==
+            isolate->native_context()->initial_array_prototype() &&
+        isolate->IsArrayIteratorLookupChainIntact() &&
+        (IsFastPackedElementsKind(array->GetElementsKind()) ||
+         isolate->IsFastArrayConstructorPrototypeChainIntact())) {
+      return *array;
+    }
+  }
+
+  Handle<JSFunction> spread_iterable = isolate->spread_iterable();
+  RETURN_RESULT_OR_FAILURE(
+      isolate, Execution::Call(isolate, spread_iterable,
+                               isolate->factory()->undefined_value(), 1,
+                               &spread));
+}
+
+// Checks whether a for-of loop over {iterable} can walk its elements by
+// index, i.e. whether {iterable} is a JSArray with the initial
+// Array.prototype and the array iterator lookup chain is intact.
+RUNTIME_FUNCTION(Runtime_IsFastArrayIterable) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_CHECKED(Object, iterable, 0);
+  if (!iterable->IsJSArray()) return isolate->heap()->false_value();
+  JSArray* array = JSArray::cast(iterable);
+  return isolate->heap()->ToBoolean(
+      isolate->IsArrayIteratorLookupChainIntact() &&
+      array->map()->prototype() ==
+          isolate->raw_native_context()->initial_array_prototype());
+}
+
+RUNTIME_FUNCTION(Runtime_ArrayIteratorProtector) {
+  SealHandleScope shs(isolate);
+  DCHECK_EQ(0, args.length());
+  return isolate->heap()->ToBoolean(
+      isolate->IsArrayIteratorLookupChainIntact());
+}
+
+// Creates the iterator that a for-of loop over the {array} would have
+// obtained, advanced to {index}. Used when the loop leaves its index based
+// fast path because the array iterator lookup chain was modified.
+RUNTIME_FUNCTION(Runtime_CreateArrayValuesIterator) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Smi, index, 1);
+
+  Handle<JSFunction> values(isolate->native_context()->array_values_iterator(),
+                            isolate);
+  Handle<Object> iterator;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(
+      isolate, iterator, Execution::Call(isolate, values, array, 0, nullptr));
+  RETURN_FAILURE_ON_EXCEPTION(
+      isolate,
+      Object::SetProperty(iterator,
+                          isolate->factory()->array_iterator_next_symbol(),
+                          index, STRICT));
+  return *iterator;
+}
+
 }  // namespace internal
 }  // namespace v8
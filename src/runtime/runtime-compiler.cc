@@ -336,12 +336,44 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
 
   MaybeHandle<Code> maybe_result;
   if (IsSuitableForOnStackReplacement(isolate, function)) {
-    if (FLAG_trace_osr) {
-      PrintF("[OSR - Compiling: ");
-      function->PrintName();
-      PrintF(" at AST id %d]\n", ast_id.ToInt());
+    if (FLAG_concurrent_osr && isolate->concurrent_recompilation_enabled()) {
+      OptimizingCompileDispatcher* dispatcher =
+          isolate->optimizing_compile_dispatcher();
+      CompilationJob* job = dispatcher->FindReadyOSRCandidate(function, ast_id);
+      if (job != NULL) {
+        if (FLAG_trace_osr) {
+          PrintF("[COSR - Finalizing: ");
+          function->PrintName();
+          PrintF(" at AST id %d]\n", ast_id.ToInt());
+        }
+        maybe_result = Compiler::FinalizeOSRCompilationJob(job);
+      } else if (dispatcher->IsQueuedForOSR(function, ast_id)) {
+        // Keep running unoptimized code until the job is ready. The back
+        // edges are armed again once it is.
+        return NULL;
+      } else {
+        if (FLAG_trace_osr) {
+          PrintF("[COSR - Queueing: ");
+          function->PrintName();
+          PrintF(" at AST id %d]\n", ast_id.ToInt());
+        }
+        maybe_result = Compiler::GetOptimizedCodeForOSR(
+            function, ast_id, frame, Compiler::CONCURRENT);
+        Handle<Code> code;
+        if (maybe_result.ToHandle(&code) &&
+            code.is_identical_to(
+                isolate->builtins()->InOptimizationQueue())) {
+          return NULL;
+        }
+      }
+    } else {
+      if (FLAG_trace_osr) {
+        PrintF("[OSR - Compiling: ");
+        function->PrintName();
+        PrintF(" at AST id %d]\n", ast_id.ToInt());
+      }
+      maybe_result = Compiler::GetOptimizedCodeForOSR(function, ast_id, frame);
     }
-    maybe_result = Compiler::GetOptimizedCodeForOSR(function, ast_id, frame);
   }
 
   // Check whether we ended up with usable optimized code.
@@ -706,6 +706,9 @@ RUNTIME_FUNCTION(Runtime_InternalCompare) {
   icu::Collator* collator = Collator::UnpackCollator(isolate, collator_holder);
   if (!collator) return isolate->ThrowIllegalOperation();
 
+  // Identical strings compare equal under every collation.
+  if (String::Equals(string1, string2)) return Smi::FromInt(UCOL_EQUAL);
+
   string1 = String::Flatten(string1);
   string2 = String::Flatten(string2);
 
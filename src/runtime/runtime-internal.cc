@@ -424,7 +424,7 @@ bool ComputeLocation(Isolate* isolate, MessageLocation* target) {
   JavaScriptFrameIterator it(isolate);
   if (!it.done()) {
     JavaScriptFrame* frame = it.frame();
-    JSFunction* fun = frame->function();
+    Handle<JSFunction> fun(frame->function(), isolate);
     Object* script = fun->shared()->script();
     if (script->IsScript() &&
         !(Script::cast(script)->source()->IsUndefined(isolate))) {
@@ -435,8 +435,9 @@ bool ComputeLocation(Isolate* isolate, MessageLocation* target) {
       List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
       it.frame()->Summarize(&frames);
       FrameSummary& summary = frames.last();
+      summary.EnsureSourcePositionsAvailable();
       int pos = summary.abstract_code()->SourcePosition(summary.code_offset());
-      *target = MessageLocation(casted_script, pos, pos + 1, handle(fun));
+      *target = MessageLocation(casted_script, pos, pos + 1, fun);
       return true;
     }
   }
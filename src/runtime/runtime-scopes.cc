@@ -580,6 +580,28 @@ RUNTIME_FUNCTION(Runtime_NewRestParameter) {
 }
 
 
+// Creates the elements backing store for an unmapped arguments object or a
+// rest parameter array from the last {length} parameters above {frame}. Only
+// used by the NewUnmappedArgumentsElements builtin for large {length}s.
+RUNTIME_FUNCTION(Runtime_NewArgumentsElements) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  // Note that {frame} is a raw frame pointer, which looks like a Smi.
+  Object** frame = reinterpret_cast<Object**>(args[0]);
+  CONVERT_SMI_ARG_CHECKED(length, 1);
+  Object** parameters =
+      frame + StandardFrameConstants::kCallerSPOffset / kPointerSize;
+  Handle<FixedArray> result =
+      isolate->factory()->NewUninitializedFixedArray(length);
+  DisallowHeapAllocation no_gc;
+  WriteBarrierMode mode = result->GetWriteBarrierMode(no_gc);
+  for (int index = 0; index < length; ++index) {
+    result->set(index, parameters[length - 1 - index], mode);
+  }
+  return *result;
+}
+
+
 RUNTIME_FUNCTION(Runtime_NewSloppyArguments) {
   HandleScope scope(isolate);
   DCHECK(args.length() == 3);
@@ -848,6 +848,34 @@ static bool FastAsciiConvert(char* dst, const char* src, int length,
 }
 
 
+// Checks whether the one-byte {src} is ASCII and has no characters that the
+// conversion would change, in which case the input can be returned as is
+// without allocating a result.
+template <class Converter>
+static bool FastAsciiIsUnchanged(const char* src, int length) {
+  DisallowHeapAllocation no_gc;
+  static const char lo = Converter::kIsToLower ? 'A' - 1 : 'a' - 1;
+  static const char hi = Converter::kIsToLower ? 'Z' + 1 : 'z' + 1;
+  const char* const limit = src + length;
+
+  if (IsAligned(reinterpret_cast<intptr_t>(src), sizeof(uintptr_t))) {
+    while (src <= limit - sizeof(uintptr_t)) {
+      const uintptr_t w = *reinterpret_cast<const uintptr_t*>(src);
+      if ((w & kAsciiMask) != 0) return false;
+      if (AsciiRangeMask(w, lo, hi) != 0) return false;
+      src += sizeof(uintptr_t);
+    }
+  }
+  while (src < limit) {
+    char c = *src;
+    if ((c & kAsciiMask) != 0) return false;
+    if (lo < c && c < hi) return false;
+    ++src;
+  }
+  return true;
+}
+
+
 template <class Converter>
 MUST_USE_RESULT static Object* ConvertCase(
     Handle<String> s, Isolate* isolate,
@@ -864,6 +892,17 @@ MUST_USE_RESULT static Object* ConvertCase(
   // might break in the future if we implement more context and locale
   // dependent upper/lower conversions.
   if (s->IsOneByteRepresentationUnderneath()) {
+    {
+      DisallowHeapAllocation no_gc;
+      String::FlatContent flat_content = s->GetFlatContent();
+      DCHECK(flat_content.IsFlat());
+      if (FastAsciiIsUnchanged<Converter>(
+              reinterpret_cast<const char*>(
+                  flat_content.ToOneByteVector().start()),
+              length)) {
+        return *s;
+      }
+    }
     // Same length as input.
     Handle<SeqOneByteString> result =
         isolate->factory()->NewRawOneByteString(length).ToHandleChecked();
@@ -763,7 +763,8 @@ RUNTIME_FUNCTION(Runtime_DeserializeWasmModule) {
 
   ScriptData sc(mem_start, mem_size);
   MaybeHandle<FixedArray> maybe_compiled_module =
-      WasmCompiledModuleSerializer::DeserializeWasmModule(isolate, &sc);
+      WasmCompiledModuleSerializer::DeserializeWasmModule(
+          isolate, &sc, Vector<const uint8_t>());
   Handle<FixedArray> compiled_module;
   if (!maybe_compiled_module.ToHandle(&compiled_module)) {
     return isolate->heap()->undefined_value();
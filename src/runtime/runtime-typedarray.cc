@@ -4,6 +4,9 @@
 
 #include "src/runtime/runtime-utils.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "src/arguments.h"
 #include "src/factory.h"
 #include "src/messages.h"
@@ -296,17 +299,67 @@ RUNTIME_FUNCTION(Runtime_TypedArrayGetBuffer) {
 // Return codes for Runtime_TypedArraySetFastCases.
 // Should be synchronized with typedarray.js natives.
 enum TypedArraySetResultCodes {
-  // Set from typed array of the same type.
+  // Set from typed array of the same type, or of a different type that does
+  // not overlap in memory.
   // This is processed by TypedArraySetFastCases
-  TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE = 0,
+  TYPED_ARRAY_SET_TYPED_ARRAY_COPIED = 0,
   // Set from typed array of the different type, overlapping in memory.
   TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING = 1,
-  // Set from typed array of the different type, non-overlapping.
-  TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING = 2,
   // Set from non-typed array.
-  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 3
+  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 2
 };
 
+namespace {
+
+template <typename SourceType, class TargetTraits>
+void CopyTypedArrayElements(uint8_t* target_base, uint8_t* source_base,
+                            size_t length) {
+  typedef typename TargetTraits::ElementType TargetType;
+  TargetType* target = reinterpret_cast<TargetType*>(target_base);
+  SourceType* source = reinterpret_cast<SourceType*>(source_base);
+  for (size_t i = 0; i < length; i++) {
+    target[i] = FixedTypedArray<TargetTraits>::from_double(
+        static_cast<double>(source[i]));
+  }
+}
+
+template <typename SourceType>
+void CopyTypedArrayElements(ExternalArrayType target_type,
+                            uint8_t* target_base, uint8_t* source_base,
+                            size_t length) {
+  switch (target_type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                     \
+  case kExternal##Type##Array:                                              \
+    CopyTypedArrayElements<SourceType, Type##ArrayTraits>(target_base,      \
+                                                          source_base,      \
+                                                          length);          \
+    break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+}
+
+// Copies |length| elements between non-overlapping typed arrays of different
+// types, converting each element like a [[Set]] of the source value would.
+void CopyTypedArrayElements(ExternalArrayType target_type,
+                            uint8_t* target_base,
+                            ExternalArrayType source_type,
+                            uint8_t* source_base, size_t length) {
+  switch (source_type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                     \
+  case kExternal##Type##Array:                                              \
+    CopyTypedArrayElements<ctype>(target_type, target_base, source_base,    \
+                                  length);                                  \
+    break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+}
+
+}  // namespace
+
 
 RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   HandleScope scope(isolate);
@@ -350,7 +403,7 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   if (target->type() == source->type()) {
     memmove(target_base + offset * target->element_size(), source_base,
             source_byte_length);
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE);
+    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_COPIED);
   }
 
   // Typed arrays of different types over the same backing store
@@ -363,8 +416,67 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
            source->GetBuffer()->backing_store());
     return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING);
   } else {  // Non-overlapping typed arrays
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING);
+    CopyTypedArrayElements(target->type(),
+                           target_base + offset * target->element_size(),
+                           source->type(), source_base, source_length);
+    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_COPIED);
+  }
+}
+
+
+namespace {
+
+template <typename T>
+bool CompareNum(T x, T y) {
+  return x < y;
+}
+
+// Orders -0 before +0 and NaNs after all other values, like the default
+// comparator of %TypedArray%.prototype.sort.
+template <typename T>
+bool CompareFloat(T x, T y) {
+  if (x < y) return true;
+  if (x > y) return false;
+  if (x == y) return std::signbit(x) && !std::signbit(y);
+  return !std::isnan(x) && std::isnan(y);
+}
+
+template <>
+bool CompareNum<float>(float x, float y) {
+  return CompareFloat(x, y);
+}
+
+template <>
+bool CompareNum<double>(double x, double y) {
+  return CompareFloat(x, y);
+}
+
+}  // namespace
+
+// Sorts a typed array in place in numeric order, without a comparator.
+RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, array, 0);
+  if (array->WasNeutered()) return *array;
+  size_t length = array->length_value();
+  if (length < 2) return *array;
+
+  DisallowHeapAllocation no_gc;
+  FixedTypedArrayBase* elements =
+      FixedTypedArrayBase::cast(array->elements());
+  switch (array->type()) {
+#define TYPED_ARRAY_SORT(Type, type, TYPE, ctype, size)     \
+  case kExternal##Type##Array: {                            \
+    ctype* data = static_cast<ctype*>(elements->DataPtr()); \
+    std::sort(data, data + length, CompareNum<ctype>);      \
+    break;                                                  \
+  }
+
+    TYPED_ARRAYS(TYPED_ARRAY_SORT)
+#undef TYPED_ARRAY_SORT
   }
+  return *array;
 }
 
 
@@ -60,6 +60,35 @@ RUNTIME_FUNCTION(Runtime_WasmGrowMemory) {
       wasm::GrowInstanceMemory(isolate, module_instance, delta_pages));
 }
 
+RUNTIME_FUNCTION(Runtime_WasmCompileLazy) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(0, args.length());
+  Handle<JSObject> module_instance;
+  Handle<Code> stub;
+  uint32_t func_index;
+  {
+    // Get the lazy compile stub which called us; its deoptimization data
+    // hold the instance and the index of the function to compile.
+    DisallowHeapAllocation no_allocation;
+    const Address entry = Isolate::c_entry_fp(isolate->thread_local_top());
+    Address pc =
+        Memory::Address_at(entry + StandardFrameConstants::kCallerPCOffset);
+    Code* code =
+        isolate->inner_pointer_to_code_cache()->GetCacheEntry(pc)->code;
+    Object* owning_instance = wasm::GetOwningWasmInstance(code);
+    CHECK_NOT_NULL(owning_instance);
+    module_instance = handle(JSObject::cast(owning_instance), isolate);
+    stub = handle(code, isolate);
+    func_index = Smi::cast(code->deoptimization_data()->get(1))->value();
+  }
+  Handle<Code> code;
+  if (!wasm::CompileLazy(isolate, module_instance, stub, func_index)
+           .ToHandle(&code)) {
+    return isolate->PromoteScheduledException();
+  }
+  return *code;
+}
+
 RUNTIME_FUNCTION(Runtime_WasmThrowTypeError) {
   HandleScope scope(isolate);
   DCHECK_EQ(0, args.length());
@@ -6,12 +6,16 @@
 
 #include <memory>
 
+#include "src/base/functional.h"
 #include "src/code-stubs.h"
+#include "src/external-reference-table.h"
 #include "src/log.h"
 #include "src/macro-assembler.h"
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/snapshot.h"
+#include "src/tracing/trace-event.h"
 #include "src/version.h"
+#include "src/wasm/wasm-module.h"
 
 namespace v8 {
 namespace internal {
@@ -28,11 +32,30 @@ ScriptData* CodeSerializer::Serialize(Isolate* isolate,
     PrintF("]\n");
   }
 
+  List<Handle<SharedFunctionInfo>> lazy_functions;
+  List<Handle<Tuple3>> lazy_data;
+  if (FLAG_serialize_lazy_functions) {
+    SerializeLazyFunctions(isolate, info, source, &lazy_functions, &lazy_data);
+  }
+
   // Serialize code object.
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(source));
   DisallowHeapAllocation no_gc;
+  // Lazy functions are serialized as if they were not compiled yet, with
+  // their payload as function data. Their state is restored afterwards.
+  List<Code*> lazy_code(lazy_functions.length());
+  Code* compile_lazy = isolate->builtins()->builtin(Builtins::kCompileLazy);
+  for (int i = 0; i < lazy_functions.length(); i++) {
+    lazy_code.Add(lazy_functions[i]->code());
+    lazy_functions[i]->set_code(compile_lazy);
+    lazy_functions[i]->set_function_data(*lazy_data[i]);
+  }
   cs.reference_map()->AddAttachedReference(*source);
   ScriptData* ret = cs.Serialize(info);
+  for (int i = 0; i < lazy_functions.length(); i++) {
+    lazy_functions[i]->set_code(lazy_code[i]);
+    lazy_functions[i]->set_function_data(isolate->heap()->undefined_value());
+  }
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -43,6 +66,52 @@ ScriptData* CodeSerializer::Serialize(Isolate* isolate,
   return ret;
 }
 
+void CodeSerializer::SerializeLazyFunctions(
+    Isolate* isolate, Handle<SharedFunctionInfo> toplevel,
+    Handle<String> source, List<Handle<SharedFunctionInfo>>* functions,
+    List<Handle<Tuple3>>* data) {
+  if (!toplevel->script()->IsScript()) return;
+  Factory* factory = isolate->factory();
+  Handle<Script> script(Script::cast(toplevel->script()), isolate);
+
+  // The payloads refer to shared function infos of the script through this
+  // table, which is part of the main payload.
+  List<Handle<SharedFunctionInfo>> infos;
+  WeakFixedArray::Iterator iterator(script->shared_function_infos());
+  SharedFunctionInfo* shared;
+  while ((shared = iterator.Next<SharedFunctionInfo>())) {
+    infos.Add(handle(shared, isolate));
+  }
+  Handle<FixedArray> table = factory->NewFixedArray(infos.length(), TENURED);
+  for (int i = 0; i < infos.length(); i++) table->set(i, *infos[i]);
+
+  uint32_t source_hash = SerializedCodeData::SourceHash(source);
+  for (int i = 0; i < infos.length(); i++) {
+    Handle<SharedFunctionInfo> info = infos[i];
+    if (info.is_identical_to(toplevel)) continue;
+    if (info->code()->kind() != Code::FUNCTION) continue;
+    if (!info->function_data()->IsUndefined(isolate)) continue;
+    if (info->HasDebugInfo()) continue;
+
+    ScriptData* script_data;
+    {
+      CodeSerializer cs(isolate, source_hash);
+      cs.reference_map()->AddAttachedReference(*source);
+      for (int j = 0; j < infos.length(); j++) {
+        cs.reference_map()->AddAttachedReference(*infos[j]);
+      }
+      script_data = cs.Serialize(handle(info->code(), isolate));
+    }
+    Handle<ByteArray> payload =
+        factory->NewByteArray(script_data->length(), TENURED);
+    payload->copy_in(0, script_data->data(), script_data->length());
+    delete script_data;
+
+    functions->Add(info);
+    data->Add(factory->NewTuple3(payload, table, factory->undefined_value()));
+  }
+}
+
 ScriptData* CodeSerializer::Serialize(Handle<HeapObject> obj) {
   DisallowHeapAllocation no_gc;
 
@@ -161,6 +230,8 @@ void CodeSerializer::SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     Isolate* isolate, ScriptData* cached_data, Handle<String> source) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"),
+               "V8.DeserializeCodeCache");
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
@@ -216,21 +287,106 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   return scope.CloseAndEscape(result);
 }
 
+MaybeHandle<Code> CodeSerializer::DeserializeLazyFunction(
+    Isolate* isolate, Handle<SharedFunctionInfo> shared) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"),
+               "V8.DeserializeLazyFunction");
+  base::ElapsedTimer timer;
+  if (FLAG_profile_deserialization) timer.Start();
+
+  Handle<Tuple3> data(shared->lazy_deserialization_data(), isolate);
+  shared->ClearLazyDeserializationData();
+  if (!shared->script()->IsScript()) return MaybeHandle<Code>();
+  Handle<Script> script(Script::cast(shared->script()), isolate);
+  if (!script->source()->IsString()) return MaybeHandle<Code>();
+  Handle<String> source(String::cast(script->source()), isolate);
+
+  // The payload may move during deserialization, so work on a copy.
+  ByteArray* payload = ByteArray::cast(data->value1());
+  int length = payload->length();
+  byte* copy = NewArray<byte>(length);
+  payload->copy_out(0, copy, length);
+  ScriptData cached_data(copy, length);
+  cached_data.AcquireDataOwnership();
+
+  SerializedCodeData::SanityCheckResult sanity_check_result =
+      SerializedCodeData::CHECK_SUCCESS;
+  const SerializedCodeData scd = SerializedCodeData::FromCachedData(
+      isolate, &cached_data, SerializedCodeData::SourceHash(source),
+      &sanity_check_result);
+  if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
+    if (FLAG_profile_deserialization) PrintF("[Lazy code failed check]\n");
+    return MaybeHandle<Code>();
+  }
+
+  Deserializer deserializer(&scd);
+  deserializer.AddAttachedObject(source);
+  Handle<FixedArray> table(FixedArray::cast(data->value2()), isolate);
+  for (int i = 0; i < table->length(); i++) {
+    deserializer.AddAttachedObject(handle(HeapObject::cast(table->get(i))));
+  }
+  Vector<const uint32_t> code_stub_keys = scd.CodeStubKeys();
+  for (int i = 0; i < code_stub_keys.length(); i++) {
+    deserializer.AddAttachedObject(
+        CodeStub::GetCode(isolate, code_stub_keys[i]).ToHandleChecked());
+  }
+
+  Handle<HeapObject> as_heap_object;
+  if (!deserializer.DeserializeObject(isolate).ToHandle(&as_heap_object)) {
+    if (FLAG_profile_deserialization) PrintF("[Deserializing failed]\n");
+    return MaybeHandle<Code>();
+  }
+  Handle<Code> code = Handle<Code>::cast(as_heap_object);
+  DCHECK_EQ(Code::FUNCTION, code->kind());
+  if (FLAG_profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Deserializing lazy function from %d bytes took %0.3f ms]\n",
+           length, ms);
+  }
+
+  if (isolate->logger()->is_logging_code_events() || isolate->is_profiling()) {
+    String* name = isolate->heap()->empty_string();
+    if (script->name()->IsString()) name = String::cast(script->name());
+    PROFILE(isolate, CodeCreateEvent(CodeEventListener::LAZY_COMPILE_TAG,
+                                     AbstractCode::cast(*code), *shared, name));
+  }
+  return code;
+}
+
 std::unique_ptr<ScriptData> WasmCompiledModuleSerializer::SerializeWasmModule(
     Isolate* isolate, Handle<FixedArray> compiled_module) {
-  WasmCompiledModuleSerializer wasm_cs(isolate, 0);
+  Handle<wasm::WasmCompiledModule> wasm_compiled_module =
+      Handle<wasm::WasmCompiledModule>::cast(compiled_module);
+  uint32_t source_hash = 0;
+  Object* wire_bytes = nullptr;
+  if (wasm_compiled_module->has_module_bytes()) {
+    SeqOneByteString* bytes = wasm_compiled_module->ptr_to_module_bytes();
+    source_hash = SerializedCodeData::SourceHash(
+        Vector<const byte>(bytes->GetChars(), bytes->length()));
+    wire_bytes = bytes;
+  }
+  WasmCompiledModuleSerializer wasm_cs(isolate, source_hash, wire_bytes);
   wasm_cs.reference_map()->AddAttachedReference(*isolate->native_context());
   ScriptData* data = wasm_cs.Serialize(compiled_module);
   return std::unique_ptr<ScriptData>(data);
 }
 
 MaybeHandle<FixedArray> WasmCompiledModuleSerializer::DeserializeWasmModule(
-    Isolate* isolate, ScriptData* data) {
+    Isolate* isolate, ScriptData* data, Vector<const byte> wire_bytes) {
   SerializedCodeData::SanityCheckResult sanity_check_result =
       SerializedCodeData::CHECK_SUCCESS;
   MaybeHandle<FixedArray> nothing;
+  uint32_t expected_source_hash;
+  if (wire_bytes.is_empty()) {
+    // Without wire bytes, accept whatever source hash the data carries.
+    if (data->length() < SerializedCodeData::kHeaderSize) return nothing;
+    expected_source_hash = SerializedCodeData(data).GetHeaderValue(
+        SerializedCodeData::kSourceHashOffset);
+  } else {
+    expected_source_hash = SerializedCodeData::SourceHash(wire_bytes);
+  }
   const SerializedCodeData scd = SerializedCodeData::FromCachedData(
-      isolate, data, 0, &sanity_check_result);
+      isolate, data, expected_source_hash, &sanity_check_result);
 
   if (sanity_check_result != SerializedCodeData::CHECK_SUCCESS) {
     return nothing;
@@ -247,7 +403,18 @@ MaybeHandle<FixedArray> WasmCompiledModuleSerializer::DeserializeWasmModule(
 
   MaybeHandle<HeapObject> obj = deserializer.DeserializeObject(isolate);
   if (obj.is_null() || !obj.ToHandleChecked()->IsFixedArray()) return nothing;
-  return Handle<FixedArray>::cast(obj.ToHandleChecked());
+  Handle<FixedArray> compiled_module =
+      Handle<FixedArray>::cast(obj.ToHandleChecked());
+  if (!wire_bytes.is_empty()) {
+    Handle<String> module_bytes =
+        isolate->factory()
+            ->NewStringFromOneByte(wire_bytes, TENURED)
+            .ToHandleChecked();
+    DCHECK(module_bytes->IsSeqOneByteString());
+    Handle<wasm::WasmCompiledModule>::cast(compiled_module)
+        ->set_module_bytes(Handle<SeqOneByteString>::cast(module_bytes));
+  }
+  return compiled_module;
 }
 
 class Checksum {
@@ -340,6 +507,18 @@ SerializedCodeData::SerializedCodeData(const List<byte>* payload,
 
 SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
     Isolate* isolate, uint32_t expected_source_hash) const {
+  SanityCheckResult result =
+      SanityCheckWithoutChecksum(isolate, expected_source_hash);
+  if (result != CHECK_SUCCESS) return result;
+  uint32_t c1 = GetHeaderValue(kChecksum1Offset);
+  uint32_t c2 = GetHeaderValue(kChecksum2Offset);
+  if (!Checksum(DataWithoutHeader()).Check(c1, c2)) return CHECKSUM_MISMATCH;
+  return CHECK_SUCCESS;
+}
+
+SerializedCodeData::SanityCheckResult
+SerializedCodeData::SanityCheckWithoutChecksum(
+    Isolate* isolate, uint32_t expected_source_hash) const {
   if (this->size_ < kHeaderSize) return INVALID_HEADER;
   uint32_t magic_number = GetMagicNumber();
   if (magic_number != ComputeMagicNumber(isolate)) return MAGIC_NUMBER_MISMATCH;
@@ -347,15 +526,12 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
   uint32_t source_hash = GetHeaderValue(kSourceHashOffset);
   uint32_t cpu_features = GetHeaderValue(kCpuFeaturesOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
-  uint32_t c1 = GetHeaderValue(kChecksum1Offset);
-  uint32_t c2 = GetHeaderValue(kChecksum2Offset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
   if (source_hash != expected_source_hash) return SOURCE_MISMATCH;
   if (cpu_features != static_cast<uint32_t>(CpuFeatures::SupportedFeatures())) {
     return CPU_FEATURES_MISMATCH;
   }
   if (flags_hash != FlagList::Hash()) return FLAGS_MISMATCH;
-  if (!Checksum(DataWithoutHeader()).Check(c1, c2)) return CHECKSUM_MISMATCH;
   return CHECK_SUCCESS;
 }
 
@@ -363,6 +539,11 @@ uint32_t SerializedCodeData::SourceHash(Handle<String> source) {
   return source->length();
 }
 
+uint32_t SerializedCodeData::SourceHash(Vector<const byte> wire_bytes) {
+  return static_cast<uint32_t>(
+      base::hash_range(wire_bytes.begin(), wire_bytes.end()));
+}
+
 // Return ScriptData object and relinquish ownership over it to the caller.
 ScriptData* SerializedCodeData::GetScriptData() {
   DCHECK(owns_data_);
@@ -407,7 +588,12 @@ const SerializedCodeData SerializedCodeData::FromCachedData(
     SanityCheckResult* rejection_result) {
   DisallowHeapAllocation no_gc;
   SerializedCodeData scd(cached_data);
-  *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  if (cached_data->checked()) {
+    *rejection_result =
+        scd.SanityCheckWithoutChecksum(isolate, expected_source_hash);
+  } else {
+    *rejection_result = scd.SanityCheck(isolate, expected_source_hash);
+  }
   if (*rejection_result != CHECK_SUCCESS) {
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
@@ -415,5 +601,30 @@ const SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+BackgroundCodeCacheCheckTask::BackgroundCodeCacheCheckTask(
+    Isolate* isolate, ScriptCompiler::Source* source, uint32_t source_hash)
+    : isolate_(isolate), source_(source), source_hash_(source_hash) {
+  // The external reference table is created lazily. Make sure this does not
+  // happen on the background thread.
+  ExternalReferenceTable::instance(isolate);
+}
+
+void BackgroundCodeCacheCheckTask::Run() {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+
+  ScriptCompiler::CachedData* cached_data = source_->cached_data;
+  // ScriptData takes care of pointer-aligning the data.
+  ScriptData script_data(cached_data->data, cached_data->length);
+  SerializedCodeData scd(&script_data);
+  if (scd.SanityCheck(isolate_, source_hash_) ==
+      SerializedCodeData::CHECK_SUCCESS) {
+    source_->cached_data_checked = true;
+  } else {
+    cached_data->rejected = true;
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -22,6 +22,12 @@ class CodeSerializer : public Serializer {
   MUST_USE_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
       Isolate* isolate, ScriptData* cached_data, Handle<String> source);
 
+  // Deserializes the code of an inner function that was left out of the
+  // code cache with --serialize-lazy-functions. Called on the first call of
+  // the function. Its payload is consumed whether this succeeds or not.
+  MUST_USE_RESULT static MaybeHandle<Code> DeserializeLazyFunction(
+      Isolate* isolate, Handle<SharedFunctionInfo> shared);
+
   const List<uint32_t>* stub_keys() const { return &stub_keys_; }
 
   uint32_t source_hash() const { return source_hash_; }
@@ -49,6 +55,14 @@ class CodeSerializer : public Serializer {
   void SerializeCodeStub(Code* code_stub, HowToCode how_to_code,
                          WhereToPoint where_to_point);
 
+  // Serializes the code of each eagerly compiled inner function of the script
+  // of {toplevel} into a payload of its own. Collects the functions and
+  // their lazy deserialization data.
+  static void SerializeLazyFunctions(
+      Isolate* isolate, Handle<SharedFunctionInfo> toplevel,
+      Handle<String> source, List<Handle<SharedFunctionInfo>>* functions,
+      List<Handle<Tuple3>>* data);
+
   DisallowHeapAllocation no_gc_;
   uint32_t source_hash_;
   List<uint32_t> stub_keys_;
@@ -57,10 +71,17 @@ class CodeSerializer : public Serializer {
 
 class WasmCompiledModuleSerializer : public CodeSerializer {
  public:
+  // Serializes the compiled code, relocation info and function tables of a
+  // compiled module. The wire bytes are not included, but the data is keyed
+  // on a hash of them.
   static std::unique_ptr<ScriptData> SerializeWasmModule(
       Isolate* isolate, Handle<FixedArray> compiled_module);
-  static MaybeHandle<FixedArray> DeserializeWasmModule(Isolate* isolate,
-                                                       ScriptData* data);
+  // Deserializes a compiled module and attaches {wire_bytes} to it. Fails if
+  // the data was produced by a different V8 version, with different flags,
+  // or for different wire bytes. If {wire_bytes} is empty, the wire bytes
+  // are not checked and the resulting module has none.
+  static MaybeHandle<FixedArray> DeserializeWasmModule(
+      Isolate* isolate, ScriptData* data, Vector<const byte> wire_bytes);
 
  protected:
   void SerializeCodeObject(Code* code_object, HowToCode how_to_code,
@@ -74,14 +95,40 @@ class WasmCompiledModuleSerializer : public CodeSerializer {
     }
   }
 
-  bool ElideObject(Object* obj) override { return obj->IsWeakCell(); };
+  bool ElideObject(Object* obj) override {
+    return obj->IsWeakCell() || obj == wire_bytes_;
+  };
 
  private:
-  WasmCompiledModuleSerializer(Isolate* isolate, uint32_t source_hash)
-      : CodeSerializer(isolate, source_hash) {}
+  WasmCompiledModuleSerializer(Isolate* isolate, uint32_t source_hash,
+                               Object* wire_bytes)
+      : CodeSerializer(isolate, source_hash), wire_bytes_(wire_bytes) {}
+
+  Object* wire_bytes_;
   DISALLOW_COPY_AND_ASSIGN(WasmCompiledModuleSerializer);
 };
 
+// Internal implementation of v8::ScriptCompiler::ConsumeCodeCacheTask. Runs
+// the checks of SerializedCodeData that do not need the heap, most notably
+// the payload checksum, so that consuming the data later on the main thread
+// only has to deserialize it.
+class BackgroundCodeCacheCheckTask
+    : public ScriptCompiler::ConsumeCodeCacheTask {
+ public:
+  BackgroundCodeCacheCheckTask(Isolate* isolate,
+                               ScriptCompiler::Source* source,
+                               uint32_t source_hash);
+
+  void Run() override;
+
+ private:
+  Isolate* isolate_;
+  ScriptCompiler::Source* source_;  // Not owned.
+  uint32_t source_hash_;
+
+  DISALLOW_COPY_AND_ASSIGN(BackgroundCodeCacheCheckTask);
+};
+
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
 class SerializedCodeData : public SerializedData {
  public:
@@ -113,8 +160,12 @@ class SerializedCodeData : public SerializedData {
   Vector<const uint32_t> CodeStubKeys() const;
 
   static uint32_t SourceHash(Handle<String> source);
+  static uint32_t SourceHash(Vector<const byte> wire_bytes);
 
  private:
+  friend class BackgroundCodeCacheCheckTask;
+  friend class WasmCompiledModuleSerializer;
+
   explicit SerializedCodeData(ScriptData* data);
   SerializedCodeData(const byte* data, int size)
       : SerializedData(const_cast<byte*>(data), size) {}
@@ -125,6 +176,10 @@ class SerializedCodeData : public SerializedData {
 
   SanityCheckResult SanityCheck(Isolate* isolate,
                                 uint32_t expected_source_hash) const;
+  // Same as SanityCheck, but trusts the payload checksum. Used for data that
+  // was already checked by a BackgroundCodeCacheCheckTask.
+  SanityCheckResult SanityCheckWithoutChecksum(
+      Isolate* isolate, uint32_t expected_source_hash) const;
   // The data header consists of uint32_t-sized entries:
   // [0] magic number and external reference count
   // [1] version hash
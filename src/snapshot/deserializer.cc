@@ -30,10 +30,11 @@ void Deserializer::DecodeReservation(
 
 void Deserializer::FlushICacheForNewIsolate() {
   DCHECK(!deserializing_user_code_);
-  // The entire isolate is newly deserialized. Simply flush all code pages.
-  for (Page* p : *isolate_->heap()->code_space()) {
-    Assembler::FlushICache(isolate_, p->area_start(),
-                           p->area_end() - p->area_start());
+  // The entire isolate is newly deserialized. All code objects were
+  // allocated in the reserved chunks, so flushing those is sufficient and
+  // avoids flushing the unused remainder of the code pages.
+  for (const Heap::Chunk& chunk : reservations_[CODE_SPACE]) {
+    Assembler::FlushICache(isolate_, chunk.start, chunk.end - chunk.start);
   }
 }
 
@@ -284,6 +285,9 @@ HeapObject* Deserializer::PostProcessNewObject(HeapObject* obj, int space) {
     }
     isolate_->heap()->set_allocation_sites_list(site);
   } else if (obj->IsCode()) {
+    // The deserialized code is not registered with the trap handler, even if
+    // the serialized code was.
+    Code::cast(obj)->set_trap_handler_index(-1);
     // We flush all code pages after deserializing the startup snapshot. In that
     // case, we only need to remember code objects in the large object space.
     // When deserializing user code, remember each individual code object.
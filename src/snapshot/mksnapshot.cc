@@ -134,6 +134,47 @@ char* GetExtraCode(char* filename, const char* description) {
   return chars;
 }
 
+bool RunContextScript(Isolate* isolate, Local<Context> context,
+                      const char* utf8_source, const char* name) {
+  Context::Scope context_scope(context);
+  TryCatch try_catch(isolate);
+  Local<String> source_string;
+  if (!String::NewFromUtf8(isolate, utf8_source, NewStringType::kNormal)
+           .ToLocal(&source_string)) {
+    return false;
+  }
+  Local<String> resource_name =
+      String::NewFromUtf8(isolate, name, NewStringType::kNormal)
+          .ToLocalChecked();
+  ScriptOrigin origin(resource_name);
+  ScriptCompiler::Source source(source_string, origin);
+  Local<Script> script;
+  if (!ScriptCompiler::Compile(context, &source).ToLocal(&script)) return false;
+  if (script->Run(context).IsEmpty()) return false;
+  CHECK(!try_catch.HasCaught());
+  return true;
+}
+
+// Creates a snapshot with one context per script. The context for the first
+// script is the default context, the others can be instantiated by their
+// position in {scripts} with v8::Context::FromSnapshot.
+StartupData CreateMultiContextSnapshotDataBlob(const i::List<char*>& scripts) {
+  StartupData result = {nullptr, 0};
+  SnapshotCreator snapshot_creator;
+  Isolate* isolate = snapshot_creator.GetIsolate();
+  for (int i = 0; i < scripts.length(); i++) {
+    HandleScope scope(isolate);
+    Local<Context> context = Context::New(isolate);
+    if (scripts[i] != NULL &&
+        !RunContextScript(isolate, context, scripts[i], "<embedded>")) {
+      return result;
+    }
+    CHECK_EQ(static_cast<size_t>(i), snapshot_creator.AddContext(context));
+  }
+  return snapshot_creator.CreateBlob(
+      SnapshotCreator::FunctionCodeHandling::kClear);
+}
+
 
 int main(int argc, char** argv) {
   // Make mksnapshot runs predictable to create reproducible snapshots.
@@ -142,9 +183,15 @@ int main(int argc, char** argv) {
   // Print the usage if an error occurs when parsing the command line
   // flags or if the help flag is set.
   int result = i::FlagList::SetFlagsFromCommandLine(&argc, argv, true);
-  if (result > 0 || (argc > 3) || i::FLAG_help) {
-    ::printf("Usage: %s --startup_src=... --startup_blob=... [extras]\n",
-             argv[0]);
+  if (result > 0 || i::FLAG_help) {
+    ::printf(
+        "Usage: %s --startup_src=... --startup_blob=... [embed script] "
+        "[warm up script] [context script]...\n"
+        "The arguments are positional. Every context script adds another "
+        "context\nto the snapshot, and cannot be combined with a warm up "
+        "script. Pass \"\" as\nthe warm up script to only use context "
+        "scripts.\n",
+        argv[0]);
     i::FlagList::PrintHelp();
     return !i::FLAG_help;
   }
@@ -161,10 +208,28 @@ int main(int argc, char** argv) {
     if (i::FLAG_startup_blob) writer.SetStartupBlobFile(i::FLAG_startup_blob);
 
     char* embed_script = GetExtraCode(argc >= 2 ? argv[1] : NULL, "embedding");
-    StartupData blob = v8::V8::CreateSnapshotDataBlob(embed_script);
-    delete[] embed_script;
-
     char* warmup_script = GetExtraCode(argc >= 3 ? argv[2] : NULL, "warm up");
+
+    StartupData blob;
+    if (argc > 3) {
+      // Warming up keeps only one fresh context, so it cannot be combined
+      // with additional contexts.
+      if (warmup_script) {
+        fprintf(stderr, "Context scripts cannot be used with warm up.\n");
+        exit(1);
+      }
+      i::List<char*> scripts(argc - 2);
+      scripts.Add(embed_script);
+      for (int i = 3; i < argc; i++) {
+        scripts.Add(GetExtraCode(argv[i], "context"));
+      }
+      blob = CreateMultiContextSnapshotDataBlob(scripts);
+      for (char* script : scripts) delete[] script;
+    } else {
+      blob = v8::V8::CreateSnapshotDataBlob(embed_script);
+      delete[] embed_script;
+    }
+
     if (warmup_script) {
       StartupData cold = blob;
       blob = v8::V8::WarmUpSnapshotDataBlob(cold, warmup_script);
@@ -0,0 +1,106 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/snapshot/shared-code-cache.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/flags.h"
+#include "src/objects-inl.h"
+#include "src/parsing/preparse-data.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+struct CacheEntries {
+  std::unordered_map<std::string, std::vector<byte>> entries;
+  size_t size = 0;
+};
+
+base::LazyInstance<CacheEntries>::type cache = LAZY_INSTANCE_INITIALIZER;
+base::LazyMutex cache_mutex = LAZY_MUTEX_INITIALIZER;
+
+template <typename T>
+void AppendBytes(std::string* key, const T* data, size_t length) {
+  key->append(reinterpret_cast<const char*>(data), length * sizeof(T));
+}
+
+void AppendString(std::string* key, String* string) {
+  DisallowHeapAllocation no_gc;
+  int length = string->length();
+  AppendBytes(key, &length, 1);
+  String::FlatContent content = string->GetFlatContent();
+  if (content.IsOneByte()) {
+    key->push_back('1');
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    AppendBytes(key, chars.start(), chars.length());
+  } else {
+    key->push_back('2');
+    Vector<const uc16> chars = content.ToUC16Vector();
+    AppendBytes(key, chars.start(), chars.length());
+  }
+}
+
+}  // namespace
+
+SharedCodeCache::Key SharedCodeCache::KeyFor(
+    Handle<String> source, Handle<Object> script_name, int line_offset,
+    int column_offset, ScriptOriginOptions origin_options) {
+  Key key;
+  uint32_t flag_hash = FlagList::Hash();
+  int origin_flags = origin_options.Flags();
+  AppendBytes(&key, &flag_hash, 1);
+  AppendBytes(&key, &line_offset, 1);
+  AppendBytes(&key, &column_offset, 1);
+  AppendBytes(&key, &origin_flags, 1);
+  if (!script_name.is_null() && script_name->IsString()) {
+    AppendString(&key, String::cast(*String::Flatten(
+                           Handle<String>::cast(script_name))));
+  } else {
+    key.push_back('-');
+  }
+  AppendString(&key, *String::Flatten(source));
+  return key;
+}
+
+ScriptData* SharedCodeCache::Lookup(const Key& key) {
+  base::LockGuard<base::Mutex> guard(cache_mutex.Pointer());
+  auto it = cache.Get().entries.find(key);
+  if (it == cache.Get().entries.end()) return nullptr;
+  const std::vector<byte>& bytes = it->second;
+  byte* copy = NewArray<byte>(bytes.size());
+  CopyBytes(copy, bytes.data(), bytes.size());
+  ScriptData* data = new ScriptData(copy, static_cast<int>(bytes.size()));
+  data->AcquireDataOwnership();
+  return data;
+}
+
+bool SharedCodeCache::Contains(const Key& key) {
+  base::LockGuard<base::Mutex> guard(cache_mutex.Pointer());
+  return cache.Get().entries.count(key) != 0;
+}
+
+void SharedCodeCache::Insert(const Key& key, const ScriptData* data) {
+  base::LockGuard<base::Mutex> guard(cache_mutex.Pointer());
+  CacheEntries* entries = cache.Pointer();
+  size_t size = key.size() + static_cast<size_t>(data->length());
+  if (entries->size + size > kMaxSize) return;
+  auto result = entries->entries.insert(std::make_pair(
+      key, std::vector<byte>(data->data(), data->data() + data->length())));
+  if (result.second) entries->size += size;
+}
+
+void SharedCodeCache::Clear() {
+  base::LockGuard<base::Mutex> guard(cache_mutex.Pointer());
+  cache.Pointer()->entries.clear();
+  cache.Pointer()->size = 0;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_SNAPSHOT_SHARED_CODE_CACHE_H_
+#define V8_SNAPSHOT_SHARED_CODE_CACHE_H_
+
+#include <string>
+
+#include "src/allocation.h"
+#include "src/handles.h"
+#include "src/objects.h"
+
+namespace v8 {
+namespace internal {
+
+class ScriptData;
+
+// A process-wide cache of code cache data, shared by all isolates. With
+// --shared-code-cache, scripts compiled without embedder-provided cached data
+// are serialized with the CodeSerializer after their first compilation, and
+// other isolates compiling the same script deserialize that data instead of
+// compiling it again. Entries are keyed by the source, the script origin and
+// the flag hash; the deserializer still performs its usual sanity checks.
+class SharedCodeCache : public AllStatic {
+ public:
+  typedef std::string Key;
+
+  static Key KeyFor(Handle<String> source, Handle<Object> script_name,
+                    int line_offset, int column_offset,
+                    ScriptOriginOptions origin_options);
+
+  // Returns a copy of the cached data for the key that is owned by the
+  // caller, or nullptr if there is none.
+  static ScriptData* Lookup(const Key& key);
+
+  static bool Contains(const Key& key);
+
+  // Copies the data into the cache, unless there already is an entry for the
+  // key or the cache is full.
+  static void Insert(const Key& key, const ScriptData* data);
+
+  // Drops all entries. Used by tests.
+  static void Clear();
+
+ private:
+  // Once the cached data reaches this size, no more entries are added.
+  static const size_t kMaxSize = 64 * MB;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_SNAPSHOT_SHARED_CODE_CACHE_H_
@@ -11,6 +11,7 @@
 #include "src/full-codegen/full-codegen.h"
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/snapshot-source-sink.h"
+#include "src/tracing/trace-event.h"
 #include "src/version.h"
 
 namespace v8 {
@@ -53,6 +54,8 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
     Isolate* isolate, Handle<JSGlobalProxy> global_proxy,
     size_t context_index) {
   if (!isolate->snapshot_available()) return Handle<Context>();
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.startup"),
+               "V8.DeserializeContext");
   base::ElapsedTimer timer;
   if (FLAG_profile_deserialization) timer.Start();
 
@@ -32,7 +32,11 @@ struct PositionTableEntry {
 
 class SourcePositionTableBuilder {
  public:
-  enum RecordingMode { OMIT_SOURCE_POSITIONS, RECORD_SOURCE_POSITIONS };
+  enum RecordingMode {
+    OMIT_SOURCE_POSITIONS,
+    LAZY_SOURCE_POSITIONS,
+    RECORD_SOURCE_POSITIONS
+  };
 
   SourcePositionTableBuilder(Zone* zone,
                              RecordingMode mode = RECORD_SOURCE_POSITIONS);
@@ -42,10 +46,13 @@ class SourcePositionTableBuilder {
   Handle<ByteArray> ToSourcePositionTable(Isolate* isolate,
                                           Handle<AbstractCode> code);
 
+  // Whether the source positions are omitted only to be collected later.
+  inline bool Lazy() const { return mode_ == LAZY_SOURCE_POSITIONS; }
+
  private:
   void AddEntry(const PositionTableEntry& entry);
 
-  inline bool Omit() const { return mode_ == OMIT_SOURCE_POSITIONS; }
+  inline bool Omit() const { return mode_ != RECORD_SOURCE_POSITIONS; }
 
   RecordingMode mode_;
   ZoneVector<byte> bytes_;
@@ -23,6 +23,11 @@ namespace {
 v8::StartupData g_natives;
 v8::StartupData g_snapshot;
 
+// The blob files, if they could be mapped into memory. Otherwise the blobs
+// are read into heap allocated buffers.
+base::OS::MemoryMappedFile* g_natives_file = nullptr;
+base::OS::MemoryMappedFile* g_snapshot_file = nullptr;
+
 
 void ClearStartupData(v8::StartupData* data) {
   data->data = nullptr;
@@ -30,24 +35,47 @@ void ClearStartupData(v8::StartupData* data) {
 }
 
 
-void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
+void DeleteStartupData(v8::StartupData* data,
+                       base::OS::MemoryMappedFile** mapped_file) {
+  if (*mapped_file != nullptr) {
+    delete *mapped_file;
+    *mapped_file = nullptr;
+  } else {
+    delete[] data->data;
+  }
   ClearStartupData(data);
 }
 
 
 void FreeStartupData() {
-  DeleteStartupData(&g_natives);
-  DeleteStartupData(&g_snapshot);
+  DeleteStartupData(&g_natives, &g_natives_file);
+  DeleteStartupData(&g_snapshot, &g_snapshot_file);
 }
 
 
 void Load(const char* blob_file, v8::StartupData* startup_data,
+          base::OS::MemoryMappedFile** mapped_file,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
+  // Map the blob read-only, so that only the pages which are actually touched
+  // during deserialization are read from disk and the pages can be shared
+  // between processes.
+  *mapped_file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (*mapped_file != nullptr) {
+    if ((*mapped_file)->size() > 0) {
+      startup_data->data = static_cast<const char*>((*mapped_file)->memory());
+      startup_data->raw_size = static_cast<int>((*mapped_file)->size());
+      (*setter_fn)(startup_data);
+      return;
+    }
+    delete *mapped_file;
+    *mapped_file = nullptr;
+  }
+
   FILE* file = fopen(blob_file, "rb");
   if (!file) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
@@ -72,8 +100,9 @@ void Load(const char* blob_file, v8::StartupData* startup_data,
 
 
 void LoadFromFiles(const char* natives_blob, const char* snapshot_blob) {
-  Load(natives_blob, &g_natives, v8::V8::SetNativesDataBlob);
-  Load(snapshot_blob, &g_snapshot, v8::V8::SetSnapshotDataBlob);
+  Load(natives_blob, &g_natives, &g_natives_file, v8::V8::SetNativesDataBlob);
+  Load(snapshot_blob, &g_snapshot, &g_snapshot_file,
+       v8::V8::SetSnapshotDataBlob);
 
   atexit(&FreeStartupData);
 }
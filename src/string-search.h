@@ -279,6 +279,9 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   Vector<const PatternChar> pattern = search->pattern_;
   DCHECK(pattern.length() > 1);
   int pattern_length = pattern.length();
+  // Checking the last character before the full comparison rejects most
+  // candidates that only share the first character with the pattern.
+  const PatternChar last_char = pattern[pattern_length - 1];
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
@@ -286,6 +289,7 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
     if (i == -1) return -1;
     DCHECK_LE(i, n);
     i++;
+    if (subject[i + pattern_length - 2] != last_char) continue;
     // Loop extracted to separate function to allow using return to do
     // a deeper break.
     if (CharCompare(pattern.start() + 1,
@@ -0,0 +1,78 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// PLEASE READ BEFORE CHANGING THIS FILE!
+//
+// This file implements the out of bounds signal handler for WebAssembly.
+// Code here runs in a signal handler, so it must be async-signal-safe: it may
+// not allocate, take regular locks or call into the rest of V8. Anything which
+// does not run in the signal handler belongs in handler-outside.cc.
+
+#include "src/trap-handler/trap-handler-internal.h"
+
+#if V8_TRAP_HANDLER_SUPPORTED
+#include <ucontext.h>
+#endif
+
+namespace v8 {
+namespace internal {
+namespace trap_handler {
+
+base::Atomic32 MetadataLock::spinlock_ = 0;
+
+MetadataLock::MetadataLock() {
+  while (base::Acquire_CompareAndSwap(&spinlock_, 0, 1) != 0) {
+  }
+}
+
+MetadataLock::~MetadataLock() { base::Release_Store(&spinlock_, 0); }
+
+#if V8_TRAP_HANDLER_SUPPORTED
+
+namespace {
+
+bool TryHandleSignal(int signum, siginfo_t* info, ucontext_t* context) {
+  // Only faults raised by the kernel can come from protected instructions;
+  // signals sent by kill() or raise() are left alone.
+  if (signum != SIGSEGV || info->si_code <= 0) return false;
+
+  uintptr_t fault_pc = context->uc_mcontext.gregs[REG_RIP];
+
+  MetadataLock lock_holder;
+  for (size_t i = 0; i < gNumCodeObjects; ++i) {
+    const CodeProtectionInfo* data = gCodeObjects[i];
+    if (data == nullptr) continue;
+    uintptr_t base = reinterpret_cast<uintptr_t>(data->base);
+    if (fault_pc < base || fault_pc >= base + data->size) continue;
+    // The fault is in this code object; look for the faulting instruction.
+    for (size_t j = 0; j < data->num_protected_instructions; ++j) {
+      if (data->instructions[j].instr_offset == fault_pc - base) {
+        // Continue at the landing pad, which throws the wasm trap.
+        context->uc_mcontext.gregs[REG_RIP] =
+            base + data->instructions[j].landing_offset;
+        return true;
+      }
+    }
+    return false;
+  }
+  return false;
+}
+
+}  // namespace
+
+void HandleSignal(int signum, siginfo_t* info, void* context) {
+  ucontext_t* uc = reinterpret_cast<ucontext_t*>(context);
+  if (!TryHandleSignal(signum, info, uc)) {
+    // This is not a wasm out of bounds access. Reinstate the previous action
+    // and return; the faulting instruction runs again and the fault goes to
+    // the previous handler, or crashes the process as usual.
+    sigaction(SIGSEGV, &gOldSigsegvAction, nullptr);
+  }
+}
+
+#endif  // V8_TRAP_HANDLER_SUPPORTED
+
+}  // namespace trap_handler
+}  // namespace internal
+}  // namespace v8
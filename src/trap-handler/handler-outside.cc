@@ -0,0 +1,123 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file implements the parts of the trap handler which run outside of the
+// signal handler: registering and releasing the metadata of code objects, and
+// installing the signal handler. See handler-inside.cc for the signal handler
+// itself.
+//
+// The metadata are shared by all isolates in the process, since a signal
+// handler is a process-wide resource. They are kept in the C heap and only
+// modified while holding the MetadataLock, so that the signal handler always
+// sees a consistent table.
+
+#include <string.h>
+
+#include "src/base/logging.h"
+#include "src/trap-handler/trap-handler-internal.h"
+
+namespace v8 {
+namespace internal {
+namespace trap_handler {
+
+CodeProtectionInfo** gCodeObjects = nullptr;
+size_t gNumCodeObjects = 0;
+
+#if V8_TRAP_HANDLER_SUPPORTED
+struct sigaction gOldSigsegvAction;
+#endif
+
+namespace {
+
+// The table is grown by doubling, starting at this many entries.
+const size_t kInitialCodeObjectSize = 1024;
+
+CodeProtectionInfo* CreateHandlerData(
+    void* base, size_t size, size_t num_protected_instructions,
+    const ProtectedInstructionData* protected_instructions) {
+  const size_t alloc_size =
+      sizeof(CodeProtectionInfo) +
+      num_protected_instructions * sizeof(ProtectedInstructionData);
+  CodeProtectionInfo* data =
+      reinterpret_cast<CodeProtectionInfo*>(malloc(alloc_size));
+  if (data == nullptr) return nullptr;
+  data->base = base;
+  data->size = size;
+  data->num_protected_instructions = num_protected_instructions;
+  memcpy(data->instructions, protected_instructions,
+         num_protected_instructions * sizeof(ProtectedInstructionData));
+  return data;
+}
+
+}  // namespace
+
+int RegisterHandlerData(
+    void* base, size_t size, size_t num_protected_instructions,
+    const ProtectedInstructionData* protected_instructions) {
+  CodeProtectionInfo* data = CreateHandlerData(
+      base, size, num_protected_instructions, protected_instructions);
+  if (data == nullptr) return -1;
+
+  MetadataLock lock;
+
+  // Reuse the first released slot, if there is one.
+  size_t i = 0;
+  while (i < gNumCodeObjects && gCodeObjects[i] != nullptr) ++i;
+
+  if (i == gNumCodeObjects) {
+    size_t new_size = gNumCodeObjects == 0 ? kInitialCodeObjectSize
+                                           : gNumCodeObjects * 2;
+    CodeProtectionInfo** new_objects = reinterpret_cast<CodeProtectionInfo**>(
+        realloc(gCodeObjects, new_size * sizeof(*gCodeObjects)));
+    if (new_objects == nullptr) {
+      free(data);
+      return -1;
+    }
+    memset(new_objects + gNumCodeObjects, 0,
+           (new_size - gNumCodeObjects) * sizeof(*gCodeObjects));
+    gCodeObjects = new_objects;
+    gNumCodeObjects = new_size;
+  }
+
+  DCHECK_NULL(gCodeObjects[i]);
+  gCodeObjects[i] = data;
+  return static_cast<int>(i);
+}
+
+void UpdateHandlerDataCodePointer(int index, void* base) {
+  MetadataLock lock;
+  DCHECK_LT(static_cast<size_t>(index), gNumCodeObjects);
+  CodeProtectionInfo* data = gCodeObjects[index];
+  DCHECK_NOT_NULL(data);
+  data->base = base;
+}
+
+void ReleaseHandlerData(int index) {
+  CodeProtectionInfo* data = nullptr;
+  {
+    MetadataLock lock;
+    DCHECK_LT(static_cast<size_t>(index), gNumCodeObjects);
+    data = gCodeObjects[index];
+    gCodeObjects[index] = nullptr;
+  }
+  // Free outside of the lock, so the signal handler is not kept waiting.
+  DCHECK_NOT_NULL(data);
+  free(data);
+}
+
+bool EnableTrapHandler() {
+#if V8_TRAP_HANDLER_SUPPORTED
+  struct sigaction action;
+  action.sa_sigaction = HandleSignal;
+  action.sa_flags = SA_SIGINFO;
+  sigemptyset(&action.sa_mask);
+  return sigaction(SIGSEGV, &action, &gOldSigsegvAction) == 0;
+#else
+  return false;
+#endif
+}
+
+}  // namespace trap_handler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,62 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_TRAP_HANDLER_TRAP_HANDLER_INTERNAL_H_
+#define V8_TRAP_HANDLER_TRAP_HANDLER_INTERNAL_H_
+
+// This file should not be included (even transitively) by files outside of
+// src/trap-handler.
+
+#include "src/base/atomicops.h"
+#include "src/trap-handler/trap-handler.h"
+
+#if V8_TRAP_HANDLER_SUPPORTED
+#include <signal.h>
+#endif
+
+namespace v8 {
+namespace internal {
+namespace trap_handler {
+
+// The metadata the signal handler needs for one registered code object.
+struct CodeProtectionInfo {
+  void* base;
+  size_t size;
+  size_t num_protected_instructions;
+  ProtectedInstructionData instructions[1];
+};
+
+// Guards gCodeObjects and gNumCodeObjects. The signal handler takes this lock
+// too, so it is a spin lock built on atomic operations, which are safe to use
+// in a signal handler. The code holding the lock never faults, so a thread
+// never takes the lock recursively from its own signal handler.
+class MetadataLock {
+ public:
+  MetadataLock();
+  ~MetadataLock();
+
+ private:
+  static base::Atomic32 spinlock_;
+
+  DISALLOW_COPY_AND_ASSIGN(MetadataLock);
+};
+
+// The registered code objects, indexed by the value returned from
+// RegisterHandlerData. Released slots hold nullptr.
+extern CodeProtectionInfo** gCodeObjects;
+extern size_t gNumCodeObjects;
+
+#if V8_TRAP_HANDLER_SUPPORTED
+// The SIGSEGV action which was installed before EnableTrapHandler. Faults the
+// trap handler does not recognize are passed on to it.
+extern struct sigaction gOldSigsegvAction;
+
+void HandleSignal(int signum, siginfo_t* info, void* context);
+#endif
+
+}  // namespace trap_handler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TRAP_HANDLER_TRAP_HANDLER_INTERNAL_H_
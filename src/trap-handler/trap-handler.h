@@ -0,0 +1,60 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_TRAP_HANDLER_TRAP_HANDLER_H_
+#define V8_TRAP_HANDLER_TRAP_HANDLER_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "src/base/build_config.h"
+#include "src/flags.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+namespace trap_handler {
+
+// Out of bounds accesses to WebAssembly memory are only caught by the signal
+// handler on Linux x64, where the memory is surrounded by guard regions.
+#if V8_TARGET_ARCH_X64 && V8_OS_LINUX && !V8_OS_ANDROID
+#define V8_TRAP_HANDLER_SUPPORTED 1
+#else
+#define V8_TRAP_HANDLER_SUPPORTED 0
+#endif
+
+// A memory access in WebAssembly code which may fault, and the offset of the
+// code which throws the out of bounds trap instead. Both offsets are relative
+// to the start of the instructions of the code object.
+struct ProtectedInstructionData {
+  uint32_t instr_offset;
+  uint32_t landing_offset;
+};
+
+// Registers the protected instructions of the code at [base, base + size).
+// Returns an index to pass to UpdateHandlerDataCodePointer and
+// ReleaseHandlerData, or -1 if the code could not be registered.
+int RegisterHandlerData(void* base, size_t size,
+                        size_t num_protected_instructions,
+                        const ProtectedInstructionData* protected_instructions);
+
+// Called when the GC moves a registered code object to {base}.
+void UpdateHandlerDataCodePointer(int index, void* base);
+
+// Removes the code with the given index. The index may be reused afterwards.
+void ReleaseHandlerData(int index);
+
+// Installs the signal handler which turns faults at protected instructions
+// into wasm traps. Returns false if the handler could not be installed.
+bool EnableTrapHandler();
+
+inline bool UseTrapHandler() {
+  return V8_TRAP_HANDLER_SUPPORTED && FLAG_wasm_trap_handler;
+}
+
+}  // namespace trap_handler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TRAP_HANDLER_TRAP_HANDLER_H_
@@ -10,6 +10,30 @@
 
 namespace unibrow {
 
+namespace {
+
+// Returns the length of the run of ASCII characters at the start of |stream|,
+// checking a word at a time where possible.
+size_t AsciiPrefixLength(const uint8_t* stream, size_t length) {
+  const uint8_t* start = stream;
+  const uint8_t* limit = stream + length;
+  const uintptr_t kNonAsciiMask = ~static_cast<uintptr_t>(0) / 0xFF * 0x80;
+  while (stream < limit &&
+         !v8::internal::IsAligned(reinterpret_cast<intptr_t>(stream),
+                                  sizeof(uintptr_t))) {
+    if (*stream > Utf8::kMaxOneByteChar) return stream - start;
+    ++stream;
+  }
+  while (stream + sizeof(uintptr_t) <= limit &&
+         !(*reinterpret_cast<const uintptr_t*>(stream) & kNonAsciiMask)) {
+    stream += sizeof(uintptr_t);
+  }
+  while (stream < limit && *stream <= Utf8::kMaxOneByteChar) ++stream;
+  return stream - start;
+}
+
+}  // namespace
+
 void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
                             const uint8_t* stream, size_t stream_length) {
   // Assume everything will fit in the buffer and stream won't be needed.
@@ -20,6 +44,25 @@ void Utf8DecoderBase::Reset(uint16_t* buffer, size_t buffer_length,
   // Loop until stream is read, writing to buffer as long as buffer has space.
   size_t utf16_length = 0;
   while (stream_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar) {
+      // ASCII characters don't need decoding and can't be two characters.
+      size_t ascii_length = AsciiPrefixLength(stream, stream_length);
+      if (writing_to_buffer) {
+        size_t buffered = buffer_length - utf16_length;
+        if (ascii_length < buffered) buffered = ascii_length;
+        v8::internal::CopyChars(buffer, stream, buffered);
+        buffer += buffered;
+        if (utf16_length + buffered == buffer_length) {
+          writing_to_buffer = false;
+          unbuffered_start_ = stream + buffered;
+          unbuffered_length_ = stream_length - buffered;
+        }
+      }
+      stream += ascii_length;
+      stream_length -= ascii_length;
+      utf16_length += ascii_length;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     DCHECK(cursor > 0 && cursor <= stream_length);
@@ -62,6 +105,16 @@ void Utf8DecoderBase::WriteUtf16Slow(const uint8_t* stream,
                                      size_t stream_length, uint16_t* data,
                                      size_t data_length) {
   while (data_length != 0) {
+    if (*stream <= Utf8::kMaxOneByteChar) {
+      size_t ascii_length = AsciiPrefixLength(stream, stream_length);
+      if (ascii_length > data_length) ascii_length = data_length;
+      v8::internal::CopyChars(data, stream, ascii_length);
+      stream += ascii_length;
+      stream_length -= ascii_length;
+      data += ascii_length;
+      data_length -= ascii_length;
+      continue;
+    }
     size_t cursor = 0;
     uint32_t character = Utf8::ValueOf(stream, stream_length, &cursor);
     // There's a total lack of bounds checking for stream
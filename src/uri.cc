@@ -168,12 +168,27 @@ bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
   return true;
 }
 
+bool ContainsEscapes(Isolate* isolate, Handle<String> uri) {
+  DisallowHeapAllocation no_gc;
+  String::FlatContent uri_content = uri->GetFlatContent();
+  if (uri_content.IsOneByte()) {
+    StringSearch<uint8_t, uint8_t> search(isolate, STATIC_CHAR_VECTOR("%"));
+    return search.Search(uri_content.ToOneByteVector(), 0) >= 0;
+  }
+  StringSearch<uint8_t, uc16> search(isolate, STATIC_CHAR_VECTOR("%"));
+  return search.Search(uri_content.ToUC16Vector(), 0) >= 0;
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Decode(Isolate* isolate, Handle<String> uri,
                                 bool is_uri) {
   uri = String::Flatten(uri);
-  List<uint8_t> one_byte_buffer;
+  // Strings without escape sequences decode to themselves.
+  if (!ContainsEscapes(isolate, uri)) return uri;
+
+  // The decoded string is never longer than the input.
+  List<uint8_t> one_byte_buffer(uri->length());
   List<uc16> two_byte_buffer;
 
   if (!IntoOneAndTwoByte(uri, is_uri, &one_byte_buffer, &two_byte_buffer)) {
@@ -266,11 +281,76 @@ void EncodePair(uc16 cc1, uc16 cc2, List<uint8_t>* buffer) {
   }
 }
 
+uint8_t* WriteEncodedOctet(uint8_t octet, uint8_t* dest) {
+  dest[0] = '%';
+  dest[1] = HexCharOfValue(octet >> 4);
+  dest[2] = HexCharOfValue(octet & 0x0F);
+  return dest + 3;
+}
+
+// One-byte strings contain no surrogates, so encoding cannot fail and the
+// length of the result can be computed up front.
+MaybeHandle<String> EncodeOneByte(Isolate* isolate, Handle<String> uri,
+                                  bool is_uri) {
+  int uri_length = uri->length();
+  int encoded_length = 0;
+  {
+    DisallowHeapAllocation no_gc;
+    Vector<const uint8_t> vector = uri->GetFlatContent().ToOneByteVector();
+    for (int k = 0; k < uri_length; k++) {
+      uint8_t c = vector[k];
+      if (IsUnescapePredicateInUriComponent(c) ||
+          (is_uri && IsUriSeparator(c))) {
+        encoded_length++;
+      } else if (c > unibrow::Utf8::kMaxOneByteChar) {
+        // Two UTF-8 octets.
+        encoded_length += 6;
+      } else {
+        encoded_length += 3;
+      }
+
+      // We don't allow strings that are longer than a maximal length.
+      DCHECK(String::kMaxLength < 0x7fffffff - 6);     // Cannot overflow.
+      if (encoded_length > String::kMaxLength) break;  // Provoke exception.
+    }
+  }
+
+  // No length change implies no change.
+  if (encoded_length == uri_length) return uri;
+
+  Handle<SeqOneByteString> result;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate, result, isolate->factory()->NewRawOneByteString(encoded_length),
+      String);
+
+  DisallowHeapAllocation no_gc;
+  Vector<const uint8_t> vector = uri->GetFlatContent().ToOneByteVector();
+  uint8_t* dest = result->GetChars();
+  for (int k = 0; k < uri_length; k++) {
+    uint8_t c = vector[k];
+    if (IsUnescapePredicateInUriComponent(c) ||
+        (is_uri && IsUriSeparator(c))) {
+      *dest++ = c;
+    } else if (c > unibrow::Utf8::kMaxOneByteChar) {
+      dest = WriteEncodedOctet(0xC0 | (c >> 6), dest);
+      dest = WriteEncodedOctet(0x80 | (c & 0x3F), dest);
+    } else {
+      dest = WriteEncodedOctet(c, dest);
+    }
+  }
+  DCHECK_EQ(result->GetChars() + encoded_length, dest);
+  return result;
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
                                 bool is_uri) {
   uri = String::Flatten(uri);
+  if (uri->IsOneByteRepresentationUnderneath()) {
+    return EncodeOneByte(isolate, uri, is_uri);
+  }
+
   int uri_length = uri->length();
   List<uint8_t> buffer(uri_length);
 
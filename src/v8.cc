@@ -20,6 +20,7 @@
 #include "src/runtime-profiler.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/snapshot.h"
+#include "src/trap-handler/trap-handler.h"
 
 
 namespace v8 {
@@ -73,6 +74,12 @@ void V8::InitializeOncePerProcessImpl() {
 
   base::OS::Initialize(FLAG_random_seed, FLAG_hard_abort, FLAG_gc_fake_mmap);
 
+  // Fall back to explicit bounds checks for wasm memory accesses if the
+  // signal handler cannot be installed.
+  if (trap_handler::UseTrapHandler() && !trap_handler::EnableTrapHandler()) {
+    FLAG_wasm_trap_handler = false;
+  }
+
   Isolate::InitializeOncePerProcess();
 
   sampler::Sampler::SetUp();
@@ -737,6 +737,8 @@
         'compiler/zone-stats.h',
         'compiler-dispatcher/compiler-dispatcher-job.cc',
         'compiler-dispatcher/compiler-dispatcher-job.h',
+        'compiler-dispatcher/compiler-dispatcher.cc',
+        'compiler-dispatcher/compiler-dispatcher.h',
         'compiler-dispatcher/optimizing-compile-dispatcher.cc',
         'compiler-dispatcher/optimizing-compile-dispatcher.h',
         'compiler.cc',
@@ -901,6 +903,8 @@
         'heap/array-buffer-tracker.h',
         'heap/code-stats.cc',
         'heap/code-stats.h',
+        'heap/concurrent-marking.cc',
+        'heap/concurrent-marking.h',
         'heap/memory-reducer.cc',
         'heap/memory-reducer.h',
         'heap/gc-idle-time-handler.cc',
@@ -925,6 +929,8 @@
         'heap/objects-visiting.cc',
         'heap/objects-visiting.h',
         'heap/page-parallel-job.h',
+        'heap/parallel-marking.cc',
+        'heap/parallel-marking.h',
         'heap/remembered-set.cc',
         'heap/remembered-set.h',
         'heap/scavenge-job.h',
@@ -1045,6 +1051,8 @@
         'objects.h',
         'ostreams.cc',
         'ostreams.h',
+        'parsing/compile-hints.cc',
+        'parsing/compile-hints.h',
         'parsing/duplicate-finder.cc',
         'parsing/duplicate-finder.h',
         'parsing/expression-classifier.h',
@@ -1061,6 +1069,8 @@
         'parsing/preparse-data-format.h',
         'parsing/preparse-data.cc',
         'parsing/preparse-data.h',
+        'parsing/preparsed-scope-data.cc',
+        'parsing/preparsed-scope-data.h',
         'parsing/preparser.cc',
         'parsing/preparser.h',
         'parsing/rewriter.cc',
@@ -1184,6 +1194,8 @@
         'snapshot/serializer.h',
         'snapshot/serializer-common.cc',
         'snapshot/serializer-common.h',
+        'snapshot/shared-code-cache.cc',
+        'snapshot/shared-code-cache.h',
         'snapshot/snapshot.h',
         'snapshot/snapshot-common.cc',
         'snapshot/snapshot-source-sink.cc',
@@ -1213,6 +1225,10 @@
         'transitions-inl.h',
         'transitions.cc',
         'transitions.h',
+        'trap-handler/handler-inside.cc',
+        'trap-handler/handler-outside.cc',
+        'trap-handler/trap-handler-internal.h',
+        'trap-handler/trap-handler.h',
         'type-feedback-vector-inl.h',
         'type-feedback-vector.cc',
         'type-feedback-vector.h',
@@ -1252,6 +1268,8 @@
         'wasm/module-decoder.h',
         'wasm/signature-map.cc',
         'wasm/signature-map.h',
+        'wasm/streaming-decoder.cc',
+        'wasm/streaming-decoder.h',
         'wasm/wasm-debug.cc',
         'wasm/wasm-debug.h',
         'wasm/wasm-external-refs.cc',
@@ -2095,6 +2113,8 @@
         'libplatform/tracing/trace-writer.cc',
         'libplatform/tracing/trace-writer.h',
         'libplatform/tracing/tracing-controller.cc',
+        'libplatform/work-stealing-task-queue.cc',
+        'libplatform/work-stealing-task-queue.h',
         'libplatform/worker-thread.cc',
         'libplatform/worker-thread.h',
       ],
@@ -2247,7 +2267,6 @@
           'messages.h',
           'js/harmony-atomics.js',
           'js/harmony-simd.js',
-          'js/harmony-string-padding.js',
         ],
         'libraries_bin_file': '<(SHARED_INTERMEDIATE_DIR)/libraries.bin',
         'libraries_experimental_bin_file': '<(SHARED_INTERMEDIATE_DIR)/libraries-experimental.bin',
@@ -125,8 +125,8 @@ bool ThreadManager::RestoreThread() {
   Isolate::PerIsolateThreadData* per_thread =
       isolate_->FindPerThreadDataForThisThread();
   if (per_thread == NULL || per_thread->thread_state() == NULL) {
-    // This is a new thread.
-    isolate_->stack_guard()->InitThread(access);
+    // This is a new thread. The caller (a top-level Locker) initializes the
+    // stack guard for it.
     return false;
   }
   ThreadState* state = per_thread->thread_state();
@@ -677,9 +677,22 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(JSArrayBuffer* array_buffer) {
   }
 
   if (array_buffer->is_shared()) {
-    ThrowDataCloneError(
-        MessageTemplate::kDataCloneErrorSharedArrayBufferNotTransferred);
-    return Nothing<bool>();
+    if (!delegate_) {
+      ThrowDataCloneError(
+          MessageTemplate::kDataCloneErrorSharedArrayBufferNotTransferred);
+      return Nothing<bool>();
+    }
+    // Let the embedder pass the memory by reference, so that the contents
+    // are never copied.
+    v8::Isolate* v8_isolate = reinterpret_cast<v8::Isolate*>(isolate_);
+    Maybe<uint32_t> id = delegate_->GetSharedArrayBufferId(
+        v8_isolate, Utils::ToLocalShared(handle(array_buffer, isolate_)));
+    RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+    // The delegate may also fail without scheduling an exception.
+    if (id.IsNothing()) return Nothing<bool>();
+    WriteTag(SerializationTag::kSharedArrayBufferTransfer);
+    WriteVarint(id.FromJust());
+    return Just(true);
   }
   if (array_buffer->was_neutered()) {
     ThrowDataCloneError(MessageTemplate::kDataCloneErrorNeuteredArrayBuffer);
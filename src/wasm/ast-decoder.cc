@@ -250,6 +250,10 @@ class WasmDecoder : public Decoder {
         MemoryAccessOperand operand(this, pc, UINT32_MAX);
         return 1 + operand.length;
       }
+      case kAtomicPrefix: {
+        MemoryAccessOperand operand(this, pc + 1, UINT32_MAX);
+        return 2 + operand.length;
+      }
       case kExprBr:
       case kExprBrIf: {
         BreakDepthOperand operand(this, pc);
@@ -1106,6 +1110,16 @@ class WasmFullDecoder : public WasmDecoder {
             len += DecodeSimdOpcode(opcode);
             break;
           }
+          case kAtomicPrefix: {
+            CHECK_PROTOTYPE_OPCODE(wasm_atomics_prototype);
+            len++;
+            byte atomic_index = checked_read_u8(pc_, 1, "atomic index");
+            opcode = static_cast<WasmOpcode>(opcode << 8 | atomic_index);
+            TRACE("  @%-4d #%02x #%02x:%-20s|", startrel(pc_), kAtomicPrefix,
+                  atomic_index, WasmOpcodes::ShortOpcodeName(opcode));
+            len += DecodeAtomicOpcode(opcode);
+            break;
+          }
           default: {
             // Deal with special asmjs opcodes.
             if (module_ && module_->origin == kAsmJsOrigin) {
@@ -1249,9 +1263,62 @@ class WasmFullDecoder : public WasmDecoder {
     return 1 + operand.length;
   }
 
+  unsigned DecodeAtomicLoadMem(MachineType mem_type) {
+    MemoryAccessOperand operand(this, pc_ + 1,
+                                ElementSizeLog2Of(mem_type.representation()));
+    CheckAtomicAlignment(operand, mem_type);
+    Value index = Pop(0, kAstI32);
+    TFNode* node =
+        BUILD(AtomicLoadMem, mem_type, index.node, operand.offset, position());
+    Push(kAstI32, node);
+    return operand.length;
+  }
+
+  unsigned DecodeAtomicStoreMem(MachineType mem_type) {
+    MemoryAccessOperand operand(this, pc_ + 1,
+                                ElementSizeLog2Of(mem_type.representation()));
+    CheckAtomicAlignment(operand, mem_type);
+    Value val = Pop(1, kAstI32);
+    Value index = Pop(0, kAstI32);
+    BUILD(AtomicStoreMem, mem_type, index.node, operand.offset, val.node,
+          position());
+    return operand.length;
+  }
+
+  // Atomic accesses must not be split, so only naturally aligned ones are
+  // valid.
+  void CheckAtomicAlignment(const MemoryAccessOperand& operand,
+                            MachineType mem_type) {
+    if (operand.alignment !=
+        static_cast<uint32_t>(ElementSizeLog2Of(mem_type.representation()))) {
+      error(pc_, pc_ + 2, "invalid alignment for atomic access");
+    }
+  }
+
+  unsigned DecodeAtomicOpcode(WasmOpcode opcode) {
+    switch (opcode) {
+      case kExprI32AtomicLoad:
+        return DecodeAtomicLoadMem(MachineType::Uint32());
+      case kExprI32AtomicLoad8U:
+        return DecodeAtomicLoadMem(MachineType::Uint8());
+      case kExprI32AtomicLoad16U:
+        return DecodeAtomicLoadMem(MachineType::Uint16());
+      case kExprI32AtomicStore:
+        return DecodeAtomicStoreMem(MachineType::Uint32());
+      case kExprI32AtomicStore8U:
+        return DecodeAtomicStoreMem(MachineType::Uint8());
+      case kExprI32AtomicStore16U:
+        return DecodeAtomicStoreMem(MachineType::Uint16());
+      default:
+        error("invalid atomic opcode");
+        return 0;
+    }
+  }
+
   unsigned DecodeSimdOpcode(WasmOpcode opcode) {
     unsigned len = 0;
     switch (opcode) {
+      case kExprF32x4ExtractLane:
       case kExprI32x4ExtractLane: {
         uint8_t lane = this->checked_read_u8(pc_, 2, "lane number");
         if (lane < 0 || lane > 3) {
@@ -1259,7 +1326,9 @@ class WasmFullDecoder : public WasmDecoder {
         }
         TFNode* input = Pop(0, LocalType::kSimd128).node;
         TFNode* node = BUILD(SimdExtractLane, opcode, lane, input);
-        Push(LocalType::kWord32, node);
+        Push(opcode == kExprF32x4ExtractLane ? LocalType::kFloat32
+                                             : LocalType::kWord32,
+             node);
         len++;
         break;
       }
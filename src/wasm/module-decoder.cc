@@ -31,6 +31,12 @@ namespace {
 const char* kNameString = "name";
 const size_t kNameStringLength = 4;
 
+bool IsNameSection(const byte* section_name, uint32_t length) {
+  return length == kNameStringLength &&
+         strncmp(reinterpret_cast<const char*>(section_name), kNameString,
+                 kNameStringLength) == 0;
+}
+
 LocalType TypeOf(const WasmModule* module, const WasmInitExpr& expr) {
   switch (expr.kind) {
     case WasmInitExpr::kNone:
@@ -143,9 +149,7 @@ class WasmSectionIterator {
               static_cast<int>(section_name_start - decoder_.start()),
               string_length < 20 ? string_length : 20, section_name_start);
 
-        if (string_length == kNameStringLength &&
-            strncmp(reinterpret_cast<const char*>(section_name_start),
-                    kNameString, kNameStringLength) == 0) {
+        if (IsNameSection(section_name_start, string_length)) {
           section_code = kNameSectionCode;
         } else {
           section_code = kUnknownSectionCode;
@@ -216,6 +220,23 @@ class ModuleDecoder : public Decoder {
 
   // Decodes an entire module.
   ModuleResult DecodeModule(WasmModule* module, bool verify_functions = true) {
+    StartDecoding(module);
+    DecodeModuleHeader();
+
+    WasmSectionIterator section_iter(*this);
+    WasmSectionCode last_section = kUnknownSectionCode;
+    while (ok() && section_iter.more()) {
+      if (!CheckSectionOrder(section_iter.section_code(), &last_section)) {
+        break;
+      }
+      DecodeSection(module, section_iter.section_code());
+      section_iter.advance();
+    }
+    return FinishDecoding(module);
+  }
+
+  // Prepares {module} for decoding the bytes between {start_} and {limit_}.
+  void StartDecoding(WasmModule* module) {
     pc_ = start_;
     module->module_start = start_;
     module->module_end = limit_;
@@ -223,7 +244,10 @@ class ModuleDecoder : public Decoder {
     module->max_mem_pages = 0;
     module->mem_export = false;
     module->origin = origin_;
+  }
 
+  // Decodes the magic word and version at {pc_}.
+  void DecodeModuleHeader() {
     const byte* pos = pc_;
     uint32_t magic_word = consume_u32("wasm magic");
 #define BYTES(x) (x & 0xff), (x >> 8) & 0xff, (x >> 16) & 0xff, (x >> 24) & 0xff
@@ -244,11 +268,24 @@ class ModuleDecoder : public Decoder {
               BYTES(kWasmVersion), BYTES(magic_version));
       }
     }
+  }
 
-    WasmSectionIterator section_iter(*this);
+  // Sections have to appear in the order of their section codes, and each
+  // at most once.
+  bool CheckSectionOrder(WasmSectionCode section_code,
+                         WasmSectionCode* last_section) {
+    if (section_code <= *last_section) {
+      error(pc(), pc(), "unexpected section: %s", SectionName(section_code));
+      return false;
+    }
+    *last_section = section_code;
+    return true;
+  }
 
+  // Decodes the payload of a single known section starting at {pc_}.
+  void DecodeSection(WasmModule* module, WasmSectionCode section_code) {
     // ===== Type section ====================================================
-    if (section_iter.section_code() == kTypeSectionCode) {
+    if (section_code == kTypeSectionCode) {
       uint32_t signatures_count = consume_u32v("signatures count");
       module->signatures.reserve(SafeReserve(signatures_count));
       for (uint32_t i = 0; ok() && i < signatures_count; ++i) {
@@ -257,11 +294,10 @@ class ModuleDecoder : public Decoder {
         FunctionSig* s = consume_sig();
         module->signatures.push_back(s);
       }
-      section_iter.advance();
     }
 
     // ===== Import section ==================================================
-    if (section_iter.section_code() == kImportSectionCode) {
+    if (section_code == kImportSectionCode) {
       uint32_t import_table_count = consume_u32v("import table count");
       module->import_table.reserve(SafeReserve(import_table_count));
       for (uint32_t i = 0; ok() && i < import_table_count; ++i) {
@@ -339,11 +375,10 @@ class ModuleDecoder : public Decoder {
             break;
         }
       }
-      section_iter.advance();
     }
 
     // ===== Function section ================================================
-    if (section_iter.section_code() == kFunctionSectionCode) {
+    if (section_code == kFunctionSectionCode) {
       uint32_t functions_count = consume_u32v("functions count");
       module->functions.reserve(SafeReserve(functions_count));
       module->num_declared_functions = functions_count;
@@ -361,11 +396,10 @@ class ModuleDecoder : public Decoder {
         WasmFunction* function = &module->functions.back();
         function->sig_index = consume_sig_index(module, &function->sig);
       }
-      section_iter.advance();
     }
 
     // ===== Table section ===================================================
-    if (section_iter.section_code() == kTableSectionCode) {
+    if (section_code == kTableSectionCode) {
       const byte* pos = pc_;
       uint32_t table_count = consume_u32v("table count");
       // Require at most one table for now.
@@ -383,11 +417,10 @@ class ModuleDecoder : public Decoder {
         consume_resizable_limits("table elements", "elements", kMaxUInt32,
                                  &table->size, &table->max_size);
       }
-      section_iter.advance();
     }
 
     // ===== Memory section ==================================================
-    if (section_iter.section_code() == kMemorySectionCode) {
+    if (section_code == kMemorySectionCode) {
       const byte* pos = pc_;
       uint32_t memory_count = consume_u32v("memory count");
       // Require at most one memory for now.
@@ -400,11 +433,11 @@ class ModuleDecoder : public Decoder {
                                  &module->min_mem_pages,
                                  &module->max_mem_pages);
       }
-      section_iter.advance();
     }
 
     // ===== Global section ==================================================
-    if (section_iter.section_code() == kGlobalSectionCode) {
+    if (section_code == kGlobalSectionCode) {
+      const byte* pos = pc_;
       uint32_t globals_count = consume_u32v("globals count");
       uint32_t imported_globals = static_cast<uint32_t>(module->globals.size());
       if (!IsWithinLimit(std::numeric_limits<int32_t>::max(), globals_count,
@@ -422,11 +455,10 @@ class ModuleDecoder : public Decoder {
         WasmGlobal* global = &module->globals.back();
         DecodeGlobalInModule(module, i + imported_globals, global);
       }
-      section_iter.advance();
     }
 
     // ===== Export section ==================================================
-    if (section_iter.section_code() == kExportSectionCode) {
+    if (section_code == kExportSectionCode) {
       uint32_t export_table_count = consume_u32v("export table count");
       module->export_table.reserve(SafeReserve(export_table_count));
       for (uint32_t i = 0; ok() && i < export_table_count; ++i) {
@@ -502,22 +534,20 @@ class ModuleDecoder : public Decoder {
           }
         }
       }
-      section_iter.advance();
     }
 
     // ===== Start section ===================================================
-    if (section_iter.section_code() == kStartSectionCode) {
+    if (section_code == kStartSectionCode) {
       WasmFunction* func;
       const byte* pos = pc_;
       module->start_function_index = consume_func_index(module, &func);
       if (func && func->sig->parameter_count() > 0) {
         error(pos, "invalid start function: non-zero parameter count");
       }
-      section_iter.advance();
     }
 
     // ===== Elements section ================================================
-    if (section_iter.section_code() == kElementSectionCode) {
+    if (section_code == kElementSectionCode) {
       uint32_t element_count = consume_u32v("element count");
       for (uint32_t i = 0; ok() && i < element_count; ++i) {
         const byte* pos = pc();
@@ -548,12 +578,10 @@ class ModuleDecoder : public Decoder {
           }
         }
       }
-
-      section_iter.advance();
     }
 
     // ===== Code section ====================================================
-    if (section_iter.section_code() == kCodeSectionCode) {
+    if (section_code == kCodeSectionCode) {
       const byte* pos = pc_;
       uint32_t functions_count = consume_u32v("functions count");
       if (functions_count != module->num_declared_functions) {
@@ -568,11 +596,10 @@ class ModuleDecoder : public Decoder {
         function->code_end_offset = pc_offset() + size;
         consume_bytes(size, "function body");
       }
-      section_iter.advance();
     }
 
     // ===== Data section ====================================================
-    if (section_iter.section_code() == kDataSectionCode) {
+    if (section_code == kDataSectionCode) {
       uint32_t data_segments_count = consume_u32v("data segments count");
       module->data_segments.reserve(SafeReserve(data_segments_count));
       for (uint32_t i = 0; ok() && i < data_segments_count; ++i) {
@@ -586,11 +613,10 @@ class ModuleDecoder : public Decoder {
         WasmDataSegment* segment = &module->data_segments.back();
         DecodeDataSegmentInModule(module, segment);
       }
-      section_iter.advance();
     }
 
     // ===== Name section ====================================================
-    if (section_iter.section_code() == kNameSectionCode) {
+    if (section_code == kNameSectionCode) {
       const byte* pos = pc_;
       uint32_t functions_count = consume_u32v("functions count");
       if (functions_count != module->num_declared_functions) {
@@ -608,19 +634,58 @@ class ModuleDecoder : public Decoder {
           skip_string();
         }
       }
-      section_iter.advance();
     }
+  }
 
-    // ===== Remaining sections ==============================================
-    if (section_iter.more() && ok()) {
-      error(pc(), pc(), "unexpected section: %s",
-            SectionName(section_iter.section_code()));
+  // Decodes a single section for streaming compilation. The payload of the
+  // section, including the name of unknown sections, spans from
+  // {payload_start} to {limit_}.
+  void DecodeSectionPayload(WasmModule* module, uint8_t section_code,
+                            const byte* payload_start,
+                            WasmSectionCode* last_section) {
+    pc_ = payload_start;
+    if (section_code == kUnknownSectionCode) {
+      uint32_t string_length = consume_u32v("section name length");
+      const byte* section_name_start = pc_;
+      consume_bytes(string_length, "section name");
+      if (failed()) return;
+      if (!IsNameSection(section_name_start, string_length)) {
+        // Skip the payload of unknown sections.
+        pc_ = limit_;
+        return;
+      }
+      section_code = kNameSectionCode;
+    } else if (!IsValidSectionCode(section_code)) {
+      error(pc_, pc_, "unknown section code #0x%02x", section_code);
+      return;
     }
+    WasmSectionCode code = static_cast<WasmSectionCode>(section_code);
+    if (!CheckSectionOrder(code, last_section)) return;
+    DecodeSection(module, code);
+    if (ok() && pc_ != limit_) {
+      error(pc_, pc_, "section was shorter than expected size");
+    }
+  }
 
-    if (ok()) {
-      CalculateGlobalOffsets(module);
-      PreinitializeIndirectFunctionTables(module);
+  // Starts a code section at {payload_start} whose function bodies are
+  // consumed by the caller. Compilation needs the layout of the module, which
+  // only depends on the sections before the code section.
+  void StartCodeSection(WasmModule* module, const byte* payload_start,
+                        WasmSectionCode* last_section) {
+    pc_ = payload_start;
+    if (CheckSectionOrder(kCodeSectionCode, last_section)) {
+      CalculateModuleLayout(module);
     }
+  }
+
+  // Computes the parts of {module} that depend on more than one section.
+  void CalculateModuleLayout(WasmModule* module) {
+    CalculateGlobalOffsets(module);
+    PreinitializeIndirectFunctionTables(module);
+  }
+
+  ModuleResult FinishDecoding(WasmModule* module) {
+    if (ok()) CalculateModuleLayout(module);
     const WasmModule* finished_module = module;
     ModuleResult result = toResult(finished_module);
     if (FLAG_dump_wasm_module) DumpModule(module, result);
@@ -1098,6 +1163,56 @@ ModuleResult DecodeWasmModule(Isolate* isolate, Zone* zone,
   return result;
 }
 
+IncrementalModuleDecoder::IncrementalModuleDecoder(Zone* zone,
+                                                   ModuleOrigin origin)
+    : zone_(zone),
+      origin_(origin),
+      module_(new WasmModule()),
+      last_section_(kUnknownSectionCode) {}
+
+IncrementalModuleDecoder::~IncrementalModuleDecoder() {}
+
+bool IncrementalModuleDecoder::DecodeModuleHeader(const byte* module_start) {
+  ModuleDecoder decoder(zone_, module_start,
+                        module_start + kWasmModuleHeaderSize, origin_);
+  decoder.StartDecoding(module_.get());
+  decoder.DecodeModuleHeader();
+  return CheckResult(&decoder);
+}
+
+bool IncrementalModuleDecoder::DecodeSection(uint8_t section_code,
+                                             const byte* module_start,
+                                             const byte* payload_start,
+                                             const byte* payload_end) {
+  ModuleDecoder decoder(zone_, module_start, payload_end, origin_);
+  decoder.DecodeSectionPayload(module_.get(), section_code, payload_start,
+                               &last_section_);
+  return CheckResult(&decoder);
+}
+
+bool IncrementalModuleDecoder::StartCodeSection(const byte* module_start,
+                                                const byte* payload_start) {
+  ModuleDecoder decoder(zone_, module_start, payload_start, origin_);
+  decoder.StartCodeSection(module_.get(), payload_start, &last_section_);
+  return CheckResult(&decoder);
+}
+
+ModuleResult IncrementalModuleDecoder::Finish(const byte* module_start,
+                                              const byte* module_end) {
+  module_->module_start = module_start;
+  module_->module_end = module_end;
+  ModuleDecoder decoder(zone_, module_start, module_end, origin_);
+  return decoder.FinishDecoding(module_.release());
+}
+
+bool IncrementalModuleDecoder::CheckResult(Decoder* decoder) {
+  if (decoder->ok()) return true;
+  std::ostringstream error;
+  error << decoder->toResult<const WasmModule*>(nullptr);
+  error_ = error.str();
+  return false;
+}
+
 FunctionSig* DecodeWasmSignatureForTesting(Zone* zone, const byte* start,
                                            const byte* end) {
   ModuleDecoder decoder(zone, start, end, kWasmOrigin);
@@ -1164,6 +1279,55 @@ FunctionOffsetsResult DecodeWasmFunctionOffsets(
   return decoder.toResult(std::move(table));
 }
 
+FunctionOffsetsResult DecodeWasmFunctionNames(const byte* module_start,
+                                              const byte* module_end,
+                                              uint32_t num_imported_functions) {
+  FunctionOffsets table;
+
+  // The function section holds the number of declared functions.
+  Vector<const byte> function_section =
+      FindSection(module_start, module_end, kFunctionSectionCode);
+  uint32_t functions_count = 0;
+  if (function_section.start()) {
+    Decoder decoder(function_section.start(), function_section.end());
+    functions_count = decoder.consume_u32v("functions count");
+    if (decoder.failed()) return decoder.toResult(std::move(table));
+  }
+  // Reserve space for the entries, taking care of invalid input.
+  if (functions_count < static_cast<unsigned>(module_end - module_start)) {
+    table.reserve(num_imported_functions + functions_count);
+  }
+  table.resize(num_imported_functions + functions_count);
+
+  Vector<const byte> name_section =
+      FindSection(module_start, module_end, kNameSectionCode);
+  Decoder decoder(name_section.start(), name_section.end());
+  if (!name_section.start()) return decoder.toResult(std::move(table));
+
+  uint32_t names_count = decoder.consume_u32v("functions count");
+  if (names_count != functions_count) {
+    decoder.error("function name count mismatch");
+    return decoder.toResult(std::move(table));
+  }
+  int section_offset = static_cast<int>(name_section.start() - module_start);
+  DCHECK_LE(0, section_offset);
+  for (uint32_t i = 0; i < names_count && decoder.ok(); ++i) {
+    uint32_t length = decoder.consume_u32v("name length");
+    int offset = static_cast<int>(section_offset + decoder.pc_offset());
+    decoder.consume_bytes(length, "function name");
+    table[num_imported_functions + i] =
+        std::make_pair(offset, static_cast<int>(length));
+    uint32_t local_names_count = decoder.consume_u32v("local names count");
+    for (uint32_t j = 0; j < local_names_count && decoder.ok(); ++j) {
+      decoder.consume_bytes(decoder.consume_u32v("local name length"),
+                            "local name");
+    }
+  }
+  if (decoder.more()) decoder.error("unexpected additional bytes");
+
+  return decoder.toResult(std::move(table));
+}
+
 AsmJsOffsetsResult DecodeAsmJsOffsets(const byte* tables_start,
                                       const byte* tables_end,
                                       uint32_t num_imported_functions) {
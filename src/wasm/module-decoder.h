@@ -5,6 +5,9 @@
 #ifndef V8_WASM_MODULE_DECODER_H_
 #define V8_WASM_MODULE_DECODER_H_
 
+#include <memory>
+#include <string>
+
 #include "src/wasm/ast-decoder.h"
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-result.h"
@@ -13,6 +16,8 @@ namespace v8 {
 namespace internal {
 namespace wasm {
 
+class Decoder;
+
 typedef Result<const WasmModule*> ModuleResult;
 typedef Result<WasmFunction*> FunctionResult;
 typedef std::vector<std::pair<int, int>> FunctionOffsets;
@@ -27,6 +32,50 @@ V8_EXPORT_PRIVATE ModuleResult DecodeWasmModule(Isolate* isolate, Zone* zone,
                                                 bool verify_functions,
                                                 ModuleOrigin origin);
 
+// Decodes a module one section at a time, for streaming compilation. The
+// module bytes may move between calls, so every call takes the current start
+// of the module. Offsets stored in the module are relative to it. Function
+// bodies may be compiled while later sections are decoded, so only the caller
+// updates the range of the module bytes in module(), until Finish() sets the
+// final range.
+class V8_EXPORT_PRIVATE IncrementalModuleDecoder {
+ public:
+  // Signatures are allocated in {zone}, which has to outlive the module.
+  IncrementalModuleDecoder(Zone* zone, ModuleOrigin origin);
+  ~IncrementalModuleDecoder();
+
+  // Each of the following returns false and sets error() on failure.
+
+  // Checks the magic word and the version at {module_start}.
+  bool DecodeModuleHeader(const byte* module_start);
+  // Decodes the section with {section_code} whose payload, including the
+  // name of unknown sections, spans [{payload_start}, {payload_end}).
+  bool DecodeSection(uint8_t section_code, const byte* module_start,
+                     const byte* payload_start, const byte* payload_end);
+  // Starts the code section at {payload_start}. The caller consumes the
+  // function bodies and records their offsets in module(). Afterwards
+  // module() is complete enough to compile functions.
+  bool StartCodeSection(const byte* module_start, const byte* payload_start);
+
+  // Finishes the module spanning [{module_start}, {module_end}) and passes its
+  // ownership to the caller.
+  ModuleResult Finish(const byte* module_start, const byte* module_end);
+
+  WasmModule* module() const { return module_.get(); }
+  const std::string& error() const { return error_; }
+
+ private:
+  bool CheckResult(Decoder* decoder);
+
+  Zone* zone_;
+  ModuleOrigin origin_;
+  std::unique_ptr<WasmModule> module_;
+  WasmSectionCode last_section_;
+  std::string error_;
+
+  DISALLOW_COPY_AND_ASSIGN(IncrementalModuleDecoder);
+};
+
 // Exposed for testing. Decodes a single function signature, allocating it
 // in the given zone. Returns {nullptr} upon failure.
 FunctionSig* DecodeWasmSignatureForTesting(Zone* zone, const byte* start,
@@ -45,6 +94,16 @@ FunctionOffsetsResult DecodeWasmFunctionOffsets(
     const byte* module_start, const byte* module_end,
     uint32_t num_imported_functions);
 
+// Extracts the function names from the name section of the wasm module bytes,
+// without decoding any other section but the function section.
+// Returns a vector with <offset, length> entries for all functions, including
+// imported ones. Functions without a name get a <0, 0> entry. Fails if the
+// wasm bytes are detected as invalid; note that this validation is not
+// complete.
+FunctionOffsetsResult DecodeWasmFunctionNames(const byte* module_start,
+                                              const byte* module_end,
+                                              uint32_t num_imported_functions);
+
 WasmInitExpr DecodeWasmInitExprForTesting(const byte* start, const byte* end);
 
 // Extracts the mapping from wasm byte offset to asm.js source position per
@@ -0,0 +1,410 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/streaming-decoder.h"
+
+#include "src/api.h"
+#include "src/cancelable-task.h"
+#include "src/compiler/wasm-compiler.h"
+#include "src/handles-inl.h"
+#include "src/isolate.h"
+#include "src/utils.h"
+#include "src/v8.h"
+#include "src/wasm/leb-helper.h"
+#include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-result.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+// The buffer starts small and doubles whenever it is full.
+const size_t kInitialBufferSize = 64 * KB;
+
+}  // namespace
+
+class StreamingDecoder::CompilationTask : public CancelableTask {
+ public:
+  CompilationTask(Isolate* isolate, StreamingDecoder* decoder)
+      : CancelableTask(isolate), decoder_(decoder) {}
+
+ private:
+  // v8::internal::CancelableTask overrides.
+  void RunInternal() override {
+    while (decoder_->FetchAndExecuteCompilationUnit(true)) {
+    }
+    decoder_->pending_tasks_.Signal();
+  }
+
+  StreamingDecoder* decoder_;
+  DISALLOW_COPY_AND_ASSIGN(CompilationTask);
+};
+
+// Stops the background compilation for the lifetime of the scope. The
+// pending compilation units are taken out of the queue, so that running tasks
+// stop after their current unit instead of draining the queue.
+class StreamingDecoder::PauseCompilationScope {
+ public:
+  explicit PauseCompilationScope(StreamingDecoder* decoder)
+      : decoder_(decoder) {
+    {
+      base::LockGuard<base::Mutex> guard(&decoder_->mutex_);
+      units_.swap(decoder_->pending_units_);
+    }
+    decoder_->WaitForCompilationTasks();
+  }
+
+  ~PauseCompilationScope() {
+    base::LockGuard<base::Mutex> guard(&decoder_->mutex_);
+    decoder_->pending_units_.swap(units_);
+    decoder_->StartCompilationTasks();
+  }
+
+ private:
+  StreamingDecoder* decoder_;
+  std::queue<compiler::WasmCompilationUnit*> units_;
+  DISALLOW_COPY_AND_ASSIGN(PauseCompilationScope);
+};
+
+StreamingDecoder::StreamingDecoder(Isolate* isolate, ErrorThrower* thrower)
+    : isolate_(isolate),
+      thrower_(thrower),
+      capacity_(0),
+      received_(0),
+      state_(kModuleHeader),
+      offset_(0),
+      section_code_(kUnknownSectionCode),
+      payload_start_(0),
+      section_end_(0),
+      num_functions_(0),
+      next_function_(0),
+      zone_(isolate->allocator()),
+      module_decoder_(&zone_, kWasmOrigin),
+      code_section_started_(false),
+      running_tasks_(0),
+      max_tasks_(
+          Min(static_cast<size_t>(FLAG_wasm_num_compilation_tasks),
+              V8::GetCurrentPlatform()->NumberOfAvailableBackgroundThreads())),
+      pending_tasks_(0) {}
+
+StreamingDecoder::~StreamingDecoder() {
+  WaitForCompilationTasks();
+  while (!pending_units_.empty()) {
+    delete pending_units_.front();
+    pending_units_.pop();
+  }
+  for (compiler::WasmCompilationUnit* unit : executed_units_) delete unit;
+  for (DeferredHandles* handles : deferred_handles_) delete handles;
+}
+
+bool StreamingDecoder::OnBytesReceived(const byte* bytes, size_t length) {
+  if (state_ == kFailed) return false;
+  if (length >= kMaxModuleSize - received_) {
+    return Fail("size > maximum module size");
+  }
+  if (length == 0) return true;
+  if (length > capacity_ - received_) Grow(received_ + length);
+  memcpy(buffer_.get() + received_, bytes, length);
+  received_ += length;
+
+  HandleScope scope(isolate_);
+  while (DecodeStep()) {
+  }
+  // Function bodies completed by this chunk are compiled as one batch, so
+  // that they share their deferred handles.
+  if (!completed_functions_.empty()) AddCompilationUnits();
+  return state_ != kFailed;
+}
+
+bool StreamingDecoder::DecodeStep() {
+  switch (state_) {
+    case kModuleHeader: {
+      if (received_ < kWasmModuleHeaderSize) return false;
+      if (!module_decoder_.DecodeModuleHeader(buffer_.get())) {
+        return Fail(module_decoder_.error());
+      }
+      offset_ = kWasmModuleHeaderSize;
+      state_ = kSectionHeader;
+      return true;
+    }
+    case kSectionHeader: {
+      if (offset_ >= received_) return false;
+      uint8_t section_code = buffer_[offset_];
+      size_t payload_start = offset_ + 1;
+      uint32_t section_length;
+      if (!ReadVarUint32(&payload_start, &section_length)) return false;
+      if (section_length >= kMaxModuleSize - payload_start) {
+        return Fail("section extends beyond the maximum module size");
+      }
+      section_code_ = section_code;
+      payload_start_ = payload_start;
+      section_end_ = payload_start + section_length;
+      offset_ = payload_start;
+      if (section_code == kCodeSectionCode) {
+        if (!OnCodeSectionStart()) return false;
+        state_ = kFunctionCount;
+      } else {
+        state_ = kSectionPayload;
+      }
+      return true;
+    }
+    case kSectionPayload:
+      if (received_ < section_end_) return false;
+      if (!OnSectionPayload()) return false;
+      offset_ = section_end_;
+      state_ = kSectionHeader;
+      return true;
+    case kFunctionCount:
+      if (!ReadVarUint32(&offset_, &num_functions_)) return false;
+      if (num_functions_ != module_decoder_.module()->num_declared_functions) {
+        return Fail("function body count does not match function count");
+      }
+      next_function_ = 0;
+      state_ = kFunctionBody;
+      return true;
+    case kFunctionBody: {
+      if (next_function_ == num_functions_) break;
+      size_t body_start = offset_;
+      uint32_t body_size;
+      if (!ReadVarUint32(&body_start, &body_size)) return false;
+      if (body_size > section_end_ - body_start) {
+        return Fail("function body extends beyond the code section");
+      }
+      if (received_ < body_start + body_size) return false;
+      OnFunctionBody(next_function_, body_start, body_start + body_size);
+      offset_ = body_start + body_size;
+      next_function_++;
+      if (next_function_ < num_functions_) return true;
+      break;
+    }
+    case kFailed:
+      return false;
+  }
+  // All function bodies of the code section were read.
+  if (offset_ != section_end_) {
+    return Fail("code section has trailing bytes");
+  }
+  state_ = kSectionHeader;
+  return true;
+}
+
+bool StreamingDecoder::ReadVarUint32(size_t* offset, uint32_t* value) {
+  uint32_t result = 0;
+  for (size_t i = 0; i < kMaxVarInt32Size; i++) {
+    size_t pos = *offset + i;
+    if (pos >= received_) return false;
+    byte b = buffer_[pos];
+    result |= static_cast<uint32_t>(b & 0x7f) << (7 * i);
+    if ((b & 0x80) == 0) {
+      *offset = pos + 1;
+      *value = result;
+      return true;
+    }
+  }
+  return Fail("invalid LEB128 value");
+}
+
+bool StreamingDecoder::Fail(const std::string& error) {
+  if (state_ != kFailed) {
+    error_ = error;
+    state_ = kFailed;
+  }
+  return false;
+}
+
+void StreamingDecoder::Grow(size_t min_capacity) {
+  size_t capacity = Max(kInitialBufferSize, 2 * capacity_);
+  capacity = Min(Max(capacity, min_capacity), kMaxModuleSize);
+  PauseCompilationScope pause(this);
+  std::unique_ptr<byte[]> buffer(new byte[capacity]);
+  if (received_ > 0) memcpy(buffer.get(), buffer_.get(), received_);
+  buffer_.swap(buffer);
+  capacity_ = capacity;
+  if (code_section_started_) UpdateModuleBytes();
+}
+
+void StreamingDecoder::UpdateModuleBytes() {
+  WasmModule* module = module_decoder_.module();
+  module->module_start = buffer_.get();
+  module->module_end = buffer_.get() + capacity_;
+}
+
+bool StreamingDecoder::OnSectionPayload() {
+  // Of the sections following the code section, only the name section writes
+  // to the function table, which compilation tasks read.
+  std::unique_ptr<PauseCompilationScope> pause;
+  if (code_section_started_ && section_code_ == kUnknownSectionCode) {
+    pause.reset(new PauseCompilationScope(this));
+  }
+  const byte* module_start = buffer_.get();
+  if (!module_decoder_.DecodeSection(section_code_, module_start,
+                                     module_start + payload_start_,
+                                     module_start + section_end_)) {
+    return Fail(module_decoder_.error());
+  }
+  return true;
+}
+
+bool StreamingDecoder::OnCodeSectionStart() {
+  if (!module_decoder_.StartCodeSection(buffer_.get(),
+                                        buffer_.get() + payload_start_)) {
+    return Fail(module_decoder_.error());
+  }
+  code_section_started_ = true;
+  WasmModule* module = module_decoder_.module();
+  UpdateModuleBytes();
+  temp_instance_.reset(new WasmInstance(module));
+  module_env_.module = module;
+  module_env_.instance = temp_instance_.get();
+  module_env_.origin = kWasmOrigin;
+
+  // The code table and the temporary instance are used by Finish(), so their
+  // handles need to outlive the current call.
+  DeferredHandleScope deferred(isolate_);
+  module->PrepareCompilation(isolate_, temp_instance_.get(), &code_table_,
+                             &indirect_table_);
+  deferred_handles_.push_back(deferred.Detach());
+  return true;
+}
+
+void StreamingDecoder::OnFunctionBody(uint32_t index, size_t start,
+                                      size_t end) {
+  WasmModule* module = module_decoder_.module();
+  WasmFunction& function =
+      module->functions[module->num_imported_functions + index];
+  function.code_start_offset = static_cast<uint32_t>(start);
+  function.code_end_offset = static_cast<uint32_t>(end);
+  completed_functions_.push_back(index);
+}
+
+void StreamingDecoder::AddCompilationUnits() {
+  WasmModule* module = module_decoder_.module();
+  std::vector<compiler::WasmCompilationUnit*> units;
+  {
+    // Compilation units hold handles until they are finished in Finish().
+    DeferredHandleScope deferred(isolate_);
+    {
+      CanonicalHandleScope canonical(isolate_);
+      for (uint32_t index : completed_functions_) {
+        uint32_t func_index = module->num_imported_functions + index;
+        if (func_index < static_cast<uint32_t>(FLAG_skip_compiling_wasm_funcs)) {
+          continue;
+        }
+        units.push_back(new compiler::WasmCompilationUnit(
+            thrower_, isolate_, &module_env_, &module->functions[func_index],
+            func_index));
+      }
+    }
+    deferred_handles_.push_back(deferred.Detach());
+  }
+  completed_functions_.clear();
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  for (compiler::WasmCompilationUnit* unit : units) pending_units_.push(unit);
+  StartCompilationTasks();
+}
+
+void StreamingDecoder::StartCompilationTasks() {
+  while (running_tasks_ < max_tasks_ && running_tasks_ < pending_units_.size()) {
+    CompilationTask* task = new CompilationTask(isolate_, this);
+    task_ids_.push_back(task->id());
+    running_tasks_++;
+    V8::GetCurrentPlatform()->CallOnBackgroundThread(
+        task, v8::Platform::kShortRunningTask);
+  }
+}
+
+bool StreamingDecoder::FetchAndExecuteCompilationUnit(bool on_task) {
+  DisallowHeapAllocation no_allocation;
+  DisallowHandleAllocation no_handles;
+  DisallowHandleDereference no_deref;
+  DisallowCodeDependencyChange no_dependency_change;
+
+  compiler::WasmCompilationUnit* unit;
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (pending_units_.empty()) {
+      // A background task that runs out of work terminates; new tasks are
+      // started when further function bodies arrive.
+      if (on_task) running_tasks_--;
+      return false;
+    }
+    unit = pending_units_.front();
+    pending_units_.pop();
+  }
+  unit->ExecuteCompilation();
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  executed_units_.push_back(unit);
+  return true;
+}
+
+void StreamingDecoder::WaitForCompilationTasks() {
+  for (uint32_t task_id : task_ids_) {
+    // If the task has not started yet, then we abort it. Otherwise we wait for
+    // it to finish.
+    if (!isolate_->cancelable_task_manager()->TryAbort(task_id)) {
+      pending_tasks_.Wait();
+    }
+  }
+  task_ids_.clear();
+  running_tasks_ = 0;
+}
+
+MaybeHandle<JSObject> StreamingDecoder::Finish() {
+  MaybeHandle<JSObject> nothing;
+  if (state_ != kFailed && (state_ != kSectionHeader || offset_ != received_)) {
+    Fail("unexpected end of module");
+  }
+
+  // Run the remaining compilation units on the main thread, then wait for
+  // the background tasks. Aborted tasks leave their work in the queue.
+  if (state_ != kFailed) {
+    while (FetchAndExecuteCompilationUnit(false)) {
+    }
+  }
+  WaitForCompilationTasks();
+  if (state_ != kFailed) {
+    while (FetchAndExecuteCompilationUnit(false)) {
+    }
+  }
+
+  if (state_ == kFailed) {
+    thrower_->CompileError("Wasm decoding failed: %s", error_.c_str());
+    return nothing;
+  }
+
+  // All sections were decoded while streaming; this only completes the
+  // module.
+  ModuleResult result =
+      module_decoder_.Finish(buffer_.get(), buffer_.get() + received_);
+  std::unique_ptr<const WasmModule> module(result.val);
+  if (result.failed()) {
+    thrower_->CompileFailed("Wasm decoding failed", result);
+    return nothing;
+  }
+
+  MaybeHandle<WasmCompiledModule> maybe_compiled_module;
+  if (!code_section_started_) {
+    // Without a code section nothing was compiled while streaming.
+    maybe_compiled_module = module->CompileFunctions(isolate_, thrower_);
+  } else {
+    DCHECK_EQ(module.get(), temp_instance_->module);
+    for (compiler::WasmCompilationUnit* unit : executed_units_) {
+      temp_instance_->function_code[unit->index()] = unit->FinishCompilation();
+      delete unit;
+    }
+    executed_units_.clear();
+    if (thrower_->error()) return nothing;
+    maybe_compiled_module = module->FinishCompilation(
+        isolate_, thrower_, temp_instance_.get(), code_table_, indirect_table_);
+  }
+  Handle<WasmCompiledModule> compiled_module;
+  if (!maybe_compiled_module.ToHandle(&compiled_module)) return nothing;
+  return CreateCompiledModuleObject(isolate_, compiled_module, kWasmOrigin);
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
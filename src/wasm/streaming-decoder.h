@@ -0,0 +1,142 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_WASM_STREAMING_DECODER_H_
+#define V8_WASM_STREAMING_DECODER_H_
+
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/semaphore.h"
+#include "src/handles.h"
+#include "src/wasm/module-decoder.h"
+#include "src/wasm/wasm-module.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+class DeferredHandles;
+
+namespace compiler {
+class WasmCompilationUnit;
+}
+
+namespace wasm {
+
+class ErrorThrower;
+
+// Decodes and compiles a wasm module while its bytes are still arriving.
+// Every section is decoded as soon as its payload is complete. Function
+// bodies are handed to background compilation tasks one by one, as soon as
+// each of them is complete. The remaining work, i.e. finishing the
+// compilation units, linking and creating the module object, is done by
+// Finish() once all bytes were received.
+//
+// The size of the module does not need to be known up front. Function bodies
+// are compiled straight out of the buffer that collects the module bytes, so
+// compilation is paused while the buffer grows.
+class V8_EXPORT_PRIVATE StreamingDecoder {
+ public:
+  // {thrower} needs to stay alive until Finish() returned.
+  StreamingDecoder(Isolate* isolate, ErrorThrower* thrower);
+  ~StreamingDecoder();
+
+  // Consumes the next chunk of module bytes. Returns false if the bytes
+  // received so far do not form a valid module prefix; the error is reported
+  // by Finish().
+  bool OnBytesReceived(const byte* bytes, size_t length);
+
+  // Waits for all compilation tasks and creates the module object. Reports
+  // errors to the thrower and returns an empty handle on failure.
+  MaybeHandle<JSObject> Finish();
+
+ private:
+  class CompilationTask;
+  class PauseCompilationScope;
+
+  enum State {
+    kModuleHeader,
+    kSectionHeader,
+    kSectionPayload,
+    kFunctionCount,
+    kFunctionBody,
+    kFailed
+  };
+
+  // Makes one step of the state machine. Returns false if more bytes are
+  // needed or decoding failed.
+  bool DecodeStep();
+  // Reads a LEB128 encoded value starting at {*offset}. Returns false if the
+  // value is incomplete or invalid; {*offset} is only advanced on success.
+  bool ReadVarUint32(size_t* offset, uint32_t* value);
+  bool Fail(const std::string& error);
+
+  // Grows the buffer to hold at least {min_capacity} bytes.
+  void Grow(size_t min_capacity);
+  // Points the module at the current buffer.
+  void UpdateModuleBytes();
+
+  bool OnSectionPayload();
+  bool OnCodeSectionStart();
+  void OnFunctionBody(uint32_t index, size_t start, size_t end);
+  void AddCompilationUnits();
+  // Starts background tasks for the pending compilation units. Needs to be
+  // called with {mutex_} held.
+  void StartCompilationTasks();
+
+  // Executes the next pending compilation unit, if any. Background tasks
+  // unregister themselves once the queue is empty.
+  bool FetchAndExecuteCompilationUnit(bool on_task);
+  void WaitForCompilationTasks();
+
+  Isolate* isolate_;
+  ErrorThrower* thrower_;
+  std::unique_ptr<byte[]> buffer_;
+  size_t capacity_;
+  size_t received_;
+
+  State state_;
+  std::string error_;
+  size_t offset_;
+  uint8_t section_code_;
+  size_t payload_start_;
+  size_t section_end_;
+  uint32_t num_functions_;
+  uint32_t next_function_;
+
+  // The module as decoded so far. Function bodies are recorded in the module
+  // by this decoder while they arrive.
+  Zone zone_;
+  IncrementalModuleDecoder module_decoder_;
+  bool code_section_started_;
+  // Indices of declared functions whose bodies are complete but which have no
+  // compilation unit yet.
+  std::vector<uint32_t> completed_functions_;
+  std::unique_ptr<WasmInstance> temp_instance_;
+  ModuleEnv module_env_;
+  Handle<FixedArray> code_table_;
+  MaybeHandle<FixedArray> indirect_table_;
+  std::vector<DeferredHandles*> deferred_handles_;
+
+  // Compilation units shared with the background tasks.
+  base::Mutex mutex_;
+  std::queue<compiler::WasmCompilationUnit*> pending_units_;
+  std::vector<compiler::WasmCompilationUnit*> executed_units_;
+  size_t running_tasks_;
+  size_t max_tasks_;
+  std::vector<uint32_t> task_ids_;
+  base::Semaphore pending_tasks_;
+
+  DISALLOW_COPY_AND_ASSIGN(StreamingDecoder);
+};
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_WASM_STREAMING_DECODER_H_
@@ -4,12 +4,15 @@
 
 #include "src/wasm/wasm-function-name-table.h"
 
+#include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-module.h"
 
 namespace v8 {
 namespace internal {
 namespace wasm {
 
+namespace {
+
 // Build an array with all function names. If there are N functions in the
 // module, then the first (kIntSize * (N+1)) bytes are integer entries.
 // The first integer entry encodes the number of functions in the module.
@@ -18,23 +21,23 @@ namespace wasm {
 // integer entry is the negative offset of the next function name.
 // After these N+1 integer entries, the second part begins, which holds a
 // concatenation of all function names.
-Handle<ByteArray> BuildFunctionNamesTable(Isolate* isolate,
-                                          const WasmModule* module) {
-  uint64_t func_names_length = 0;
-  for (auto& func : module->functions) func_names_length += func.name_length;
-  int num_funcs_int = static_cast<int>(module->functions.size());
+// {get_name} is only called after the array is allocated, so it may return
+// pointers into movable heap objects.
+template <typename GetName>
+Handle<ByteArray> BuildTable(Isolate* isolate, size_t num_funcs,
+                             uint64_t func_names_length, GetName get_name) {
+  int num_funcs_int = static_cast<int>(num_funcs);
   int current_offset = (num_funcs_int + 1) * kIntSize;
   uint64_t total_array_length = current_offset + func_names_length;
   int total_array_length_int = static_cast<int>(total_array_length);
   // Check for overflow.
   CHECK(total_array_length_int == total_array_length && num_funcs_int >= 0 &&
-        num_funcs_int == module->functions.size());
+        num_funcs_int == num_funcs);
   Handle<ByteArray> func_names_array =
       isolate->factory()->NewByteArray(total_array_length_int, TENURED);
   func_names_array->set_int(0, num_funcs_int);
-  int func_index = 0;
-  for (const WasmFunction& fun : module->functions) {
-    WasmName name = module->GetNameOrNull(&fun);
+  for (int func_index = 0; func_index < num_funcs_int; ++func_index) {
+    WasmName name = get_name(func_index);
     if (name.start() == nullptr) {
       func_names_array->set_int(func_index + 1, -current_offset);
     } else {
@@ -44,11 +47,47 @@ Handle<ByteArray> BuildFunctionNamesTable(Isolate* isolate,
       func_names_array->set_int(func_index + 1, current_offset);
       current_offset += name.length();
     }
-    ++func_index;
   }
   return func_names_array;
 }
 
+}  // namespace
+
+Handle<ByteArray> BuildFunctionNamesTable(Isolate* isolate,
+                                          const WasmModule* module) {
+  uint64_t func_names_length = 0;
+  for (auto& func : module->functions) func_names_length += func.name_length;
+  return BuildTable(isolate, module->functions.size(), func_names_length,
+                    [module](int func_index) {
+                      return module->GetNameOrNull(
+                          &module->functions[func_index]);
+                    });
+}
+
+MaybeHandle<ByteArray> BuildFunctionNamesTable(
+    Isolate* isolate, Handle<SeqOneByteString> module_bytes,
+    uint32_t num_imported_functions) {
+  FunctionOffsets names;
+  {
+    DisallowHeapAllocation no_gc;
+    const byte* start = module_bytes->GetChars();
+    FunctionOffsetsResult result = DecodeWasmFunctionNames(
+        start, start + module_bytes->length(), num_imported_functions);
+    if (result.failed()) return {};
+    names = std::move(result.val);
+  }
+  uint64_t func_names_length = 0;
+  for (auto& name : names) func_names_length += name.second;
+  return BuildTable(isolate, names.size(), func_names_length,
+                    [module_bytes, &names](int func_index) -> WasmName {
+                      const std::pair<int, int>& name = names[func_index];
+                      if (name.first == 0 && name.second == 0) return {};
+                      return {reinterpret_cast<const char*>(
+                                  module_bytes->GetChars() + name.first),
+                              name.second};
+                    });
+}
+
 MaybeHandle<String> GetWasmFunctionNameFromTable(
     Handle<ByteArray> func_names_array, uint32_t func_index) {
   uint32_t num_funcs = static_cast<uint32_t>(func_names_array->get_int(0));
@@ -19,6 +19,13 @@ struct WasmModule;
 Handle<ByteArray> BuildFunctionNamesTable(Isolate* isolate,
                                           const WasmModule* module);
 
+// Encode all function names into one ByteArray, reading them from the name
+// section of the wire bytes. Returns an empty handle if the name section
+// cannot be decoded.
+MaybeHandle<ByteArray> BuildFunctionNamesTable(
+    Isolate* isolate, Handle<SeqOneByteString> module_bytes,
+    uint32_t num_imported_functions);
+
 // Extract the function name for the given func_index from the function name
 // table.
 // Returns a null handle if the respective function is unnamed (not to be
@@ -718,13 +718,23 @@ static const int kRunSteps = 1000;
 // A helper class to compute the control transfers for each bytecode offset.
 // Control transfers allow Br, BrIf, BrTable, If, Else, and End bytecodes to
 // be directly executed without the need to dynamically track blocks.
+// The immediates of the most frequently executed bytecodes are decoded in the
+// same pass, so that the interpreter does not decode LEB128s on every step.
 class ControlTransfers : public ZoneObject {
  public:
+  // A decoded immediate and the length of the encoded immediates.
+  struct Immediate {
+    uint32_t value;
+    uint32_t length;
+  };
+
   ControlTransferMap map_;
 
   ControlTransfers(Zone* zone, ModuleEnv* env, AstLocalDecls* locals,
                    const byte* start, const byte* end)
-      : map_(zone) {
+      : map_(zone),
+        targets_(end - start, 0, zone),
+        immediates_(end - start, Immediate{0, 0}, zone) {
     // Represents a control flow label.
     struct CLabel : public ZoneObject {
       const byte* target;
@@ -782,6 +792,7 @@ class ControlTransfers : public ZoneObject {
       WasmOpcode opcode = i.current();
       TRACE("@%u: control %s\n", i.pc_offset(),
             WasmOpcodes::OpcodeName(opcode));
+      DecodeImmediate(&i, opcode);
       switch (opcode) {
         case kExprBlock: {
           TRACE("control @%u: Block\n", i.pc_offset());
@@ -859,14 +870,75 @@ class ControlTransfers : public ZoneObject {
       }
     }
     if (!func_label->target) func_label->Bind(&map_, start, end);
+    // Flatten the map for constant time lookups. No transfer is to the
+    // bytecode itself, so 0 marks offsets without a transfer.
+    for (auto entry : map_) {
+      DCHECK_NE(0, entry.second);
+      if (entry.first < targets_.size()) targets_[entry.first] = entry.second;
+    }
   }
 
   pcdiff_t Lookup(pc_t from) {
-    auto result = map_.find(from);
-    if (result == map_.end()) {
+    pcdiff_t result = from < targets_.size() ? targets_[from] : 0;
+    if (result == 0) {
       V8_Fatal(__FILE__, __LINE__, "no control target for pc %zu", from);
     }
-    return result->second;
+    return result;
+  }
+
+  const Immediate& LookupImmediate(pc_t pc) {
+    DCHECK_LT(pc, immediates_.size());
+    return immediates_[pc];
+  }
+
+ private:
+  ZoneVector<pcdiff_t> targets_;
+  ZoneVector<Immediate> immediates_;
+
+  void DecodeImmediate(BytecodeIterator* i, WasmOpcode opcode) {
+    Immediate* immediate = &immediates_[i->pc_offset()];
+    switch (opcode) {
+      case kExprGetLocal:
+      case kExprSetLocal:
+      case kExprTeeLocal: {
+        LocalIndexOperand operand(i, i->pc());
+        *immediate = {operand.index, operand.length};
+        break;
+      }
+      case kExprI32Const: {
+        ImmI32Operand operand(i, i->pc());
+        *immediate = {static_cast<uint32_t>(operand.value), operand.length};
+        break;
+      }
+      case kExprBr:
+      case kExprBrIf: {
+        BreakDepthOperand operand(i, i->pc());
+        *immediate = {operand.depth, operand.length};
+        break;
+      }
+      case kExprCallFunction: {
+        CallFunctionOperand operand(i, i->pc());
+        *immediate = {operand.index, operand.length};
+        break;
+      }
+      case kExprGetGlobal:
+      case kExprSetGlobal: {
+        GlobalIndexOperand operand(i, i->pc());
+        *immediate = {operand.index, operand.length};
+        break;
+      }
+#define MEMORY_CASE(name, opcode, sig) case kExpr##name:
+        FOREACH_LOAD_MEM_OPCODE(MEMORY_CASE)
+        FOREACH_STORE_MEM_OPCODE(MEMORY_CASE) {
+          // The alignment was checked when the module was validated.
+          MemoryAccessOperand operand(i, i->pc(), kMaxUInt32);
+          *immediate = {operand.offset, operand.length};
+          break;
+        }
+#undef MEMORY_CASE
+      default:
+        break;
+    }
   }
 };
 
@@ -1160,6 +1232,11 @@ class ThreadImpl : public WasmInterpreter::Thread {
     return static_cast<int>(code->targets->Lookup(pc));
   }
 
+  const ControlTransfers::Immediate& LookupImmediate(InterpreterCode* code,
+                                                     pc_t pc) {
+    return code->targets->LookupImmediate(pc);
+  }
+
   int DoBreak(InterpreterCode* code, pc_t pc, size_t depth) {
     size_t bp = blocks_.size() - depth - 1;
     Block* target = &blocks_[bp];
@@ -1307,17 +1384,19 @@ class ThreadImpl : public WasmInterpreter::Thread {
           break;
         }
         case kExprBr: {
-          BreakDepthOperand operand(&decoder, code->at(pc));
-          len = DoBreak(code, pc, operand.depth);
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
+          len = DoBreak(code, pc, operand.value);
           TRACE("  br => @%zu\n", pc + len);
           break;
         }
         case kExprBrIf: {
-          BreakDepthOperand operand(&decoder, code->at(pc));
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
           WasmVal cond = Pop();
           bool is_true = cond.to<uint32_t>() != 0;
           if (is_true) {
-            len = DoBreak(code, pc, operand.depth);
+            len = DoBreak(code, pc, operand.value);
             TRACE("  br_if => @%zu\n", pc + len);
           } else {
             TRACE("  false => fallthrough\n");
@@ -1354,8 +1433,9 @@ class ThreadImpl : public WasmInterpreter::Thread {
           break;
         }
         case kExprI32Const: {
-          ImmI32Operand operand(&decoder, code->at(pc));
-          Push(pc, WasmVal(operand.value));
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
+          Push(pc, WasmVal(static_cast<int32_t>(operand.value)));
           len = 1 + operand.length;
           break;
         }
@@ -1378,22 +1458,25 @@ class ThreadImpl : public WasmInterpreter::Thread {
           break;
         }
         case kExprGetLocal: {
-          LocalIndexOperand operand(&decoder, code->at(pc));
-          Push(pc, stack_[frames_.back().sp + operand.index]);
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
+          Push(pc, stack_[frames_.back().sp + operand.value]);
           len = 1 + operand.length;
           break;
         }
         case kExprSetLocal: {
-          LocalIndexOperand operand(&decoder, code->at(pc));
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
           WasmVal val = Pop();
-          stack_[frames_.back().sp + operand.index] = val;
+          stack_[frames_.back().sp + operand.value] = val;
           len = 1 + operand.length;
           break;
         }
         case kExprTeeLocal: {
-          LocalIndexOperand operand(&decoder, code->at(pc));
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
           WasmVal val = Pop();
-          stack_[frames_.back().sp + operand.index] = val;
+          stack_[frames_.back().sp + operand.value] = val;
           Push(pc, val);
           len = 1 + operand.length;
           break;
@@ -1403,8 +1486,9 @@ class ThreadImpl : public WasmInterpreter::Thread {
           break;
         }
         case kExprCallFunction: {
-          CallFunctionOperand operand(&decoder, code->at(pc));
-          InterpreterCode* target = codemap()->GetCode(operand.index);
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
+          InterpreterCode* target = codemap()->GetCode(operand.value);
           DoCall(target, &pc, pc + 1 + operand.length, &limit);
           code = target;
           decoder.Reset(code->start, code->end);
@@ -1437,8 +1521,9 @@ class ThreadImpl : public WasmInterpreter::Thread {
           continue;
         }
         case kExprGetGlobal: {
-          GlobalIndexOperand operand(&decoder, code->at(pc));
-          const WasmGlobal* global = &module()->globals[operand.index];
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
+          const WasmGlobal* global = &module()->globals[operand.value];
           byte* ptr = instance()->globals_start + global->offset;
           LocalType type = global->type;
           WasmVal val;
@@ -1458,8 +1543,9 @@ class ThreadImpl : public WasmInterpreter::Thread {
           break;
         }
         case kExprSetGlobal: {
-          GlobalIndexOperand operand(&decoder, code->at(pc));
-          const WasmGlobal* global = &module()->globals[operand.index];
+          const ControlTransfers::Immediate& operand =
+              LookupImmediate(code, pc);
+          const WasmGlobal* global = &module()->globals[operand.value];
           byte* ptr = instance()->globals_start + global->offset;
           LocalType type = global->type;
           WasmVal val = Pop();
@@ -1480,14 +1566,14 @@ class ThreadImpl : public WasmInterpreter::Thread {
 
 #define LOAD_CASE(name, ctype, mtype)                                       \
   case kExpr##name: {                                                       \
-    MemoryAccessOperand operand(&decoder, code->at(pc), sizeof(ctype));     \
+    const ControlTransfers::Immediate& operand = LookupImmediate(code, pc); \
     uint32_t index = Pop().to<uint32_t>();                                  \
     size_t effective_mem_size = instance()->mem_size - sizeof(mtype);       \
-    if (operand.offset > effective_mem_size ||                              \
-        index > (effective_mem_size - operand.offset)) {                    \
+    if (operand.value > effective_mem_size ||                               \
+        index > (effective_mem_size - operand.value)) {                     \
       return DoTrap(kTrapMemOutOfBounds, pc);                               \
     }                                                                       \
-    byte* addr = instance()->mem_start + operand.offset + index;            \
+    byte* addr = instance()->mem_start + operand.value + index;             \
     WasmVal result(static_cast<ctype>(ReadLittleEndianValue<mtype>(addr))); \
     Push(pc, result);                                                       \
     len = 1 + operand.length;                                               \
@@ -1512,15 +1598,15 @@ class ThreadImpl : public WasmInterpreter::Thread {
 
 #define STORE_CASE(name, ctype, mtype)                                        \
   case kExpr##name: {                                                         \
-    MemoryAccessOperand operand(&decoder, code->at(pc), sizeof(ctype));       \
+    const ControlTransfers::Immediate& operand = LookupImmediate(code, pc);   \
     WasmVal val = Pop();                                                      \
     uint32_t index = Pop().to<uint32_t>();                                    \
     size_t effective_mem_size = instance()->mem_size - sizeof(mtype);         \
-    if (operand.offset > effective_mem_size ||                                \
-        index > (effective_mem_size - operand.offset)) {                      \
+    if (operand.value > effective_mem_size ||                                 \
+        index > (effective_mem_size - operand.value)) {                       \
       return DoTrap(kTrapMemOutOfBounds, pc);                                 \
     }                                                                         \
-    byte* addr = instance()->mem_start + operand.offset + index;              \
+    byte* addr = instance()->mem_start + operand.value + index;               \
     WriteLittleEndianValue<mtype>(addr, static_cast<mtype>(val.to<ctype>())); \
     len = 1 + operand.length;                                                 \
     break;                                                                    \
@@ -15,6 +15,7 @@
 #include "src/isolate.h"
 #include "src/objects.h"
 #include "src/parsing/parse-info.h"
+#include "src/trap-handler/trap-handler.h"
 
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-js.h"
@@ -29,6 +30,7 @@ namespace v8 {
 
 static const int kWasmMemoryBufferFieldIndex = 0;
 static const int kWasmMemoryMaximumFieldIndex = 1;
+static const int kWasmMemoryInstancesFieldIndex = 2;
 static const int kWasmTableArrayFieldIndex = 0;
 static const int kWasmTableMaximumFieldIndex = 1;
 
@@ -469,12 +471,51 @@ void WebAssemblyMemory(const v8::FunctionCallbackInfo<v8::Value>& args) {
       return;
     }
   }
+  // The descriptor's 'shared'.
+  bool shared = false;
+  if (i::FLAG_wasm_atomics_prototype) {
+    Local<Value> value;
+    if (!descriptor->Get(context, v8_str(isolate, "shared")).ToLocal(&value)) {
+      return;
+    }
+    shared = value->BooleanValue(context).FromMaybe(false);
+  }
+  if (shared && !has_maximum.FromJust()) {
+    thrower.TypeError("A shared memory must have a maximum");
+    return;
+  }
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
-  i::Handle<i::JSArrayBuffer> buffer =
-      i_isolate->factory()->NewJSArrayBuffer(i::SharedFlag::kNotShared);
   size_t size = static_cast<size_t>(i::wasm::WasmModule::kPageSize) *
                 static_cast<size_t>(initial);
-  i::JSArrayBuffer::SetupAllocatingData(buffer, i_isolate, size);
+  i::Handle<i::JSArrayBuffer> buffer;
+  if (shared) {
+    // A shared memory is backed by a SharedArrayBuffer, which other workers
+    // access concurrently through the JS Atomics or wasm atomic opcodes. It
+    // cannot grow, so it has no guard region to grow into.
+    if (i::trap_handler::UseTrapHandler()) {
+      thrower.RangeError(
+          "shared memory is not supported with --wasm-trap-handler");
+      return;
+    }
+    buffer = i_isolate->factory()->NewJSArrayBuffer(i::SharedFlag::kShared);
+    if (!i::JSArrayBuffer::SetupAllocatingData(buffer, i_isolate, size, true,
+                                               i::SharedFlag::kShared)) {
+      thrower.RangeError("could not allocate memory");
+      return;
+    }
+  } else if (i::wasm::EnableGuardRegions()) {
+    // Instances compiled for the trap handler expect their memory to be
+    // surrounded by guard regions, also when it is imported. The region also
+    // lets the memory grow in place.
+    buffer = i::wasm::NewArrayBuffer(i_isolate, size, true);
+    if (buffer.is_null()) {
+      thrower.RangeError("could not allocate memory");
+      return;
+    }
+  } else {
+    buffer = i_isolate->factory()->NewJSArrayBuffer(i::SharedFlag::kNotShared);
+    i::JSArrayBuffer::SetupAllocatingData(buffer, i_isolate, size);
+  }
 
   i::Handle<i::JSObject> memory_obj = i::WasmJs::CreateWasmMemoryObject(
       i_isolate, buffer, has_maximum.FromJust(), maximum);
@@ -616,6 +657,8 @@ i::Handle<i::JSObject> i::WasmJs::CreateWasmMemoryObject(
       has_maximum
           ? static_cast<i::Object*>(i::Smi::FromInt(maximum))
           : static_cast<i::Object*>(i_isolate->heap()->undefined_value()));
+  memory_obj->SetInternalField(kWasmMemoryInstancesFieldIndex,
+                               i_isolate->heap()->undefined_value());
   i::Handle<i::Symbol> memory_sym(
       i_isolate->native_context()->wasm_memory_sym());
   i::Object::SetProperty(memory_obj, memory_sym, memory_obj, i::STRICT).Check();
@@ -743,7 +786,7 @@ void WasmJs::InstallWasmConstructors(Isolate* isolate,
   Handle<JSObject> memory_proto =
       factory->NewJSObject(memory_constructor, TENURED);
   map = isolate->factory()->NewMap(
-      i::JS_OBJECT_TYPE, i::JSObject::kHeaderSize + 2 * i::kPointerSize);
+      i::JS_OBJECT_TYPE, i::JSObject::kHeaderSize + 3 * i::kPointerSize);
   JSFunction::SetInitialMap(memory_constructor, map, memory_proto);
   JSObject::AddProperty(memory_proto, isolate->factory()->constructor_string(),
                         memory_constructor, DONT_ENUM);
@@ -855,5 +898,32 @@ Handle<JSArrayBuffer> WasmJs::GetWasmMemoryArrayBuffer(Isolate* isolate,
       isolate);
   return Handle<JSArrayBuffer>::cast(buf);
 }
+
+void WasmJs::SetWasmMemoryArrayBuffer(Isolate* isolate, Handle<Object> value,
+                                      Handle<JSArrayBuffer> buffer) {
+  DCHECK(IsWasmMemoryObject(isolate, value));
+  JSObject::cast(*value)->SetInternalField(kWasmMemoryBufferFieldIndex,
+                                           *buffer);
+}
+
+void WasmJs::AddWasmMemoryInstance(Isolate* isolate, Handle<Object> value,
+                                   Handle<JSObject> instance) {
+  DCHECK(IsWasmMemoryObject(isolate, value));
+  Handle<JSObject> memory_object = Handle<JSObject>::cast(value);
+  Handle<Object> instances(
+      memory_object->GetInternalField(kWasmMemoryInstancesFieldIndex),
+      isolate);
+  Handle<WeakFixedArray> new_instances =
+      WeakFixedArray::Add(instances, instance);
+  memory_object->SetInternalField(kWasmMemoryInstancesFieldIndex,
+                                  *new_instances);
+}
+
+Object* WasmJs::GetWasmMemoryInstances(Isolate* isolate,
+                                       Handle<Object> value) {
+  DCHECK(IsWasmMemoryObject(isolate, value));
+  return JSObject::cast(*value)->GetInternalField(
+      kWasmMemoryInstancesFieldIndex);
+}
 }  // namespace internal
 }  // namespace v8
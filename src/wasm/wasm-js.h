@@ -32,6 +32,18 @@ class WasmJs {
 
   static Handle<JSArrayBuffer> GetWasmMemoryArrayBuffer(Isolate* isolate,
                                                         Handle<Object> value);
+
+  static void SetWasmMemoryArrayBuffer(Isolate* isolate, Handle<Object> value,
+                                       Handle<JSArrayBuffer> buffer);
+
+  // Records that {instance} uses the memory of the WebAssembly.Memory object
+  // {value}, so that all of them are updated when the memory grows.
+  static void AddWasmMemoryInstance(Isolate* isolate, Handle<Object> value,
+                                    Handle<JSObject> instance);
+
+  // Returns the WeakFixedArray of instances using the memory, or undefined.
+  static Object* GetWasmMemoryInstances(Isolate* isolate,
+                                        Handle<Object> value);
 };
 
 }  // namespace internal
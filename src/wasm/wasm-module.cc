@@ -12,6 +12,7 @@
 #include "src/property-descriptor.h"
 #include "src/simulator.h"
 #include "src/snapshot/snapshot.h"
+#include "src/trap-handler/trap-handler.h"
 #include "src/v8.h"
 
 #include "src/wasm/ast-decoder.h"
@@ -161,30 +162,83 @@ void PatchFunctionTable(Handle<Code> code,
   }
 }
 
-Handle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size) {
-  if (size > (WasmModule::kMaxMemPages * WasmModule::kPageSize)) {
-    // TODO(titzer): lift restriction on maximum memory allocated here.
-    return Handle<JSArrayBuffer>::null();
-  }
-  void* memory = isolate->array_buffer_allocator()->Allocate(size);
-  if (memory == nullptr) {
-    return Handle<JSArrayBuffer>::null();
+// The size of the region reserved for a memory with guard regions. The
+// effective address of an access is the sum of a 32-bit index and a 32-bit
+// offset, so every access starts within the first 8 GiB from the memory start.
+// This also covers the largest memory, so such a memory grows in place.
+const size_t kWasmMaxHeapOffset =
+    (static_cast<size_t>(std::numeric_limits<uint32_t>::max()) + 1) * 2;
+
+// Releases the region of a memory with guard regions when its buffer dies.
+// Buffers neutered by GrowInstanceMemory have passed their region on to the
+// grown buffer.
+void GuardedMemoryFinalizer(const v8::WeakCallbackInfo<void>& data) {
+  JSArrayBuffer** p = reinterpret_cast<JSArrayBuffer**>(data.GetParameter());
+  JSArrayBuffer* buffer = *p;
+  void* memory = buffer->backing_store();
+  if (memory != nullptr) {
+    size_t size = NumberToSize(buffer->byte_length());
+    base::VirtualMemory::ReleaseRegion(memory, kWasmMaxHeapOffset);
+    data.GetIsolate()->AdjustAmountOfExternalAllocatedMemory(
+        -static_cast<int64_t>(size));
   }
+  GlobalHandles::Destroy(reinterpret_cast<Object**>(p));
+}
 
-#if DEBUG
-  // Double check the API allocator actually zero-initialized the memory.
-  const byte* bytes = reinterpret_cast<const byte*>(memory);
-  for (size_t i = 0; i < size; ++i) {
-    DCHECK_EQ(0, bytes[i]);
-  }
-#endif
-
+// Wraps {size} committed bytes at the start of the reserved region {memory}
+// into a buffer which releases the region when it dies.
+Handle<JSArrayBuffer> SetupGuardedArrayBuffer(Isolate* isolate, void* memory,
+                                              size_t size) {
+  // The buffer is external, so that the array buffer allocator does not free
+  // the region; the finalizer releases it instead.
   Handle<JSArrayBuffer> buffer = isolate->factory()->NewJSArrayBuffer();
-  JSArrayBuffer::Setup(buffer, isolate, false, memory, static_cast<int>(size));
+  JSArrayBuffer::Setup(buffer, isolate, true, memory, static_cast<int>(size));
   buffer->set_is_neuterable(false);
+  buffer->set_has_guard_region(true);
+
+  Handle<Object> global_handle = isolate->global_handles()->Create(*buffer);
+  GlobalHandles::MakeWeak(global_handle.location(), global_handle.location(),
+                          &GuardedMemoryFinalizer,
+                          v8::WeakCallbackType::kFinalizer);
   return buffer;
 }
 
+Handle<JSArrayBuffer> NewGuardedArrayBuffer(Isolate* isolate, size_t size) {
+  void* memory = base::VirtualMemory::ReserveRegion(kWasmMaxHeapOffset);
+  if (memory == nullptr) return Handle<JSArrayBuffer>::null();
+  // The rest of the region stays inaccessible. Committed pages are zeroed.
+  if (size > 0 && !base::VirtualMemory::CommitRegion(memory, size, false)) {
+    base::VirtualMemory::ReleaseRegion(memory, kWasmMaxHeapOffset);
+    return Handle<JSArrayBuffer>::null();
+  }
+  reinterpret_cast<v8::Isolate*>(isolate)
+      ->AdjustAmountOfExternalAllocatedMemory(static_cast<int64_t>(size));
+  return SetupGuardedArrayBuffer(isolate, memory, size);
+}
+
+// Grows a memory with guard regions to {new_size} bytes by committing more of
+// its region. The contents stay in place, so neither a copy nor a change of
+// the memory start is needed. {old_buffer} is neutered and the returned buffer
+// takes over the region.
+Handle<JSArrayBuffer> GrowGuardedArrayBuffer(Isolate* isolate,
+                                             Handle<JSArrayBuffer> old_buffer,
+                                             size_t new_size) {
+  DCHECK(old_buffer->has_guard_region());
+  byte* memory = static_cast<byte*>(old_buffer->backing_store());
+  size_t old_size = NumberToSize(old_buffer->byte_length());
+  DCHECK_LT(old_size, new_size);
+  if (!base::VirtualMemory::CommitRegion(memory + old_size,
+                                         new_size - old_size, false)) {
+    return Handle<JSArrayBuffer>::null();
+  }
+  reinterpret_cast<v8::Isolate*>(isolate)
+      ->AdjustAmountOfExternalAllocatedMemory(
+          static_cast<int64_t>(new_size - old_size));
+  old_buffer->set_is_neuterable(true);
+  old_buffer->Neuter();
+  return SetupGuardedArrayBuffer(isolate, memory, new_size);
+}
+
 void RelocateInstanceCode(Handle<JSObject> instance, Address old_start,
                           Address start, uint32_t prev_size,
                           uint32_t new_size) {
@@ -574,6 +628,45 @@ void CompileSequentially(Isolate* isolate, const WasmModule* module,
   }
 }
 
+// Validates the function bodies, but installs a lazy compile stub instead of
+// compiling each function; see wasm::CompileLazy. Functions with the same
+// signature share one compiled stub; each function gets its own copy, which
+// carries the function index in its deoptimization data.
+void InstallLazyCompileStubs(Isolate* isolate, const WasmModule* module,
+                             std::vector<Handle<Code>>& functions,
+                             ErrorThrower* thrower, ModuleEnv* module_env) {
+  DCHECK(!thrower->error());
+  std::map<FunctionSig*, Handle<Code>> stubs;
+
+  for (uint32_t i = FLAG_skip_compiling_wasm_funcs;
+       i < module->functions.size(); ++i) {
+    const WasmFunction& func = module->functions[i];
+    if (func.imported) continue;  // Imports are compiled at instantiation time.
+
+    FunctionBody body = {module_env, func.sig, module->module_start,
+                         module->module_start + func.code_start_offset,
+                         module->module_start + func.code_end_offset};
+    DecodeResult result = VerifyWasmCode(isolate->allocator(), body);
+    if (result.failed()) {
+      WasmName str = module->GetName(func.name_offset, func.name_length);
+      ScopedVector<char> buffer(128);
+      SNPrintF(buffer, "Compiling WASM function #%d:%.*s failed:", i,
+               str.length(), str.start());
+      thrower->CompileFailed(buffer.start(), result);
+      return;
+    }
+
+    Handle<Code>& stub = stubs[func.sig];
+    if (stub.is_null()) {
+      stub = compiler::CompileWasmLazyCompileStub(isolate, module_env,
+                                                  func.sig);
+      functions[i] = stub;
+    } else {
+      functions[i] = isolate->factory()->CopyCode(stub);
+    }
+  }
+}
+
 void PatchDirectCalls(Handle<FixedArray> old_functions,
                       Handle<FixedArray> new_functions, int start) {
   DCHECK_EQ(new_functions->length(), old_functions->length());
@@ -606,6 +699,99 @@ void PatchDirectCalls(Handle<FixedArray> old_functions,
   }
 }
 
+// Finds the functions in {code_table} whose code can be shared by all
+// instances of a module, because it contains nothing which instantiation
+// patches: no references to memory, globals or function tables, and no calls
+// to imports or to functions which cannot be shared themselves. Calls to the
+// runtime functions which look up the calling instance are excluded too.
+std::vector<bool> FindInstanceIndependentCode(Isolate* isolate,
+                                              Handle<FixedArray> code_table) {
+  DisallowHeapAllocation no_gc;
+  std::map<Code*, int> indices;
+  std::vector<bool> independent(code_table->length(), false);
+  for (int i = 0; i < code_table->length(); ++i) {
+    Code* code = Code::cast(code_table->get(i));
+    indices.insert(std::make_pair(code, i));
+    independent[i] = code->kind() == Code::WASM_FUNCTION;
+  }
+  Address grow_memory =
+      ExternalReference(Runtime::kWasmGrowMemory, isolate).address();
+  Address memory_size =
+      ExternalReference(Runtime::kWasmMemorySize, isolate).address();
+  // Lazy compile stubs compile the function for the instance they belong to.
+  Address compile_lazy =
+      ExternalReference(Runtime::kWasmCompileLazy, isolate).address();
+  int data_mask = RelocInfo::ModeMask(RelocInfo::WASM_MEMORY_REFERENCE) |
+                  RelocInfo::ModeMask(RelocInfo::WASM_MEMORY_SIZE_REFERENCE) |
+                  RelocInfo::ModeMask(RelocInfo::WASM_GLOBAL_REFERENCE) |
+                  RelocInfo::ModeMask(RelocInfo::EMBEDDED_OBJECT) |
+                  RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE);
+  for (int i = 0; i < code_table->length(); ++i) {
+    if (!independent[i]) continue;
+    Code* code = Code::cast(code_table->get(i));
+    for (RelocIterator it(code, data_mask); !it.done(); it.next()) {
+      RelocInfo::Mode mode = it.rinfo()->rmode();
+      if (mode == RelocInfo::EMBEDDED_OBJECT) {
+        // Function tables are the only embedded fixed arrays which are
+        // replaced per instance; the context is shared.
+        Object* target = it.rinfo()->target_object();
+        if (!target->IsFixedArray() || target->IsContext()) continue;
+      } else if (mode == RelocInfo::EXTERNAL_REFERENCE) {
+        Address target = it.rinfo()->target_external_reference();
+        if (target != grow_memory && target != memory_size &&
+            target != compile_lazy) {
+          continue;
+        }
+      }
+      independent[i] = false;
+      break;
+    }
+  }
+  // Calls to imports and to instance specific functions are patched, so
+  // propagate that to the callers until nothing changes.
+  int call_mask = RelocInfo::ModeMask(RelocInfo::CODE_TARGET);
+  AllowDeferredHandleDereference embedding_raw_address;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int i = 0; i < code_table->length(); ++i) {
+      if (!independent[i]) continue;
+      Code* code = Code::cast(code_table->get(i));
+      for (RelocIterator it(code, call_mask); !it.done(); it.next()) {
+        Code* target =
+            Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
+        if (target->kind() != Code::WASM_TO_JS_FUNCTION &&
+            target->kind() != Code::WASM_FUNCTION) {
+          continue;
+        }
+        auto found = indices.find(target);
+        if (target->kind() == Code::WASM_TO_JS_FUNCTION ||
+            found == indices.end() || !independent[found->second]) {
+          independent[i] = false;
+          changed = true;
+          break;
+        }
+      }
+    }
+  }
+  return independent;
+}
+
+// Code shared by several instances refers to one of them in its deoptimization
+// data, so that stack walks and runtime calls find a live instance. When that
+// instance dies, {code_table} is handed to the instance behind {heir}.
+void HandOffSharedCode(FixedArray* code_table, WeakCell* dying,
+                       WeakCell* heir) {
+  for (int i = 0; i < code_table->length(); ++i) {
+    Code* code = Code::cast(code_table->get(i));
+    if (code->kind() != Code::WASM_FUNCTION) continue;
+    FixedArray* deopt_data = code->deoptimization_data();
+    if (deopt_data->length() == 2 && deopt_data->get(0) == dying) {
+      deopt_data->set(0, heir);
+    }
+  }
+}
+
 static void ResetCompiledModule(Isolate* isolate, JSObject* owner,
                                 WasmCompiledModule* compiled_module) {
   TRACE("Resetting %d\n", compiled_module->instance_id());
@@ -657,12 +843,77 @@ static void ResetCompiledModule(Isolate* isolate, JSObject* owner,
   compiled_module->reset_heap();
 }
 
+// Registers the protected instructions of a wasm function with the trap
+// handler, now that the code is at its final location.
+void RegisterProtectedInstructions(Code* code) {
+  DisallowHeapAllocation no_gc;
+  DCHECK_EQ(Code::WASM_FUNCTION, code->kind());
+  DCHECK_EQ(-1, code->trap_handler_index());
+  FixedArray* protected_instructions = code->protected_instructions();
+  int num_instructions = protected_instructions->length() / 2;
+  if (num_instructions == 0) return;
+  std::unique_ptr<trap_handler::ProtectedInstructionData[]> unpacked(
+      new trap_handler::ProtectedInstructionData[num_instructions]);
+  for (int j = 0; j < num_instructions; ++j) {
+    unpacked[j].instr_offset =
+        Smi::cast(protected_instructions->get(j * 2))->value();
+    unpacked[j].landing_offset =
+        Smi::cast(protected_instructions->get(j * 2 + 1))->value();
+  }
+  int index = trap_handler::RegisterHandlerData(
+      code->instruction_start(), code->instruction_size(), num_instructions,
+      unpacked.get());
+  if (index < 0) {
+    V8::FatalProcessOutOfMemory("RegisterProtectedInstructions");
+  }
+  code->set_trap_handler_index(index);
+}
+
+// Registers the protected instructions of all functions of an instance.
+void RegisterProtectedInstructions(Handle<FixedArray> code_table) {
+  DisallowHeapAllocation no_gc;
+  for (int i = 0; i < code_table->length(); ++i) {
+    Code* code = Code::cast(code_table->get(i));
+    if (code->kind() != Code::WASM_FUNCTION) continue;
+    RegisterProtectedInstructions(code);
+  }
+}
+
+void ReleaseProtectedInstructions(FixedArray* code_table) {
+  for (int i = 0; i < code_table->length(); ++i) {
+    Code* code = Code::cast(code_table->get(i));
+    int index = code->trap_handler_index();
+    if (index < 0) continue;
+    trap_handler::ReleaseHandlerData(index);
+    code->set_trap_handler_index(-1);
+  }
+}
+
 static void InstanceFinalizer(const v8::WeakCallbackInfo<void>& data) {
   JSObject** p = reinterpret_cast<JSObject**>(data.GetParameter());
   JSObject* owner = *p;
+  if (trap_handler::UseTrapHandler()) {
+    ReleaseProtectedInstructions(
+        FixedArray::cast(owner->GetInternalField(kWasmModuleCodeTable)));
+  }
   WasmCompiledModule* compiled_module = GetCompiledModule(owner);
   TRACE("Finalizing %d {\n", compiled_module->instance_id());
   Isolate* isolate = reinterpret_cast<Isolate*>(data.GetIsolate());
+
+  // All instances in the chain share the instance independent code.
+  WeakCell* neighbour = compiled_module->has_weak_next_instance()
+                            ? compiled_module->ptr_to_weak_next_instance()
+                            : compiled_module->ptr_to_weak_prev_instance();
+  if (neighbour != nullptr && !neighbour->cleared()) {
+    WeakCell* heir = WasmCompiledModule::cast(neighbour->value())
+                         ->ptr_to_weak_owning_instance();
+    if (heir != nullptr) {
+      HandOffSharedCode(
+          FixedArray::cast(owner->GetInternalField(kWasmModuleCodeTable)),
+          compiled_module->ptr_to_weak_owning_instance(), heir);
+    }
+  }
+
   DCHECK(compiled_module->has_weak_module_object());
   WeakCell* weak_module_obj = compiled_module->ptr_to_weak_module_object();
 
@@ -927,13 +1178,13 @@ void EncodeInit(const WasmModule* module, Factory* factory,
 
 }  // namespace
 
-MaybeHandle<WasmCompiledModule> WasmModule::CompileFunctions(
-    Isolate* isolate, ErrorThrower* thrower) const {
+void WasmModule::PrepareCompilation(
+    Isolate* isolate, WasmInstance* instance, Handle<FixedArray>* code_table_out,
+    MaybeHandle<FixedArray>* indirect_table_out) const {
   Factory* factory = isolate->factory();
+  WasmInstance& temp_instance = *instance;
+  DCHECK_EQ(this, temp_instance.module);
 
-  MaybeHandle<WasmCompiledModule> nothing;
-
-  WasmInstance temp_instance(this);
   temp_instance.context = isolate->native_context();
   temp_instance.mem_size = GetMinModuleMemSize(this);
   temp_instance.mem_start = nullptr;
@@ -955,14 +1206,6 @@ MaybeHandle<WasmCompiledModule> WasmModule::CompileFunctions(
     indirect_table.ToHandleChecked()->set(i, *metadata);
   }
 
-  HistogramTimerScope wasm_compile_module_time_scope(
-      isolate->counters()->wasm_compile_module_time());
-
-  ModuleEnv module_env;
-  module_env.module = this;
-  module_env.instance = &temp_instance;
-  module_env.origin = origin;
-
   // The {code_table} array contains import wrappers and functions (which
   // are both included in {functions.size()}, and export wrappers.
   int code_table_size =
@@ -979,9 +1222,34 @@ MaybeHandle<WasmCompiledModule> WasmModule::CompileFunctions(
     temp_instance.function_code[i] = placeholder;
   }
 
+  *code_table_out = code_table;
+  *indirect_table_out = indirect_table;
+}
+
+MaybeHandle<WasmCompiledModule> WasmModule::CompileFunctions(
+    Isolate* isolate, ErrorThrower* thrower) const {
+  MaybeHandle<WasmCompiledModule> nothing;
+
+  WasmInstance temp_instance(this);
+  Handle<FixedArray> code_table;
+  MaybeHandle<FixedArray> indirect_table;
+  PrepareCompilation(isolate, &temp_instance, &code_table, &indirect_table);
+
+  HistogramTimerScope wasm_compile_module_time_scope(
+      isolate->counters()->wasm_compile_module_time());
+
+  ModuleEnv module_env;
+  module_env.module = this;
+  module_env.instance = &temp_instance;
+  module_env.origin = origin;
+
   isolate->counters()->wasm_functions_per_module()->AddSample(
       static_cast<int>(functions.size()));
-  if (!FLAG_trace_wasm_decoder && FLAG_wasm_num_compilation_tasks != 0) {
+  if (FLAG_wasm_lazy_compilation && origin == kWasmOrigin) {
+    InstallLazyCompileStubs(isolate, this, temp_instance.function_code,
+                            thrower, &module_env);
+  } else if (!FLAG_trace_wasm_decoder &&
+             FLAG_wasm_num_compilation_tasks != 0) {
     // Avoid a race condition by collecting results into a second vector.
     std::vector<Handle<Code>> results;
     results.reserve(temp_instance.function_code.size());
@@ -999,6 +1267,24 @@ MaybeHandle<WasmCompiledModule> WasmModule::CompileFunctions(
   }
   if (thrower->error()) return nothing;
 
+  return FinishCompilation(isolate, thrower, &temp_instance, code_table,
+                           indirect_table);
+}
+
+MaybeHandle<WasmCompiledModule> WasmModule::FinishCompilation(
+    Isolate* isolate, ErrorThrower* thrower, WasmInstance* instance,
+    Handle<FixedArray> code_table,
+    MaybeHandle<FixedArray> indirect_table) const {
+  Factory* factory = isolate->factory();
+  MaybeHandle<WasmCompiledModule> nothing;
+  WasmInstance& temp_instance = *instance;
+  DCHECK_EQ(this, temp_instance.module);
+
+  ModuleEnv module_env;
+  module_env.module = this;
+  module_env.instance = &temp_instance;
+  module_env.origin = origin;
+
   // At this point, compilation has completed. Update the code table.
   for (size_t i = FLAG_skip_compiling_wasm_funcs;
        i < temp_instance.function_code.size(); ++i) {
@@ -1150,9 +1436,6 @@ MaybeHandle<WasmCompiledModule> WasmModule::CompileFunctions(
     ret->set_module_bytes(Handle<SeqOneByteString>::cast(module_bytes_string));
   }
 
-  Handle<ByteArray> function_name_table =
-      BuildFunctionNamesTable(isolate, module_env.module);
-  ret->set_function_names(function_name_table);
   if (data_segments.size() > 0) SaveDataSegmentInfo(factory, this, ret);
   DCHECK_EQ(ret->default_mem_size(), temp_instance.mem_size);
   return ret;
@@ -1219,7 +1502,10 @@ class WasmInstanceBuilder {
         TRACE("Cloning from %d\n", original->instance_id());
         compiled_module_ = WasmCompiledModule::Clone(isolate_, original);
 
-        // Clone the code for WASM functions and exports.
+        // Clone the code for WASM functions and exports. Functions which do
+        // not depend on the instance keep sharing the original code.
+        std::vector<bool> independent =
+            FindInstanceIndependentCode(isolate_, code_table);
         for (int i = 0; i < code_table->length(); ++i) {
           Handle<Code> orig_code =
               code_table->GetValueChecked<Code>(isolate_, i);
@@ -1227,8 +1513,10 @@ class WasmInstanceBuilder {
             case Code::WASM_TO_JS_FUNCTION:
               // Imports will be overwritten with newly compiled wrappers.
               break;
-            case Code::JS_TO_WASM_FUNCTION:
-            case Code::WASM_FUNCTION: {
+            case Code::WASM_FUNCTION:
+              if (independent[i]) break;
+            // Fall through.
+            case Code::JS_TO_WASM_FUNCTION: {
               Handle<Code> code = factory->CopyCode(orig_code);
               code_table->set(i, *code);
               break;
@@ -1265,7 +1553,7 @@ class WasmInstanceBuilder {
     uint32_t globals_size = compiled_module_->globals_size();
     if (globals_size > 0) {
       Handle<JSArrayBuffer> global_buffer =
-          NewArrayBuffer(isolate_, globals_size);
+          NewArrayBuffer(isolate_, globals_size, false);
       globals = global_buffer;
       if (globals.is_null()) {
         thrower_->RangeError("Out of memory: wasm globals");
@@ -1387,6 +1675,10 @@ class WasmInstanceBuilder {
 
     FlushICache(isolate_, code_table);
 
+    if (trap_handler::UseTrapHandler()) {
+      RegisterProtectedInstructions(code_table);
+    }
+
     //--------------------------------------------------------------------------
     // Set up and link the new instance.
     //--------------------------------------------------------------------------
@@ -1394,7 +1686,6 @@ class WasmInstanceBuilder {
       Handle<Object> global_handle =
           isolate_->global_handles()->Create(*instance);
       Handle<WeakCell> link_to_clone = factory->NewWeakCell(compiled_module_);
-      Handle<WeakCell> link_to_owning_instance = factory->NewWeakCell(instance);
       MaybeHandle<WeakCell> link_to_original;
       MaybeHandle<WasmCompiledModule> original;
       if (!owner.is_null()) {
@@ -1418,7 +1709,9 @@ class WasmInstanceBuilder {
         }
         module_object_->SetInternalField(0, *compiled_module_);
         instance->SetInternalField(kWasmCompiledModule, *compiled_module_);
-        compiled_module_->set_weak_owning_instance(link_to_owning_instance);
+        // The deoptimization data of the code refers to the same cell, see
+        // HandOffSharedCode.
+        compiled_module_->set_weak_owning_instance(weak_link);
         GlobalHandles::MakeWeak(global_handle.location(),
                                 global_handle.location(), &InstanceFinalizer,
                                 v8::WeakCallbackType::kFinalizer);
@@ -1718,6 +2011,7 @@ class WasmInstanceBuilder {
             return -1;
           }
           instance->SetInternalField(kWasmMemObject, *object);
+          WasmJs::AddWasmMemoryInstance(isolate_, object, instance);
           memory_ = WasmJs::GetWasmMemoryArrayBuffer(isolate_, object);
           break;
         }
@@ -1779,7 +2073,8 @@ class WasmInstanceBuilder {
       return Handle<JSArrayBuffer>::null();
     }
     Handle<JSArrayBuffer> mem_buffer =
-        NewArrayBuffer(isolate_, min_mem_pages * WasmModule::kPageSize);
+        NewArrayBuffer(isolate_, min_mem_pages * WasmModule::kPageSize,
+                       EnableGuardRegions());
 
     if (mem_buffer.is_null()) {
       thrower_->RangeError("Out of memory: wasm memory");
@@ -1849,6 +2144,7 @@ class WasmInstanceBuilder {
             memory_object =
                 WasmJs::CreateWasmMemoryObject(isolate_, buffer, false, 0);
             instance->SetInternalField(kWasmMemObject, *memory_object);
+            WasmJs::AddWasmMemoryInstance(isolate_, memory_object, instance);
           }
 
           desc.set_value(memory_object);
@@ -1968,18 +2264,40 @@ void WasmCompiledModule::PrintInstancesChain() {
 #endif
 }
 
+namespace {
+
+// The function name table is only needed for stack traces and debugging, so
+// it is built from the module bytes on first use instead of at compile time.
+MaybeHandle<ByteArray> GetFunctionNamesTable(Isolate* isolate,
+                                             Handle<JSObject> wasm) {
+  Handle<WasmCompiledModule> compiled_module(GetCompiledModule(*wasm),
+                                             isolate);
+  if (compiled_module->has_function_names()) {
+    return compiled_module->function_names();
+  }
+  if (!compiled_module->has_module_bytes()) return {};
+  Handle<ByteArray> func_names;
+  if (!BuildFunctionNamesTable(isolate, compiled_module->module_bytes(),
+                               GetNumImportedFunctions(wasm))
+           .ToHandle(&func_names)) {
+    return {};
+  }
+  compiled_module->set_function_names(func_names);
+  return func_names;
+}
+
+}  // namespace
+
 Handle<Object> wasm::GetWasmFunctionNameOrNull(Isolate* isolate,
                                                Handle<Object> wasm,
                                                uint32_t func_index) {
   if (!wasm->IsUndefined(isolate)) {
     DCHECK(IsWasmObject(*wasm));
-    WasmCompiledModule* compiled_module =
-        GetCompiledModule(JSObject::cast(*wasm));
-    Handle<ByteArray> func_names = compiled_module->function_names();
-    // TODO(clemens): Extract this from the module bytes; skip whole function
-    // name table.
+    Handle<ByteArray> func_names;
     Handle<Object> name;
-    if (GetWasmFunctionNameFromTable(func_names, func_index).ToHandle(&name)) {
+    if (GetFunctionNamesTable(isolate, Handle<JSObject>::cast(wasm))
+            .ToHandle(&func_names) &&
+        GetWasmFunctionNameFromTable(func_names, func_index).ToHandle(&name)) {
       return name;
     }
   }
@@ -2126,10 +2444,10 @@ void wasm::PopulateFunctionTable(Handle<FixedArray> table, uint32_t table_size,
 
 int wasm::GetNumberOfFunctions(Handle<JSObject> wasm) {
   DCHECK(IsWasmObject(*wasm));
-  WasmCompiledModule* compiled_module = GetCompiledModule(*wasm);
-  ByteArray* func_names_arr = compiled_module->ptr_to_function_names();
+  Handle<ByteArray> func_names =
+      GetFunctionNamesTable(wasm->GetIsolate(), wasm).ToHandleChecked();
   // TODO(clemensh): this looks inside an array constructed elsewhere. Refactor.
-  return func_names_arr->get_int(0);
+  return func_names->get_int(0);
 }
 
 Handle<JSObject> wasm::CreateCompiledModuleObject(
@@ -2271,21 +2589,194 @@ int32_t wasm::GrowInstanceMemory(Isolate* isolate, Handle<JSObject> instance,
       WasmModule::kMaxMemPages * WasmModule::kPageSize <= new_size) {
     return -1;
   }
-  Handle<JSArrayBuffer> buffer = NewArrayBuffer(isolate, new_size);
+  // Other threads may access a shared memory, so its buffer cannot be
+  // replaced.
+  if (old_size != 0 && old_buffer->is_shared()) return -1;
+  Handle<JSArrayBuffer> buffer;
+  if (old_size != 0 && old_buffer->has_guard_region()) {
+    buffer = GrowGuardedArrayBuffer(isolate, old_buffer, new_size);
+  } else {
+    buffer = NewArrayBuffer(isolate, new_size, EnableGuardRegions());
+    if (!buffer.is_null() && old_size != 0) {
+      memcpy(buffer->backing_store(), old_mem_start, old_size);
+    }
+  }
   if (buffer.is_null()) return -1;
   Address new_mem_start = static_cast<Address>(buffer->backing_store());
-  if (old_size != 0) {
-    memcpy(new_mem_start, old_mem_start, old_size);
-  }
-  SetInstanceMemory(instance, *buffer);
-  if (!UpdateWasmModuleMemory(instance, old_mem_start, new_mem_start, old_size,
-                              new_size)) {
-    return -1;
+  Handle<Object> memory_object(instance->GetInternalField(kWasmMemObject),
+                               isolate);
+  if (memory_object->IsUndefined(isolate)) {
+    SetInstanceMemory(instance, *buffer);
+    if (!UpdateWasmModuleMemory(instance, old_mem_start, new_mem_start,
+                                old_size, new_size)) {
+      return -1;
+    }
+  } else {
+    // The memory might be shared with other instances through the
+    // WebAssembly.Memory object. The old buffer is neutered or stale, so all
+    // of them have to switch to the grown buffer.
+    WasmJs::SetWasmMemoryArrayBuffer(isolate, memory_object, buffer);
+    WeakFixedArray::Iterator iterator(
+        WasmJs::GetWasmMemoryInstances(isolate, memory_object));
+    while (JSObject* raw_instance = iterator.Next<JSObject>()) {
+      Handle<JSObject> shared_instance(raw_instance, isolate);
+      SetInstanceMemory(shared_instance, *buffer);
+      if (!UpdateWasmModuleMemory(shared_instance, old_mem_start,
+                                  new_mem_start, old_size, new_size)) {
+        return -1;
+      }
+    }
   }
   DCHECK(old_size % WasmModule::kPageSize == 0);
   return (old_size / WasmModule::kPageSize);
 }
 
+MaybeHandle<Code> wasm::CompileLazy(Isolate* isolate,
+                                    Handle<JSObject> instance,
+                                    Handle<Code> stub, uint32_t func_index) {
+  Handle<WasmCompiledModule> compiled_module(GetCompiledModule(*instance),
+                                             isolate);
+  Handle<FixedArray> code_table(
+      FixedArray::cast(instance->GetInternalField(kWasmModuleCodeTable)),
+      isolate);
+  // Callers which still hold on to {stub} end up here again after the
+  // function was compiled.
+  Code* current = Code::cast(code_table->get(static_cast<int>(func_index)));
+  if (current != *stub) return handle(current, isolate);
+
+  // Decode a copy of the module bytes, which the GC may move during
+  // compilation. The function bodies were validated when the module was
+  // compiled.
+  Handle<SeqOneByteString> module_bytes = compiled_module->module_bytes();
+  int length = module_bytes->length();
+  std::unique_ptr<byte[]> bytes(new byte[length]);
+  memcpy(bytes.get(), module_bytes->GetChars(), length);
+  ErrorThrower thrower(isolate, "WebAssembly lazy compilation");
+  Zone zone(isolate->allocator());
+  ModuleResult result =
+      DecodeWasmModule(isolate, &zone, bytes.get(), bytes.get() + length, false,
+                       compiled_module->origin());
+  std::unique_ptr<const WasmModule> module(result.val);
+  if (result.failed()) {
+    thrower.CompileFailed("Wasm decoding failed", result);
+    return {};
+  }
+
+  // Compile against the current memory, globals, function tables and code of
+  // the instance, so that the code needs no patching.
+  WasmInstance temp_instance(module.get());
+  temp_instance.context = isolate->native_context();
+  Handle<JSArrayBuffer> memory;
+  if (GetInstanceMemory(isolate, instance).ToHandle(&memory)) {
+    temp_instance.mem_start = static_cast<byte*>(memory->backing_store());
+    temp_instance.mem_size =
+        static_cast<uint32_t>(memory->byte_length()->Number());
+  } else {
+    temp_instance.mem_size = compiled_module->default_mem_size();
+  }
+  Object* globals = instance->GetInternalField(kWasmGlobalsArrayBuffer);
+  if (globals->IsJSArrayBuffer()) {
+    temp_instance.globals_start =
+        static_cast<byte*>(JSArrayBuffer::cast(globals)->backing_store());
+  }
+  Object* tables = instance->GetInternalField(kWasmModuleFunctionTable);
+  if (tables->IsFixedArray()) {
+    for (size_t i = 0; i < temp_instance.function_tables.size(); ++i) {
+      FixedArray* metadata =
+          FixedArray::cast(FixedArray::cast(tables)->get(static_cast<int>(i)));
+      temp_instance.function_tables[i] =
+          handle(FixedArray::cast(metadata->get(kTable)), isolate);
+    }
+  }
+  for (size_t i = 0; i < temp_instance.function_code.size(); ++i) {
+    temp_instance.function_code[i] =
+        handle(Code::cast(code_table->get(static_cast<int>(i))), isolate);
+  }
+  ModuleEnv module_env;
+  module_env.module = module.get();
+  module_env.instance = &temp_instance;
+  module_env.origin = module->origin;
+
+  Handle<Code> code = compiler::WasmCompilationUnit::CompileWasmFunction(
+      &thrower, isolate, &module_env, &module->functions[func_index]);
+  if (code.is_null()) {
+    if (!thrower.error()) {
+      thrower.RangeError("Lazy compilation of #%u failed.", func_index);
+    }
+    return {};
+  }
+  code->set_deoptimization_data(stub->deoptimization_data());
+  if (trap_handler::UseTrapHandler()) RegisterProtectedInstructions(*code);
+
+  // Install the code, and redirect the calls and function table entries to
+  // the stub, so that later calls reach the code directly.
+  code_table->set(static_cast<int>(func_index), *code);
+  DisallowHeapAllocation no_gc;
+  int mode_mask = RelocInfo::ModeMask(RelocInfo::CODE_TARGET);
+  for (int i = 0; i < code_table->length(); ++i) {
+    Code* caller = Code::cast(code_table->get(i));
+    bool changed = false;
+    for (RelocIterator it(caller, mode_mask); !it.done(); it.next()) {
+      Code* target =
+          Code::GetCodeFromTargetAddress(it.rinfo()->target_address());
+      if (target != *stub) continue;
+      it.rinfo()->set_target_address(code->instruction_start(),
+                                     UPDATE_WRITE_BARRIER, SKIP_ICACHE_FLUSH);
+      changed = true;
+    }
+    if (changed) {
+      Assembler::FlushICache(isolate, caller->instruction_start(),
+                             caller->instruction_size());
+    }
+  }
+  if (tables->IsFixedArray()) {
+    for (int i = 0; i < FixedArray::cast(tables)->length(); ++i) {
+      FixedArray* metadata = FixedArray::cast(FixedArray::cast(tables)->get(i));
+      FixedArray* table = FixedArray::cast(metadata->get(kTable));
+      for (int j = 0; j < table->length(); ++j) {
+        if (table->get(j) == *stub) table->set(j, *code);
+      }
+    }
+  }
+  return code;
+}
+
+bool wasm::EnableGuardRegions() {
+  return (kPointerSize == 8 && FLAG_wasm_guard_regions) ||
+         trap_handler::UseTrapHandler();
+}
+
+Handle<JSArrayBuffer> wasm::NewArrayBuffer(Isolate* isolate, size_t size,
+                                           bool enable_guard_regions) {
+  if (size > (WasmModule::kMaxMemPages * WasmModule::kPageSize)) {
+    // TODO(titzer): lift restriction on maximum memory allocated here.
+    return Handle<JSArrayBuffer>::null();
+  }
+  if (enable_guard_regions) {
+    Handle<JSArrayBuffer> buffer = NewGuardedArrayBuffer(isolate, size);
+    // Without the trap handler, the guard regions only serve to grow in
+    // place; fall back to a plain buffer if no region could be reserved.
+    if (!buffer.is_null() || trap_handler::UseTrapHandler()) return buffer;
+  }
+  void* memory = isolate->array_buffer_allocator()->Allocate(size);
+  if (memory == nullptr) {
+    return Handle<JSArrayBuffer>::null();
+  }
+
+#if DEBUG
+  // Double check the API allocator actually zero-initialized the memory.
+  const byte* bytes = reinterpret_cast<const byte*>(memory);
+  for (size_t i = 0; i < size; ++i) {
+    DCHECK_EQ(0, bytes[i]);
+  }
+#endif
+
+  Handle<JSArrayBuffer> buffer = isolate->factory()->NewJSArrayBuffer();
+  JSArrayBuffer::Setup(buffer, isolate, false, memory, static_cast<int>(size));
+  buffer->set_is_neuterable(false);
+  return buffer;
+}
+
 void testing::ValidateInstancesChain(Isolate* isolate,
                                      Handle<JSObject> module_obj,
                                      int instance_count) {
@@ -30,6 +30,8 @@ const size_t kMaxFunctionSize = 128 * 1024;
 const size_t kMaxStringSize = 256;
 const uint32_t kWasmMagic = 0x6d736100;
 const uint32_t kWasmVersion = 0x0c;
+// The magic word followed by the version.
+const size_t kWasmModuleHeaderSize = 2 * sizeof(uint32_t);
 
 const uint8_t kWasmFunctionTypeForm = 0x40;
 const uint8_t kWasmAnyFunctionTypeForm = 0x20;
@@ -167,6 +169,7 @@ struct WasmExport {
 enum ModuleOrigin { kWasmOrigin, kAsmJsOrigin };
 
 class WasmCompiledModule;
+struct WasmInstance;
 
 // Static representation of a module.
 struct WasmModule {
@@ -252,6 +255,18 @@ struct WasmModule {
   MaybeHandle<WasmCompiledModule> CompileFunctions(Isolate* isolate,
                                                    ErrorThrower* thrower) const;
 
+  // The phases of CompileFunctions() before and after the functions are
+  // compiled. {instance} has to be created for this module. Used directly by
+  // streaming compilation, which compiles the functions while the module
+  // bytes arrive.
+  void PrepareCompilation(Isolate* isolate, WasmInstance* instance,
+                          Handle<FixedArray>* code_table,
+                          MaybeHandle<FixedArray>* indirect_table) const;
+  MaybeHandle<WasmCompiledModule> FinishCompilation(
+      Isolate* isolate, ErrorThrower* thrower, WasmInstance* instance,
+      Handle<FixedArray> code_table,
+      MaybeHandle<FixedArray> indirect_table) const;
+
  private:
   DISALLOW_COPY_AND_ASSIGN(WasmModule);
 };
@@ -560,6 +575,26 @@ int32_t GetInstanceMemorySize(Isolate* isolate, Handle<JSObject> instance);
 int32_t GrowInstanceMemory(Isolate* isolate, Handle<JSObject> instance,
                            uint32_t pages);
 
+// Compiles function {func_index} of {instance}, which was called through its
+// lazy compile {stub}, against the current state of the instance, and
+// redirects all calls to the stub to the new code. Returns the code to call,
+// or an empty handle with a scheduled exception if compilation failed.
+MaybeHandle<Code> CompileLazy(Isolate* isolate, Handle<JSObject> instance,
+                              Handle<Code> stub, uint32_t func_index);
+
+// Allocates a zero-initialized array buffer of {size} bytes for a wasm memory
+// or globals. With {enable_guard_regions}, the buffer is placed at the start
+// of a reserved region which no 32-bit index and offset can reach beyond, so
+// that out of bounds accesses fault and are caught by the trap handler, and
+// GrowInstanceMemory commits more of the region instead of copying.
+Handle<JSArrayBuffer> NewArrayBuffer(Isolate* isolate, size_t size,
+                                     bool enable_guard_regions);
+
+// Whether wasm memories should be allocated with guard regions. This is the
+// case with the trap handler, and on 64-bit hosts with --wasm-guard-regions,
+// where there is enough address space to reserve the largest memory up front.
+bool EnableGuardRegions();
+
 namespace testing {
 
 void ValidateInstancesChain(Isolate* isolate, Handle<JSObject> module_obj,
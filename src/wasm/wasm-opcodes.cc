@@ -88,6 +88,7 @@ static const FunctionSig* kSimdExprSigs[] = {
 static byte kSimpleExprSigTable[256];
 static byte kSimpleAsmjsExprSigTable[256];
 static byte kSimdExprSigTable[256];
+static byte kAtomicExprSigTable[256];
 
 // Initialize the signature table.
 static void InitSigTables() {
@@ -105,6 +106,10 @@ static void InitSigTables() {
   kSimdExprSigTable[simd_index] = static_cast<int>(kSigEnum_##sig) + 1;
   FOREACH_SIMD_0_OPERAND_OPCODE(SET_SIG_TABLE)
 #undef SET_SIG_TABLE
+#define SET_SIG_TABLE(name, opcode, sig) \
+  kAtomicExprSigTable[opcode & 0xff] = static_cast<int>(kSigEnum_##sig) + 1;
+  FOREACH_ATOMIC_OPCODE(SET_SIG_TABLE)
+#undef SET_SIG_TABLE
 }
 
 class SigTable {
@@ -125,6 +130,10 @@ class SigTable {
     return const_cast<FunctionSig*>(
         kSimdExprSigs[kSimdExprSigTable[static_cast<byte>(opcode & 0xff)]]);
   }
+  FunctionSig* AtomicSignature(WasmOpcode opcode) const {
+    return const_cast<FunctionSig*>(
+        kSimpleExprSigs[kAtomicExprSigTable[static_cast<byte>(opcode & 0xff)]]);
+  }
 };
 
 static base::LazyInstance<SigTable>::type sig_table = LAZY_INSTANCE_INITIALIZER;
@@ -132,6 +141,8 @@ static base::LazyInstance<SigTable>::type sig_table = LAZY_INSTANCE_INITIALIZER;
 FunctionSig* WasmOpcodes::Signature(WasmOpcode opcode) {
   if (opcode >> 8 == kSimdPrefix) {
     return sig_table.Get().SimdSignature(opcode);
+  } else if (opcode >> 8 == kAtomicPrefix) {
+    return sig_table.Get().AtomicSignature(opcode);
   } else {
     return sig_table.Get().Signature(opcode);
   }
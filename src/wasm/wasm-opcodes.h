@@ -400,6 +400,16 @@ const WasmCodePosition kNoCodePosition = -1;
   V(I16x8ExtractLane, 0xe539, _)         \
   V(I8x16ExtractLane, 0xe558, _)
 
+// Atomic memory accesses, followed by a memory access immediate. The
+// alignment has to be the natural alignment of the access.
+#define FOREACH_ATOMIC_OPCODE(V)    \
+  V(I32AtomicLoad, 0xe601, i_i)     \
+  V(I32AtomicLoad8U, 0xe602, i_i)   \
+  V(I32AtomicLoad16U, 0xe603, i_i)  \
+  V(I32AtomicStore, 0xe604, i_ii)   \
+  V(I32AtomicStore8U, 0xe605, i_ii) \
+  V(I32AtomicStore16U, 0xe606, i_ii)
+
 // All opcodes.
 #define FOREACH_OPCODE(V)          \
   FOREACH_CONTROL_OPCODE(V)        \
@@ -411,7 +421,8 @@ const WasmCodePosition kNoCodePosition = -1;
   FOREACH_MISC_MEM_OPCODE(V)       \
   FOREACH_ASMJS_COMPAT_OPCODE(V)   \
   FOREACH_SIMD_0_OPERAND_OPCODE(V) \
-  FOREACH_SIMD_1_OPERAND_OPCODE(V)
+  FOREACH_SIMD_1_OPERAND_OPCODE(V) \
+  FOREACH_ATOMIC_OPCODE(V)
 
 // All signatures.
 #define FOREACH_SIGNATURE(V)         \
@@ -454,7 +465,9 @@ const WasmCodePosition kNoCodePosition = -1;
   V(s_sii, kAstS128, kAstS128, kAstI32, kAstI32)   \
   V(s_si, kAstS128, kAstS128, kAstI32)
 
-#define FOREACH_PREFIX(V) V(Simd, 0xe5)
+#define FOREACH_PREFIX(V) \
+  V(Simd, 0xe5)           \
+  V(Atomic, 0xe6)
 
 enum WasmOpcode {
 // Declare expression opcodes.
@@ -874,6 +874,8 @@ class Assembler : public AssemblerBase {
   // Bit operations.
   void bt(const Operand& dst, Register src);
   void bts(const Operand& dst, Register src);
+  void bswapl(Register dst);
+  void bswapq(Register dst);
   void bsrq(Register dst, Register src);
   void bsrq(Register dst, const Operand& src);
   void bsrl(Register dst, Register src);
@@ -2165,6 +2165,10 @@ int DisassemblerX64::TwoByteOpcodeInstruction(byte* data) {
     get_modrm(*current, &mod, &regop, &rm);
     AppendToBuffer("%s,", NameOfCPURegister(regop));
     current += PrintRightOperand(current);
+  } else if ((opcode & 0xF8) == 0xC8) {
+    // BSWAP.
+    int reg = (opcode & 0x7) | (rex_b() ? 8 : 0);
+    AppendToBuffer("bswap%c %s", operand_size_code(), NameOfCPURegister(reg));
   } else if (opcode == 0x0B) {
     AppendToBuffer("ud2");
   } else if (opcode == 0xB0 || opcode == 0xB1) {
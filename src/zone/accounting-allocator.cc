@@ -39,8 +39,11 @@ void AccountingAllocator::MemoryPressureNotification(
 Segment* AccountingAllocator::GetSegment(size_t bytes) {
   Segment* result = GetSegmentFromPool(bytes);
   if (result == nullptr) {
+    base::NoBarrier_AtomicIncrement(&pool_miss_count_, 1);
     result = AllocateSegment(bytes);
     result->Initialize(bytes);
+  } else {
+    base::NoBarrier_AtomicIncrement(&pool_hit_count_, 1);
   }
 
   return result;
@@ -88,6 +91,14 @@ size_t AccountingAllocator::GetCurrentPoolSize() const {
   return base::NoBarrier_Load(&current_pool_size_);
 }
 
+size_t AccountingAllocator::GetPoolHitCount() const {
+  return base::NoBarrier_Load(&pool_hit_count_);
+}
+
+size_t AccountingAllocator::GetPoolMissCount() const {
+  return base::NoBarrier_Load(&pool_miss_count_);
+}
+
 Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
   if (requested_size > (1 << kMaxSegmentSizePower)) {
     return nullptr;
@@ -159,10 +170,13 @@ void AccountingAllocator::ClearPool() {
     Segment* current = unused_segments_heads_[power];
     while (current) {
       Segment* next = current->next();
+      base::NoBarrier_AtomicIncrement(
+          &current_pool_size_, -static_cast<base::AtomicWord>(current->size()));
       FreeSegment(current);
       current = next;
     }
     unused_segments_heads_[power] = nullptr;
+    unused_segments_sizes[power] = 0;
   }
 }
 
@@ -33,6 +33,11 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
 
   size_t GetCurrentPoolSize() const;
 
+  // Number of segment requests that were served from the pool, and that
+  // needed a fresh allocation, respectively.
+  size_t GetPoolHitCount() const;
+  size_t GetPoolMissCount() const;
+
   void MemoryPressureNotification(MemoryPressureLevel level);
 
   virtual void ZoneCreation(const Zone* zone) {}
@@ -67,6 +72,8 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   base::AtomicWord current_memory_usage_ = 0;
   base::AtomicWord max_memory_usage_ = 0;
   base::AtomicWord current_pool_size_ = 0;
+  base::AtomicWord pool_hit_count_ = 0;
+  base::AtomicWord pool_miss_count_ = 0;
 
   base::AtomicValue<MemoryPressureLevel> memory_pressure_level_;
 
@@ -125,6 +125,7 @@
       'test-api-accessors.cc',
       'test-api-interceptors.cc',
       'test-api-fast-accessor-builder.cc',
+      'test-api-fast-api-call.cc',
       'test-array-list.cc',
       'test-ast.cc',
       'test-atomicops.cc',
@@ -1607,6 +1607,42 @@ TEST(BytecodeGraphBuilderTryFinally2) {
   }
 }
 
+TEST(BytecodeGraphBuilderGenerators) {
+  HandleAndZoneScope scope;
+  Isolate* isolate = scope.main_isolate();
+  Zone* zone = scope.main_zone();
+
+  // The snippets are run after the generator {f} has been optimized.
+  ExpectedSnippet<0> snippets[] = {
+      {"var g = f(); g.next(); g.next(2).value",
+       {handle(Smi::FromInt(3), isolate)}},
+      {"var g = f(); g.next(); g.next(2); g.next().value",
+       {handle(Smi::FromInt(10), isolate)}},
+      {"var g = f(); g.next(); g.next(2); g.return(5).value",
+       {handle(Smi::FromInt(5), isolate)}},
+      {"var g = f(); g.next(); g.next(2);"
+       "var r; try { g.throw(7) } catch(e) { r = e }; r",
+       {handle(Smi::FromInt(7), isolate)}},
+  };
+
+  for (size_t i = 0; i < arraysize(snippets); i++) {
+    ScopedVector<char> script(1024);
+    SNPrintF(script,
+             "function* %s() {"
+             "  var a = yield 1;"
+             "  try { yield a + 1; } finally { a = 10; }"
+             "  return a;"
+             "}\n%s();",
+             kFunctionName, kFunctionName);
+
+    BytecodeGraphTester tester(isolate, zone, script.start());
+    tester.GetCallable<>();
+    Handle<Object> return_value =
+        BytecodeGraphTester::NewObject(snippets[i].code_snippet);
+    CHECK(return_value->SameValue(*snippets[i].return_value()));
+  }
+}
+
 TEST(BytecodeGraphBuilderThrow) {
   HandleAndZoneScope scope;
   Isolate* isolate = scope.main_isolate();
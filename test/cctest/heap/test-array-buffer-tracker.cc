@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "src/api.h"
 #include "src/heap/array-buffer-tracker.h"
 #include "src/isolate.h"
@@ -16,6 +19,37 @@ bool IsTracked(i::JSArrayBuffer* buf) {
   return i::ArrayBufferTracker::IsTracked(buf);
 }
 
+class RecordingAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  explicit RecordingAllocator(v8::ArrayBuffer::Allocator* allocator)
+      : allocator_(allocator) {}
+
+  void* Allocate(size_t length) override {
+    return allocator_->Allocate(length);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return allocator_->AllocateUninitialized(length);
+  }
+  void Free(void* data, size_t length) override {
+    {
+      v8::base::LockGuard<v8::base::Mutex> guard(&mutex_);
+      freed_lengths_.push_back(length);
+    }
+    allocator_->Free(data, length);
+  }
+
+  bool WasFreed(size_t length) {
+    v8::base::LockGuard<v8::base::Mutex> guard(&mutex_);
+    return std::find(freed_lengths_.begin(), freed_lengths_.end(), length) !=
+           freed_lengths_.end();
+  }
+
+ private:
+  v8::ArrayBuffer::Allocator* allocator_;
+  v8::base::Mutex mutex_;
+  std::vector<size_t> freed_lengths_;
+};
+
 }  // namespace
 
 namespace v8 {
@@ -316,5 +350,34 @@ UNINITIALIZED_TEST(ArrayBuffer_SemiSpaceCopyMultipleTasks) {
   }
 }
 
+UNINITIALIZED_TEST(ArrayBuffer_FreedAfterScavenge) {
+  const size_t kLength = 1234;
+  RecordingAllocator allocator(CcTest::array_buffer_allocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context->Enter();
+    Heap* heap = i_isolate->heap();
+
+    {
+      v8::HandleScope inner_scope(isolate);
+      Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kLength);
+      Handle<JSArrayBuffer> buf = v8::Utils::OpenHandle(*ab);
+      CHECK(IsTracked(*buf));
+    }
+    heap::GcAndSweep(heap, NEW_SPACE);
+    // The backing store is released by a background task, if any.
+    heap->array_buffer_freer()->WaitUntilCompleted();
+    CHECK(allocator.WasFreed(kLength));
+    context->Exit();
+  }
+  isolate->Dispose();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -1291,6 +1291,77 @@ UNINITIALIZED_TEST(TestCodeFlushing) {
 }
 
 
+UNINITIALIZED_TEST(TestBytecodeFlushing) {
+  // If we do not flush code this test is invalid.
+  if (!FLAG_flush_code) return;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_ignition = true;
+  i::FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  isolate->Enter();
+  Factory* factory = i_isolate->factory();
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "  return z;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    // This compile will add the code to the compilation cache.
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    // Check function is interpreted.
+    Handle<Object> func_value = Object::GetProperty(i_isolate->global_object(),
+                                                    foo_name).ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared()->HasBytecodeArray());
+
+    // The bytecode will survive at least two GCs.
+    i_isolate->heap()->CollectAllGarbage(
+        i::Heap::kFinalizeIncrementalMarkingMask,
+        i::GarbageCollectionReason::kTesting);
+    i_isolate->heap()->CollectAllGarbage(
+        i::Heap::kFinalizeIncrementalMarkingMask,
+        i::GarbageCollectionReason::kTesting);
+    CHECK(function->shared()->HasBytecodeArray());
+
+    // Simulate several GCs that use full marking.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      i_isolate->heap()->CollectAllGarbage(
+          i::Heap::kFinalizeIncrementalMarkingMask,
+          i::GarbageCollectionReason::kTesting);
+    }
+
+    // foo should no longer have bytecode.
+    CHECK(!function->shared()->HasBytecodeArray());
+    CHECK(!function->shared()->is_compiled());
+
+    // Call foo to get it recompiled.
+    CHECK_EQ(84, CompileRun("foo()")->Int32Value(
+                     isolate->GetCurrentContext()).FromJust());
+    CHECK(function->shared()->HasBytecodeArray());
+    CHECK(function->is_compiled());
+  }
+  isolate->Exit();
+  isolate->Dispose();
+}
+
+
 TEST(TestCodeFlushingPreAged) {
   // If we do not flush code this test is invalid.
   if (!FLAG_flush_code) return;
@@ -7074,5 +7145,166 @@ TEST(RememberedSetRemoveRange) {
   });
 }
 
+TEST(ParallelScavenge) {
+  bool old_flag = FLAG_parallel_scavenge;
+  FLAG_parallel_scavenge = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Factory* factory = heap->isolate()->factory();
+
+  // Old arrays referencing young objects, both exclusively and shared, are
+  // only reachable from the young generation through the remembered set.
+  const int kNumHolders = 32;
+  const int kLength = 64;
+  Handle<FixedArray> shared = factory->NewFixedArray(kLength);
+  Handle<FixedArray> holders = factory->NewFixedArray(kNumHolders, TENURED);
+  for (int i = 0; i < kNumHolders; i++) {
+    Handle<FixedArray> holder = factory->NewFixedArray(kLength, TENURED);
+    holder->set(0, *shared);
+    for (int j = 1; j < kLength; j++) {
+      holder->set(j, *factory->NewHeapNumber(i * kLength + j));
+    }
+    holders->set(i, *holder);
+  }
+  CHECK(heap->InNewSpace(*shared));
+
+  for (int gc = 0; gc < 2; gc++) {
+    if (heap->mark_compact_collector()->sweeping_in_progress()) {
+      heap->mark_compact_collector()->EnsureSweepingCompleted();
+    }
+    CcTest::CollectGarbage(NEW_SPACE);
+    for (int i = 0; i < kNumHolders; i++) {
+      FixedArray* holder = FixedArray::cast(holders->get(i));
+      CHECK_EQ(*shared, holder->get(0));
+      for (int j = 1; j < kLength; j++) {
+        CHECK_EQ(static_cast<double>(i * kLength + j),
+                 HeapNumber::cast(holder->get(j))->value());
+      }
+    }
+  }
+  FLAG_parallel_scavenge = old_flag;
+}
+
+TEST(ConcurrentMarking) {
+  if (!FLAG_incremental_marking) return;
+  bool old_flag = FLAG_concurrent_marking;
+  FLAG_concurrent_marking = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Factory* factory = heap->isolate()->factory();
+
+  // A tree of old arrays is marked by the background task while its young
+  // leaves are handed back to the main thread.
+  const int kNumChildren = 64;
+  const int kLength = 32;
+  Handle<FixedArray> root = factory->NewFixedArray(kNumChildren, TENURED);
+  for (int i = 0; i < kNumChildren; i++) {
+    Handle<FixedArray> child = factory->NewFixedArray(kLength, TENURED);
+    for (int j = 0; j < kLength; j++) {
+      child->set(j, *factory->NewHeapNumber(i * kLength + j));
+    }
+    root->set(i, *child);
+  }
+
+  heap::SimulateIncrementalMarking(heap);
+  CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
+  for (int i = 0; i < kNumChildren; i++) {
+    FixedArray* child = FixedArray::cast(root->get(i));
+    for (int j = 0; j < kLength; j++) {
+      CHECK_EQ(static_cast<double>(i * kLength + j),
+               HeapNumber::cast(child->get(j))->value());
+    }
+  }
+  FLAG_concurrent_marking = old_flag;
+}
+
+TEST(MapSubTypeObjectStats) {
+  bool old_flag = FLAG_track_gc_object_stats;
+  FLAG_track_gc_object_stats = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CompileRun(
+        "var dictionary = {a: 1};"
+        "for (var i = 0; i < 100; i++) dictionary['p' + i] = i;"
+        "delete dictionary.a;"
+        "function C() {}"
+        "C.prototype.m = function() {};"
+        "var instance = new C();");
+    reinterpret_cast<Isolate*>(isolate)->heap()->CollectAllGarbage(
+        Heap::kNoGCFlags, GarbageCollectionReason::kTesting);
+
+    size_t prototype_maps = 0;
+    size_t dictionary_maps = 0;
+    size_t stable_maps = 0;
+    v8::HeapObjectStatistics stats;
+    for (size_t i = 0; i < isolate->NumberOfTrackedHeapObjectTypes(); i++) {
+      if (!isolate->GetHeapObjectStatisticsAtLastGC(&stats, i)) continue;
+      if (strcmp(stats.object_type(), "MAP_TYPE") != 0) continue;
+      if (strcmp(stats.object_sub_type(), "PROTOTYPE_MAP_SUB_TYPE") == 0) {
+        prototype_maps = stats.object_count();
+      } else if (strcmp(stats.object_sub_type(), "DICTIONARY_MAP_SUB_TYPE") ==
+                 0) {
+        dictionary_maps = stats.object_count();
+      } else if (strcmp(stats.object_sub_type(), "STABLE_MAP_SUB_TYPE") == 0) {
+        stable_maps = stats.object_count();
+      }
+    }
+    CHECK_LT(0u, prototype_maps);
+    CHECK_LT(0u, dictionary_maps);
+    CHECK_LT(0u, stable_maps);
+  }
+  isolate->Dispose();
+  FLAG_track_gc_object_stats = old_flag;
+}
+
+TEST(ConcurrentStoreBuffer) {
+  bool old_flag = FLAG_concurrent_store_buffer;
+  FLAG_concurrent_store_buffer = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+
+    // The elements of the array are a large object in old space. Filling it
+    // with young objects from generated code overflows the store buffer many
+    // times, so the task processes halves while the main thread refills the
+    // other one.
+    CompileRun(
+        "var a = [];"
+        "for (var i = 0; i < 100000; i++) a.push(null);"
+        "function fill() {"
+        "  for (var i = 0; i < a.length; i++) a[i] = {x: i};"
+        "}");
+    heap->CollectAllGarbage(Heap::kNoGCFlags,
+                            GarbageCollectionReason::kTesting);
+    heap->CollectAllGarbage(Heap::kNoGCFlags,
+                            GarbageCollectionReason::kTesting);
+    for (int gc = 0; gc < 2; gc++) {
+      CompileRun("fill();");
+      heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+      CHECK(CompileRun("a.every(function(o, i) { return o.x === i; })")
+                ->IsTrue());
+    }
+    // Leave entries behind for a task that may still be pending when the
+    // isolate is torn down.
+    CompileRun("fill();");
+  }
+  isolate->Dispose();
+  FLAG_concurrent_store_buffer = old_flag;
+}
+
 }  // namespace internal
 }  // namespace v8
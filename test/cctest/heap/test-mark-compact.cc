@@ -382,6 +382,48 @@ TEST(EmptyObjectGroups) {
 }
 
 
+TEST(ParallelMarking) {
+  bool old_flag = FLAG_parallel_marking;
+  FLAG_parallel_marking = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope sc(CcTest::isolate());
+
+  // A wide tree of arrays, objects and strings provides enough work for
+  // several marking tasks. Functions reachable from it are bailouts that are
+  // visited on the main thread.
+  const int kNumChildren = 512;
+  const int kLength = 16;
+  Handle<FixedArray> root = factory->NewFixedArray(kNumChildren, TENURED);
+  Handle<JSFunction> function =
+      factory->NewFunction(factory->InternalizeUtf8String("f"));
+  for (int i = 0; i < kNumChildren; i++) {
+    Handle<FixedArray> child = factory->NewFixedArray(kLength, TENURED);
+    child->set(0, *function);
+    child->set(1, *factory->NewJSObject(function));
+    for (int j = 2; j < kLength; j++) {
+      child->set(j, *factory->NewHeapNumber(i * kLength + j));
+    }
+    root->set(i, *child);
+  }
+
+  CcTest::CollectGarbage(OLD_SPACE);
+  CcTest::CollectGarbage(OLD_SPACE);
+
+  for (int i = 0; i < kNumChildren; i++) {
+    FixedArray* child = FixedArray::cast(root->get(i));
+    CHECK_EQ(*function, child->get(0));
+    CHECK(child->get(1)->IsJSObject());
+    for (int j = 2; j < kLength; j++) {
+      CHECK_EQ(static_cast<double>(i * kLength + j),
+               HeapNumber::cast(child->get(j))->value());
+    }
+  }
+  FLAG_parallel_marking = old_flag;
+}
+
+
 #if defined(__has_feature)
 #if __has_feature(address_sanitizer)
 #define V8_WITH_ASAN 1
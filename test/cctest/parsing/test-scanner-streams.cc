@@ -424,6 +424,69 @@ TEST(CharacterStreams) {
   TestCharacterStreams(buffer, arraysize(buffer) - 1, 576, 3298);
 }
 
+void TestAdvanceUntil(i::Utf16CharacterStream* stream) {
+  auto is_newline = [](i::uc32 c) { return c == '\n'; };
+  CHECK_EQ('\n', stream->AdvanceUntil(is_newline));
+  CHECK_EQ(1501u, stream->pos());
+  CHECK_EQ('\n', stream->AdvanceUntil(is_newline));
+  CHECK_EQ(3001u, stream->pos());
+  CHECK_EQ('a', stream->Advance());
+  CHECK_LT(stream->AdvanceUntil(is_newline), 0);
+
+  // Back() and Seek() keep working after reaching the end.
+  stream->Seek(1500);
+  CHECK_EQ('\n', stream->Advance());
+  stream->Back();
+  CHECK_EQ('\n', stream->AdvanceUntil(is_newline));
+  CHECK_EQ(1501u, stream->pos());
+}
+
+TEST(AdvanceUntil) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handles(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  i::Factory* factory = CcTest::i_isolate()->factory();
+
+  // Larger than the buffer of buffered streams, so that the search crosses
+  // block boundaries.
+  const unsigned length = 4096;
+  char one_byte_source[length];
+  i::uc16 two_byte_source[length];
+  for (unsigned i = 0; i < length; i++) {
+    one_byte_source[i] = (i == 1500 || i == 3000) ? '\n' : 'a';
+    two_byte_source[i] = static_cast<i::uc16>(one_byte_source[i]);
+  }
+
+  {
+    TestExternalOneByteResource resource(one_byte_source, length);
+    i::Handle<i::String> string(
+        factory->NewExternalStringFromOneByte(&resource).ToHandleChecked());
+    std::unique_ptr<i::Utf16CharacterStream> stream(
+        i::ScannerStream::For(string));
+    TestAdvanceUntil(stream.get());
+  }
+
+  {
+    TestExternalResource resource(two_byte_source, length);
+    i::Handle<i::String> string(
+        factory->NewExternalStringFromTwoByte(&resource).ToHandleChecked());
+    std::unique_ptr<i::Utf16CharacterStream> stream(
+        i::ScannerStream::For(string));
+    TestAdvanceUntil(stream.get());
+  }
+
+  {
+    i::Handle<i::String> string =
+        factory
+            ->NewStringFromAscii(i::Vector<const char>(one_byte_source, length))
+            .ToHandleChecked();
+    std::unique_ptr<i::Utf16CharacterStream> stream(
+        i::ScannerStream::For(string));
+    TestAdvanceUntil(stream.get());
+  }
+}
+
 // Regression test for crbug.com/651333. Read invalid utf-8.
 TEST(Regress651333) {
   const uint8_t bytes[] =
@@ -489,3 +489,45 @@ TEST(FastAccessorGoto) {
 
   ExpectInt32("test()", 60707357);
 }
+
+// "Fast" accessors without embedder callbacks are inlined into TurboFan code.
+TEST(FastAccessorInlinedIntoOptimizedCode) {
+  v8::internal::FLAG_always_opt = false;
+  v8::internal::FLAG_allow_natives_syntax = true;
+  v8::internal::FLAG_turbo = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::Local<v8::ObjectTemplate> foo = v8::ObjectTemplate::New(isolate);
+  foo->SetInternalFieldCount(2);
+  {
+    // accessor "isnull": null unless field 1 has the 3rd bit set, else 0 for
+    // nullptr in field 0 and 1 otherwise.
+    auto builder = v8::experimental::FastAccessorBuilder::New(isolate);
+    auto label = builder->MakeLabel();
+    auto flags = builder->LoadInternalField(builder->GetReceiver(), 1);
+    builder->CheckFlagSetOrReturnNull(flags, 0x4);
+    auto val = builder->LoadInternalField(builder->GetReceiver(), 0);
+    builder->CheckNotZeroOrJump(val, label);
+    builder->ReturnValue(builder->IntegerConstant(1));
+    builder->SetLabel(label);
+    builder->ReturnValue(builder->IntegerConstant(0));
+    foo->SetAccessorProperty(v8_str("isnull"),
+                             v8::FunctionTemplate::NewWithFastHandler(
+                                 isolate, NativePropertyAccessor, builder));
+  }
+
+  v8::Local<v8::Object> obj = foo->NewInstance(env.local()).ToLocalChecked();
+  obj->SetAlignedPointerInInternalField(0, nullptr);
+  obj->SetAlignedPointerInInternalField(1, reinterpret_cast<void*>(0xfe));
+  CHECK(env->Global()->Set(env.local(), v8_str("obj"), obj).FromJust());
+
+  CompileRun(FN_WARMUP("isnull", "return obj.isnull"));
+  CompileRun("%OptimizeFunctionOnNextCall(isnull)");
+  ExpectInt32("isnull()", 0);
+  obj->SetAlignedPointerInInternalField(0, /* anything != nullptr */ isolate);
+  ExpectInt32("isnull()", 1);
+  obj->SetAlignedPointerInInternalField(1, reinterpret_cast<void*>(0xf0));
+  ExpectNull("isnull()");
+}
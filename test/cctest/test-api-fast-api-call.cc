@@ -0,0 +1,120 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8.h"
+#include "include/v8-experimental.h"
+
+#include "src/api.h"
+#include "test/cctest/cctest.h"
+
+namespace {
+
+// These tests register a regular callback and a fast C function for the
+// same methods, and count which of them is called. The fast C functions are
+// only called from TurboFan code, everything else uses the regular callback.
+
+struct Counter {
+  int32_t value;
+};
+
+int slow_calls = 0;
+int fast_calls = 0;
+
+Counter* CounterOf(v8::Local<v8::Object> holder) {
+  return static_cast<Counter*>(holder->GetAlignedPointerFromInternalField(0));
+}
+
+void AddCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  slow_calls++;
+  v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
+  int32_t delta = info[0]->Int32Value(context).FromJust();
+  info.GetReturnValue().Set(CounterOf(info.Holder())->value + delta);
+}
+
+int32_t FastAdd(void* receiver, int32_t delta) {
+  fast_calls++;
+  return static_cast<Counter*>(receiver)->value + delta;
+}
+
+void IsPositiveCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  slow_calls++;
+  info.GetReturnValue().Set(CounterOf(info.Holder())->value > 0);
+}
+
+bool FastIsPositive(void* receiver) {
+  fast_calls++;
+  return static_cast<Counter*>(receiver)->value > 0;
+}
+
+v8::Local<v8::Object> NewCounterObject(LocalContext* env, Counter* counter) {
+  v8::Isolate* isolate = (*env)->GetIsolate();
+  v8::Local<v8::FunctionTemplate> templ = v8::FunctionTemplate::New(isolate);
+  templ->InstanceTemplate()->SetInternalFieldCount(1);
+  v8::Local<v8::Signature> signature = v8::Signature::New(isolate, templ);
+
+  v8::Local<v8::FunctionTemplate> add = v8::FunctionTemplate::New(
+      isolate, AddCallback, v8::Local<v8::Value>(), signature);
+  const v8::experimental::FastApiType add_types[] = {
+      v8::experimental::FastApiType::kWrappedObject,
+      v8::experimental::FastApiType::kInt32};
+  v8::experimental::SetFastApiCall(
+      add, reinterpret_cast<void*>(FastAdd),
+      v8::experimental::FastApiType::kInt32, 2, add_types);
+  templ->PrototypeTemplate()->Set(v8_str("add"), add);
+
+  v8::Local<v8::FunctionTemplate> is_positive = v8::FunctionTemplate::New(
+      isolate, IsPositiveCallback, v8::Local<v8::Value>(), signature);
+  const v8::experimental::FastApiType is_positive_types[] = {
+      v8::experimental::FastApiType::kWrappedObject};
+  v8::experimental::SetFastApiCall(
+      is_positive, reinterpret_cast<void*>(FastIsPositive),
+      v8::experimental::FastApiType::kBool, 1, is_positive_types);
+  templ->PrototypeTemplate()->Set(v8_str("isPositive"), is_positive);
+
+  v8::Local<v8::Object> object = templ->GetFunction(env->local())
+                                     .ToLocalChecked()
+                                     ->NewInstance(env->local())
+                                     .ToLocalChecked();
+  object->SetAlignedPointerInInternalField(0, counter);
+  return object;
+}
+
+}  // namespace
+
+TEST(FastApiCallFromOptimizedCode) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_turbo = true;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  Counter counter = {40};
+  CHECK(env->Global()
+            ->Set(env.local(), v8_str("counter"),
+                  NewCounterObject(&env, &counter))
+            .FromJust());
+  CompileRun(
+      "function add(o, x) { return o.add(x); }"
+      "function isPositive(o) { return o.isPositive(); }"
+      "add(counter, 1); add(counter, 2);"
+      "isPositive(counter); isPositive(counter);");
+  CHECK_EQ(4, slow_calls);
+  CHECK_EQ(0, fast_calls);
+
+  slow_calls = 0;
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(add);"
+      "%OptimizeFunctionOnNextCall(isPositive);");
+  ExpectInt32("add(counter, 2)", 42);
+  ExpectBoolean("isPositive(counter)", true);
+  counter.value = -1;
+  ExpectBoolean("isPositive(counter)", false);
+  CHECK_EQ(0, slow_calls);
+  CHECK_EQ(3, fast_calls);
+
+  // Arguments which don't match the signature use the regular callback.
+  fast_calls = 0;
+  ExpectInt32("add(counter, '3')", 2);
+  CHECK_EQ(1, slow_calls);
+  CHECK_EQ(0, fast_calls);
+}
@@ -2187,6 +2187,43 @@ THREADED_TEST(TestObjectTemplateClassInheritance) {
   }
 }
 
+THREADED_TEST(TestObjectTemplateClassInheritanceCopiesInstances) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::FunctionTemplate> fun_B = v8::FunctionTemplate::New(isolate);
+  fun_B->SetClassName(v8_str("B"));
+  fun_B->InstanceTemplate()->SetInternalFieldCount(1);
+  fun_B->InstanceTemplate()->Set(v8_str("x"), v8_num(1));
+  CHECK(env->Global()
+            ->Set(env.local(), v8_str("B"),
+                  fun_B->GetFunction(env.local()).ToLocalChecked())
+            .FromJust());
+
+  // Later subclass instances are copies of the cached instance of B, which
+  // must not share any state.
+  CompileRun(
+      "class C extends B { get y() { return this.x + 1; } };"
+      "var instances = [];"
+      "for (var i = 0; i < 3; i++) instances.push(new C());"
+      "instances[1].x = 2;");
+  Local<v8::Object> first =
+      CompileRun("instances[0]")->ToObject(env.local()).ToLocalChecked();
+  Local<v8::Object> second =
+      CompileRun("instances[2]")->ToObject(env.local()).ToLocalChecked();
+  CHECK_EQ(1, first->InternalFieldCount());
+  first->SetInternalField(0, v8_num(10));
+  second->SetInternalField(0, v8_num(20));
+  CHECK_EQ(10, first->GetInternalField(0)->Int32Value(env.local()).FromJust());
+  ExpectTrue("instances.every(o => Object.getPrototypeOf(o) === C.prototype)");
+  ExpectTrue("instances.every(o => o.constructor === C)");
+  ExpectInt32("instances[0].y", 2);
+  ExpectInt32("instances[1].y", 3);
+  ExpectInt32("instances[2].y", 2);
+  ExpectTrue("(new B()).x === 1 && !('y' in new B())");
+}
+
 static void NamedPropertyGetterWhichReturns42(
     Local<Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
   info.GetReturnValue().Set(v8_num(42));
@@ -9716,6 +9753,45 @@ TEST(DetachGlobal) {
 }
 
 
+TEST(ResetContext) {
+  LocalContext env1;
+  v8::Isolate* isolate = env1->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  v8::Local<Context> env2 = Context::New(isolate);
+  Local<Value> foo = v8_str("foo");
+  env1->SetSecurityToken(foo);
+  env2->SetSecurityToken(foo);
+  CHECK(env1->Global()
+            ->Set(env1.local(), v8_str("other"), env2->Global())
+            .FromJust());
+
+  // Leave state behind in env2, both in a global and in a built-in.
+  {
+    v8::Context::Scope scope(env2);
+    CompileRun(
+        "var p = 42;"
+        "Array.prototype.push = function() { return 'leaked'; };");
+    ExpectString("[].push(1)", "leaked");
+  }
+  ExpectInt32("other.p", 42);
+
+  Local<v8::Object> global2 = env2->Global();
+  v8::Local<Context> env3 = Context::Reset(env2);
+  CHECK(!env3.IsEmpty());
+  CHECK(global2->Equals(env1.local(), env3->Global()).FromJust());
+
+  // The global object is still accessible with the same security token, but
+  // shows the fresh globals of env3.
+  ExpectTrue("other.p === undefined");
+  {
+    v8::Context::Scope scope(env3);
+    ExpectInt32("[].push(1)", 1);
+    ExpectTrue("typeof p === 'undefined'");
+  }
+}
+
+
 void GetThisX(const v8::FunctionCallbackInfo<v8::Value>& info) {
   v8::Local<v8::Context> context = info.GetIsolate()->GetCurrentContext();
   info.GetReturnValue().Set(
@@ -15061,6 +15137,39 @@ THREADED_TEST(CompilationCache) {
 }
 
 
+// Code created by the Function constructor and by indirect eval is cached
+// per isolate, so other contexts only need to instantiate a new closure.
+TEST(CompilationCacheAcrossContexts) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  const char* sources[] = {"new Function('a', 'return a + 1;')",
+                           "(0, eval)('(function(a) { return a + 2; })')"};
+  for (const char* source : sources) {
+    v8::Local<v8::Context> context0 = v8::Context::New(isolate);
+    v8::Local<v8::Context> context1 = v8::Context::New(isolate);
+    v8::Local<v8::Value> result0;
+    v8::Local<v8::Value> result1;
+    {
+      v8::Context::Scope context_scope(context0);
+      // The first time a source is seen, the cache only records its hash.
+      // The second compilation puts the SharedFunctionInfo into the cache.
+      CompileRun(source);
+      result0 = CompileRun(source);
+    }
+    {
+      v8::Context::Scope context_scope(context1);
+      result1 = CompileRun(source);
+    }
+    i::Handle<i::JSFunction> function0 =
+        i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*result0));
+    i::Handle<i::JSFunction> function1 =
+        i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*result1));
+    CHECK(function0->shared() == function1->shared());
+    CHECK(function0->native_context() != function1->native_context());
+  }
+}
+
+
 static void FunctionNameCallback(
     const v8::FunctionCallbackInfo<v8::Value>& args) {
   ApiTestFuzzer::Fuzz();
@@ -15894,6 +16003,55 @@ TEST(CreateDataProperty) {
   }
 }
 
+TEST(GetMultipleAndCreateDataProperties) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+
+  v8::Local<v8::Object> obj = v8::Object::New(isolate);
+  v8::Local<v8::Name> keys[] = {v8_str("a"), v8_str("b"), v8_str("0")};
+  v8::Local<v8::Value> values[] = {v8_num(1), v8_str("two"), v8_num(3)};
+  CHECK(obj->CreateDataProperties(env.local(), 3, keys, values).FromJust());
+
+  v8::Local<v8::Value> results[3];
+  {
+    // The results outlive nested handle scopes.
+    v8::HandleScope inner_scope(isolate);
+    CHECK(obj->GetMultiple(env.local(), 3, keys, results).FromJust());
+  }
+  CHECK_EQ(1.0, results[0]->NumberValue(env.local()).FromJust());
+  CHECK(results[1]->Equals(env.local(), v8_str("two")).FromJust());
+  CHECK_EQ(3.0, results[2]->NumberValue(env.local()).FromJust());
+
+  // Missing properties are undefined, getters are called.
+  CHECK(env->Global()->Set(env.local(), v8_str("obj"), obj).FromJust());
+  CompileRun(
+      "Object.defineProperty(obj, 'b', {get() { return 42; }});"
+      "Object.defineProperty(obj, 'c', {get() { throw 'c'; }});");
+  v8::Local<v8::Name> more_keys[] = {v8_str("b"), v8_str("x"), v8_str("c"),
+                                     v8_str("a")};
+  v8::Local<v8::Value> more_results[4];
+  CHECK(obj->GetMultiple(env.local(), 2, more_keys, more_results).FromJust());
+  CHECK_EQ(42.0, more_results[0]->NumberValue(env.local()).FromJust());
+  CHECK(more_results[1]->IsUndefined());
+  {
+    v8::TryCatch try_catch(isolate);
+    CHECK(obj->GetMultiple(env.local(), 4, more_keys, more_results)
+              .IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK(more_results[3]->IsUndefined());
+  }
+
+  // Creation stops at the first property which can't be created.
+  CompileRun("Object.defineProperty(obj, 'd', {value: 0});");
+  v8::Local<v8::Name> new_keys[] = {v8_str("e"), v8_str("d"), v8_str("f")};
+  CHECK(!obj->CreateDataProperties(env.local(), 3, new_keys, values)
+             .FromJust());
+  ExpectInt32("obj.e", 1);
+  ExpectInt32("obj.d", 0);
+  ExpectTrue("!('f' in obj)");
+}
+
 
 TEST(DefineOwnProperty) {
   LocalContext env;
@@ -25584,6 +25742,36 @@ TEST(EstimatedContextSize) {
 }
 
 
+TEST(ContextLiveSizeAtLastGC) {
+  i::FLAG_track_context_live_size = true;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> small = v8::Context::New(isolate);
+  v8::Local<v8::Context> large = v8::Context::New(isolate);
+  CHECK_EQ(0u, large->LiveSizeAtLastGC());
+  {
+    v8::Context::Scope context_scope(large);
+    CompileRun(
+        "var objects = [];"
+        "for (var i = 0; i < 1000; i++) objects.push({a: i, b: [i, i]});");
+  }
+  CcTest::CollectAllGarbage(i::Heap::kNoGCFlags);
+  size_t small_size = small->LiveSizeAtLastGC();
+  size_t large_size = large->LiveSizeAtLastGC();
+  CHECK_LT(0u, small_size);
+  // Every object holds at least a header and two fields, and every array a
+  // backing store with two elements.
+  CHECK_LE(small_size + 1000 * 8 * i::kPointerSize, large_size);
+
+  {
+    v8::Context::Scope context_scope(large);
+    CompileRun("objects = null;");
+  }
+  CcTest::CollectAllGarbage(i::Heap::kNoGCFlags);
+  CHECK_GT(large_size, large->LiveSizeAtLastGC());
+}
+
+
 static int nb_uncaught_exception_callback_calls = 0;
 
 
@@ -25947,3 +26135,91 @@ TEST(EvalInAccessCheckedContext) {
   CHECK_EQ(42, x_value->Int32Value(context1).FromJust());
   context1->Exit();
 }
+
+class CountingRuntimeCallStatsVisitor : public v8::RuntimeCallStatsVisitor {
+ public:
+  CountingRuntimeCallStatsVisitor() : counters_(0), total_count_(0) {}
+
+  void VisitRuntimeCallCounter(const char* name, int64_t count,
+                               int64_t time_in_microseconds) override {
+    CHECK_GT(count, 0);
+    CHECK_GE(time_in_microseconds, 0);
+    counters_++;
+    total_count_ += count;
+  }
+
+  int counters() const { return counters_; }
+  int64_t total_count() const { return total_count_; }
+
+ private:
+  int counters_;
+  int64_t total_count_;
+};
+
+TEST(VisitRuntimeCallStats) {
+  i::FLAG_runtime_call_stats = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  isolate->ResetRuntimeCallStats();
+  CompileRun("var o = {}; for (var i = 0; i < 10; i++) o['p' + i] = i;");
+  CountingRuntimeCallStatsVisitor visitor;
+  isolate->VisitRuntimeCallStats(&visitor);
+  CHECK_GT(visitor.counters(), 0);
+  CHECK_GT(visitor.total_count(), 0);
+
+  isolate->ResetRuntimeCallStats();
+  CountingRuntimeCallStatsVisitor empty_visitor;
+  isolate->VisitRuntimeCallStats(&empty_visitor);
+  CHECK_EQ(0, empty_visitor.counters());
+  i::FLAG_runtime_call_stats = false;
+}
+
+TEST(GetLastGCStatistics) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::GCStatistics stats;
+
+  CcTest::CollectGarbage(i::NEW_SPACE);
+  CHECK(isolate->GetLastGCStatistics(&stats));
+  CHECK_EQ(v8::kGCTypeScavenge, stats.type());
+  CHECK_GE(stats.total_time(), stats.scavenge_time());
+  CHECK_EQ(0, stats.mark_time());
+  CHECK_GE(stats.survival_ratio(), 0);
+  CHECK_LE(stats.survival_ratio(), 1);
+
+  CcTest::CollectAllGarbage(i::Heap::kNoGCFlags);
+  CHECK(isolate->GetLastGCStatistics(&stats));
+  CHECK_EQ(v8::kGCTypeMarkSweepCompact, stats.type());
+  CHECK_GE(stats.total_time(), stats.mark_time());
+  CHECK_EQ(0, stats.scavenge_time());
+}
+
+TEST(CompilePhaseStatistics) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_turbo = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::CompilePhaseStatistics stats;
+
+  isolate->SetCompilePhaseStatisticsEnabled(true);
+  CompileRun(
+      "function f(x) { return x + 1; }"
+      "f(1); f(2); %OptimizeFunctionOnNextCall(f); f(3);");
+  size_t phases = isolate->NumberOfCompilePhases();
+  CHECK_GT(phases, 0u);
+  for (size_t i = 0; i < phases; i++) {
+    CHECK(isolate->GetCompilePhaseStatistics(&stats, i));
+    CHECK_NOT_NULL(stats.phase_kind_name());
+    CHECK_NOT_NULL(stats.phase_name());
+    CHECK_GE(stats.time(), 0);
+    CHECK_GE(stats.total_allocated_bytes(), stats.max_allocated_bytes());
+  }
+  CHECK(!isolate->GetCompilePhaseStatistics(&stats, phases));
+
+  isolate->SetCompilePhaseStatisticsEnabled(false);
+  CHECK_EQ(0u, isolate->NumberOfCompilePhases());
+}
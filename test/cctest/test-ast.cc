@@ -99,3 +99,27 @@ TEST(ConcatStrings) {
   CHECK(!result->is_one_byte());
   CHECK_EQ(expectation, result);
 }
+
+TEST(AstStringConstants) {
+  Isolate* isolate = CcTest::i_isolate();
+  const AstStringConstants* constants = isolate->ast_string_constants();
+  uint32_t hash_seed = isolate->heap()->HashSeed();
+
+  // Factories with the same constants share their strings.
+  Zone zone1(isolate->allocator());
+  Zone zone2(isolate->allocator());
+  AstValueFactory value_factory1(&zone1, constants, hash_seed);
+  AstValueFactory value_factory2(&zone2, constants, hash_seed);
+  CHECK_EQ(constants->arguments_string(), value_factory1.arguments_string());
+  CHECK_EQ(value_factory1.arguments_string(),
+           value_factory2.arguments_string());
+  CHECK_EQ(value_factory1.arguments_string(),
+           value_factory1.GetOneByteString("arguments"));
+
+  // The constants are internalized from the start.
+  CHECK(value_factory1.use_strict_string()->string().is_identical_to(
+      isolate->factory()->use_strict_string()));
+  value_factory1.Internalize(isolate);
+  CHECK(value_factory1.GetOneByteString("use strict")->string().is_identical_to(
+      isolate->factory()->use_strict_string()));
+}
@@ -721,3 +721,47 @@ TEST(InvocationCount) {
   CompileRun("foo();");
   CHECK_EQ(5, foo->feedback_vector()->invocation_count());
 }
+
+static bool HaveSameCode(Handle<JSFunction> f, Handle<JSFunction> g) {
+  if (f->shared()->HasBytecodeArray()) {
+    return g->shared()->HasBytecodeArray() &&
+           f->shared()->bytecode_array() == g->shared()->bytecode_array();
+  }
+  return f->shared()->code() == g->shared()->code();
+}
+
+TEST(FunctionCodeSharedAcrossScripts) {
+  FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+
+  // The scripts only differ after the functions. A function is only cached
+  // when it is compiled a second time, so the third script is the first one
+  // to reuse its code.
+  Handle<JSFunction> leaf[3];
+  Handle<JSFunction> outer[3];
+  for (int i = 0; i < 3; i++) {
+    i::EmbeddedVector<char, 256> source;
+    i::SNPrintF(source,
+                "function f(a) { return a + 1; }"
+                "function g(a) { return function() { return a; }; }"
+                "var result = f(%d) + g(2)();",
+                i);
+    CompileRun(source.start());
+    CHECK_EQ(i + 3.0, GetGlobalProperty("result")->Number());
+    leaf[i] = Handle<JSFunction>::cast(GetGlobalProperty("f"));
+    outer[i] = Handle<JSFunction>::cast(GetGlobalProperty("g"));
+  }
+  CHECK_NE(leaf[1]->shared()->script(), leaf[2]->shared()->script());
+  CHECK(!HaveSameCode(leaf[0], leaf[1]));
+  CHECK(HaveSameCode(leaf[1], leaf[2]));
+
+  // Functions with inner functions are not shared.
+  CHECK(!HaveSameCode(outer[1], outer[2]));
+
+  // Neither are functions starting at a different position.
+  CompileRun(" function f(a) { return a + 1; } var result = f(3);");
+  Handle<JSFunction> moved = Handle<JSFunction>::cast(GetGlobalProperty("f"));
+  CHECK_EQ(4.0, GetGlobalProperty("result")->Number());
+  CHECK(!HaveSameCode(leaf[2], moved));
+}
@@ -26,6 +26,7 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "src/base/platform/platform.h"
 #include "src/conversions.h"
@@ -418,6 +419,30 @@ TEST(SpecialIndexParsing) {
   CheckNonArrayIndex(false, "42949672964294967296429496729694966");
 }
 
+
+static void CheckDoubleToCString(const char* expected, double value) {
+  char buffer[100];
+  CHECK_EQ(0, strcmp(expected, DoubleToCString(value, ArrayVector(buffer))));
+}
+
+
+TEST(IntegralDoubleToCString) {
+  CheckDoubleToCString("1", 1.0);
+  CheckDoubleToCString("-1", -1.0);
+  CheckDoubleToCString("0", -0.0);
+  CheckDoubleToCString("100", 100.0);
+  CheckDoubleToCString("4294967296", 4294967296.0);
+  CheckDoubleToCString("1476438000000", 1476438000000.0);
+  CheckDoubleToCString("9007199254740991", 9007199254740991.0);
+  CheckDoubleToCString("-9007199254740991", -9007199254740991.0);
+  // Beyond the safe integers the shortest representation is used.
+  CheckDoubleToCString("9007199254740992", 9007199254740992.0);
+  CheckDoubleToCString("18014398509481984", 18014398509481984.0);
+  CheckDoubleToCString("1e+21", 1e21);
+  CheckDoubleToCString("0.5", 0.5);
+  CheckDoubleToCString("-1.5", -1.5);
+}
+
 TEST(NoHandlesForTryNumberToSize) {
   i::Isolate* isolate = CcTest::i_isolate();
   size_t result = 0;
@@ -2177,3 +2177,48 @@ TEST(TracingCpuProfiler) {
 
   i::V8::SetPlatformForTesting(old_platform);
 }
+
+namespace {
+
+class LoadICCollector : public v8::InlineCacheVisitor {
+ public:
+  void VisitInlineCache(int slot, Kind kind, State state,
+                        int map_count) override {
+    if (kind != kLoad) return;
+    states_.push_back(state);
+    map_counts_.push_back(map_count);
+  }
+
+  std::vector<State> states_;
+  std::vector<int> map_counts_;
+};
+
+}  // namespace
+
+TEST(VisitInlineCaches) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(
+      "function poly(o) { return o.x; }\n"
+      "function mega(o) { return o.x; }\n"
+      "for (var i = 0; i < 3; i++) {\n"
+      "  poly({x: 1}); poly({x: 1, a: 1}); poly({x: 1, b: 1});\n"
+      "}\n"
+      "for (var i = 0; i < 3; i++) {\n"
+      "  mega({x: 1}); mega({x: 1, a: 1}); mega({x: 1, b: 1});\n"
+      "  mega({x: 1, c: 1}); mega({x: 1, d: 1}); mega({x: 1, e: 1});\n"
+      "}\n");
+
+  LoadICCollector poly;
+  v8::CpuProfiler::VisitInlineCaches(GetFunction(env.local(), "poly"), &poly);
+  CHECK_EQ(1u, poly.states_.size());
+  CHECK_EQ(v8::InlineCacheVisitor::kPolymorphic, poly.states_[0]);
+  CHECK_EQ(3, poly.map_counts_[0]);
+
+  LoadICCollector mega;
+  v8::CpuProfiler::VisitInlineCaches(GetFunction(env.local(), "mega"), &mega);
+  CHECK_EQ(1u, mega.states_.size());
+  CHECK_EQ(v8::InlineCacheVisitor::kMegamorphic, mega.states_[0]);
+  CHECK_EQ(0, mega.map_counts_[0]);
+}
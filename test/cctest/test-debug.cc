@@ -8190,3 +8190,37 @@ TEST(DebugStepOverFunctionWithCaughtException) {
   v8::Debug::SetDebugEventListener(env->GetIsolate(), nullptr);
   CHECK_EQ(break_point_hit_count, 4);
 }
+
+TEST(BreakPointKeepsUnrelatedOptimizedCode) {
+  i::FLAG_allow_natives_syntax = true;
+  break_point_hit_count = 0;
+  DebugLocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  v8::Debug::SetDebugEventListener(isolate, DebugEventBreakPointHitCount);
+
+  v8::Local<v8::Function> foo =
+      CompileFunction(&env, "function foo(){bar=0;}", "foo");
+  v8::Local<v8::Value> g1 = CompileRun(
+      "function make() { return function g(x) { return x + 1; }; }"
+      "var g1 = make();"
+      "g1(1); g1(2); %OptimizeFunctionOnNextCall(g1); g1(3);"
+      "g1");
+  if (!Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*g1))
+           ->IsOptimized()) {
+    v8::Debug::SetDebugEventListener(isolate, nullptr);
+    return;
+  }
+
+  // A break point in foo does not flush the optimized code of g, so new
+  // closures of g still start out optimized.
+  int bp = SetBreakPoint(foo, 0);
+  foo->Call(env.context(), env->Global(), 0, NULL).ToLocalChecked();
+  CHECK_EQ(1, break_point_hit_count);
+  v8::Local<v8::Value> g2 = CompileRun("make()");
+  CHECK(Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*g2))->IsOptimized());
+
+  ClearBreakPoint(bp);
+  v8::Debug::SetDebugEventListener(isolate, nullptr);
+  CheckDebuggerUnloaded(isolate);
+}
@@ -933,3 +933,40 @@ UNINITIALIZED_TEST(DeoptimizeLoadICStoreICNested) {
   isolate->Exit();
   isolate->Dispose();
 }
+
+
+TEST(DeoptimizeTooOftenAtSameSite) {
+  i::FLAG_allow_natives_syntax = true;
+  i::FLAG_always_opt = false;
+  i::FLAG_max_deopts_per_site = 2;
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  // Optimizes {f} with monomorphic feedback and deoptimizes it eagerly at the
+  // property load that sees a different map.
+  CompileRun(
+      "function f(o, p) { return o.x + p.y; }"
+      "function deopt(o, p) {"
+      "  %ClearFunctionTypeFeedback(f);"
+      "  f({x: 1}, {y: 1});"
+      "  f({x: 1}, {y: 1});"
+      "  %OptimizeFunctionOnNextCall(f);"
+      "  f({x: 1}, {y: 1});"
+      "  f(o, p);"
+      "}");
+  Handle<JSFunction> f = GetJSFunction(env.local(), "f");
+
+  // Deopts at different sites are counted separately.
+  CompileRun("deopt({z: 1, x: 1}, {y: 1});");
+  CHECK(!f->IsOptimized());
+  CompileRun("deopt({x: 1}, {z: 1, y: 1});");
+  CHECK(!f->IsOptimized());
+  CHECK(!f->shared()->optimization_disabled());
+
+  // The second deopt at the same site disables optimization.
+  CompileRun("deopt({z: 1, x: 1}, {y: 1});");
+  CHECK(!f->IsOptimized());
+  CHECK(f->shared()->optimization_disabled());
+  CHECK_EQ(i::kDeoptimizedTooOftenAtSameSite,
+           f->shared()->disable_optimization_reason());
+}
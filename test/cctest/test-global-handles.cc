@@ -472,3 +472,45 @@ TEST(PhatomHandlesWithoutCallbacks) {
   CHECK_EQ(2, isolate->NumberOfPhantomHandleResetsSinceLastCall());
   CHECK_EQ(0, isolate->NumberOfPhantomHandleResetsSinceLastCall());
 }
+
+namespace {
+
+int finalizer_calls = 0;
+
+void ResettingFinalizer(
+    const v8::WeakCallbackInfo<v8::Global<v8::Object>>& data) {
+  finalizer_calls++;
+  data.GetParameter()->Reset();
+}
+
+}  // namespace
+
+TEST(FinalizersAmongStrongHandles) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+
+  // Spread the weak handles over several blocks of strong handles.
+  static const int kHandles = 1000;
+  v8::Global<v8::Object> strong[kHandles];
+  v8::Global<v8::Object> weak[kHandles / 10];
+  {
+    v8::HandleScope scope(isolate);
+    for (int i = 0; i < kHandles; ++i) {
+      strong[i].Reset(isolate, v8::Object::New(isolate));
+      if (i % 10 == 0) {
+        v8::Global<v8::Object>* g = &weak[i / 10];
+        g->Reset(isolate, v8::Object::New(isolate));
+        g->SetWeak(g, ResettingFinalizer, v8::WeakCallbackType::kFinalizer);
+      }
+    }
+  }
+
+  finalizer_calls = 0;
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(kHandles / 10, finalizer_calls);
+  for (int i = 0; i < kHandles / 10; ++i) CHECK(weak[i].IsEmpty());
+  for (int i = 0; i < kHandles; ++i) CHECK(!strong[i].IsEmpty());
+
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(kHandles / 10, finalizer_calls);
+}
@@ -1110,3 +1110,42 @@ TEST(SubclassPromiseBuiltinNoInlineNew) {
   FLAG_inline_new = false;
   TestSubclassPromiseBuiltin();
 }
+
+
+TEST(ObjectCreateSlackTracking) {
+  FLAG_always_opt = false;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "var proto = {};"
+      "function make() {"
+      "  var o = Object.create(proto);"
+      "  o.a = 1; o.b = 2; o.c = 3; o.d = 4; o.e = 5; o.f = 6;"
+      "  return o;"
+      "}";
+  CompileRun(source);
+
+  v8::Local<v8::Script> make_script = v8_compile("make();");
+  Handle<JSObject> obj = Run<JSObject>(make_script);
+  Handle<Map> root_map(obj->map()->FindRootMap());
+
+  // All properties are in-object, with slack left over.
+  CHECK(root_map->IsInobjectSlackTrackingInProgress());
+  CHECK_EQ(0, obj->properties()->length());
+  CHECK_LT(6, obj->map()->GetInObjectProperties());
+  CHECK(IsObjectShrinkable(*obj));
+
+  // Create several objects to complete the tracking.
+  for (int i = 1; i < Map::kGenerousAllocationCount; i++) {
+    CHECK(root_map->IsInobjectSlackTrackingInProgress());
+    Run<JSObject>(make_script);
+  }
+  CHECK(!root_map->IsInobjectSlackTrackingInProgress());
+  CHECK(!IsObjectShrinkable(*obj));
+
+  // No slack left, and the properties of new objects are still in-object.
+  CHECK_EQ(6, obj->map()->GetInObjectProperties());
+  Handle<JSObject> tmp = Run<JSObject>(make_script);
+  CHECK_EQ(tmp->map(), obj->map());
+  CHECK_EQ(0, tmp->properties()->length());
+}
@@ -739,3 +739,32 @@ TEST(ExtensionsRegistration) {
   }
   StartJoinAndDeleteThreads(threads);
 }
+
+
+// Every (isolate, thread) pair has its own PerIsolateThreadData, which is
+// found again whenever the thread enters the isolate.
+TEST(PerIsolateThreadDataLookup) {
+  const int kNumIsolates = 8;
+  v8::Isolate* isolates[kNumIsolates];
+  i::Isolate::PerIsolateThreadData* data[kNumIsolates];
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  for (int i = 0; i < kNumIsolates; i++) {
+    isolates[i] = v8::Isolate::New(create_params);
+    v8::Locker locker(isolates[i]);
+    v8::Isolate::Scope isolate_scope(isolates[i]);
+    i::Isolate* isolate = reinterpret_cast<i::Isolate*>(isolates[i]);
+    data[i] = isolate->FindPerThreadDataForThisThread();
+    CHECK_NOT_NULL(data[i]);
+    CHECK_EQ(isolate, data[i]->isolate());
+    CHECK(data[i]->thread_id().Equals(i::ThreadId::Current()));
+    for (int j = 0; j < i; j++) CHECK_NE(data[j], data[i]);
+  }
+  for (int i = kNumIsolates - 1; i >= 0; i--) {
+    v8::Locker locker(isolates[i]);
+    v8::Isolate::Scope isolate_scope(isolates[i]);
+    i::Isolate* isolate = reinterpret_cast<i::Isolate*>(isolates[i]);
+    CHECK_EQ(data[i], isolate->FindPerThreadDataForThisThread());
+  }
+  for (int i = 0; i < kNumIsolates; i++) isolates[i]->Dispose();
+}
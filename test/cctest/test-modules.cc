@@ -2,6 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "src/base/platform/platform.h"
 #include "src/flags.h"
 
 #include "test/cctest/cctest.h"
@@ -90,4 +95,122 @@ TEST(ModuleEvaluation) {
   ExpectInt32("Object.expando", 10);
 }
 
+class OneChunkSourceStream : public ScriptCompiler::ExternalSourceStream {
+ public:
+  explicit OneChunkSourceStream(const char* source)
+      : source_(source), done_(false) {}
+
+  size_t GetMoreData(const uint8_t** src) override {
+    if (done_) return 0;
+    done_ = true;
+    size_t length = strlen(source_);
+    uint8_t* copy = new uint8_t[length];
+    memcpy(copy, source_, length);
+    *src = copy;
+    return length;
+  }
+
+ private:
+  const char* source_;
+  bool done_;
+};
+
+class StreamingTaskThread : public v8::base::Thread {
+ public:
+  explicit StreamingTaskThread(ScriptCompiler::ScriptStreamingTask* task)
+      : Thread(Options("StreamingTaskThread")), task_(task) {}
+
+  void Run() override { task_->Run(); }
+
+ private:
+  std::unique_ptr<ScriptCompiler::ScriptStreamingTask> task_;
+};
+
+static std::map<std::string, v8::Global<Module>>* g_streamed_modules;
+
+static MaybeLocal<Module> StreamedModuleResolveCallback(
+    Local<Context> context, Local<String> specifier, Local<Module> referrer) {
+  String::Utf8Value name(specifier);
+  auto it = g_streamed_modules->find(*name);
+  if (it == g_streamed_modules->end()) return MaybeLocal<Module>();
+  return it->second.Get(context->GetIsolate());
+}
+
+TEST(ModuleStreamingInParallel) {
+  Isolate* isolate = CcTest::isolate();
+  HandleScope scope(isolate);
+  LocalContext env;
+  v8::TryCatch try_catch(isolate);
+
+  struct {
+    const char* name;
+    const char* source;
+  } modules[] = {
+      {"main.js",
+       "import {a} from 'a.js'; import {b} from 'b.js';"
+       "Object.streamed = a + b;"},
+      {"a.js", "export let a = 3;"},
+      {"b.js", "import {a} from 'a.js'; export let b = a * 4;"},
+  };
+  const int kModuleCount = arraysize(modules);
+
+  // Parse all modules on background threads at the same time.
+  std::unique_ptr<ScriptCompiler::StreamedSource> sources[kModuleCount];
+  std::unique_ptr<StreamingTaskThread> threads[kModuleCount];
+  for (int i = 0; i < kModuleCount; i++) {
+    sources[i].reset(new ScriptCompiler::StreamedSource(
+        new OneChunkSourceStream(modules[i].source),
+        ScriptCompiler::StreamedSource::ONE_BYTE));
+    ScriptCompiler::ScriptStreamingTask* task =
+        ScriptCompiler::StartStreamingModule(isolate, sources[i].get());
+    CHECK_NOT_NULL(task);
+    threads[i].reset(new StreamingTaskThread(task));
+    threads[i]->Start();
+  }
+  for (int i = 0; i < kModuleCount; i++) threads[i]->Join();
+  CHECK(!try_catch.HasCaught());
+
+  // Compile the parsed modules on the main thread, then link the graph.
+  std::map<std::string, v8::Global<Module>> streamed_modules;
+  for (int i = 0; i < kModuleCount; i++) {
+    ScriptOrigin origin(v8_str(modules[i].name));
+    Local<Module> module =
+        ScriptCompiler::CompileModule(env.local(), sources[i].get(),
+                                      v8_str(modules[i].source), origin)
+            .ToLocalChecked();
+    streamed_modules[modules[i].name].Reset(isolate, module);
+  }
+  Local<Module> main = streamed_modules["main.js"].Get(isolate);
+  CHECK_EQ(2, main->GetModuleRequestsLength());
+  CHECK(v8_str("a.js")->StrictEquals(main->GetModuleRequest(0)));
+
+  g_streamed_modules = &streamed_modules;
+  CHECK(main->Instantiate(env.local(), StreamedModuleResolveCallback));
+  g_streamed_modules = nullptr;
+  CHECK(!main->Evaluate(env.local()).IsEmpty());
+  ExpectInt32("Object.streamed", 15);
+}
+
+TEST(ModuleStreamingSyntaxError) {
+  Isolate* isolate = CcTest::isolate();
+  HandleScope scope(isolate);
+  LocalContext env;
+  v8::TryCatch try_catch(isolate);
+
+  const char* source_text = "import {a} from 'a.js'; export let 1 = a;";
+  ScriptCompiler::StreamedSource source(
+      new OneChunkSourceStream(source_text),
+      ScriptCompiler::StreamedSource::ONE_BYTE);
+  std::unique_ptr<ScriptCompiler::ScriptStreamingTask> task(
+      ScriptCompiler::StartStreamingModule(isolate, &source));
+  task->Run();
+  CHECK(!try_catch.HasCaught());
+
+  ScriptOrigin origin(v8_str("error.js"));
+  CHECK(ScriptCompiler::CompileModule(env.local(), &source,
+                                      v8_str(source_text), origin)
+            .IsEmpty());
+  CHECK(try_catch.HasCaught());
+}
+
 }  // anonymous namespace
@@ -111,6 +111,32 @@ TEST(ScanKeywords) {
 }
 
 
+TEST(ScanLongIdentifiers) {
+  // Identifiers which span several blocks of the character stream.
+  i::UnicodeCache unicode_cache;
+  i::AccountingAllocator allocator;
+  i::Zone zone(&allocator);
+  i::AstValueFactory ast_value_factory(&zone, 0);
+  const char* suffixes[] = {"", "$_0Z", "\\u0061"};
+  for (unsigned i = 0; i < arraysize(suffixes); i++) {
+    std::string identifier(10000, 'a');
+    identifier += suffixes[i];
+    std::string source = identifier + " = 1";
+    auto stream = i::ScannerStream::ForTesting(source.c_str(), source.length());
+    i::Scanner scanner(&unicode_cache);
+    scanner.Initialize(stream.get());
+    CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+    const i::AstRawString* name = scanner.CurrentSymbol(&ast_value_factory);
+    // The unicode escape stands for one character.
+    std::string expected = i == 2 ? std::string(10001, 'a') : identifier;
+    CHECK(name->IsOneByteEqualTo(expected.c_str()));
+    CHECK_EQ(i::Token::ASSIGN, scanner.Next());
+    CHECK_EQ(i::Token::NUMBER, scanner.Next());
+    CHECK_EQ(i::Token::EOS, scanner.Next());
+  }
+}
+
+
 TEST(ScanHTMLEndComments) {
   v8::V8::Initialize();
   v8::Isolate* isolate = CcTest::isolate();
@@ -43,6 +43,7 @@
 #include "src/snapshot/deserializer.h"
 #include "src/snapshot/natives.h"
 #include "src/snapshot/partial-serializer.h"
+#include "src/snapshot/shared-code-cache.h"
 #include "src/snapshot/snapshot.h"
 #include "src/snapshot/startup-serializer.h"
 #include "test/cctest/cctest.h"
@@ -1535,6 +1536,52 @@ TEST(CodeSerializerIsolates) {
   isolate2->Dispose();
 }
 
+static void CompileAndRunInNewIsolate(const char* source, bool allow_compile) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source script_source(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script;
+    {
+      std::unique_ptr<DisallowCompilation> no_compile;
+      if (!allow_compile) {
+        no_compile.reset(
+            new DisallowCompilation(reinterpret_cast<Isolate*>(isolate)));
+      }
+      script = v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+                   .ToLocalChecked();
+    }
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate->Dispose();
+}
+
+TEST(CodeSerializerSharedCodeCache) {
+  FLAG_serialize_toplevel = true;
+  FLAG_shared_code_cache = true;
+  SharedCodeCache::Clear();
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  // The first isolate compiles the script and populates the shared cache.
+  CompileAndRunInNewIsolate(source, true);
+  // The second isolate deserializes it without compiling.
+  CompileAndRunInNewIsolate(source, false);
+
+  SharedCodeCache::Clear();
+}
+
 TEST(CodeSerializerFlagChange) {
   FLAG_serialize_toplevel = true;
 
@@ -1593,6 +1640,90 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerConsumeCodeCacheTask) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+        v8::ScriptCompiler::StartConsumingCodeCache(isolate2, &source);
+    CHECK_NOT_NULL(task);
+    CHECK(!source.IsCachedDataChecked());
+    // The task does not touch the heap, so it's OK to just run it here in the
+    // main thread.
+    task->Run();
+    delete task;
+    CHECK(!cache->rejected);
+    CHECK(source.IsCachedDataChecked());
+
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile(reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerConsumeCodeCacheTaskBitFlip) {
+  FLAG_serialize_toplevel = true;
+
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  // Random bit flip.
+  const_cast<uint8_t*>(cache->data)[337] ^= 0x40;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::ScriptCompiler::ConsumeCodeCacheTask* task =
+        v8::ScriptCompiler::StartConsumingCodeCache(isolate2, &source);
+    task->Run();
+    delete task;
+    CHECK(cache->rejected);
+    CHECK(!source.IsCachedDataChecked());
+
+    // Compiling from the rejected data falls back to a full compile.
+    v8::ScriptCompiler::CompileUnboundScript(
+        isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+        .ToLocalChecked();
+    CHECK(cache->rejected);
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   FLAG_serialize_toplevel = true;
 
@@ -1817,6 +1948,206 @@ TEST(CodeSerializerEagerCompilationAndPreAge) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerLazyFunctions) {
+  if (FLAG_ignition) return;
+
+  FLAG_lazy = true;
+  FLAG_serialize_toplevel = true;
+  FLAG_serialize_eager = true;
+  FLAG_serialize_lazy_functions = true;
+  FLAG_min_preparse_length = 1;
+
+  static const char* source =
+      "function f() {"
+      "  function g() {"
+      "    return 1;"
+      "  }"
+      "  return g() + 1;"
+      "}"
+      "'abcdef';";
+
+  v8::ScriptCompiler::CachedData* cache = ProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+
+    CHECK(!cache->rejected);
+
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+    HandleScope i_scope(i_isolate);
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*unbound);
+    Handle<Script> script(Script::cast(toplevel->script()));
+    {
+      // Only the toplevel code has been deserialized.
+      WeakFixedArray::Iterator iterator(script->shared_function_infos());
+      int count = 0;
+      while (SharedFunctionInfo* shared = iterator.Next<SharedFunctionInfo>()) {
+        if (shared == *toplevel) {
+          CHECK(shared->is_compiled());
+        } else {
+          CHECK(!shared->is_compiled());
+          CHECK(shared->HasLazyDeserializationData());
+        }
+        count++;
+      }
+      CHECK_EQ(3, count);
+    }
+
+    unbound->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK_EQ(2, CompileRun("f()")->Int32Value(context).FromJust());
+
+    // Both inner functions have been deserialized on their first call.
+    WeakFixedArray::Iterator iterator(script->shared_function_infos());
+    while (SharedFunctionInfo* shared = iterator.Next<SharedFunctionInfo>()) {
+      if (shared == *toplevel) continue;
+      CHECK(shared->is_compiled());
+      CHECK(!shared->HasLazyDeserializationData());
+    }
+  }
+  isolate2->Dispose();
+  FLAG_serialize_lazy_functions = false;
+}
+
+static SharedFunctionInfo* FindSharedFunctionInfo(Handle<Script> script,
+                                                  const char* name) {
+  WeakFixedArray::Iterator iterator(script->shared_function_infos());
+  while (SharedFunctionInfo* shared = iterator.Next<SharedFunctionInfo>()) {
+    if (String::cast(shared->name())->IsUtf8EqualTo(CStrVector(name))) {
+      return shared;
+    }
+  }
+  UNREACHABLE();
+  return nullptr;
+}
+
+static bool IsCompiled(Handle<Script> script, const char* name) {
+  return FindSharedFunctionInfo(script, name)->is_compiled();
+}
+
+TEST(CompileHints) {
+  if (!FLAG_lazy || (FLAG_ignition && FLAG_ignition_eager)) return;
+  FLAG_min_preparse_length = 0;
+
+  static const char* source =
+      "function used() { return 1; }"
+      "function unused() { return 2; }"
+      "used();";
+
+  v8::ScriptCompiler::CachedData* hints;
+  {
+    LocalContext context;
+    v8::HandleScope scope(CcTest::isolate());
+    v8::ScriptCompiler::Source source_object(v8_str(source));
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(CcTest::isolate(),
+                                                 &source_object)
+            .ToLocalChecked();
+    unbound->BindToCurrentContext()->Run(context.local()).ToLocalChecked();
+    hints = v8::ScriptCompiler::CreateCompileHints(unbound);
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source_object(v8_str(source), hints);
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_object, v8::ScriptCompiler::kConsumeCompileHints)
+            .ToLocalChecked();
+    CHECK(!hints->rejected);
+
+    // Only the function which ran before is compiled along with the script.
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+    HandleScope i_scope(i_isolate);
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*unbound);
+    Handle<Script> script(Script::cast(toplevel->script()));
+    CHECK(IsCompiled(script, "used"));
+    CHECK(!IsCompiled(script, "unused"));
+
+    // Hints recorded for a different source are rejected.
+    v8::ScriptCompiler::Source other_source(
+        v8_str("function used() { return 3; }"),
+        new v8::ScriptCompiler::CachedData(hints->data, hints->length));
+    v8::ScriptCompiler::CompileUnboundScript(
+        isolate2, &other_source, v8::ScriptCompiler::kConsumeCompileHints)
+        .ToLocalChecked();
+    CHECK(other_source.GetCachedData()->rejected);
+  }
+  isolate2->Dispose();
+}
+
+TEST(CompileHintsForOptimizedFunctions) {
+  if (!FLAG_crankshaft || FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+  FLAG_min_preparse_length = 0;
+
+  static const char* source =
+      "function hot(x) { return x + 1; }"
+      "function warm(x) { return x + 2; }"
+      "hot(1); hot(2); warm(1);"
+      "%OptimizeFunctionOnNextCall(hot);"
+      "hot(3);";
+
+  v8::ScriptCompiler::CachedData* hints;
+  {
+    LocalContext context;
+    v8::HandleScope scope(CcTest::isolate());
+    v8::ScriptCompiler::Source source_object(v8_str(source));
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(CcTest::isolate(),
+                                                 &source_object)
+            .ToLocalChecked();
+    unbound->BindToCurrentContext()->Run(context.local()).ToLocalChecked();
+    hints = v8::ScriptCompiler::CreateCompileHints(unbound);
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source_object(v8_str(source), hints);
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_object, v8::ScriptCompiler::kConsumeCompileHints)
+            .ToLocalChecked();
+    CHECK(!hints->rejected);
+
+    // Only the function which was optimized before is optimized early.
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate2);
+    HandleScope i_scope(i_isolate);
+    Handle<SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*unbound);
+    Handle<Script> script(Script::cast(toplevel->script()));
+    CHECK(FindSharedFunctionInfo(script, "hot")->optimize_early());
+    CHECK(!FindSharedFunctionInfo(script, "warm")->optimize_early());
+  }
+  isolate2->Dispose();
+}
+
 TEST(Regress503552) {
   // Test that the code serializer can deal with weak cells that form a linked
   // list during incremental marking.
@@ -2179,6 +2510,56 @@ TEST(SnapshotCreatorTemplates) {
   delete[] blob.data;
 }
 
+TEST(SnapshotCreatorMultipleContextsWithTemplates) {
+  DisableTurbofan();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator(original_external_references);
+    v8::Isolate* isolate = creator.GetIsolate();
+    v8::ExtensionConfiguration* no_extension = nullptr;
+    for (int i = 0; i < 2; i++) {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::ObjectTemplate> global_template =
+          v8::ObjectTemplate::New(isolate);
+      global_template->Set(
+          v8_str("f"), v8::FunctionTemplate::New(isolate, SerializedCallback));
+      v8::Local<v8::Context> context =
+          v8::Context::New(isolate, no_extension, global_template);
+      v8::Context::Scope context_scope(context);
+      CompileRun(i == 0 ? "var g = function() { return f() + 1; }"
+                        : "var g = function() { return f() + 2; }");
+      CHECK_EQ(static_cast<size_t>(i), creator.AddContext(context));
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  params.external_references = original_external_references;
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context =
+          v8::Context::FromSnapshot(isolate, 0).ToLocalChecked();
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("g()", 43);
+    }
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context =
+          v8::Context::FromSnapshot(isolate, 1).ToLocalChecked();
+      v8::Context::Scope context_scope(context);
+      ExpectInt32("g()", 44);
+    }
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+}
+
 TEST(SerializationMemoryStats) {
   FLAG_profile_deserialization = true;
   FLAG_always_opt = false;
@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <vector>
+
 #include "src/v8.h"
 
 #include "src/api.h"
@@ -925,6 +927,68 @@ TEST(Utf8Conversion) {
 }
 
 
+TEST(Utf8ConversionWithAsciiRuns) {
+  // Runs of ASCII characters of all lengths around the size of the decoder
+  // buffer, between non-ASCII characters.
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  const int kMaxRun = 530;
+  std::vector<char> utf8;
+  std::vector<uint16_t> utf16;
+  for (int run = 0; run < kMaxRun; run += 17) {
+    // U+00E9 -> C3 A9
+    utf8.push_back(static_cast<char>(0xC3));
+    utf8.push_back(static_cast<char>(0xA9));
+    utf16.push_back(0x00E9);
+    for (int i = 0; i < run; i++) {
+      utf8.push_back('a' + i % 26);
+      utf16.push_back('a' + i % 26);
+    }
+    // U+1F600 -> F0 9F 98 80
+    utf8.push_back(static_cast<char>(0xF0));
+    utf8.push_back(static_cast<char>(0x9F));
+    utf8.push_back(static_cast<char>(0x98));
+    utf8.push_back(static_cast<char>(0x80));
+    utf16.push_back(0xD83D);
+    utf16.push_back(0xDE00);
+  }
+  v8::Local<v8::String> str =
+      v8::String::NewFromUtf8(isolate, utf8.data(), v8::NewStringType::kNormal,
+                              static_cast<int>(utf8.size()))
+          .ToLocalChecked();
+  CHECK_EQ(static_cast<int>(utf16.size()), str->Length());
+  std::vector<uint16_t> chars(utf16.size());
+  str->Write(chars.data(), 0, static_cast<int>(chars.size()),
+             v8::String::NO_NULL_TERMINATION);
+  CHECK(chars == utf16);
+
+  // Write a one-byte string with ASCII runs back out as UTF-8.
+  std::vector<uint8_t> latin1;
+  std::vector<char> latin1_as_utf8;
+  for (int i = 0; i < 2 * kMaxRun; i++) {
+    uint8_t c = i % 37 == 0 ? 0xE9 : 'a' + i % 26;
+    latin1.push_back(c);
+    if (c == 0xE9) {
+      latin1_as_utf8.push_back(static_cast<char>(0xC3));
+      latin1_as_utf8.push_back(static_cast<char>(0xA9));
+    } else {
+      latin1_as_utf8.push_back(c);
+    }
+  }
+  v8::Local<v8::String> one_byte =
+      v8::String::NewFromOneByte(isolate, latin1.data(),
+                                 v8::NewStringType::kNormal,
+                                 static_cast<int>(latin1.size()))
+          .ToLocalChecked();
+  std::vector<char> buffer(latin1_as_utf8.size());
+  CHECK_EQ(static_cast<int>(buffer.size()),
+           one_byte->WriteUtf8(buffer.data(), -1, nullptr,
+                               v8::String::NO_NULL_TERMINATION));
+  CHECK(buffer == latin1_as_utf8);
+}
+
+
 TEST(ExternalShortStringAdd) {
   LocalContext context;
   v8::HandleScope handle_scope(CcTest::isolate());
@@ -263,3 +263,66 @@ TEST(Regress399527) {
   // marking bits which makes the weak map garbage.
   CcTest::CollectAllGarbage(i::Heap::kFinalizeIncrementalMarkingMask);
 }
+
+
+// Returns the number of entries of the weak map maps[index].
+static int NumberOfWeakMapEntries(int index) {
+  EmbeddedVector<char, 32> source;
+  SNPrintF(source, "maps[%d]", index);
+  Handle<JSWeakMap> weakmap = Handle<JSWeakMap>::cast(
+      v8::Utils::OpenHandle(*CompileRun(source.start())));
+  return ObjectHashTable::cast(weakmap->table())->NumberOfElements();
+}
+
+
+TEST(EphemeronChains) {
+  FLAG_incremental_marking = false;
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  HandleScope scope(isolate);
+
+  // Build a chain of entries spread over several weak maps, where the value
+  // of each entry is the key of the next one. The chain runs against the
+  // order in which the maps are visited, so every entry only becomes live
+  // after the previous one was marked. Entries with dead keys are mixed in.
+  CompileRun(
+      "var maps = [];"
+      "for (var i = 0; i < 8; i++) maps.push(new WeakMap());"
+      "var root = {};"
+      "var key = root;"
+      "for (var i = 0; i < 512; i++) {"
+      "  var next = {};"
+      "  maps[(512 - i) % 8].set(key, next);"
+      "  maps[i % 8].set({}, {});"
+      "  key = next;"
+      "}"
+      "key = next = undefined;"
+      "function chainLength() {"
+      "  var length = 0;"
+      "  for (var key = root;; length++) {"
+      "    var value;"
+      "    for (var i = 0; i < 8 && value === undefined; i++) {"
+      "      value = maps[i].get(key);"
+      "    }"
+      "    if (value === undefined) return length;"
+      "    key = value;"
+      "    value = undefined;"
+      "  }"
+      "}");
+
+  CcTest::CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  CHECK_EQ(512, CompileRun("chainLength()")->Int32Value(context.local())
+                    .FromJust());
+  int live_entries = 0;
+  for (int i = 0; i < 8; i++) {
+    live_entries += NumberOfWeakMapEntries(i);
+  }
+  CHECK_EQ(512, live_entries);
+
+  // Once the root dies, the whole chain goes away.
+  CompileRun("root = undefined;");
+  CcTest::CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  for (int i = 0; i < 8; i++) {
+    CHECK_EQ(0, NumberOfWeakMapEntries(i));
+  }
+}
@@ -5,7 +5,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "src/snapshot/code-serializer.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-macro-gen.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
@@ -150,6 +152,30 @@ TEST(Run_WasmModule_CallMain_recursive) {
   TestModule(&zone, builder, 55);
 }
 
+TEST(Run_WasmModule_FastCompilation) {
+  FLAG_wasm_fast_compilation = true;
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  TestSignatures sigs;
+
+  WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+  WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+
+  uint16_t localIndex = f->AddLocal(kAstI32);
+  ExportAsMain(f);
+  byte code[] = {
+      WASM_SET_LOCAL(localIndex,
+                     WASM_LOAD_MEM(MachineType::Int32(), WASM_ZERO)),
+      WASM_IF_ELSE_I(WASM_I32_LTS(WASM_GET_LOCAL(localIndex), WASM_I8(5)),
+                     WASM_SEQ(WASM_STORE_MEM(MachineType::Int32(), WASM_ZERO,
+                                             WASM_INC_LOCAL(localIndex)),
+                              WASM_CALL_FUNCTION0(0)),
+                     WASM_I8(55))};
+  f->EmitCode(code, sizeof(code));
+  TestModule(&zone, builder, 55);
+  FLAG_wasm_fast_compilation = false;
+}
+
 TEST(Run_WasmModule_Global) {
   v8::internal::AccountingAllocator allocator;
   Zone zone(&allocator);
@@ -265,6 +291,194 @@ TEST(Run_WasmModule_Serialization) {
   }
 }
 
+TEST(Run_WasmModule_SerializationChecksWireBytes) {
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator);
+
+  WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+  TestSignatures sigs;
+
+  WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+  ExportAsMain(f);
+  byte code[] = {WASM_I8(42)};
+  f->EmitCode(code, sizeof(code));
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(buffer);
+  Vector<const byte> wire_bytes(buffer.begin(),
+                                static_cast<int>(buffer.size()));
+
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  HandleScope scope(isolate);
+  testing::SetupIsolateForWasmModule(isolate);
+  ErrorThrower thrower(isolate, "");
+
+  ModuleResult decoding_result = DecodeWasmModule(
+      isolate, &zone, buffer.begin(), buffer.end(), false, kWasmOrigin);
+  std::unique_ptr<const WasmModule> module(decoding_result.val);
+  CHECK(!decoding_result.failed());
+  Handle<WasmCompiledModule> compiled_module =
+      module->CompileFunctions(isolate, &thrower).ToHandleChecked();
+  std::unique_ptr<ScriptData> data =
+      WasmCompiledModuleSerializer::SerializeWasmModule(isolate,
+                                                        compiled_module);
+
+  {
+    // The original wire bytes are accepted and attached to the module.
+    ScriptData sc(data->data(), data->length());
+    Handle<FixedArray> deserialized =
+        WasmCompiledModuleSerializer::DeserializeWasmModule(isolate, &sc,
+                                                            wire_bytes)
+            .ToHandleChecked();
+    Handle<WasmCompiledModule> deserialized_module =
+        Handle<WasmCompiledModule>::cast(deserialized);
+    CHECK(deserialized_module->has_module_bytes());
+    CHECK_EQ(wire_bytes.length(), deserialized_module->module_bytes()->length());
+  }
+
+  {
+    // Different wire bytes are rejected.
+    byte* other_bytes = zone.NewArray<byte>(wire_bytes.length());
+    memcpy(other_bytes, wire_bytes.start(), wire_bytes.length());
+    other_bytes[wire_bytes.length() - 1] ^= 1;
+    ScriptData sc(data->data(), data->length());
+    CHECK(WasmCompiledModuleSerializer::DeserializeWasmModule(
+              isolate, &sc,
+              Vector<const byte>(other_bytes, wire_bytes.length()))
+              .is_null());
+  }
+}
+
+namespace {
+void StreamAndRunModule(const ZoneBuffer& buffer, size_t chunk_size,
+                        int32_t expected) {
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  HandleScope scope(isolate);
+  testing::SetupIsolateForWasmModule(isolate);
+  ErrorThrower thrower(isolate, "TestStreamingCompilation");
+  StreamingDecoder decoder(isolate, &thrower);
+  for (size_t offset = 0; offset < buffer.size(); offset += chunk_size) {
+    size_t length = Min(chunk_size, buffer.size() - offset);
+    CHECK(decoder.OnBytesReceived(buffer.begin() + offset, length));
+  }
+  Handle<JSObject> module_object = decoder.Finish().ToHandleChecked();
+  CHECK(!thrower.error());
+  Handle<JSObject> instance =
+      WasmModule::Instantiate(isolate, &thrower, module_object,
+                              Handle<JSReceiver>::null(),
+                              Handle<JSArrayBuffer>::null())
+          .ToHandleChecked();
+  CHECK_EQ(expected, testing::RunWasmModuleForTesting(
+                         isolate, instance, 0, nullptr, kWasmOrigin));
+}
+
+void TestStreamingCompilation(size_t chunk_size) {
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  TestSignatures sigs;
+
+  WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+  WasmFunctionBuilder* f1 = builder->AddFunction(sigs.i_ii());
+  byte code1[] = {WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1))};
+  f1->EmitCode(code1, sizeof(code1));
+  WasmFunctionBuilder* f2 = builder->AddFunction(sigs.i_v());
+  ExportAsMain(f2);
+  byte code2[] = {
+      WASM_CALL_FUNCTION(f1->func_index(), WASM_I8(77), WASM_I8(22))};
+  f2->EmitCode(code2, sizeof(code2));
+  byte data[] = {0xaa, 0xbb, 0xcc, 0xdd};
+  builder->AddDataSegment(data, sizeof(data), 0);
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(buffer);
+  StreamAndRunModule(buffer, chunk_size, 99);
+}
+}  // namespace
+
+TEST(Run_WasmModule_StreamingCompilation) {
+  TestStreamingCompilation(1);
+  TestStreamingCompilation(7);
+  TestStreamingCompilation(1024);
+}
+
+TEST(Run_WasmModule_StreamingCompilationLarge) {
+  // The module does not fit into the initial buffer of the decoder, so the
+  // buffer grows while function bodies are being compiled.
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  TestSignatures sigs;
+
+  WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+  const int kNumFunctions = 16;
+  const size_t kNumNops = 16 * KB;
+  WasmFunctionBuilder* f = nullptr;
+  for (int i = 0; i < kNumFunctions; ++i) {
+    f = builder->AddFunction(sigs.i_v());
+    std::vector<byte> code(kNumNops, kExprNop);
+    byte value[] = {WASM_I8(80 + i)};
+    code.insert(code.end(), value, value + sizeof(value));
+    f->EmitCode(code.data(), static_cast<uint32_t>(code.size()));
+  }
+  ExportAsMain(f);
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(buffer);
+  CHECK_LT(kNumFunctions * kNumNops, buffer.size());
+  StreamAndRunModule(buffer, 1000, 80 + kNumFunctions - 1);
+  StreamAndRunModule(buffer, 64 * KB + 1, 80 + kNumFunctions - 1);
+}
+
+TEST(Run_WasmModule_StreamingCompilationTruncated) {
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  TestSignatures sigs;
+
+  WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+  WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+  ExportAsMain(f);
+  byte code[] = {WASM_I8(114)};
+  f->EmitCode(code, sizeof(code));
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(buffer);
+
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  HandleScope scope(isolate);
+  testing::SetupIsolateForWasmModule(isolate);
+  ErrorThrower thrower(isolate, "TestStreamingCompilation");
+  StreamingDecoder decoder(isolate, &thrower);
+  CHECK(decoder.OnBytesReceived(buffer.begin(), buffer.size() - 1));
+  CHECK(decoder.Finish().is_null());
+  CHECK(thrower.error());
+}
+
+TEST(Run_WasmModule_StreamingCompilationSectionOrder) {
+  v8::internal::AccountingAllocator allocator;
+  Zone zone(&allocator);
+  TestSignatures sigs;
+
+  WasmModuleBuilder* builder = new (&zone) WasmModuleBuilder(&zone);
+  WasmFunctionBuilder* f = builder->AddFunction(sigs.i_v());
+  ExportAsMain(f);
+  byte code[] = {WASM_I8(114)};
+  f->EmitCode(code, sizeof(code));
+
+  ZoneBuffer buffer(&zone);
+  builder->WriteTo(buffer);
+
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  HandleScope scope(isolate);
+  testing::SetupIsolateForWasmModule(isolate);
+  ErrorThrower thrower(isolate, "TestStreamingCompilation");
+  StreamingDecoder decoder(isolate, &thrower);
+  CHECK(decoder.OnBytesReceived(buffer.begin(), buffer.size()));
+  // A type section after the code section is rejected as soon as it arrives.
+  byte type_section[] = {kTypeSectionCode, 1, 0};
+  CHECK(!decoder.OnBytesReceived(type_section, sizeof(type_section)));
+  CHECK(decoder.Finish().is_null());
+  CHECK(thrower.error());
+}
+
 TEST(MemorySize) {
   // Initial memory size is 16, see wasm-module-builder.cc
   static const int kExpectedValue = 16;
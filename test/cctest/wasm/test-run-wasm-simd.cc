@@ -47,3 +47,102 @@ WASM_EXEC_TEST(Splat) {
 
   FOR_INT32_INPUTS(i) { CHECK_EQ(1, r.Call(*i)); }
 }
+
+WASM_EXEC_TEST(I32x4Add) {
+  FLAG_wasm_simd_prototype = true;
+
+  // Add two splatted values and check the lanes of the result.
+  WasmRunner<int32_t> r(kExecuteCompiled, MachineType::Int32(),
+                        MachineType::Int32());
+  r.AllocateLocal(kAstS128);
+  BUILD(r,
+        WASM_BLOCK(
+            WASM_SET_LOCAL(2, WASM_SIMD_I32x4_ADD(
+                                  WASM_SIMD_I32x4_SPLAT(WASM_GET_LOCAL(0)),
+                                  WASM_SIMD_I32x4_SPLAT(WASM_GET_LOCAL(1)))),
+            WASM_RETURN1(WASM_I32_ADD(
+                WASM_SIMD_I32x4_EXTRACT_LANE(0, WASM_GET_LOCAL(2)),
+                WASM_SIMD_I32x4_EXTRACT_LANE(3, WASM_GET_LOCAL(2))))));
+
+  FOR_INT32_INPUTS(i) {
+    FOR_INT32_INPUTS(j) {
+      int32_t sum = static_cast<int32_t>(static_cast<uint32_t>(*i) +
+                                         static_cast<uint32_t>(*j));
+      int32_t expected = static_cast<int32_t>(static_cast<uint32_t>(sum) * 2);
+      CHECK_EQ(expected, r.Call(*i, *j));
+    }
+  }
+}
+
+WASM_EXEC_TEST(I32x4Sub) {
+  FLAG_wasm_simd_prototype = true;
+
+  // Subtract two splatted values and check the lanes of the result.
+  WasmRunner<int32_t> r(kExecuteCompiled, MachineType::Int32(),
+                        MachineType::Int32());
+  r.AllocateLocal(kAstS128);
+  BUILD(r,
+        WASM_BLOCK(
+            WASM_SET_LOCAL(2, WASM_SIMD_I32x4_SUB(
+                                  WASM_SIMD_I32x4_SPLAT(WASM_GET_LOCAL(0)),
+                                  WASM_SIMD_I32x4_SPLAT(WASM_GET_LOCAL(1)))),
+            WASM_RETURN1(WASM_I32_ADD(
+                WASM_SIMD_I32x4_EXTRACT_LANE(1, WASM_GET_LOCAL(2)),
+                WASM_SIMD_I32x4_EXTRACT_LANE(2, WASM_GET_LOCAL(2))))));
+
+  FOR_INT32_INPUTS(i) {
+    FOR_INT32_INPUTS(j) {
+      int32_t diff = static_cast<int32_t>(static_cast<uint32_t>(*i) -
+                                          static_cast<uint32_t>(*j));
+      int32_t expected = static_cast<int32_t>(static_cast<uint32_t>(diff) * 2);
+      CHECK_EQ(expected, r.Call(*i, *j));
+    }
+  }
+}
+
+WASM_EXEC_TEST(F32x4Splat) {
+  FLAG_wasm_simd_prototype = true;
+
+  // Splat a value and return the sum of its first and last lanes.
+  WasmRunner<float> r(kExecuteCompiled, MachineType::Float32());
+  r.AllocateLocal(kAstS128);
+  BUILD(r, WASM_BLOCK(
+               WASM_SET_LOCAL(1, WASM_SIMD_F32x4_SPLAT(WASM_GET_LOCAL(0))),
+               WASM_RETURN1(WASM_F32_ADD(
+                   WASM_SIMD_F32x4_EXTRACT_LANE(0, WASM_GET_LOCAL(1)),
+                   WASM_SIMD_F32x4_EXTRACT_LANE(3, WASM_GET_LOCAL(1))))));
+
+  FOR_FLOAT32_INPUTS(i) { CHECK_FLOAT_EQ(*i + *i, r.Call(*i)); }
+}
+
+typedef float (*FloatBinOp)(float, float);
+
+static void RunF32x4BinOpTest(WasmOpcode simd_op, FloatBinOp expected_op) {
+  FLAG_wasm_simd_prototype = true;
+
+  // Apply {simd_op} to two splatted values and return one lane of the result.
+  WasmRunner<float> r(kExecuteCompiled, MachineType::Float32(),
+                      MachineType::Float32());
+  r.AllocateLocal(kAstS128);
+  BUILD(r,
+        WASM_BLOCK(
+            WASM_SET_LOCAL(
+                2, WASM_SIMD_BINOP(simd_op,
+                                   WASM_SIMD_F32x4_SPLAT(WASM_GET_LOCAL(0)),
+                                   WASM_SIMD_F32x4_SPLAT(WASM_GET_LOCAL(1)))),
+            WASM_RETURN1(WASM_SIMD_F32x4_EXTRACT_LANE(2, WASM_GET_LOCAL(2)))));
+
+  FOR_FLOAT32_INPUTS(i) {
+    FOR_FLOAT32_INPUTS(j) {
+      CHECK_FLOAT_EQ(expected_op(*i, *j), r.Call(*i, *j));
+    }
+  }
+}
+
+static float FloatAdd(float a, float b) { return a + b; }
+static float FloatSub(float a, float b) { return a - b; }
+static float FloatMul(float a, float b) { return a * b; }
+
+WASM_EXEC_TEST(F32x4Add) { RunF32x4BinOpTest(kExprF32x4Add, FloatAdd); }
+WASM_EXEC_TEST(F32x4Sub) { RunF32x4BinOpTest(kExprF32x4Sub, FloatSub); }
+WASM_EXEC_TEST(F32x4Mul) { RunF32x4BinOpTest(kExprF32x4Mul, FloatMul); }
@@ -0,0 +1,25 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+print("Checks that only the async stacks of the tasks scheduled longest ago are dropped.");
+
+InspectorTest.addScript(`
+function testFunction() {
+  Promise.resolve().then(function first() { debugger; });
+  // More tasks than the debugger keeps stacks for are scheduled before any
+  // of them runs.
+  for (var i = 0; i < 140000; ++i) Promise.resolve().then(() => {});
+  Promise.resolve().then(function last() { debugger; });
+}`);
+
+Protocol.Debugger.enable();
+Protocol.Debugger.setAsyncCallStackDepth({ maxDepth: 1 });
+Protocol.Debugger.onPaused(message => {
+  var functionName = message.params.callFrames[0].functionName;
+  var hasAsyncStack = !!message.params.asyncStackTrace;
+  InspectorTest.log(`paused in ${functionName}, async stack: ${hasAsyncStack}`);
+  Protocol.Debugger.resume();
+});
+Protocol.Runtime.evaluate({ expression: "testFunction()" })
+  .then(InspectorTest.completeTest);
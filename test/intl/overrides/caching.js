@@ -39,7 +39,7 @@ var cachedTime = endTime.getTime() - startTime.getTime();
 // Not cached.
 startTime = new Date();
 for (var i = 0; i < 1000; i++) {
-  'a'.localeCompare('c', 'sr');
+  'a'.localeCompare('c', 'sr', {});
 }
 endTime = new Date();
 var nonCachedTime = endTime.getTime() - startTime.getTime();
@@ -57,3 +57,11 @@ collatorTime = endTime.getTime() - startTime.getTime();
 assertTrue(collatorTime < cachedTime);
 // Non-cached time is much slower, measured to 12.5 times.
 assertTrue(cachedTime < nonCachedTime);
+
+// The instance cached for a single locale is not reused for other locales.
+for (var i = 0; i < 3; i++) {
+  assertEquals(-1, '\u00e4'.localeCompare('z', 'de'));
+  assertEquals(1, '\u00e4'.localeCompare('z', 'sv'));
+  assertEquals('1.000', (1000).toLocaleString('de'));
+  assertEquals('1,000', (1000).toLocaleString('en'));
+}
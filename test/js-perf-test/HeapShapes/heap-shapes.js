@@ -0,0 +1,163 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Synthetic allocation profiles for different heap shapes. Run them under
+// d8 --benchmark to also get the scavenge and mark-compact pause
+// distributions and the peak heap size.
+
+new BenchmarkSuite('YoungHeavy', [1000], [
+  new Benchmark('YoungHeavy', false, false, 0,
+                YoungHeavy, YoungHeavySetup, YoungHeavyTearDown),
+]);
+
+new BenchmarkSuite('OldHeavy', [1000], [
+  new Benchmark('OldHeavy', false, false, 0,
+                OldHeavy, OldHeavySetup, OldHeavyTearDown),
+]);
+
+new BenchmarkSuite('ManyWeakMaps', [1000], [
+  new Benchmark('ManyWeakMaps', false, false, 0,
+                ManyWeakMaps, ManyWeakMapsSetup, ManyWeakMapsTearDown),
+]);
+
+new BenchmarkSuite('HugeArrays', [1000], [
+  new Benchmark('HugeArrays', false, false, 0,
+                HugeArrays, HugeArraysSetup, HugeArraysTearDown),
+]);
+
+new BenchmarkSuite('CodeChurn', [1000], [
+  new Benchmark('CodeChurn', false, false, 0,
+                CodeChurn, CodeChurnSetup, CodeChurnTearDown),
+]);
+
+var result;
+
+// ----------------------------------------------------------------------------
+// Short-lived objects only; almost everything dies in the young generation.
+
+function YoungHeavySetup() {
+  result = 0;
+}
+
+function YoungHeavy() {
+  var sum = 0;
+  for (var i = 0; i < 2000; i++) {
+    var point = {x: i, y: i + 1, label: 'p' + i};
+    sum += point.x + point.y + point.label.length;
+  }
+  result = sum;
+}
+
+function YoungHeavyTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+// A large long-lived object graph which is mutated slowly, so survivors get
+// promoted and the old generation keeps growing until it is trimmed.
+
+var oldGraph;
+var kOldGraphSize = 100000;
+
+function OldHeavySetup() {
+  oldGraph = [];
+  result = 0;
+}
+
+function OldHeavy() {
+  for (var i = 0; i < 500; i++) {
+    oldGraph.push({id: oldGraph.length, children: [], parent: null});
+  }
+  if (oldGraph.length > kOldGraphSize) oldGraph.length = kOldGraphSize / 2;
+  var node = oldGraph[oldGraph.length - 1];
+  node.parent = oldGraph[0];
+  oldGraph[0].children.push(node.id);
+  result = oldGraph.length;
+}
+
+function OldHeavyTearDown() {
+  oldGraph = undefined;
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+// Many WeakMaps with keys of mixed lifetimes, which stresses ephemeron
+// processing during marking.
+
+var weakMaps;
+var weakKeys;
+
+function ManyWeakMapsSetup() {
+  weakMaps = [];
+  weakKeys = [];
+  for (var i = 0; i < 100; i++) weakMaps.push(new WeakMap());
+  result = 0;
+}
+
+function ManyWeakMaps() {
+  for (var i = 0; i < 200; i++) {
+    var key = {i: i};
+    if (i % 4 == 0) weakKeys.push(key);
+    weakMaps[i % weakMaps.length].set(key, {value: key});
+  }
+  if (weakKeys.length > 10000) weakKeys = weakKeys.slice(5000);
+  result = weakKeys.length;
+}
+
+function ManyWeakMapsTearDown() {
+  weakMaps = undefined;
+  weakKeys = undefined;
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+// Arrays large enough for the large object space, replaced regularly.
+
+var hugeArrays;
+
+function HugeArraysSetup() {
+  hugeArrays = [];
+  result = 0;
+}
+
+function HugeArrays() {
+  var array = new Array(200000);
+  for (var i = 0; i < array.length; i += 1000) array[i] = i;
+  hugeArrays.push(array, new Float64Array(100000));
+  if (hugeArrays.length > 20) hugeArrays.splice(0, 10);
+  result = hugeArrays.length;
+}
+
+function HugeArraysTearDown() {
+  hugeArrays = undefined;
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+// Freshly compiled functions of which only some stay alive, which fragments
+// code space.
+
+var liveFunctions;
+var codeChurnCounter;
+
+function CodeChurnSetup() {
+  liveFunctions = [];
+  codeChurnCounter = 0;
+  result = 0;
+}
+
+function CodeChurn() {
+  for (var i = 0; i < 10; i++) {
+    var n = codeChurnCounter++;
+    var f = new Function('a', 'return a + ' + n + ';');
+    result = f(n);
+    if (n % 3 == 0) liveFunctions.push(f);
+  }
+  if (liveFunctions.length > 1000) liveFunctions = liveFunctions.slice(500);
+}
+
+function CodeChurnTearDown() {
+  liveFunctions = undefined;
+  return result > 0;
+}
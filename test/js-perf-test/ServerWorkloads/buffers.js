@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Encodes messages into a binary frame with a DataView header and decodes
+// them again, like a network protocol handler.
+
+new BenchmarkSuite('TypedArray-Framing', [1000], [
+  new Benchmark('TypedArray-Framing', false, false, 0,
+                Framing, FramingSetup, FramingTearDown),
+]);
+
+var payload;
+var decodedChecksum;
+
+function FramingSetup() {
+  payload = new Uint8Array(1024);
+  for (var i = 0; i < payload.length; i++) payload[i] = i & 0xff;
+  decodedChecksum = undefined;
+}
+
+function EncodeFrame(type, body) {
+  var frame = new Uint8Array(8 + body.length);
+  var view = new DataView(frame.buffer);
+  view.setUint32(0, body.length);
+  view.setUint16(4, type);
+  frame.set(body, 8);
+  return frame;
+}
+
+function DecodeFrame(frame) {
+  var view = new DataView(frame.buffer, frame.byteOffset, frame.byteLength);
+  var length = view.getUint32(0);
+  var body = frame.subarray(8, 8 + length);
+  var checksum = 0;
+  for (var i = 0; i < body.length; i++) checksum = (checksum + body[i]) | 0;
+  return checksum;
+}
+
+function Framing() {
+  decodedChecksum = 0;
+  for (var i = 0; i < 10; i++) {
+    var chunk = payload.subarray(i * 64, i * 64 + 512);
+    decodedChecksum += DecodeFrame(EncodeFrame(i, chunk));
+  }
+}
+
+function FramingTearDown() {
+  var expected = 0;
+  for (var i = 0; i < 10; i++) {
+    for (var j = i * 64; j < i * 64 + 512; j++) expected += j & 0xff;
+  }
+  return decodedChecksum === expected;
+}
@@ -0,0 +1,44 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A bounded least-recently-used cache built on Map insertion order, as
+// used in front of a database.
+
+new BenchmarkSuite('Map-LRUCache', [1000], [
+  new Benchmark('Map-LRUCache', false, false, 0,
+                LRUCache, LRUCacheSetup, LRUCacheTearDown),
+]);
+
+var cache;
+var cacheHits;
+var kCacheSize = 256;
+
+function LRUCacheSetup() {
+  cache = new Map();
+  cacheHits = 0;
+}
+
+function CacheGet(key) {
+  var value = cache.get(key);
+  if (value !== undefined) {
+    cache.delete(key);
+    cache.set(key, value);
+    cacheHits++;
+    return value;
+  }
+  value = {key: key, loaded: true};
+  cache.set(key, value);
+  if (cache.size > kCacheSize) cache.delete(cache.keys().next().value);
+  return value;
+}
+
+function LRUCache() {
+  for (var i = 0; i < 500; i++) {
+    CacheGet('session:' + ((i * 7919) % 400));
+  }
+}
+
+function LRUCacheTearDown() {
+  return cache.size === kCacheSize && cacheHits > 0;
+}
@@ -0,0 +1,50 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Parses a request body, updates it and serializes the response, like a
+// JSON API endpoint.
+
+new BenchmarkSuite('JSON-RoundTrip', [1000], [
+  new Benchmark('JSON-RoundTrip', false, false, 0,
+                JSONRoundTrip, JSONRoundTripSetup, JSONRoundTripTearDown),
+]);
+
+var requestBody;
+var responseBody;
+
+function JSONRoundTripSetup() {
+  var items = [];
+  for (var i = 0; i < 50; i++) {
+    items.push({
+      id: i,
+      name: 'item-' + i,
+      price: i * 1.25,
+      tags: ['tag' + (i % 7), 'tag' + (i % 11)],
+      inStock: i % 3 != 0
+    });
+  }
+  requestBody = JSON.stringify({user: {id: 42, name: 'Ada'}, items: items});
+  responseBody = undefined;
+}
+
+function JSONRoundTrip() {
+  var request = JSON.parse(requestBody);
+  var total = 0;
+  var items = request.items;
+  for (var i = 0; i < items.length; i++) {
+    if (items[i].inStock) total += items[i].price;
+  }
+  responseBody = JSON.stringify({
+    user: request.user.id,
+    count: items.length,
+    total: total,
+    items: items
+  });
+}
+
+function JSONRoundTripTearDown() {
+  var response = JSON.parse(responseBody);
+  return response.user === 42 && response.count === 50 &&
+         response.items[49].name === 'item-49';
+}
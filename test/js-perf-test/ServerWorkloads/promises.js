@@ -0,0 +1,48 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Handles a request through a chain of asynchronous middleware steps.
+
+new BenchmarkSuite('Promise-Chain', [1000], [
+  new Benchmark('Promise-Chain', false, false, 0,
+                PromiseChain, PromiseChainSetup, PromiseChainTearDown),
+]);
+
+var handledRequests;
+
+function PromiseChainSetup() {
+  handledRequests = 0;
+}
+
+function Authenticate(request) {
+  request.user = 'user' + request.id;
+  return request;
+}
+
+function LoadSession(request) {
+  return Promise.resolve({user: request.user, visits: request.id % 10})
+      .then(function(session) {
+        request.session = session;
+        return request;
+      });
+}
+
+function Respond(request) {
+  handledRequests++;
+  return {status: 200, body: request.session.user};
+}
+
+function PromiseChain() {
+  for (var i = 0; i < 20; i++) {
+    Promise.resolve({id: i})
+        .then(Authenticate)
+        .then(LoadSession)
+        .then(Respond);
+  }
+  %RunMicrotasks();
+}
+
+function PromiseChainTearDown() {
+  return handledRequests > 0 && handledRequests % 20 === 0;
+}
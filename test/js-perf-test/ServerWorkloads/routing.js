@@ -0,0 +1,49 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Matches request paths against a table of regular expression routes and
+// extracts their parameters.
+
+new BenchmarkSuite('RegExp-Routing', [1000], [
+  new Benchmark('RegExp-Routing', false, false, 0,
+                Routing, RoutingSetup, RoutingTearDown),
+]);
+
+var routes;
+var paths;
+var matchedRoutes;
+
+function RoutingSetup() {
+  routes = [
+    {name: 'home', pattern: /^\/$/},
+    {name: 'user', pattern: /^\/users\/(\d+)$/},
+    {name: 'post', pattern: /^\/users\/(\d+)\/posts\/([\w-]+)$/},
+    {name: 'search', pattern: /^\/search\?q=([^&]*)(?:&page=(\d+))?$/},
+    {name: 'static', pattern: /^\/static\/(.+)\.(css|js|png)$/}
+  ];
+  paths = ['/', '/users/17', '/users/17/posts/hello-world',
+           '/search?q=v8&page=2', '/static/app/main.js', '/missing'];
+  matchedRoutes = undefined;
+}
+
+function Route(path) {
+  for (var i = 0; i < routes.length; i++) {
+    var match = routes[i].pattern.exec(path);
+    if (match !== null) return {name: routes[i].name, params: match.slice(1)};
+  }
+  return null;
+}
+
+function Routing() {
+  matchedRoutes = [];
+  for (var i = 0; i < 50; i++) {
+    matchedRoutes.push(Route(paths[i % paths.length]));
+  }
+}
+
+function RoutingTearDown() {
+  return matchedRoutes[2].name === 'post' &&
+         matchedRoutes[2].params[1] === 'hello-world' &&
+         matchedRoutes[5] === null;
+}
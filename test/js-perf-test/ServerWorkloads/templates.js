@@ -0,0 +1,41 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Renders an HTML page from a list of records, with escaping, like a
+// server-side view.
+
+new BenchmarkSuite('Template-Render', [1000], [
+  new Benchmark('Template-Render', false, false, 0,
+                TemplateRender, TemplateRenderSetup, TemplateRenderTearDown),
+]);
+
+var records;
+var page;
+
+function TemplateRenderSetup() {
+  records = [];
+  for (var i = 0; i < 40; i++) {
+    records.push({title: 'Post <' + i + '> & co', author: 'user' + i,
+                  comments: i % 5});
+  }
+  page = undefined;
+}
+
+function EscapeHTML(s) {
+  return s.replace(/&/g, '&amp;').replace(/</g, '&lt;').replace(/>/g, '&gt;');
+}
+
+function TemplateRender() {
+  var rows = records.map(function(record) {
+    return `<li><h2>${EscapeHTML(record.title)}</h2>` +
+           `<span>${record.author}</span>` +
+           `<em>${record.comments} comments</em></li>`;
+  });
+  page = `<html><body><ul>${rows.join('')}</ul></body></html>`;
+}
+
+function TemplateRenderTearDown() {
+  return page.indexOf('Post &lt;39&gt; &amp; co') > 0 &&
+         page.indexOf('<') === 0;
+}
@@ -0,0 +1,92 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function CreateBenchmarkSuite(name, run, setup, tearDown) {
+  new BenchmarkSuite(name, [1000], [
+    new Benchmark('test', false, false, 0, run, setup, tearDown),
+  ]);
+}
+
+CreateBenchmarkSuite('EncodeURIComponent-Plain', EncodePlain, Setup,
+                     EncodePlainTearDown);
+CreateBenchmarkSuite('EncodeURIComponent-Query', EncodeQuery, Setup,
+                     EncodeQueryTearDown);
+CreateBenchmarkSuite('EncodeURIComponent-TwoByte', EncodeTwoByte, Setup,
+                     EncodeTwoByteTearDown);
+CreateBenchmarkSuite('DecodeURIComponent-Plain', DecodePlain, Setup,
+                     DecodePlainTearDown);
+CreateBenchmarkSuite('DecodeURIComponent-Query', DecodeQuery, Setup,
+                     DecodeQueryTearDown);
+CreateBenchmarkSuite('Escape', Escape, Setup, EscapeTearDown);
+CreateBenchmarkSuite('Unescape', Unescape, Setup, UnescapeTearDown);
+
+var result;
+
+// Path segments and query strings as handled by an HTTP router.
+var plain = "api-v2.users_12345~profile.settings".repeat(8);
+var query = "q=café au lait&sort=price desc&page=2&tags=a,b;c".repeat(8);
+var twoByte = "ユーザー=山田 太郎&".repeat(8);
+var encodedPlain = encodeURIComponent(plain);
+var encodedQuery = encodeURIComponent(query);
+var escapedQuery = escape(query);
+
+function Setup() {
+  result = undefined;
+}
+
+function EncodePlain() {
+  for (var i = 0; i < 10; i++) result = encodeURIComponent(plain);
+}
+
+function EncodePlainTearDown() {
+  return result === plain;
+}
+
+function EncodeQuery() {
+  for (var i = 0; i < 10; i++) result = encodeURIComponent(query);
+}
+
+function EncodeQueryTearDown() {
+  return result === encodedQuery;
+}
+
+function EncodeTwoByte() {
+  for (var i = 0; i < 10; i++) result = encodeURIComponent(twoByte);
+}
+
+function EncodeTwoByteTearDown() {
+  return decodeURIComponent(result) === twoByte;
+}
+
+function DecodePlain() {
+  for (var i = 0; i < 10; i++) result = decodeURIComponent(encodedPlain);
+}
+
+function DecodePlainTearDown() {
+  return result === plain;
+}
+
+function DecodeQuery() {
+  for (var i = 0; i < 10; i++) result = decodeURIComponent(encodedQuery);
+}
+
+function DecodeQueryTearDown() {
+  return result === query;
+}
+
+function Escape() {
+  for (var i = 0; i < 10; i++) result = escape(query);
+}
+
+function EscapeTearDown() {
+  return result === escapedQuery;
+}
+
+function Unescape() {
+  for (var i = 0; i < 10; i++) result = unescape(escapedQuery);
+}
+
+function UnescapeTearDown() {
+  return result === query;
+}
@@ -544,3 +544,24 @@ TestSortOnProxy();
   })()
 
 })();
+
+// Test the fast path for packed Smi arrays without a comparator.
+(function TestSmiLexicographicFastPath() {
+  var a = [10, 9, 1, -1, -10, 0, 100, -2, 1000000000, 2, 1];
+  a.sort();
+  assertArrayEquals(
+      [-1, -10, -2, 0, 1, 1, 10, 100, 1000000000, 2, 9], a);
+
+  // Sorting a copy-on-write literal must not change the boilerplate.
+  function literal() { return [3, 1, 2]; }
+  assertArrayEquals([1, 2, 3], literal().sort());
+  assertArrayEquals([3, 1, 2], literal());
+
+  // Holey arrays take the generic path.
+  var holey = [3, , 1];
+  holey.sort();
+  assertEquals(3, holey.length);
+  assertEquals(1, holey[0]);
+  assertEquals(3, holey[1]);
+  assertFalse(2 in holey);
+})();
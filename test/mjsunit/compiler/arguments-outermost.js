@@ -0,0 +1,116 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Strict arguments objects, with and without an arguments adaptor frame.
+(function() {
+  function f(a, b) {
+    "use strict";
+    return arguments;
+  }
+  function g(a, b) {
+    "use strict";
+    return arguments.length;
+  }
+  f(1, 2);
+  g(1, 2);
+  %OptimizeFunctionOnNextCall(f);
+  %OptimizeFunctionOnNextCall(g);
+  assertEquals([1, 2], Array.from(f(1, 2)));
+  assertEquals([1], Array.from(f(1)));
+  assertEquals([], Array.from(f()));
+  assertEquals([1, 2, 3, 4], Array.from(f(1, 2, 3, 4)));
+  assertEquals(2, g(1, 2));
+  assertEquals(0, g());
+  assertEquals(5, g(1, 2, 3, 4, 5));
+  assertEquals("[object Arguments]", Object.prototype.toString.call(f()));
+})();
+
+// Sloppy arguments objects without formal parameters.
+(function() {
+  function f() {
+    return arguments;
+  }
+  f(1);
+  f(1, 2);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([], Array.from(f()));
+  assertEquals([1, 2, 3], Array.from(f(1, 2, 3)));
+  assertSame(f, f().callee);
+  var args = f("a", "b");
+  args[0] = "c";
+  assertEquals(["c", "b"], Array.from(args));
+})();
+
+// Rest parameters, with and without an arguments adaptor frame.
+(function() {
+  function f(a, ...rest) {
+    return rest;
+  }
+  function g(...rest) {
+    return rest;
+  }
+  f(1, 2);
+  g(1, 2);
+  %OptimizeFunctionOnNextCall(f);
+  %OptimizeFunctionOnNextCall(g);
+  assertEquals([], f());
+  assertEquals([], f(1));
+  assertEquals([2], f(1, 2));
+  assertEquals([2, 3, 4], f(1, 2, 3, 4));
+  assertEquals([], g());
+  assertEquals([1, 2, 3], g(1, 2, 3));
+  assertTrue(Array.isArray(f(1, 2)));
+  f(1, 2).push(3);
+})();
+
+// Many parameters.
+(function() {
+  function f(...rest) {
+    return arguments.length + rest.length;
+  }
+  var many = [];
+  for (var i = 0; i < 10000; ++i) many.push(i);
+  f(1);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(20000, f.apply(null, many));
+  function g(a, ...rest) {
+    return rest[rest.length - 1];
+  }
+  g(1);
+  %OptimizeFunctionOnNextCall(g);
+  assertEquals(9999, g.apply(null, many));
+})();
+
+// Arguments objects that are only read and do not escape.
+(function() {
+  function sum() {
+    "use strict";
+    var result = 0;
+    for (var i = 0; i < arguments.length; ++i) result += arguments[i];
+    return result;
+  }
+  sum(1, 2);
+  sum(1, 2, 3);
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(0, sum());
+  assertEquals(6, sum(1, 2, 3));
+  assertEquals(15, sum(1, 2, 3, 4, 5));
+  assertEquals("0a1", sum("a", 1));
+})();
+
+// Deoptimization needs to materialize the arguments object.
+(function() {
+  function f(x, ...rest) {
+    var args = arguments;
+    x.y;
+    return [args.length, rest.length, args[args.length - 1]];
+  }
+  f({}, 1);
+  f({}, 1, 2);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals([3, 2, 2], f({}, 1, 2));
+  assertEquals([4, 3, 3], f({ y: 1, z: 2 }, 1, 2, 3));
+})();
@@ -0,0 +1,84 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-sharedarraybuffer
+
+var sab = new SharedArrayBuffer(64);
+
+function load(ta, index) { return Atomics.load(ta, index); }
+function store(ta, index, value) { return Atomics.store(ta, index, value); }
+
+function loadHandled(ta, index) {
+  try { return load(ta, index); } catch (e) { return e; }
+}
+
+function optimize() {
+  %OptimizeFunctionOnNextCall(load);
+  %OptimizeFunctionOnNextCall(store);
+}
+
+(function TestInt32() {
+  var ta = new Int32Array(sab, 8, 4);
+  store(ta, 0, 1);
+  store(ta, 3, -1);
+  assertEquals(1, load(ta, 0));
+  optimize();
+  assertEquals(-7, store(ta, 1, -7));
+  assertEquals(-7, load(ta, 1));
+  assertEquals(-1, load(ta, 3));
+  assertEquals(-7, new Int32Array(sab)[3]);
+})();
+
+(function TestUint32() {
+  var ta = new Uint32Array(sab);
+  store(ta, 0, 0);
+  assertEquals(0, load(ta, 0));
+  optimize();
+  assertEquals(0xffffffff, store(ta, 0, 0xffffffff));
+  assertEquals(0xffffffff, load(ta, 0));
+})();
+
+(function TestSmallTypes() {
+  var types = [Int8Array, Uint8Array, Int16Array, Uint16Array];
+  var expected = [-1, 255, -1, 65535];
+  for (var i = 0; i < types.length; ++i) {
+    var ta = new types[i](new SharedArrayBuffer(16));
+    store(ta, 0, 0);
+    load(ta, 0);
+    optimize();
+    assertEquals(-1, store(ta, 7, -1));
+    assertEquals(expected[i], load(ta, 7));
+    assertEquals(0, load(ta, 6));
+  }
+})();
+
+(function TestOutOfBounds() {
+  var ta = new Int32Array(sab, 0, 2);
+  load(ta, 0);
+  optimize();
+  assertEquals(0, load(ta, 1));
+  assertInstanceof(loadHandled(ta, 2), RangeError);
+  assertInstanceof(loadHandled(ta, -1), RangeError);
+  assertEquals(0, load(ta, "1"));
+})();
+
+(function TestNonShared() {
+  var ta = new Int32Array(sab);
+  load(ta, 0);
+  optimize();
+  load(ta, 0);
+  assertInstanceof(loadHandled(new Int32Array(4), 0), TypeError);
+  assertInstanceof(loadHandled(new Float64Array(sab), 0), TypeError);
+})();
+
+(function TestStoreConvertsValue() {
+  var ta = new Int32Array(sab);
+  store(ta, 0, 1);
+  optimize();
+  store(ta, 0, 1);
+  assertEquals(3, store(ta, 0, 3.5));
+  assertEquals(3, load(ta, 0));
+  assertEquals(0, store(ta, 0, "x"));
+  assertEquals(0, load(ta, 0));
+})();
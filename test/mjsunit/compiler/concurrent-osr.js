@@ -0,0 +1,26 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+function f(n) {
+  var sum = 0;
+  for (var i = 0; i < n; i++) {
+    sum += i;
+    // Request OSR, then let the queued job finish while the loop keeps
+    // running unoptimized code.
+    if (i == 100) %OptimizeOsr();
+    if (i == 200) %UnblockConcurrentRecompilation();
+  }
+  return sum;
+}
+
+assertEquals(49995000, f(10000));
+assertEquals(49995000, f(10000));
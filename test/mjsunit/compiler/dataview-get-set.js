@@ -0,0 +1,174 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+var buffer = new ArrayBuffer(64);
+var dataview = new DataView(buffer, 8, 24);
+var bytes = new Uint8Array(buffer);
+
+function readInt8Handled(offset) {
+  try { return dataview.getInt8(offset); } catch (e) { return e; }
+}
+function readUint8Handled(offset) {
+  try { return dataview.getUint8(offset); } catch (e) { return e; }
+}
+function readInt16Handled(offset, little_endian) {
+  try {
+    return dataview.getInt16(offset, little_endian);
+  } catch (e) {
+    return e;
+  }
+}
+function readUint16Handled(offset, little_endian) {
+  try {
+    return dataview.getUint16(offset, little_endian);
+  } catch (e) {
+    return e;
+  }
+}
+function readInt32Handled(offset, little_endian) {
+  try {
+    return dataview.getInt32(offset, little_endian);
+  } catch (e) {
+    return e;
+  }
+}
+function readUint32Handled(offset, little_endian) {
+  try {
+    return dataview.getUint32(offset, little_endian);
+  } catch (e) {
+    return e;
+  }
+}
+function readFloat32(offset, little_endian) {
+  return dataview.getFloat32(offset, little_endian);
+}
+function readFloat64(offset, little_endian) {
+  return dataview.getFloat64(offset, little_endian);
+}
+
+function warmUp(f) {
+  f(0, true);
+  f(0, false);
+  f(1, true);
+  f(1, false);
+  %OptimizeFunctionOnNextCall(f);
+  f(0, true);
+  f(0, false);
+}
+
+for (var i = 0; i < bytes.length; ++i) bytes[i] = 0;
+// Bytes 0xff 0xfe 0xfd 0xfc 0xfb 0xfa 0xf9 0xf8 starting at offset 1 of the
+// {dataview}, i.e. at an unaligned position.
+for (var i = 0; i < 8; ++i) bytes[9 + i] = 0xff - i;
+
+warmUp(readInt8Handled);
+warmUp(readUint8Handled);
+warmUp(readInt16Handled);
+warmUp(readUint16Handled);
+warmUp(readInt32Handled);
+warmUp(readUint32Handled);
+warmUp(readFloat32);
+warmUp(readFloat64);
+
+assertEquals(-1, readInt8Handled(1));
+assertEquals(0xff, readUint8Handled(1));
+assertEquals(-2, readInt16Handled(1));
+assertEquals(-257, readInt16Handled(1, true));
+assertEquals(0xfffe, readUint16Handled(1, false));
+assertEquals(0xfeff, readUint16Handled(1, true));
+assertEquals(-66052, readInt32Handled(1));
+assertEquals(-50462977, readInt32Handled(1, true));
+assertEquals(0xfffefdfc, readUint32Handled(1, false));
+assertEquals(0xfcfdfeff, readUint32Handled(1, true));
+assertEquals(0xfffefdfc | 0, readInt32Handled(1, 0));
+assertEquals(0xfcfdfeff, readUint32Handled(1, "yes"));
+
+// Compare floating point values against a little endian Float32Array and
+// Float64Array view of byte swapped copies of the bytes.
+var swapped = new ArrayBuffer(8);
+var swapped_bytes = new Uint8Array(swapped);
+for (var i = 0; i < 8; ++i) swapped_bytes[i] = bytes[16 - i];
+assertSame(new Float64Array(swapped)[0], readFloat64(1, false));
+for (var i = 0; i < 4; ++i) swapped_bytes[i] = bytes[12 - i];
+assertSame(new Float32Array(swapped)[0], readFloat32(1, false));
+assertSame(new Float64Array(buffer.slice(9, 17))[0], readFloat64(1, true));
+assertSame(new Float32Array(buffer.slice(9, 13))[0], readFloat32(1, true));
+
+// Out of bounds reads throw.
+assertInstanceof(readInt8Handled(24), RangeError);
+assertInstanceof(readUint8Handled(-1), RangeError);
+assertInstanceof(readInt16Handled(23), RangeError);
+assertInstanceof(readUint16Handled(23, true), RangeError);
+assertInstanceof(readInt32Handled(21), RangeError);
+assertInstanceof(readUint32Handled(21, true), RangeError);
+assertEquals(0, readInt32Handled(20));
+
+function writeInt8(offset, value) {
+  dataview.setInt8(offset, value);
+}
+function writeUint16(offset, value, little_endian) {
+  dataview.setUint16(offset, value, little_endian);
+}
+function writeInt32(offset, value, little_endian) {
+  dataview.setInt32(offset, value, little_endian);
+}
+function writeFloat32(offset, value, little_endian) {
+  dataview.setFloat32(offset, value, little_endian);
+}
+function writeFloat64(offset, value, little_endian) {
+  dataview.setFloat64(offset, value, little_endian);
+}
+
+function warmUpWrite(f) {
+  f(0, 0, true);
+  f(0, 0, false);
+  f(3, 0, true);
+  %OptimizeFunctionOnNextCall(f);
+  f(0, 0, true);
+}
+
+warmUpWrite(writeInt8);
+warmUpWrite(writeUint16);
+warmUpWrite(writeInt32);
+warmUpWrite(writeFloat32);
+warmUpWrite(writeFloat64);
+
+writeInt8(3, -2);
+assertEquals(0xfe, bytes[11]);
+writeUint16(3, 0x1234);
+assertEquals(0x12, bytes[11]);
+assertEquals(0x34, bytes[12]);
+writeUint16(3, 0x12345678, true);
+assertEquals(0x78, bytes[11]);
+assertEquals(0x56, bytes[12]);
+writeInt32(5, -2);
+assertEquals([0xff, 0xff, 0xff, 0xfe], Array.from(bytes.subarray(13, 17)));
+writeInt32(5, 0x01020304, true);
+assertEquals([4, 3, 2, 1], Array.from(bytes.subarray(13, 17)));
+writeFloat32(5, 1.5);
+assertEquals(1.5, dataview.getFloat32(5));
+writeFloat32(5, -1.5, true);
+assertEquals(-1.5, dataview.getFloat32(5, true));
+writeFloat64(3, Math.PI);
+assertEquals(Math.PI, dataview.getFloat64(3));
+writeFloat64(3, -Math.E, true);
+assertEquals(-Math.E, dataview.getFloat64(3, true));
+writeFloat64(3, NaN);
+assertSame(NaN, dataview.getFloat64(3));
+assertThrows(() => writeFloat64(17, 0), RangeError);
+assertThrows(() => writeInt32(-1, 0), RangeError);
+
+// Accesses to a neutered buffer throw, like in unoptimized code.
+function readNeutered(view) {
+  return view.getUint32(0, true);
+}
+var neutered = new DataView(new ArrayBuffer(4));
+readNeutered(neutered);
+readNeutered(neutered);
+%OptimizeFunctionOnNextCall(readNeutered);
+assertEquals(0, readNeutered(neutered));
+%ArrayBufferNeuter(neutered.buffer);
+assertThrows(() => readNeutered(neutered), RangeError);
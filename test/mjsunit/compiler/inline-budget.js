@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --noalways-opt
+// Flags: --max-inlined-nodes-cumulative=20
+
+// A call site that doesn't fit into the remaining inlining budget must not
+// be inlined, but it doesn't stop less frequent, smaller call sites from
+// being inlined. Whether a callee got inlined is observed through the
+// property cell of the global it loads: changing the global only deopts
+// the caller if the load was inlined into it.
+
+var big_value = 1;
+var small_value = 2;
+
+function big(x) {
+  var a = x + big_value;
+  var b = a * 2;
+  var c = b - x;
+  var d = c + a;
+  var e = d * b;
+  var f = e - c;
+  var g = f + d;
+  var h = g * e;
+  var i = h - f;
+  var j = i + g;
+  return j | 0;
+}
+
+function small() {
+  return small_value;
+}
+
+function caller(x) {
+  var result = big(x);
+  if (x & 1) result += small();
+  return result;
+}
+
+for (var i = 0; i < 10; ++i) caller(i);
+%OptimizeFunctionOnNextCall(caller);
+caller(1);
+assertOptimized(caller);
+
+// {big} is the most frequent call site, but exceeds the budget.
+big_value = 3;
+caller(1);
+assertOptimized(caller);
+
+// {small} is still inlined after {big} has been skipped.
+small_value = 4;
+caller(1);
+assertUnoptimized(caller);
@@ -0,0 +1,83 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-escape
+
+// Test inlining of closures which are created in the optimized function.
+
+(function TestReadContext() {
+  function foo(x) {
+    var y = x + 1;
+    var f = function(a) { return a + y; };
+    return f(x);
+  }
+  assertEquals(3, foo(1));
+  assertEquals(5, foo(2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(7, foo(3));
+  assertEquals("aa1", foo("a"));
+})();
+
+(function TestWriteContext() {
+  function foo(x) {
+    var y = 0;
+    var f = (a) => { y = a * 2; };
+    f(x);
+    return y;
+  }
+  assertEquals(2, foo(1));
+  assertEquals(4, foo(2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo(3));
+  assertEquals(0.5, foo(0.25));
+})();
+
+(function TestEscapingClosure() {
+  var g;
+  function foo(x) {
+    var f = function() { return x; };
+    g = f;
+    return f();
+  }
+  assertEquals(1, foo(1));
+  assertEquals(2, foo(2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(3, foo(3));
+  assertEquals(3, g());
+  assertEquals(4, foo(4));
+  assertEquals(4, g());
+})();
+
+(function TestDeoptInClosure() {
+  function foo(x) {
+    var y = 1;
+    var f = function(a) {
+      y++;
+      return a.value + y;
+    };
+    var result = f(x);
+    return result + y;
+  }
+  assertEquals(5, foo({value: 1}));
+  assertEquals(6, foo({value: 2}));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(7, foo({value: 3}));
+  assertEquals("x22", foo({value: "x"}));
+})();
+
+(function TestStackTraceInClosure() {
+  function foo(x) {
+    var y = 1;
+    var f = function(a) {
+      y++;
+      if (a > 2) return new Error().stack;
+      return a + y;
+    };
+    return f(x);
+  }
+  assertEquals(3, foo(1));
+  assertEquals(4, foo(2));
+  %OptimizeFunctionOnNextCall(foo);
+  assertContains("at f ", foo(3));
+})();
@@ -0,0 +1,33 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --nostress-opt
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+// Flags: --concurrent-recompilation-queue-length=1
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+function f(x) { return x + 1; }
+function g(x) { return x + 2; }
+
+f(1); f(1);
+g(1); g(1);
+
+%OptimizeFunctionOnNextCall(f, "concurrent");
+assertEquals(2, f(1));
+// The queue is full with a job of the same priority, so g is not queued and
+// keeps running unoptimized code.
+%OptimizeFunctionOnNextCall(g, "concurrent");
+assertEquals(3, g(1));
+assertUnoptimized(f, "no sync");
+assertUnoptimized(g, "no sync");
+
+%UnblockConcurrentRecompilation();
+assertOptimized(f, "sync");
+assertUnoptimized(g, "sync");
+assertEquals(2, f(1));
+assertEquals(3, g(1));
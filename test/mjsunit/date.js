@@ -285,6 +285,19 @@ assertEquals(63157803500, Date.parse("+001972T23:50:03.500"));
 assertEquals(63157803000, Date.parse("+001972T23:50:03"));
 assertEquals(63072000000, Date.parse("+001972"));
 
+// Strings in the toISOString format round-trip, and out of range fields in
+// that format are handled like in any other ES5 date-time string.
+(function TestParseISOString() {
+  var times = [0, 1, -1, 63157803500, -62167219200000, 253402300799999];
+  for (var i = 0; i < times.length; i++) {
+    assertEquals(times[i], Date.parse(new Date(times[i]).toISOString()));
+  }
+  assertEquals(86400000, Date.parse("1970-01-01T24:00:00.000Z"));
+  assertEquals(NaN, Date.parse("1970-01-01T24:00:00.001Z"));
+  assertEquals(NaN, Date.parse("1970-01-01T00:60:00.000Z"));
+  assertEquals(NaN, Date.parse("1970-01-01T00:00:60.000Z"));
+})();
+
 
 // Ensure that ISO-years in the range 00-99 aren't translated to the range
 // 1950..2049.
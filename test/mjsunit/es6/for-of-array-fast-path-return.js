@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A return method that the loop body installs on the prototype chain of
+// array iterators is called when the body exits abruptly in the same
+// iteration, although the loop started iterating the array by index.
+
+var array_iterator_prototype = Object.getPrototypeOf([][Symbol.iterator]());
+
+(function() {
+  var receiver;
+  var seen = [];
+  for (var value of [1, 2, 3]) {
+    seen.push(value);
+    if (value === 2) {
+      array_iterator_prototype.return = function() {
+        receiver = this;
+        return {};
+      };
+      break;
+    }
+  }
+  assertEquals([1, 2], seen);
+  assertSame(array_iterator_prototype, Object.getPrototypeOf(receiver));
+  assertEquals({value: 3, done: false}, receiver.next());
+  delete array_iterator_prototype.return;
+})();
+
+// The lookup chain stays modified, so this loop uses the iterator throughout.
+(function() {
+  var returned = 0;
+  function f() {
+    for (var value of [1, 2, 3]) {
+      Object.prototype.return = function() { returned++; };
+      throw value;
+    }
+  }
+  assertThrowsEquals(f, 1);
+  assertEquals(1, returned);
+  delete Object.prototype.return;
+})();
+
+// Errors name the subject of the loop rather than internal temporaries.
+(function() {
+  var not_iterable = {};
+  try {
+    for (var value of not_iterable) {}
+    assertUnreachable();
+  } catch (e) {
+    assertInstanceof(e, TypeError);
+    assertEquals("not_iterable[Symbol.iterator] is not a function", e.message);
+  }
+})();
@@ -0,0 +1,123 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+function collect(iterable) {
+  var result = [];
+  for (var value of iterable) result.push(value);
+  return result;
+}
+
+// Packed, holey and double arrays.
+assertEquals([1, 2, 3], collect([1, 2, 3]));
+assertEquals([1, undefined, 3], collect([1, , 3]));
+assertEquals([1.5, 2.5], collect([1.5, 2.5]));
+assertEquals([], collect([]));
+collect([1, 2]);
+%OptimizeFunctionOnNextCall(collect);
+assertEquals([1, 2, 3], collect([1, 2, 3]));
+assertEquals(["a", "b"], collect("ab"));
+assertEquals([1, 2], collect(new Set([1, 2])));
+
+// Holes read through to the prototype chain.
+Array.prototype[1] = "proto";
+assertEquals([1, "proto", 3], collect([1, , 3]));
+delete Array.prototype[1];
+
+// Modifying the array while iterating over it is observed.
+(function() {
+  var array = [1, 2, 3];
+  var seen = [];
+  for (var value of array) {
+    seen.push(value);
+    if (value === 1) array.push(4);
+    if (value === 3) array.length = 0;
+  }
+  assertEquals([1, 2, 3], seen);
+})();
+
+// Destructuring, break and continue.
+(function() {
+  var sum = 0;
+  for (var [a, b] of [[1, 2], [3, 4], [5, 6]]) {
+    if (a === 3) continue;
+    if (a === 5) break;
+    sum += a + b;
+  }
+  assertEquals(3, sum);
+})();
+
+// Generators that yield inside of the loop.
+(function() {
+  function* g(array) {
+    for (var value of array) yield value * 2;
+  }
+  assertEquals([2, 4, 6], collect(g([1, 2, 3])));
+})();
+
+// Arrays with a different prototype use their own iterator.
+(function() {
+  class MyArray extends Array {
+    *[Symbol.iterator]() { yield "sub"; }
+  }
+  assertEquals(["sub"], collect(MyArray.from([1, 2])));
+  var array = [1, 2];
+  Object.setPrototypeOf(array, { *[Symbol.iterator]() { yield "proto"; } });
+  assertEquals(["proto"], collect(array));
+})();
+
+// Throwing from the loop body does not try to close the iterator.
+(function() {
+  function f() {
+    for (var value of [1, 2, 3]) {
+      if (value === 2) throw value;
+    }
+  }
+  assertThrowsEquals(f, 2);
+})();
+
+// Modifying %ArrayIteratorPrototype%.next while iterating continues with the
+// new next method at the current position.
+(function() {
+  var array_iterator_prototype = Object.getPrototypeOf([][Symbol.iterator]());
+  var next = array_iterator_prototype.next;
+  var seen = [];
+  for (var value of [1, 2, 3, 4]) {
+    seen.push(value);
+    if (value === 2) {
+      array_iterator_prototype.next = function() {
+        var result = next.call(this);
+        if (!result.done) result.value *= 10;
+        return result;
+      };
+    }
+  }
+  assertEquals([1, 2, 30, 40], seen);
+  assertEquals([10, 20], collect([1, 2]));
+  array_iterator_prototype.next = next;
+  assertEquals([1, 2], collect([1, 2]));
+})();
+
+// A modified Array.prototype[Symbol.iterator] is respected.
+(function() {
+  var values = Array.prototype[Symbol.iterator];
+  Array.prototype[Symbol.iterator] = function*() { yield "iterated"; };
+  assertEquals(["iterated"], collect([1, 2]));
+  Array.prototype[Symbol.iterator] = values;
+  assertEquals([1, 2], collect([1, 2]));
+})();
+
+// A return method on the prototype chain of array iterators is called on
+// abrupt exits.
+(function() {
+  var returned = 0;
+  Object.prototype.return = function() {
+    returned++;
+    return {};
+  };
+  for (var value of [1, 2, 3]) break;
+  assertEquals(1, returned);
+  delete Object.prototype.return;
+})();
@@ -0,0 +1,65 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The invariant checks after the get, set, has and deleteProperty traps
+// must still fire for non-configurable properties when the target also has
+// configurable ones.
+
+(function TestGet() {
+  var target = {a: 1};
+  Object.defineProperty(target, "b", {value: 2});
+  var p = new Proxy(target, {get() { return 42; }});
+  assertEquals(42, p.a);
+  assertEquals(42, p.c);
+  assertEquals(42, p[0]);
+  assertThrows(() => p.b, TypeError);
+  Object.defineProperty(target, "d", {get: undefined, set() {}});
+  assertThrows(() => p.d, TypeError);
+})();
+
+(function TestSet() {
+  var target = {a: 1};
+  Object.defineProperty(target, "b", {value: 2});
+  var p = new Proxy(target, {set() { return true; }});
+  p.a = 10;
+  p.c = 10;
+  assertEquals(1, target.a);
+  assertFalse("c" in target);
+  assertThrows(() => { p.b = 3; }, TypeError);
+  p.b = 2;
+})();
+
+(function TestHas() {
+  var target = {a: 1};
+  Object.defineProperty(target, "b", {value: 2});
+  var p = new Proxy(target, {has() { return false; }});
+  assertFalse("a" in p);
+  assertFalse("c" in p);
+  assertThrows(() => "b" in p, TypeError);
+  Object.preventExtensions(target);
+  assertThrows(() => "a" in p, TypeError);
+  assertFalse("c" in p);
+})();
+
+(function TestDeleteProperty() {
+  var target = {a: 1};
+  Object.defineProperty(target, "b", {value: 2});
+  var p = new Proxy(target, {deleteProperty() { return true; }});
+  assertTrue(delete p.a);
+  assertTrue(delete p.c);
+  assertThrows(() => delete p.b, TypeError);
+})();
+
+(function TestProxyTarget() {
+  var log = [];
+  var target = new Proxy({a: 1}, {
+    getOwnPropertyDescriptor(t, name) {
+      log.push(name);
+      return Reflect.getOwnPropertyDescriptor(t, name);
+    }
+  });
+  var p = new Proxy(target, {get() { return 42; }});
+  assertEquals(42, p.a);
+  assertEquals(["a"], log);
+})();
@@ -0,0 +1,67 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function args() { return Array.prototype.slice.call(arguments); }
+function count() { return arguments.length; }
+
+// Packed, holey and double arrays are spread without an intermediate copy.
+assertEquals([1, 2, 3], args(...[1, 2, 3]));
+assertEquals([1, undefined, 3], args(...[1, , 3]));
+assertEquals(3, count(...[1, , 3]));
+assertEquals([1.5, 2.5], args(...[1.5, 2.5]));
+assertEquals([1.5, undefined, 2.5], args(...[1.5, , 2.5]));
+assertEquals([], args(...[]));
+assertEquals(["a", {}], args(...["a", {}]));
+
+// Spreading into a constructor.
+assertEquals([2, 3], new Array(...[2, 3]));
+
+// The spread array is not modified by the callee.
+var spread = [1, 2];
+function modify() { arguments[0] = 10; return arguments[0]; }
+assertEquals(10, modify(...spread));
+assertEquals([1, 2], spread);
+
+// Null and undefined are not iterable.
+assertThrows(() => args(...null), TypeError);
+assertThrows(() => args(...undefined), TypeError);
+
+// Strings and other iterables still go through the iterator protocol.
+assertEquals(["a", "b"], args(..."ab"));
+assertEquals([1, 2], args(...new Set([1, 2])));
+
+// An own Symbol.iterator on the array is respected.
+var own = [1, 2, 3];
+own[Symbol.iterator] = function*() { yield 4; };
+assertEquals([4], args(...own));
+
+// Holes read through to an array prototype with elements.
+Array.prototype[1] = "proto";
+assertEquals([1, "proto", 3], args(...[1, , 3]));
+delete Array.prototype[1];
+
+// Subclass arrays with an overridden iterator.
+class MyArray extends Array {
+  *[Symbol.iterator]() { yield "sub"; }
+}
+assertEquals(["sub"], args(...MyArray.from([1, 2])));
+
+// A modified %ArrayIteratorPrototype%.next is respected.
+var array_iterator_prototype = Object.getPrototypeOf([][Symbol.iterator]());
+var next = array_iterator_prototype.next;
+array_iterator_prototype.next = function() {
+  var result = next.call(this);
+  if (!result.done) result.value *= 2;
+  return result;
+};
+assertEquals([2, 4], args(...[1, 2]));
+array_iterator_prototype.next = next;
+assertEquals([1, 2], args(...[1, 2]));
+
+// A modified Array.prototype[Symbol.iterator] is respected.
+var values = Array.prototype[Symbol.iterator];
+Array.prototype[Symbol.iterator] = function*() { yield "iterated"; };
+assertEquals(["iterated"], args(...[1, 2]));
+Array.prototype[Symbol.iterator] = values;
+assertEquals([1, 2], args(...[1, 2]));
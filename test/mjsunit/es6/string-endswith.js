@@ -417,3 +417,15 @@ assertThrows(function() {
 }, TypeError);
 re[Symbol.match] = false;
 assertEquals(false, "".startsWith(re));
+
+// Mixed one-byte and two-byte representations, and cons strings.
+var two_byte = "\u2603abc\u2603";
+assertTrue(two_byte.endsWith("c\u2603"));
+assertTrue(two_byte.endsWith("abc", 4));
+assertFalse(two_byte.endsWith("abd", 4));
+assertTrue("abcdef".endsWith("def"));
+assertFalse("abcdef".endsWith("\u2603ef"));
+var cons = "abcdefghijklmnop".concat("qrstuvwxyz");
+assertTrue(cons.endsWith("nopqrs", 19));
+assertTrue(cons.endsWith("jklmnopqrstuvwxyz"));
+assertFalse(cons.endsWith("jklmnopqrstuvwxyy"));
@@ -408,3 +408,15 @@ assertThrows(function() {
 }, TypeError);
 re[Symbol.match] = false;
 assertEquals(false, "".startsWith(re));
+
+// Mixed one-byte and two-byte representations, and cons strings.
+var two_byte = "\u2603abc\u2603";
+assertTrue(two_byte.startsWith("\u2603a"));
+assertTrue(two_byte.startsWith("abc", 1));
+assertFalse(two_byte.startsWith("abd", 1));
+assertTrue("abcdef".startsWith("abc"));
+assertFalse("abcdef".startsWith("ab\u2603"));
+var cons = "abcdefghijklmnop".concat("qrstuvwxyz");
+assertTrue(cons.startsWith("nopqrs", 13));
+assertTrue(cons.startsWith("abcdefghijklmnopq"));
+assertFalse(cons.startsWith("abcdefghijklmnopr"));
@@ -0,0 +1,42 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tests %TypedArray%.prototype.set between non-overlapping typed arrays of
+// different element types.
+
+var source = new Float64Array([NaN, -0, 1.5, -1.5, 255.5, 256, -129, 2.5,
+                               4294967297, -Infinity]);
+
+function check(constructor, expected) {
+  var target = new constructor(source.length + 1);
+  target.set(source, 1);
+  assertSame(0, target[0]);
+  for (var i = 0; i < expected.length; i++) {
+    assertSame(expected[i], target[i + 1], constructor.name + "[" + i + "]");
+  }
+}
+
+check(Int8Array, [0, 0, 1, -1, -1, 0, 127, 2, 1, 0]);
+check(Uint8Array, [0, 0, 1, 255, 255, 0, 127, 2, 1, 0]);
+check(Uint8ClampedArray, [0, 0, 2, 0, 255, 255, 0, 2, 255, 0]);
+check(Int16Array, [0, 0, 1, -1, 255, 256, -129, 2, 1, 0]);
+check(Uint32Array, [0, 0, 1, 4294967295, 255, 256, 4294967167, 2, 1, 0]);
+check(Float32Array, [NaN, -0, 1.5, -1.5, 255.5, 256, -129, 2.5,
+                     4294967296, -Infinity]);
+
+// Integer sources convert exactly.
+var ints = new Uint32Array([0, 1, 4294967295, 2147483648]);
+var int32s = new Int32Array(4);
+int32s.set(ints);
+assertArrayEquals([0, 1, -1, -2147483648], Array.from(int32s));
+var doubles = new Float64Array(4);
+doubles.set(ints);
+assertArrayEquals([0, 1, 4294967295, 2147483648], Array.from(doubles));
+
+// Copies into a different buffer leave the source untouched.
+var bytes = new Uint8Array([1, 2, 3]);
+var shorts = new Int16Array(3);
+shorts.set(bytes);
+assertArrayEquals([1, 2, 3], Array.from(shorts));
+assertArrayEquals([1, 2, 3], Array.from(bytes));
@@ -0,0 +1,52 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test that repeated references to the same name in one scope all resolve to
+// the right variable, through deserialized outer scopes of an eval.
+
+var g = "global";
+
+(function TestRepeatedReferences() {
+  var a = 1;
+  function outer() {
+    var b = 2;
+    return function inner() {
+      var c = 3;
+      return eval("a + b + c + a + b + c + (typeof g) + g + g");
+    };
+  }
+  assertEquals("12stringglobalglobal", outer()());
+})();
+
+(function TestRepeatedAssignments() {
+  var a = 0;
+  function f() {
+    eval("a; a = a + 1; a; a += 1; a");
+    return a;
+  }
+  assertEquals(2, f());
+  assertEquals(2, a);
+})();
+
+(function TestWithScope() {
+  var x = "outer";
+  var o = { x: "with" };
+  with (o) {
+    assertEquals("withwith", eval("x + x"));
+    eval("x; x = 'assigned'; x");
+  }
+  assertEquals("assigned", o.x);
+  assertEquals("outer", x);
+  delete o.x;
+  with (o) {
+    eval("x; x = 'again'; x");
+  }
+  assertEquals("again", x);
+})();
+
+(function TestShadowingInInnerScopes() {
+  var a = "outer";
+  assertEquals("innerinnerouter",
+               eval("(function() { var a = 'inner'; return a + a; })() + a"));
+})();
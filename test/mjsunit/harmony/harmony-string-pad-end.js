@@ -96,3 +96,16 @@
 (function TestTruncation() {
   assertEquals("ab", "a".padEnd(2, "bc"));
 })();
+
+
+(function TestTwoByte() {
+  assertEquals("abc\u2603\u2603\u2603", "abc".padEnd(6, "\u2603"));
+  assertEquals("\u2603xyx", "\u2603".padEnd(4, "xy"));
+  assertEquals("ab\u2603a\u2603", "ab".padEnd(5, "\u2603a"));
+})();
+
+
+(function TestInvalidLength() {
+  assertThrows(() => "a".padEnd(Math.pow(2, 40)), RangeError);
+  assertEquals("a", "a".padEnd(Math.pow(2, 40), ""));
+})();
@@ -96,3 +96,16 @@
 (function TestTruncation() {
   assertEquals("ba", "a".padStart(2, "bc"));
 })();
+
+
+(function TestTwoByte() {
+  assertEquals("\u2603\u2603\u2603abc", "abc".padStart(6, "\u2603"));
+  assertEquals("xyx\u2603", "\u2603".padStart(4, "xy"));
+  assertEquals("\u2603a\u2603ab", "ab".padStart(5, "\u2603a"));
+})();
+
+
+(function TestInvalidLength() {
+  assertThrows(() => "a".padStart(Math.pow(2, 40)), RangeError);
+  assertEquals("a", "a".padStart(Math.pow(2, 40), ""));
+})();
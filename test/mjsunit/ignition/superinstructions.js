@@ -0,0 +1,59 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --ignition-superinstructions --allow-natives-syntax
+
+function equal(a, b) {
+  if (a == b) return 1;
+  return 0;
+}
+
+function strictEqual(a, b) {
+  if (a === b) return 1;
+  return 0;
+}
+
+function count(n) {
+  var result = 0;
+  for (var i = 0; i < n; i++) result++;
+  return result;
+}
+
+for (var i = 0; i < 3; i++) {
+  assertEquals(1, equal(1, 1));
+  assertEquals(1, equal(1, "1"));
+  assertEquals(0, equal(1, 2));
+  assertEquals(1, equal(null, undefined));
+  assertEquals(1, strictEqual("a", "a"));
+  assertEquals(0, strictEqual(1, "1"));
+  assertEquals(10, count(10));
+  assertEquals(0, count(-1));
+  assertEquals(0, count(NaN));
+}
+
+%OptimizeFunctionOnNextCall(count);
+assertEquals(100, count(100));
+
+// The comparison leaves its result in the accumulator.
+function resultOf(a, b) {
+  var result = a < b;
+  if (result) return result;
+  return result;
+}
+assertTrue(resultOf(1, 2));
+assertFalse(resultOf(2, 1));
+
+// Comparisons are observable and happen exactly once.
+var calls = 0;
+var object = { valueOf: function() { calls++; return 5; } };
+assertEquals(5, count(object));
+assertEquals(6, calls);
+
+// Jumps that do not fit into an immediate operand.
+var body = "";
+for (var i = 0; i < 500; i++) body += "x = x + " + i + ";";
+var far = new Function("a", "b", "var x = 0; if (a === b) {" + body +
+                       "} return x;");
+assertEquals(124750, far(1, 1));
+assertEquals(0, far(1, 2));
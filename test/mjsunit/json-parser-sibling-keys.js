@@ -0,0 +1,28 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Make the transition tree branch after "a".
+var branch = [JSON.parse('{"a":1,"b":2}'), JSON.parse('{"a":1,"c":2}')];
+
+var list = JSON.parse(
+    '[{"a":1,"b":2},{"a":3,"b":4},{"a":5,"c":6},{"a":7,"c":8},' +
+    '{"d":9},1,{"a":10,"e":11},{"a":12,"e":"x"},{"a":13}]');
+
+assertEquals(9, list.length);
+assertEquals({a: 1, b: 2}, list[0]);
+assertEquals({a: 3, b: 4}, list[1]);
+assertEquals({a: 5, c: 6}, list[2]);
+assertEquals({a: 7, c: 8}, list[3]);
+assertEquals({d: 9}, list[4]);
+assertEquals(1, list[5]);
+assertEquals({a: 10, e: 11}, list[6]);
+assertEquals({a: 12, e: "x"}, list[7]);
+assertEquals({a: 13}, list[8]);
+
+assertTrue(%HaveSameMap(list[0], list[1]));
+assertTrue(%HaveSameMap(list[2], list[3]));
+assertTrue(%HaveSameMap(list[0], branch[0]));
+assertTrue(%HaveSameMap(list[2], branch[1]));
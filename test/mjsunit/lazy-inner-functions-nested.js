@@ -0,0 +1,139 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --min-preparse-length 1 --allow-natives-syntax --lazy-inner-functions
+
+// Test that inner functions which are skipped using the data recorded when
+// their outer function was preparsed still see the right variables.
+
+(function TestNestedClosures() {
+  function outer() {
+    var a = 1;
+    function middle() {
+      var b = 2;
+      function inner() {
+        var c = 3;
+        function innermost() {
+          return a + b + c;
+        }
+        return innermost;
+      }
+      return inner;
+    }
+    return middle;
+  }
+  assertEquals(6, outer()()()());
+})();
+
+(function TestShadowing() {
+  function outer() {
+    var a = "outer";
+    function middle() {
+      var a = "middle";
+      function inner() {
+        let a = "inner";
+        function innermost() { return a; }
+        return innermost;
+      }
+      function sibling() { return a; }
+      return [inner, sibling];
+    }
+    return [middle, function() { return a; }];
+  }
+  var functions = outer();
+  var middle_functions = functions[0]();
+  assertEquals("inner", middle_functions[0]()());
+  assertEquals("middle", middle_functions[1]());
+  assertEquals("outer", functions[1]());
+})();
+
+(function TestAssignmentInSkippedFunction() {
+  function outer() {
+    var counter = 0;
+    function middle() {
+      function inner() {
+        function increment() { counter++; }
+        return increment;
+      }
+      return inner;
+    }
+    var increment = middle()();
+    increment();
+    increment();
+    return counter;
+  }
+  assertEquals(2, outer());
+})();
+
+(function TestEvalInSkippedFunction() {
+  function outer() {
+    var a = 1;
+    function middle() {
+      var b = 2;
+      function inner() {
+        function innermost() { return eval("a + b"); }
+        return innermost;
+      }
+      return inner;
+    }
+    return middle;
+  }
+  assertEquals(3, outer()()()());
+})();
+
+(function TestLiterals() {
+  function outer() {
+    function middle() {
+      function inner(x = [1]) {
+        return [x, { y: /z/ }, function() { return [2]; }];
+      }
+      return inner;
+    }
+    return middle;
+  }
+  var result = outer()()();
+  assertEquals([1], result[0]);
+  assertEquals("z", result[1].y.source);
+  assertEquals([2], result[2]());
+})();
+
+(function TestStrictInnerFunction() {
+  function outer() {
+    function middle() {
+      function inner() {
+        "use strict";
+        function innermost() { return this; }
+        return innermost;
+      }
+      return inner;
+    }
+    return middle;
+  }
+  assertEquals(undefined, outer()()()());
+})();
+
+(function TestRecompilation() {
+  function outer() {
+    var a = 1;
+    function middle() {
+      var b = 2;
+      var c = 3;
+      function inner() {
+        function innermost() { return b; }
+        return innermost;
+      }
+      for (var i = 0; i < 3; ++i) {
+        if (i == 1) {
+          %OptimizeOsr();
+        }
+        assertEquals(2, b);
+        assertEquals(3, c);
+      }
+      return inner()();
+    }
+    return middle;
+  }
+  assertEquals(2, outer()());
+  assertEquals(2, outer()());
+})();
@@ -0,0 +1,60 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition --lazy-source-positions
+
+// Test that source positions that were omitted when compiling bytecode are
+// collected when a stack trace or error location needs them.
+
+function thrower() {
+  throw new Error("boom");
+}
+
+function caller() {
+  return 1 +
+      thrower();
+}
+
+(function TestStackTrace() {
+  try {
+    caller();
+    assertUnreachable();
+  } catch (e) {
+    var lines = e.stack.split("\n");
+    assertTrue(/thrower .*:11:9\)$/.test(lines[1]), lines[1]);
+    assertTrue(/caller .*:16:7\)$/.test(lines[2]), lines[2]);
+  }
+})();
+
+(function TestCallSites() {
+  var prepare = Error.prepareStackTrace;
+  Error.prepareStackTrace = function(error, frames) { return frames; };
+  try {
+    var frames = new Error().stack;
+    assertEquals(34, frames[0].getLineNumber());
+    assertEquals(18, frames[0].getColumnNumber());
+  } finally {
+    Error.prepareStackTrace = prepare;
+  }
+})();
+
+(function TestMessageLocation() {
+  function f(o) {
+    return o.x.y;
+  }
+  assertThrows(function() { f({}); }, TypeError);
+  try {
+    f({});
+  } catch (e) {
+    assertTrue(/f .*:44:\d+\)$/.test(e.stack.split("\n")[1]));
+  }
+})();
+
+(function TestEvalOrigin() {
+  function evaluate() {
+    return new Function("return new Error().stack;")();
+  }
+  var stack = evaluate();
+  assertTrue(/eval at evaluate .*:56:12\)/.test(stack), stack);
+})();
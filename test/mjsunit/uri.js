@@ -98,3 +98,16 @@ test("ab\u1234<\u0123");
   assertEquals('abc', encodeURI('abc'));
   assertEquals('abc', decodeURI('abc'));
 })();
+
+(function TestOneByte() {
+  assertEquals("%C3%A9%C3%BF%C2%80%20a", encodeURIComponent("\xe9\xff\x80 a"));
+  assertEquals("%C3%A9/%25?", encodeURI("\xe9/%?"));
+  assertEquals("a%2Fb", encodeURIComponent("a/b"));
+  assertEquals("a/b", encodeURI("a/b"));
+  assertEquals("\xe9\xff\x80 a", decodeURIComponent("%C3%A9%C3%BF%C2%80%20a"));
+  assertEquals("\xe9abc", decodeURIComponent("\xe9abc"));
+  assertEquals("ሴabc", decodeURIComponent("ሴabc"));
+  assertThrows(() => decodeURIComponent("%"), URIError);
+  var cons = "abcdefghijklmnopq".repeat(4) + "\xe9";
+  assertEquals(cons.slice(0, -1) + "%C3%A9", encodeURIComponent(cons));
+})();
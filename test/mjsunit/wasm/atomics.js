@@ -0,0 +1,87 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --wasm-atomics-prototype --harmony-sharedarraybuffer
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+function instantiate(memory) {
+  var builder = new WasmModuleBuilder();
+  builder.addImportedMemory("mem");
+  builder.addFunction("load", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kAtomicPrefix, kExprI32AtomicLoad, 2, 0])
+      .exportFunc();
+  builder.addFunction("load8", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kAtomicPrefix, kExprI32AtomicLoad8U, 0, 0])
+      .exportFunc();
+  builder.addFunction("load16", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kAtomicPrefix, kExprI32AtomicLoad16U, 1, 0])
+      .exportFunc();
+  builder.addFunction("store", kSig_v_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1,
+                kAtomicPrefix, kExprI32AtomicStore, 2, 0])
+      .exportFunc();
+  builder.addFunction("store8", kSig_v_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1,
+                kAtomicPrefix, kExprI32AtomicStore8U, 0, 0])
+      .exportFunc();
+  builder.addFunction("store16", kSig_v_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1,
+                kAtomicPrefix, kExprI32AtomicStore16U, 1, 0])
+      .exportFunc();
+  builder.addFunction("grow_memory", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprGrowMemory])
+      .exportFunc();
+  return builder.instantiate({mem: memory}).exports;
+}
+
+(function TestSharedMemory() {
+  var memory = new WebAssembly.Memory({initial: 1, maximum: 1, shared: true});
+  assertTrue(memory.buffer instanceof SharedArrayBuffer);
+  assertEquals(kPageSize, memory.buffer.byteLength);
+  // A shared memory needs a maximum.
+  assertThrows(() => new WebAssembly.Memory({initial: 1, shared: true}));
+})();
+
+(function TestAtomicLoadStore() {
+  var memory = new WebAssembly.Memory({initial: 1, maximum: 1, shared: true});
+  var exports = instantiate(memory);
+  var i32 = new Int32Array(memory.buffer);
+  var u8 = new Uint8Array(memory.buffer);
+  var u16 = new Uint16Array(memory.buffer);
+
+  exports.store(4, 0x01020304);
+  assertEquals(0x01020304, Atomics.load(i32, 1));
+  Atomics.store(i32, 2, -1);
+  assertEquals(-1, exports.load(8));
+
+  exports.store8(1, 0x1ff);
+  assertEquals(0xff, Atomics.load(u8, 1));
+  assertEquals(0xff, exports.load8(1));
+  exports.store16(2, 0x1ffff);
+  assertEquals(0xffff, Atomics.load(u16, 1));
+  assertEquals(0xffff, exports.load16(2));
+
+  assertTraps(kTrapMemOutOfBounds, () => exports.load(kPageSize - 3));
+  assertTraps(kTrapMemOutOfBounds, () => exports.store(kPageSize, 0));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load16(-1));
+})();
+
+(function TestSharedMemoryCannotGrow() {
+  var memory = new WebAssembly.Memory({initial: 1, maximum: 2, shared: true});
+  var exports = instantiate(memory);
+  var buffer = memory.buffer;
+  assertEquals(-1, exports.grow_memory(1));
+  assertSame(buffer, memory.buffer);
+  assertEquals(kPageSize, buffer.byteLength);
+})();
+
+(function TestAtomicsRequireNaturalAlignment() {
+  var builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.addFunction("load", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kAtomicPrefix, kExprI32AtomicLoad, 0, 0]);
+  assertThrows(() => builder.instantiate());
+})();
@@ -48,3 +48,67 @@ load("test/mjsunit/wasm/wasm-module-builder.js");
   gc();
   %ValidateWasmOrphanedInstance(i4);
 })();
+
+(function InstanceIndependentCodeIsShared() {
+  var builder = new WasmModuleBuilder();
+
+  builder.addMemory(1,1, true);
+  builder.addFunction("add", kSig_i_ii)
+    .addBody([
+      kExprGetLocal, 0,
+      kExprGetLocal, 1,
+      kExprI32Add
+    ]).exportFunc();
+  builder.addFunction("trap", kSig_i_v)
+    .addBody([
+      kExprUnreachable
+    ]).exportFunc();
+  builder.addFunction("load", kSig_i_v)
+    .addBody([
+      kExprI32Const, 0,
+      kExprI32LoadMem, 0, 0
+    ]).exportFunc();
+  builder.addFunction("store", kSig_v_i)
+    .addBody([
+      kExprI32Const, 0,
+      kExprGetLocal, 0,
+      kExprI32StoreMem, 0, 0
+    ]).exportFunc();
+  builder.addFunction("add_load", kSig_i_i)
+    .addBody([
+      kExprGetLocal, 0,
+      kExprCallFunction, 2,
+      kExprCallFunction, 0
+    ]).exportFunc();
+
+  var module = new WebAssembly.Module(builder.toBuffer());
+  var i1 = new WebAssembly.Instance(module);
+  var i2 = new WebAssembly.Instance(module);
+  var i3 = new WebAssembly.Instance(module);
+  %ValidateWasmInstancesChain(module, 3);
+
+  // Functions using the memory, and their callers, still use the memory of
+  // their own instance.
+  i1.exports.store(1);
+  i2.exports.store(2);
+  assertEquals(1, i1.exports.load());
+  assertEquals(2, i2.exports.load());
+  assertEquals(0, i3.exports.load());
+  assertEquals(11, i1.exports.add_load(10));
+  assertEquals(12, i2.exports.add_load(10));
+
+  // Shared code keeps working, and finds a live instance for the stack trace,
+  // when the instances it was created for are collected.
+  i1 = null;
+  i3 = null;
+  gc();
+  %ValidateWasmInstancesChain(module, 1);
+  assertEquals(5, i2.exports.add(2, 3));
+  try {
+    i2.exports.trap();
+    assertUnreachable();
+  } catch (e) {
+    assertContains("trap", e.stack);
+  }
+  assertEquals(12, i2.exports.add_load(10));
+})();
@@ -0,0 +1,8 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --expose-gc --stress-compaction --wasm-guard-regions
+
+// Memories with guard regions grow in place on 64-bit hosts.
+load("test/mjsunit/wasm/grow-memory.js");
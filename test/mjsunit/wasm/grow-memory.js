@@ -358,3 +358,56 @@ function testGrowMemoryOutOfBoundsOffset() {
 }
 
 testGrowMemoryOutOfBoundsOffset();
+
+function testGrowMemoryExportedMemory() {
+  var builder = genGrowMemoryBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs("memory");
+  var module = builder.instantiate();
+  var memory = module.exports.memory;
+  assertEquals(kPageSize, memory.buffer.byteLength);
+  module.exports.store(kPageSize - 4, 0xaced);
+
+  assertEquals(1, module.exports.grow_memory(2));
+  // The contents are visible through the new buffer.
+  assertEquals(3 * kPageSize, memory.buffer.byteLength);
+  assertEquals(0xaced, new Int32Array(memory.buffer)[kPageSize / 4 - 1]);
+  assertEquals(0xaced, module.exports.load(kPageSize - 4));
+  assertEquals(0, module.exports.load(3 * kPageSize - 4));
+  gc();
+  assertEquals(0xaced, module.exports.load(kPageSize - 4));
+}
+
+testGrowMemoryExportedMemory();
+
+function testGrowMemorySharedMemory() {
+  var builder = genGrowMemoryBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs("memory");
+  var exporting = builder.instantiate();
+  var memory = exporting.exports.memory;
+
+  builder = genGrowMemoryBuilder();
+  builder.addImportedMemory("memory");
+  var importing = builder.instantiate({memory: memory});
+  exporting.exports.store(kPageSize - 4, 0xaced);
+  assertEquals(0xaced, importing.exports.load(kPageSize - 4));
+
+  // Both instances see the grown memory, whichever one grows it.
+  assertEquals(1, importing.exports.grow_memory(1));
+  assertEquals(2 * kPageSize, memory.buffer.byteLength);
+  assertEquals(0xaced, exporting.exports.load(kPageSize - 4));
+  exporting.exports.store(2 * kPageSize - 4, 0xbeef);
+  assertEquals(0xbeef, importing.exports.load(2 * kPageSize - 4));
+
+  assertEquals(2, exporting.exports.grow_memory(1));
+  assertEquals(3 * kPageSize, memory.buffer.byteLength);
+  importing.exports.store(3 * kPageSize - 4, 0xcafe);
+  assertEquals(0xcafe, exporting.exports.load(3 * kPageSize - 4));
+  assertEquals(0xaced, new Int32Array(memory.buffer)[kPageSize / 4 - 1]);
+  gc();
+  assertEquals(0xbeef, exporting.exports.load(2 * kPageSize - 4));
+  assertEquals(0xbeef, importing.exports.load(2 * kPageSize - 4));
+}
+
+testGrowMemorySharedMemory();
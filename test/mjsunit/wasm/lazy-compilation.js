@@ -0,0 +1,95 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --expose-gc --wasm-lazy-compilation
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+function buildModule() {
+  var builder = new WasmModuleBuilder();
+  builder.addMemory(1, 2, false);
+  var sig_i_ii = builder.addType(kSig_i_ii);
+  // Passes its parameters as i64 to a function only called from wasm.
+  var add64 = builder.addFunction("add64", kSig_l_ll)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI64Add]);
+  var add = builder.addFunction("add", kSig_i_ii)
+      .addBody([
+        kExprGetLocal, 0, kExprI64UConvertI32,
+        kExprGetLocal, 1, kExprI64UConvertI32,
+        kExprCallFunction, add64.index,
+        kExprI32ConvertI64])
+      .exportFunc();
+  var sub = builder.addFunction("sub", kSig_i_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Sub]);
+  builder.addFunction("call_indirect", kSig_i_iii)
+      .addBody([
+        kExprGetLocal, 1,
+        kExprGetLocal, 2,
+        kExprGetLocal, 0,
+        kExprCallIndirect, sig_i_ii])
+      .exportFunc();
+  builder.addFunction("load", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  builder.addFunction("store", kSig_v_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32StoreMem, 0, 0])
+      .exportFunc();
+  builder.addFunction("grow_memory", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprGrowMemory])
+      .exportFunc();
+  builder.addFunction("never_called", kSig_v_v)
+      .addBody([kExprUnreachable])
+      .exportFunc();
+  builder.appendToTable([add.index, sub.index]);
+  return new WebAssembly.Module(builder.toBuffer());
+}
+
+(function TestLazyCompilation() {
+  var exports = new WebAssembly.Instance(buildModule()).exports;
+  // The first call compiles the function, the second one calls it directly.
+  assertEquals(5, exports.add(2, 3));
+  assertEquals(5, exports.add(2, 3));
+  assertEquals(9, exports.call_indirect(0, 4, 5));
+  assertEquals(-1, exports.call_indirect(1, 4, 5));
+  assertEquals(-1, exports.call_indirect(1, 4, 5));
+  assertTraps(kTrapFuncInvalid, () => exports.call_indirect(2, 4, 5));
+})();
+
+(function TestLazyCompilationAfterGrowMemory() {
+  var exports = new WebAssembly.Instance(buildModule()).exports;
+  exports.store(0, 11);
+  assertEquals(1, exports.grow_memory(1));
+  // {load} is compiled against the grown memory.
+  assertEquals(0, exports.load(kPageSize));
+  assertEquals(11, exports.load(0));
+  exports.store(2 * kPageSize - 4, 12);
+  assertEquals(12, exports.load(2 * kPageSize - 4));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load(2 * kPageSize));
+})();
+
+(function TestLazyCompilationPerInstance() {
+  var module = buildModule();
+  var exports1 = new WebAssembly.Instance(module).exports;
+  exports1.store(0, 1);
+  assertEquals(1, exports1.load(0));
+  // The second instance is cloned from the first one, including the code
+  // compiled so far, and compiles the rest for its own memory.
+  var exports2 = new WebAssembly.Instance(module).exports;
+  assertEquals(0, exports2.load(0));
+  exports2.store(4, 2);
+  assertEquals(2, exports2.load(4));
+  assertEquals(0, exports1.load(4));
+  assertEquals(7, exports2.add(3, 4));
+  gc();
+  assertEquals(7, exports1.add(3, 4));
+})();
+
+(function TestInvalidFunctionIsStillRejected() {
+  var builder = new WasmModuleBuilder();
+  builder.addFunction("invalid", kSig_i_v)
+      .addBody([kExprF32Const, 0, 0, 0, 0]);
+  assertThrows(() => new WebAssembly.Module(builder.toBuffer()),
+               WebAssembly.CompileError);
+})();
@@ -109,3 +109,31 @@ function testSelect10(t) {
 testSelect10(kAstI32);
 testSelect10(kAstF32);
 testSelect10(kAstF64);
+
+(function testParameterConversions() {
+  var builder = new WasmModuleBuilder();
+  builder.addFunction("id_i", kSig_i_i)
+    .addBody([kExprGetLocal, 0])
+    .exportFunc();
+  builder.addFunction("id_d", makeSig([kAstF64], [kAstF64]))
+    .addBody([kExprGetLocal, 0])
+    .exportFunc();
+  var exports = builder.instantiate().exports;
+
+  // Smis and heap numbers are converted inline, other values by ToNumber.
+  var valueOf_calls = 0;
+  var object = {valueOf: () => { valueOf_calls++; return 7.5; }};
+  assertEquals(3, exports.id_i(3));
+  assertEquals(3, exports.id_i(3.75));
+  assertEquals(-1, exports.id_i(0xffffffff));
+  assertEquals(7, exports.id_i(object));
+  assertEquals(12, exports.id_i("12"));
+  assertEquals(0, exports.id_i(undefined));
+  assertEquals(1, exports.id_i(true));
+  assertEquals(3, exports.id_d(3));
+  assertEquals(-2.5, exports.id_d(-2.5));
+  assertEquals(7.5, exports.id_d(object));
+  assertEquals(NaN, exports.id_d(undefined));
+  assertEquals(NaN, exports.id_d("x"));
+  assertEquals(2, valueOf_calls);
+})();
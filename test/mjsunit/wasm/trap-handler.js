@@ -0,0 +1,107 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --expose-wasm --expose-gc --wasm-trap-handler --stress-compaction
+
+// Out of bounds loads must trap the same way with and without explicit bounds
+// checks. On platforms without the trap handler this tests the bounds checks.
+
+load("test/mjsunit/wasm/wasm-constants.js");
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+var kSig_d_i = makeSig([kAstI32], [kAstF64]);
+
+function addLoads(builder) {
+  builder.addFunction("load", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  builder.addFunction("load8", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32LoadMem8S, 0, 0])
+      .exportFunc();
+  builder.addFunction("load16", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32LoadMem16S, 0, 0])
+      .exportFunc();
+  builder.addFunction("load64", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI64LoadMem, 0, 0, kExprI32ConvertI64])
+      .exportFunc();
+  builder.addFunction("loadf64", kSig_d_i)
+      .addBody([kExprGetLocal, 0, kExprF64LoadMem, 0, 0])
+      .exportFunc();
+  // The static offset 0x10000 plus any index is out of bounds of one page.
+  builder.addFunction("load_offset", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprI32LoadMem, 0, 0x80, 0x80, 0x04])
+      .exportFunc();
+  builder.addFunction("store", kSig_v_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32StoreMem, 0, 0])
+      .exportFunc();
+  builder.addFunction("grow_memory", kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprGrowMemory])
+      .exportFunc();
+}
+
+function checkLoads(exports, size) {
+  exports.store(0, 0x01020304);
+  assertEquals(0x01020304, exports.load(0));
+  assertEquals(4, exports.load8(0));
+  assertEquals(0x0304, exports.load16(0));
+  assertEquals(0x01020304, exports.load64(0));
+  assertEquals(0, exports.load(size - 4));
+  assertEquals(0, exports.loadf64(size - 8));
+
+  assertTraps(kTrapMemOutOfBounds, () => exports.load(size - 3));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load(size));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load8(size));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load16(size - 1));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load64(size - 7));
+  assertTraps(kTrapMemOutOfBounds, () => exports.loadf64(size - 4));
+  // Indices are unsigned.
+  assertTraps(kTrapMemOutOfBounds, () => exports.load(-1));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load(0x7fffffff));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load_offset(size - 0x10000));
+  assertTraps(kTrapMemOutOfBounds, () => exports.load_offset(-1));
+  assertTraps(kTrapMemOutOfBounds, () => exports.store(size, 1));
+}
+
+(function TestOutOfBoundsLoads() {
+  var builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  addLoads(builder);
+  var exports = builder.instantiate().exports;
+  checkLoads(exports, kPageSize);
+  // The code may be moved by the GC.
+  gc();
+  checkLoads(exports, kPageSize);
+})();
+
+(function TestOutOfBoundsLoadsAfterGrowMemory() {
+  var builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  addLoads(builder);
+  var exports = builder.instantiate().exports;
+  assertEquals(1, exports.grow_memory(2));
+  assertEquals(0, exports.load(2 * kPageSize));
+  checkLoads(exports, 3 * kPageSize);
+})();
+
+(function TestOutOfBoundsLoadsImportedMemory() {
+  var memory = new WebAssembly.Memory({initial: 2});
+  var builder = new WasmModuleBuilder();
+  builder.addImportedMemory("mem");
+  addLoads(builder);
+  var exports = builder.instantiate({mem: memory}).exports;
+  checkLoads(exports, 2 * kPageSize);
+  assertEquals(0x01020304, new Int32Array(memory.buffer)[0]);
+})();
+
+(function TestManyInstances() {
+  var builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  addLoads(builder);
+  var module = new WebAssembly.Module(builder.toBuffer());
+  for (var i = 0; i < 10; ++i) {
+    var exports = new WebAssembly.Instance(module).exports;
+    checkLoads(exports, kPageSize);
+    gc();
+  }
+})();
@@ -194,6 +194,15 @@ var kExprF64StoreMem = 0x36;
 var kExprMemorySize = 0x3b;
 var kExprGrowMemory = 0x39;
 
+// Atomic opcodes follow kAtomicPrefix.
+var kAtomicPrefix = 0xe6;
+var kExprI32AtomicLoad = 0x01;
+var kExprI32AtomicLoad8U = 0x02;
+var kExprI32AtomicLoad16U = 0x03;
+var kExprI32AtomicStore = 0x04;
+var kExprI32AtomicStore8U = 0x05;
+var kExprI32AtomicStore16U = 0x06;
+
 var kExprI32Add = 0x40;
 var kExprI32Sub = 0x41;
 var kExprI32Mul = 0x42;
@@ -0,0 +1,334 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
+
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/api.h"
+#include "src/base/platform/platform.h"
+#include "src/compiler-dispatcher/compiler-dispatcher-job.h"
+#include "src/flags.h"
+#include "src/handles.h"
+#include "src/objects-inl.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+class CompilerDispatcherTest : public TestWithContext {
+ public:
+  CompilerDispatcherTest() {}
+  ~CompilerDispatcherTest() override {}
+
+  static void SetUpTestCase() {
+    old_flag_ = i::FLAG_compiler_dispatcher;
+    i::FLAG_compiler_dispatcher = true;
+    TestWithContext::SetUpTestCase();
+  }
+
+  static void TearDownTestCase() {
+    TestWithContext::TearDownTestCase();
+    i::FLAG_compiler_dispatcher = old_flag_;
+  }
+
+ private:
+  static bool old_flag_;
+  DISALLOW_COPY_AND_ASSIGN(CompilerDispatcherTest);
+};
+
+bool CompilerDispatcherTest::old_flag_;
+
+namespace {
+
+// A platform that holds on to posted tasks until the test runs them.
+class MockPlatform : public v8::Platform {
+ public:
+  MockPlatform() : idle_task_(nullptr), time_(0.0), time_step_(0.0) {}
+  ~MockPlatform() override {
+    delete idle_task_;
+    for (Task* task : background_tasks_) delete task;
+    for (Task* task : foreground_tasks_) delete task;
+  }
+
+  size_t NumberOfAvailableBackgroundThreads() override { return 1; }
+
+  void CallOnBackgroundThread(Task* task,
+                              ExpectedRuntime expected_runtime) override {
+    background_tasks_.push_back(task);
+  }
+
+  void CallOnForegroundThread(v8::Isolate* isolate, Task* task) override {
+    foreground_tasks_.push_back(task);
+  }
+
+  void CallDelayedOnForegroundThread(v8::Isolate* isolate, Task* task,
+                                     double delay_in_seconds) override {
+    UNREACHABLE();
+  }
+
+  void CallIdleOnForegroundThread(v8::Isolate* isolate,
+                                  IdleTask* task) override {
+    ASSERT_TRUE(idle_task_ == nullptr);
+    idle_task_ = task;
+  }
+
+  bool IdleTasksEnabled(v8::Isolate* isolate) override { return true; }
+
+  double MonotonicallyIncreasingTime() override {
+    time_ += time_step_;
+    return time_;
+  }
+
+  void RunIdleTask(double deadline_in_seconds, double time_step) {
+    ASSERT_TRUE(idle_task_ != nullptr);
+    time_step_ = time_step;
+    IdleTask* task = idle_task_;
+    idle_task_ = nullptr;
+    task->Run(deadline_in_seconds);
+    delete task;
+  }
+
+  bool IdleTaskPending() const { return idle_task_ != nullptr; }
+
+  // Runs background tasks on the calling thread, which is sufficient to
+  // exercise the hand-off between the main thread and background tasks.
+  void RunBackgroundTasks() {
+    std::vector<Task*> tasks;
+    tasks.swap(background_tasks_);
+    for (Task* task : tasks) {
+      task->Run();
+      delete task;
+    }
+  }
+
+  bool BackgroundTasksPending() const { return !background_tasks_.empty(); }
+
+  void RunForegroundTasks() {
+    std::vector<Task*> tasks;
+    tasks.swap(foreground_tasks_);
+    for (Task* task : tasks) {
+      task->Run();
+      delete task;
+    }
+  }
+
+  bool ForegroundTasksPending() const { return !foreground_tasks_.empty(); }
+
+ private:
+  IdleTask* idle_task_;
+  double time_;
+  double time_step_;
+  std::vector<Task*> background_tasks_;
+  std::vector<Task*> foreground_tasks_;
+
+  DISALLOW_COPY_AND_ASSIGN(MockPlatform);
+};
+
+const char test_script[] = "(x) { x*x; }";
+
+class ScriptResource : public v8::String::ExternalOneByteStringResource {
+ public:
+  ScriptResource(const char* data, size_t length)
+      : data_(data), length_(length) {}
+  ~ScriptResource() override = default;
+
+  const char* data() const override { return data_; }
+  size_t length() const override { return length_; }
+
+ private:
+  const char* data_;
+  size_t length_;
+
+  DISALLOW_COPY_AND_ASSIGN(ScriptResource);
+};
+
+Handle<SharedFunctionInfo> CreateSharedFunctionInfo(
+    Isolate* isolate, ExternalOneByteString::Resource* resource) {
+  HandleScope scope(isolate);
+  Handle<String> source = isolate->factory()
+                              ->NewExternalStringFromOneByte(resource)
+                              .ToHandleChecked();
+  Handle<Script> script = isolate->factory()->NewScript(source);
+  Handle<SharedFunctionInfo> shared = isolate->factory()->NewSharedFunctionInfo(
+      isolate->factory()->NewStringFromAsciiChecked("f"),
+      isolate->builtins()->CompileLazy(), false);
+  SharedFunctionInfo::SetScript(shared, script);
+  shared->set_end_position(source->length());
+  shared->set_outer_scope_info(ScopeInfo::Empty(isolate));
+  return scope.CloseAndEscape(shared);
+}
+
+Handle<Object> RunJS(v8::Isolate* isolate, const char* script) {
+  return Utils::OpenHandle(
+      *v8::Script::Compile(
+           isolate->GetCurrentContext(),
+           v8::String::NewFromUtf8(isolate, script, v8::NewStringType::kNormal)
+               .ToLocalChecked())
+           .ToLocalChecked()
+           ->Run(isolate->GetCurrentContext())
+           .ToLocalChecked());
+}
+
+}  // namespace
+
+TEST_F(CompilerDispatcherTest, Construct) {
+  MockPlatform platform;
+  std::unique_ptr<CompilerDispatcher> dispatcher(
+      new CompilerDispatcher(i_isolate(), &platform, FLAG_stack_size));
+}
+
+TEST_F(CompilerDispatcherTest, IsEnqueued) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] =
+      "function g() { var y = 1; function f1(x) { return x * y }; return f1; } "
+      "g();";
+  Handle<JSFunction> f = Handle<JSFunction>::cast(RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(platform.IdleTaskPending());
+  dispatcher.AbortAll();
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+}
+
+TEST_F(CompilerDispatcherTest, FinishNow) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] =
+      "function g() { var y = 1; function f2(x) { return x * y }; return f2; } "
+      "g();";
+  Handle<JSFunction> f = Handle<JSFunction>::cast(RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_FALSE(shared->is_compiled());
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  ASSERT_TRUE(dispatcher.FinishNow(shared));
+  // Finishing removes the SFI from the queue.
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+}
+
+TEST_F(CompilerDispatcherTest, IdleTask) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  const char script[] =
+      "function g() { var y = 1; function f3(x) { return x * y }; return f3; } "
+      "g();";
+  Handle<JSFunction> f = Handle<JSFunction>::cast(RunJS(isolate(), script));
+  Handle<SharedFunctionInfo> shared(f->shared(), i_isolate());
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+
+  // Running the idle task with a deadline that has already passed does no
+  // work and reschedules the task.
+  platform.RunIdleTask(0.0, 1.0);
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(dispatcher.jobs_.begin()->second->status() ==
+              CompileJobStatus::kInitial);
+  ASSERT_TRUE(platform.IdleTaskPending());
+
+  // With enough idle time, the job is finished.
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  ASSERT_FALSE(platform.IdleTaskPending());
+}
+
+TEST_F(CompilerDispatcherTest, ParseOnBackgroundThread) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  ScriptResource script(test_script, strlen(test_script));
+  Handle<SharedFunctionInfo> shared =
+      CreateSharedFunctionInfo(i_isolate(), &script);
+
+  ASSERT_TRUE(dispatcher.Enqueue(shared));
+  CompilerDispatcherJob* job = dispatcher.jobs_.begin()->second.get();
+
+  // The first idle task prepares the job for parsing, and hands the parse
+  // step off to a background task.
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_TRUE(job->status() == CompileJobStatus::kReadyToParse);
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+  ASSERT_FALSE(platform.IdleTaskPending());
+
+  // The background task parses, and asks for an idle task to finish the job.
+  platform.RunBackgroundTasks();
+  ASSERT_TRUE(job->status() == CompileJobStatus::kParsed);
+  ASSERT_TRUE(platform.ForegroundTasksPending());
+
+  platform.RunForegroundTasks();
+  ASSERT_TRUE(platform.IdleTaskPending());
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+}
+
+TEST_F(CompilerDispatcherTest, EnqueueAndStep) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  ScriptResource script(test_script, strlen(test_script));
+  Handle<SharedFunctionInfo> shared =
+      CreateSharedFunctionInfo(i_isolate(), &script);
+
+  // The job is prepared right away, and its parse step is handed off to a
+  // background task without waiting for idle time.
+  ASSERT_TRUE(dispatcher.EnqueueAndStep(shared));
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared));
+  CompilerDispatcherJob* job = dispatcher.jobs_.begin()->second.get();
+  ASSERT_TRUE(job->status() == CompileJobStatus::kReadyToParse);
+  ASSERT_TRUE(platform.BackgroundTasksPending());
+
+  platform.RunBackgroundTasks();
+  ASSERT_TRUE(job->status() == CompileJobStatus::kParsed);
+
+  platform.RunForegroundTasks();
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+}
+
+TEST_F(CompilerDispatcherTest, ParseManyOnBackgroundThreads) {
+  MockPlatform platform;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  ScriptResource script1(test_script, strlen(test_script));
+  Handle<SharedFunctionInfo> shared1 =
+      CreateSharedFunctionInfo(i_isolate(), &script1);
+  ScriptResource script2(test_script, strlen(test_script));
+  Handle<SharedFunctionInfo> shared2 =
+      CreateSharedFunctionInfo(i_isolate(), &script2);
+
+  ASSERT_TRUE(dispatcher.EnqueueAndStep(shared1));
+  ASSERT_TRUE(dispatcher.EnqueueAndStep(shared2));
+
+  // The platform has a single background thread, so only one background task
+  // is posted, and it parses both functions.
+  ASSERT_EQ(1u, dispatcher.background_task_ids_.size());
+  platform.RunBackgroundTasks();
+  ASSERT_FALSE(platform.BackgroundTasksPending());
+  for (auto& entry : dispatcher.jobs_) {
+    ASSERT_TRUE(entry.second->status() == CompileJobStatus::kParsed);
+  }
+
+  platform.RunForegroundTasks();
+  platform.RunIdleTask(1000.0, 0.0);
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared1));
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared2));
+  ASSERT_TRUE(shared1->is_compiled());
+  ASSERT_TRUE(shared2->is_compiled());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -6,6 +6,7 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -204,6 +205,65 @@ TEST_F(BranchEliminationTest, BranchInsideLoopSame) {
   EXPECT_THAT(ret1, IsReturn(IsInt32Constant(2), effect, loop));
 }
 
+
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThan) {
+  // { if (i < n) return CheckBounds(i, n); else return n; }
+  // should be reduced to
+  // { if (i < n) return i; else return n; }
+  SimplifiedOperatorBuilder simplified(zone());
+  Node* index = Parameter(0);
+  Node* length = Parameter(1);
+  NodeProperties::SetType(index, Type::Unsigned31());
+  NodeProperties::SetType(length, Type::Unsigned31());
+  Node* condition =
+      graph()->NewNode(simplified.NumberLessThan(), index, length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* check = graph()->NewNode(simplified.CheckBounds(), index, length,
+                                 graph()->start(), if_true);
+  Node* ret1 = graph()->NewNode(common()->Return(), check, check, if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* ret2 =
+      graph()->NewNode(common()->Return(), length, graph()->start(), if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce();
+
+  EXPECT_THAT(ret1, IsReturn(index, graph()->start(), if_true));
+}
+
+
+TEST_F(BranchEliminationTest, CheckBoundsNotDominatedByLessThan) {
+  // { if (i < n) return n; else return CheckBounds(i, n); }
+  // should not be changed.
+  SimplifiedOperatorBuilder simplified(zone());
+  Node* index = Parameter(0);
+  Node* length = Parameter(1);
+  NodeProperties::SetType(index, Type::Unsigned31());
+  NodeProperties::SetType(length, Type::Unsigned31());
+  Node* condition =
+      graph()->NewNode(simplified.NumberLessThan(), index, length);
+  Node* branch =
+      graph()->NewNode(common()->Branch(), condition, graph()->start());
+
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* ret1 =
+      graph()->NewNode(common()->Return(), length, graph()->start(), if_true);
+
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* check = graph()->NewNode(simplified.CheckBounds(), index, length,
+                                 graph()->start(), if_false);
+  Node* ret2 = graph()->NewNode(common()->Return(), check, check, if_false);
+  graph()->SetEnd(graph()->NewNode(common()->End(2), ret1, ret2));
+
+  Reduce();
+
+  EXPECT_THAT(ret2, IsReturn(check, check, if_false));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
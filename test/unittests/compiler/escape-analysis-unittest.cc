@@ -7,9 +7,11 @@
 #include "src/compiler/escape-analysis-reducer.h"
 #include "src/compiler/graph-visualizer.h"
 #include "src/compiler/js-graph.h"
+#include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties.h"
 #include "src/compiler/simplified-operator.h"
 #include "src/compiler/types.h"
+#include "src/factory.h"
 #include "src/zone/zone-containers.h"
 #include "test/unittests/compiler/graph-unittest.h"
 
@@ -513,6 +515,47 @@ TEST_F(EscapeAnalysisTest, DISABLED_DeoptReplacementIdentity) {
   ASSERT_EQ(object_state, object_state2);
 }
 
+
+TEST_F(EscapeAnalysisTest, ObjectIsNumberWithKnownMap) {
+  Node* map = graph()->NewNode(
+      common()->HeapConstant(factory()->heap_number_map()));
+  BeginRegion();
+  Node* allocation = Allocate(Constant(HeapNumber::kSize));
+  Store(FieldAccessAtIndex(HeapObject::kMapOffset), allocation, map);
+  Node* finish = FinishRegion(allocation);
+  Node* check = graph()->NewNode(simplified()->ObjectIsNumber(), finish);
+  Node* result = Return(check);
+  EndGraph();
+
+  Analysis();
+
+  ExpectVirtual(allocation);
+
+  Transformation();
+
+  EXPECT_TRUE(HeapObjectMatcher(NodeProperties::GetValueInput(result, 0))
+                  .Is(factory()->true_value()));
+}
+
+
+TEST_F(EscapeAnalysisTest, ObjectIsReceiverWithUnknownMapEscapes) {
+  BeginRegion();
+  Node* allocation = Allocate(Constant(kPointerSize));
+  Store(FieldAccessAtIndex(HeapObject::kMapOffset), allocation, Constant(1));
+  Node* finish = FinishRegion(allocation);
+  Node* check = graph()->NewNode(simplified()->ObjectIsReceiver(), finish);
+  Node* result = Return(check);
+  EndGraph();
+
+  Analysis();
+
+  ExpectEscaped(allocation);
+
+  Transformation();
+
+  ASSERT_EQ(check, NodeProperties::GetValueInput(result, 0));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
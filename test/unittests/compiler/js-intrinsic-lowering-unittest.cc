@@ -7,6 +7,7 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/js-intrinsic-lowering.h"
 #include "src/compiler/js-operator.h"
+#include "src/factory.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
 #include "testing/gmock-support.h"
@@ -49,6 +50,28 @@ class JSIntrinsicLoweringTest : public GraphTest {
 };
 
 
+// -----------------------------------------------------------------------------
+// %_ArrayIteratorProtector
+
+
+TEST_F(JSIntrinsicLoweringTest, InlineArrayIteratorProtector) {
+  Node* const context = Parameter(0);
+  Node* const effect = graph()->start();
+  Node* const control = graph()->start();
+  Reduction const r = Reduce(graph()->NewNode(
+      javascript()->CallRuntime(Runtime::kInlineArrayIteratorProtector, 0),
+      context, effect, control));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_THAT(
+      r.replacement(),
+      IsReferenceEqual(
+          _, IsLoadField(AccessBuilder::ForCellValue(),
+                         IsHeapConstant(factory()->array_iterator_protector()),
+                         effect, control),
+          IsNumberConstant(Isolate::kArrayProtectorValid)));
+}
+
+
 // -----------------------------------------------------------------------------
 // %_IsSmi
 
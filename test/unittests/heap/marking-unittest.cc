@@ -124,6 +124,24 @@ TEST(Marking, SetAndClearRange) {
   free(bitmap);
 }
 
+TEST(Marking, SetRangeAtomicWithBitsAlreadySet) {
+  bool old_flag = FLAG_concurrent_marking;
+  FLAG_concurrent_marking = true;
+  Bitmap* bitmap = reinterpret_cast<Bitmap*>(
+      calloc(Bitmap::kSize / kPointerSize, kPointerSize));
+  // A bit inside both boundary cells is set already, e.g. by the marker.
+  reinterpret_cast<uint32_t*>(bitmap)[0] = 1 << 4;
+  reinterpret_cast<uint32_t*>(bitmap)[1] = 1 << 1;
+  bitmap->SetRange(2, Bitmap::kBitsPerCell + 3);
+  CHECK_EQ(reinterpret_cast<uint32_t*>(bitmap)[0], 0xffffffff << 2);
+  CHECK_EQ(reinterpret_cast<uint32_t*>(bitmap)[1], 0x7);
+  bitmap->ClearRange(2, Bitmap::kBitsPerCell + 3);
+  CHECK_EQ(reinterpret_cast<uint32_t*>(bitmap)[0], 0x0);
+  CHECK_EQ(reinterpret_cast<uint32_t*>(bitmap)[1], 0x0);
+  free(bitmap);
+  FLAG_concurrent_marking = old_flag;
+}
+
 TEST(Marking, ClearMultipleRanges) {
   Bitmap* bitmap = reinterpret_cast<Bitmap*>(
       calloc(Bitmap::kSize / kPointerSize, kPointerSize));
@@ -97,6 +97,33 @@ TEST(ScavengeJob, EnoughIdleTimeForScavengeLowScavengeSpeed) {
 }
 
 
+TEST(ScavengeJob, AllocationLimitLongIdleTime) {
+  size_t scavenge_speed = 256 * KB;
+  double idle_time = 2 * ScavengeJob::kAverageIdleTimeMs;
+  size_t expected_size = static_cast<size_t>(scavenge_speed * idle_time) -
+                         ScavengeJob::kBytesAllocatedBeforeNextIdleTask;
+  EXPECT_FALSE(ScavengeJob::ReachedIdleAllocationLimit(
+      scavenge_speed, expected_size - 1, kNewSpaceCapacity, idle_time));
+  EXPECT_TRUE(ScavengeJob::ReachedIdleAllocationLimit(
+      scavenge_speed, expected_size, kNewSpaceCapacity, idle_time));
+}
+
+
+TEST(ScavengeJob, RecordIdleTime) {
+  ScavengeJob job;
+  EXPECT_EQ(static_cast<double>(ScavengeJob::kAverageIdleTimeMs),
+            job.average_idle_time_ms());
+  job.RecordIdleTime(0);
+  EXPECT_EQ(static_cast<double>(ScavengeJob::kAverageIdleTimeMs),
+            job.average_idle_time_ms());
+  job.RecordIdleTime(3 * ScavengeJob::kAverageIdleTimeMs);
+  EXPECT_EQ(2 * ScavengeJob::kAverageIdleTimeMs, job.average_idle_time_ms());
+  for (int i = 0; i < 100; i++) job.RecordIdleTime(1000);
+  EXPECT_GE(static_cast<double>(ScavengeJob::kMaxIdleTimeMs),
+            job.average_idle_time_ms());
+}
+
+
 TEST(ScavengeJob, EnoughIdleTimeForScavengeHighScavengeSpeed) {
   size_t scavenge_speed = kNewSpaceCapacity;
   size_t new_space_size = 1 * MB;
@@ -0,0 +1,104 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ic/handler-configuration.h"
+#include "src/objects-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+int FieldHandler(bool is_inobject, bool is_double, int offset) {
+  return LoadHandlerTypeBit::encode(kLoadICHandlerForProperties) |
+         LoadHandlerIsConstant::encode(false) |
+         FieldOffsetIsInobject::encode(is_inobject) |
+         FieldOffsetIsDouble::encode(is_double) |
+         FieldOffsetOffset::encode(offset);
+}
+
+int ConstantHandler(int descriptor) {
+  return LoadHandlerTypeBit::encode(kLoadICHandlerForProperties) |
+         LoadHandlerIsConstant::encode(true) |
+         ConstantDescriptorIndex::encode(descriptor);
+}
+
+// Some offsets at the boundaries of the object layouts and of the encoding.
+const int kFieldOffsets[] = {
+    0,
+    kPointerSize,
+    JSObject::kHeaderSize,
+    JSObject::kMaxInstanceSize - kPointerSize,
+    FixedArray::kHeaderSize,
+    FixedArray::OffsetOfElementAt(kMaxNumberOfDescriptors),
+    FieldOffsetOffset::kMax};
+
+// Some descriptor indices at the boundaries of the encoding.
+const int kDescriptors[] = {0, 1, kMaxNumberOfDescriptors - 1,
+                            ConstantDescriptorIndex::kMax};
+
+}  // namespace
+
+TEST(HandlerConfigurationTest, FieldHandlerRoundTrip) {
+  for (int offset : kFieldOffsets) {
+    for (int bits = 0; bits < 4; ++bits) {
+      bool is_inobject = (bits & 1) != 0;
+      bool is_double = (bits & 2) != 0;
+      int handler = FieldHandler(is_inobject, is_double, offset);
+      EXPECT_TRUE(Smi::IsValid(handler));
+      EXPECT_LE(0, handler);
+      EXPECT_EQ(LoadHandlerTypeBit::encode(kLoadICHandlerForProperties),
+                handler & LoadHandlerTypeBit::kMask);
+      EXPECT_FALSE(LoadHandlerIsConstant::decode(handler));
+      EXPECT_EQ(is_inobject, FieldOffsetIsInobject::decode(handler));
+      EXPECT_EQ(is_double, FieldOffsetIsDouble::decode(handler));
+      EXPECT_EQ(offset, FieldOffsetOffset::decode(handler));
+    }
+  }
+}
+
+TEST(HandlerConfigurationTest, FieldIndexHandlerRoundTrip) {
+  for (int index = JSObject::kHeaderSize / kPointerSize;
+       index < JSObject::kMaxInstanceSize / kPointerSize; ++index) {
+    FieldIndex field = FieldIndex::ForInObjectOffset(index * kPointerSize);
+    int handler = field.GetLoadByFieldOffset();
+    EXPECT_EQ(LoadHandlerTypeBit::encode(kLoadICHandlerForProperties),
+              handler & LoadHandlerTypeBit::kMask);
+    EXPECT_FALSE(LoadHandlerIsConstant::decode(handler));
+    EXPECT_TRUE(FieldOffsetIsInobject::decode(handler));
+    EXPECT_FALSE(FieldOffsetIsDouble::decode(handler));
+    EXPECT_EQ(field.offset(), FieldOffsetOffset::decode(handler));
+  }
+}
+
+TEST(HandlerConfigurationTest, ConstantHandlerRoundTrip) {
+  EXPECT_LE(kMaxNumberOfDescriptors,
+            static_cast<int>(ConstantDescriptorIndex::kMax));
+  for (int descriptor : kDescriptors) {
+    int handler = ConstantHandler(descriptor);
+    EXPECT_TRUE(Smi::IsValid(handler));
+    EXPECT_LE(0, handler);
+    EXPECT_EQ(LoadHandlerTypeBit::encode(kLoadICHandlerForProperties),
+              handler & LoadHandlerTypeBit::kMask);
+    EXPECT_TRUE(LoadHandlerIsConstant::decode(handler));
+    EXPECT_EQ(descriptor, ConstantDescriptorIndex::decode(handler));
+  }
+}
+
+TEST(HandlerConfigurationTest, ElementsHandlerIsNotPropertyHandler) {
+  int handler = LoadHandlerTypeBit::encode(kLoadICHandlerForElements) |
+                KeyedLoadIsJsArray::encode(true) |
+                KeyedLoadConvertHole::encode(true) |
+                KeyedLoadElementsKind::encode(LAST_ELEMENTS_KIND);
+  EXPECT_TRUE(Smi::IsValid(handler));
+  EXPECT_EQ(LoadHandlerTypeBit::encode(kLoadICHandlerForElements),
+            handler & LoadHandlerTypeBit::kMask);
+  EXPECT_TRUE(KeyedLoadIsJsArray::decode(handler));
+  EXPECT_TRUE(KeyedLoadConvertHole::decode(handler));
+  EXPECT_EQ(LAST_ELEMENTS_KIND, KeyedLoadElementsKind::decode(handler));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -399,6 +399,15 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
     scorecard[Bytecodes::ToByte(Bytecode::kShiftRightSmi)] = 1;
   }
 
+  if (!FLAG_ignition_peephole || !FLAG_ignition_superinstructions) {
+    // Insert entries for fused bytecodes only emitted when superinstructions
+    // are enabled.
+#define MARK_TEST_AND_JUMP(Name) \
+  scorecard[Bytecodes::ToByte(Bytecode::k##Name)] = 1;
+    TEST_AND_JUMP_BYTECODE_LIST(MARK_TEST_AND_JUMP)
+#undef MARK_TEST_AND_JUMP
+  }
+
   // Check return occurs at the end and only once in the BytecodeArray.
   CHECK_EQ(final_bytecode, Bytecode::kReturn);
   CHECK_EQ(scorecard[Bytecodes::ToByte(final_bytecode)], 1);
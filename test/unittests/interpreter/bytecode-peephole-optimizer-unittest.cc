@@ -530,6 +530,64 @@ TEST_F(BytecodePeepholeOptimizerTest, MergeLdaZeroWithBinaryOp) {
   }
 }
 
+TEST_F(BytecodePeepholeOptimizerTest, MergeTestWithJump) {
+  bool old_flag = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = true;
+  Bytecode test_jump_replacement_triples[][3] = {
+      {Bytecode::kTestEqual, Bytecode::kJumpIfTrue,
+       Bytecode::kTestEqualJumpIfTrue},
+      {Bytecode::kTestEqual, Bytecode::kJumpIfToBooleanFalse,
+       Bytecode::kTestEqualJumpIfFalse},
+      {Bytecode::kTestEqualStrict, Bytecode::kJumpIfFalse,
+       Bytecode::kTestEqualStrictJumpIfFalse},
+      {Bytecode::kTestLessThan, Bytecode::kJumpIfToBooleanTrue,
+       Bytecode::kTestLessThanJumpIfTrue}};
+
+  for (auto test_jump_replacement : test_jump_replacement_triples) {
+    uint32_t reg_operand = Register(0).ToOperand();
+    uint32_t idx_operand = 1;
+    BytecodeNode first(test_jump_replacement[0], reg_operand, idx_operand);
+    BytecodeNode second(test_jump_replacement[1], 0u);
+    BytecodeLabel label;
+    optimizer()->Write(&first);
+    optimizer()->WriteJump(&second, &label);
+    CHECK_EQ(write_count(), 1);
+    CHECK_EQ(last_written().bytecode(), test_jump_replacement[2]);
+    CHECK_EQ(last_written().operand_count(), 3);
+    CHECK_EQ(last_written().operand(0), 0);
+    CHECK_EQ(last_written().operand(1), reg_operand);
+    CHECK_EQ(last_written().operand(2), idx_operand);
+    Reset();
+  }
+  FLAG_ignition_superinstructions = old_flag;
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, NotMergingTestWithJump) {
+  bool old_flag = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = false;
+  BytecodeNode first(Bytecode::kTestEqual, Register(0).ToOperand(), 1);
+  BytecodeNode second(Bytecode::kJumpIfToBooleanTrue, 0u);
+  BytecodeLabel label;
+  optimizer()->Write(&first);
+  optimizer()->WriteJump(&second, &label);
+  CHECK_EQ(write_count(), 2);
+  CHECK_EQ(last_written().bytecode(), Bytecode::kJumpIfTrue);
+  FLAG_ignition_superinstructions = old_flag;
+}
+
+TEST_F(BytecodePeepholeOptimizerTest, NotMergingTestWithJumpWideOperands) {
+  bool old_flag = FLAG_ignition_superinstructions;
+  FLAG_ignition_superinstructions = true;
+  BytecodeNode first(Bytecode::kTestEqual, Register(1000).ToOperand(), 1);
+  BytecodeNode second(Bytecode::kJumpIfTrue, 0u);
+  BytecodeLabel label;
+  optimizer()->Write(&first);
+  optimizer()->WriteJump(&second, &label);
+  CHECK_EQ(write_count(), 2);
+  CHECK_EQ(last_written(), second);
+  FLAG_ignition_superinstructions = old_flag;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
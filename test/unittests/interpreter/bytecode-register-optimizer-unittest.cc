@@ -267,6 +267,53 @@ TEST_F(BytecodeRegisterOptimizerTest, RangeOfTemporariesMaterializedForInput) {
   CHECK_EQ(output()->at(3).operand(2), 2);
 }
 
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceKeptAcrossConditionalJump) {
+  bool old_flag = FLAG_ignition_reo_across_jumps;
+  FLAG_ignition_reo_across_jumps = true;
+  Initialize(3, 1);
+  Register parameter = Register::FromParameterIndex(1, 3);
+  BytecodeNode node0(Bytecode::kLdar, parameter.ToOperand());
+  optimizer()->Write(&node0);
+  CHECK_EQ(write_count(), 0);
+  BytecodeLabel label;
+  BytecodeNode jump(Bytecode::kJumpIfFalse, 0, nullptr);
+  optimizer()->WriteJump(&jump, &label);
+  CHECK_EQ(write_count(), 2);
+  BytecodeNode node1(Bytecode::kLdar, parameter.ToOperand());
+  optimizer()->Write(&node1);
+  BytecodeNode node2(Bytecode::kReturn);
+  optimizer()->Write(&node2);
+  CHECK_EQ(write_count(), 3);
+  CHECK_EQ(output()->at(0).bytecode(), Bytecode::kLdar);
+  CHECK_EQ(output()->at(0).operand(0), parameter.ToOperand());
+  CHECK_EQ(output()->at(1).bytecode(), Bytecode::kJumpIfFalse);
+  CHECK_EQ(output()->at(2).bytecode(), Bytecode::kReturn);
+  FLAG_ignition_reo_across_jumps = old_flag;
+}
+
+TEST_F(BytecodeRegisterOptimizerTest, EquivalenceBrokenAtLabel) {
+  bool old_flag = FLAG_ignition_reo_across_jumps;
+  FLAG_ignition_reo_across_jumps = true;
+  Initialize(3, 1);
+  Register parameter = Register::FromParameterIndex(1, 3);
+  BytecodeNode node0(Bytecode::kLdar, parameter.ToOperand());
+  optimizer()->Write(&node0);
+  BytecodeLabel jump_label;
+  BytecodeNode jump(Bytecode::kJumpIfFalse, 0, nullptr);
+  optimizer()->WriteJump(&jump, &jump_label);
+  BytecodeLabel label;
+  optimizer()->BindLabel(&label);
+  BytecodeNode node1(Bytecode::kLdar, parameter.ToOperand());
+  optimizer()->Write(&node1);
+  BytecodeNode node2(Bytecode::kReturn);
+  optimizer()->Write(&node2);
+  CHECK_EQ(write_count(), 4);
+  CHECK_EQ(output()->at(2).bytecode(), Bytecode::kLdar);
+  CHECK_EQ(output()->at(2).operand(0), parameter.ToOperand());
+  CHECK_EQ(output()->at(3).bytecode(), Bytecode::kReturn);
+  FLAG_ignition_reo_across_jumps = old_flag;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -7,6 +7,7 @@
 
 using testing::InSequence;
 using testing::StrictMock;
+using testing::_;
 
 namespace v8 {
 namespace platform {
@@ -19,10 +20,19 @@ struct MockTask : public Task {
   MOCK_METHOD0(Die, void());
 };
 
+struct MockIdleTask : public IdleTask {
+  virtual ~MockIdleTask() { Die(); }
+  MOCK_METHOD1(Run, void(double deadline_in_seconds));
+  MOCK_METHOD0(Die, void());
+};
+
 
 class DefaultPlatformWithMockTime : public DefaultPlatform {
  public:
-  DefaultPlatformWithMockTime() : time_(0) {}
+  DefaultPlatformWithMockTime()
+      : DefaultPlatform(WorkStealingSupport::kDisabled,
+                        IdleTaskSupport::kEnabled),
+        time_(0) {}
   double MonotonicallyIncreasingTime() override { return time_; }
   void IncreaseTime(double seconds) { time_ += seconds; }
 
@@ -112,6 +122,73 @@ TEST(DefaultPlatformTest, PumpMessageLoopNoStarvation) {
 }
 
 
+TEST(DefaultPlatformTest, RunIdleTasks) {
+  InSequence s;
+
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  DefaultPlatformWithMockTime platform;
+  EXPECT_TRUE(platform.IdleTasksEnabled(isolate));
+  EXPECT_EQ(0.0, platform.RunIdleTasks(isolate, 42.0));
+
+  StrictMock<MockIdleTask>* task = new StrictMock<MockIdleTask>;
+  platform.CallIdleOnForegroundThread(isolate, task);
+  EXPECT_CALL(*task, Run(42.0 + 23.0));
+  EXPECT_CALL(*task, Die());
+  platform.IncreaseTime(23.0);
+  EXPECT_EQ(0.0, platform.RunIdleTasks(isolate, 42.0));
+}
+
+
+TEST(DefaultPlatformTest, RunIdleTasksStopsAtDeadline) {
+  InSequence s;
+
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  DefaultPlatformWithMockTime platform;
+  StrictMock<MockIdleTask>* task1 = new StrictMock<MockIdleTask>;
+  StrictMock<MockIdleTask>* task2 = new StrictMock<MockIdleTask>;
+  platform.CallIdleOnForegroundThread(isolate, task1);
+  platform.CallIdleOnForegroundThread(isolate, task2);
+  EXPECT_CALL(*task1, Run(10.0))
+      .WillOnce(testing::InvokeWithoutArgs([&platform]() {
+        platform.IncreaseTime(15.0);
+      }));
+  EXPECT_CALL(*task1, Die());
+  EXPECT_EQ(15.0, platform.RunIdleTasks(isolate, 10.0));
+
+  EXPECT_CALL(*task2, Run(_));
+  EXPECT_CALL(*task2, Die());
+  EXPECT_EQ(0.0, platform.RunIdleTasks(isolate, 10.0));
+}
+
+
+TEST(DefaultPlatformTest, IdleTasksDisabledByDefault) {
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  DefaultPlatform platform;
+  EXPECT_FALSE(platform.IdleTasksEnabled(isolate));
+}
+
+
+TEST(DefaultPlatformTest, PendingIdleTasksAreDestroyedOnShutdown) {
+  InSequence s;
+
+  int dummy;
+  Isolate* isolate = reinterpret_cast<Isolate*>(&dummy);
+
+  {
+    DefaultPlatformWithMockTime platform;
+    StrictMock<MockIdleTask>* task = new StrictMock<MockIdleTask>;
+    platform.CallIdleOnForegroundThread(isolate, task);
+    EXPECT_CALL(*task, Die());
+  }
+}
+
+
 TEST(DefaultPlatformTest, PendingDelayedTasksAreDestroyedOnShutdown) {
   InSequence s;
 
@@ -0,0 +1,124 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/v8-platform.h"
+#include "src/base/platform/platform.h"
+#include "src/libplatform/work-stealing-task-queue.h"
+#include "src/libplatform/worker-thread.h"
+#include "testing/gmock/include/gmock/gmock.h"
+
+using testing::InSequence;
+using testing::IsNull;
+using testing::StrictMock;
+
+namespace v8 {
+namespace platform {
+
+namespace {
+
+struct MockTask : public Task {
+  virtual ~MockTask() { Die(); }
+  MOCK_METHOD0(Run, void());
+  MOCK_METHOD0(Die, void());
+};
+
+
+class WorkStealingTaskQueueThread final : public base::Thread {
+ public:
+  WorkStealingTaskQueueThread(WorkStealingTaskQueue* queue, int index)
+      : Thread(Options("libplatform WorkStealingTaskQueueThread")),
+        queue_(queue),
+        index_(index) {}
+
+  void Run() override { EXPECT_THAT(queue_->GetNext(index_), IsNull()); }
+
+ private:
+  WorkStealingTaskQueue* queue_;
+  int index_;
+};
+
+}  // namespace
+
+
+TEST(WorkStealingTaskQueueTest, Basic) {
+  WorkStealingTaskQueue queue(1);
+  StrictMock<MockTask>* task = new StrictMock<MockTask>;
+  EXPECT_CALL(*task, Die());
+  queue.Append(task, Platform::kShortRunningTask);
+  Task* next = queue.GetNext(0);
+  EXPECT_EQ(task, next);
+  delete next;
+  queue.Terminate();
+  EXPECT_THAT(queue.GetNext(0), IsNull());
+}
+
+
+TEST(WorkStealingTaskQueueTest, ShortRunningTasksFirst) {
+  WorkStealingTaskQueue queue(1);
+  StrictMock<MockTask>* long_task = new StrictMock<MockTask>;
+  StrictMock<MockTask>* short_task = new StrictMock<MockTask>;
+  EXPECT_CALL(*long_task, Die());
+  EXPECT_CALL(*short_task, Die());
+  queue.Append(long_task, Platform::kLongRunningTask);
+  queue.Append(short_task, Platform::kShortRunningTask);
+  Task* first = queue.GetNext(0);
+  Task* second = queue.GetNext(0);
+  EXPECT_EQ(short_task, first);
+  EXPECT_EQ(long_task, second);
+  delete first;
+  delete second;
+  queue.Terminate();
+}
+
+
+TEST(WorkStealingTaskQueueTest, Steal) {
+  // Tasks are distributed round robin, so a single reader has to steal the
+  // tasks appended to the deques of the other workers.
+  static const int kNumWorkers = 4;
+  WorkStealingTaskQueue queue(kNumWorkers);
+  for (int i = 0; i < kNumWorkers; ++i) {
+    StrictMock<MockTask>* task = new StrictMock<MockTask>;
+    EXPECT_CALL(*task, Die());
+    queue.Append(task, Platform::kShortRunningTask);
+  }
+  for (int i = 0; i < kNumWorkers; ++i) {
+    delete queue.GetNext(0);
+  }
+  queue.Terminate();
+}
+
+
+TEST(WorkStealingTaskQueueTest, TerminateMultipleReaders) {
+  WorkStealingTaskQueue queue(2);
+  WorkStealingTaskQueueThread thread1(&queue, 0);
+  WorkStealingTaskQueueThread thread2(&queue, 1);
+  thread1.Start();
+  thread2.Start();
+  queue.Terminate();
+  thread1.Join();
+  thread2.Join();
+}
+
+
+TEST(WorkStealingTaskQueueTest, WorkerThreads) {
+  static const size_t kNumTasks = 10;
+
+  WorkStealingTaskQueue queue(2);
+  for (size_t i = 0; i < kNumTasks; ++i) {
+    InSequence s;
+    StrictMock<MockTask>* task = new StrictMock<MockTask>;
+    EXPECT_CALL(*task, Run());
+    EXPECT_CALL(*task, Die());
+    queue.Append(task, Platform::kShortRunningTask);
+  }
+
+  WorkerThread thread1(&queue, 0);
+  WorkerThread thread2(&queue, 1);
+
+  // The queue DCHECKS that it's empty in its destructor.
+  queue.Terminate();
+}
+
+}  // namespace platform
+}  // namespace v8
@@ -81,9 +81,11 @@
       'compiler/value-numbering-reducer-unittest.cc',
       'compiler/zone-stats-unittest.cc',
       'compiler-dispatcher/compiler-dispatcher-job-unittest.cc',
+      'compiler-dispatcher/compiler-dispatcher-unittest.cc',
       'counters-unittest.cc',
       'eh-frame-iterator-unittest.cc',
       'eh-frame-writer-unittest.cc',
+      'ic/handler-configuration-unittest.cc',
       'interpreter/bytecodes-unittest.cc',
       'interpreter/bytecode-array-builder-unittest.cc',
       'interpreter/bytecode-array-iterator-unittest.cc',
@@ -100,6 +102,7 @@
       'interpreter/interpreter-assembler-unittest.h',
       'libplatform/default-platform-unittest.cc',
       'libplatform/task-queue-unittest.cc',
+      'libplatform/work-stealing-task-queue-unittest.cc',
       'libplatform/worker-thread-unittest.cc',
       'heap/bitmap-unittest.cc',
       'heap/gc-idle-time-handler-unittest.cc',
@@ -126,6 +129,7 @@
       'wasm/switch-logic-unittest.cc',
       'wasm/wasm-macro-gen-unittest.cc',
       'wasm/wasm-module-builder-unittest.cc',
+      'zone/segmentpool-unittest.cc',
     ],
     'unittests_sources_arm': [  ### gcmole(arch:arm) ###
       'compiler/arm/instruction-selector-arm-unittest.cc',
@@ -2123,6 +2123,50 @@ TEST_F(ValueSerializerTestWithSharedArrayBufferTransfer,
   InvalidEncodeTest("new SharedArrayBuffer(32)");
 }
 
+class ValueSerializerTestWithSharedArrayBufferId
+    : public ValueSerializerTestWithSharedArrayBufferTransfer {
+ protected:
+  ValueSerializerTestWithSharedArrayBufferId() : serializer_delegate_(this) {}
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(
+        ValueSerializerTestWithSharedArrayBufferId* test)
+        : test_(test) {}
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+    Maybe<uint32_t> GetSharedArrayBufferId(
+        Isolate* isolate,
+        Local<SharedArrayBuffer> shared_array_buffer) override {
+      EXPECT_EQ(test_->input_buffer(), shared_array_buffer);
+      return Just<uint32_t>(0);
+    }
+
+   private:
+    ValueSerializerTestWithSharedArrayBufferId* test_;
+  };
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+
+  // The buffer is not marked for transfer; the delegate provides its id.
+  void BeforeEncode(ValueSerializer* serializer) override {}
+
+ private:
+  SerializerDelegate serializer_delegate_;
+};
+
+TEST_F(ValueSerializerTestWithSharedArrayBufferId,
+       RoundTripSharedArrayBufferById) {
+  RoundTripTest([this]() { return input_buffer(); },
+                [this](Local<Value> value) {
+                  ASSERT_TRUE(value->IsSharedArrayBuffer());
+                  EXPECT_EQ(output_buffer(), value);
+                });
+}
+
 TEST_F(ValueSerializerTest, UnsupportedHostObject) {
   InvalidEncodeTest("new ExampleHostObject()");
   InvalidEncodeTest("({ a: new ExampleHostObject() })");
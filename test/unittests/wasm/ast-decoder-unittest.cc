@@ -1196,6 +1196,38 @@ TEST_F(AstDecoderTest, LoadMemAlignment) {
   }
 }
 
+TEST_F(AstDecoderTest, AtomicMemAlignment) {
+  struct {
+    WasmOpcode load;
+    WasmOpcode store;
+    byte alignment;
+  } values[] = {
+      {kExprI32AtomicLoad8U, kExprI32AtomicStore8U, 0},    // --
+      {kExprI32AtomicLoad16U, kExprI32AtomicStore16U, 1},  // --
+      {kExprI32AtomicLoad, kExprI32AtomicStore, 2},        // --
+  };
+
+  EXPECT_FAILURE(i_i, WASM_ATOMIC_LOAD_MEM(kExprI32AtomicLoad, 2, WASM_ZERO));
+  FLAG_wasm_atomics_prototype = true;
+  for (size_t i = 0; i < arraysize(values); i++) {
+    for (byte alignment = 0; alignment <= 3; alignment++) {
+      byte load[] = {
+          WASM_ATOMIC_LOAD_MEM(values[i].load, alignment, WASM_ZERO)};
+      byte store[] = {WASM_ATOMIC_STORE_MEM(values[i].store, alignment,
+                                            WASM_ZERO, WASM_ZERO)};
+      // Atomic accesses must be naturally aligned.
+      if (alignment == values[i].alignment) {
+        EXPECT_VERIFIES_C(i_i, load);
+        EXPECT_VERIFIES_C(v_i, store);
+      } else {
+        EXPECT_FAILURE_C(i_i, load);
+        EXPECT_FAILURE_C(v_i, store);
+      }
+    }
+  }
+  FLAG_wasm_atomics_prototype = false;
+}
+
 TEST_F(AstDecoderTest, StoreMemOffset) {
   for (int offset = 0; offset < 128; offset += 7) {
     byte code[] = {WASM_STORE_MEM_OFFSET(MachineType::Int32(), offset,
@@ -1227,6 +1227,37 @@ TEST_F(WasmModuleVerifyTest, Names_two_empty) {
   EXPECT_VERIFIES(data);
 }
 
+TEST_F(WasmModuleVerifyTest, DecodeFunctionNames) {
+  static const byte data[] = {
+      SIGNATURES_SECTION(1, SIG_ENTRY_v_v),      // --
+      FUNCTION_SIGNATURES_SECTION(2, 0, 0),      // --
+      SECTION(Code, 1 + 2 * SIZEOF_EMPTY_BODY),  // --
+      ENTRY_COUNT(2),
+      EMPTY_BODY,
+      EMPTY_BODY,  // --
+      SECTION_NAMES(1 + 10),
+      ENTRY_COUNT(2),  // --
+      FOO_STRING,
+      NO_LOCAL_NAMES,  // --
+      FOO_STRING,
+      NO_LOCAL_NAMES,  // --
+  };
+  const uint32_t kNumImportedFunctions = 1;
+  FunctionOffsetsResult result = DecodeWasmFunctionNames(
+      data, data + sizeof(data), kNumImportedFunctions);
+  EXPECT_TRUE(result.ok());
+  ASSERT_EQ(3u, result.val.size());
+  EXPECT_EQ(0, result.val[0].first);
+  EXPECT_EQ(0, result.val[0].second);
+  for (size_t i = 1; i < result.val.size(); ++i) {
+    const std::pair<int, int>& name = result.val[i];
+    EXPECT_EQ(3, name.second);
+    EXPECT_EQ('f', data[name.first]);
+    EXPECT_EQ('o', data[name.first + 2]);
+  }
+  EXPECT_LT(result.val[1].first, result.val[2].first);
+}
+
 #define EXPECT_INIT_EXPR(Type, type, value, ...)                 \
   {                                                              \
     static const byte data[] = {__VA_ARGS__, kExprEnd};          \
@@ -0,0 +1,54 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/accounting-allocator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(Zone, SegmentPoolReusesSegments) {
+  AccountingAllocator allocator;
+  Segment* segment = allocator.GetSegment(8 * KB);
+  EXPECT_EQ(0u, allocator.GetPoolHitCount());
+  EXPECT_EQ(1u, allocator.GetPoolMissCount());
+
+  allocator.ReturnSegment(segment);
+  EXPECT_LT(0u, allocator.GetCurrentPoolSize());
+
+  Segment* reused = allocator.GetSegment(8 * KB);
+  EXPECT_EQ(segment, reused);
+  EXPECT_EQ(1u, allocator.GetPoolHitCount());
+  EXPECT_EQ(1u, allocator.GetPoolMissCount());
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(reused);
+}
+
+TEST(Zone, SegmentPoolRefillsAfterMemoryPressure) {
+  AccountingAllocator allocator;
+  const int kSegments = 8;
+  Segment* segments[kSegments];
+  for (int i = 0; i < kSegments; i++) {
+    segments[i] = allocator.GetSegment(8 * KB);
+  }
+  for (int i = 0; i < kSegments; i++) {
+    allocator.ReturnSegment(segments[i]);
+  }
+  EXPECT_LT(0u, allocator.GetCurrentPoolSize());
+
+  // Memory pressure releases the pooled segments.
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kCritical);
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+
+  // Once the pressure is gone, returned segments are pooled again.
+  allocator.MemoryPressureNotification(MemoryPressureLevel::kNone);
+  Segment* segment = allocator.GetSegment(8 * KB);
+  allocator.ReturnSegment(segment);
+  EXPECT_LT(0u, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(segment, allocator.GetSegment(8 * KB));
+  allocator.ReturnSegment(segment);
+}
+
+}  // namespace internal
+}  // namespace v8